@@ -311,6 +311,40 @@ private:
 
 	typedef std::vector<UndoRecord> UndoBuffer;
 
+	// Lexer state carried over a line break, cached per line. An edit only has to
+	// rescan forward until the recomputed state of a line matches the cached one
+	// again; everything past that point is unaffected by the edit.
+	struct LineState
+	{
+		bool mKnown : 1;
+		bool mWithinString : 1;
+		bool mWithinComment : 1;
+		bool mWithinSingleLineComment : 1;
+		bool mWithinPreproc : 1;
+		bool mConcatenate : 1;
+		bool mFirstChar : 1;
+
+		LineState()
+			: mKnown(false), mWithinString(false), mWithinComment(false), mWithinSingleLineComment(false)
+			, mWithinPreproc(false), mConcatenate(false), mFirstChar(true)
+		{}
+
+		bool operator ==(const LineState& o) const
+		{
+			if (mWithinString != o.mWithinString || mWithinComment != o.mWithinComment || mConcatenate != o.mConcatenate)
+				return false;
+
+			// the remaining fields only leak into the next line through a '\' continuation
+			if (!mConcatenate)
+				return true;
+
+			return
+				mWithinSingleLineComment == o.mWithinSingleLineComment &&
+				mWithinPreproc == o.mWithinPreproc &&
+				mFirstChar == o.mFirstChar;
+		}
+	};
+
 	void ProcessInputs();
 	void Colorize(int aFromLine = 0, int aCount = -1);
 	void ColorizeRange(int aFromLine = 0, int aToLine = 0);
@@ -377,7 +411,8 @@ private:
 	LanguageDefinition mLanguageDefinition;
 	RegexList mRegexList;
 
-	bool mCheckComments;
+	int mCheckCommentsFrom;
+	std::vector<LineState> mLineStates;
 	Breakpoints mBreakpoints;
 	ErrorMarkers mErrorMarkers;
 	ImVec2 mCharAdvance;
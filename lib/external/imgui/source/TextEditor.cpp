@@ -22,7 +22,7 @@ bool equals(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, Bi
 }
 
 TextEditor::TextEditor()
-    : mLineSpacing(1.0f), mUndoIndex(0), mTabSize(4), mOverwrite(false), mReadOnly(false), mWithinRender(false), mScrollToCursor(false), mScrollToTop(false), mTextChanged(false), mColorizerEnabled(true), mTextStart(20.0f), mLeftMargin(10), mCursorPositionChanged(false), mColorRangeMin(0), mColorRangeMax(0), mSelectionMode(SelectionMode::Normal), mCheckComments(true), mLastClick(-1.0f), mHandleKeyboardInputs(true), mHandleMouseInputs(true), mIgnoreImGuiChild(false), mShowWhitespaces(true), mStartTime(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count()) {
+    : mLineSpacing(1.0f), mUndoIndex(0), mTabSize(4), mOverwrite(false), mReadOnly(false), mWithinRender(false), mScrollToCursor(false), mScrollToTop(false), mTextChanged(false), mColorizerEnabled(true), mTextStart(20.0f), mLeftMargin(10), mCursorPositionChanged(false), mColorRangeMin(0), mColorRangeMax(0), mSelectionMode(SelectionMode::Normal), mCheckCommentsFrom(0), mLastClick(-1.0f), mHandleKeyboardInputs(true), mHandleMouseInputs(true), mIgnoreImGuiChild(false), mShowWhitespaces(true), mStartTime(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count()) {
     SetPalette(GetDarkPalette());
     SetLanguageDefinition(LanguageDefinition::HLSL());
     mLines.push_back(Line());
@@ -502,6 +502,9 @@ void TextEditor::RemoveLine(int aStart, int aEnd) {
     mLines.erase(mLines.begin() + aStart, mLines.begin() + aEnd);
     assert(!mLines.empty());
 
+    if (aStart < (int)mLineStates.size())
+        mLineStates.erase(mLineStates.begin() + aStart, mLineStates.begin() + std::min((size_t)aEnd, mLineStates.size()));
+
     mTextChanged = true;
 }
 
@@ -529,6 +532,9 @@ void TextEditor::RemoveLine(int aIndex) {
     mLines.erase(mLines.begin() + aIndex);
     assert(!mLines.empty());
 
+    if (aIndex < (int)mLineStates.size())
+        mLineStates.erase(mLineStates.begin() + aIndex);
+
     mTextChanged = true;
 }
 
@@ -537,6 +543,9 @@ TextEditor::Line &TextEditor::InsertLine(int aIndex) {
 
     auto &result = *mLines.insert(mLines.begin() + aIndex, Line());
 
+    if (aIndex <= (int)mLineStates.size())
+        mLineStates.insert(mLineStates.begin() + aIndex, LineState());
+
     ErrorMarkers etmp;
     for (auto &i : mErrorMarkers)
         etmp.insert(ErrorMarkers::value_type(i.first >= aIndex ? i.first + 1 : i.first, i.second));
@@ -1001,6 +1010,7 @@ void TextEditor::Render(const char *aTitle, const ImVec2 &aSize, bool aBorder) {
 
 void TextEditor::SetText(const std::string &aText) {
     mLines.clear();
+    mLineStates.clear();
     mLines.emplace_back(Line());
     for (auto chr : aText) {
         if (chr == '\r') {
@@ -1023,6 +1033,7 @@ void TextEditor::SetText(const std::string &aText) {
 
 void TextEditor::SetTextLines(const std::vector<std::string> &aLines) {
     mLines.clear();
+    mLineStates.clear();
 
     if (aLines.empty()) {
         mLines.emplace_back(Line());
@@ -1849,7 +1860,7 @@ void TextEditor::Colorize(int aFromLine, int aLines) {
     mColorRangeMax = std::max(mColorRangeMax, toLine);
     mColorRangeMin = std::max(0, mColorRangeMin);
     mColorRangeMax = std::max(mColorRangeMin, mColorRangeMax);
-    mCheckComments = true;
+    mCheckCommentsFrom = std::min(mCheckCommentsFrom, std::max(0, aFromLine));
 }
 
 void TextEditor::ColorizeRange(int aFromLine, int aToLine) {
@@ -1946,7 +1957,9 @@ void TextEditor::ColorizeInternal() {
     if (mLines.empty() || !mColorizerEnabled)
         return;
 
-    if (mCheckComments) {
+    if (mCheckCommentsFrom < (int)mLines.size()) {
+        mLineStates.resize(mLines.size());
+
         auto endLine                 = mLines.size();
         auto endIndex                = 0;
         auto commentStartLine        = endLine;
@@ -1956,9 +1969,53 @@ void TextEditor::ColorizeInternal() {
         auto withinPreproc           = false;
         auto firstChar               = true;     // there is no other non-whitespace characters in the line before
         auto concatenate             = false;    // '\' on the very end of the line
-        auto currentLine             = 0;
+        auto currentLine             = std::max(0, mCheckCommentsFrom);
         auto currentIndex            = 0;
-        while (currentLine < endLine || currentIndex < endIndex) {
+
+        // Pick the scan up from the state the previous line ended in; everything
+        // before the first dirtied line is still valid
+        if (currentLine > 0) {
+            const auto &prevState = mLineStates[currentLine - 1];
+
+            withinString = prevState.mWithinString;
+            if (prevState.mConcatenate) {
+                withinSingleLineComment = prevState.mWithinSingleLineComment;
+                withinPreproc           = prevState.mWithinPreproc;
+                firstChar               = prevState.mFirstChar;
+                concatenate             = true;
+            }
+            if (prevState.mWithinComment) {
+                commentStartLine  = currentLine;
+                commentStartIndex = 0;
+            }
+        }
+
+        // Lines queued for token recoloring get rescanned unconditionally; past
+        // them the scan stops as soon as a line ends in the same state it ended
+        // in before the edit, since later lines cannot be affected anymore
+        const int minScanLine = std::min((int)endLine, std::max(mCheckCommentsFrom + 1, mColorRangeMax));
+
+        auto finishLine = [&]() {
+            LineState state;
+            state.mKnown                   = true;
+            state.mWithinString            = withinString;
+            state.mWithinComment           = commentStartLine <= (size_t)currentLine;
+            state.mWithinSingleLineComment = withinSingleLineComment;
+            state.mWithinPreproc           = withinPreproc;
+            state.mFirstChar               = firstChar;
+            state.mConcatenate             = concatenate;
+
+            auto &cached         = mLineStates[currentLine];
+            const bool converged = currentLine + 1 >= minScanLine && cached.mKnown && cached == state;
+            cached               = state;
+
+            currentIndex = 0;
+            ++currentLine;
+
+            return converged;
+        };
+
+        while (currentLine < (int)endLine) {
             auto &line = mLines[currentLine];
 
             if (currentIndex == 0 && !concatenate) {
@@ -2035,15 +2092,15 @@ void TextEditor::ColorizeInternal() {
                 line[currentIndex].mPreprocessor = withinPreproc;
                 currentIndex += UTF8CharLength(c);
                 if (currentIndex >= (int)line.size()) {
-                    currentIndex = 0;
-                    ++currentLine;
+                    if (finishLine())
+                        break;
                 }
             } else {
-                currentIndex = 0;
-                ++currentLine;
+                if (finishLine())
+                    break;
             }
         }
-        mCheckComments = false;
+        mCheckCommentsFrom = std::numeric_limits<int>::max();
     }
 
     if (mColorRangeMin < mColorRangeMax) {
@@ -9,6 +9,8 @@
 
 #include <functional>
 #include <map>
+#include <memory>
+#include <span>
 #include <unordered_map>
 #include <string>
 #include <string_view>
@@ -65,6 +67,13 @@ namespace hex {
             void store();
             void clear();
 
+            /**
+             * @brief Marks the in-memory settings document dirty and schedules a
+             * debounced background flush. write() calls this automatically; code
+             * mutating getSettingsData() directly calls it itself
+             */
+            void requestStore();
+
             void add(const std::string &unlocalizedCategory, const std::string &unlocalizedName, i64 defaultValue, const Callback &callback, bool requiresRestart = false);
             void add(const std::string &unlocalizedCategory, const std::string &unlocalizedName, const std::string &defaultValue, const Callback &callback, bool requiresRestart = false);
             void add(const std::string &unlocalizedCategory, const std::string &unlocalizedName, const std::vector<std::string> &defaultValue, const Callback &callback, bool requiresRestart = false);
@@ -254,11 +263,15 @@ namespace hex {
 
         /* Language Registry. Allows together with the LangEntry class and the _lang user defined literal to add new languages */
         namespace Language {
+            // Localizations are registered as factories and only materialized when
+            // their language is activated, so unselected languages cost nothing
+            using LanguageDefinitionFactory = std::function<LanguageDefinition()>;
+
             void registerLanguage(const std::string &name, const std::string &languageCode);
-            void addLocalizations(const std::string &languageCode, const LanguageDefinition &definition);
+            void addLocalizations(const std::string &languageCode, LanguageDefinitionFactory factory);
 
             std::map<std::string, std::string> &getLanguages();
-            std::map<std::string, std::vector<LanguageDefinition>> &getLanguageDefinitions();
+            std::map<std::string, std::vector<LanguageDefinitionFactory>> &getLanguageDefinitions();
         }
 
         /* Interface Registry. Allows adding new items to various interfaces */
@@ -362,11 +375,30 @@ namespace hex {
                     Callback callback;
                 };
 
+                using ExportHeaderCallback = std::function<std::string(u64 startAddress, size_t totalSize)>;
+                using ExportChunkCallback  = std::function<std::string(prv::Provider *provider, u64 address, size_t size, u64 startAddress, size_t totalSize)>;
+
+                /**
+                 * Formatter that can produce its output piecewise, so huge regions can be
+                 * streamed to a file chunk by chunk instead of being built up in memory.
+                 * Chunks are split at offsets relative to the region start that are
+                 * multiples of the alignment, so the callback results concatenate cleanly
+                 */
+                struct ExportEntry {
+                    std::string unlocalizedName;
+                    size_t chunkAlignment;
+                    ExportHeaderCallback begin;
+                    ExportChunkCallback chunk;
+                    ExportHeaderCallback end;
+                };
+
             }
 
             void add(const std::string &unlocalizedName, const impl::Callback &callback);
+            void addExport(const std::string &unlocalizedName, size_t chunkAlignment, const impl::ExportHeaderCallback &begin, const impl::ExportChunkCallback &chunk, const impl::ExportHeaderCallback &end);
 
             std::vector<impl::Entry> &getEntries();
+            std::vector<impl::ExportEntry> &getExportEntries();
 
         }
 
@@ -400,6 +432,16 @@ namespace hex {
                 virtual void draw(u64 address, const u8 *data, size_t size, bool upperCase) = 0;
                 virtual bool drawEditing(u64 address, u8 *data, size_t size, bool upperCase, bool startedEditing) = 0;
 
+                // The cell's rendered text, for visualizers that draw plain text.
+                // The hex editor caches this string and skips draw() entirely for
+                // unchanged cells; visualizers drawing something richer than text
+                // return std::nullopt and are called through draw() every frame
+                [[nodiscard]] virtual std::optional<std::string> format(u64 address, const u8 *data, size_t size, bool upperCase) {
+                    hex::unused(address, data, size, upperCase);
+
+                    return std::nullopt;
+                }
+
                 [[nodiscard]] u16 getBytesPerCell() const { return this->m_bytesPerCell; }
                 [[nodiscard]] u16 getMaxCharsPerCell() const { return this->m_maxCharsPerCell; }
 
@@ -437,14 +479,40 @@ namespace hex {
                 public:
                     using Callback = std::function<std::vector<u8>(const Region&, prv::Provider *)>;
 
+                    /**
+                     * @brief Incremental hashing context.
+                     *
+                     * Hashes that provide a context factory can be fed chunk by chunk, which
+                     * lets views compute all selected hashes from a single pass over the data
+                     * instead of reading it once per hash. finish() doesn't disturb the context,
+                     * so the digest can be read at any point and rolled forward with more data.
+                     */
+                    class Context {
+                    public:
+                        virtual ~Context() = default;
+
+                        virtual void update(const u8 *data, size_t size) = 0;
+                        [[nodiscard]] virtual std::vector<u8> finish() = 0;
+                    };
+
+                    using ContextFactory = std::function<std::unique_ptr<Context>()>;
+
                     Function(const Hash *type, std::string name, Callback callback)
                         : m_type(type), m_name(std::move(name)), m_callback(std::move(callback)) {
 
                     }
 
+                    Function(const Hash *type, std::string name, Callback callback, ContextFactory contextFactory)
+                        : m_type(type), m_name(std::move(name)), m_callback(std::move(callback)), m_contextFactory(std::move(contextFactory)) {
+
+                    }
+
                     [[nodiscard]] const Hash *getType() const { return this->m_type; }
                     [[nodiscard]] const std::string &getName() const { return this->m_name; }
 
+                    [[nodiscard]] bool isStreamable() const { return bool(this->m_contextFactory); }
+                    [[nodiscard]] std::unique_ptr<Context> createContext() const { return this->m_contextFactory(); }
+
                     const std::vector<u8>& get(const Region& region, prv::Provider *provider) {
                         if (this->m_cache.empty()) {
                             this->m_cache = this->m_callback(region, provider);
@@ -453,6 +521,14 @@ namespace hex {
                         return this->m_cache;
                     }
 
+                    [[nodiscard]] bool isCached() const {
+                        return !this->m_cache.empty();
+                    }
+
+                    void setCache(std::vector<u8> result) {
+                        this->m_cache = std::move(result);
+                    }
+
                     void reset() {
                         this->m_cache.clear();
                     }
@@ -461,6 +537,7 @@ namespace hex {
                     const Hash *m_type;
                     std::string m_name;
                     Callback m_callback;
+                    ContextFactory m_contextFactory;
 
                     std::vector<u8> m_cache;
                 };
@@ -477,6 +554,10 @@ namespace hex {
                     return { this, name, callback };
                 }
 
+                [[nodiscard]] Function create(const std::string &name, const Function::Callback &callback, const Function::ContextFactory &contextFactory) const {
+                    return { this, name, callback, contextFactory };
+                }
+
             private:
                 std::string m_unlocalizedName;
             };
@@ -494,6 +575,59 @@ namespace hex {
             }
 
         }
+
+        /* Data Metrics Registry. Allows adding streaming metrics to the data information analysis */
+        namespace DataMetrics {
+
+            /**
+             * @brief A streaming metric over the analyzed data.
+             *
+             * All registered metrics consume the same chunk stream during one analysis run,
+             * so adding a metric never adds another pass over the data. Chunks arrive back
+             * to back in ascending address order, each byte exactly once.
+             */
+            class Metric {
+            public:
+                explicit Metric(std::string unlocalizedName) : m_unlocalizedName(std::move(unlocalizedName)) {}
+
+                virtual ~Metric() = default;
+
+                /**
+                 * @brief Resets the metric's state before a new analysis run
+                 */
+                virtual void reset() = 0;
+
+                /**
+                 * @brief Consumes the next chunk of the data
+                 */
+                virtual void process(std::span<const u8> data) = 0;
+
+                /**
+                 * @brief Formats the metric's result after the last chunk was consumed
+                 */
+                [[nodiscard]] virtual std::string getResult() = 0;
+
+                [[nodiscard]] const std::string &getUnlocalizedName() const {
+                    return this->m_unlocalizedName;
+                }
+
+            private:
+                std::string m_unlocalizedName;
+            };
+
+            namespace impl {
+
+                std::vector<Metric*> &getMetrics();
+
+                void add(Metric *metric);
+            }
+
+            template<std::derived_from<Metric> T, typename ... Args>
+            void add(Args && ... args) {
+                impl::add(new T(std::forward<Args>(args)...));
+            }
+
+        }
     }
 
 }
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <hex.hpp>
+
+#include <hex/helpers/fs.hpp>
+
+#include <string>
+#include <vector>
+
+namespace hex {
+
+    namespace prv {
+        class Provider;
+    }
+
+    /**
+     * @brief Journals unsaved patches so a crash loses seconds of work, not hours
+     *
+     * Every provider with unsaved patches gets a journal file recording its type,
+     * its settings and a series of checkpoints. A checkpoint only contains the
+     * patch chunks that changed since the previous one; changed chunks are found
+     * by comparing the copy-on-write chunk pointers of the patch store, so the
+     * diff is a map walk instead of a byte comparison and the write cost scales
+     * with the edits made, never with the file size. All dirty providers are
+     * committed together in one throttled batch (group commit), so bursts of
+     * small edits share a single flush. Journals of cleanly closed providers are
+     * deleted; whatever survives a crash is offered for restoration on the next
+     * launch.
+     */
+    class CrashRecovery {
+    public:
+        struct PendingRecovery {
+            std::fs::path path;
+            std::string providerType;
+            std::string settings;
+        };
+
+        CrashRecovery() = delete;
+
+        /**
+         * @brief Marks a provider's patches as changed since its last checkpoint
+         */
+        static void providerDirtied(prv::Provider *provider);
+
+        /**
+         * @brief Closes and deletes the journal of a cleanly closed provider
+         */
+        static void providerClosed(prv::Provider *provider);
+
+        /**
+         * @brief Appends a checkpoint for every provider dirtied since the last one
+         *
+         * Throttled internally to one group commit every few seconds; pass force
+         * to commit immediately
+         */
+        static void commit(bool force = false);
+
+        /**
+         * @brief Returns the journals left behind by a crashed session
+         */
+        [[nodiscard]] static std::vector<PendingRecovery> getPendingRecoveries();
+
+        /**
+         * @brief Replays a journal's checkpoints onto a freshly opened provider
+         */
+        static bool restore(const PendingRecovery &recovery, prv::Provider *provider);
+
+        /**
+         * @brief Deletes a journal once it has been restored or rejected
+         */
+        static void discard(const PendingRecovery &recovery);
+    };
+
+}
@@ -2,10 +2,11 @@
 
 #include <hex.hpp>
 
-#include <list>
-#include <map>
+#include <atomic>
+#include <memory>
 #include <string_view>
 #include <functional>
+#include <vector>
 
 #include <hex/api/imhex_api.hpp>
 #include <hex/helpers/fs.hpp>
@@ -17,6 +18,7 @@
     }
 
 struct GLFWwindow;
+struct ImFontAtlas;
 
 namespace hex {
 
@@ -56,49 +58,74 @@ namespace hex {
 
     class EventManager {
     public:
-        using EventList = std::list<std::pair<EventId, EventBase *>>;
+        using SubscriptionId = u64;
+
+        struct Subscriber {
+            EventId id;
+            SubscriptionId subscriptionId;
+            std::shared_ptr<EventBase> event;
+        };
+        using EventList = std::vector<Subscriber>;
 
         template<typename E>
-        static EventList::iterator subscribe(typename E::Callback function) {
-            return s_events.insert(s_events.end(), std::make_pair(E::id, new E(function)));
+        static SubscriptionId subscribe(typename E::Callback function) {
+            return subscribeImpl(E::id, std::make_shared<E>(std::move(function)));
         }
 
         template<typename E>
         static void subscribe(void *token, typename E::Callback function) {
-            s_tokenStore.insert(std::make_pair(token, subscribe<E>(function)));
+            registerTokenSubscription(token, E::id, subscribe<E>(std::move(function)));
         }
 
-        static void unsubscribe(EventList::iterator iter) noexcept {
-            s_events.remove(*iter);
-        }
+        static void unsubscribe(SubscriptionId subscriptionId) noexcept;
 
         template<typename E>
         static void unsubscribe(void *token) noexcept {
-            auto iter = std::find_if(s_tokenStore.begin(), s_tokenStore.end(), [&](auto &item) {
-                return item.first == token && item.second->first == E::id;
-            });
-
-            if (iter != s_tokenStore.end()) {
-                s_events.remove(*iter->second);
-            }
+            unsubscribeToken(token, E::id);
         }
 
+        /**
+         * @brief Calls all subscribers of the event on the calling thread
+         *
+         * Posting iterates an immutable snapshot of the subscriber list, so the hot
+         * path never waits on (un)subscriptions; those publish a new snapshot instead.
+         * Snapshots a post still iterates keep their subscribers alive
+         */
         template<typename E>
         static void post(auto &&...args) noexcept {
-            for (const auto &[id, event] : s_events) {
-                if (id == E::id)
-                    (*static_cast<E *const>(event))(std::forward<decltype(args)>(args)...);
+            const auto events = s_events.load(std::memory_order_acquire);
+
+            for (const auto &subscriber : *events) {
+                if (subscriber.id == E::id)
+                    (*static_cast<E *const>(subscriber.event.get()))(std::forward<decltype(args)>(args)...);
             }
         }
 
-        static void clear() noexcept {
-            s_events.clear();
-            s_tokenStore.clear();
+        /**
+         * @brief Queues the event to be posted on the main thread
+         *
+         * Worker threads use this instead of post() when subscribers expect to run
+         * on the main thread. The queue is drained once per frame; arguments are
+         * captured by value since the event outlives the call
+         */
+        template<typename E>
+        static void postDeferred(auto ...args) {
+            enqueueDeferred([...args = std::move(args)] {
+                post<E>(args...);
+            });
         }
 
+        static void drainDeferred();
+
+        static void clear() noexcept;
+
     private:
-        static std::map<void *, EventList::iterator> s_tokenStore;
-        static EventList s_events;
+        static SubscriptionId subscribeImpl(EventId eventId, std::shared_ptr<EventBase> &&event);
+        static void registerTokenSubscription(void *token, EventId eventId, SubscriptionId subscriptionId);
+        static void unsubscribeToken(void *token, EventId eventId) noexcept;
+        static void enqueueDeferred(std::function<void()> &&event);
+
+        static std::atomic<std::shared_ptr<const EventList>> s_events;
     };
 
     /* Default Events */
@@ -116,6 +143,7 @@ namespace hex {
     EVENT_DEF(EventProviderClosing, prv::Provider *, bool *);
     EVENT_DEF(EventProviderClosed,  prv::Provider *);
     EVENT_DEF(EventProviderDeleted, prv::Provider *);
+    EVENT_DEF(EventRegionDirtied, prv::Provider *, Region);
     EVENT_DEF(EventFrameBegin);
     EVENT_DEF(EventFrameEnd);
     EVENT_DEF(EventWindowInitialized);
@@ -129,6 +157,7 @@ namespace hex {
     EVENT_DEF(RequestRestartImHex);
     EVENT_DEF(RequestOpenFile, std::fs::path);
     EVENT_DEF(RequestChangeTheme, u32);
+    EVENT_DEF(RequestSwapFontAtlas, ImFontAtlas *);
     EVENT_DEF(RequestOpenPopup, std::string);
     EVENT_DEF(RequestCreateProvider, std::string, bool, hex::prv::Provider **);
 
@@ -2,6 +2,7 @@
 
 #include <hex.hpp>
 
+#include <functional>
 #include <list>
 #include <optional>
 #include <string>
@@ -67,11 +68,14 @@ namespace hex {
             namespace impl {
 
                 using HighlightingFunction = std::function<std::optional<color_t>(u64, const u8*, size_t, bool)>;
+                using RegionHighlightingFunction = std::function<std::vector<Highlighting>(const Region &)>;
 
                 std::map<u32, Highlighting> &getBackgroundHighlights();
                 std::map<u32, HighlightingFunction> &getBackgroundHighlightingFunctions();
+                std::map<u32, RegionHighlightingFunction> &getBackgroundRegionHighlightingFunctions();
                 std::map<u32, Highlighting> &getForegroundHighlights();
                 std::map<u32, HighlightingFunction> &getForegroundHighlightingFunctions();
+                std::map<u32, RegionHighlightingFunction> &getForegroundRegionHighlightingFunctions();
                 std::map<u32, Tooltip> &getTooltips();
                 std::map<u32, TooltipFunction> &getTooltipFunctions();
 
@@ -95,6 +99,20 @@ namespace hex {
             u32 addForegroundHighlightingProvider(const impl::HighlightingFunction &function);
             void removeForegroundHighlightingProvider(u32 id);
 
+            /**
+             * Interval-based variant of the highlighting providers above. Instead of being asked
+             * once per byte per frame, the function is queried once per frame with the visible
+             * region and returns the colored regions inside it; the hex editor answers the
+             * per-cell lookups from an interval tree built over the result. Prefer this whenever
+             * a highlight is representable as regions, the per-byte callback stays around for
+             * highlights that depend on the bytes' values
+             */
+            u32 addBackgroundRegionHighlightingProvider(const impl::RegionHighlightingFunction &function);
+            void removeBackgroundRegionHighlightingProvider(u32 id);
+
+            u32 addForegroundRegionHighlightingProvider(const impl::RegionHighlightingFunction &function);
+            void removeForegroundRegionHighlightingProvider(u32 id);
+
             bool isSelectionValid();
             std::optional<Region> getSelection();
             void setSelection(const Region &region);
@@ -117,6 +135,39 @@ namespace hex {
 
         }
 
+        /**
+         * Coarse map of what kind of data lives where inside a provider. The data analysis
+         * publishes it as a cheap post-pass over its per-block statistics; any view can then
+         * consume it, e.g. to skip padding while searching or to suggest disassembly ranges.
+         * Addresses not covered by any entry are simply unclassified.
+         */
+        namespace DataRegions {
+
+            enum class RegionType : u8 {
+                Unknown     = 0,
+                Padding     = 1,
+                Text        = 2,
+                Code        = 3,
+                HighEntropy = 4
+            };
+
+            struct TypedRegion {
+                Region region;
+                RegionType type;
+            };
+
+            namespace impl {
+
+                void removeProviderRegions(prv::Provider *provider);
+
+            }
+
+            void set(prv::Provider *provider, std::vector<TypedRegion> regions);
+            [[nodiscard]] const std::vector<TypedRegion>& get(prv::Provider *provider);
+            [[nodiscard]] RegionType getRegionType(prv::Provider *provider, u64 address);
+
+        }
+
         namespace Provider {
 
             namespace impl {
@@ -173,6 +224,14 @@ namespace hex {
                 void setPortableVersion(bool enabled);
 
                 void addInitArgument(const std::string &key, const std::string &value = { });
+
+                /**
+                 * @brief Sets the callback waking the window loop out of its idle event wait
+                 */
+                void setFrameWakeCallback(const std::function<void()> &callback);
+
+                /// Returns whether a redraw was requested and clears the request
+                bool takeFrameDirty();
             }
 
             struct ProgramArguments {
@@ -193,6 +252,16 @@ namespace hex {
             float getTargetFPS();
             void setTargetFPS(float fps);
 
+            /**
+             * @brief Marks the main window contents as changed
+             *
+             * With no input, no running tasks and no open popups the window loop
+             * stops redrawing and blocks on events. Views and background threads
+             * whose state changes outside of an input event call this so the next
+             * frame picks the change up immediately instead of on the idle heartbeat.
+             */
+            void markFrameDirty();
+
             float getGlobalScale();
             float getNativeScale();
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <hex.hpp>
+
 #include <initializer_list>
 #include <map>
 #include <string>
@@ -29,6 +31,15 @@ namespace hex {
 
         [[nodiscard]] const std::string &get() const;
 
+        /**
+         * @brief Returns a shared entry for the given string literal
+         *
+         * Entries are keyed by the literal's address, so repeated calls from the
+         * same call site skip the string lookup entirely. Only pass string
+         * literals or other strings that stay alive for the program's lifetime
+         */
+        static const LangEntry &getInterned(const char *unlocalizedString);
+
         static void loadLanguage(const std::string &language);
         static const std::map<std::string, std::string> &getSupportedLanguages();
 
@@ -39,6 +50,8 @@ namespace hex {
 
     private:
         std::string m_unlocalizedString;
+        mutable const std::string *m_cachedString = nullptr;
+        mutable u32 m_cachedGeneration = 0;
 
         static std::string s_fallbackLanguage;
         static std::map<std::string, std::string> s_currStrings;
@@ -52,8 +65,8 @@ namespace hex {
     std::string operator+(const LangEntry &&left, const char *right);
     std::string operator+(const LangEntry &&left, const LangEntry &&right);
 
-    inline LangEntry operator""_lang(const char *string, size_t) {
-        return LangEntry(string);
+    inline const LangEntry &operator""_lang(const char *string, size_t) {
+        return LangEntry::getInterned(string);
     }
 
 }
\ No newline at end of file
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <hex.hpp>
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace hex {
+
+    namespace prv {
+        class Provider;
+    }
+
+    /**
+     * @brief Keeps the combined footprint of reconstructible per-provider caches under a budget
+     *
+     * Subsystems that cache derived data for a provider (analysis results, decoded
+     * previews, row caches) register a reclaimer that can report and drop that data.
+     * When the combined footprint of all open providers exceeds the configured budget,
+     * the caches of the least-recently-viewed providers are evicted first; they are
+     * recomputed lazily when their tab is revisited. The currently selected provider
+     * is never evicted.
+     */
+    class MemoryGovernor {
+    public:
+        struct Reclaimer {
+            std::string name;
+            std::function<size_t(prv::Provider *)> getFootprint;
+            std::function<void(prv::Provider *)> evict;
+        };
+
+        MemoryGovernor() = delete;
+
+        static void registerReclaimer(Reclaimer reclaimer);
+
+        /**
+         * @brief Sets the cache budget in bytes. A budget of zero disables eviction
+         */
+        static void setBudget(size_t bytes);
+        static size_t getBudget();
+
+        /**
+         * @brief Marks a provider as most recently viewed
+         */
+        static void providerTouched(prv::Provider *provider);
+        static void providerClosed(prv::Provider *provider);
+
+        /**
+         * @brief Returns the combined footprint of all registered caches of a provider
+         */
+        static size_t getFootprint(prv::Provider *provider);
+
+        /**
+         * @brief Evicts least-recently-viewed providers' caches until the budget is met
+         */
+        static void enforce();
+
+    private:
+        static std::vector<Reclaimer> s_reclaimers;
+        static std::map<prv::Provider *, u64> s_lastUse;
+        static u64 s_useCounter;
+        static size_t s_budget;
+    };
+
+}
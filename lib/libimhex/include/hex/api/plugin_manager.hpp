@@ -5,7 +5,9 @@
 #include <hex/helpers/fmt.hpp>
 #include <hex/helpers/fs.hpp>
 
+#include <functional>
 #include <string>
+#include <vector>
 
 #if defined(OS_WINDOWS)
     #include <windows.h>
@@ -79,6 +81,16 @@ namespace hex {
         static void unload();
         static void reload();
 
+        /**
+         * @brief Queues registration work that doesn't need to exist before the
+         * window is interactive, e.g. language maps, constants or store metadata
+         *
+         * Called by plugins from their initialization function. Everything queued
+         * runs on the main thread right after the first frame
+         */
+        static void addDeferredInitialization(std::function<void()> function);
+        static void runDeferredInitializations();
+
         static const auto &getPlugins() {
             return PluginManager::s_plugins;
         }
@@ -86,6 +98,7 @@ namespace hex {
     private:
         static std::fs::path s_pluginFolder;
         static std::vector<Plugin> s_plugins;
+        static std::vector<std::function<void()>> s_deferredInitializations;
     };
 
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <hex.hpp>
 
+#include <atomic>
 #include <cstdio>
 #include <thread>
 #include <functional>
@@ -10,6 +11,7 @@
 #include <chrono>
 #include <memory>
 #include <list>
+#include <optional>
 #include <condition_variable>
 
 namespace hex {
@@ -17,10 +19,34 @@ namespace hex {
     class TaskHolder;
     class TaskManager;
 
+    /**
+     * @brief Scheduling class of a task
+     *
+     * High priority tasks jump ahead of everything already queued, Low priority
+     * tasks only run once nothing more urgent is waiting. Priorities order the
+     * queue; they never preempt a task that already started running
+     */
+    enum class TaskPriority : u8 {
+        High   = 0,
+        Normal = 1,
+        Low    = 2
+    };
+
+    /**
+     * @brief Worker pool a task runs on
+     *
+     * Tasks that mostly block on disk or network belong on the Io pool so they
+     * don't occupy the compute workers while waiting
+     */
+    enum class TaskPool : u8 {
+        Compute,
+        Io
+    };
+
     class Task {
     public:
         Task() = default;
-        Task(std::string unlocalizedName, u64 maxValue, bool background, std::function<void(Task &)> function);
+        Task(std::string unlocalizedName, u64 maxValue, bool background, TaskPriority priority, std::function<void(Task &)> function);
 
         Task(const Task&) = delete;
         Task(Task &&other) noexcept;
@@ -30,6 +56,7 @@ namespace hex {
         void setMaxValue(u64 value);
 
         [[nodiscard]] bool isBackgroundTask() const;
+        [[nodiscard]] TaskPriority getPriority() const;
         [[nodiscard]] bool isFinished() const;
         [[nodiscard]] bool hadException() const;
         [[nodiscard]] bool wasInterrupted() const;
@@ -40,11 +67,31 @@ namespace hex {
         [[nodiscard]] u64 getValue() const;
         [[nodiscard]] u64 getMaxValue() const;
 
+        /**
+         * @brief Returns the task's current processing rate in progress units per
+         * second, smoothed over the last few samples. Zero until enough samples
+         * exist. For tasks counting bytes this is a byte rate
+         */
+        [[nodiscard]] double getThroughput() const;
+
+        /**
+         * @brief Estimates the remaining runtime from the current throughput,
+         * or nothing when the task has no max value or no rate yet
+         */
+        [[nodiscard]] std::optional<u64> getEstimatedRemainingSeconds() const;
+
+        /// Time the task spent waiting in the queue before a worker picked it up
+        [[nodiscard]] std::chrono::milliseconds getQueuedDuration() const;
+
+        /// Time the task has been executing, zero while it is still queued
+        [[nodiscard]] std::chrono::milliseconds getRunningDuration() const;
+
         void interrupt();
 
         void setInterruptCallback(std::function<void()> callback);
 
     private:
+        void start();
         void finish();
         void interruption();
         void exception(const char *message);
@@ -59,12 +106,20 @@ namespace hex {
 
         std::atomic<bool> m_shouldInterrupt = false;
         std::atomic<bool> m_background = true;
+        TaskPriority m_priority = TaskPriority::Normal;
 
         std::atomic<bool> m_interrupted = false;
         std::atomic<bool> m_finished = false;
         std::atomic<bool> m_hadException = false;
         std::string m_exceptionMessage;
 
+        using Clock = std::chrono::steady_clock;
+        std::atomic<Clock::time_point> m_createdTime = Clock::now();
+        std::atomic<Clock::time_point> m_startTime {};
+        std::atomic<Clock::time_point> m_lastSampleTime {};
+        std::atomic<u64> m_lastSampleValue = 0;
+        std::atomic<double> m_throughput = 0;
+
         struct TaskInterruptor { virtual ~TaskInterruptor() = default; };
 
         friend class TaskHolder;
@@ -95,7 +150,21 @@ namespace hex {
         constexpr static auto NoProgress = 0;
 
         static TaskHolder createTask(std::string name, u64 maxValue, std::function<void(Task &)> function);
+        static TaskHolder createTask(std::string name, u64 maxValue, TaskPriority priority, TaskPool pool, std::function<void(Task &)> function);
         static TaskHolder createBackgroundTask(std::string name, std::function<void(Task &)> function);
+        static TaskHolder createIoTask(std::string name, std::function<void(Task &)> function);
+
+        /**
+         * @brief Runs function over [begin, end) split into chunkSize sized chunks,
+         * spread across one worker per core
+         *
+         * Chunks are claimed from a shared counter, so fast workers automatically
+         * pick up work that slow ones haven't gotten to. Progress on the owning
+         * task is aggregated from the finished chunks and interrupting the task
+         * stops all workers at their next chunk boundary. The function is called
+         * as function(chunkBegin, chunkEnd) and must not touch the task itself
+         */
+        static void parallelFor(Task &task, u64 begin, u64 end, u64 chunkSize, const std::function<void(u64 chunkBegin, u64 chunkEnd)> &function);
 
         static void collectGarbage();
 
@@ -105,17 +174,23 @@ namespace hex {
         static void doLater(const std::function<void()> &function);
         static void runDeferredCalls();
     private:
-        static std::mutex s_deferredCallsMutex;
+        // Deferred calls are pushed onto a lock-free stack so workers queueing UI
+        // updates never contend with each other or with the frame loop's drain
+        struct DeferredCallNode {
+            std::function<void()> function;
+            DeferredCallNode *next;
+        };
+        static std::atomic<DeferredCallNode *> s_deferredCallsHead;
 
         static std::list<std::shared_ptr<Task>> s_tasks;
-        static std::list<std::shared_ptr<Task>> s_taskQueue;
-        static std::list<std::function<void()>> s_deferredCalls;
+        static std::list<std::shared_ptr<Task>> s_taskQueue, s_ioTaskQueue;
 
         static std::mutex s_queueMutex;
-        static std::condition_variable s_jobCondVar;
-        static std::vector<std::jthread> s_workers;
+        static std::condition_variable s_jobCondVar, s_ioJobCondVar;
+        static std::vector<std::jthread> s_workers, s_ioWorkers;
 
-        static void runner(const std::stop_token &stopToken);
+        static TaskHolder createTaskImpl(std::string name, u64 maxValue, bool background, TaskPriority priority, TaskPool pool, std::function<void(Task &)> function);
+        static void runner(const std::stop_token &stopToken, std::list<std::shared_ptr<Task>> &queue, std::condition_variable &condVar);
     };
 
 }
\ No newline at end of file
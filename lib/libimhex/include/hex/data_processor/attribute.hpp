@@ -1,7 +1,7 @@
 #pragma once
 #include <hex.hpp>
 
-#include <optional>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <map>
@@ -40,7 +40,10 @@ namespace hex::dp {
 
         [[nodiscard]] Node *getParentNode() { return this->m_parentNode; }
 
-        [[nodiscard]] std::optional<std::vector<u8>> &getOutputData() { return this->m_outputData; }
+        // Output data is an immutable shared buffer: every consumer either reads it
+        // in place or takes another reference to it, so data travelling through the
+        // graph is allocated once by the producing node instead of once per edge
+        [[nodiscard]] std::shared_ptr<std::vector<u8>> &getOutputData() { return this->m_outputData; }
 
         static void setIdCounter(int id) {
             if (id > Attribute::s_idCounter)
@@ -55,7 +58,7 @@ namespace hex::dp {
         std::map<int, Attribute *> m_connectedAttributes;
         Node *m_parentNode = nullptr;
 
-        std::optional<std::vector<u8>> m_outputData;
+        std::shared_ptr<std::vector<u8>> m_outputData;
 
         friend class Node;
         void setParentNode(Node *node) { this->m_parentNode = node; }
@@ -4,6 +4,9 @@
 #include <hex/helpers/intrinsics.hpp>
 #include <hex/data_processor/attribute.hpp>
 
+#include <array>
+#include <memory>
+#include <optional>
 #include <set>
 #include <string_view>
 #include <vector>
@@ -43,6 +46,33 @@ namespace hex::dp {
         virtual void store(nlohmann::json &j) { hex::unused(j); }
         virtual void load(nlohmann::json &j) { hex::unused(j); }
 
+        // Streaming interface: a linear chain from a stream source through
+        // streamable transforms into a stream sink can be executed one fixed size
+        // chunk at a time, so the data flowing through it is never materialized as
+        // a single buffer. Streamable nodes carry whatever context they need
+        // across chunks and evaluate their non-buffer inputs through the regular
+        // attribute pulls in resetStreamState()
+        [[nodiscard]] virtual bool isStreamSource() const { return false; }
+        [[nodiscard]] virtual bool isStreamable() const { return false; }
+        [[nodiscard]] virtual bool isStreamSink() const { return false; }
+
+        virtual void resetStreamState() { }
+        virtual u64 getStreamSize() { return 0; }
+        virtual std::vector<u8> readStreamChunk(u64 offset, size_t size) { hex::unused(offset, size); return { }; }
+        virtual std::vector<u8> processStreamChunk(std::vector<u8> chunk) { return chunk; }
+        virtual void writeStreamChunk(std::vector<u8> chunk) { hex::unused(chunk); }
+        virtual void finishStream() { }
+
+        // A node with more than one buffer input names the attribute the streamed
+        // data flows through here; the others stay regular side inputs
+        [[nodiscard]] virtual std::optional<u32> getStreamInputIndex() const { return std::nullopt; }
+
+        // An elementwise node maps every byte to an output byte independent of its
+        // position. Maximal runs of such nodes in a stream chain are fused into a
+        // single lookup table pass instead of one pass per node. Called after
+        // resetStreamState(), so the map may depend on side inputs
+        [[nodiscard]] virtual std::optional<std::array<u8, 0x100>> getStreamByteMap() { return std::nullopt; }
+
         struct NodeError {
             Node *node;
             std::string message;
@@ -57,6 +87,23 @@ namespace hex::dp {
             this->m_processedInputs.clear();
         }
 
+        [[nodiscard]] bool isDirty() const { return this->m_dirty; }
+        void markClean() { this->m_dirty = false; }
+        void markDirty();
+
+        // Profile of the node's most recent run. The byte counters are fed by the
+        // buffer accessors; the wall time is measured by whoever drives process()
+        [[nodiscard]] u64 getProcessingTime() const { return this->m_processingTime; }
+        [[nodiscard]] u64 getProcessedBytes() const { return this->m_processedBytes; }
+
+        void resetProfile() {
+            this->m_processingTime = 0;
+            this->m_processedBytes = 0;
+        }
+
+        void addProcessingTime(u64 nanoseconds) { this->m_processingTime += nanoseconds; }
+        void addProcessedBytes(u64 count) { this->m_processedBytes += count; }
+
         void setPosition(ImVec2 pos) {
             this->m_position = pos;
         }
@@ -75,6 +122,9 @@ namespace hex::dp {
         std::string m_unlocalizedTitle, m_unlocalizedName;
         std::vector<Attribute> m_attributes;
         std::set<u32> m_processedInputs;
+        bool m_dirty = true;
+        u64 m_processingTime = 0;
+        u64 m_processedBytes = 0;
         prv::Overlay *m_overlay = nullptr;
         ImVec2 m_position;
 
@@ -103,15 +153,18 @@ namespace hex::dp {
             throw NodeError { this, message };
         }
 
-        std::vector<u8> getBufferOnInput(u32 index);
+        const std::vector<u8> &getBufferOnInput(u32 index);
+        std::shared_ptr<std::vector<u8>> getBufferSharedOnInput(u32 index);
         i128 getIntegerOnInput(u32 index);
         long double getFloatOnInput(u32 index);
 
-        void setBufferOnOutput(u32 index, const std::vector<u8> &data);
+        void setBufferOnOutput(u32 index, std::vector<u8> data);
+        void setBufferOnOutput(u32 index, std::shared_ptr<std::vector<u8>> data);
         void setIntegerOnOutput(u32 index, i128 integer);
         void setFloatOnOutput(u32 index, long double floatingPoint);
 
         void setOverlayData(u64 address, const std::vector<u8> &data);
+        void appendOverlayData(const std::vector<u8> &data);
     };
 
 }
\ No newline at end of file
@@ -3,7 +3,9 @@
 #include <hex.hpp>
 
 #include <array>
+#include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -27,16 +29,49 @@ namespace hex::crypt {
     std::array<u8, 48> sha384(prv::Provider *&data, u64 offset, size_t size);
     std::array<u8, 64> sha512(prv::Provider *&data, u64 offset, size_t size);
 
-    std::array<u8, 16> md5(const std::vector<u8> &data);
-    std::array<u8, 20> sha1(const std::vector<u8> &data);
-    std::array<u8, 28> sha224(const std::vector<u8> &data);
-    std::array<u8, 32> sha256(const std::vector<u8> &data);
-    std::array<u8, 48> sha384(const std::vector<u8> &data);
-    std::array<u8, 64> sha512(const std::vector<u8> &data);
+    std::array<u8, 16> md5(std::span<const u8> data);
+    std::array<u8, 20> sha1(std::span<const u8> data);
+    std::array<u8, 28> sha224(std::span<const u8> data);
+    std::array<u8, 32> sha256(std::span<const u8> data);
+    std::array<u8, 48> sha384(std::span<const u8> data);
+    std::array<u8, 64> sha512(std::span<const u8> data);
 
+    /**
+     * @brief Incremental hashing context.
+     *
+     * Accepts data in arbitrarily sized chunks and produces the digest at the end,
+     * so several hashes can be computed from a single pass over the data. Calling
+     * finish() doesn't disturb the stream state, so a digest can be read at any
+     * point and more data appended afterwards to roll it forward.
+     */
+    class HashStream {
+    public:
+        virtual ~HashStream() = default;
+
+        virtual void update(const unsigned char *data, size_t size) = 0;
+        [[nodiscard]] virtual std::vector<u8> finish() = 0;
+    };
+
+    std::unique_ptr<HashStream> createMd5Stream();
+    std::unique_ptr<HashStream> createSha1Stream();
+    std::unique_ptr<HashStream> createSha224Stream();
+    std::unique_ptr<HashStream> createSha256Stream();
+    std::unique_ptr<HashStream> createSha384Stream();
+    std::unique_ptr<HashStream> createSha512Stream();
+    std::unique_ptr<HashStream> createXxHash64Stream();
+    std::unique_ptr<HashStream> createCrcStream(u32 width, u32 polynomial, u32 init, u32 xorout, bool reflectIn, bool reflectOut, size_t digestSize);
+
+    /*
+        The base64 functions run a vectorized bulk kernel over the body of the data
+        when the processor supports it and only hand the trailing bytes to mbedtls
+    */
+    std::vector<u8> decode64(std::span<const u8> input);
     std::vector<u8> decode64(const std::vector<u8> &input);
+    std::vector<u8> encode64(std::span<const u8> input);
     std::vector<u8> encode64(const std::vector<u8> &input);
+    std::vector<u8> decode16(std::span<const u8> input);
     std::vector<u8> decode16(const std::string &input);
+    std::string encode16(std::span<const u8> input);
     std::string encode16(const std::vector<u8> &input);
 
     i128 decodeSleb128(const std::vector<u8> &bytes);
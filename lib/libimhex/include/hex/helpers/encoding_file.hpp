@@ -3,6 +3,7 @@
 #include <hex.hpp>
 
 #include <map>
+#include <optional>
 #include <string_view>
 #include <vector>
 
@@ -28,10 +29,23 @@ namespace hex {
 
     private:
         void parseThingyFile(fs::File &file);
+        void insertSequence(const std::vector<u8> &from, const std::string &to);
 
         bool m_valid = false;
 
-        std::map<size_t, std::map<std::vector<u8>, std::string>> m_mapping;
+        /**
+         * @brief Node of the byte trie the sequences are matched against
+         *
+         * Built once at load time; a lookup walks the trie along the input bytes and
+         * remembers the deepest node that ends a sequence, so resolving a sequence
+         * is bounded by its length and allocates nothing.
+         */
+        struct TrieNode {
+            std::map<u8, u32> children;
+            std::optional<std::string> value;
+        };
+
+        std::vector<TrieNode> m_trie = std::vector<TrieNode>(1);
         size_t m_longestSequence = 0;
     };
 
@@ -3,6 +3,7 @@
 #include <hex.hpp>
 
 #include <cstdio>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -49,6 +50,15 @@ namespace hex::fs {
         std::string readString(size_t numBytes = 0);
         std::u8string readU8String(size_t numBytes = 0);
 
+        /**
+         * @brief Maps the whole file into memory and returns a read-only view over it.
+         *
+         * Unlike readBytes() this doesn't allocate or copy anything; when the platform
+         * refuses to map the file, the contents are read into an internal buffer
+         * instead. Either way the view stays valid until the file is closed
+         */
+        [[nodiscard]] std::span<const u8> map();
+
         void write(const u8 *buffer, size_t size);
         void write(const std::vector<u8> &bytes);
         void write(const std::string &string);
@@ -65,9 +75,16 @@ namespace hex::fs {
 
         void disableBuffering();
 
+    private:
+        void unmap();
+
     private:
         FILE *m_file;
         std::fs::path m_path;
+
+        void *m_map      = nullptr;
+        size_t m_mapSize = 0;
+        std::vector<u8> m_mapFallback;
     };
 
 }
\ No newline at end of file
@@ -14,6 +14,24 @@ namespace hex::log {
     FILE *getDestination();
     bool isRedirected();
 
+    /**
+     * @brief Switches logging to a background writer thread.
+     *
+     * In async mode, records are formatted on the calling thread and pushed onto a
+     * bounded ring that a writer thread drains to the destination, so logging from
+     * tight loops no longer stalls on console or file I/O. When the ring overflows,
+     * records are dropped and the writer reports how many were lost. Disabling
+     * async mode flushes everything still queued before returning
+     */
+    void enableAsyncMode(bool enabled);
+
+    namespace impl {
+
+        [[nodiscard]] bool isAsyncEnabled();
+        void enqueueRecord(std::string &&record);
+
+    }
+
     namespace {
 
         [[maybe_unused]] void printPrefix(FILE *dest, const fmt::text_style &ts, const std::string &level) {
@@ -29,8 +47,32 @@ namespace hex::log {
             fmt::print(dest, "[{0}] ", IMHEX_PROJECT_NAME);
         }
 
+        [[maybe_unused]] std::string formatPrefix(const fmt::text_style &ts, const std::string &level) {
+            const auto now = fmt::localtime(std::chrono::system_clock::now());
+
+            std::string prefix = fmt::format("[{0:%H:%M:%S}] ", now);
+
+            if (isRedirected())
+                prefix += fmt::format("{0} ", level);
+            else
+                prefix += fmt::format(ts, "{0} ", level);
+
+            prefix += fmt::format("[{0}] ", IMHEX_PROJECT_NAME);
+
+            return prefix;
+        }
+
         template<typename... T>
         [[maybe_unused]] void print(const fmt::text_style &ts, const std::string &level, const std::string &fmt, auto... args) {
+            if (impl::isAsyncEnabled()) {
+                auto record = formatPrefix(ts, level);
+                record += fmt::format(fmt::runtime(fmt), args...);
+                record += '\n';
+
+                impl::enqueueRecord(std::move(record));
+                return;
+            }
+
             static std::mutex logMutex;
             std::scoped_lock lock(logMutex);
 
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <hex.hpp>
+
+#include <atomic>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace hex::mem {
+
+    /**
+     * @brief Opt-in, tag-based allocation tracking
+     *
+     * Subsystems report their allocations at their ownership seams so memory
+     * growth in long sessions can be attributed to real owners instead of one
+     * opaque RSS number. Counted tags are updated with add()/remove() as the
+     * allocations happen; subsystems that can size themselves cheaply on
+     * demand register a polled tag instead of counting every mutation.
+     */
+    class TagStats {
+    public:
+        void add(u64 size) {
+            this->m_allocations += 1;
+            const auto bytes = this->m_bytes += size;
+
+            // Racing updates can only ever under-report the peak for a moment
+            u64 peak = this->m_peakBytes;
+            while (bytes > peak && !this->m_peakBytes.compare_exchange_weak(peak, bytes))
+                ;
+        }
+
+        void remove(u64 size) {
+            this->m_allocations -= 1;
+            this->m_bytes -= size;
+        }
+
+        [[nodiscard]] u64 getBytes() const { return this->m_bytes; }
+        [[nodiscard]] u64 getAllocations() const { return this->m_allocations; }
+        [[nodiscard]] u64 getPeakBytes() const { return this->m_peakBytes; }
+
+    private:
+        std::atomic<u64> m_bytes = 0, m_allocations = 0, m_peakBytes = 0;
+    };
+
+    /**
+     * @brief Returns the stats slot for a subsystem tag
+     *
+     * Slots live for the program's lifetime, so callers on hot paths should
+     * look their tag up once and keep the reference.
+     */
+    TagStats &tag(const std::string &name);
+
+    /**
+     * @brief Registers a tag whose usage is computed on demand
+     *
+     * The callback returns current bytes and allocation count; it runs on the
+     * UI thread whenever a snapshot is taken, so it has to stay cheap and do
+     * its own locking where needed.
+     */
+    void registerPolledTag(std::string name, std::function<std::pair<u64, u64>()> poll);
+
+    struct Snapshot {
+        std::string name;
+        u64 bytes;
+        u64 allocations;
+        u64 peakBytes;
+    };
+
+    /// Current usage of all counted and polled tags, sorted by bytes descending
+    std::vector<Snapshot> snapshot();
+
+}
@@ -31,6 +31,13 @@ namespace hex {
         i32 code;
     };
 
+    struct ConditionalResponse {
+        i32 code;    // 304 means the caller's cached copy is still valid and the body is empty
+        std::string body;
+        std::string etag;
+        std::string lastModified;
+    };
+
     class Net {
     public:
         Net();
@@ -41,6 +48,12 @@ namespace hex {
         std::future<Response<std::string>> getString(const std::string &url, u32 timeout = DefaultTimeout);
         std::future<Response<nlohmann::json>> getJson(const std::string &url, u32 timeout = DefaultTimeout);
 
+        /**
+         * @brief GET with cache revalidation. When the passed validators match on the
+         * server, the response is a bodyless 304 instead of a full download
+         */
+        std::future<ConditionalResponse> getStringConditional(const std::string &url, const std::string &etag, const std::string &lastModified, u32 timeout = DefaultTimeout);
+
         std::future<Response<std::string>> uploadFile(const std::string &url, const std::fs::path &filePath, u32 timeout = DefaultTimeout);
         std::future<Response<void>> downloadFile(const std::string &url, const std::fs::path &filePath, u32 timeout = DefaultTimeout);
 
@@ -54,7 +67,9 @@ namespace hex {
         static void setProxy(const std::string &url);
 
     private:
-        void setCommonSettings(std::string &response, const std::string &url, u32 timeout = 2000, const std::map<std::string, std::string> &extraHeaders = {}, const std::string &body = {});
+        // Configures everything except the response sink; each request wires its own
+        // write callback so downloads can stream to disk without a full-body buffer
+        void setCommonSettings(const std::string &url, u32 timeout = 2000, const std::map<std::string, std::string> &extraHeaders = {}, const std::string &body = {});
         std::optional<i32> execute();
 
         friend int progressCallback(void *contents, curl_off_t dlTotal, curl_off_t dlNow, curl_off_t ulTotal, curl_off_t ulNow);
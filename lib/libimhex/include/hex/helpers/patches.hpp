@@ -5,6 +5,13 @@
 #include <map>
 #include <vector>
 
+#include <hex/helpers/file.hpp>
+
+namespace hex::prv {
+    class Provider;
+    class PatchStore;
+}
+
 namespace hex {
 
     using Patches = std::map<u64, u8>;
@@ -14,4 +21,15 @@ namespace hex {
 
     Patches loadIPSPatch(const std::vector<u8> &ipsPatch);
     Patches loadIPS32Patch(const std::vector<u8> &ipsPatch);
+
+    /*
+     * Streaming variants. Records are written straight to a file while iterating the
+     * patch runs, or read from a file and applied straight to a provider, so memory
+     * use is bounded by the largest record instead of the patched file.
+     */
+    bool generateIPSPatch(const prv::PatchStore &patches, fs::File &output);
+    bool generateIPS32Patch(const prv::PatchStore &patches, fs::File &output);
+
+    bool applyIPSPatch(prv::Provider *provider, fs::File &input);
+    bool applyIPS32Patch(prv::Provider *provider, fs::File &input);
 }
\ No newline at end of file
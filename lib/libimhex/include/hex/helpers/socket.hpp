@@ -13,7 +13,9 @@
     #define SOCKET_NONE INVALID_SOCKET
 #else
     #include <unistd.h>
+    #include <poll.h>
     #include <sys/socket.h>
+    #include <sys/uio.h>
     #include <netinet/in.h>
     #include <netinet/ip.h>
     #include <arpa/inet.h>
@@ -43,7 +45,22 @@ namespace hex {
         void writeString(const std::string &string) const;
         void writeBytes(const std::vector<u8> &bytes) const;
 
+        /**
+         * @brief Writes all parts with a single gathered send (writev / WSASend)
+         */
+        void writeVectored(const std::vector<std::string> &parts) const;
+
+        /**
+         * @brief Polls whether data can be read without blocking
+         */
+        [[nodiscard]] bool hasDataAvailable(int timeoutMs = 0) const;
+
     private:
+        // Received data is drained from the kernel in large chunks and handed
+        // out of this buffer so small protocol reads don't each cost a syscall
+        mutable std::vector<u8> m_receiveBuffer;
+        mutable size_t m_receivePos = 0;
+
         bool m_connected = false;
 #if defined(OS_WINDOWS)
         SOCKET m_socket = SOCKET_NONE;
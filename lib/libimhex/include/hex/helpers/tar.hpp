@@ -4,6 +4,8 @@
 
 #include <hex/helpers/fs.hpp>
 
+#include <functional>
+
 #include <microtar.h>
 
 namespace hex {
@@ -29,9 +31,27 @@ namespace hex {
         [[nodiscard]] std::vector<u8> read(const std::fs::path &path);
         [[nodiscard]] std::string readString(const std::fs::path &path);
 
+        /**
+         * @brief Streams an entry's contents through a callback in fixed-size chunks,
+         * so large members never have to exist in memory as a whole
+         */
+        void read(const std::fs::path &path, const std::function<void(const u8 *data, size_t size)> &consumer);
+
         void write(const std::fs::path &path, const std::vector<u8> &data);
         void write(const std::fs::path &path, const std::string &data);
 
+        /**
+         * @brief Writes an entry of the given size by pulling its contents from a
+         * producer in fixed-size chunks. The entry size is committed to the header up
+         * front, so if the producer runs dry early the remainder is zero-filled
+         */
+        void write(const std::fs::path &path, u64 size, const std::function<size_t(u8 *buffer, size_t size)> &producer);
+
+        /**
+         * @brief Streams a file on disk into the archive at constant memory
+         */
+        void writeFile(const std::fs::path &path, const std::fs::path &sourcePath);
+
         [[nodiscard]] std::vector<std::fs::path> listEntries(const std::fs::path &basePath = "/");
         [[nodiscard]] bool contains(const std::fs::path &path);
 
@@ -40,6 +60,9 @@ namespace hex {
 
         [[nodiscard]] bool isValid() const { return this->m_valid; }
 
+    private:
+        void writeParentDirectories(const std::fs::path &path);
+
     private:
         mtar_t m_ctx = { };
 
@@ -14,6 +14,7 @@
 #include <limits>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <type_traits>
 #include <variant>
@@ -53,6 +54,13 @@ namespace hex {
     std::string encodeByteString(const std::vector<u8> &bytes);
     std::vector<u8> decodeByteString(const std::string &string);
 
+    /**
+     * @brief Adds the number of occurrences of every byte value in the data to the counts.
+     * Byte histogramming is the inner loop of the data analyses, so this counts eight bytes
+     * per load into separate sub-histograms instead of incrementing one counter at a time
+     */
+    void countByteOccurrences(std::span<const u8> data, std::array<u64, 256> &counts);
+
     [[nodiscard]] constexpr inline u64 extract(u8 from, u8 to, const std::unsigned_integral auto &value) {
         if (from < to) std::swap(from, to);
 
@@ -148,6 +156,26 @@ namespace hex {
         return changeEndianess(value, sizeof(value), endian);
     }
 
+    /**
+     * @brief Byteswaps every element of a contiguous buffer in place.
+     *
+     * Runs a vectorized bulk kernel over the body of the buffer when the processor
+     * supports it. Trailing bytes that don't fill a whole element are left untouched.
+     */
+    void changeEndianess(std::span<u8> data, size_t elementSize, std::endian endian);
+
+    /**
+     * @brief Elementwise bitwise operations over whole buffers.
+     *
+     * Combines every byte of the buffer with the matching byte of the operand in
+     * place, using wide vector kernels with runtime dispatch where the processor
+     * supports them. The operand must be at least as long as the buffer.
+     */
+    void bitwiseNot(std::span<u8> data);
+    void bitwiseAnd(std::span<u8> data, std::span<const u8> operand);
+    void bitwiseOr(std::span<u8> data, std::span<const u8> operand);
+    void bitwiseXor(std::span<u8> data, std::span<const u8> operand);
+
     [[nodiscard]] constexpr u128 bitmask(u8 bits) {
         return u128(-1) >> (128 - bits);
     }
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <future>
 #include <span>
 #include <vector>
 
 #include <hex/providers/provider.hpp>
+#include <hex/providers/io_tracer.hpp>
 #include <hex/helpers/literals.hpp>
+#include <hex/helpers/memory_tracker.hpp>
 
 namespace hex::prv {
 
@@ -16,9 +19,19 @@ namespace hex::prv {
         : m_provider(provider), m_bufferAddress(provider->getBaseAddress()), m_maxBufferSize(bufferSize),
           m_startAddress(0x00), m_endAddress(provider->getActualSize() - 1),
           m_buffer(bufferSize) {
+            stats().add(this->m_maxBufferSize);
+        }
+
+        ~BufferedReader() {
+            if (this->m_prefetchFuture.valid())
+                this->m_prefetchFuture.wait();
 
+            stats().remove(this->m_maxBufferSize);
         }
 
+        BufferedReader(const BufferedReader&) = delete;
+        BufferedReader& operator=(const BufferedReader&) = delete;
+
         void seek(u64 address) {
             this->m_startAddress = address;
         }
@@ -64,6 +77,86 @@ namespace hex::prv {
             return { result, result + std::min(size, this->m_buffer.size()) };
         }
 
+        /**
+         * @brief Reads data as a view into the internal buffer instead of copying it out
+         *
+         * The returned span stays valid until the next read(), readSpan() or iterator
+         * dereference that moves the buffer window, and until the reader is destroyed.
+         * It gets clamped to the configured end address; requests larger than the buffer
+         * return at most one buffer's worth of data, so callers need to check its size.
+         */
+        [[nodiscard]] std::span<const u8> readSpan(u64 address, size_t size) {
+            if (address > this->m_endAddress)
+                return { };
+
+            size = std::min<u64>(size, (this->m_endAddress - address) + 1);
+            size = std::min<size_t>(size, this->m_maxBufferSize);
+
+            this->updateBuffer(address, size);
+
+            const auto offset = address - this->m_bufferAddress;
+            return { this->m_buffer.data() + offset, std::min(size, this->m_buffer.size() - offset) };
+        }
+
+        struct Chunk {
+            u64 address;
+            std::span<const u8> data;
+        };
+
+        class ChunkIterator {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using difference_type   = std::ptrdiff_t;
+            using value_type        = Chunk;
+
+            ChunkIterator(BufferedReader *reader, u64 address, size_t chunkSize)
+                : m_reader(reader), m_address(address), m_chunkSize(chunkSize) { }
+
+            Chunk operator*() const {
+                return { this->m_address, this->m_reader->readSpan(this->m_address, this->m_chunkSize) };
+            }
+
+            ChunkIterator& operator++() {
+                if ((this->m_reader->m_endAddress - this->m_address) < this->m_chunkSize)
+                    this->m_address = this->m_reader->m_endAddress + 1;
+                else
+                    this->m_address += this->m_chunkSize;
+
+                return *this;
+            }
+
+            ChunkIterator operator++(int) {
+                auto copy = *this;
+                ++(*this);
+
+                return copy;
+            }
+
+            friend bool operator== (const ChunkIterator& left, const ChunkIterator& right) { return left.m_address == right.m_address; };
+            friend bool operator!= (const ChunkIterator& left, const ChunkIterator& right) { return left.m_address != right.m_address; };
+
+        private:
+            BufferedReader *m_reader;
+            u64 m_address;
+            size_t m_chunkSize;
+        };
+
+        /**
+         * @brief Range adaptor yielding the data between the start and end address as
+         * consecutive spans of at most chunkSize bytes, reusing the internal buffer
+         */
+        [[nodiscard]] auto chunks(size_t chunkSize) {
+            struct ChunkRange {
+                BufferedReader *reader;
+                size_t chunkSize;
+
+                [[nodiscard]] ChunkIterator begin() const { return { reader, reader->m_startAddress, chunkSize }; }
+                [[nodiscard]] ChunkIterator end()   const { return { reader, reader->m_endAddress + 1, chunkSize }; }
+            };
+
+            return ChunkRange { this, chunkSize };
+        }
+
         class Iterator {
         public:
             using iterator_category = std::forward_iterator_tag;
@@ -258,17 +351,59 @@ namespace hex::prv {
 
     private:
         void updateBuffer(u64 address, size_t size) {
-            if (!this->m_bufferValid || address < this->m_bufferAddress || address + size > (this->m_bufferAddress + this->m_buffer.size())) {
-                const auto remainingBytes = (this->m_endAddress - address) + 1;
-                if (remainingBytes < this->m_maxBufferSize)
-                    this->m_buffer.resize(remainingBytes);
-                else
-                    this->m_buffer.resize(this->m_maxBufferSize);
-
-                this->m_provider->read(address, this->m_buffer.data(), this->m_buffer.size());
-                this->m_bufferAddress = address;
-                this->m_bufferValid = true;
+            if (this->m_bufferValid && address >= this->m_bufferAddress && address + size <= (this->m_bufferAddress + this->m_buffer.size()))
+                return;
+
+            // If the window being entered is the one the prefetch thread loaded, take it
+            // and immediately start fetching the window after it. Sequential consumers
+            // thereby overlap their processing with the I/O of the next window
+            if (this->m_prefetchFuture.valid()) {
+                this->m_prefetchFuture.get();
+
+                if (this->m_prefetchAddress == address && this->m_prefetchBuffer.size() >= size) {
+                    std::swap(this->m_buffer, this->m_prefetchBuffer);
+                    this->m_bufferAddress = address;
+                    this->m_bufferValid   = true;
+
+                    this->prefetchNextWindow();
+                    return;
+                }
             }
+
+            const auto remainingBytes = (this->m_endAddress - address) + 1;
+            if (remainingBytes < this->m_maxBufferSize)
+                this->m_buffer.resize(remainingBytes);
+            else
+                this->m_buffer.resize(this->m_maxBufferSize);
+
+            iotrace::ScopedTag traceTag("buffered reader");
+            this->m_provider->read(address, this->m_buffer.data(), this->m_buffer.size());
+            this->m_bufferAddress = address;
+            this->m_bufferValid = true;
+
+            this->prefetchNextWindow();
+        }
+
+        void prefetchNextWindow() {
+            const u64 nextAddress = this->m_bufferAddress + this->m_buffer.size();
+            if (nextAddress > this->m_endAddress)
+                return;
+
+            const auto prefetchSize = std::min<u64>((this->m_endAddress - nextAddress) + 1, this->m_maxBufferSize);
+
+            this->m_prefetchAddress = nextAddress;
+            this->m_prefetchBuffer.resize(prefetchSize);
+            this->m_prefetchFuture = std::async(std::launch::async, [this, nextAddress, prefetchSize] {
+                iotrace::ScopedTag traceTag("prefetch");
+                this->m_provider->read(nextAddress, this->m_prefetchBuffer.data(), prefetchSize);
+            });
+        }
+
+        // The window buffers are the biggest transient allocations tasks make,
+        // so they are reported under one shared tag
+        static mem::TagStats &stats() {
+            static auto &stats = mem::tag("Read buffers");
+            return stats;
         }
 
     private:
@@ -279,6 +414,10 @@ namespace hex::prv {
         bool m_bufferValid = false;
         u64 m_startAddress = 0x00, m_endAddress;
         std::vector<u8> m_buffer;
+
+        u64 m_prefetchAddress = 0x00;
+        std::vector<u8> m_prefetchBuffer;
+        std::future<void> m_prefetchFuture;
     };
 
 }
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <hex.hpp>
+
+#include <atomic>
+#include <list>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <hex/providers/provider.hpp>
+
+namespace hex::prv {
+
+    /**
+     * @brief Provider base class that caches aligned blocks of a slow backend in a fixed-size LRU
+     *
+     * Providers whose backends pay per-request latency (network protocols, device ioctls) can derive
+     * from this class instead of Provider and implement readFromSource()/writeToSource(). readRaw()
+     * then only hits the backend on cache misses, and writes go through to the backend while updating
+     * any cached blocks in place (write-through). Providers need to call invalidateCache() whenever
+     * the backend may have changed underneath them, e.g. on reopen or target resume.
+     */
+    class CachedProvider : public Provider {
+    public:
+        explicit CachedProvider(size_t blockSize = 0x1000, size_t maxBlockCount = 0x400);
+        ~CachedProvider() override = default;
+
+        void readRaw(u64 offset, void *buffer, size_t size) override;
+        void writeRaw(u64 offset, const void *buffer, size_t size) override;
+
+        virtual void readFromSource(u64 offset, void *buffer, size_t size)        = 0;
+        virtual void writeToSource(u64 offset, const void *buffer, size_t size)   = 0;
+
+        void invalidateCache();
+        void invalidateCache(u64 offset, size_t size);
+
+        /**
+         * @brief Warms the cache for the given range on a background task
+         *
+         * Does nothing if the range is already fully cached or a prefetch is still running.
+         */
+        void prefetchAsync(u64 offset, size_t size);
+
+        [[nodiscard]] size_t getCacheBlockSize() const { return this->m_blockSize; }
+
+    private:
+        struct CacheBlock {
+            std::vector<u8> data;
+            std::list<u64>::iterator lruEntry;
+        };
+
+        CacheBlock &loadBlock(u64 blockAddress);
+        void fetchBlockRun(u64 runStart, u64 runEnd);
+        void evictExcessBlocks();
+
+        size_t m_blockSize;
+        size_t m_maxBlockCount;
+
+        std::map<u64, CacheBlock> m_blocks;
+        std::list<u64> m_lruOrder;
+        std::mutex m_cacheMutex;
+        std::atomic<bool> m_prefetchRunning = false;
+    };
+
+}
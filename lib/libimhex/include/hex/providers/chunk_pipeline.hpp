@@ -0,0 +1,102 @@
+#pragma once
+
+#include <hex/providers/buffered_reader.hpp>
+#include <hex/api/task.hpp>
+
+#include <functional>
+#include <vector>
+
+namespace hex::prv {
+
+    /**
+     * @brief Fans one chunked pass over a provider region out to multiple consumers.
+     *
+     * Every subscriber sees each chunk exactly once, back to back in ascending
+     * address order, so adding a consumer never adds another pass over the data.
+     * Reads go through BufferedReader, which fetches the next window on a
+     * background thread while the subscribers process the current one, and
+     * unallocated regions of sparse providers are fed from a zeroed buffer
+     * without asking the provider for their contents.
+     */
+    class ChunkPipeline {
+    public:
+        using Subscriber = std::function<void(u64 address, const u8 *data, size_t size)>;
+
+        constexpr static size_t DefaultChunkSize = 1_MiB;
+
+        ChunkPipeline(Provider *provider, u64 address, size_t size, size_t chunkSize = DefaultChunkSize)
+            : m_provider(provider), m_reader(provider), m_address(address), m_size(size), m_chunkSize(chunkSize) {
+            this->m_reader.seek(address);
+
+            if (size > 0)
+                this->m_reader.setEndAddress((address + size) - 1);
+        }
+
+        void subscribe(Subscriber subscriber) {
+            this->m_subscribers.push_back(std::move(subscriber));
+        }
+
+        /**
+         * @brief Streams the configured region through all subscribers.
+         *
+         * When a task is passed, its progress is advanced to the number of processed
+         * bytes after every chunk; interrupting the task cancels the pass through the
+         * interruption exception thrown by Task::update().
+         */
+        void process(Task *task = nullptr) {
+            if (this->m_size == 0 || this->m_subscribers.empty())
+                return;
+
+            u64 holeEnd = 0;
+            for (u64 processed = 0; processed < this->m_size;) {
+                const u64 address = this->m_address + processed;
+                auto readSize = std::min<u64>(this->m_chunkSize, this->m_size - processed);
+
+                if (address >= holeEnd) {
+                    const auto [region, hasData] = this->m_provider->getRegionValidity(address);
+                    if (!hasData && region != Region::Invalid() && region.getEndAddress() >= address)
+                        holeEnd = region.getEndAddress() + 1;
+                    else
+                        holeEnd = 0;
+                }
+
+                if (address < holeEnd) {
+                    readSize = std::min<u64>(readSize, holeEnd - address);
+                    if (this->m_zeroBuffer.size() < readSize)
+                        this->m_zeroBuffer.resize(readSize);
+
+                    this->publish(address, this->m_zeroBuffer.data(), readSize);
+                } else {
+                    const auto chunk = this->m_reader.readSpan(address, readSize);
+                    if (chunk.empty())
+                        break;
+
+                    this->publish(address, chunk.data(), chunk.size());
+                    readSize = chunk.size();
+                }
+
+                processed += readSize;
+
+                if (task != nullptr)
+                    task->update(processed);
+            }
+        }
+
+    private:
+        void publish(u64 address, const u8 *data, size_t size) {
+            for (const auto &subscriber : this->m_subscribers)
+                subscriber(address, data, size);
+        }
+
+    private:
+        Provider *m_provider;
+        BufferedReader m_reader;
+        u64 m_address;
+        size_t m_size;
+        size_t m_chunkSize;
+
+        std::vector<Subscriber> m_subscribers;
+        std::vector<u8> m_zeroBuffer;
+    };
+
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <hex.hpp>
+
+namespace hex::prv {
+
+    class Provider;
+
+    /**
+     * @brief Frame-scoped read cache shared by all views
+     *
+     * Within one frame the hex editor, the data inspector and the highlighting
+     * callbacks read largely overlapping provider ranges, each paying the full
+     * patch and overlay path. Reads going through this cache are served from
+     * aligned blocks fetched once per frame instead; blocks of a provider are
+     * dropped whenever it is written to, and the whole cache is dropped at the
+     * end of every frame, so cached data can never outlive the frame it was
+     * read in. Reads too large to be worth caching fall through to the provider
+     */
+    namespace readcache {
+
+        /**
+         * @brief Reads through the cache; offset is absolute, like Provider::read
+         */
+        void read(Provider *provider, u64 offset, void *buffer, size_t size);
+
+        /**
+         * @brief Drops all cached blocks of one provider, called when it's written to or removed
+         */
+        void invalidate(Provider *provider);
+
+        /**
+         * @brief Drops the entire cache, called at the end of every frame
+         */
+        void invalidateAll();
+
+    }
+
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <hex.hpp>
+
+#include <hex/helpers/fs.hpp>
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace hex::prv::iotrace {
+
+    /**
+     * @brief Compact binary trace of the provider read stream
+     *
+     * When enabled, every read going through a provider's read path drops one
+     * fixed-size record (offset, size, latency, caller tag) into a global ring.
+     * The ring overwrites its oldest entries, so tracing can stay on during a
+     * whole interactive session and a dump always holds the most recent reads.
+     * Dumped traces feed the duplicate-range analyzer and the replay job in
+     * headless mode, which re-issues a trace against a provider to compare
+     * backend changes on the exact same access pattern.
+     */
+
+    enum class Kind : u8 {
+        Read = 0,   ///< Provider::read, patches and overlays applied
+        Raw  = 1    ///< Backend readRaw fetch
+    };
+
+    struct Record {
+        u64 offset;
+        u32 size;
+        u32 latencyNs;
+        u16 tagId;
+        u8 kind;
+        u8 reserved;
+    };
+    static_assert(sizeof(Record) == 0x10, "trace records are written to disk verbatim");
+
+    void setEnabled(bool enabled);
+    [[nodiscard]] bool isEnabled();
+
+    /// Number of records currently held in the ring
+    [[nodiscard]] u64 getRecordCount();
+
+    /// Number of records written since the last clear, including overwritten ones
+    [[nodiscard]] u64 getTotalCount();
+
+    void record(Kind kind, u64 offset, size_t size, u64 latencyNs);
+    void clear();
+
+    /**
+     * @brief Tags all reads recorded on the current thread with a subsystem name
+     *
+     * Intended for the top of a draw function or task body, so the analyzer can
+     * attribute the read stream to the code issuing it. Tags nest; the previous
+     * tag is restored when the scope ends.
+     */
+    class ScopedTag {
+    public:
+        explicit ScopedTag(const char *name);
+        ~ScopedTag();
+
+        ScopedTag(const ScopedTag&) = delete;
+        ScopedTag& operator=(const ScopedTag&) = delete;
+
+    private:
+        u16 m_previousId;
+    };
+
+    /**
+     * @brief Times one read and records it when the scope ends
+     *
+     * Constructed at the top of a provider's read path; while tracing is
+     * disabled it costs a single branch.
+     */
+    class Scope {
+    public:
+        Scope(Kind kind, u64 offset, size_t size)
+            : m_kind(kind), m_offset(offset), m_size(size), m_armed(isEnabled()) {
+            if (this->m_armed)
+                this->m_start = std::chrono::steady_clock::now();
+        }
+
+        ~Scope() {
+            if (this->m_armed) {
+                const auto latency = std::chrono::steady_clock::now() - this->m_start;
+                record(this->m_kind, this->m_offset, this->m_size, u64(std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count()));
+            }
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Kind m_kind;
+        u64 m_offset;
+        size_t m_size;
+        bool m_armed;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    /**
+     * @brief Stops tracing and writes the ring to disk, oldest record first
+     */
+    bool dump(const std::fs::path &path);
+
+    struct Trace {
+        std::vector<std::string> tags;
+        std::vector<Record> records;
+    };
+
+    /// Parses a dumped trace back in; returns std::nullopt for malformed files
+    [[nodiscard]] std::optional<Trace> load(const std::fs::path &path);
+
+}
@@ -10,15 +10,25 @@ namespace hex::prv {
     public:
         Overlay() = default;
 
-        void setAddress(u64 address) { this->m_address = address; }
+        void setAddress(u64 address) { this->m_address = address; this->markModified(); }
         [[nodiscard]] u64 getAddress() const { return this->m_address; }
 
         [[nodiscard]] u64 getSize() const { return this->m_data.size(); }
-        [[nodiscard]] std::vector<u8> &getData() { return this->m_data; }
+        [[nodiscard]] std::vector<u8> &getData() { this->markModified(); return this->m_data; }
+        [[nodiscard]] const std::vector<u8> &getData() const { return this->m_data; }
 
     private:
+        friend class Provider;
+
+        void markModified() {
+            if (this->m_modificationCounter != nullptr)
+                (*this->m_modificationCounter)++;
+        }
+
         u64 m_address = 0;
         std::vector<u8> m_data;
+
+        u32 *m_modificationCounter = nullptr;
     };
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <hex.hpp>
+
+#include <hex/helpers/memory_tracker.hpp>
+
+#include <array>
+#include <bitset>
+#include <map>
+#include <memory>
+#include <span>
+
+namespace hex::prv {
+
+    /**
+     * @brief Chunk-granular storage for byte patches
+     *
+     * Patches are kept in fixed-size chunks instead of one map node per byte.
+     * Applying patches to a read turns into a bounded number of chunk lookups
+     * followed by memcpys for fully patched chunks, and copies of a PatchStore
+     * share their chunks until one of them is modified (copy-on-write), which
+     * keeps undo points cheap.
+     */
+    class PatchStore {
+    public:
+        constexpr static size_t ChunkSize = 0x1000;
+
+        struct Chunk {
+            Chunk() { stats().add(sizeof(Chunk)); }
+            Chunk(const Chunk &other) : data(other.data), patched(other.patched), patchCount(other.patchCount) { stats().add(sizeof(Chunk)); }
+            ~Chunk() { stats().remove(sizeof(Chunk)); }
+
+            std::array<u8, ChunkSize> data = { };
+            std::bitset<ChunkSize> patched;
+            size_t patchCount = 0;
+
+        private:
+            static mem::TagStats &stats() {
+                static auto &stats = mem::tag("Provider patches");
+                return stats;
+            }
+        };
+
+        class Iterator {
+        public:
+            using ChunkMap = std::map<u64, std::shared_ptr<Chunk>>;
+
+            Iterator(ChunkMap::const_iterator chunk, ChunkMap::const_iterator end, size_t index);
+
+            [[nodiscard]] std::pair<u64, u8> operator*() const;
+            Iterator &operator++();
+            Iterator operator++(int);
+
+            [[nodiscard]] bool operator==(const Iterator &other) const = default;
+
+        private:
+            void advanceToPatchedByte();
+
+            ChunkMap::const_iterator m_chunk, m_end;
+            size_t m_index;
+        };
+
+        PatchStore() = default;
+
+        void set(u64 address, u8 value);
+        void erase(u64 address);
+
+        [[nodiscard]] bool contains(u64 address) const;
+        [[nodiscard]] u8 at(u64 address) const;
+
+        /**
+         * @brief Overwrites all patched bytes within [offset, offset + size) in the passed buffer
+         */
+        void apply(u64 offset, void *buffer, size_t size) const;
+
+        /**
+         * @brief Patches an entire run of bytes in one pass over the affected chunks
+         */
+        void setRange(u64 address, std::span<const u8> data);
+
+        /**
+         * @brief Shared snapshot of all chunks overlapping a range
+         *
+         * A snapshot references the live chunks instead of copying them; a later write
+         * to a snapshotted chunk clones it first (copy-on-write), so taking and keeping
+         * a snapshot costs one shared pointer per chunk until a chunk is modified.
+         */
+        using ChunkSnapshot = std::map<u64, std::shared_ptr<Chunk>>;
+
+        [[nodiscard]] ChunkSnapshot snapshotChunks(u64 address, size_t size) const;
+
+        /**
+         * @brief Replaces all chunks overlapping the range with the ones from the snapshot
+         */
+        void restoreChunks(u64 address, size_t size, const ChunkSnapshot &snapshot);
+
+        /**
+         * @brief Invokes the callback once for every contiguous run of patched bytes
+         *
+         * Runs never cross chunk boundaries, so the passed spans point directly into chunk storage.
+         */
+        template<typename Callback>
+        void forEachRun(Callback callback) const {
+            for (const auto &[chunkAddress, chunk] : this->m_chunks) {
+                size_t runStart = 0;
+                bool inRun = false;
+
+                for (size_t index = 0; index <= ChunkSize; index++) {
+                    const bool patched = index < ChunkSize && chunk->patched[index];
+
+                    if (patched && !inRun) {
+                        runStart = index;
+                        inRun    = true;
+                    } else if (!patched && inRun) {
+                        callback(chunkAddress + runStart, std::span<const u8>(chunk->data.data() + runStart, index - runStart));
+                        inRun = false;
+                    }
+                }
+            }
+        }
+
+        [[nodiscard]] size_t size() const { return this->m_patchCount; }
+        [[nodiscard]] bool empty() const { return this->m_patchCount == 0; }
+        void clear();
+
+        [[nodiscard]] std::map<u64, u8> toMap() const;
+        void fromMap(const std::map<u64, u8> &patches);
+
+        [[nodiscard]] Iterator begin() const;
+        [[nodiscard]] Iterator end() const;
+
+    private:
+        Chunk &getWritableChunk(u64 chunkAddress);
+
+        std::map<u64, std::shared_ptr<Chunk>> m_chunks;
+        size_t m_patchCount = 0;
+    };
+
+}
@@ -5,21 +5,24 @@
 #include <list>
 #include <map>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
 #include <hex/api/imhex_api.hpp>
 #include <hex/providers/overlay.hpp>
+#include <hex/providers/patch_store.hpp>
+#include <hex/helpers/file.hpp>
 #include <hex/helpers/fs.hpp>
 
 #include <nlohmann/json.hpp>
 
+#include <IntervalTree.h>
+
 namespace hex::prv {
 
     class Provider {
     public:
-        constexpr static size_t PageSize = 0x1000'0000;
-
         Provider();
         virtual ~Provider();
 
@@ -43,25 +46,30 @@ namespace hex::prv {
         virtual void writeRaw(u64 offset, const void *buffer, size_t size) = 0;
         [[nodiscard]] virtual size_t getActualSize() const                 = 0;
 
+        /**
+         * @brief Borrows a read-only view of the raw data without copying it
+         *
+         * Only providers whose backing store is directly addressable (e.g. memory mapped files)
+         * return a view; all others return std::nullopt and callers need to fall back to read().
+         * The returned view doesn't include patches or overlays and is only valid until the
+         * provider is written to, resized or closed.
+         */
+        [[nodiscard]] virtual std::optional<std::span<const u8>> readRawBorrowed(u64 offset, size_t size) const;
+
         void applyOverlays(u64 offset, void *buffer, size_t size);
 
-        [[nodiscard]] std::map<u64, u8> &getPatches();
-        [[nodiscard]] const std::map<u64, u8> &getPatches() const;
+        [[nodiscard]] PatchStore &getPatches();
+        [[nodiscard]] const PatchStore &getPatches() const;
         void applyPatches();
 
         [[nodiscard]] Overlay *newOverlay();
         void deleteOverlay(Overlay *overlay);
         [[nodiscard]] const std::list<Overlay *> &getOverlays();
-
-        [[nodiscard]] u32 getPageCount() const;
-        [[nodiscard]] u32 getCurrentPage() const;
-        void setCurrentPage(u32 page);
+        [[nodiscard]] std::vector<Overlay *> getOverlaysInRange(u64 address, size_t size) const;
 
         virtual void setBaseAddress(u64 address);
         [[nodiscard]] virtual u64 getBaseAddress() const;
-        [[nodiscard]] virtual u64 getCurrentPageAddress() const;
         [[nodiscard]] virtual size_t getSize() const;
-        [[nodiscard]] virtual std::optional<u32> getPageOfAddress(u64 address) const;
 
         [[nodiscard]] virtual std::string getName() const                                                 = 0;
         [[nodiscard]] virtual std::vector<std::pair<std::string, std::string>> getDataInformation() const = 0;
@@ -70,6 +78,17 @@ namespace hex::prv {
         virtual void close() = 0;
 
         void addPatch(u64 offset, const void *buffer, size_t size, bool createUndo = false);
+
+        /**
+         * @brief Applies a contiguous run of bytes as patches in one operation
+         *
+         * Behaves like addPatch() but records the undo information as chunk snapshots
+         * instead of one entry per byte, so large pastes and fills stay proportional to
+         * the number of touched patch chunks. Unlike addPatch(), bytes that match the
+         * underlying data still become patches.
+         */
+        void addBulkPatch(u64 offset, const void *buffer, size_t size, bool createUndo = false);
+
         void createUndoPoint();
 
         void undo();
@@ -78,6 +97,14 @@ namespace hex::prv {
         [[nodiscard]] bool canUndo() const;
         [[nodiscard]] bool canRedo() const;
 
+        /**
+         * @brief Limits the approximate amount of memory the undo history may use. Oldest undo points
+         * spill to a temporary file once the limit is exceeded and get loaded back on deep undo,
+         * so the undo depth stays unlimited. A limit of zero keeps everything in memory.
+         */
+        void setUndoMemoryLimit(size_t bytes) { this->m_maxUndoDeltaSize = bytes; }
+        [[nodiscard]] size_t getUndoMemoryLimit() const { return this->m_maxUndoDeltaSize; }
+
         [[nodiscard]] virtual bool hasFilePicker() const;
         virtual bool handleFilePicker();
 
@@ -99,23 +126,96 @@ namespace hex::prv {
 
         [[nodiscard]] virtual std::pair<Region, bool> getRegionValidity(u64 address) const;
 
+        /**
+         * @brief Cheap fingerprint of the provider's content
+         *
+         * Hashes the data size together with a handful of blocks sampled across the raw data,
+         * so it stays fast even on huge providers. Used to decide whether cached analysis
+         * results stored in a project file still belong to the data being opened. Patches and
+         * overlays are not part of the fingerprint.
+         */
+        [[nodiscard]] u64 getContentFingerprint();
+
         void skipLoadInterface() { this->m_skipLoadInterface = true; }
         [[nodiscard]] bool shouldSkipLoadInterface() const { return this->m_skipLoadInterface; }
 
     protected:
-        u32 m_currPage    = 0;
         u64 m_baseAddress = 0;
 
+        /**
+         * @brief Difference of a single byte between two undo points
+         *
+         * A missing value means the byte wasn't patched on that side of the undo point.
+         */
+        struct PatchChange {
+            std::optional<u8> oldValue, newValue;
+        };
+
+        /**
+         * @brief All changes recorded between two undo points
+         *
+         * Byte edits are stored per byte. Bulk patches instead keep copy-on-write
+         * snapshots of the affected patch chunks from before and after the write,
+         * so undoing a large paste or fill costs one chunk swap per touched chunk
+         * instead of one operation per byte.
+         */
+        struct UndoDelta {
+            struct BulkChange {
+                u64 offset;
+                size_t size;
+                PatchStore::ChunkSnapshot before, after;
+            };
+
+            std::map<u64, PatchChange> changes;
+            std::vector<BulkChange> bulkChanges;
+        };
+
         u32 m_patchTreeOffset = 0;
-        std::list<std::map<u64, u8>> m_patches;
+        PatchStore m_patchStore;
+        std::list<UndoDelta> m_undoDeltas;
+        size_t m_undoDeltaSize = 0;
+        size_t m_maxUndoDeltaSize = 0;
+
+        /**
+         * @brief Spill tier of the undo history
+         *
+         * Undo deltas evicted by the memory budget are appended sequentially to a
+         * temporary file; the offsets list records where each spilled record starts,
+         * newest last. Deep undo pops the newest record back into m_undoDeltas.
+         */
+        fs::File m_undoSpillFile;
+        std::vector<u64> m_undoSpillOffsets;
+
         std::list<Overlay *> m_overlays;
 
+        /**
+         * @brief Consolidated overlay bytes covering one contiguous range
+         *
+         * Overlapping and adjacent overlays are flattened into merged extents with
+         * pooled storage, so a read intersects a handful of large buffers instead
+         * of every individual overlay. Overlays created later override earlier ones
+         * inside a shared extent.
+         */
+        struct OverlayExtent {
+            u64 address;
+            std::vector<u8> data;
+        };
+
+        mutable std::vector<OverlayExtent> m_overlayExtents;
+        mutable interval_tree::IntervalTree<u64, size_t> m_overlayTree;
+        mutable u32 m_overlayModifications = 0, m_overlayTreeModifications = 0;
+
         u32 m_id;
 
         bool m_dirty = false;
         bool m_skipLoadInterface = false;
 
     private:
+        void updateOverlayTree() const;
+
+        void spillOldestUndoDelta();
+        [[nodiscard]] bool reloadSpilledUndoDelta();
+
         static u32 s_idCounter;
     };
 
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cstring>
+#include <future>
+#include <list>
+#include <map>
+#include <vector>
+
+#include <hex/providers/provider.hpp>
+#include <hex/helpers/literals.hpp>
+
+namespace hex::prv {
+
+    using namespace hex::literals;
+
+    /**
+     * @brief Session-local chunk cache for long background reads over a provider
+     *
+     * Long running consumers like pattern evaluation used to issue every field read
+     * through Provider::read(), paying the patch and overlay resolution per access
+     * and contending with the UI's frame reads. A ReadSession instead fetches
+     * fixed-size chunks through the provider once and serves reads out of them,
+     * prefetching the following chunk on a worker thread while the consumer is
+     * still processing the current one. Chunks are never invalidated during the
+     * session, so a run keeps seeing the bytes it already touched; a consumer that
+     * must not publish results over mid-session writes has to detect those itself,
+     * the way the pattern editor's stale-run check does.
+     */
+    class ReadSession {
+    public:
+        explicit ReadSession(Provider *provider, size_t chunkSize = 1_MiB, size_t maxChunkCount = 32)
+            : m_provider(provider), m_chunkSize(chunkSize), m_maxChunkCount(std::max<size_t>(2, maxChunkCount)) { }
+
+        ~ReadSession() {
+            if (this->m_prefetchFuture.valid())
+                this->m_prefetchFuture.wait();
+        }
+
+        ReadSession(const ReadSession&) = delete;
+        ReadSession& operator=(const ReadSession&) = delete;
+
+        void read(u64 offset, u8 *buffer, size_t size) {
+            while (size > 0) {
+                const u64 chunkAddress = offset - (offset % this->m_chunkSize);
+                const auto &chunk      = this->getChunk(chunkAddress);
+
+                const size_t chunkOffset = offset - chunkAddress;
+                if (chunkOffset >= chunk.size()) {
+                    std::memset(buffer, 0x00, size);
+                    return;
+                }
+
+                const size_t copySize = std::min(size, chunk.size() - chunkOffset);
+                std::memcpy(buffer, chunk.data() + chunkOffset, copySize);
+
+                offset += copySize;
+                buffer += copySize;
+                size   -= copySize;
+            }
+        }
+
+    private:
+        const std::vector<u8>& getChunk(u64 chunkAddress) {
+            if (auto chunkIter = this->m_chunks.find(chunkAddress); chunkIter != this->m_chunks.end()) {
+                this->m_lruOrder.splice(this->m_lruOrder.begin(), this->m_lruOrder, chunkIter->second.lruEntry);
+
+                return chunkIter->second.data;
+            }
+
+            auto &chunk = this->m_chunks[chunkAddress];
+            this->m_lruOrder.push_front(chunkAddress);
+            chunk.lruEntry = this->m_lruOrder.begin();
+
+            // If the chunk being entered is the one the prefetch thread loaded, take
+            // it; sequential consumers thereby overlap processing with the next fetch
+            bool loaded = false;
+            if (this->m_prefetchFuture.valid()) {
+                this->m_prefetchFuture.get();
+
+                if (this->m_prefetchAddress == chunkAddress) {
+                    chunk.data = std::move(this->m_prefetchBuffer);
+                    loaded = true;
+                }
+            }
+
+            if (!loaded) {
+                chunk.data.resize(this->getChunkLength(chunkAddress));
+                if (!chunk.data.empty())
+                    this->m_provider->read(chunkAddress, chunk.data.data(), chunk.data.size());
+            }
+
+            this->evictExcessChunks();
+            this->prefetchChunk(chunkAddress + this->m_chunkSize);
+
+            return chunk.data;
+        }
+
+        void prefetchChunk(u64 chunkAddress) {
+            if (this->m_chunks.contains(chunkAddress))
+                return;
+
+            const auto length = this->getChunkLength(chunkAddress);
+            if (length == 0)
+                return;
+
+            this->m_prefetchAddress = chunkAddress;
+            this->m_prefetchBuffer.resize(length);
+            this->m_prefetchFuture = std::async(std::launch::async, [this, chunkAddress, length] {
+                this->m_provider->read(chunkAddress, this->m_prefetchBuffer.data(), length);
+            });
+        }
+
+        [[nodiscard]] size_t getChunkLength(u64 chunkAddress) const {
+            const u64 endAddress = this->m_provider->getBaseAddress() + this->m_provider->getActualSize();
+            if (chunkAddress >= endAddress)
+                return 0;
+
+            return std::min<u64>(this->m_chunkSize, endAddress - chunkAddress);
+        }
+
+        void evictExcessChunks() {
+            while (this->m_chunks.size() > this->m_maxChunkCount) {
+                this->m_chunks.erase(this->m_lruOrder.back());
+                this->m_lruOrder.pop_back();
+            }
+        }
+
+    private:
+        struct CacheChunk {
+            std::vector<u8> data;
+            std::list<u64>::iterator lruEntry;
+        };
+
+        Provider *m_provider;
+        size_t m_chunkSize;
+        size_t m_maxChunkCount;
+
+        std::map<u64, CacheChunk> m_chunks;
+        std::list<u64> m_lruOrder;
+
+        u64 m_prefetchAddress = 0x00;
+        std::vector<u8> m_prefetchBuffer;
+        std::future<void> m_prefetchFuture;
+    };
+
+}
@@ -3,7 +3,10 @@
 #include <hex.hpp>
 
 #include <functional>
+#include <memory>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #define IMGUI_DEFINE_MATH_OPERATORS
 #include <imgui.h>
@@ -63,10 +66,33 @@ namespace ImGui {
         }
 
     private:
+        Texture(ImTextureID textureId, int width, int height)
+            : m_textureId(textureId), m_width(width), m_height(height) { }
+
+        friend class TextureLoader;
+
         ImTextureID m_textureId = nullptr;
         int m_width = 0, m_height = 0;
     };
 
+    /**
+     * @brief Loads images without ever blocking the render thread
+     *
+     * Decoding runs on a background task; the decoded pixels wait in a staging
+     * queue and get uploaded to the GPU at the next frame boundary, since GL
+     * calls are only legal on the render thread. The returned handle starts out
+     * as an invalid placeholder that drawing code already knows how to skip,
+     * and flips to the finished texture right after the upload.
+     */
+    class TextureLoader {
+    public:
+        static std::shared_ptr<Texture> loadAsync(std::vector<ImU8> data, int width = 0, int height = 0);
+        static std::shared_ptr<Texture> loadAsync(const std::string &path);
+
+        /// Uploads all finished decodes; runs once per frame on the render thread
+        static void processStagingQueue();
+    };
+
     int UpdateStringSizeCallback(ImGuiInputTextCallbackData *data);
 
     bool IconHyperlink(const char *icon, const char *label, const ImVec2 &size_arg = ImVec2(0, 0), ImGuiButtonFlags flags = 0);
@@ -114,6 +140,35 @@ namespace ImGui {
         ImGui::TextUnformatted(hex::format(fmt, std::forward<decltype(args)>(args)...).c_str());
     }
 
+    namespace impl {
+
+        constexpr ImU64 CombineHash(ImU64 seed, ImU64 value) {
+            return seed ^ (value + 0x9E37'79B9'7F4A'7C15ULL + (seed << 6) + (seed >> 2));
+        }
+
+        const std::string &GetCachedFormattedText(ImU64 key, const std::function<std::string()> &format);
+
+    }
+
+    /**
+     * @brief TextFormatted variant that memoizes the formatted output
+     *
+     * The formatted string is cached keyed by the hash of the format string and
+     * arguments, so re-submitting unchanged values skips the fmt call entirely.
+     * Entries that stop being submitted get swept out after a while. Arguments
+     * have to be hashable, and a hash collision shows the colliding text, so
+     * this suits the many small, mostly unchanged labels of data-heavy views
+     * rather than free-form content.
+     */
+    void TextFormattedCached(const std::string &fmt, auto &&...args) {
+        ImU64 key = std::hash<std::string>{}(fmt);
+        ((key = impl::CombineHash(key, std::hash<std::decay_t<decltype(args)>>{}(args))), ...);
+
+        ImGui::TextUnformatted(impl::GetCachedFormattedText(key, [&] {
+            return hex::format(fmt, std::forward<decltype(args)>(args)...);
+        }).c_str());
+    }
+
     void TextFormattedColored(ImColor color, const std::string &fmt, auto &&...args) {
         ImGui::TextColored(color, "%s", hex::format(fmt, std::forward<decltype(args)>(args)...).c_str());
     }
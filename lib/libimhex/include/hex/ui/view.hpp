@@ -31,6 +31,20 @@ namespace hex {
 
         virtual void drawContent() = 0;
         virtual void drawAlwaysVisible() { }
+
+        /**
+         * @brief Produces display-ready data off the render thread
+         *
+         * Runs on a worker thread between frames whenever shouldPrepare() returns
+         * true; the next drawContent() then only submits the prepared data. The
+         * window loop joins all prepare phases before a frame starts, so prepare()
+         * never overlaps drawContent() of the same view and the two can share
+         * state without locking. Provider reads and value decoding belong here
+         * instead of in the draw callback.
+         */
+        virtual void prepare() { }
+        [[nodiscard]] virtual bool shouldPrepare() const { return false; }
+
         [[nodiscard]] virtual bool isAvailable() const;
         [[nodiscard]] virtual bool shouldProcess() const { return this->isAvailable() && this->getWindowOpenState(); }
 
@@ -1,17 +1,24 @@
 #include <hex/api/content_registry.hpp>
 
+#include <hex/api/task.hpp>
+
 #include <hex/helpers/fs.hpp>
 #include <hex/helpers/file.hpp>
 #include <hex/helpers/logger.hpp>
 
 #include <hex/ui/view.hpp>
 
+#include <atomic>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <future>
+#include <thread>
 
 #include <nlohmann/json.hpp>
 
 #include <hex/data_processor/node.hpp>
+#include <hex/providers/read_session.hpp>
 
 namespace hex {
 
@@ -19,6 +26,76 @@ namespace hex {
 
         constexpr auto SettingsFile = "settings.json";
 
+        namespace {
+
+            // Write-behind persistence state. write() only mutates the in-memory
+            // document; a background task flushes it once the document has been
+            // quiet for the debounce interval. store() stays the synchronous
+            // force-flush used at startup and exit
+            constexpr auto StoreDebounceInterval = std::chrono::milliseconds(500);
+
+            std::atomic<u64> s_writeGeneration   = 0;
+            std::atomic<u64> s_flushedGeneration = 0;
+            std::atomic<bool> s_flushScheduled   = false;
+            std::atomic<std::chrono::steady_clock::time_point> s_lastWriteTime;
+
+        }
+
+        static void writeSettingsToDisk(const std::string &data) {
+            for (const auto &dir : fs::getDefaultPaths(fs::ImHexPath::Config)) {
+                fs::File file(dir / SettingsFile, fs::File::Mode::Create);
+
+                if (file.isValid()) {
+                    file.write(data);
+                    break;
+                }
+            }
+        }
+
+        static void scheduleFlush() {
+            if (s_flushScheduled.exchange(true))
+                return;
+
+            TaskManager::createIoTask("Storing settings", [](Task &task) {
+                // Wait until the document has been quiet for a while so a dragged
+                // slider causes one write instead of one per changed value
+                for (;;) {
+                    task.update();
+                    std::this_thread::sleep_for(StoreDebounceInterval);
+
+                    if (std::chrono::steady_clock::now() - s_lastWriteTime.load() >= StoreDebounceInterval)
+                        break;
+                }
+
+                // All mutations of the settings document happen on the main thread,
+                // so serialization is pushed there too; only the disk write runs here
+                const auto generation = s_writeGeneration.load();
+                auto serialized = std::make_shared<std::promise<std::string>>();
+                auto future     = serialized->get_future();
+                TaskManager::doLater([serialized] {
+                    serialized->set_value(getSettingsData().dump(4));
+                });
+
+                while (future.wait_for(std::chrono::milliseconds(100)) != std::future_status::ready)
+                    task.update();
+
+                writeSettingsToDisk(future.get());
+                s_flushedGeneration = generation;
+
+                // Writes that arrived while flushing schedule the next round
+                s_flushScheduled = false;
+                if (s_writeGeneration.load() != generation)
+                    scheduleFlush();
+            });
+        }
+
+        void requestStore() {
+            s_writeGeneration++;
+            s_lastWriteTime = std::chrono::steady_clock::now();
+
+            scheduleFlush();
+        }
+
         void load() {
             bool loaded = false;
             for (const auto &dir : fs::getDefaultPaths(fs::ImHexPath::Config)) {
@@ -36,14 +113,9 @@ namespace hex {
         }
 
         void store() {
-            for (const auto &dir : fs::getDefaultPaths(fs::ImHexPath::Config)) {
-                fs::File file(dir / SettingsFile, fs::File::Mode::Create);
+            s_flushedGeneration = s_writeGeneration.load();
 
-                if (file.isValid()) {
-                    file.write(getSettingsData().dump(4));
-                    break;
-                }
-            }
+            writeSettingsToDisk(getSettingsData().dump(4));
         }
 
         void clear() {
@@ -115,6 +187,8 @@ namespace hex {
                 json[unlocalizedCategory] = nlohmann::json::object();
 
             json[unlocalizedCategory][unlocalizedName] = value;
+
+            requestStore();
         }
 
         void write(const std::string &unlocalizedCategory, const std::string &unlocalizedName, const std::string &value) {
@@ -124,6 +198,8 @@ namespace hex {
                 json[unlocalizedCategory] = nlohmann::json::object();
 
             json[unlocalizedCategory][unlocalizedName] = value;
+
+            requestStore();
         }
 
         void write(const std::string &unlocalizedCategory, const std::string &unlocalizedName, const std::vector<std::string> &value) {
@@ -133,6 +209,8 @@ namespace hex {
                 json[unlocalizedCategory] = nlohmann::json::object();
 
             json[unlocalizedCategory][unlocalizedName] = value;
+
+            requestStore();
         }
 
 
@@ -245,8 +323,12 @@ namespace hex {
             runtime.reset();
 
             if (provider != nullptr) {
-                runtime.setDataSource([provider](u64 offset, u8 *buffer, size_t size) {
-                    provider->read(offset, buffer, size);
+                // The runtime reads through its own chunked session, so a long
+                // evaluation pays the patch and overlay resolution once per chunk
+                // instead of once per field and streams ahead of the consumer
+                auto session = std::make_shared<prv::ReadSession>(provider);
+                runtime.setDataSource([session](u64 offset, u8 *buffer, size_t size) {
+                    session->read(offset, buffer, size);
                 }, provider->getBaseAddress(), provider->getActualSize());
             }
 
@@ -399,10 +481,10 @@ namespace hex {
             getLanguages().insert({ languageCode, name });
         }
 
-        void addLocalizations(const std::string &languageCode, const LanguageDefinition &definition) {
-            log::debug("Registered new localization for language {} with {} entries", languageCode, definition.getEntries().size());
+        void addLocalizations(const std::string &languageCode, LanguageDefinitionFactory factory) {
+            log::debug("Registered new localization for language {}", languageCode);
 
-            getLanguageDefinitions()[languageCode].push_back(definition);
+            getLanguageDefinitions()[languageCode].push_back(std::move(factory));
         }
 
         std::map<std::string, std::string> &getLanguages() {
@@ -411,8 +493,8 @@ namespace hex {
             return languages;
         }
 
-        std::map<std::string, std::vector<LanguageDefinition>> &getLanguageDefinitions() {
-            static std::map<std::string, std::vector<LanguageDefinition>> definitions;
+        std::map<std::string, std::vector<LanguageDefinitionFactory>> &getLanguageDefinitions() {
+            static std::map<std::string, std::vector<LanguageDefinitionFactory>> definitions;
 
             return definitions;
         }
@@ -531,12 +613,24 @@ namespace hex {
             getEntries().push_back({ unlocalizedName, callback });
         }
 
+        void addExport(const std::string &unlocalizedName, size_t chunkAlignment, const impl::ExportHeaderCallback &begin, const impl::ExportChunkCallback &chunk, const impl::ExportHeaderCallback &end) {
+            log::debug("Registered new streaming data formatter: {}", unlocalizedName);
+
+            getExportEntries().push_back({ unlocalizedName, chunkAlignment, begin, chunk, end });
+        }
+
         std::vector<impl::Entry> &getEntries() {
             static std::vector<impl::Entry> entries;
 
             return entries;
         }
 
+        std::vector<impl::ExportEntry> &getExportEntries() {
+            static std::vector<impl::ExportEntry> entries;
+
+            return entries;
+        }
+
     }
 
     namespace ContentRegistry::FileHandler {
@@ -616,4 +710,18 @@ namespace hex {
 
     }
 
+    namespace ContentRegistry::DataMetrics {
+
+        std::vector<Metric *> &impl::getMetrics() {
+            static std::vector<Metric *> metrics;
+
+            return metrics;
+        }
+
+        void impl::add(Metric *metric) {
+            getMetrics().push_back(metric);
+        }
+
+    }
+
 }
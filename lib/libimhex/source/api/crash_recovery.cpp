@@ -0,0 +1,308 @@
+#include <hex/api/crash_recovery.hpp>
+
+#include <hex/providers/provider.hpp>
+#include <hex/helpers/file.hpp>
+#include <hex/helpers/fmt.hpp>
+#include <hex/helpers/logger.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <optional>
+
+namespace hex {
+
+    namespace {
+
+        constexpr u32 JournalMagic   = 0x4A52'4849; // "IHRJ"
+        constexpr u32 JournalVersion = 1;
+
+        constexpr auto CommitInterval = std::chrono::seconds(5);
+
+        struct Journal {
+            fs::File file;
+            std::fs::path path;
+            prv::PatchStore::ChunkSnapshot lastChunks;
+            bool dirty = false;
+        };
+
+        std::mutex s_mutex;
+        std::map<prv::Provider *, Journal> s_journals;
+        std::chrono::steady_clock::time_point s_lastCommit;
+
+        std::optional<std::fs::path> getRecoveryDirectory() {
+            for (const auto &folder : fs::getDefaultPaths(fs::ImHexPath::Config, true)) {
+                auto directory = folder / "recovery";
+
+                fs::createDirectories(directory);
+                if (fs::exists(directory))
+                    return directory;
+            }
+
+            return std::nullopt;
+        }
+
+        void writeValue(fs::File &file, auto value) {
+            file.write(reinterpret_cast<const u8 *>(&value), sizeof(value));
+        }
+
+        void writeString(fs::File &file, const std::string &string) {
+            writeValue(file, u32(string.size()));
+            file.write(string);
+        }
+
+        template<typename T>
+        std::optional<T> readValue(fs::File &file) {
+            T value = { };
+            if (file.readBuffer(reinterpret_cast<u8 *>(&value), sizeof(value)) != sizeof(value))
+                return std::nullopt;
+
+            return value;
+        }
+
+        bool openJournal(prv::Provider *provider, Journal &journal) {
+            const auto directory = getRecoveryDirectory();
+            if (!directory.has_value())
+                return false;
+
+            // The timestamp keeps the name from colliding with a leftover journal
+            // of a previous session that hasn't been restored or discarded yet
+            const auto timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+            journal.path = *directory / hex::format("{}_{}.hexrecov", provider->getID(), timestamp);
+            journal.file = fs::File(journal.path, fs::File::Mode::Create);
+            if (!journal.file.isValid())
+                return false;
+
+            writeValue(journal.file, JournalMagic);
+            writeValue(journal.file, JournalVersion);
+            writeString(journal.file, provider->getTypeName());
+            writeString(journal.file, provider->storeSettings().dump());
+
+            return true;
+        }
+
+        /**
+         * @brief Appends the full patch state of one chunk to the journal
+         *
+         * A record replaces everything previously journaled for its chunk, so
+         * replay is last-record-wins and a record with zero runs clears the chunk
+         */
+        void writeChunkRecord(fs::File &file, u64 chunkAddress, const prv::PatchStore::Chunk *chunk) {
+            writeValue(file, chunkAddress);
+
+            if (chunk == nullptr) {
+                writeValue(file, u32(0));
+                return;
+            }
+
+            std::vector<std::pair<u32, u32>> runs;
+            for (size_t index = 0; index < prv::PatchStore::ChunkSize;) {
+                if (!chunk->patched[index]) {
+                    index++;
+                    continue;
+                }
+
+                const size_t runStart = index;
+                while (index < prv::PatchStore::ChunkSize && chunk->patched[index])
+                    index++;
+
+                runs.emplace_back(u32(runStart), u32(index - runStart));
+            }
+
+            writeValue(file, u32(runs.size()));
+            for (const auto &[offset, size] : runs) {
+                writeValue(file, offset);
+                writeValue(file, size);
+                file.write(chunk->data.data() + offset, size);
+            }
+        }
+
+        void writeCheckpoint(prv::Provider *provider, Journal &journal) {
+            if (!journal.file.isValid())
+                return;
+
+            auto chunks = provider->getPatches().snapshotChunks(0x00, std::numeric_limits<size_t>::max());
+
+            // Thanks to copy-on-write, a chunk that was modified since the last
+            // checkpoint carries a different pointer than the one snapshotted back
+            // then. Everything else is unchanged and doesn't need to be written
+            for (const auto &[address, chunk] : chunks) {
+                auto previous = journal.lastChunks.find(address);
+                if (previous != journal.lastChunks.end() && previous->second == chunk)
+                    continue;
+
+                writeChunkRecord(journal.file, address, chunk.get());
+            }
+
+            // Chunks that disappeared entirely (e.g. through an undo) get cleared
+            for (const auto &[address, chunk] : journal.lastChunks) {
+                if (!chunks.contains(address))
+                    writeChunkRecord(journal.file, address, nullptr);
+            }
+
+            journal.file.flush();
+            journal.lastChunks = std::move(chunks);
+            journal.dirty      = false;
+        }
+
+    }
+
+    void CrashRecovery::providerDirtied(prv::Provider *provider) {
+        std::scoped_lock lock(s_mutex);
+
+        auto iter = s_journals.find(provider);
+        if (iter == s_journals.end()) {
+            Journal journal;
+            if (!openJournal(provider, journal))
+                log::error("Failed to create recovery journal for provider '{}'", provider->getName());
+
+            // An invalid journal is kept too so the creation isn't retried on every edit
+            iter = s_journals.emplace(provider, std::move(journal)).first;
+        }
+
+        iter->second.dirty = true;
+    }
+
+    void CrashRecovery::providerClosed(prv::Provider *provider) {
+        std::scoped_lock lock(s_mutex);
+
+        auto iter = s_journals.find(provider);
+        if (iter == s_journals.end())
+            return;
+
+        iter->second.file.close();
+        fs::remove(iter->second.path);
+        s_journals.erase(iter);
+    }
+
+    void CrashRecovery::commit(bool force) {
+        std::scoped_lock lock(s_mutex);
+
+        const auto now = std::chrono::steady_clock::now();
+        if (!force && now - s_lastCommit < CommitInterval)
+            return;
+        s_lastCommit = now;
+
+        for (auto &[provider, journal] : s_journals) {
+            if (journal.dirty)
+                writeCheckpoint(provider, journal);
+        }
+    }
+
+    std::vector<CrashRecovery::PendingRecovery> CrashRecovery::getPendingRecoveries() {
+        std::vector<PendingRecovery> result;
+
+        for (const auto &folder : fs::getDefaultPaths(fs::ImHexPath::Config)) {
+            auto directory = folder / "recovery";
+            if (!fs::exists(directory))
+                continue;
+
+            std::error_code error;
+            for (const auto &entry : std::fs::directory_iterator(directory, error)) {
+                if (entry.path().extension() != ".hexrecov")
+                    continue;
+
+                fs::File file(entry.path(), fs::File::Mode::Read);
+                if (!file.isValid())
+                    continue;
+
+                if (readValue<u32>(file) != JournalMagic || readValue<u32>(file) != JournalVersion)
+                    continue;
+
+                auto typeLength = readValue<u32>(file);
+                if (!typeLength.has_value())
+                    continue;
+                auto providerType = file.readString(*typeLength);
+
+                auto settingsLength = readValue<u32>(file);
+                if (!settingsLength.has_value())
+                    continue;
+                auto settings = file.readString(*settingsLength);
+
+                if (providerType.size() != *typeLength || settings.size() != *settingsLength)
+                    continue;
+
+                result.push_back({ entry.path(), std::move(providerType), std::move(settings) });
+            }
+        }
+
+        return result;
+    }
+
+    bool CrashRecovery::restore(const PendingRecovery &recovery, prv::Provider *provider) {
+        fs::File file(recovery.path, fs::File::Mode::Read);
+        if (!file.isValid())
+            return false;
+
+        // Skip over the header again
+        if (readValue<u32>(file) != JournalMagic || readValue<u32>(file) != JournalVersion)
+            return false;
+        for (u32 i = 0; i < 2; i++) {
+            auto length = readValue<u32>(file);
+            if (!length.has_value())
+                return false;
+
+            file.readString(*length);
+        }
+
+        struct Run {
+            u32 offset;
+            std::vector<u8> data;
+        };
+
+        // Later records replace earlier ones of the same chunk, so only the final
+        // state of each chunk is kept. A crash can tear the very last record; the
+        // parse stops there and everything before it is still restored
+        std::map<u64, std::vector<Run>> chunks;
+        bool torn = false;
+        while (!torn) {
+            auto chunkAddress = readValue<u64>(file);
+            if (!chunkAddress.has_value())
+                break;
+
+            auto runCount = readValue<u32>(file);
+            if (!runCount.has_value() || *runCount > prv::PatchStore::ChunkSize)
+                break;
+
+            std::vector<Run> runs;
+            for (u32 i = 0; i < *runCount; i++) {
+                auto offset = readValue<u32>(file);
+                auto size   = readValue<u32>(file);
+                if (!offset.has_value() || !size.has_value() || u64(*offset) + *size > prv::PatchStore::ChunkSize) {
+                    torn = true;
+                    break;
+                }
+
+                auto data = file.readBytes(*size);
+                if (data.size() != *size) {
+                    torn = true;
+                    break;
+                }
+
+                runs.push_back({ *offset, std::move(data) });
+            }
+
+            if (!torn)
+                chunks.insert_or_assign(*chunkAddress, std::move(runs));
+        }
+
+        auto &patches = provider->getPatches();
+        for (const auto &[chunkAddress, runs] : chunks) {
+            for (const auto &run : runs)
+                patches.setRange(chunkAddress + run.offset, run.data);
+        }
+
+        if (!patches.empty())
+            provider->markDirty();
+
+        return true;
+    }
+
+    void CrashRecovery::discard(const PendingRecovery &recovery) {
+        fs::remove(recovery.path);
+    }
+
+}
@@ -1,8 +1,99 @@
 #include <hex/api/event.hpp>
 
+#include <map>
+#include <mutex>
+#include <optional>
+
 namespace hex {
 
-    EventManager::EventList EventManager::s_events;
-    std::map<void *, EventManager::EventList::iterator> EventManager::s_tokenStore;
+    namespace {
+
+        // (Un)subscriptions are rare; they serialize here and publish a fresh
+        // immutable snapshot that post() iterates without taking a lock
+        std::mutex s_registrationMutex;
+        EventManager::SubscriptionId s_currSubscriptionId = 1;
+        std::multimap<void *, std::pair<EventId, EventManager::SubscriptionId>> s_tokenStore;
+
+        std::mutex s_deferredMutex;
+        std::vector<std::function<void()>> s_deferredEvents;
+
+    }
+
+    std::atomic<std::shared_ptr<const EventManager::EventList>> EventManager::s_events = std::make_shared<const EventManager::EventList>();
+
+    EventManager::SubscriptionId EventManager::subscribeImpl(EventId eventId, std::shared_ptr<EventBase> &&event) {
+        std::scoped_lock lock(s_registrationMutex);
+
+        const auto subscriptionId = s_currSubscriptionId++;
+
+        auto newList = std::make_shared<EventList>(*s_events.load());
+        newList->push_back({ eventId, subscriptionId, std::move(event) });
+        s_events.store(std::move(newList));
+
+        return subscriptionId;
+    }
+
+    void EventManager::unsubscribe(SubscriptionId subscriptionId) noexcept {
+        std::scoped_lock lock(s_registrationMutex);
+
+        auto newList = std::make_shared<EventList>(*s_events.load());
+        std::erase_if(*newList, [&](const Subscriber &subscriber) {
+            return subscriber.subscriptionId == subscriptionId;
+        });
+        s_events.store(std::move(newList));
+    }
+
+    void EventManager::registerTokenSubscription(void *token, EventId eventId, SubscriptionId subscriptionId) {
+        std::scoped_lock lock(s_registrationMutex);
+
+        s_tokenStore.insert({ token, { eventId, subscriptionId } });
+    }
+
+    void EventManager::unsubscribeToken(void *token, EventId eventId) noexcept {
+        std::optional<SubscriptionId> subscriptionId;
+
+        {
+            std::scoped_lock lock(s_registrationMutex);
+
+            auto [begin, end] = s_tokenStore.equal_range(token);
+            for (auto iter = begin; iter != end; ++iter) {
+                if (iter->second.first == eventId) {
+                    subscriptionId = iter->second.second;
+                    s_tokenStore.erase(iter);
+                    break;
+                }
+            }
+        }
+
+        if (subscriptionId.has_value())
+            unsubscribe(*subscriptionId);
+    }
+
+    void EventManager::enqueueDeferred(std::function<void()> &&event) {
+        std::scoped_lock lock(s_deferredMutex);
+
+        s_deferredEvents.push_back(std::move(event));
+    }
+
+    void EventManager::drainDeferred() {
+        // The batch is swapped out under the lock, so an event queued from within
+        // a subscriber lands in the next frame's batch instead of deadlocking
+        std::vector<std::function<void()>> events;
+        {
+            std::scoped_lock lock(s_deferredMutex);
+            std::swap(events, s_deferredEvents);
+        }
+
+        for (const auto &event : events)
+            event();
+    }
+
+    void EventManager::clear() noexcept {
+        std::scoped_lock lock(s_registrationMutex, s_deferredMutex);
+
+        s_events.store(std::make_shared<const EventList>());
+        s_tokenStore.clear();
+        s_deferredEvents.clear();
+    }
 
-}
\ No newline at end of file
+}
@@ -4,6 +4,8 @@
 #include <hex/api/event.hpp>
 #include <hex/providers/provider.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <utility>
 #include <unistd.h>
 
@@ -55,6 +57,11 @@ namespace hex {
                 return s_backgroundHighlightingFunctions;
             }
 
+            static std::map<u32, RegionHighlightingFunction> s_backgroundRegionHighlightingFunctions;
+            std::map<u32, RegionHighlightingFunction> &getBackgroundRegionHighlightingFunctions() {
+                return s_backgroundRegionHighlightingFunctions;
+            }
+
             static std::map<u32, Highlighting> s_foregroundHighlights;
             std::map<u32, Highlighting> &getForegroundHighlights() {
                 return s_foregroundHighlights;
@@ -65,6 +72,11 @@ namespace hex {
                 return s_foregroundHighlightingFunctions;
             }
 
+            static std::map<u32, RegionHighlightingFunction> s_foregroundRegionHighlightingFunctions;
+            std::map<u32, RegionHighlightingFunction> &getForegroundRegionHighlightingFunctions() {
+                return s_foregroundRegionHighlightingFunctions;
+            }
+
             static std::map<u32, Tooltip> s_tooltips;
             std::map<u32, Tooltip> &getTooltips() {
                 return s_tooltips;
@@ -153,6 +165,42 @@ namespace hex {
             EventManager::post<EventHighlightingChanged>();
         }
 
+        u32 addBackgroundRegionHighlightingProvider(const impl::RegionHighlightingFunction &function) {
+            static u32 id = 0;
+
+            id++;
+
+            impl::getBackgroundRegionHighlightingFunctions().insert({ id, function });
+
+            EventManager::post<EventHighlightingChanged>();
+
+            return id;
+        }
+
+        void removeBackgroundRegionHighlightingProvider(u32 id) {
+            impl::getBackgroundRegionHighlightingFunctions().erase(id);
+
+            EventManager::post<EventHighlightingChanged>();
+        }
+
+        u32 addForegroundRegionHighlightingProvider(const impl::RegionHighlightingFunction &function) {
+            static u32 id = 0;
+
+            id++;
+
+            impl::getForegroundRegionHighlightingFunctions().insert({ id, function });
+
+            EventManager::post<EventHighlightingChanged>();
+
+            return id;
+        }
+
+        void removeForegroundRegionHighlightingProvider(u32 id) {
+            impl::getForegroundRegionHighlightingFunctions().erase(id);
+
+            EventManager::post<EventHighlightingChanged>();
+        }
+
         static u32 tooltipId = 0;
         u32 addTooltip(Region region, std::string value, color_t color) {
             tooltipId++;
@@ -212,6 +260,57 @@ namespace hex {
     }
 
 
+    namespace ImHexApi::DataRegions {
+
+        static std::map<prv::Provider *, std::vector<TypedRegion>> s_typedRegions;
+
+        namespace impl {
+
+            void removeProviderRegions(prv::Provider *provider) {
+                s_typedRegions.erase(provider);
+            }
+
+        }
+
+        void set(prv::Provider *provider, std::vector<TypedRegion> regions) {
+            if (provider == nullptr)
+                return;
+
+            s_typedRegions[provider] = std::move(regions);
+        }
+
+        const std::vector<TypedRegion>& get(prv::Provider *provider) {
+            static const std::vector<TypedRegion> EmptyRegions;
+
+            auto iter = s_typedRegions.find(provider);
+            if (iter == s_typedRegions.end())
+                return EmptyRegions;
+
+            return iter->second;
+        }
+
+        RegionType getRegionType(prv::Provider *provider, u64 address) {
+            const auto &regions = get(provider);
+
+            // The entries are sorted and don't overlap, so the only candidate is the
+            // last region starting at or before the queried address
+            auto iter = std::upper_bound(regions.begin(), regions.end(), address, [](u64 address, const TypedRegion &entry) {
+                return address < entry.region.getStartAddress();
+            });
+
+            if (iter == regions.begin())
+                return RegionType::Unknown;
+
+            iter = std::prev(iter);
+            if (address <= iter->region.getEndAddress())
+                return iter->type;
+
+            return RegionType::Unknown;
+        }
+
+    }
+
+
     namespace ImHexApi::Provider {
 
         static i64 s_currentProvider = -1;
@@ -305,6 +404,7 @@ namespace hex {
                 return;
 
             EventManager::post<EventProviderDeleted>(provider);
+            DataRegions::impl::removeProviderRegions(provider);
 
             s_providers.erase(it);
 
@@ -398,6 +498,17 @@ namespace hex {
                 getInitArguments()[key] = value;
             }
 
+            static std::atomic<bool> s_frameDirty = true;
+            static std::function<void()> s_frameWakeCallback;
+
+            void setFrameWakeCallback(const std::function<void()> &callback) {
+                s_frameWakeCallback = callback;
+            }
+
+            bool takeFrameDirty() {
+                return s_frameDirty.exchange(false);
+            }
+
         }
 
 
@@ -431,6 +542,14 @@ namespace hex {
             s_targetFPS = fps;
         }
 
+        void markFrameDirty() {
+            impl::s_frameDirty = true;
+
+            // Wake the window loop if it's currently blocked on events
+            if (impl::s_frameWakeCallback)
+                impl::s_frameWakeCallback();
+        }
+
         float getGlobalScale() {
             return impl::s_globalScale;
         }
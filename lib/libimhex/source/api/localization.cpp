@@ -4,6 +4,14 @@
 
 namespace hex {
 
+    namespace {
+
+        // Bumped whenever the active string table changes so that cached
+        // resolutions inside LangEntry instances go stale
+        u32 s_languageGeneration = 1;
+
+    }
+
     std::string LangEntry::s_fallbackLanguage;
     std::map<std::string, std::string> LangEntry::s_currStrings;
 
@@ -61,28 +69,52 @@ namespace hex {
     }
 
     const std::string &LangEntry::get() const {
+        if (this->m_cachedString != nullptr && this->m_cachedGeneration == s_languageGeneration)
+            return *this->m_cachedString;
+
         auto &lang = LangEntry::s_currStrings;
-        if (lang.contains(this->m_unlocalizedString))
-            return lang[this->m_unlocalizedString];
-        else
-            return this->m_unlocalizedString;
+
+        // Pointers into the string table stay valid until the table is reloaded,
+        // which also bumps the generation and forces a fresh lookup
+        auto entry = lang.find(this->m_unlocalizedString);
+        this->m_cachedString     = entry != lang.end() ? &entry->second : &this->m_unlocalizedString;
+        this->m_cachedGeneration = s_languageGeneration;
+
+        return *this->m_cachedString;
+    }
+
+    const LangEntry &LangEntry::getInterned(const char *unlocalizedString) {
+        static std::map<const char *, LangEntry> s_internedEntries;
+
+        auto entry = s_internedEntries.find(unlocalizedString);
+        if (entry == s_internedEntries.end())
+            entry = s_internedEntries.emplace(unlocalizedString, LangEntry(unlocalizedString)).first;
+
+        return entry->second;
     }
 
     void LangEntry::loadLanguage(const std::string &language) {
         LangEntry::s_currStrings.clear();
+        s_languageGeneration++;
 
         auto &definitions = ContentRegistry::Language::getLanguageDefinitions();
 
         if (!definitions.contains(language))
             return;
 
-        for (auto &definition : definitions[language])
+        // Tables are materialized from their factories here and discarded again
+        // once merged, so only the active language's strings stay resident
+        for (const auto &factory : definitions[language]) {
+            const auto definition = factory();
             LangEntry::s_currStrings.insert(definition.getEntries().begin(), definition.getEntries().end());
+        }
 
         const auto fallbackLanguage = LangEntry::getFallbackLanguage();
         if (language != fallbackLanguage) {
-            for (auto &definition : definitions[fallbackLanguage])
+            for (const auto &factory : definitions[fallbackLanguage]) {
+                const auto definition = factory();
                 LangEntry::s_currStrings.insert(definition.getEntries().begin(), definition.getEntries().end());
+            }
         }
     }
 
@@ -100,6 +132,7 @@ namespace hex {
 
     void LangEntry::resetLanguageStrings() {
         LangEntry::s_currStrings.clear();
+        s_languageGeneration++;
     }
 
 }
\ No newline at end of file
@@ -0,0 +1,90 @@
+#include <hex/api/memory_governor.hpp>
+
+#include <hex/api/imhex_api.hpp>
+#include <hex/helpers/logger.hpp>
+
+#include <algorithm>
+
+namespace hex {
+
+    std::vector<MemoryGovernor::Reclaimer> MemoryGovernor::s_reclaimers;
+    std::map<prv::Provider *, u64> MemoryGovernor::s_lastUse;
+    u64 MemoryGovernor::s_useCounter = 0;
+    size_t MemoryGovernor::s_budget  = 0;
+
+    void MemoryGovernor::registerReclaimer(Reclaimer reclaimer) {
+        log::info("Registered new memory reclaimer: {}", reclaimer.name);
+
+        s_reclaimers.push_back(std::move(reclaimer));
+    }
+
+    void MemoryGovernor::setBudget(size_t bytes) {
+        s_budget = bytes;
+    }
+
+    size_t MemoryGovernor::getBudget() {
+        return s_budget;
+    }
+
+    void MemoryGovernor::providerTouched(prv::Provider *provider) {
+        if (provider == nullptr)
+            return;
+
+        s_useCounter++;
+        s_lastUse[provider] = s_useCounter;
+    }
+
+    void MemoryGovernor::providerClosed(prv::Provider *provider) {
+        s_lastUse.erase(provider);
+    }
+
+    size_t MemoryGovernor::getFootprint(prv::Provider *provider) {
+        size_t footprint = 0;
+        for (const auto &reclaimer : s_reclaimers)
+            footprint += reclaimer.getFootprint(provider);
+
+        return footprint;
+    }
+
+    void MemoryGovernor::enforce() {
+        if (s_budget == 0 || s_reclaimers.empty())
+            return;
+
+        const auto &providers   = ImHexApi::Provider::getProviders();
+        const auto currProvider = ImHexApi::Provider::isValid() ? ImHexApi::Provider::get() : nullptr;
+
+        size_t totalFootprint = 0;
+        std::vector<std::pair<u64, prv::Provider *>> evictionOrder;
+        for (const auto &provider : providers) {
+            totalFootprint += getFootprint(provider);
+
+            if (provider != currProvider)
+                evictionOrder.emplace_back(s_lastUse[provider], provider);
+        }
+
+        if (totalFootprint <= s_budget)
+            return;
+
+        std::sort(evictionOrder.begin(), evictionOrder.end(), [](const auto &a, const auto &b) {
+            return a.first < b.first;
+        });
+
+        // Drop the reconstructible caches of the least-recently-viewed providers
+        // until the budget is met again. The data is recomputed lazily when the
+        // provider's tab is viewed the next time
+        for (const auto &[lastUse, provider] : evictionOrder) {
+            for (const auto &reclaimer : s_reclaimers) {
+                const auto footprint = reclaimer.getFootprint(provider);
+                if (footprint == 0)
+                    continue;
+
+                reclaimer.evict(provider);
+                totalFootprint -= std::min(footprint, totalFootprint);
+            }
+
+            if (totalFootprint <= s_budget)
+                break;
+        }
+    }
+
+}
@@ -1,10 +1,15 @@
 #include <hex/api/plugin_manager.hpp>
 
+#include <hex/api/event.hpp>
+
 #include <hex/helpers/logger.hpp>
 #include <hex/helpers/utils.hpp>
 
+#include <algorithm>
 #include <filesystem>
+#include <optional>
 #include <system_error>
+#include <thread>
 
 namespace hex {
 
@@ -143,6 +148,7 @@ namespace hex {
 
     std::fs::path PluginManager::s_pluginFolder;
     std::vector<Plugin> PluginManager::s_plugins;
+    std::vector<std::function<void()>> PluginManager::s_deferredInitializations;
 
     bool PluginManager::load(const std::fs::path &pluginFolder) {
         if (!fs::exists(pluginFolder))
@@ -150,18 +156,58 @@ namespace hex {
 
         PluginManager::s_pluginFolder = pluginFolder;
 
+        std::vector<std::fs::path> pluginPaths;
         for (auto &pluginPath : std::fs::directory_iterator(pluginFolder)) {
             if (pluginPath.is_regular_file() && pluginPath.path().extension() == ".hexplug")
-                PluginManager::s_plugins.emplace_back(pluginPath.path());
+                pluginPaths.push_back(pluginPath.path());
+        }
+
+        // The libraries are opened and their symbols resolved in parallel; only
+        // initializePlugin() later runs sequentially, since that's where plugins
+        // touch the shared registries. Each path keeps a fixed slot so the load
+        // order stays deterministic regardless of which library finishes first
+        std::sort(pluginPaths.begin(), pluginPaths.end());
+
+        std::vector<std::optional<Plugin>> loadedPlugins(pluginPaths.size());
+        {
+            std::vector<std::jthread> loaders;
+            for (size_t i = 0; i < pluginPaths.size(); i++) {
+                loaders.emplace_back([&, i] {
+                    loadedPlugins[i].emplace(pluginPaths[i]);
+                });
+            }
         }
 
+        for (auto &plugin : loadedPlugins)
+            PluginManager::s_plugins.push_back(std::move(*plugin));
+
         if (PluginManager::s_plugins.empty())
             return false;
 
         return true;
     }
 
+    void PluginManager::addDeferredInitialization(std::function<void()> function) {
+        PluginManager::s_deferredInitializations.push_back(std::move(function));
+    }
+
+    void PluginManager::runDeferredInitializations() {
+        if (PluginManager::s_deferredInitializations.empty())
+            return;
+
+        for (const auto &function : PluginManager::s_deferredInitializations)
+            function();
+        PluginManager::s_deferredInitializations.clear();
+
+        // Deferred registrations may add settings-driven content like languages,
+        // so everything reading those gets a chance to pick them up
+        EventManager::post<EventSettingsChanged>();
+    }
+
     void PluginManager::unload() {
+        // Un-run deferred initializations point into plugin code that's about to go away
+        PluginManager::s_deferredInitializations.clear();
+
         PluginManager::s_plugins.clear();
         PluginManager::s_pluginFolder.clear();
     }
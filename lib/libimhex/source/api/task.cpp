@@ -1,5 +1,6 @@
 #include <hex/api/task.hpp>
 
+#include <hex/api/imhex_api.hpp>
 #include <hex/api/localization.hpp>
 #include <hex/helpers/logger.hpp>
 
@@ -8,17 +9,16 @@
 
 namespace hex {
 
-    std::mutex TaskManager::s_deferredCallsMutex;
+    std::atomic<TaskManager::DeferredCallNode *> TaskManager::s_deferredCallsHead = nullptr;
 
-    std::list<std::shared_ptr<Task>> TaskManager::s_tasks, TaskManager::s_taskQueue;
-    std::list<std::function<void()>> TaskManager::s_deferredCalls;
+    std::list<std::shared_ptr<Task>> TaskManager::s_tasks, TaskManager::s_taskQueue, TaskManager::s_ioTaskQueue;
 
     std::mutex TaskManager::s_queueMutex;
-    std::condition_variable TaskManager::s_jobCondVar;
-    std::vector<std::jthread> TaskManager::s_workers;
+    std::condition_variable TaskManager::s_jobCondVar, TaskManager::s_ioJobCondVar;
+    std::vector<std::jthread> TaskManager::s_workers, TaskManager::s_ioWorkers;
 
-    Task::Task(std::string unlocalizedName, u64 maxValue, bool background, std::function<void(Task &)> function)
-    : m_unlocalizedName(std::move(unlocalizedName)), m_currValue(0), m_maxValue(maxValue), m_function(std::move(function)), m_background(background) { }
+    Task::Task(std::string unlocalizedName, u64 maxValue, bool background, TaskPriority priority, std::function<void(Task &)> function)
+    : m_unlocalizedName(std::move(unlocalizedName)), m_currValue(0), m_maxValue(maxValue), m_function(std::move(function)), m_background(background), m_priority(priority) { }
 
     Task::Task(hex::Task &&other) noexcept {
         {
@@ -36,6 +36,13 @@ namespace hex {
         this->m_hadException    = bool(other.m_hadException);
         this->m_interrupted     = bool(other.m_interrupted);
         this->m_shouldInterrupt = bool(other.m_shouldInterrupt);
+        this->m_priority        = other.m_priority;
+
+        this->m_createdTime     = other.m_createdTime.load();
+        this->m_startTime       = other.m_startTime.load();
+        this->m_lastSampleTime  = other.m_lastSampleTime.load();
+        this->m_lastSampleValue = u64(other.m_lastSampleValue);
+        this->m_throughput      = double(other.m_throughput);
     }
 
     Task::~Task() {
@@ -46,6 +53,27 @@ namespace hex {
     void Task::update(u64 value) {
         this->m_currValue = value;
 
+        // Throughput is sampled on a coarse interval so frequent updates from hot
+        // loops stay cheap; the rate is smoothed across samples to keep the ETA
+        // from jumping around
+        constexpr static auto SampleInterval = std::chrono::milliseconds(500);
+
+        const auto now        = Clock::now();
+        const auto lastSample = this->m_lastSampleTime.load(std::memory_order_relaxed);
+        if (now - lastSample >= SampleInterval) {
+            const auto lastValue = this->m_lastSampleValue.load(std::memory_order_relaxed);
+
+            if (lastSample.time_since_epoch().count() != 0 && value >= lastValue) {
+                const auto instantRate = double(value - lastValue) / std::chrono::duration<double>(now - lastSample).count();
+                const auto smoothedRate = this->m_throughput.load(std::memory_order_relaxed);
+
+                this->m_throughput.store(smoothedRate <= 0 ? instantRate : (smoothedRate + instantRate) / 2, std::memory_order_relaxed);
+            }
+
+            this->m_lastSampleTime.store(now, std::memory_order_relaxed);
+            this->m_lastSampleValue.store(value, std::memory_order_relaxed);
+        }
+
         if (this->m_shouldInterrupt)
             throw TaskInterruptor();
     }
@@ -70,6 +98,10 @@ namespace hex {
         return this->m_background;
     }
 
+    TaskPriority Task::getPriority() const {
+        return this->m_priority;
+    }
+
     bool Task::isFinished() const {
         return this->m_finished;
     }
@@ -104,6 +136,46 @@ namespace hex {
         return this->m_maxValue;
     }
 
+    double Task::getThroughput() const {
+        return this->m_throughput;
+    }
+
+    std::optional<u64> Task::getEstimatedRemainingSeconds() const {
+        const auto throughput = this->m_throughput.load();
+        const u64 maxValue    = this->m_maxValue;
+        const u64 currValue   = this->m_currValue;
+
+        if (throughput <= 0 || maxValue == 0 || currValue >= maxValue)
+            return std::nullopt;
+
+        return u64(double(maxValue - currValue) / throughput);
+    }
+
+    std::chrono::milliseconds Task::getQueuedDuration() const {
+        const auto startTime = this->m_startTime.load();
+        const auto reference = startTime.time_since_epoch().count() != 0 ? startTime : Clock::now();
+
+        return std::chrono::duration_cast<std::chrono::milliseconds>(reference - this->m_createdTime.load());
+    }
+
+    std::chrono::milliseconds Task::getRunningDuration() const {
+        const auto startTime = this->m_startTime.load();
+        if (startTime.time_since_epoch().count() == 0)
+            return std::chrono::milliseconds(0);
+
+        return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - startTime);
+    }
+
+    void Task::start() {
+        const auto now = Clock::now();
+
+        this->m_startTime = now;
+
+        // Seed the sampling state here so queue time never counts into the rate
+        this->m_lastSampleTime  = now;
+        this->m_lastSampleValue = u64(this->m_currValue);
+    }
+
     void Task::finish() {
         this->m_finished = true;
     }
@@ -155,7 +227,17 @@ namespace hex {
 
     void TaskManager::init() {
         for (u32 i = 0; i < std::thread::hardware_concurrency(); i++)
-            TaskManager::s_workers.emplace_back(TaskManager::runner);
+            TaskManager::s_workers.emplace_back([](const std::stop_token &stopToken) {
+                runner(stopToken, s_taskQueue, s_jobCondVar);
+            });
+
+        // Tasks on the I/O pool mostly sleep in blocking reads and writes, so a
+        // small fixed pool is enough and compute workers stay free for actual work
+        constexpr static u32 IoWorkerCount = 4;
+        for (u32 i = 0; i < IoWorkerCount; i++)
+            TaskManager::s_ioWorkers.emplace_back([](const std::stop_token &stopToken) {
+                runner(stopToken, s_ioTaskQueue, s_ioJobCondVar);
+            });
     }
 
     void TaskManager::exit() {
@@ -164,29 +246,41 @@ namespace hex {
 
         for (auto &thread : TaskManager::s_workers)
             thread.request_stop();
+        for (auto &thread : TaskManager::s_ioWorkers)
+            thread.request_stop();
 
         s_jobCondVar.notify_all();
+        s_ioJobCondVar.notify_all();
 
         TaskManager::s_workers.clear();
+        TaskManager::s_ioWorkers.clear();
+
+        // Queued deferred calls won't get another frame to run in
+        auto node = s_deferredCallsHead.exchange(nullptr);
+        while (node != nullptr) {
+            auto next = node->next;
+            delete node;
+            node = next;
+        }
     }
 
-    void TaskManager::runner(const std::stop_token &stopToken) {
-        std::mutex mutex;
+    void TaskManager::runner(const std::stop_token &stopToken, std::list<std::shared_ptr<Task>> &queue, std::condition_variable &condVar) {
         while (true) {
             std::shared_ptr<Task> task;
             {
                 std::unique_lock lock(s_queueMutex);
-                s_jobCondVar.wait(lock, [&] {
-                    return !s_taskQueue.empty() || stopToken.stop_requested();
+                condVar.wait(lock, [&] {
+                    return !queue.empty() || stopToken.stop_requested();
                 });
                 if (stopToken.stop_requested())
                     break;
 
-                task = std::move(s_taskQueue.front());
-                s_taskQueue.pop_front();
+                task = std::move(queue.front());
+                queue.pop_front();
             }
 
             try {
+                task->start();
                 task->m_function(*task);
             } catch (const Task::TaskInterruptor &) {
                 task->interruption();
@@ -202,27 +296,115 @@ namespace hex {
         }
     }
 
-    TaskHolder TaskManager::createTask(std::string name, u64 maxValue, std::function<void(Task &)> function) {
+    TaskHolder TaskManager::createTaskImpl(std::string name, u64 maxValue, bool background, TaskPriority priority, TaskPool pool, std::function<void(Task &)> function) {
         std::unique_lock lock(s_queueMutex);
-        auto task = std::make_shared<Task>(std::move(name), maxValue, false, std::move(function));
+
+        auto task = std::make_shared<Task>(std::move(name), maxValue, background, priority, std::move(function));
         s_tasks.emplace_back(task);
-        s_taskQueue.emplace_back(task);
 
-        s_jobCondVar.notify_one();
+        // Queues stay sorted by priority at insertion time and FIFO within one
+        // priority class, so workers simply pop the front
+        auto &queue = pool == TaskPool::Io ? s_ioTaskQueue : s_taskQueue;
+        auto insertPos = std::find_if(queue.begin(), queue.end(), [&](const auto &queuedTask) {
+            return queuedTask->getPriority() > priority;
+        });
+        queue.insert(insertPos, task);
+
+        (pool == TaskPool::Io ? s_ioJobCondVar : s_jobCondVar).notify_one();
 
         return TaskHolder(s_tasks.back());
     }
 
+    TaskHolder TaskManager::createTask(std::string name, u64 maxValue, std::function<void(Task &)> function) {
+        return createTaskImpl(std::move(name), maxValue, false, TaskPriority::Normal, TaskPool::Compute, std::move(function));
+    }
+
+    TaskHolder TaskManager::createTask(std::string name, u64 maxValue, TaskPriority priority, TaskPool pool, std::function<void(Task &)> function) {
+        return createTaskImpl(std::move(name), maxValue, false, priority, pool, std::move(function));
+    }
+
     TaskHolder TaskManager::createBackgroundTask(std::string name, std::function<void(Task &)> function) {
-        std::unique_lock lock(s_queueMutex);
+        return createTaskImpl(std::move(name), 0, true, TaskPriority::Low, TaskPool::Compute, std::move(function));
+    }
 
-        auto task = std::make_shared<Task>(std::move(name), 0, true, std::move(function));
-        s_tasks.emplace_back(task);
-        s_taskQueue.emplace_back(task);
+    TaskHolder TaskManager::createIoTask(std::string name, std::function<void(Task &)> function) {
+        return createTaskImpl(std::move(name), 0, true, TaskPriority::Normal, TaskPool::Io, std::move(function));
+    }
 
-        s_jobCondVar.notify_one();
+    void TaskManager::parallelFor(Task &task, u64 begin, u64 end, u64 chunkSize, const std::function<void(u64, u64)> &function) {
+        if (begin >= end)
+            return;
 
-        return TaskHolder(s_tasks.back());
+        chunkSize = std::max<u64>(chunkSize, 1);
+
+        const u64 total       = end - begin;
+        const u64 chunkCount  = (total + chunkSize - 1) / chunkSize;
+        const u64 workerCount = std::min<u64>(chunkCount, std::max<u32>(std::thread::hardware_concurrency(), 1));
+
+        task.setMaxValue(total);
+
+        if (workerCount <= 1) {
+            for (u64 chunk = 0; chunk < chunkCount; chunk++) {
+                const u64 chunkBegin = begin + chunk * chunkSize;
+                const u64 chunkEnd   = std::min(end, chunkBegin + chunkSize);
+
+                function(chunkBegin, chunkEnd);
+                task.update(chunkEnd - begin);
+            }
+
+            return;
+        }
+
+        std::atomic<u64> nextChunk = 0;
+        std::atomic<u64> processed = 0;
+        std::atomic<bool> stop     = false;
+
+        std::mutex exceptionMutex;
+        std::exception_ptr exception;
+
+        {
+            std::vector<std::jthread> workers;
+            for (u64 i = 0; i < workerCount; i++) {
+                workers.emplace_back([&] {
+                    try {
+                        while (!stop) {
+                            const u64 chunk = nextChunk++;
+                            if (chunk >= chunkCount)
+                                break;
+
+                            const u64 chunkBegin = begin + chunk * chunkSize;
+                            const u64 chunkEnd   = std::min(end, chunkBegin + chunkSize);
+
+                            function(chunkBegin, chunkEnd);
+                            processed += chunkEnd - chunkBegin;
+                        }
+                    } catch (...) {
+                        std::scoped_lock lock(exceptionMutex);
+                        if (exception == nullptr)
+                            exception = std::current_exception();
+                        stop = true;
+                    }
+                });
+            }
+
+            // Aggregate progress and forward interruption while the workers run;
+            // update() throwing sets the stop flag and the workers get joined on
+            // the way out of this scope
+            try {
+                while (processed < total && !stop) {
+                    task.update(processed);
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                }
+            } catch (...) {
+                stop = true;
+                throw;
+            }
+        }
+
+        if (exception != nullptr)
+            std::rethrow_exception(exception);
+
+        task.update(processed);
     }
 
     void TaskManager::collectGarbage() {
@@ -244,18 +426,37 @@ namespace hex {
 
 
     void TaskManager::doLater(const std::function<void()> &function) {
-        std::scoped_lock lock(s_deferredCallsMutex);
+        auto node = new DeferredCallNode { function, s_deferredCallsHead.load(std::memory_order_relaxed) };
+        while (!s_deferredCallsHead.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed))
+            ;
 
-        s_deferredCalls.push_back(function);
+        // Deferred calls are the main way background threads push UI updates,
+        // so a queued call always warrants a redraw
+        ImHexApi::System::markFrameDirty();
     }
 
     void TaskManager::runDeferredCalls() {
-        std::scoped_lock lock(s_deferredCallsMutex);
-
-        for (const auto &call : s_deferredCalls)
-            call();
+        // The whole batch is claimed with a single exchange. Calls queued while
+        // the batch executes (including from within a deferred call) land in the
+        // next frame's drain instead of deadlocking on a mutex
+        auto node = s_deferredCallsHead.exchange(nullptr, std::memory_order_acquire);
+
+        // The stack comes out newest-first; reverse it so calls run in the order
+        // they were queued
+        DeferredCallNode *batch = nullptr;
+        while (node != nullptr) {
+            auto next  = node->next;
+            node->next = batch;
+            batch      = node;
+            node       = next;
+        }
 
-        s_deferredCalls.clear();
+        while (batch != nullptr) {
+            auto next = batch->next;
+            batch->function();
+            delete batch;
+            batch = next;
+        }
     }
 
 }
\ No newline at end of file
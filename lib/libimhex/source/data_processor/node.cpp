@@ -14,7 +14,31 @@ namespace hex::dp {
             attr.setParentNode(this);
     }
 
-    std::vector<u8> Node::getBufferOnInput(u32 index) {
+    void Node::markDirty() {
+        // Dirtiness always spreads downstream along the links, so a node that's
+        // already flagged has flagged all of its consumers before and the
+        // propagation can stop here
+        if (this->m_dirty)
+            return;
+
+        this->m_dirty = true;
+
+        for (auto &attribute : this->m_attributes) {
+            if (attribute.getIOType() != Attribute::IOType::Out)
+                continue;
+
+            for (auto &[linkId, connectedAttribute] : attribute.getConnectedAttributes())
+                connectedAttribute->getParentNode()->markDirty();
+        }
+    }
+
+    const std::vector<u8> &Node::getBufferOnInput(u32 index) {
+        // The attribute holds its own reference, so the buffer outlives the
+        // returned view for the whole run
+        return *this->getBufferSharedOnInput(index);
+    }
+
+    std::shared_ptr<std::vector<u8>> Node::getBufferSharedOnInput(u32 index) {
         auto attribute = this->getConnectedInputAttribute(index);
 
         if (attribute == nullptr)
@@ -24,14 +48,21 @@ namespace hex::dp {
             throwNodeError("Tried to read buffer from non-buffer attribute");
 
         markInputProcessed(index);
-        attribute->getParentNode()->process();
+
+        // A producer whose output was already computed this run isn't pulled again.
+        // This keeps nodes feeding multiple consumers from being re-evaluated and
+        // lets the scheduler resolve all inputs before a node runs
+        if (attribute->getOutputData() == nullptr)
+            attribute->getParentNode()->process();
 
         auto &outputData = attribute->getOutputData();
 
-        if (!outputData.has_value())
+        if (outputData == nullptr)
             throwNodeError("No data available at connected attribute");
 
-        return outputData.value();
+        this->addProcessedBytes(outputData->size());
+
+        return outputData;
     }
 
     i128 Node::getIntegerOnInput(u32 index) {
@@ -44,11 +75,13 @@ namespace hex::dp {
             throwNodeError("Tried to read integer from non-integer attribute");
 
         markInputProcessed(index);
-        attribute->getParentNode()->process();
+
+        if (attribute->getOutputData() == nullptr)
+            attribute->getParentNode()->process();
 
         auto &outputData = attribute->getOutputData();
 
-        if (!outputData.has_value())
+        if (outputData == nullptr)
             throwNodeError("No data available at connected attribute");
 
         if (outputData->size() < sizeof(u64))
@@ -67,11 +100,13 @@ namespace hex::dp {
             throwNodeError("Tried to read float from non-float attribute");
 
         markInputProcessed(index);
-        attribute->getParentNode()->process();
+
+        if (attribute->getOutputData() == nullptr)
+            attribute->getParentNode()->process();
 
         auto &outputData = attribute->getOutputData();
 
-        if (!outputData.has_value())
+        if (outputData == nullptr)
             throwNodeError("No data available at connected attribute");
 
         if (outputData->size() < sizeof(long double))
@@ -82,7 +117,13 @@ namespace hex::dp {
         return result;
     }
 
-    void Node::setBufferOnOutput(u32 index, const std::vector<u8> &data) {
+    void Node::setBufferOnOutput(u32 index, std::vector<u8> data) {
+        this->setBufferOnOutput(index, std::make_shared<std::vector<u8>>(std::move(data)));
+    }
+
+    // Pass-through nodes hand the shared buffer of one of their inputs straight to
+    // their output, so forwarding large data doesn't copy it
+    void Node::setBufferOnOutput(u32 index, std::shared_ptr<std::vector<u8>> data) {
         if (index >= this->getAttributes().size())
             throwNodeError("Attribute index out of bounds!");
 
@@ -91,7 +132,10 @@ namespace hex::dp {
         if (attribute.getIOType() != Attribute::IOType::Out)
             throwNodeError("Tried to set output data of an input attribute!");
 
-        attribute.getOutputData() = data;
+        if (data != nullptr)
+            this->addProcessedBytes(data->size());
+
+        attribute.getOutputData() = std::move(data);
     }
 
     void Node::setIntegerOnOutput(u32 index, i128 integer) {
@@ -106,7 +150,7 @@ namespace hex::dp {
         std::vector<u8> buffer(sizeof(integer), 0);
         std::memcpy(buffer.data(), &integer, sizeof(integer));
 
-        attribute.getOutputData() = buffer;
+        attribute.getOutputData() = std::make_shared<std::vector<u8>>(std::move(buffer));
     }
 
     void Node::setFloatOnOutput(u32 index, long double floatingPoint) {
@@ -121,7 +165,7 @@ namespace hex::dp {
         std::vector<u8> buffer(sizeof(floatingPoint), 0);
         std::memcpy(buffer.data(), &floatingPoint, sizeof(floatingPoint));
 
-        attribute.getOutputData() = buffer;
+        attribute.getOutputData() = std::make_shared<std::vector<u8>>(std::move(buffer));
     }
 
     void Node::setOverlayData(u64 address, const std::vector<u8> &data) {
@@ -132,4 +176,12 @@ namespace hex::dp {
         this->m_overlay->getData() = data;
     }
 
+    void Node::appendOverlayData(const std::vector<u8> &data) {
+        if (this->m_overlay == nullptr)
+            throwNodeError("Tried setting overlay data on a node that's not the end of a chain!");
+
+        auto &overlayData = this->m_overlay->getData();
+        overlayData.insert(overlayData.end(), data.begin(), data.end());
+    }
+
 }
\ No newline at end of file
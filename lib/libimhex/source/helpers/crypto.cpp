@@ -1,12 +1,12 @@
 #include <hex/helpers/crypto.hpp>
 
 #include <hex/providers/provider.hpp>
+#include <hex/providers/chunk_pipeline.hpp>
 #include <hex/helpers/utils.hpp>
 #include <hex/helpers/concepts.hpp>
 
 #include <mbedtls/version.h>
 #include <mbedtls/base64.h>
-#include <mbedtls/bignum.h>
 #include <mbedtls/md5.h>
 #include <mbedtls/sha1.h>
 #include <mbedtls/sha256.h>
@@ -20,8 +20,21 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <bit>
 
+#if defined(__SSE4_2__)
+    #include <nmmintrin.h>
+#elif defined(__ARM_FEATURE_CRC32)
+    #include <arm_acle.h>
+#endif
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    #define IMHEX_HAS_SHA_INTRINSICS
+    #define IMHEX_HAS_SSSE3_INTRINSICS
+    #include <immintrin.h>
+#endif
+
 #if MBEDTLS_VERSION_MAJOR <= 2
 
     #define mbedtls_md5_starts mbedtls_md5_starts_ret
@@ -45,14 +58,17 @@
 namespace hex::crypt {
     using namespace std::placeholders;
 
-    template<std::invocable<unsigned char *, size_t> Func>
+    template<std::invocable<const unsigned char *, size_t> Func>
     void processDataByChunks(prv::Provider *data, u64 offset, size_t size, Func func) {
-        std::array<u8, 512> buffer = { 0 };
-        for (size_t bufferOffset = 0; bufferOffset < size; bufferOffset += buffer.size()) {
-            const auto readSize = std::min(buffer.size(), size - bufferOffset);
-            data->read(offset + bufferOffset, buffer.data(), readSize);
-            func(buffer.data(), readSize);
-        }
+        // The pipeline handles sparse holes and overlaps the consumer with the
+        // I/O of the next chunk through the reader's prefetching
+        prv::ChunkPipeline pipeline(data, offset, size);
+
+        pipeline.subscribe([&func](u64, const u8 *chunk, size_t chunkSize) {
+            func(chunk, chunkSize);
+        });
+
+        pipeline.process();
     }
 
     template<typename T>
@@ -89,12 +105,15 @@ namespace hex::crypt {
         // mask values, 0b1 << 64 is UB, so use 0b10 << 63
 
     public:
+        constexpr static std::size_t SliceCount = 8;
+
         constexpr Crc(u64 polynomial, u64 init, u64 xorOut, bool reflectInput, bool reflectOutput)
-            : m_value(0x00), m_init(init & ((0b10ull << (NumBits - 1)) - 1)), m_xorOut(xorOut & ((0b10ull << (NumBits - 1)) - 1)),
+            : m_value(0x00), m_polynomial(polynomial & ((0b10ull << (NumBits - 1)) - 1)),
+              m_init(init & ((0b10ull << (NumBits - 1)) - 1)), m_xorOut(xorOut & ((0b10ull << (NumBits - 1)) - 1)),
               m_reflectInput(reflectInput), m_reflectOutput(reflectOutput),
               m_table([polynomial]() {
                 auto reflectedPoly = reflect(polynomial & ((0b10ull << (NumBits - 1)) - 1), NumBits);
-                std::array<uint64_t, 256> table = { 0 };
+                std::array<std::array<uint64_t, 256>, SliceCount> tables = {};
 
                 for (uint32_t i = 0; i < 256; i++) {
                     uint64_t c = i;
@@ -104,10 +123,17 @@ namespace hex::crypt {
                         else
                             c >>= 1;
                     }
-                    table[i] = c;
+                    tables[0][i] = c;
+                }
+
+                // Every further table advances its remainder by one more byte of zeros,
+                // so eight input bytes can be folded with eight independent lookups
+                for (std::size_t t = 1; t < SliceCount; t++) {
+                    for (uint32_t i = 0; i < 256; i++)
+                        tables[t][i] = tables[0][tables[t - 1][i] & 0xFF] ^ (tables[t - 1][i] >> 8);
                 }
 
-                return table;
+                return tables;
          }()) {
             reset();
         };
@@ -116,16 +142,44 @@ namespace hex::crypt {
             this->m_value = reflect(m_init, NumBits);
         }
 
-        constexpr void processBytes(const unsigned char *data, std::size_t size) {
-            for (std::size_t i = 0; i < size; i++) {
-                u8 byte;
-                if (this->m_reflectInput)
-                    byte = data[i];
-                else
-                    byte = reflect(data[i]);
+        void processBytes(const unsigned char *data, std::size_t size) {
+            if (!this->m_reflectInput) {
+                // Non-reflected input can't use the sliced path since every byte needs
+                // its bits reversed first; these parameter sets are rare enough that the
+                // plain table loop is fine here
+                for (std::size_t i = 0; i < size; i++)
+                    this->m_value = this->m_table[0][(this->m_value ^ reflect(data[i])) & 0xFFL] ^ (this->m_value >> 8);
 
-                this->m_value = this->m_table[(this->m_value ^ byte) & 0xFFL] ^ (this->m_value >> 8);
+                return;
             }
+
+            if constexpr (NumBits == 32) {
+                if (this->processBytesHardware(data, size))
+                    return;
+            }
+
+            // Slice-by-8: one 64 bit block per step, eight independent table lookups.
+            // The remaining tail bytes fall through to the byte-wise loop below
+            while (size >= 8) {
+                const u64 block = u64(data[0]) | (u64(data[1]) << 8) | (u64(data[2]) << 16) | (u64(data[3]) << 24)
+                                | (u64(data[4]) << 32) | (u64(data[5]) << 40) | (u64(data[6]) << 48) | (u64(data[7]) << 56);
+                const u64 folded = this->m_value ^ block;
+
+                this->m_value = this->m_table[7][(folded >>  0) & 0xFF]
+                              ^ this->m_table[6][(folded >>  8) & 0xFF]
+                              ^ this->m_table[5][(folded >> 16) & 0xFF]
+                              ^ this->m_table[4][(folded >> 24) & 0xFF]
+                              ^ this->m_table[3][(folded >> 32) & 0xFF]
+                              ^ this->m_table[2][(folded >> 40) & 0xFF]
+                              ^ this->m_table[1][(folded >> 48) & 0xFF]
+                              ^ this->m_table[0][(folded >> 56) & 0xFF];
+
+                data += 8;
+                size -= 8;
+            }
+
+            for (std::size_t i = 0; i < size; i++)
+                this->m_value = this->m_table[0][(this->m_value ^ data[i]) & 0xFFL] ^ (this->m_value >> 8);
         }
 
         [[nodiscard]]
@@ -136,15 +190,69 @@ namespace hex::crypt {
                 return reflect(this->m_value, NumBits) ^ m_xorOut;
         }
 
+    private:
+        // The CRC instructions of x86 and ARM hardwire the CRC32/CRC32C polynomials in
+        // their reflected form, so they only apply to those exact parameter sets
+        bool processBytesHardware([[maybe_unused]] const unsigned char *data, [[maybe_unused]] std::size_t size) {
+            constexpr static u64 Crc32Polynomial  = 0x04C11DB7;
+            constexpr static u64 Crc32CPolynomial = 0x1EDC6F41;
+            hex::unused(Crc32Polynomial, Crc32CPolynomial);
+
+            #if defined(__SSE4_2__)
+                if (this->m_polynomial != Crc32CPolynomial)
+                    return false;
+
+                u64 crc = u32(this->m_value);
+                while (size >= 8) {
+                    const u64 block = u64(data[0]) | (u64(data[1]) << 8) | (u64(data[2]) << 16) | (u64(data[3]) << 24)
+                                    | (u64(data[4]) << 32) | (u64(data[5]) << 40) | (u64(data[6]) << 48) | (u64(data[7]) << 56);
+                    crc = _mm_crc32_u64(crc, block);
+
+                    data += 8;
+                    size -= 8;
+                }
+
+                for (std::size_t i = 0; i < size; i++)
+                    crc = _mm_crc32_u8(u32(crc), data[i]);
+
+                this->m_value = u32(crc);
+                return true;
+            #elif defined(__ARM_FEATURE_CRC32)
+                if (this->m_polynomial != Crc32Polynomial && this->m_polynomial != Crc32CPolynomial)
+                    return false;
+
+                const bool castagnoli = this->m_polynomial == Crc32CPolynomial;
+
+                u32 crc = u32(this->m_value);
+                while (size >= 8) {
+                    const u64 block = u64(data[0]) | (u64(data[1]) << 8) | (u64(data[2]) << 16) | (u64(data[3]) << 24)
+                                    | (u64(data[4]) << 32) | (u64(data[5]) << 40) | (u64(data[6]) << 48) | (u64(data[7]) << 56);
+                    crc = castagnoli ? __crc32cd(crc, block) : __crc32d(crc, block);
+
+                    data += 8;
+                    size -= 8;
+                }
+
+                for (std::size_t i = 0; i < size; i++)
+                    crc = castagnoli ? __crc32cb(crc, data[i]) : __crc32b(crc, data[i]);
+
+                this->m_value = crc;
+                return true;
+            #else
+                return false;
+            #endif
+        }
+
     private:
         u64 m_value;
 
+        u64 m_polynomial;
         u64 m_init;
         u64 m_xorOut;
         bool m_reflectInput;
         bool m_reflectOutput;
 
-        std::array<uint64_t, 256> m_table;
+        std::array<std::array<uint64_t, 256>, SliceCount> m_table;
     };
 
     template<size_t NumBits>
@@ -170,6 +278,464 @@ namespace hex::crypt {
     }
 
 
+    #if defined(IMHEX_HAS_SHA_INTRINSICS)
+
+        // Hardware-accelerated SHA-1/SHA-256 block compression through the x86 SHA
+        // extensions. The round sequences follow the standard formulation of the
+        // sha1rnds4/sha256rnds2 instruction usage; the message schedule advances in
+        // 128 bit groups of four rounds each
+        __attribute__((target("sha,sse4.1")))
+        static void sha1CompressHardware(u32 *state, const unsigned char *data, size_t length) {
+            __m128i abcd, abcdSave, e0, e0Save, e1;
+            __m128i msg0, msg1, msg2, msg3;
+            const __m128i ByteSwapMask = _mm_set_epi64x(0x0001020304050607ULL, 0x08090A0B0C0D0E0FULL);
+
+            abcd = _mm_loadu_si128(reinterpret_cast<const __m128i *>(state));
+            e0   = _mm_set_epi32(state[4], 0, 0, 0);
+            abcd = _mm_shuffle_epi32(abcd, 0x1B);
+
+            while (length >= 64) {
+                abcdSave = abcd;
+                e0Save   = e0;
+
+                // Rounds 0-3
+                msg0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 0));
+                msg0 = _mm_shuffle_epi8(msg0, ByteSwapMask);
+                e0   = _mm_add_epi32(e0, msg0);
+                e1   = abcd;
+                abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+
+                // Rounds 4-7
+                msg1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 16));
+                msg1 = _mm_shuffle_epi8(msg1, ByteSwapMask);
+                e1   = _mm_sha1nexte_epu32(e1, msg1);
+                e0   = abcd;
+                abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+                msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+
+                // Rounds 8-11
+                msg2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 32));
+                msg2 = _mm_shuffle_epi8(msg2, ByteSwapMask);
+                e0   = _mm_sha1nexte_epu32(e0, msg2);
+                e1   = abcd;
+                abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+                msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+                msg0 = _mm_xor_si128(msg0, msg2);
+
+                // Rounds 12-15
+                msg3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 48));
+                msg3 = _mm_shuffle_epi8(msg3, ByteSwapMask);
+                e1   = _mm_sha1nexte_epu32(e1, msg3);
+                e0   = abcd;
+                msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+                abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+                msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+                msg1 = _mm_xor_si128(msg1, msg3);
+
+                // Rounds 16-19
+                e0   = _mm_sha1nexte_epu32(e0, msg0);
+                e1   = abcd;
+                msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+                abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+                msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+                msg2 = _mm_xor_si128(msg2, msg0);
+
+                // Rounds 20-23
+                e1   = _mm_sha1nexte_epu32(e1, msg1);
+                e0   = abcd;
+                msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+                abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+                msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+                msg3 = _mm_xor_si128(msg3, msg1);
+
+                // Rounds 24-27
+                e0   = _mm_sha1nexte_epu32(e0, msg2);
+                e1   = abcd;
+                msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+                abcd = _mm_sha1rnds4_epu32(abcd, e0, 1);
+                msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+                msg0 = _mm_xor_si128(msg0, msg2);
+
+                // Rounds 28-31
+                e1   = _mm_sha1nexte_epu32(e1, msg3);
+                e0   = abcd;
+                msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+                abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+                msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+                msg1 = _mm_xor_si128(msg1, msg3);
+
+                // Rounds 32-35
+                e0   = _mm_sha1nexte_epu32(e0, msg0);
+                e1   = abcd;
+                msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+                abcd = _mm_sha1rnds4_epu32(abcd, e0, 1);
+                msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+                msg2 = _mm_xor_si128(msg2, msg0);
+
+                // Rounds 36-39
+                e1   = _mm_sha1nexte_epu32(e1, msg1);
+                e0   = abcd;
+                msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+                abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+                msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+                msg3 = _mm_xor_si128(msg3, msg1);
+
+                // Rounds 40-43
+                e0   = _mm_sha1nexte_epu32(e0, msg2);
+                e1   = abcd;
+                msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+                abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+                msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+                msg0 = _mm_xor_si128(msg0, msg2);
+
+                // Rounds 44-47
+                e1   = _mm_sha1nexte_epu32(e1, msg3);
+                e0   = abcd;
+                msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+                abcd = _mm_sha1rnds4_epu32(abcd, e1, 2);
+                msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+                msg1 = _mm_xor_si128(msg1, msg3);
+
+                // Rounds 48-51
+                e0   = _mm_sha1nexte_epu32(e0, msg0);
+                e1   = abcd;
+                msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+                abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+                msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+                msg2 = _mm_xor_si128(msg2, msg0);
+
+                // Rounds 52-55
+                e1   = _mm_sha1nexte_epu32(e1, msg1);
+                e0   = abcd;
+                msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+                abcd = _mm_sha1rnds4_epu32(abcd, e1, 2);
+                msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+                msg3 = _mm_xor_si128(msg3, msg1);
+
+                // Rounds 56-59
+                e0   = _mm_sha1nexte_epu32(e0, msg2);
+                e1   = abcd;
+                msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+                abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+                msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+                msg0 = _mm_xor_si128(msg0, msg2);
+
+                // Rounds 60-63
+                e1   = _mm_sha1nexte_epu32(e1, msg3);
+                e0   = abcd;
+                msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+                abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+                msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+                msg1 = _mm_xor_si128(msg1, msg3);
+
+                // Rounds 64-67
+                e0   = _mm_sha1nexte_epu32(e0, msg0);
+                e1   = abcd;
+                msg1 = _mm_sha1msg2_epu32(msg1, msg0);
+                abcd = _mm_sha1rnds4_epu32(abcd, e0, 3);
+                msg3 = _mm_sha1msg1_epu32(msg3, msg0);
+                msg2 = _mm_xor_si128(msg2, msg0);
+
+                // Rounds 68-71
+                e1   = _mm_sha1nexte_epu32(e1, msg1);
+                e0   = abcd;
+                msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+                abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+                msg3 = _mm_xor_si128(msg3, msg1);
+
+                // Rounds 72-75
+                e0   = _mm_sha1nexte_epu32(e0, msg2);
+                e1   = abcd;
+                msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+                abcd = _mm_sha1rnds4_epu32(abcd, e0, 3);
+
+                // Rounds 76-79
+                e1   = _mm_sha1nexte_epu32(e1, msg3);
+                e0   = abcd;
+                abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+
+                e0   = _mm_sha1nexte_epu32(e0, e0Save);
+                abcd = _mm_add_epi32(abcd, abcdSave);
+
+                data += 64;
+                length -= 64;
+            }
+
+            abcd = _mm_shuffle_epi32(abcd, 0x1B);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(state), abcd);
+            state[4] = _mm_extract_epi32(e0, 3);
+        }
+
+        __attribute__((target("sha,sse4.1")))
+        static void sha256CompressHardware(u32 *state, const unsigned char *data, size_t length) {
+            __m128i state0, state1, msg, tmp;
+            __m128i msg0, msg1, msg2, msg3;
+            __m128i abefSave, cdghSave;
+            const __m128i ByteSwapMask = _mm_set_epi64x(0x0C0D0E0F08090A0BULL, 0x0405060700010203ULL);
+
+            tmp    = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&state[0]));
+            state1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&state[4]));
+
+            tmp    = _mm_shuffle_epi32(tmp, 0xB1);
+            state1 = _mm_shuffle_epi32(state1, 0x1B);
+            state0 = _mm_alignr_epi8(tmp, state1, 8);
+            state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+            while (length >= 64) {
+                abefSave = state0;
+                cdghSave = state1;
+
+                // Rounds 0-3
+                msg    = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 0));
+                msg0   = _mm_shuffle_epi8(msg, ByteSwapMask);
+                msg    = _mm_add_epi32(msg0, _mm_set_epi64x(0xE9B5DBA5B5C0FBCFULL, 0x71374491428A2F98ULL));
+                state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+                msg    = _mm_shuffle_epi32(msg, 0x0E);
+                state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+
+                // Rounds 4-7
+                msg1   = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 16));
+                msg1   = _mm_shuffle_epi8(msg1, ByteSwapMask);
+                msg    = _mm_add_epi32(msg1, _mm_set_epi64x(0xAB1C5ED5923F82A4ULL, 0x59F111F13956C25BULL));
+                state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+                msg    = _mm_shuffle_epi32(msg, 0x0E);
+                state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+                msg0   = _mm_sha256msg1_epu32(msg0, msg1);
+
+                // Rounds 8-11
+                msg2   = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 32));
+                msg2   = _mm_shuffle_epi8(msg2, ByteSwapMask);
+                msg    = _mm_add_epi32(msg2, _mm_set_epi64x(0x550C7DC3243185BEULL, 0x12835B01D807AA98ULL));
+                state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+                msg    = _mm_shuffle_epi32(msg, 0x0E);
+                state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+                msg1   = _mm_sha256msg1_epu32(msg1, msg2);
+
+                // Rounds 12-15
+                msg3   = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 48));
+                msg3   = _mm_shuffle_epi8(msg3, ByteSwapMask);
+                msg    = _mm_add_epi32(msg3, _mm_set_epi64x(0xC19BF1749BDC06A7ULL, 0x80DEB1FE72BE5D74ULL));
+                state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+                tmp    = _mm_alignr_epi8(msg3, msg2, 4);
+                msg0   = _mm_add_epi32(msg0, tmp);
+                msg0   = _mm_sha256msg2_epu32(msg0, msg3);
+                msg    = _mm_shuffle_epi32(msg, 0x0E);
+                state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+                msg2   = _mm_sha256msg1_epu32(msg2, msg3);
+
+                // Rounds 16-19
+                msg    = _mm_add_epi32(msg0, _mm_set_epi64x(0x240CA1CC0FC19DC6ULL, 0xEFBE4786E49B69C1ULL));
+                state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+                tmp    = _mm_alignr_epi8(msg0, msg3, 4);
+                msg1   = _mm_add_epi32(msg1, tmp);
+                msg1   = _mm_sha256msg2_epu32(msg1, msg0);
+                msg    = _mm_shuffle_epi32(msg, 0x0E);
+                state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+                msg3   = _mm_sha256msg1_epu32(msg3, msg0);
+
+                // Rounds 20-23
+                msg    = _mm_add_epi32(msg1, _mm_set_epi64x(0x76F988DA5CB0A9DCULL, 0x4A7484AA2DE92C6FULL));
+                state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+                tmp    = _mm_alignr_epi8(msg1, msg0, 4);
+                msg2   = _mm_add_epi32(msg2, tmp);
+                msg2   = _mm_sha256msg2_epu32(msg2, msg1);
+                msg    = _mm_shuffle_epi32(msg, 0x0E);
+                state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+                msg0   = _mm_sha256msg1_epu32(msg0, msg1);
+
+                // Rounds 24-27
+                msg    = _mm_add_epi32(msg2, _mm_set_epi64x(0xBF597FC7B00327C8ULL, 0xA831C66D983E5152ULL));
+                state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+                tmp    = _mm_alignr_epi8(msg2, msg1, 4);
+                msg3   = _mm_add_epi32(msg3, tmp);
+                msg3   = _mm_sha256msg2_epu32(msg3, msg2);
+                msg    = _mm_shuffle_epi32(msg, 0x0E);
+                state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+                msg1   = _mm_sha256msg1_epu32(msg1, msg2);
+
+                // Rounds 28-31
+                msg    = _mm_add_epi32(msg3, _mm_set_epi64x(0x1429296706CA6351ULL, 0xD5A79147C6E00BF3ULL));
+                state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+                tmp    = _mm_alignr_epi8(msg3, msg2, 4);
+                msg0   = _mm_add_epi32(msg0, tmp);
+                msg0   = _mm_sha256msg2_epu32(msg0, msg3);
+                msg    = _mm_shuffle_epi32(msg, 0x0E);
+                state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+                msg2   = _mm_sha256msg1_epu32(msg2, msg3);
+
+                // Rounds 32-35
+                msg    = _mm_add_epi32(msg0, _mm_set_epi64x(0x53380D134D2C6DFCULL, 0x2E1B213827B70A85ULL));
+                state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+                tmp    = _mm_alignr_epi8(msg0, msg3, 4);
+                msg1   = _mm_add_epi32(msg1, tmp);
+                msg1   = _mm_sha256msg2_epu32(msg1, msg0);
+                msg    = _mm_shuffle_epi32(msg, 0x0E);
+                state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+                msg3   = _mm_sha256msg1_epu32(msg3, msg0);
+
+                // Rounds 36-39
+                msg    = _mm_add_epi32(msg1, _mm_set_epi64x(0x92722C8581C2C92EULL, 0x766A0ABB650A7354ULL));
+                state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+                tmp    = _mm_alignr_epi8(msg1, msg0, 4);
+                msg2   = _mm_add_epi32(msg2, tmp);
+                msg2   = _mm_sha256msg2_epu32(msg2, msg1);
+                msg    = _mm_shuffle_epi32(msg, 0x0E);
+                state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+                msg0   = _mm_sha256msg1_epu32(msg0, msg1);
+
+                // Rounds 40-43
+                msg    = _mm_add_epi32(msg2, _mm_set_epi64x(0xC76C51A3C24B8B70ULL, 0xA81A664BA2BFE8A1ULL));
+                state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+                tmp    = _mm_alignr_epi8(msg2, msg1, 4);
+                msg3   = _mm_add_epi32(msg3, tmp);
+                msg3   = _mm_sha256msg2_epu32(msg3, msg2);
+                msg    = _mm_shuffle_epi32(msg, 0x0E);
+                state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+                msg1   = _mm_sha256msg1_epu32(msg1, msg2);
+
+                // Rounds 44-47
+                msg    = _mm_add_epi32(msg3, _mm_set_epi64x(0x106AA070F40E3585ULL, 0xD6990624D192E819ULL));
+                state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+                tmp    = _mm_alignr_epi8(msg3, msg2, 4);
+                msg0   = _mm_add_epi32(msg0, tmp);
+                msg0   = _mm_sha256msg2_epu32(msg0, msg3);
+                msg    = _mm_shuffle_epi32(msg, 0x0E);
+                state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+                msg2   = _mm_sha256msg1_epu32(msg2, msg3);
+
+                // Rounds 48-51
+                msg    = _mm_add_epi32(msg0, _mm_set_epi64x(0x34B0BCB52748774CULL, 0x1E376C0819A4C116ULL));
+                state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+                tmp    = _mm_alignr_epi8(msg0, msg3, 4);
+                msg1   = _mm_add_epi32(msg1, tmp);
+                msg1   = _mm_sha256msg2_epu32(msg1, msg0);
+                msg    = _mm_shuffle_epi32(msg, 0x0E);
+                state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+                msg3   = _mm_sha256msg1_epu32(msg3, msg0);
+
+                // Rounds 52-55
+                msg    = _mm_add_epi32(msg1, _mm_set_epi64x(0x682E6FF35B9CCA4FULL, 0x4ED8AA4A391C0CB3ULL));
+                state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+                tmp    = _mm_alignr_epi8(msg1, msg0, 4);
+                msg2   = _mm_add_epi32(msg2, tmp);
+                msg2   = _mm_sha256msg2_epu32(msg2, msg1);
+                msg    = _mm_shuffle_epi32(msg, 0x0E);
+                state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+
+                // Rounds 56-59
+                msg    = _mm_add_epi32(msg2, _mm_set_epi64x(0x8CC7020884C87814ULL, 0x78A5636F748F82EEULL));
+                state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+                tmp    = _mm_alignr_epi8(msg2, msg1, 4);
+                msg3   = _mm_add_epi32(msg3, tmp);
+                msg3   = _mm_sha256msg2_epu32(msg3, msg2);
+                msg    = _mm_shuffle_epi32(msg, 0x0E);
+                state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+
+                // Rounds 60-63
+                msg    = _mm_add_epi32(msg3, _mm_set_epi64x(0xC67178F2BEF9A3F7ULL, 0xA4506CEB90BEFFFAULL));
+                state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+                msg    = _mm_shuffle_epi32(msg, 0x0E);
+                state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+
+                state0 = _mm_add_epi32(state0, abefSave);
+                state1 = _mm_add_epi32(state1, cdghSave);
+
+                data += 64;
+                length -= 64;
+            }
+
+            tmp    = _mm_shuffle_epi32(state0, 0x1B);
+            state1 = _mm_shuffle_epi32(state1, 0xB1);
+            state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+            state1 = _mm_alignr_epi8(state1, tmp, 8);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&state[0]), state0);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(&state[4]), state1);
+        }
+
+        // Both hashes share their block size and length padding, only the initial state,
+        // the compression function and the digest size differ
+        template<size_t StateWords>
+        class ShaStream {
+        public:
+            constexpr static size_t BlockSize = 64;
+
+            ShaStream(const std::array<u32, StateWords> &initialState, void (*compress)(u32 *state, const unsigned char *data, size_t length))
+                : m_state(initialState), m_compress(compress) { }
+
+            void update(const unsigned char *data, std::size_t size) {
+                this->m_totalSize += size;
+
+                if (this->m_bufferSize > 0) {
+                    const auto fill = std::min(size, BlockSize - this->m_bufferSize);
+                    std::memcpy(this->m_buffer.data() + this->m_bufferSize, data, fill);
+                    this->m_bufferSize += fill;
+                    data += fill;
+                    size -= fill;
+
+                    if (this->m_bufferSize == BlockSize) {
+                        this->m_compress(this->m_state.data(), this->m_buffer.data(), BlockSize);
+                        this->m_bufferSize = 0;
+                    }
+                }
+
+                // Whole blocks go to the compression function straight from the input
+                const auto blockBytes = size - (size % BlockSize);
+                if (blockBytes > 0) {
+                    this->m_compress(this->m_state.data(), data, blockBytes);
+                    data += blockBytes;
+                    size -= blockBytes;
+                }
+
+                if (size > 0) {
+                    std::memcpy(this->m_buffer.data(), data, size);
+                    this->m_bufferSize = size;
+                }
+            }
+
+            template<size_t DigestSize>
+            std::array<u8, DigestSize> finish() {
+                // Terminator bit, zero padding up to the last eight block bytes, then the
+                // big endian bit length
+                const u64 bitLength  = this->m_totalSize * 8;
+                const auto remainder = this->m_totalSize % BlockSize;
+
+                std::array<u8, BlockSize * 2> padding = { 0x80 };
+                const auto padLength = (remainder < 56 ? 56 : 120) - remainder;
+
+                for (std::size_t i = 0; i < 8; i++)
+                    padding[padLength + i] = u8(bitLength >> (56 - i * 8));
+
+                this->update(padding.data(), padLength + 8);
+
+                std::array<u8, DigestSize> result = { 0 };
+                for (std::size_t i = 0; i < DigestSize; i++)
+                    result[i] = u8(this->m_state[i / 4] >> (24 - (i % 4) * 8));
+
+                return result;
+            }
+
+        private:
+            std::array<u32, StateWords> m_state;
+            void (*m_compress)(u32 *state, const unsigned char *data, size_t length);
+
+            std::array<u8, BlockSize> m_buffer = { 0 };
+            std::size_t m_bufferSize = 0;
+            u64 m_totalSize = 0;
+        };
+
+        constexpr static std::array<u32, 5> Sha1InitialState   = { 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0 };
+        constexpr static std::array<u32, 8> Sha256InitialState = { 0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19 };
+
+        // Detected once on first use and cached for the rest of the session
+        static bool hasShaExtensions() {
+            static const bool Available = __builtin_cpu_supports("sha") && __builtin_cpu_supports("sse4.1");
+
+            return Available;
+        }
+
+    #endif
+
     std::array<u8, 16> md5(prv::Provider *&data, u64 offset, size_t size) {
         std::array<u8, 16> result = { 0 };
 
@@ -187,7 +753,7 @@ namespace hex::crypt {
         return result;
     }
 
-    std::array<u8, 16> md5(const std::vector<u8> &data) {
+    std::array<u8, 16> md5(std::span<const u8> data) {
         std::array<u8, 16> result = { 0 };
 
         mbedtls_md5_context ctx;
@@ -203,6 +769,18 @@ namespace hex::crypt {
     }
 
     std::array<u8, 20> sha1(prv::Provider *&data, u64 offset, size_t size) {
+        #if defined(IMHEX_HAS_SHA_INTRINSICS)
+            if (hasShaExtensions()) {
+                ShaStream<5> stream(Sha1InitialState, sha1CompressHardware);
+
+                processDataByChunks(data, offset, size, [&stream](const unsigned char *chunk, size_t chunkSize) {
+                    stream.update(chunk, chunkSize);
+                });
+
+                return stream.finish<20>();
+            }
+        #endif
+
         std::array<u8, 20> result = { 0 };
 
         mbedtls_sha1_context ctx;
@@ -219,7 +797,17 @@ namespace hex::crypt {
         return result;
     }
 
-    std::array<u8, 20> sha1(const std::vector<u8> &data) {
+    std::array<u8, 20> sha1(std::span<const u8> data) {
+        #if defined(IMHEX_HAS_SHA_INTRINSICS)
+            if (hasShaExtensions()) {
+                ShaStream<5> stream(Sha1InitialState, sha1CompressHardware);
+
+                stream.update(data.data(), data.size());
+
+                return stream.finish<20>();
+            }
+        #endif
+
         std::array<u8, 20> result = { 0 };
 
         mbedtls_sha1_context ctx;
@@ -251,7 +839,7 @@ namespace hex::crypt {
         return result;
     }
 
-    std::array<u8, 28> sha224(const std::vector<u8> &data) {
+    std::array<u8, 28> sha224(std::span<const u8> data) {
         std::array<u8, 28> result = { 0 };
 
         mbedtls_sha256_context ctx;
@@ -267,6 +855,18 @@ namespace hex::crypt {
     }
 
     std::array<u8, 32> sha256(prv::Provider *&data, u64 offset, size_t size) {
+        #if defined(IMHEX_HAS_SHA_INTRINSICS)
+            if (hasShaExtensions()) {
+                ShaStream<8> stream(Sha256InitialState, sha256CompressHardware);
+
+                processDataByChunks(data, offset, size, [&stream](const unsigned char *chunk, size_t chunkSize) {
+                    stream.update(chunk, chunkSize);
+                });
+
+                return stream.finish<32>();
+            }
+        #endif
+
         std::array<u8, 32> result = { 0 };
 
         mbedtls_sha256_context ctx;
@@ -283,7 +883,17 @@ namespace hex::crypt {
         return result;
     }
 
-    std::array<u8, 32> sha256(const std::vector<u8> &data) {
+    std::array<u8, 32> sha256(std::span<const u8> data) {
+        #if defined(IMHEX_HAS_SHA_INTRINSICS)
+            if (hasShaExtensions()) {
+                ShaStream<8> stream(Sha256InitialState, sha256CompressHardware);
+
+                stream.update(data.data(), data.size());
+
+                return stream.finish<32>();
+            }
+        #endif
+
         std::array<u8, 32> result = { 0 };
 
         mbedtls_sha256_context ctx;
@@ -315,7 +925,7 @@ namespace hex::crypt {
         return result;
     }
 
-    std::array<u8, 48> sha384(const std::vector<u8> &data) {
+    std::array<u8, 48> sha384(std::span<const u8> data) {
         std::array<u8, 48> result = { 0 };
 
         mbedtls_sha512_context ctx;
@@ -347,7 +957,7 @@ namespace hex::crypt {
         return result;
     }
 
-    std::array<u8, 64> sha512(const std::vector<u8> &data) {
+    std::array<u8, 64> sha512(std::span<const u8> data) {
         std::array<u8, 64> result = { 0 };
 
         mbedtls_sha512_context ctx;
@@ -363,65 +973,631 @@ namespace hex::crypt {
     }
 
 
-    std::vector<u8> decode64(const std::vector<u8> &input) {
+    class Md5Stream : public HashStream {
+    public:
+        Md5Stream() {
+            mbedtls_md5_init(&this->m_ctx);
+            mbedtls_md5_starts(&this->m_ctx);
+        }
+
+        ~Md5Stream() override {
+            mbedtls_md5_free(&this->m_ctx);
+        }
+
+        void update(const unsigned char *data, size_t size) override {
+            mbedtls_md5_update(&this->m_ctx, data, size);
+        }
+
+        std::vector<u8> finish() override {
+            // Finish a copy of the context so more data can still be appended
+            mbedtls_md5_context ctx;
+            mbedtls_md5_init(&ctx);
+            mbedtls_md5_clone(&ctx, &this->m_ctx);
+
+            std::vector<u8> result(16, 0x00);
+            mbedtls_md5_finish(&ctx, result.data());
+            mbedtls_md5_free(&ctx);
+
+            return result;
+        }
+
+    private:
+        mbedtls_md5_context m_ctx;
+    };
+
+    class Sha1Stream : public HashStream {
+    public:
+        Sha1Stream() {
+            mbedtls_sha1_init(&this->m_ctx);
+            mbedtls_sha1_starts(&this->m_ctx);
+        }
+
+        ~Sha1Stream() override {
+            mbedtls_sha1_free(&this->m_ctx);
+        }
+
+        void update(const unsigned char *data, size_t size) override {
+            mbedtls_sha1_update(&this->m_ctx, data, size);
+        }
+
+        std::vector<u8> finish() override {
+            mbedtls_sha1_context ctx;
+            mbedtls_sha1_init(&ctx);
+            mbedtls_sha1_clone(&ctx, &this->m_ctx);
+
+            std::vector<u8> result(20, 0x00);
+            mbedtls_sha1_finish(&ctx, result.data());
+            mbedtls_sha1_free(&ctx);
+
+            return result;
+        }
+
+    private:
+        mbedtls_sha1_context m_ctx;
+    };
+
+    class Sha256Stream : public HashStream {
+    public:
+        explicit Sha256Stream(bool is224) : m_is224(is224) {
+            mbedtls_sha256_init(&this->m_ctx);
+            mbedtls_sha256_starts(&this->m_ctx, this->m_is224);
+        }
+
+        ~Sha256Stream() override {
+            mbedtls_sha256_free(&this->m_ctx);
+        }
+
+        void update(const unsigned char *data, size_t size) override {
+            mbedtls_sha256_update(&this->m_ctx, data, size);
+        }
+
+        std::vector<u8> finish() override {
+            mbedtls_sha256_context ctx;
+            mbedtls_sha256_init(&ctx);
+            mbedtls_sha256_clone(&ctx, &this->m_ctx);
+
+            std::vector<u8> result(this->m_is224 ? 28 : 32, 0x00);
+            mbedtls_sha256_finish(&ctx, result.data());
+            mbedtls_sha256_free(&ctx);
+
+            return result;
+        }
+
+    private:
+        mbedtls_sha256_context m_ctx;
+        bool m_is224;
+    };
+
+    class Sha512Stream : public HashStream {
+    public:
+        explicit Sha512Stream(bool is384) : m_is384(is384) {
+            mbedtls_sha512_init(&this->m_ctx);
+            mbedtls_sha512_starts(&this->m_ctx, this->m_is384);
+        }
+
+        ~Sha512Stream() override {
+            mbedtls_sha512_free(&this->m_ctx);
+        }
+
+        void update(const unsigned char *data, size_t size) override {
+            mbedtls_sha512_update(&this->m_ctx, data, size);
+        }
+
+        std::vector<u8> finish() override {
+            mbedtls_sha512_context ctx;
+            mbedtls_sha512_init(&ctx);
+            mbedtls_sha512_clone(&ctx, &this->m_ctx);
+
+            std::vector<u8> result(this->m_is384 ? 48 : 64, 0x00);
+            mbedtls_sha512_finish(&ctx, result.data());
+            mbedtls_sha512_free(&ctx);
+
+            return result;
+        }
+
+    private:
+        mbedtls_sha512_context m_ctx;
+        bool m_is384;
+    };
+
+    #if defined(IMHEX_HAS_SHA_INTRINSICS)
+
+        template<size_t StateWords, size_t DigestSize>
+        class HardwareShaStream : public HashStream {
+        public:
+            HardwareShaStream(const std::array<u32, StateWords> &initialState, void (*compress)(u32 *state, const unsigned char *data, size_t length))
+                : m_stream(initialState, compress) { }
+
+            void update(const unsigned char *data, size_t size) override {
+                this->m_stream.update(data, size);
+            }
+
+            std::vector<u8> finish() override {
+                // Padding happens on a copy so more data can still be appended
+                auto stream = this->m_stream;
+                auto digest = stream.template finish<DigestSize>();
+
+                return { digest.begin(), digest.end() };
+            }
+
+        private:
+            ShaStream<StateWords> m_stream;
+        };
+
+    #endif
+
+    // Portable XXH64 implementation. The 32 byte stripe buffer makes it usable
+    // through the streaming interface with arbitrarily sized updates
+    class XxHash64Stream : public HashStream {
+        constexpr static u64 Prime1 = 0x9E37'79B1'85EB'CA87;
+        constexpr static u64 Prime2 = 0xC2B2'AE3D'27D4'EB4F;
+        constexpr static u64 Prime3 = 0x1656'67B1'9E37'79F9;
+        constexpr static u64 Prime4 = 0x85EB'CA77'C2B2'AE63;
+        constexpr static u64 Prime5 = 0x27D4'EB2F'1656'67C5;
+
+        constexpr static size_t StripeSize = 32;
+
+    public:
+        XxHash64Stream() : m_accumulators({ Prime1 + Prime2, Prime2, 0, 0 - Prime1 }) { }
+
+        void update(const unsigned char *data, size_t size) override {
+            this->m_totalSize += size;
+
+            if (this->m_bufferSize > 0) {
+                const auto fill = std::min(size, StripeSize - this->m_bufferSize);
+                std::memcpy(this->m_buffer.data() + this->m_bufferSize, data, fill);
+                this->m_bufferSize += fill;
+                data += fill;
+                size -= fill;
+
+                if (this->m_bufferSize == StripeSize) {
+                    this->processStripe(this->m_buffer.data());
+                    this->m_bufferSize = 0;
+                }
+            }
 
-        size_t written = 0;
-        mbedtls_base64_decode(nullptr, 0, &written, reinterpret_cast<const unsigned char *>(input.data()), input.size());
-        std::vector<u8> output(written, 0x00);
-        if (mbedtls_base64_decode(output.data(), output.size(), &written, reinterpret_cast<const unsigned char *>(input.data()), input.size()))
+            while (size >= StripeSize) {
+                this->processStripe(data);
+                data += StripeSize;
+                size -= StripeSize;
+            }
+
+            if (size > 0) {
+                std::memcpy(this->m_buffer.data(), data, size);
+                this->m_bufferSize = size;
+            }
+        }
+
+        std::vector<u8> finish() override {
+            u64 result = 0x00;
+
+            if (this->m_totalSize >= StripeSize) {
+                auto &[v1, v2, v3, v4] = this->m_accumulators;
+
+                result = std::rotl(v1, 1) + std::rotl(v2, 7) + std::rotl(v3, 12) + std::rotl(v4, 18);
+                for (const auto &accumulator : { v1, v2, v3, v4 }) {
+                    result ^= round(0x00, accumulator);
+                    result  = result * Prime1 + Prime4;
+                }
+            } else {
+                result = Prime5;
+            }
+
+            result += this->m_totalSize;
+
+            // At most 31 bytes never made it into a full stripe
+            const u8 *tail = this->m_buffer.data();
+            auto left = this->m_bufferSize;
+            while (left >= 8) {
+                result ^= round(0x00, read64(tail));
+                result  = std::rotl(result, 27) * Prime1 + Prime4;
+                tail += 8;
+                left -= 8;
+            }
+
+            if (left >= 4) {
+                result ^= u64(read32(tail)) * Prime1;
+                result  = std::rotl(result, 23) * Prime2 + Prime3;
+                tail += 4;
+                left -= 4;
+            }
+
+            while (left > 0) {
+                result ^= *tail * Prime5;
+                result  = std::rotl(result, 11) * Prime1;
+                tail += 1;
+                left -= 1;
+            }
+
+            result ^= result >> 33;
+            result *= Prime2;
+            result ^= result >> 29;
+            result *= Prime3;
+            result ^= result >> 32;
+
+            // Canonical XXH64 representation stores the hash value big endian
+            std::vector<u8> digest(sizeof(result), 0x00);
+            for (size_t i = 0; i < digest.size(); i++)
+                digest[i] = u8(result >> (56 - i * 8));
+
+            return digest;
+        }
+
+    private:
+        constexpr static u64 round(u64 accumulator, u64 input) {
+            accumulator += input * Prime2;
+            accumulator  = std::rotl(accumulator, 31);
+            accumulator *= Prime1;
+
+            return accumulator;
+        }
+
+        static u64 read64(const u8 *data) {
+            u64 value = 0x00;
+            for (size_t i = 0; i < sizeof(value); i++)
+                value |= u64(data[i]) << (i * 8);
+
+            return value;
+        }
+
+        static u32 read32(const u8 *data) {
+            u32 value = 0x00;
+            for (size_t i = 0; i < sizeof(value); i++)
+                value |= u32(data[i]) << (i * 8);
+
+            return value;
+        }
+
+        void processStripe(const u8 *stripe) {
+            for (size_t i = 0; i < this->m_accumulators.size(); i++)
+                this->m_accumulators[i] = round(this->m_accumulators[i], read64(stripe + i * 8));
+        }
+
+    private:
+        std::array<u64, 4> m_accumulators;
+
+        std::array<u8, StripeSize> m_buffer = { 0 };
+        size_t m_bufferSize = 0;
+        u64 m_totalSize = 0;
+    };
+
+    template<size_t NumBits>
+    class CrcStream : public HashStream {
+    public:
+        CrcStream(u32 polynomial, u32 init, u32 xorout, bool reflectIn, bool reflectOut, size_t digestSize)
+            : m_crc(polynomial, init, xorout, reflectIn, reflectOut), m_digestSize(digestSize) { }
+
+        void update(const unsigned char *data, size_t size) override {
+            this->m_crc.processBytes(data, size);
+        }
+
+        std::vector<u8> finish() override {
+            // Same byte layout as the crc8/crc16/crc32 convenience functions, which
+            // memcpy the checksum integer into the result buffer
+            const auto checksum = this->m_crc.checksum();
+
+            std::vector<u8> result(this->m_digestSize, 0x00);
+            for (size_t i = 0; i < result.size() && i < sizeof(checksum); i++)
+                result[i] = u8(checksum >> (i * 8));
+
+            return result;
+        }
+
+    private:
+        Crc<NumBits> m_crc;
+        size_t m_digestSize;
+    };
+
+    std::unique_ptr<HashStream> createMd5Stream() {
+        return std::make_unique<Md5Stream>();
+    }
+
+    std::unique_ptr<HashStream> createSha1Stream() {
+        #if defined(IMHEX_HAS_SHA_INTRINSICS)
+            if (hasShaExtensions())
+                return std::make_unique<HardwareShaStream<5, 20>>(Sha1InitialState, sha1CompressHardware);
+        #endif
+
+        return std::make_unique<Sha1Stream>();
+    }
+
+    std::unique_ptr<HashStream> createSha224Stream() {
+        return std::make_unique<Sha256Stream>(true);
+    }
+
+    std::unique_ptr<HashStream> createSha256Stream() {
+        #if defined(IMHEX_HAS_SHA_INTRINSICS)
+            if (hasShaExtensions())
+                return std::make_unique<HardwareShaStream<8, 32>>(Sha256InitialState, sha256CompressHardware);
+        #endif
+
+        return std::make_unique<Sha256Stream>(false);
+    }
+
+    std::unique_ptr<HashStream> createSha384Stream() {
+        return std::make_unique<Sha512Stream>(true);
+    }
+
+    std::unique_ptr<HashStream> createSha512Stream() {
+        return std::make_unique<Sha512Stream>(false);
+    }
+
+    std::unique_ptr<HashStream> createXxHash64Stream() {
+        return std::make_unique<XxHash64Stream>();
+    }
+
+    std::unique_ptr<HashStream> createCrcStream(u32 width, u32 polynomial, u32 init, u32 xorout, bool reflectIn, bool reflectOut, size_t digestSize) {
+        switch (width) {
+            case 8:  return std::make_unique<CrcStream<8>>(polynomial, init, xorout, reflectIn, reflectOut, digestSize);
+            case 16: return std::make_unique<CrcStream<16>>(polynomial, init, xorout, reflectIn, reflectOut, digestSize);
+            case 32: return std::make_unique<CrcStream<32>>(polynomial, init, xorout, reflectIn, reflectOut, digestSize);
+            default: return nullptr;
+        }
+    }
+
+    #if defined(IMHEX_HAS_SSSE3_INTRINSICS)
+
+        // Detected once on first use and cached for the rest of the session
+        static bool hasSsse3Extensions() {
+            static const bool Available = __builtin_cpu_supports("ssse3");
+
+            return Available;
+        }
+
+        __attribute__((target("ssse3")))
+        static size_t encodeBase64Bulk(const u8 *input, size_t size, u8 *output) {
+            size_t processed = 0, written = 0;
+
+            // Each iteration loads 16 bytes, spreads the first twelve over four 32 bit
+            // lanes of three bytes each, splits them into 6 bit indices and maps those
+            // to their ASCII alphabet through an offset lookup
+            while (processed + 16 <= size) {
+                __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + processed));
+
+                in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+
+                const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00));
+                const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+                const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003F03F0));
+                const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+
+                const __m128i indices = _mm_or_si128(t1, t3);
+
+                __m128i offsets = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+                const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+                offsets = _mm_or_si128(offsets, _mm_and_si128(less, _mm_set1_epi8(13)));
+
+                const __m128i OffsetLut = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+                const __m128i result = _mm_add_epi8(_mm_shuffle_epi8(OffsetLut, offsets), indices);
+
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(output + written), result);
+
+                processed += 12;
+                written   += 16;
+            }
+
+            return processed;
+        }
+
+        __attribute__((target("ssse3")))
+        static size_t decodeBase64Bulk(const u8 *input, size_t size, u8 *output, size_t &written) {
+            size_t processed = 0;
+            written = 0;
+
+            // Each iteration turns 16 alphabet characters into their twelve data bytes.
+            // The nibble lookups flag every character outside the plain alphabet, so a
+            // block containing padding, whitespace or garbage ends the bulk pass and
+            // leaves everything from there to the scalar decoder. Bulk blocks align
+            // with the 4 character groups, so the decodings concatenate cleanly
+            const __m128i LutLo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+            const __m128i LutHi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+            const __m128i LutRoll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+
+            while (processed + 16 <= size) {
+                const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + processed));
+
+                const __m128i hiNibbles = _mm_and_si128(_mm_srli_epi32(in, 4), _mm_set1_epi8(0x0F));
+                const __m128i loNibbles = _mm_and_si128(in, _mm_set1_epi8(0x0F));
+
+                const __m128i lo = _mm_shuffle_epi8(LutLo, loNibbles);
+                const __m128i hi = _mm_shuffle_epi8(LutHi, hiNibbles);
+
+                if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128())) != 0)
+                    break;
+
+                const __m128i eq2F = _mm_cmpeq_epi8(in, _mm_set1_epi8(0x2F));
+                const __m128i roll = _mm_shuffle_epi8(LutRoll, _mm_add_epi8(eq2F, hiNibbles));
+
+                const __m128i values = _mm_add_epi8(in, roll);
+
+                __m128i merged = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+                merged = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+                merged = _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(output + written), merged);
+
+                processed += 16;
+                written   += 12;
+            }
+
+            return processed;
+        }
+
+    #endif
+
+    std::vector<u8> decode64(std::span<const u8> input) {
+        // The vector store always writes full 16 byte blocks, so the buffer keeps a
+        // few bytes of slack past the upper bound of the decoded size
+        std::vector<u8> output((input.size() / 4) * 3 + 4, 0x00);
+
+        size_t decoded = 0, written = 0;
+
+        #if defined(IMHEX_HAS_SSSE3_INTRINSICS)
+            if (hasSsse3Extensions())
+                decoded = decodeBase64Bulk(input.data(), input.size(), output.data(), written);
+        #endif
+
+        size_t tailWritten = 0;
+        if (mbedtls_base64_decode(output.data() + written, output.size() - written, &tailWritten, input.data() + decoded, input.size() - decoded))
             return {};
 
-        output.resize(written);
+        output.resize(written + tailWritten);
 
         return output;
     }
 
-    std::vector<u8> encode64(const std::vector<u8> &input) {
+    std::vector<u8> decode64(const std::vector<u8> &input) {
+        return decode64(std::span<const u8>(input.data(), input.size()));
+    }
+
+    std::vector<u8> encode64(std::span<const u8> input) {
+        // One extra byte for the null terminator mbedtls appends to the tail
+        std::vector<u8> output(((input.size() + 2) / 3) * 4 + 1, 0x00);
 
-        size_t written = 0;
-        mbedtls_base64_encode(nullptr, 0, &written, reinterpret_cast<const unsigned char *>(input.data()), input.size());
+        size_t encoded = 0, written = 0;
 
-        std::vector<u8> output(written, 0x00);
-        if (mbedtls_base64_encode(output.data(), output.size(), &written, reinterpret_cast<const unsigned char *>(input.data()), input.size()))
+        #if defined(IMHEX_HAS_SSSE3_INTRINSICS)
+            if (hasSsse3Extensions()) {
+                encoded = encodeBase64Bulk(input.data(), input.size(), output.data());
+                written = (encoded / 3) * 4;
+            }
+        #endif
+
+        size_t tailWritten = 0;
+        if (mbedtls_base64_encode(output.data() + written, output.size() - written, &tailWritten, input.data() + encoded, input.size() - encoded))
             return {};
 
-        output.resize(written);
+        output.resize(written + tailWritten);
 
         return output;
     }
 
-    std::vector<u8> decode16(const std::string &input) {
-        std::vector<u8> output(input.length() / 2, 0x00);
+    std::vector<u8> encode64(const std::vector<u8> &input) {
+        return encode64(std::span<const u8>(input.data(), input.size()));
+    }
 
-        mbedtls_mpi ctx;
-        mbedtls_mpi_init(&ctx);
+    #if defined(IMHEX_HAS_SSSE3_INTRINSICS)
 
-        ON_SCOPE_EXIT { mbedtls_mpi_free(&ctx); };
+        __attribute__((target("ssse3")))
+        static size_t encodeHexBulk(const u8 *input, size_t size, char *output) {
+            const __m128i HexLut = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F');
 
-        if (mbedtls_mpi_read_string(&ctx, 16, input.c_str()))
-            return {};
+            // Each iteration maps 16 bytes to their 32 hex characters by looking both
+            // nibbles up in the alphabet and interleaving the results
+            size_t processed = 0, written = 0;
+            for (; processed + 16 <= size; processed += 16, written += 32) {
+                const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + processed));
+
+                const __m128i hi = _mm_shuffle_epi8(HexLut, _mm_and_si128(_mm_srli_epi32(in, 4), _mm_set1_epi8(0x0F)));
+                const __m128i lo = _mm_shuffle_epi8(HexLut, _mm_and_si128(in, _mm_set1_epi8(0x0F)));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(output + written), _mm_unpacklo_epi8(hi, lo));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(output + written + 16), _mm_unpackhi_epi8(hi, lo));
+            }
+
+            return processed;
+        }
+
+        __attribute__((target("ssse3")))
+        static size_t decodeHexBulk(const u8 *input, size_t size, u8 *output, size_t &written) {
+            size_t processed = 0;
+            written = 0;
+
+            // Each iteration turns 16 hex characters of either case into their eight
+            // bytes. A block containing anything but hex digits ends the bulk pass and
+            // leaves everything from there to the scalar decoder
+            while (processed + 16 <= size) {
+                const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + processed));
+
+                const __m128i digits  = _mm_sub_epi8(in, _mm_set1_epi8('0'));
+                const __m128i letters = _mm_sub_epi8(_mm_or_si128(in, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+
+                const __m128i digitMask  = _mm_cmpeq_epi8(_mm_subs_epu8(digits, _mm_set1_epi8(9)), _mm_setzero_si128());
+                const __m128i letterMask = _mm_cmpeq_epi8(_mm_subs_epu8(letters, _mm_set1_epi8(5)), _mm_setzero_si128());
+
+                if (_mm_movemask_epi8(_mm_or_si128(digitMask, letterMask)) != 0xFFFF)
+                    break;
+
+                const __m128i nibbles = _mm_or_si128(_mm_and_si128(digitMask, digits), _mm_and_si128(letterMask, _mm_add_epi8(letters, _mm_set1_epi8(10))));
+
+                const __m128i bytes = _mm_maddubs_epi16(nibbles, _mm_set1_epi16(0x0110));
+                _mm_storel_epi64(reinterpret_cast<__m128i *>(output + written), _mm_packus_epi16(bytes, _mm_setzero_si128()));
+
+                processed += 16;
+                written   += 8;
+            }
+
+            return processed;
+        }
 
-        if (mbedtls_mpi_write_binary(&ctx, output.data(), output.size()))
+    #endif
+
+    constexpr static i8 hexCharValue(u8 character) {
+        if (character >= '0' && character <= '9')
+            return character - '0';
+        else if (character >= 'a' && character <= 'f')
+            return character - 'a' + 10;
+        else if (character >= 'A' && character <= 'F')
+            return character - 'A' + 10;
+        else
+            return -1;
+    }
+
+    std::vector<u8> decode16(std::span<const u8> input) {
+        if (input.size() % 2 != 0)
             return {};
 
+        std::vector<u8> output(input.size() / 2, 0x00);
+
+        size_t decoded = 0, written = 0;
+
+        #if defined(IMHEX_HAS_SSSE3_INTRINSICS)
+            if (hasSsse3Extensions())
+                decoded = decodeHexBulk(input.data(), input.size(), output.data(), written);
+        #endif
+
+        for (; decoded < input.size(); decoded += 2, written++) {
+            const auto hi = hexCharValue(input[decoded + 0]);
+            const auto lo = hexCharValue(input[decoded + 1]);
+
+            if (hi < 0 || lo < 0)
+                return {};
+
+            output[written] = (hi << 4) | lo;
+        }
+
         return output;
     }
 
-    std::string encode16(const std::vector<u8> &input) {
+    std::vector<u8> decode16(const std::string &input) {
+        return decode16(std::span<const u8>(reinterpret_cast<const u8 *>(input.data()), input.size()));
+    }
 
+    std::string encode16(std::span<const u8> input) {
         if (input.empty())
             return {};
 
         std::string output(input.size() * 2, '\0');
 
-        for (size_t i = 0; i < input.size(); i++) {
-            output[2 * i + 0] = "0123456789ABCDEF"[input[i] / 16];
-            output[2 * i + 1] = "0123456789ABCDEF"[input[i] % 16];
+        size_t processed = 0;
+
+        #if defined(IMHEX_HAS_SSSE3_INTRINSICS)
+            if (hasSsse3Extensions())
+                processed = encodeHexBulk(input.data(), input.size(), output.data());
+        #endif
+
+        for (; processed < input.size(); processed++) {
+            output[2 * processed + 0] = "0123456789ABCDEF"[input[processed] / 16];
+            output[2 * processed + 1] = "0123456789ABCDEF"[input[processed] % 16];
         }
 
         return output;
     }
 
+    std::string encode16(const std::vector<u8> &input) {
+        return encode16(std::span<const u8>(input.data(), input.size()));
+    }
+
     template<typename T>
     static T safeLeftShift(T t, u32 shift) {
         if (shift >= sizeof(t) * 8) {
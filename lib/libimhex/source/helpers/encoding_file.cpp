@@ -18,21 +18,66 @@ namespace hex {
     }
 
     std::pair<std::string_view, size_t> EncodingFile::getEncodingFor(const std::vector<u8> &buffer) const {
-        for (auto riter = this->m_mapping.crbegin(); riter != this->m_mapping.crend(); ++riter) {
-            const auto &[size, mapping] = *riter;
+        u32 nodeIndex = 0;
 
-            if (size > buffer.size()) continue;
+        const std::string *longestMatch = nullptr;
+        size_t longestMatchLength       = 0;
 
-            auto key = std::vector<u8>(buffer.begin(), buffer.begin() + size);
-            if (mapping.contains(key))
-                return { mapping.at(key), size };
+        for (size_t index = 0; index < buffer.size(); index++) {
+            const auto &children = this->m_trie[nodeIndex].children;
+
+            const auto child = children.find(buffer[index]);
+            if (child == children.end())
+                break;
+
+            nodeIndex = child->second;
+
+            if (const auto &value = this->m_trie[nodeIndex].value; value.has_value()) {
+                longestMatch       = &*value;
+                longestMatchLength = index + 1;
+            }
+        }
+
+        if (longestMatch == nullptr)
+            return { ".", 1 };
+
+        return { *longestMatch, longestMatchLength };
+    }
+
+    void EncodingFile::insertSequence(const std::vector<u8> &from, const std::string &to) {
+        u32 nodeIndex = 0;
+        for (const auto byte : from) {
+            u32 next = 0;
+            if (const auto iter = this->m_trie[nodeIndex].children.find(byte); iter != this->m_trie[nodeIndex].children.end()) {
+                next = iter->second;
+            } else {
+                next = u32(this->m_trie.size());
+
+                // Growing the trie can move every node, so the child link is
+                // re-resolved instead of held across the insertion
+                this->m_trie.emplace_back();
+                this->m_trie[nodeIndex].children.emplace(byte, next);
+            }
+
+            nodeIndex = next;
         }
 
-        return { ".", 1 };
+        this->m_trie[nodeIndex].value = to;
     }
 
     void EncodingFile::parseThingyFile(fs::File &file) {
-        for (const auto &line : splitString(file.readString(), "\n")) {
+        // Iterate over a mapped view of the file instead of copying it into a
+        // string and splitting that into per-line strings
+        const auto content = file.map();
+        const std::string_view text(reinterpret_cast<const char *>(content.data()), content.size());
+
+        for (size_t lineStart = 0; lineStart < text.size();) {
+            auto lineEnd = text.find('\n', lineStart);
+            if (lineEnd == std::string_view::npos)
+                lineEnd = text.size();
+
+            const auto line = text.substr(lineStart, lineEnd - lineStart);
+            lineStart = lineEnd + 1;
 
             std::string from, to;
             {
@@ -41,8 +86,8 @@ namespace hex {
                 if (delimiterPos >= line.length())
                     continue;
 
-                from = line.substr(0, delimiterPos);
-                to   = line.substr(delimiterPos + 1);
+                from = std::string(line.substr(0, delimiterPos));
+                to   = std::string(line.substr(delimiterPos + 1));
 
                 if (from.empty()) continue;
             }
@@ -55,9 +100,7 @@ namespace hex {
             if (to.empty())
                 to = " ";
 
-            if (!this->m_mapping.contains(fromBytes.size()))
-                this->m_mapping.insert({ fromBytes.size(), {} });
-            this->m_mapping[fromBytes.size()].insert({ fromBytes, to });
+            this->insertSequence(fromBytes, to);
 
             this->m_longestSequence = std::max(this->m_longestSequence, fromBytes.size());
         }
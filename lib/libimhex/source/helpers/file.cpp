@@ -4,6 +4,13 @@
 
 #include <unistd.h>
 
+#if defined(OS_WINDOWS)
+    #include <windows.h>
+    #include <io.h>
+#else
+    #include <sys/mman.h>
+#endif
+
 namespace hex::fs {
 
     File::File(const std::fs::path &path, Mode mode) noexcept : m_path(path) {
@@ -33,6 +40,13 @@ namespace hex::fs {
     File::File(File &&other) noexcept {
         this->m_file = other.m_file;
         other.m_file = nullptr;
+
+        this->m_map     = other.m_map;
+        this->m_mapSize = other.m_mapSize;
+        other.m_map     = nullptr;
+        other.m_mapSize = 0;
+
+        this->m_mapFallback = std::move(other.m_mapFallback);
     }
 
     File::~File() {
@@ -40,11 +54,20 @@ namespace hex::fs {
     }
 
     File &File::operator=(File &&other) noexcept {
+        this->unmap();
+
         this->m_file = other.m_file;
         other.m_file = nullptr;
 
         this->m_path = std::move(other.m_path);
 
+        this->m_map     = other.m_map;
+        this->m_mapSize = other.m_mapSize;
+        other.m_map     = nullptr;
+        other.m_mapSize = 0;
+
+        this->m_mapFallback = std::move(other.m_mapFallback);
+
         return *this;
     }
 
@@ -54,16 +77,74 @@ namespace hex::fs {
     }
 
     void File::close() {
+        this->unmap();
+
         if (isValid()) {
             std::fclose(this->m_file);
             this->m_file = nullptr;
         }
     }
 
+    std::span<const u8> File::map() {
+        if (!isValid()) return {};
+
+        if (this->m_map != nullptr)
+            return { static_cast<const u8 *>(this->m_map), this->m_mapSize };
+        if (!this->m_mapFallback.empty())
+            return { this->m_mapFallback.data(), this->m_mapFallback.size() };
+
+        const auto size = getSize();
+        if (size == 0) return {};
+
+        #if defined(OS_WINDOWS)
+            auto fileHandle = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(this->m_file)));
+
+            HANDLE mapping = CreateFileMapping(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping != nullptr) {
+                this->m_map = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, size);
+
+                // The view keeps the mapping object alive on its own
+                CloseHandle(mapping);
+            }
+        #else
+            auto mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileno(this->m_file), 0);
+            if (mapped != MAP_FAILED)
+                this->m_map = mapped;
+        #endif
+
+        if (this->m_map != nullptr) {
+            this->m_mapSize = size;
+            return { static_cast<const u8 *>(this->m_map), this->m_mapSize };
+        }
+
+        // Mapping failed, fall back to reading a copy into memory
+        this->seek(0x00);
+        this->m_mapFallback = this->readBytes();
+
+        return { this->m_mapFallback.data(), this->m_mapFallback.size() };
+    }
+
+    void File::unmap() {
+        if (this->m_map != nullptr) {
+            #if defined(OS_WINDOWS)
+                UnmapViewOfFile(this->m_map);
+            #else
+                ::munmap(this->m_map, this->m_mapSize);
+            #endif
+
+            this->m_map     = nullptr;
+            this->m_mapSize = 0;
+        }
+
+        this->m_mapFallback.clear();
+    }
+
     size_t File::readBuffer(u8 *buffer, size_t size) {
         if (!isValid()) return 0;
 
-        return fread(buffer, size, 1, this->m_file);
+        // Read byte-wise so the returned count is the number of bytes transferred,
+        // including the short read at the end of the file
+        return fread(buffer, 1, size, this->m_file);
     }
 
     std::vector<u8> File::readBytes(size_t numBytes) {
@@ -3,12 +3,149 @@
 #include <hex/helpers/fs.hpp>
 #include <hex/helpers/fmt.hpp>
 
+#include <array>
+#include <atomic>
 #include <iostream>
+#include <thread>
 
 namespace hex::log {
 
     static fs::File g_loggerFile;
 
+    namespace {
+
+        /**
+         * @brief Bounded multi-producer ring of preformatted log records.
+         *
+         * Producers reserve a slot through a compare-exchange on the enqueue
+         * position and hand the slot back through its sequence number, so pushing
+         * never takes a lock. When every slot is occupied, push fails and the
+         * caller counts the record as dropped instead of blocking
+         */
+        class LogRing {
+        public:
+            constexpr static size_t Capacity = 0x800;
+
+            LogRing() {
+                for (size_t i = 0; i < Capacity; i++)
+                    this->m_slots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+
+            bool push(std::string &&record) {
+                auto pos = this->m_enqueuePos.load(std::memory_order_relaxed);
+
+                while (true) {
+                    auto &slot = this->m_slots[pos & (Capacity - 1)];
+
+                    const auto sequence = slot.sequence.load(std::memory_order_acquire);
+                    const auto diff     = intptr_t(sequence) - intptr_t(pos);
+
+                    if (diff == 0) {
+                        if (this->m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                            slot.record = std::move(record);
+                            slot.sequence.store(pos + 1, std::memory_order_release);
+
+                            return true;
+                        }
+                    } else if (diff < 0) {
+                        // The ring is full
+                        return false;
+                    } else {
+                        pos = this->m_enqueuePos.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            bool pop(std::string &record) {
+                const auto pos = this->m_dequeuePos;
+                auto &slot = this->m_slots[pos & (Capacity - 1)];
+
+                const auto sequence = slot.sequence.load(std::memory_order_acquire);
+                if (intptr_t(sequence) - intptr_t(pos + 1) != 0)
+                    return false;
+
+                record = std::move(slot.record);
+                slot.record.clear();
+                slot.sequence.store(pos + Capacity, std::memory_order_release);
+                this->m_dequeuePos = pos + 1;
+
+                return true;
+            }
+
+        private:
+            struct Slot {
+                std::atomic<size_t> sequence;
+                std::string record;
+            };
+
+            std::array<Slot, Capacity> m_slots;
+            std::atomic<size_t> m_enqueuePos = 0;
+
+            // Only the writer thread dequeues, so this needs no synchronization
+            size_t m_dequeuePos = 0;
+        };
+
+        LogRing g_logRing;
+        std::atomic<size_t> g_droppedRecords = 0;
+        std::atomic<bool> g_asyncEnabled     = false;
+        std::jthread g_writerThread;
+
+        void writerLoop(const std::stop_token &stopToken) {
+            std::string record;
+
+            while (true) {
+                bool wroteAnything = false;
+                while (g_logRing.pop(record)) {
+                    std::fwrite(record.data(), 1, record.size(), getDestination());
+                    wroteAnything = true;
+                }
+
+                if (auto dropped = g_droppedRecords.exchange(0, std::memory_order_relaxed); dropped > 0) {
+                    const auto message = hex::format("Dropped {0} log records because the log ring was full\n", dropped);
+                    std::fwrite(message.data(), 1, message.size(), getDestination());
+                    wroteAnything = true;
+                }
+
+                if (wroteAnything)
+                    std::fflush(getDestination());
+                else if (stopToken.stop_requested())
+                    break;
+                else
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+        }
+
+    }
+
+    namespace impl {
+
+        bool isAsyncEnabled() {
+            return g_asyncEnabled.load(std::memory_order_relaxed);
+        }
+
+        void enqueueRecord(std::string &&record) {
+            if (!g_logRing.push(std::move(record)))
+                g_droppedRecords.fetch_add(1, std::memory_order_relaxed);
+        }
+
+    }
+
+    void enableAsyncMode(bool enabled) {
+        if (enabled == g_asyncEnabled)
+            return;
+
+        if (enabled) {
+            g_writerThread = std::jthread(writerLoop);
+            g_asyncEnabled = true;
+        } else {
+            // New records go back to the synchronous path while the writer drains the rest
+            g_asyncEnabled = false;
+
+            g_writerThread.request_stop();
+            g_writerThread.join();
+        }
+    }
+
     FILE *getDestination() {
         if (g_loggerFile.isValid())
             return g_loggerFile.getHandle();
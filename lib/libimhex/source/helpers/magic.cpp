@@ -6,6 +6,7 @@
 #include <hex/providers/provider.hpp>
 
 #include <filesystem>
+#include <mutex>
 #include <optional>
 #include <string>
 
@@ -20,6 +21,14 @@
 
 namespace hex::magic {
 
+    // The loaded databases are shared across all detection call sites, so access to them
+    // gets serialized. Compiling and loading magic files takes seconds with big databases;
+    // both only happen again when a source file changed since the last time
+    static std::mutex s_magicMutex;
+    static std::string s_compiledState;
+    static magic_t s_descriptionCtx = nullptr;
+    static magic_t s_mimeCtx        = nullptr;
+
     static std::optional<std::string> getMagicFiles(bool sourceFiles = false) {
         std::string magicFiles;
 
@@ -38,7 +47,51 @@ namespace hex::magic {
             return magicFiles;
     }
 
+    // Path and modification time of every magic source file. As long as this stays the
+    // same, the previously compiled database is still up to date
+    static std::string getMagicSourceState() {
+        std::string state;
+
+        std::error_code error;
+        for (const auto &dir : fs::getDefaultPaths(fs::ImHexPath::Magic)) {
+            for (const auto &entry : std::fs::directory_iterator(dir, error)) {
+                if (entry.is_regular_file() && entry.path().extension().empty()) {
+                    state += hex::toUTF8String(entry.path());
+                    state += std::to_string(entry.last_write_time(error).time_since_epoch().count());
+                    state += ';';
+                }
+            }
+        }
+
+        return state;
+    }
+
+    static magic_t getLoadedContext(int flags, magic_t &cache) {
+        if (cache != nullptr)
+            return cache;
+
+        auto magicFiles = getMagicFiles();
+
+        if (!magicFiles.has_value())
+            return nullptr;
+
+        magic_t ctx = magic_open(flags);
+        if (magic_load(ctx, magicFiles->c_str()) != 0) {
+            magic_close(ctx);
+            return nullptr;
+        }
+
+        cache = ctx;
+        return cache;
+    }
+
     bool compile() {
+        std::scoped_lock lock(s_magicMutex);
+
+        auto state = getMagicSourceState();
+        if (!state.empty() && state == s_compiledState)
+            return true;
+
         magic_t ctx = magic_open(MAGIC_NONE);
         ON_SCOPE_EXIT { magic_close(ctx); };
 
@@ -47,19 +100,29 @@ namespace hex::magic {
         if (!magicFiles.has_value())
             return false;
 
-        return magic_compile(ctx, magicFiles->c_str()) == 0;
+        if (magic_compile(ctx, magicFiles->c_str()) != 0)
+            return false;
+
+        s_compiledState = std::move(state);
+
+        // The freshly compiled database replaces any previously loaded handles
+        if (s_descriptionCtx != nullptr) {
+            magic_close(s_descriptionCtx);
+            s_descriptionCtx = nullptr;
+        }
+        if (s_mimeCtx != nullptr) {
+            magic_close(s_mimeCtx);
+            s_mimeCtx = nullptr;
+        }
+
+        return true;
     }
 
     std::string getDescription(const std::vector<u8> &data) {
-        auto magicFiles = getMagicFiles();
-
-        if (magicFiles.has_value()) {
-            magic_t ctx = magic_open(MAGIC_NONE);
-            ON_SCOPE_EXIT { magic_close(ctx); };
+        std::scoped_lock lock(s_magicMutex);
 
-            if (magic_load(ctx, magicFiles->c_str()) == 0)
-                return magic_buffer(ctx, data.data(), data.size()) ?: "";
-        }
+        if (auto ctx = getLoadedContext(MAGIC_NONE, s_descriptionCtx); ctx != nullptr)
+            return magic_buffer(ctx, data.data(), data.size()) ?: "";
 
         return "";
     }
@@ -72,15 +135,10 @@ namespace hex::magic {
     }
 
     std::string getMIMEType(const std::vector<u8> &data) {
-        auto magicFiles = getMagicFiles();
+        std::scoped_lock lock(s_magicMutex);
 
-        if (magicFiles.has_value()) {
-            magic_t ctx = magic_open(MAGIC_MIME_TYPE);
-            ON_SCOPE_EXIT { magic_close(ctx); };
-
-            if (magic_load(ctx, magicFiles->c_str()) == 0)
-                return magic_buffer(ctx, data.data(), data.size()) ?: "";
-        }
+        if (auto ctx = getLoadedContext(MAGIC_MIME_TYPE, s_mimeCtx); ctx != nullptr)
+            return magic_buffer(ctx, data.data(), data.size()) ?: "";
 
         return "";
     }
@@ -92,4 +150,4 @@ namespace hex::magic {
         return getMIMEType(buffer);
     }
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,65 @@
+#include <hex/helpers/memory_tracker.hpp>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace hex::mem {
+
+    namespace {
+
+        struct PolledTag {
+            std::string name;
+            std::function<std::pair<u64, u64>()> poll;
+            u64 peakBytes = 0;
+        };
+
+        std::mutex s_tagMutex;
+        // unique_ptr keeps the returned references stable while the map grows
+        std::map<std::string, std::unique_ptr<TagStats>> s_countedTags;
+        std::vector<PolledTag> s_polledTags;
+
+    }
+
+    TagStats &tag(const std::string &name) {
+        std::scoped_lock lock(s_tagMutex);
+
+        auto &stats = s_countedTags[name];
+        if (stats == nullptr)
+            stats = std::make_unique<TagStats>();
+
+        return *stats;
+    }
+
+    void registerPolledTag(std::string name, std::function<std::pair<u64, u64>()> poll) {
+        std::scoped_lock lock(s_tagMutex);
+
+        s_polledTags.push_back({ std::move(name), std::move(poll), 0 });
+    }
+
+    std::vector<Snapshot> snapshot() {
+        std::vector<Snapshot> result;
+
+        {
+            std::scoped_lock lock(s_tagMutex);
+
+            for (const auto &[name, stats] : s_countedTags)
+                result.push_back({ name, stats->getBytes(), stats->getAllocations(), stats->getPeakBytes() });
+
+            for (auto &polled : s_polledTags) {
+                const auto [bytes, allocations] = polled.poll();
+                polled.peakBytes = std::max(polled.peakBytes, bytes);
+
+                result.push_back({ polled.name, bytes, allocations, polled.peakBytes });
+            }
+        }
+
+        std::sort(result.begin(), result.end(), [](const auto &left, const auto &right) {
+            return left.bytes > right.bytes;
+        });
+
+        return result;
+    }
+
+}
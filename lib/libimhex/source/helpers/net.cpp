@@ -8,6 +8,10 @@
 
 #include <filesystem>
 #include <cstdio>
+#include <list>
+#include <map>
+#include <mutex>
+#include <thread>
 
 #include <curl/curl.h>
 #include <nlohmann/json.hpp>
@@ -16,6 +20,121 @@
 
 namespace hex {
 
+    namespace {
+
+        /**
+         * @brief Drives all transfers through one shared curl multi handle.
+         *
+         * Every Net instance keeps its own easy handle for per-request state, but all
+         * of them run on this dispatcher's multi handle, so connections to the same
+         * host get pooled and concurrent requests multiplex over one HTTP/2 stream
+         * instead of each paying a fresh TCP/TLS handshake
+         */
+        class NetDispatcher {
+        public:
+            static NetDispatcher &instance() {
+                static NetDispatcher dispatcher;
+
+                return dispatcher;
+            }
+
+            std::future<CURLcode> submit(CURL *handle) {
+                std::future<CURLcode> future;
+                {
+                    std::scoped_lock lock(this->m_mutex);
+
+                    auto &transfer  = this->m_queued.emplace_back();
+                    transfer.handle = handle;
+                    future          = transfer.promise.get_future();
+                }
+
+                curl_multi_wakeup(this->m_multi);
+
+                return future;
+            }
+
+        private:
+            NetDispatcher() {
+                this->m_multi = curl_multi_init();
+
+                // Let concurrent requests to the same host share one HTTP/2 connection
+                curl_multi_setopt(this->m_multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+
+                this->m_thread = std::jthread([this](const std::stop_token &stopToken) {
+                    std::map<CURL *, std::promise<CURLcode>> active;
+
+                    while (true) {
+                        {
+                            std::scoped_lock lock(this->m_mutex);
+
+                            for (auto &transfer : this->m_queued) {
+                                curl_multi_add_handle(this->m_multi, transfer.handle);
+                                active.emplace(transfer.handle, std::move(transfer.promise));
+                            }
+                            this->m_queued.clear();
+                        }
+
+                        int runningTransfers = 0;
+                        curl_multi_perform(this->m_multi, &runningTransfers);
+
+                        int messagesLeft = 0;
+                        while (auto *message = curl_multi_info_read(this->m_multi, &messagesLeft)) {
+                            if (message->msg != CURLMSG_DONE)
+                                continue;
+
+                            auto handle = message->easy_handle;
+                            auto result = message->data.result;
+
+                            curl_multi_remove_handle(this->m_multi, handle);
+                            if (auto node = active.extract(handle); !node.empty())
+                                node.mapped().set_value(result);
+                        }
+
+                        if (stopToken.stop_requested()) {
+                            // Whatever is still in flight gets aborted so no caller
+                            // ends up stuck on a broken promise during shutdown
+                            for (auto &[handle, promise] : active) {
+                                curl_multi_remove_handle(this->m_multi, handle);
+                                promise.set_value(CURLE_ABORTED_BY_CALLBACK);
+                            }
+                            active.clear();
+
+                            std::scoped_lock lock(this->m_mutex);
+                            for (auto &transfer : this->m_queued)
+                                transfer.promise.set_value(CURLE_ABORTED_BY_CALLBACK);
+                            this->m_queued.clear();
+
+                            break;
+                        }
+
+                        int descriptorCount = 0;
+                        curl_multi_poll(this->m_multi, nullptr, 0, 100, &descriptorCount);
+                    }
+                });
+            }
+
+            ~NetDispatcher() {
+                this->m_thread.request_stop();
+                curl_multi_wakeup(this->m_multi);
+                this->m_thread.join();
+
+                curl_multi_cleanup(this->m_multi);
+            }
+
+        private:
+            struct QueuedTransfer {
+                CURL *handle = nullptr;
+                std::promise<CURLcode> promise;
+            };
+
+            CURLM *m_multi = nullptr;
+            std::mutex m_mutex;
+            std::list<QueuedTransfer> m_queued;
+            std::jthread m_thread;
+        };
+
+    }
+
     Net::Net() {
         FIRST_TIME {
             curl_global_sslset(CURLSSLBACKEND_MBEDTLS, nullptr, nullptr);
@@ -53,7 +172,9 @@ namespace hex {
         auto crt = static_cast<mbedtls_x509_crt*>(userData);
         mbedtls_x509_crt_init(crt);
 
-        auto cacert = romfs::get("cacert.pem").string();
+        // The certificate bundle only gets copied out of the romfs once the
+        // first TLS connection actually needs it, and is shared from then on
+        static const auto cacert = romfs::get("cacert.pem").string();
         mbedtls_x509_crt_parse(crt, reinterpret_cast<const u8 *>(cacert.data()), cacert.size());
 
         mbedtls_ssl_conf_ca_chain(cfg, crt, nullptr);
@@ -74,7 +195,7 @@ namespace hex {
         return net.m_shouldCancel ? CURLE_ABORTED_BY_CALLBACK : CURLE_OK;
     }
 
-    void Net::setCommonSettings(std::string &response, const std::string &url, u32 timeout, const std::map<std::string, std::string> &extraHeaders, const std::string &body) {
+    void Net::setCommonSettings(const std::string &url, u32 timeout, const std::map<std::string, std::string> &extraHeaders, const std::string &body) {
         this->m_headers = curl_slist_append(this->m_headers, "Cache-Control: no-cache");
 
         if (!extraHeaders.empty())
@@ -96,16 +217,15 @@ namespace hex {
         curl_easy_setopt(this->m_ctx, CURLOPT_HTTPHEADER, this->m_headers);
         curl_easy_setopt(this->m_ctx, CURLOPT_USERAGENT, "ImHex/1.0");
         curl_easy_setopt(this->m_ctx, CURLOPT_DEFAULT_PROTOCOL, "https");
-        curl_easy_setopt(this->m_ctx, CURLOPT_WRITEFUNCTION, writeToString);
         curl_easy_setopt(this->m_ctx, CURLOPT_SSL_VERIFYPEER, 1L);
         curl_easy_setopt(this->m_ctx, CURLOPT_SSL_VERIFYHOST, 2L);
-        curl_easy_setopt(this->m_ctx, CURLOPT_WRITEDATA, &response);
         curl_easy_setopt(this->m_ctx, CURLOPT_TIMEOUT_MS, 0L);
         curl_easy_setopt(this->m_ctx, CURLOPT_CONNECTTIMEOUT_MS, timeout);
         curl_easy_setopt(this->m_ctx, CURLOPT_XFERINFODATA, this);
         curl_easy_setopt(this->m_ctx, CURLOPT_XFERINFOFUNCTION, progressCallback);
         curl_easy_setopt(this->m_ctx, CURLOPT_NOSIGNAL, 1L);
         curl_easy_setopt(this->m_ctx, CURLOPT_NOPROGRESS, 0L);
+        curl_easy_setopt(this->m_ctx, CURLOPT_PIPEWAIT, 1L);
 
 #if defined(IMHEX_USE_BUNDLED_CA)
         curl_easy_setopt(this->m_ctx, CURLOPT_CAINFO, nullptr);
@@ -119,7 +239,7 @@ namespace hex {
     }
 
     std::optional<i32> Net::execute() {
-        CURLcode result = curl_easy_perform(this->m_ctx);
+        CURLcode result = NetDispatcher::instance().submit(this->m_ctx).get();
         if (result != CURLE_OK){
             char *url = nullptr;
             curl_easy_getinfo(this->m_ctx, CURLINFO_EFFECTIVE_URL, &url);
@@ -149,7 +269,9 @@ namespace hex {
             ON_SCOPE_EXIT { this->m_transmissionActive.unlock(); };
 
             curl_easy_setopt(this->m_ctx, CURLOPT_CUSTOMREQUEST, "GET");
-            setCommonSettings(response, url, timeout);
+            setCommonSettings(url, timeout);
+            curl_easy_setopt(this->m_ctx, CURLOPT_WRITEFUNCTION, writeToString);
+            curl_easy_setopt(this->m_ctx, CURLOPT_WRITEDATA, &response);
 
             auto responseCode = execute();
 
@@ -157,6 +279,59 @@ namespace hex {
         });
     }
 
+    static std::string getHeaderValue(const std::string &headerData, const std::string &headerName) {
+        size_t lineStart = 0;
+        while (lineStart < headerData.size()) {
+            auto lineEnd = headerData.find("\r\n", lineStart);
+            if (lineEnd == std::string::npos)
+                lineEnd = headerData.size();
+
+            auto line = headerData.substr(lineStart, lineEnd - lineStart);
+            if (line.size() > headerName.size() && line[headerName.size()] == ':' && hex::equalsIgnoreCase(line.substr(0, headerName.size()), headerName)) {
+                auto value = line.substr(headerName.size() + 1);
+                hex::trim(value);
+
+                return value;
+            }
+
+            lineStart = lineEnd + 2;
+        }
+
+        return {};
+    }
+
+    std::future<ConditionalResponse> Net::getStringConditional(const std::string &url, const std::string &etag, const std::string &lastModified, u32 timeout) {
+        this->m_transmissionActive.lock();
+
+        return std::async(std::launch::async, [=, this] {
+            std::string response, headerData;
+
+            ON_SCOPE_EXIT { this->m_transmissionActive.unlock(); };
+
+            curl_easy_setopt(this->m_ctx, CURLOPT_CUSTOMREQUEST, "GET");
+
+            std::map<std::string, std::string> extraHeaders;
+            if (!etag.empty())
+                extraHeaders["If-None-Match"] = etag;
+            if (!lastModified.empty())
+                extraHeaders["If-Modified-Since"] = lastModified;
+
+            setCommonSettings(url, timeout, extraHeaders);
+            curl_easy_setopt(this->m_ctx, CURLOPT_WRITEFUNCTION, writeToString);
+            curl_easy_setopt(this->m_ctx, CURLOPT_WRITEDATA, &response);
+            curl_easy_setopt(this->m_ctx, CURLOPT_HEADERFUNCTION, writeToString);
+            curl_easy_setopt(this->m_ctx, CURLOPT_HEADERDATA, &headerData);
+
+            auto responseCode = execute();
+
+            // The handle is reused for other requests, so header capture has to be disarmed again
+            curl_easy_setopt(this->m_ctx, CURLOPT_HEADERFUNCTION, nullptr);
+            curl_easy_setopt(this->m_ctx, CURLOPT_HEADERDATA, nullptr);
+
+            return ConditionalResponse { responseCode.value_or(0), response, getHeaderValue(headerData, "etag"), getHeaderValue(headerData, "last-modified") };
+        });
+    }
+
     std::future<Response<nlohmann::json>> Net::getJson(const std::string &url, u32 timeout) {
         this->m_transmissionActive.lock();
 
@@ -166,7 +341,9 @@ namespace hex {
             ON_SCOPE_EXIT { this->m_transmissionActive.unlock(); };
 
             curl_easy_setopt(this->m_ctx, CURLOPT_CUSTOMREQUEST, "GET");
-            setCommonSettings(response, url, timeout);
+            setCommonSettings(url, timeout);
+            curl_easy_setopt(this->m_ctx, CURLOPT_WRITEFUNCTION, writeToString);
+            curl_easy_setopt(this->m_ctx, CURLOPT_WRITEDATA, &response);
 
             auto responseCode = execute();
             if (!responseCode.has_value())
@@ -215,7 +392,9 @@ namespace hex {
             curl_mime_filename(part, fileName.c_str());
             curl_mime_name(part, "file");
 
-            setCommonSettings(response, url, timeout);
+            setCommonSettings(url, timeout);
+            curl_easy_setopt(this->m_ctx, CURLOPT_WRITEFUNCTION, writeToString);
+            curl_easy_setopt(this->m_ctx, CURLOPT_WRITEDATA, &response);
             curl_easy_setopt(this->m_ctx, CURLOPT_MIMEPOST, mime);
             curl_easy_setopt(this->m_ctx, CURLOPT_CUSTOMREQUEST, "POST");
 
@@ -229,21 +408,59 @@ namespace hex {
         this->m_transmissionActive.lock();
 
         return std::async(std::launch::async, [=, this] {
-            std::string response;
-
             ON_SCOPE_EXIT { this->m_transmissionActive.unlock(); };
 
-            fs::File file(filePath, fs::File::Mode::Create);
-            if (!file.isValid())
-                return Response<void> { 400 };
-
-            setCommonSettings(response, url, timeout);
-            curl_easy_setopt(this->m_ctx, CURLOPT_CUSTOMREQUEST, "GET");
-            curl_easy_setopt(this->m_ctx, CURLOPT_WRITEFUNCTION, writeToFile);
-            curl_easy_setopt(this->m_ctx, CURLOPT_WRITEDATA, file.getHandle());
-            auto responseCode = execute();
+            // Data accumulates in a .part file that only moves into place once the
+            // transfer completed, so an interrupted download resumes where it stopped
+            // instead of starting over
+            auto partPath = filePath;
+            partPath += ".part";
+
+            u64 resumeOffset = 0;
+            if (auto partFile = fs::File(partPath, fs::File::Mode::Read); partFile.isValid())
+                resumeOffset = partFile.getSize();
+
+            auto transfer = [&, this](u64 offset) -> std::optional<i32> {
+                fs::File file(partPath, offset > 0 ? fs::File::Mode::Write : fs::File::Mode::Create);
+                if (!file.isValid())
+                    return std::nullopt;
+                if (offset > 0)
+                    file.seek(offset);
+
+                // Received chunks go straight to disk; no in-memory body buffer exists
+                // on this path, so memory use stays flat regardless of file size
+                setCommonSettings(url, timeout);
+                curl_easy_setopt(this->m_ctx, CURLOPT_CUSTOMREQUEST, "GET");
+                curl_easy_setopt(this->m_ctx, CURLOPT_WRITEFUNCTION, writeToFile);
+                curl_easy_setopt(this->m_ctx, CURLOPT_WRITEDATA, file.getHandle());
+                curl_easy_setopt(this->m_ctx, CURLOPT_RESUME_FROM_LARGE, curl_off_t(offset));
+
+                auto result = execute();
+
+                // The handle is reused for other requests, so the resume offset has to be reset
+                curl_easy_setopt(this->m_ctx, CURLOPT_RESUME_FROM_LARGE, curl_off_t(0));
+
+                return result;
+            };
+
+            auto responseCode = transfer(resumeOffset);
+
+            // A 200 to a range request means the server ignored it and sent the whole
+            // file; the partial data is useless then, so the download restarts cleanly
+            if (resumeOffset > 0 && responseCode.value_or(0) == 200)
+                responseCode = transfer(0);
+
+            auto code = responseCode.value_or(0);
+            if (code == 200 || code == 206) {
+                std::error_code error;
+                std::fs::rename(partPath, filePath, error);
+                if (error)
+                    return Response<void> { 400 };
+
+                return Response<void> { 200 };
+            }
 
-            return Response<void> { responseCode.value_or(0) };
+            return Response<void> { code };
         });
     }
 
@@ -2,6 +2,10 @@
 
 #include <hex/helpers/utils.hpp>
 
+#include <hex/providers/provider.hpp>
+#include <hex/providers/patch_store.hpp>
+
+#include <array>
 #include <cstring>
 #include <string_view>
 #include <type_traits>
@@ -217,4 +221,161 @@ namespace hex {
             return {};
     }
 
+    static bool writeIPSRecords(const prv::PatchStore &patches, fs::File &file, bool ips32) {
+        constexpr static size_t MaxRecordSize = 0xFFFF;
+        constexpr static size_t MaxRunLength  = 0x10'0000;
+
+        const u64 maxAddress = ips32 ? 0xFFFF'FFFF : 0x00FF'FFFF;
+
+        bool success = true;
+
+        u64 runAddress = 0x00;
+        std::vector<u8> runBytes;
+
+        const auto flushRun = [&] {
+            if (runBytes.empty())
+                return;
+
+            if (runAddress + runBytes.size() - 1 > maxAddress) {
+                success = false;
+                runBytes.clear();
+                return;
+            }
+
+            // Long runs are split over multiple records of at most 0xFFFF bytes each
+            for (size_t offset = 0; offset < runBytes.size(); offset += MaxRecordSize) {
+                const u16 recordSize = std::min<size_t>(MaxRecordSize, runBytes.size() - offset);
+                const u64 address    = runAddress + offset;
+
+                std::array<u8, 6> header = { };
+                size_t headerSize = 0;
+                if (ips32)
+                    header[headerSize++] = (address >> 24) & 0xFF;
+                header[headerSize++] = (address >> 16) & 0xFF;
+                header[headerSize++] = (address >> 8)  & 0xFF;
+                header[headerSize++] = (address >> 0)  & 0xFF;
+                header[headerSize++] = (recordSize >> 8) & 0xFF;
+                header[headerSize++] = (recordSize >> 0) & 0xFF;
+
+                file.write(header.data(), headerSize);
+                file.write(runBytes.data() + offset, recordSize);
+            }
+
+            runBytes.clear();
+        };
+
+        patches.forEachRun([&](u64 address, std::span<const u8> bytes) {
+            // Coalesce runs continuing across a chunk boundary, flushing early so a
+            // fully patched region never accumulates in memory
+            if (!runBytes.empty() && (runAddress + runBytes.size() != address || runBytes.size() >= MaxRunLength))
+                flushRun();
+
+            if (runBytes.empty())
+                runAddress = address;
+
+            runBytes.insert(runBytes.end(), bytes.begin(), bytes.end());
+        });
+        flushRun();
+
+        return success;
+    }
+
+    bool generateIPSPatch(const prv::PatchStore &patches, fs::File &output) {
+        output.write(std::string("PATCH"));
+
+        if (!writeIPSRecords(patches, output, false))
+            return false;
+
+        output.write(std::string("EOF"));
+        return true;
+    }
+
+    bool generateIPS32Patch(const prv::PatchStore &patches, fs::File &output) {
+        output.write(std::string("IPS32"));
+
+        if (!writeIPSRecords(patches, output, true))
+            return false;
+
+        output.write(std::string("EEOF"));
+        return true;
+    }
+
+    static bool applyIPSRecords(prv::Provider *provider, fs::File &file, bool ips32) {
+        const size_t addressSize = ips32 ? 4 : 3;
+        const size_t footerSize  = ips32 ? 4 : 3;
+        const size_t fileSize    = file.getSize();
+
+        file.seek(5);
+        u64 offset = 5;
+
+        std::vector<u8> buffer;
+        while (offset + footerSize < fileSize) {
+            std::array<u8, 6> header = { };
+            if (file.readBuffer(header.data(), addressSize + 2) != addressSize + 2)
+                return false;
+            offset += addressSize + 2;
+
+            u64 address = 0x00;
+            for (size_t i = 0; i < addressSize; i++)
+                address = (address << 8) | header[i];
+
+            const u16 size = (header[addressSize] << 8) | header[addressSize + 1];
+
+            if (size > 0x0000) {
+                // Handle normal record
+                buffer.resize(size);
+                if (file.readBuffer(buffer.data(), size) != size)
+                    return false;
+                offset += size;
+            } else {
+                // Handle RLE record
+                std::array<u8, 3> rle = { };
+                if (file.readBuffer(rle.data(), rle.size()) != rle.size())
+                    return false;
+                offset += rle.size();
+
+                const u16 rleSize = (rle[0] << 8) | rle[1];
+                buffer.assign(rleSize, rle[2]);
+            }
+
+            if (!buffer.empty())
+                provider->addPatch(address, buffer.data(), buffer.size());
+        }
+
+        std::array<u8, 4> footer = { };
+        file.seek(fileSize - footerSize);
+        if (file.readBuffer(footer.data(), footerSize) != footerSize)
+            return false;
+
+        return std::memcmp(footer.data(), ips32 ? "EEOF" : "EOF", footerSize) == 0;
+    }
+
+    bool applyIPSPatch(prv::Provider *provider, fs::File &input) {
+        if (input.getSize() < (5 + 3))
+            return false;
+
+        input.seek(0);
+        std::array<u8, 5> magic = { };
+        if (input.readBuffer(magic.data(), magic.size()) != magic.size())
+            return false;
+        if (std::memcmp(magic.data(), "PATCH", magic.size()) != 0)
+            return false;
+
+        return applyIPSRecords(provider, input, false);
+    }
+
+    bool applyIPS32Patch(prv::Provider *provider, fs::File &input) {
+        if (input.getSize() < (5 + 4))
+            return false;
+
+        input.seek(0);
+        std::array<u8, 5> magic = { };
+        if (input.readBuffer(magic.data(), magic.size()) != magic.size())
+            return false;
+        if (std::memcmp(magic.data(), "IPS32", magic.size()) != 0)
+            return false;
+
+        return applyIPSRecords(provider, input, true);
+    }
+
 }
\ No newline at end of file
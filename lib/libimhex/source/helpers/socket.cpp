@@ -21,8 +21,10 @@ namespace hex {
     }
 
     Socket::Socket(Socket &&other) noexcept {
-        this->m_socket    = other.m_socket;
-        this->m_connected = other.m_connected;
+        this->m_socket        = other.m_socket;
+        this->m_connected     = other.m_connected;
+        this->m_receiveBuffer = std::move(other.m_receiveBuffer);
+        this->m_receivePos    = other.m_receivePos;
 
         other.m_socket = SOCKET_NONE;
     }
@@ -43,16 +45,77 @@ namespace hex {
         ::send(this->m_socket, string.c_str(), string.length(), 0);
     }
 
+    void Socket::writeVectored(const std::vector<std::string> &parts) const {
+        if (!this->isConnected()) return;
+
+#if defined(OS_WINDOWS)
+        std::vector<WSABUF> buffers;
+        buffers.reserve(parts.size());
+        for (const auto &part : parts)
+            buffers.push_back({ static_cast<ULONG>(part.size()), const_cast<char *>(part.data()) });
+
+        DWORD bytesSent = 0;
+        ::WSASend(this->m_socket, buffers.data(), buffers.size(), &bytesSent, 0, nullptr, nullptr);
+#else
+        std::vector<iovec> buffers;
+        buffers.reserve(parts.size());
+        for (const auto &part : parts)
+            buffers.push_back({ const_cast<char *>(part.data()), part.size() });
+
+        ::writev(this->m_socket, buffers.data(), buffers.size());
+#endif
+    }
+
+    bool Socket::hasDataAvailable(int timeoutMs) const {
+        if (!this->isConnected()) return false;
+
+        if (this->m_receivePos < this->m_receiveBuffer.size())
+            return true;
+
+#if defined(OS_WINDOWS)
+        WSAPOLLFD pollEntry = { this->m_socket, POLLRDNORM, 0 };
+        return ::WSAPoll(&pollEntry, 1, timeoutMs) > 0 && (pollEntry.revents & POLLRDNORM) != 0;
+#else
+        pollfd pollEntry = { this->m_socket, POLLIN, 0 };
+        return ::poll(&pollEntry, 1, timeoutMs) > 0 && (pollEntry.revents & POLLIN) != 0;
+#endif
+    }
+
     std::vector<u8> Socket::readBytes(size_t size) const {
         std::vector<u8> data;
-        data.resize(size);
 
-        auto receivedSize = ::recv(this->m_socket, reinterpret_cast<char *>(data.data()), size, 0);
+        while (data.size() < size) {
+            // Serve from the internal buffer first
+            if (this->m_receivePos < this->m_receiveBuffer.size()) {
+                const auto available = this->m_receiveBuffer.size() - this->m_receivePos;
+                const auto copySize  = std::min(size - data.size(), available);
+
+                data.insert(data.end(), this->m_receiveBuffer.begin() + this->m_receivePos, this->m_receiveBuffer.begin() + this->m_receivePos + copySize);
+                this->m_receivePos += copySize;
+
+                if (this->m_receivePos == this->m_receiveBuffer.size()) {
+                    this->m_receiveBuffer.clear();
+                    this->m_receivePos = 0;
+                }
 
-        if (receivedSize < 0)
-            return {};
+                continue;
+            }
 
-        data.resize(receivedSize);
+            // Only the first refill may block; afterwards return what has arrived,
+            // matching the previous single-recv() semantics
+            if (!data.empty() && !this->hasDataAvailable(0))
+                break;
+
+            char chunk[0x1'0000];
+            auto receivedSize = ::recv(this->m_socket, chunk, sizeof(chunk), 0);
+
+            if (receivedSize < 0 && data.empty())
+                return {};
+            if (receivedSize <= 0)
+                break;
+
+            this->m_receiveBuffer.insert(this->m_receiveBuffer.end(), chunk, chunk + receivedSize);
+        }
 
         return data;
     }
@@ -98,6 +161,10 @@ namespace hex {
 #endif
         }
 
+        this->m_socket = SOCKET_NONE;
+        this->m_receiveBuffer.clear();
+        this->m_receivePos = 0;
+
         this->m_connected = false;
     }
 
@@ -2,10 +2,23 @@
 #include <hex/helpers/literals.hpp>
 #include <hex/helpers/file.hpp>
 
+#include <cstring>
+
 namespace hex {
 
     using namespace hex::literals;
 
+    constexpr static u64 StreamChunkSize = 1_MiB;
+
+    static std::string toTarPath(const std::fs::path &path) {
+        auto fixedPath = path.string();
+        #if defined(OS_WINDOWS)
+            std::replace(fixedPath.begin(), fixedPath.end(), '\\', '/');
+        #endif
+
+        return fixedPath;
+    }
+
     Tar::Tar(const std::fs::path &path, Mode mode) {
         int error = MTAR_ESUCCESS;
 
@@ -77,12 +90,7 @@ namespace hex {
 
     std::vector<u8> Tar::read(const std::fs::path &path) {
         mtar_header_t header;
-
-        auto fixedPath = path.string();
-        #if defined(OS_WINDOWS)
-            std::replace(fixedPath.begin(), fixedPath.end(), '\\', '/');
-        #endif
-        mtar_find(&this->m_ctx, fixedPath.c_str(), &header);
+        mtar_find(&this->m_ctx, toTarPath(path).c_str(), &header);
 
         std::vector<u8> result(header.size, 0x00);
         mtar_read_data(&this->m_ctx, result.data(), result.size());
@@ -95,25 +103,35 @@ namespace hex {
         return { result.begin(), result.end() };
     }
 
-    void Tar::write(const std::fs::path &path, const std::vector<u8> &data) {
-        if (path.has_parent_path()) {
-            std::fs::path pathPart;
-            for (const auto &part : path.parent_path()) {
-                pathPart /= part;
-
-                auto fixedPath = pathPart.string();
-                #if defined(OS_WINDOWS)
-                    std::replace(fixedPath.begin(), fixedPath.end(), '\\', '/');
-                #endif
-                mtar_write_dir_header(&this->m_ctx, fixedPath.c_str());
-            }
+    void Tar::read(const std::fs::path &path, const std::function<void(const u8 *data, size_t size)> &consumer) {
+        mtar_header_t header;
+        mtar_find(&this->m_ctx, toTarPath(path).c_str(), &header);
+
+        std::vector<u8> buffer;
+        for (u64 offset = 0; offset < header.size; offset += StreamChunkSize) {
+            buffer.resize(std::min<u64>(StreamChunkSize, header.size - offset));
+
+            mtar_read_data(&this->m_ctx, buffer.data(), buffer.size());
+            consumer(buffer.data(), buffer.size());
         }
+    }
 
-        auto fixedPath = path.string();
-        #if defined(OS_WINDOWS)
-            std::replace(fixedPath.begin(), fixedPath.end(), '\\', '/');
-        #endif
-        mtar_write_file_header(&this->m_ctx, fixedPath.c_str(), data.size());
+    void Tar::writeParentDirectories(const std::fs::path &path) {
+        if (!path.has_parent_path())
+            return;
+
+        std::fs::path pathPart;
+        for (const auto &part : path.parent_path()) {
+            pathPart /= part;
+
+            mtar_write_dir_header(&this->m_ctx, toTarPath(pathPart).c_str());
+        }
+    }
+
+    void Tar::write(const std::fs::path &path, const std::vector<u8> &data) {
+        this->writeParentDirectories(path);
+
+        mtar_write_file_header(&this->m_ctx, toTarPath(path).c_str(), data.size());
         mtar_write_data(&this->m_ctx, data.data(), data.size());
     }
 
@@ -121,6 +139,36 @@ namespace hex {
         this->write(path, std::vector<u8>(data.begin(), data.end()));
     }
 
+    void Tar::write(const std::fs::path &path, u64 size, const std::function<size_t(u8 *buffer, size_t size)> &producer) {
+        this->writeParentDirectories(path);
+
+        mtar_write_file_header(&this->m_ctx, toTarPath(path).c_str(), size);
+
+        std::vector<u8> buffer(std::min<u64>(StreamChunkSize, size));
+        for (u64 written = 0; written < size;) {
+            const auto chunkSize = std::min<u64>(buffer.size(), size - written);
+
+            auto produced = producer(buffer.data(), chunkSize);
+            if (produced == 0 || produced > chunkSize) {
+                // The entry size is already committed to the header, so a producer
+                // that runs dry early gets the remainder of the entry zero-filled
+                std::memset(buffer.data(), 0x00, chunkSize);
+                produced = chunkSize;
+            }
+
+            mtar_write_data(&this->m_ctx, buffer.data(), produced);
+            written += produced;
+        }
+    }
+
+    void Tar::writeFile(const std::fs::path &path, const std::fs::path &sourcePath) {
+        fs::File file(sourcePath, fs::File::Mode::Read);
+
+        this->write(path, file.getSize(), [&file](u8 *buffer, size_t size) {
+            return file.readBuffer(buffer, size);
+        });
+    }
+
     static void writeFile(mtar_t *ctx, mtar_header_t *header, const std::fs::path &path) {
         constexpr static u64 BufferSize = 1_MiB;
 
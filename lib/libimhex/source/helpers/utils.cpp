@@ -1,5 +1,6 @@
 #include <hex/helpers/utils.hpp>
 
+#include <algorithm>
 #include <cstdio>
 #include <codecvt>
 
@@ -20,6 +21,11 @@
     #include <unistd.h>
 #endif
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    #define IMHEX_HAS_SSSE3_INTRINSICS
+    #include <immintrin.h>
+#endif
+
 namespace hex {
 
     float operator""_scaled(long double value) {
@@ -66,6 +72,144 @@ namespace hex {
             return { data + index + 1 };
     }
 
+    #if defined(IMHEX_HAS_SSSE3_INTRINSICS)
+
+        // Detected once on first use and cached for the rest of the session
+        static bool hasSsse3Extensions() {
+            static const bool Available = __builtin_cpu_supports("ssse3");
+
+            return Available;
+        }
+
+        __attribute__((target("ssse3")))
+        static size_t swapBytesBulk(u8 *data, size_t size, size_t elementSize) {
+            __m128i shuffle;
+            switch (elementSize) {
+                case 2:  shuffle = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14); break;
+                case 4:  shuffle = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12); break;
+                case 8:  shuffle = _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8); break;
+                case 16: shuffle = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0); break;
+                default: return 0;
+            }
+
+            size_t processed = 0;
+            for (; processed + 16 <= size; processed += 16) {
+                const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + processed));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(data + processed), _mm_shuffle_epi8(value, shuffle));
+            }
+
+            return processed;
+        }
+
+    #endif
+
+    void changeEndianess(std::span<u8> data, size_t elementSize, std::endian endian) {
+        if (endian == std::endian::native || elementSize <= 1)
+            return;
+
+        const size_t swappableSize = data.size() - data.size() % elementSize;
+        size_t processed = 0;
+
+        #if defined(IMHEX_HAS_SSSE3_INTRINSICS)
+            // The vectorized kernel swaps whole 16 byte blocks, so it only applies to
+            // element sizes that tile them evenly
+            if (hasSsse3Extensions() && (16 % elementSize) == 0)
+                processed = swapBytesBulk(data.data(), swappableSize, elementSize);
+        #endif
+
+        for (; processed < swappableSize; processed += elementSize)
+            std::reverse(data.begin() + processed, data.begin() + processed + elementSize);
+    }
+
+    enum class BitwiseOp {
+        Not,
+        And,
+        Or,
+        Xor
+    };
+
+    #if defined(IMHEX_HAS_SSSE3_INTRINSICS)
+
+        static bool hasAvx2Extensions() {
+            static const bool Available = __builtin_cpu_supports("avx2");
+
+            return Available;
+        }
+
+        __attribute__((target("avx2")))
+        static size_t bitwiseBulkAvx2(u8 *data, const u8 *operand, size_t size, BitwiseOp op) {
+            size_t processed = 0;
+            for (; processed + 32 <= size; processed += 32) {
+                __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + processed));
+
+                switch (op) {
+                    case BitwiseOp::Not: value = _mm256_xor_si256(value, _mm256_set1_epi8(-1)); break;
+                    case BitwiseOp::And: value = _mm256_and_si256(value, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(operand + processed))); break;
+                    case BitwiseOp::Or:  value = _mm256_or_si256(value, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(operand + processed)));  break;
+                    case BitwiseOp::Xor: value = _mm256_xor_si256(value, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(operand + processed))); break;
+                }
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(data + processed), value);
+            }
+
+            return processed;
+        }
+
+        // SSE2 is part of the x86_64 baseline, so this path needs no runtime check
+        static size_t bitwiseBulkSse2(u8 *data, const u8 *operand, size_t size, BitwiseOp op) {
+            size_t processed = 0;
+            for (; processed + 16 <= size; processed += 16) {
+                __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + processed));
+
+                switch (op) {
+                    case BitwiseOp::Not: value = _mm_xor_si128(value, _mm_set1_epi8(-1)); break;
+                    case BitwiseOp::And: value = _mm_and_si128(value, _mm_loadu_si128(reinterpret_cast<const __m128i *>(operand + processed))); break;
+                    case BitwiseOp::Or:  value = _mm_or_si128(value, _mm_loadu_si128(reinterpret_cast<const __m128i *>(operand + processed)));  break;
+                    case BitwiseOp::Xor: value = _mm_xor_si128(value, _mm_loadu_si128(reinterpret_cast<const __m128i *>(operand + processed))); break;
+                }
+
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(data + processed), value);
+            }
+
+            return processed;
+        }
+
+    #endif
+
+    static void bitwiseCombine(std::span<u8> data, const u8 *operand, BitwiseOp op) {
+        size_t processed = 0;
+
+        #if defined(IMHEX_HAS_SSSE3_INTRINSICS)
+            if (hasAvx2Extensions())
+                processed = bitwiseBulkAvx2(data.data(), operand, data.size(), op);
+
+            processed += bitwiseBulkSse2(data.data() + processed, operand + processed, data.size() - processed, op);
+        #endif
+
+        switch (op) {
+            case BitwiseOp::Not: for (; processed < data.size(); processed++) data[processed] = ~data[processed];        break;
+            case BitwiseOp::And: for (; processed < data.size(); processed++) data[processed] &= operand[processed];     break;
+            case BitwiseOp::Or:  for (; processed < data.size(); processed++) data[processed] |= operand[processed];     break;
+            case BitwiseOp::Xor: for (; processed < data.size(); processed++) data[processed] ^= operand[processed];     break;
+        }
+    }
+
+    void bitwiseNot(std::span<u8> data) {
+        bitwiseCombine(data, nullptr, BitwiseOp::Not);
+    }
+
+    void bitwiseAnd(std::span<u8> data, std::span<const u8> operand) {
+        bitwiseCombine(data, operand.data(), BitwiseOp::And);
+    }
+
+    void bitwiseOr(std::span<u8> data, std::span<const u8> operand) {
+        bitwiseCombine(data, operand.data(), BitwiseOp::Or);
+    }
+
+    void bitwiseXor(std::span<u8> data, std::span<const u8> operand) {
+        bitwiseCombine(data, operand.data(), BitwiseOp::Xor);
+    }
+
     std::string toByteString(u64 bytes) {
         double value = bytes;
         u8 unitIndex = 0;
@@ -413,6 +557,35 @@ namespace hex {
         return result;
     }
 
+    void countByteOccurrences(std::span<const u8> data, std::array<u64, 256> &counts) {
+        // A single-table loop is limited by the dependency between increments of the same
+        // counter whenever neighbouring bytes happen to have the same value. Four separate
+        // sub-histograms keep those increments independent; they get merged at the end
+        std::array<std::array<u64, 256>, 4> subCounts = { };
+
+        size_t offset = 0;
+        const size_t alignedSize = data.size() - (data.size() % 8);
+        for (; offset < alignedSize; offset += 8) {
+            u64 qword = 0;
+            std::memcpy(&qword, data.data() + offset, sizeof(qword));
+
+            subCounts[0][u8(qword >>  0)]++;
+            subCounts[1][u8(qword >>  8)]++;
+            subCounts[2][u8(qword >> 16)]++;
+            subCounts[3][u8(qword >> 24)]++;
+            subCounts[0][u8(qword >> 32)]++;
+            subCounts[1][u8(qword >> 40)]++;
+            subCounts[2][u8(qword >> 48)]++;
+            subCounts[3][u8(qword >> 56)]++;
+        }
+
+        for (; offset < data.size(); offset++)
+            subCounts[0][data[offset]]++;
+
+        for (u32 value = 0; value < counts.size(); value++)
+            counts[value] += subCounts[0][value] + subCounts[1][value] + subCounts[2][value] + subCounts[3][value];
+    }
+
     float float16ToFloat32(u16 float16) {
         u32 sign     = float16 >> 15;
         u32 exponent = (float16 >> 10) & 0x1F;
@@ -0,0 +1,190 @@
+#include <hex/providers/cached_provider.hpp>
+
+#include <hex/api/task.hpp>
+#include <hex/providers/io_tracer.hpp>
+
+#include <cstring>
+
+namespace hex::prv {
+
+    CachedProvider::CachedProvider(size_t blockSize, size_t maxBlockCount)
+        : Provider(), m_blockSize(blockSize), m_maxBlockCount(maxBlockCount) { }
+
+    CachedProvider::CacheBlock &CachedProvider::loadBlock(u64 blockAddress) {
+        auto iter = this->m_blocks.find(blockAddress);
+
+        if (iter == this->m_blocks.end()) {
+            CacheBlock block;
+            block.data.resize(std::min<size_t>(this->m_blockSize, this->getActualSize() - blockAddress));
+            this->readFromSource(blockAddress, block.data.data(), block.data.size());
+
+            this->m_lruOrder.push_front(blockAddress);
+            block.lruEntry = this->m_lruOrder.begin();
+
+            iter = this->m_blocks.emplace(blockAddress, std::move(block)).first;
+            this->evictExcessBlocks();
+        } else {
+            this->m_lruOrder.splice(this->m_lruOrder.begin(), this->m_lruOrder, iter->second.lruEntry);
+        }
+
+        return iter->second;
+    }
+
+    void CachedProvider::evictExcessBlocks() {
+        while (this->m_blocks.size() > this->m_maxBlockCount) {
+            this->m_blocks.erase(this->m_lruOrder.back());
+            this->m_lruOrder.pop_back();
+        }
+    }
+
+    void CachedProvider::fetchBlockRun(u64 runStart, u64 runEnd) {
+        runEnd = std::min<u64>(runEnd, this->getActualSize());
+        if (runStart >= runEnd)
+            return;
+
+        // Fetch the whole run of missing blocks from the backend in one request
+        std::vector<u8> data(runEnd - runStart);
+        this->readFromSource(runStart, data.data(), data.size());
+
+        for (u64 blockAddress = runStart; blockAddress < runEnd; blockAddress += this->m_blockSize) {
+            CacheBlock block;
+            block.data.assign(data.begin() + (blockAddress - runStart), data.begin() + std::min<u64>(blockAddress - runStart + this->m_blockSize, data.size()));
+
+            this->m_lruOrder.push_front(blockAddress);
+            block.lruEntry = this->m_lruOrder.begin();
+
+            this->m_blocks.insert_or_assign(blockAddress, std::move(block));
+        }
+
+        this->evictExcessBlocks();
+    }
+
+    void CachedProvider::readRaw(u64 offset, void *buffer, size_t size) {
+        if ((offset + size) > this->getActualSize() || buffer == nullptr || size == 0)
+            return;
+
+        iotrace::Scope trace(iotrace::Kind::Raw, offset, size);
+
+        std::scoped_lock lock(this->m_cacheMutex);
+
+        // Load all missing blocks first, coalescing adjacent misses into single backend requests
+        {
+            const u64 firstBlock = offset - (offset % this->m_blockSize);
+            const u64 lastBlock  = (offset + size - 1) - ((offset + size - 1) % this->m_blockSize);
+
+            u64 runStart = 0;
+            bool inRun   = false;
+
+            for (u64 blockAddress = firstBlock; blockAddress <= lastBlock; blockAddress += this->m_blockSize) {
+                const bool missing = !this->m_blocks.contains(blockAddress);
+
+                if (missing && !inRun) {
+                    runStart = blockAddress;
+                    inRun    = true;
+                } else if (!missing && inRun) {
+                    this->fetchBlockRun(runStart, blockAddress);
+                    inRun = false;
+                }
+            }
+
+            if (inRun)
+                this->fetchBlockRun(runStart, lastBlock + this->m_blockSize);
+        }
+
+        auto bytes = static_cast<u8 *>(buffer);
+        while (size > 0) {
+            const auto blockAddress = offset - (offset % this->m_blockSize);
+            const auto blockOffset  = offset - blockAddress;
+
+            auto &block = this->loadBlock(blockAddress);
+            if (blockOffset >= block.data.size())
+                break;
+
+            const auto copySize = std::min<size_t>(size, block.data.size() - blockOffset);
+            std::memcpy(bytes, block.data.data() + blockOffset, copySize);
+
+            bytes  += copySize;
+            offset += copySize;
+            size   -= copySize;
+        }
+    }
+
+    void CachedProvider::writeRaw(u64 offset, const void *buffer, size_t size) {
+        if ((offset + size) > this->getActualSize() || buffer == nullptr || size == 0)
+            return;
+
+        this->writeToSource(offset, buffer, size);
+
+        // Write-through: keep any cached blocks covering the written range up to date
+        std::scoped_lock lock(this->m_cacheMutex);
+
+        auto bytes = static_cast<const u8 *>(buffer);
+        for (u64 blockAddress = offset - (offset % this->m_blockSize); blockAddress < offset + size; blockAddress += this->m_blockSize) {
+            auto iter = this->m_blocks.find(blockAddress);
+            if (iter == this->m_blocks.end())
+                continue;
+
+            auto &block = iter->second;
+
+            const auto overlapStart = std::max(offset, blockAddress);
+            const auto overlapEnd   = std::min<u64>(offset + size, blockAddress + block.data.size());
+            if (overlapStart >= overlapEnd)
+                continue;
+
+            std::memcpy(block.data.data() + (overlapStart - blockAddress), bytes + (overlapStart - offset), overlapEnd - overlapStart);
+        }
+    }
+
+    void CachedProvider::prefetchAsync(u64 offset, size_t size) {
+        if (size == 0 || offset >= this->getActualSize())
+            return;
+        size = std::min<size_t>(size, this->getActualSize() - offset);
+
+        // Skip scheduling a task if everything is already cached
+        {
+            std::scoped_lock lock(this->m_cacheMutex);
+
+            bool allCached = true;
+            for (u64 blockAddress = offset - (offset % this->m_blockSize); blockAddress < offset + size; blockAddress += this->m_blockSize) {
+                if (!this->m_blocks.contains(blockAddress)) {
+                    allCached = false;
+                    break;
+                }
+            }
+
+            if (allCached)
+                return;
+        }
+
+        if (this->m_prefetchRunning.exchange(true))
+            return;
+
+        TaskManager::createBackgroundTask("hex.builtin.common.processing", [this, offset, size](auto &) {
+            std::vector<u8> scratch(size);
+            this->readRaw(offset, scratch.data(), scratch.size());
+
+            this->m_prefetchRunning = false;
+        });
+    }
+
+    void CachedProvider::invalidateCache() {
+        std::scoped_lock lock(this->m_cacheMutex);
+
+        this->m_blocks.clear();
+        this->m_lruOrder.clear();
+    }
+
+    void CachedProvider::invalidateCache(u64 offset, size_t size) {
+        if (size == 0)
+            return;
+
+        std::scoped_lock lock(this->m_cacheMutex);
+
+        auto iter = this->m_blocks.lower_bound(offset - (offset % this->m_blockSize));
+        while (iter != this->m_blocks.end() && iter->first < offset + size) {
+            this->m_lruOrder.erase(iter->second.lruEntry);
+            iter = this->m_blocks.erase(iter);
+        }
+    }
+
+}
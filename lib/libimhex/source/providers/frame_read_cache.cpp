@@ -0,0 +1,102 @@
+#include <hex/providers/frame_read_cache.hpp>
+
+#include <hex/providers/provider.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace hex::prv::readcache {
+
+    namespace {
+
+        constexpr static size_t BlockSize = 0x1000;
+
+        // Reads larger than this gain nothing from block assembly and would
+        // only churn the cache, so they go straight to the provider
+        constexpr static size_t MaxCachedReadSize = 0x1'0000;
+
+        constexpr static size_t MaxBlockCount = 0x100;
+
+        struct Block {
+            std::vector<u8> data;
+            u64 lastUse = 0;
+        };
+
+        std::mutex s_mutex;
+        std::map<std::pair<Provider *, u64>, Block> s_blocks;
+        u64 s_useCounter = 0;
+
+        Block &getBlock(Provider *provider, u64 blockOffset) {
+            auto [iter, inserted] = s_blocks.try_emplace({ provider, blockOffset });
+
+            auto &block = iter->second;
+            if (inserted) {
+                if (s_blocks.size() > MaxBlockCount) {
+                    auto oldest = std::min_element(s_blocks.begin(), s_blocks.end(), [](const auto &left, const auto &right) {
+                        return left.second.lastUse < right.second.lastUse;
+                    });
+                    if (oldest != iter)
+                        s_blocks.erase(oldest);
+                }
+
+                block.data.resize(BlockSize);
+
+                // Blocks straddling the provider's bounds only read the valid part;
+                // the rest stays zero-filled, matching what Provider::read would leave
+                const u64 providerStart = provider->getBaseAddress();
+                const u64 providerEnd   = providerStart + provider->getActualSize();
+                const u64 validStart    = std::max(blockOffset, providerStart);
+                const u64 validEnd      = std::min(blockOffset + BlockSize, providerEnd);
+                if (validEnd > validStart)
+                    provider->read(validStart, block.data.data() + (validStart - blockOffset), validEnd - validStart);
+            }
+
+            block.lastUse = ++s_useCounter;
+
+            return block;
+        }
+
+    }
+
+    void read(Provider *provider, u64 offset, void *buffer, size_t size) {
+        if (provider == nullptr || buffer == nullptr || size == 0)
+            return;
+
+        if (size > MaxCachedReadSize) {
+            provider->read(offset, buffer, size);
+            return;
+        }
+
+        std::scoped_lock lock(s_mutex);
+
+        auto bytes = static_cast<u8 *>(buffer);
+        for (u64 current = offset; current < offset + size;) {
+            const u64 blockOffset = current - current % BlockSize;
+            const u64 blockIndex  = current - blockOffset;
+            const auto chunkSize  = std::min<size_t>(BlockSize - blockIndex, (offset + size) - current);
+
+            const auto &block = getBlock(provider, blockOffset);
+            std::memcpy(bytes + (current - offset), block.data.data() + blockIndex, chunkSize);
+
+            current += chunkSize;
+        }
+    }
+
+    void invalidate(Provider *provider) {
+        std::scoped_lock lock(s_mutex);
+
+        std::erase_if(s_blocks, [provider](const auto &entry) {
+            return entry.first.first == provider;
+        });
+    }
+
+    void invalidateAll() {
+        std::scoped_lock lock(s_mutex);
+
+        s_blocks.clear();
+    }
+
+}
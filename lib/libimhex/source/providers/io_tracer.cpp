@@ -0,0 +1,165 @@
+#include <hex/providers/io_tracer.hpp>
+
+#include <hex/helpers/file.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+namespace hex::prv::iotrace {
+
+    namespace {
+
+        constexpr u32 FileMagic   = 0x52544849; // "IHTR"
+        constexpr u32 FileVersion = 1;
+
+        // 8 MiB worth of records; the ring overwrites its oldest entries when full
+        constexpr size_t RingCapacity = 0x8'0000;
+
+        std::atomic<bool> s_enabled = false;
+        std::atomic<u64> s_head = 0;
+
+        // Allocated lazily on the first enable, so sessions that never trace don't pay for the ring
+        std::vector<Record> s_ring;
+
+        std::mutex s_tagMutex;
+        std::vector<std::string> s_tagNames = { "untagged" };
+
+        // Cached per thread so recording doesn't take the tag lock on the hot path
+        thread_local u16 t_tagId = 0;
+
+        u16 internTag(const char *name) {
+            std::scoped_lock lock(s_tagMutex);
+
+            for (size_t index = 0; index < s_tagNames.size(); index++) {
+                if (s_tagNames[index] == name)
+                    return u16(index);
+            }
+
+            s_tagNames.emplace_back(name);
+            return u16(s_tagNames.size() - 1);
+        }
+
+    }
+
+    void setEnabled(bool enabled) {
+        if (enabled && s_ring.empty())
+            s_ring.resize(RingCapacity);
+
+        s_enabled = enabled;
+    }
+
+    bool isEnabled() {
+        return s_enabled;
+    }
+
+    u64 getRecordCount() {
+        return std::min<u64>(s_head, RingCapacity);
+    }
+
+    u64 getTotalCount() {
+        return s_head;
+    }
+
+    void record(Kind kind, u64 offset, size_t size, u64 latencyNs) {
+        if (!s_enabled)
+            return;
+
+        const auto slot = s_head.fetch_add(1, std::memory_order_relaxed) % RingCapacity;
+        s_ring[slot] = {
+            offset,
+            u32(std::min<size_t>(size, 0xFFFF'FFFF)),
+            u32(std::min<u64>(latencyNs, 0xFFFF'FFFF)),
+            t_tagId,
+            u8(kind),
+            0
+        };
+    }
+
+    void clear() {
+        s_head = 0;
+    }
+
+    ScopedTag::ScopedTag(const char *name) : m_previousId(t_tagId) {
+        t_tagId = internTag(name);
+    }
+
+    ScopedTag::~ScopedTag() {
+        t_tagId = this->m_previousId;
+    }
+
+    bool dump(const std::fs::path &path) {
+        // Concurrent writers would tear records while they're being copied out
+        setEnabled(false);
+
+        fs::File file(path, fs::File::Mode::Create);
+        if (!file.isValid())
+            return false;
+
+        const auto writeValue = [&](auto value) {
+            file.write(reinterpret_cast<const u8*>(&value), sizeof(value));
+        };
+
+        writeValue(FileMagic);
+        writeValue(FileVersion);
+
+        {
+            std::scoped_lock lock(s_tagMutex);
+
+            writeValue(u32(s_tagNames.size()));
+            for (const auto &name : s_tagNames) {
+                writeValue(u32(name.size()));
+                file.write(reinterpret_cast<const u8*>(name.data()), name.size());
+            }
+        }
+
+        const u64 total = s_head;
+        const u64 count = std::min<u64>(total, RingCapacity);
+
+        writeValue(count);
+        for (u64 index = total - count; index < total; index++)
+            file.write(reinterpret_cast<const u8*>(&s_ring[index % RingCapacity]), sizeof(Record));
+
+        return true;
+    }
+
+    std::optional<Trace> load(const std::fs::path &path) {
+        fs::File file(path, fs::File::Mode::Read);
+        if (!file.isValid())
+            return std::nullopt;
+
+        const auto readValue = [&](auto &value) {
+            return file.readBuffer(reinterpret_cast<u8*>(&value), sizeof(value)) == sizeof(value);
+        };
+
+        u32 magic = 0, version = 0, tagCount = 0;
+        if (!readValue(magic) || !readValue(version) || !readValue(tagCount))
+            return std::nullopt;
+        if (magic != FileMagic || version != FileVersion)
+            return std::nullopt;
+
+        Trace trace;
+        for (u32 index = 0; index < tagCount; index++) {
+            u32 length = 0;
+            if (!readValue(length) || length > 0x1000)
+                return std::nullopt;
+
+            std::string name(length, '\x00');
+            if (file.readBuffer(reinterpret_cast<u8*>(name.data()), length) != length)
+                return std::nullopt;
+
+            trace.tags.push_back(std::move(name));
+        }
+
+        u64 recordCount = 0;
+        if (!readValue(recordCount) || recordCount > RingCapacity)
+            return std::nullopt;
+
+        trace.records.resize(recordCount);
+        if (file.readBuffer(reinterpret_cast<u8*>(trace.records.data()), recordCount * sizeof(Record)) != recordCount * sizeof(Record))
+            return std::nullopt;
+
+        return trace;
+    }
+
+}
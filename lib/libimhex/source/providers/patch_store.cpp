@@ -0,0 +1,216 @@
+#include <hex/providers/patch_store.hpp>
+
+#include <cstring>
+
+namespace hex::prv {
+
+    PatchStore::Iterator::Iterator(ChunkMap::const_iterator chunk, ChunkMap::const_iterator end, size_t index)
+        : m_chunk(chunk), m_end(end), m_index(index) {
+        this->advanceToPatchedByte();
+    }
+
+    std::pair<u64, u8> PatchStore::Iterator::operator*() const {
+        return { this->m_chunk->first + this->m_index, this->m_chunk->second->data[this->m_index] };
+    }
+
+    PatchStore::Iterator &PatchStore::Iterator::operator++() {
+        this->m_index++;
+        this->advanceToPatchedByte();
+
+        return *this;
+    }
+
+    PatchStore::Iterator PatchStore::Iterator::operator++(int) {
+        auto result = *this;
+        ++(*this);
+
+        return result;
+    }
+
+    void PatchStore::Iterator::advanceToPatchedByte() {
+        while (this->m_chunk != this->m_end) {
+            const auto &chunk = *this->m_chunk->second;
+            while (this->m_index < ChunkSize) {
+                if (chunk.patched[this->m_index])
+                    return;
+                this->m_index++;
+            }
+
+            this->m_chunk++;
+            this->m_index = 0;
+        }
+    }
+
+
+    PatchStore::Chunk &PatchStore::getWritableChunk(u64 chunkAddress) {
+        auto &chunk = this->m_chunks[chunkAddress];
+
+        if (chunk == nullptr)
+            chunk = std::make_shared<Chunk>();
+        else if (chunk.use_count() > 1)
+            chunk = std::make_shared<Chunk>(*chunk);
+
+        return *chunk;
+    }
+
+    void PatchStore::set(u64 address, u8 value) {
+        auto &chunk = this->getWritableChunk(address - address % ChunkSize);
+        const auto index = address % ChunkSize;
+
+        if (!chunk.patched[index]) {
+            chunk.patched[index] = true;
+            chunk.patchCount++;
+            this->m_patchCount++;
+        }
+
+        chunk.data[index] = value;
+    }
+
+    void PatchStore::erase(u64 address) {
+        const auto chunkAddress = address - address % ChunkSize;
+
+        auto iter = this->m_chunks.find(chunkAddress);
+        if (iter == this->m_chunks.end() || !iter->second->patched[address % ChunkSize])
+            return;
+
+        auto &chunk = this->getWritableChunk(chunkAddress);
+        chunk.patched[address % ChunkSize] = false;
+        chunk.patchCount--;
+        this->m_patchCount--;
+
+        if (chunk.patchCount == 0)
+            this->m_chunks.erase(chunkAddress);
+    }
+
+    bool PatchStore::contains(u64 address) const {
+        auto iter = this->m_chunks.find(address - address % ChunkSize);
+        if (iter == this->m_chunks.end())
+            return false;
+
+        return iter->second->patched[address % ChunkSize];
+    }
+
+    u8 PatchStore::at(u64 address) const {
+        auto iter = this->m_chunks.find(address - address % ChunkSize);
+        if (iter == this->m_chunks.end())
+            return 0x00;
+
+        return iter->second->data[address % ChunkSize];
+    }
+
+    void PatchStore::apply(u64 offset, void *buffer, size_t size) const {
+        if (this->m_chunks.empty() || size == 0)
+            return;
+
+        auto bytes = static_cast<u8 *>(buffer);
+
+        auto iter = this->m_chunks.upper_bound(offset);
+        if (iter != this->m_chunks.begin())
+            iter--;
+
+        for (; iter != this->m_chunks.end() && iter->first < offset + size; iter++) {
+            const auto &[chunkAddress, chunk] = *iter;
+
+            const auto overlapStart = std::max(offset, chunkAddress);
+            const auto overlapEnd   = std::min(offset + size, chunkAddress + ChunkSize);
+            if (overlapStart >= overlapEnd)
+                continue;
+
+            if (chunk->patchCount == ChunkSize) {
+                std::memcpy(bytes + (overlapStart - offset), chunk->data.data() + (overlapStart - chunkAddress), overlapEnd - overlapStart);
+            } else {
+                for (u64 address = overlapStart; address < overlapEnd; address++) {
+                    if (chunk->patched[address - chunkAddress])
+                        bytes[address - offset] = chunk->data[address - chunkAddress];
+                }
+            }
+        }
+    }
+
+    void PatchStore::setRange(u64 address, std::span<const u8> data) {
+        size_t index = 0;
+        while (index < data.size()) {
+            const u64 byteAddress  = address + index;
+            const u64 chunkAddress = byteAddress - byteAddress % ChunkSize;
+            const auto chunkOffset = size_t(byteAddress - chunkAddress);
+            const auto count       = std::min(data.size() - index, ChunkSize - chunkOffset);
+
+            auto &chunk = this->getWritableChunk(chunkAddress);
+
+            std::memcpy(chunk.data.data() + chunkOffset, data.data() + index, count);
+            for (size_t bit = chunkOffset; bit < chunkOffset + count; bit++) {
+                if (!chunk.patched[bit]) {
+                    chunk.patched[bit] = true;
+                    chunk.patchCount++;
+                    this->m_patchCount++;
+                }
+            }
+
+            index += count;
+        }
+    }
+
+    PatchStore::ChunkSnapshot PatchStore::snapshotChunks(u64 address, size_t size) const {
+        ChunkSnapshot snapshot;
+        if (this->m_chunks.empty() || size == 0)
+            return snapshot;
+
+        auto iter = this->m_chunks.upper_bound(address);
+        if (iter != this->m_chunks.begin())
+            iter--;
+
+        for (; iter != this->m_chunks.end() && iter->first < address + size; iter++) {
+            if (iter->first + ChunkSize > address)
+                snapshot.insert(snapshot.end(), *iter);
+        }
+
+        return snapshot;
+    }
+
+    void PatchStore::restoreChunks(u64 address, size_t size, const ChunkSnapshot &snapshot) {
+        if (size == 0)
+            return;
+
+        const u64 firstChunk = address - address % ChunkSize;
+        auto iter = this->m_chunks.lower_bound(firstChunk);
+        while (iter != this->m_chunks.end() && iter->first < address + size) {
+            this->m_patchCount -= iter->second->patchCount;
+            iter = this->m_chunks.erase(iter);
+        }
+
+        for (const auto &[chunkAddress, chunk] : snapshot) {
+            this->m_chunks.insert_or_assign(chunkAddress, chunk);
+            this->m_patchCount += chunk->patchCount;
+        }
+    }
+
+    void PatchStore::clear() {
+        this->m_chunks.clear();
+        this->m_patchCount = 0;
+    }
+
+    std::map<u64, u8> PatchStore::toMap() const {
+        std::map<u64, u8> result;
+
+        for (const auto &[address, value] : *this)
+            result.insert(result.end(), { address, value });
+
+        return result;
+    }
+
+    void PatchStore::fromMap(const std::map<u64, u8> &patches) {
+        this->clear();
+
+        for (const auto &[address, value] : patches)
+            this->set(address, value);
+    }
+
+    PatchStore::Iterator PatchStore::begin() const {
+        return Iterator(this->m_chunks.begin(), this->m_chunks.end(), 0);
+    }
+
+    PatchStore::Iterator PatchStore::end() const {
+        return Iterator(this->m_chunks.end(), this->m_chunks.end(), 0);
+    }
+
+}
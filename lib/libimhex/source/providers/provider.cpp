@@ -2,34 +2,59 @@
 
 #include <hex.hpp>
 #include <hex/api/event.hpp>
+#include <hex/providers/io_tracer.hpp>
+#include <hex/helpers/fmt.hpp>
+#include <hex/helpers/logger.hpp>
+#include <hex/helpers/utils.hpp>
 
 #include <cmath>
 #include <cstring>
 #include <map>
 #include <optional>
+#include <utility>
+
+#if defined(OS_WINDOWS)
+    #include <windows.h>
+#else
+    #include <unistd.h>
+#endif
 
 namespace hex::prv {
 
     u32 Provider::s_idCounter = 0;
 
     Provider::Provider() : m_id(s_idCounter++) {
-        this->m_patches.emplace_back();
+        this->m_undoDeltas.emplace_back();
     }
 
     Provider::~Provider() {
         for (auto &overlay : this->m_overlays)
             this->deleteOverlay(overlay);
+
+        if (this->m_undoSpillFile.isValid())
+            this->m_undoSpillFile.remove();
     }
 
     void Provider::read(u64 offset, void *buffer, size_t size, bool overlays) {
         hex::unused(overlays);
 
+        iotrace::Scope trace(iotrace::Kind::Read, offset, size);
+
         this->readRaw(offset - this->getBaseAddress(), buffer, size);
     }
 
     void Provider::write(u64 offset, const void *buffer, size_t size) {
         this->writeRaw(offset - this->getBaseAddress(), buffer, size);
         this->markDirty();
+
+        if (size > 0)
+            EventManager::post<EventRegionDirtied>(this, Region { offset, size });
+    }
+
+    std::optional<std::span<const u8>> Provider::readRawBorrowed(u64 offset, size_t size) const {
+        hex::unused(offset, size);
+
+        return std::nullopt;
     }
 
     void Provider::save() { }
@@ -48,7 +73,7 @@ namespace hex::prv {
 
         std::vector<std::pair<u64, u8>> patchesToMove;
 
-        for (auto &[address, value] : patches) {
+        for (const auto &[address, value] : patches) {
             if (address > offset)
                 patchesToMove.emplace_back(address, value);
         }
@@ -56,9 +81,12 @@ namespace hex::prv {
         for (const auto &[address, value] : patchesToMove)
             patches.erase(address);
         for (const auto &[address, value] : patchesToMove)
-            patches.insert({ address + size, value });
+            patches.set(address + size, value);
 
         this->markDirty();
+
+        // Everything from the insertion point to the new end of the data shifted
+        EventManager::post<EventRegionDirtied>(this, Region { this->getBaseAddress() + offset, this->getActualSize() - offset });
     }
 
     void Provider::remove(u64 offset, size_t size) {
@@ -66,7 +94,7 @@ namespace hex::prv {
 
         std::vector<std::pair<u64, u8>> patchesToMove;
 
-        for (auto &[address, value] : patches) {
+        for (const auto &[address, value] : patches) {
             if (address > offset)
                 patchesToMove.emplace_back(address, value);
         }
@@ -74,56 +102,110 @@ namespace hex::prv {
         for (const auto &[address, value] : patchesToMove)
             patches.erase(address);
         for (const auto &[address, value] : patchesToMove)
-            patches.insert({ address - size, value });
+            patches.set(address - size, value);
 
         this->markDirty();
+
+        // The dirtied range covers the old extent of the data so consumers can drop results past the new end
+        EventManager::post<EventRegionDirtied>(this, Region { this->getBaseAddress() + offset, (this->getActualSize() - offset) + size });
     }
 
-    void Provider::applyOverlays(u64 offset, void *buffer, size_t size) {
-        for (auto &overlay : this->m_overlays) {
-            auto overlayOffset = overlay->getAddress();
-            auto overlaySize   = overlay->getSize();
+    u64 Provider::getContentFingerprint() {
+        constexpr static u64 FnvOffsetBasis = 0xCBF2'9CE4'8422'2325;
+        constexpr static u64 FnvPrime       = 0x0000'0100'0000'01B5;
+        constexpr static u64 SampleCount    = 16;
+        constexpr static size_t SampleSize  = 0x1000;
 
-            i128 overlapMin = std::max(offset, overlayOffset);
-            i128 overlapMax = std::min(offset + size, overlayOffset + overlaySize);
-            if (overlapMax > overlapMin)
-                std::memcpy(static_cast<u8 *>(buffer) + std::max<i128>(0, overlapMin - offset), overlay->getData().data() + std::max<i128>(0, overlapMin - overlayOffset), overlapMax - overlapMin);
+        u64 fingerprint = FnvOffsetBasis;
+        auto feed = [&fingerprint](const u8 *data, size_t count) {
+            for (size_t i = 0; i < count; i++) {
+                fingerprint ^= data[i];
+                fingerprint *= FnvPrime;
+            }
+        };
+
+        const u64 size = this->getActualSize();
+        feed(reinterpret_cast<const u8 *>(&size), sizeof(size));
+
+        std::vector<u8> buffer(SampleSize);
+        if (size <= SampleCount * SampleSize) {
+            for (u64 offset = 0; offset < size; offset += SampleSize) {
+                const auto chunkSize = std::min<u64>(SampleSize, size - offset);
+                this->readRaw(offset, buffer.data(), chunkSize);
+                feed(buffer.data(), chunkSize);
+            }
+        } else {
+            // Sample evenly spread blocks, always including the very start and end of the data
+            const auto stride = (size - SampleSize) / (SampleCount - 1);
+            for (u64 sample = 0; sample < SampleCount; sample++) {
+                this->readRaw(sample * stride, buffer.data(), SampleSize);
+                feed(buffer.data(), SampleSize);
+            }
         }
+
+        return fingerprint;
     }
 
+    void Provider::applyOverlays(u64 offset, void *buffer, size_t size) {
+        if (this->m_overlays.empty() || size == 0)
+            return;
+
+        this->updateOverlayTree();
+
+        for (const auto &interval : this->m_overlayTree.findOverlapping(offset, (offset + size) - 1)) {
+            const auto &extent = this->m_overlayExtents[interval.value];
 
-    std::map<u64, u8> &Provider::getPatches() {
-        auto iter = this->m_patches.end();
-        for (u32 i = 0; i < this->m_patchTreeOffset + 1; i++)
-            iter--;
+            const u64 extentOffset = extent.address;
+            const u64 extentSize   = extent.data.size();
 
-        return *(iter);
+            i128 overlapMin = std::max(offset, extentOffset);
+            i128 overlapMax = std::min(offset + size, extentOffset + extentSize);
+            if (overlapMax > overlapMin)
+                std::memcpy(static_cast<u8 *>(buffer) + std::max<i128>(0, overlapMin - offset), extent.data.data() + std::max<i128>(0, overlapMin - extentOffset), overlapMax - overlapMin);
+        }
     }
 
-    const std::map<u64, u8> &Provider::getPatches() const {
-        auto iter = this->m_patches.end();
-        for (u32 i = 0; i < this->m_patchTreeOffset + 1; i++)
-            iter--;
 
-        return *(iter);
+    PatchStore &Provider::getPatches() {
+        return this->m_patchStore;
+    }
+
+    const PatchStore &Provider::getPatches() const {
+        return this->m_patchStore;
     }
 
     void Provider::applyPatches() {
-        for (auto &[patchAddress, patch] : getPatches()) {
-            this->writeRaw(patchAddress - this->getBaseAddress(), &patch, 1);
-        }
+        this->createUndoPoint();
+
+        // Recording the apply as a single chunk snapshot keeps the undo point
+        // proportional to the number of patched chunks instead of patched bytes
+        auto &bulkChange  = this->m_undoDeltas.back().bulkChanges.emplace_back();
+        bulkChange.offset = 0x00;
+        bulkChange.size   = this->getActualSize();
+        bulkChange.before = this->m_patchStore.snapshotChunks(bulkChange.offset, bulkChange.size);
+        this->m_undoDeltaSize += bulkChange.before.size() * sizeof(PatchStore::Chunk);
+
+        // Write contiguous runs of patched bytes in one go instead of one writeRaw() per byte
+        this->m_patchStore.forEachRun([this](u64 address, std::span<const u8> run) {
+            this->writeRaw(address - this->getBaseAddress(), run.data(), run.size());
+        });
+
+        this->m_patchStore.clear();
         this->markDirty();
-
-        this->m_patches.emplace_back();
     }
 
 
     Overlay *Provider::newOverlay() {
-        return this->m_overlays.emplace_back(new Overlay());
+        auto overlay = this->m_overlays.emplace_back(new Overlay());
+        overlay->m_modificationCounter = &this->m_overlayModifications;
+        this->m_overlayModifications++;
+
+        return overlay;
     }
 
     void Provider::deleteOverlay(Overlay *overlay) {
         this->m_overlays.erase(std::find(this->m_overlays.begin(), this->m_overlays.end(), overlay));
+        this->m_overlayModifications++;
         delete overlay;
     }
 
@@ -131,18 +213,84 @@ namespace hex::prv {
         return this->m_overlays;
     }
 
+    std::vector<Overlay *> Provider::getOverlaysInRange(u64 address, size_t size) const {
+        if (this->m_overlays.empty() || size == 0)
+            return { };
 
-    u32 Provider::getPageCount() const {
-        return std::max(1.0, std::ceil(this->getActualSize() / double(PageSize)));
-    }
+        std::vector<Overlay *> result;
+        for (const auto &overlay : this->m_overlays) {
+            if (overlay->getSize() == 0)
+                continue;
 
-    u32 Provider::getCurrentPage() const {
-        return this->m_currPage;
+            if (overlay->getAddress() < address + size && overlay->getAddress() + overlay->getSize() > address)
+                result.push_back(overlay);
+        }
+
+        return result;
     }
 
-    void Provider::setCurrentPage(u32 page) {
-        if (page < getPageCount())
-            this->m_currPage = page;
+    void Provider::updateOverlayTree() const {
+        if (this->m_overlayTreeModifications == this->m_overlayModifications)
+            return;
+
+        // Batch all pending overlay writes into merged extents. Overlapping and
+        // adjacent overlays share one pooled buffer, so tools that create thousands
+        // of small overlays cost a few extent intersections per read instead of one
+        // per overlay
+        struct ExtentRange {
+            u64 start, end;
+        };
+        std::vector<ExtentRange> ranges;
+
+        {
+            std::vector<const Overlay *> sortedOverlays;
+            for (const auto &overlay : this->m_overlays) {
+                if (overlay->getSize() > 0)
+                    sortedOverlays.push_back(overlay);
+            }
+            std::sort(sortedOverlays.begin(), sortedOverlays.end(), [](const Overlay *a, const Overlay *b) {
+                return a->getAddress() < b->getAddress();
+            });
+
+            for (const auto &overlay : sortedOverlays) {
+                const u64 start = overlay->getAddress();
+                const u64 end   = start + overlay->getSize();
+
+                if (!ranges.empty() && start <= ranges.back().end)
+                    ranges.back().end = std::max(ranges.back().end, end);
+                else
+                    ranges.push_back({ start, end });
+            }
+        }
+
+        this->m_overlayExtents.clear();
+        this->m_overlayExtents.resize(ranges.size());
+        for (size_t index = 0; index < ranges.size(); index++) {
+            this->m_overlayExtents[index].address = ranges[index].start;
+            this->m_overlayExtents[index].data.resize(ranges[index].end - ranges[index].start);
+        }
+
+        // Fill the extents in creation order so later overlays override earlier ones
+        for (const auto &overlay : this->m_overlays) {
+            if (overlay->getSize() == 0)
+                continue;
+
+            const auto range = std::prev(std::upper_bound(ranges.begin(), ranges.end(), overlay->getAddress(), [](u64 address, const ExtentRange &extentRange) {
+                return address < extentRange.start;
+            }));
+            auto &extent = this->m_overlayExtents[std::distance(ranges.begin(), range)];
+
+            std::memcpy(extent.data.data() + (overlay->getAddress() - extent.address), std::as_const(*overlay).getData().data(), overlay->getSize());
+        }
+
+        decltype(this->m_overlayTree)::interval_vector intervals;
+        for (size_t index = 0; index < this->m_overlayExtents.size(); index++) {
+            const auto &extent = this->m_overlayExtents[index];
+            intervals.emplace_back(extent.address, extent.address + extent.data.size() - 1, index);
+        }
+
+        this->m_overlayTree = decltype(this->m_overlayTree)(std::move(intervals));
+        this->m_overlayTreeModifications = this->m_overlayModifications;
     }
 
 
@@ -155,66 +303,344 @@ namespace hex::prv {
         return this->m_baseAddress;
     }
 
-    u64 Provider::getCurrentPageAddress() const {
-        return PageSize * this->getCurrentPage();
-    }
-
     size_t Provider::getSize() const {
-        return std::min(this->getActualSize() - PageSize * this->m_currPage, PageSize);
-    }
-
-    std::optional<u32> Provider::getPageOfAddress(u64 address) const {
-        u32 page = std::floor((address - this->getBaseAddress()) / double(PageSize));
-
-        if (page >= this->getPageCount())
-            return std::nullopt;
-
-        return page;
+        return this->getActualSize();
     }
 
     void Provider::addPatch(u64 offset, const void *buffer, size_t size, bool createUndo) {
         if (this->m_patchTreeOffset > 0) {
-            auto iter = this->m_patches.end();
-            for (u32 i = 0; i < this->m_patchTreeOffset; i++)
-                iter--;
+            auto iter = std::prev(this->m_undoDeltas.end(), this->m_patchTreeOffset);
 
-            this->m_patches.erase(iter, this->m_patches.end());
+            this->m_undoDeltas.erase(iter, this->m_undoDeltas.end());
             this->m_patchTreeOffset = 0;
+
+            if (this->m_undoDeltas.empty())
+                this->m_undoDeltas.emplace_back();
         }
 
         if (createUndo)
             createUndoPoint();
 
+        auto &patches = getPatches();
+        auto &delta   = this->m_undoDeltas.back().changes;
+
         for (u64 i = 0; i < size; i++) {
             u8 patch         = reinterpret_cast<const u8 *>(buffer)[i];
             u8 originalValue = 0x00;
             this->readRaw(offset + i, &originalValue, sizeof(u8));
 
-            if (patch == originalValue)
-                getPatches().erase(offset + i);
+            std::optional<u8> oldValue, newValue;
+            if (patches.contains(offset + i))
+                oldValue = patches.at(offset + i);
+            if (patch != originalValue)
+                newValue = patch;
+
+            auto [changeIter, inserted] = delta.try_emplace(offset + i, PatchChange { oldValue, newValue });
+            if (inserted)
+                this->m_undoDeltaSize += sizeof(u64) + sizeof(PatchChange);
             else
-                getPatches()[offset + i] = patch;
+                changeIter->second.newValue = newValue;
+
+            if (newValue.has_value())
+                patches.set(offset + i, *newValue);
+            else
+                patches.erase(offset + i);
         }
 
         this->markDirty();
+
+        if (size > 0)
+            EventManager::post<EventRegionDirtied>(this, Region { this->getBaseAddress() + offset, size });
+    }
+
+    void Provider::addBulkPatch(u64 offset, const void *buffer, size_t size, bool createUndo) {
+        if (size == 0)
+            return;
+
+        if (this->m_patchTreeOffset > 0) {
+            auto iter = std::prev(this->m_undoDeltas.end(), this->m_patchTreeOffset);
+
+            this->m_undoDeltas.erase(iter, this->m_undoDeltas.end());
+            this->m_patchTreeOffset = 0;
+
+            if (this->m_undoDeltas.empty())
+                this->m_undoDeltas.emplace_back();
+        }
+
+        if (createUndo)
+            createUndoPoint();
+
+        auto &bulkChange  = this->m_undoDeltas.back().bulkChanges.emplace_back();
+        bulkChange.offset = offset;
+        bulkChange.size   = size;
+        bulkChange.before = this->m_patchStore.snapshotChunks(offset, size);
+
+        this->m_patchStore.setRange(offset, { static_cast<const u8 *>(buffer), size });
+
+        bulkChange.after = this->m_patchStore.snapshotChunks(offset, size);
+
+        // Snapshots share chunk storage with the live store, so this is an upper bound
+        this->m_undoDeltaSize += (bulkChange.before.size() + bulkChange.after.size()) * sizeof(PatchStore::Chunk);
+
+        this->markDirty();
+
+        EventManager::post<EventRegionDirtied>(this, Region { this->getBaseAddress() + offset, size });
     }
 
     void Provider::createUndoPoint() {
-        this->m_patches.push_back(getPatches());
+        this->m_undoDeltas.emplace_back();
+
+        // Spill the oldest undo points to disk once the history exceeds its memory
+        // budget; deep undo loads them back in, so the undo depth stays unlimited
+        while (this->m_maxUndoDeltaSize != 0 && this->m_undoDeltaSize > this->m_maxUndoDeltaSize &&
+               (this->m_undoDeltas.size() - 1) > this->m_patchTreeOffset && this->m_undoDeltas.size() > 1) {
+            const auto &oldest = this->m_undoDeltas.front();
+
+            size_t oldestSize = oldest.changes.size() * (sizeof(u64) + sizeof(PatchChange));
+            for (const auto &bulkChange : oldest.bulkChanges)
+                oldestSize += (bulkChange.before.size() + bulkChange.after.size()) * sizeof(PatchStore::Chunk);
+
+            this->spillOldestUndoDelta();
+
+            this->m_undoDeltaSize -= std::min(this->m_undoDeltaSize, oldestSize);
+            this->m_undoDeltas.pop_front();
+        }
+    }
+
+    // File-format helpers for the undo spill tier. Everything is written in host
+    // byte order since the spill file never leaves the machine or the session
+    namespace {
+
+        template<typename T>
+        void spillWrite(fs::File &file, const T &value) {
+            file.write(reinterpret_cast<const u8 *>(&value), sizeof(value));
+        }
+
+        template<typename T>
+        [[nodiscard]] bool spillRead(fs::File &file, T &value) {
+            return file.readBuffer(reinterpret_cast<u8 *>(&value), sizeof(value)) == sizeof(value);
+        }
+
+        void spillSnapshot(fs::File &file, const PatchStore::ChunkSnapshot &snapshot) {
+            spillWrite(file, u32(snapshot.size()));
+
+            for (const auto &[chunkAddress, chunk] : snapshot) {
+                spillWrite(file, chunkAddress);
+
+                // Only contiguous patched runs go to disk, so sparse chunks stay small
+                std::vector<std::pair<u32, u32>> runs;
+                for (size_t index = 0; index < PatchStore::ChunkSize; index++) {
+                    if (!chunk->patched[index])
+                        continue;
+
+                    if (!runs.empty() && size_t(runs.back().first) + runs.back().second == index)
+                        runs.back().second++;
+                    else
+                        runs.emplace_back(u32(index), 1);
+                }
+
+                spillWrite(file, u32(runs.size()));
+                for (const auto &[runOffset, runSize] : runs) {
+                    spillWrite(file, runOffset);
+                    spillWrite(file, runSize);
+                    file.write(chunk->data.data() + runOffset, runSize);
+                }
+            }
+        }
+
+        [[nodiscard]] bool unspillSnapshot(fs::File &file, PatchStore::ChunkSnapshot &snapshot) {
+            u32 chunkCount = 0;
+            if (!spillRead(file, chunkCount))
+                return false;
+
+            for (u32 chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++) {
+                u64 chunkAddress = 0;
+                u32 runCount = 0;
+                if (!spillRead(file, chunkAddress) || !spillRead(file, runCount))
+                    return false;
+
+                auto chunk = std::make_shared<PatchStore::Chunk>();
+                for (u32 runIndex = 0; runIndex < runCount; runIndex++) {
+                    u32 runOffset = 0, runSize = 0;
+                    if (!spillRead(file, runOffset) || !spillRead(file, runSize))
+                        return false;
+                    if (runOffset > PatchStore::ChunkSize || runSize > PatchStore::ChunkSize - runOffset)
+                        return false;
+
+                    if (file.readBuffer(chunk->data.data() + runOffset, runSize) != runSize)
+                        return false;
+
+                    for (u32 index = 0; index < runSize; index++)
+                        chunk->patched[runOffset + index] = true;
+                    chunk->patchCount += runSize;
+                }
+
+                snapshot.emplace(chunkAddress, std::move(chunk));
+            }
+
+            return true;
+        }
+
+    }
+
+    void Provider::spillOldestUndoDelta() {
+        if (!this->m_undoSpillFile.isValid()) {
+            // Provider IDs start at zero in every process, so the name needs the process
+            // ID too or two running instances would truncate each other's spill files
+            #if defined(OS_WINDOWS)
+                const auto processId = ::GetCurrentProcessId();
+            #else
+                const auto processId = ::getpid();
+            #endif
+
+            const auto path = std::fs::temp_directory_path() / hex::format("imhex.undo.{}.{}.spill", processId, this->m_id);
+
+            this->m_undoSpillFile = fs::File(path, fs::File::Mode::Create);
+            if (!this->m_undoSpillFile.isValid()) {
+                log::error("Failed to create undo spill file '{}', dropping oldest undo point instead", hex::toUTF8String(path));
+                return;
+            }
+        }
+
+        auto &file        = this->m_undoSpillFile;
+        const auto &delta = this->m_undoDeltas.front();
+
+        const u64 recordOffset = file.getSize();
+        file.seek(recordOffset);
+
+        spillWrite(file, u64(delta.changes.size()));
+        for (const auto &[address, change] : delta.changes) {
+            spillWrite(file, address);
+            spillWrite(file, u8((change.oldValue.has_value() ? 0b01 : 0b00) | (change.newValue.has_value() ? 0b10 : 0b00)));
+            spillWrite(file, change.oldValue.value_or(0x00));
+            spillWrite(file, change.newValue.value_or(0x00));
+        }
+
+        spillWrite(file, u64(delta.bulkChanges.size()));
+        for (const auto &bulkChange : delta.bulkChanges) {
+            spillWrite(file, bulkChange.offset);
+            spillWrite(file, u64(bulkChange.size));
+            spillSnapshot(file, bulkChange.before);
+            spillSnapshot(file, bulkChange.after);
+        }
+
+        file.flush();
+
+        this->m_undoSpillOffsets.push_back(recordOffset);
+    }
+
+    bool Provider::reloadSpilledUndoDelta() {
+        if (this->m_undoSpillOffsets.empty() || !this->m_undoSpillFile.isValid())
+            return false;
+
+        auto &file = this->m_undoSpillFile;
+        file.seek(this->m_undoSpillOffsets.back());
+
+        UndoDelta delta;
+        const auto parse = [&] {
+            u64 changeCount = 0;
+            if (!spillRead(file, changeCount))
+                return false;
+
+            for (u64 index = 0; index < changeCount; index++) {
+                u64 address = 0;
+                u8 flags = 0, oldValue = 0, newValue = 0;
+                if (!spillRead(file, address) || !spillRead(file, flags) || !spillRead(file, oldValue) || !spillRead(file, newValue))
+                    return false;
+
+                PatchChange change;
+                if (flags & 0b01)
+                    change.oldValue = oldValue;
+                if (flags & 0b10)
+                    change.newValue = newValue;
+
+                delta.changes.emplace(address, change);
+            }
+
+            u64 bulkCount = 0;
+            if (!spillRead(file, bulkCount))
+                return false;
+
+            for (u64 index = 0; index < bulkCount; index++) {
+                auto &bulkChange = delta.bulkChanges.emplace_back();
+
+                u64 size = 0;
+                if (!spillRead(file, bulkChange.offset) || !spillRead(file, size))
+                    return false;
+                bulkChange.size = size;
+
+                if (!unspillSnapshot(file, bulkChange.before) || !unspillSnapshot(file, bulkChange.after))
+                    return false;
+            }
+
+            return true;
+        };
+
+        if (!parse()) {
+            // Skipping over a bad record would undo out of order, so the entire
+            // spilled history below this point has to go
+            log::error("Undo spill file is corrupted, discarding spilled undo history");
+            this->m_undoSpillOffsets.clear();
+            return false;
+        }
+
+        size_t deltaSize = delta.changes.size() * (sizeof(u64) + sizeof(PatchChange));
+        for (const auto &bulkChange : delta.bulkChanges)
+            deltaSize += (bulkChange.before.size() + bulkChange.after.size()) * sizeof(PatchStore::Chunk);
+
+        this->m_undoDeltas.push_front(std::move(delta));
+        this->m_undoDeltaSize += deltaSize;
+        this->m_undoSpillOffsets.pop_back();
+
+        return true;
     }
 
     void Provider::undo() {
-        if (canUndo())
-            this->m_patchTreeOffset++;
+        if (!canUndo())
+            return;
+
+        // Stepping past the in-memory window loads the newest spilled delta back
+        // first, which shifts the current base delta into undoable range
+        if (this->m_patchTreeOffset >= this->m_undoDeltas.size() - 1 && !this->reloadSpilledUndoDelta())
+            return;
+
+        const auto &delta = *std::prev(this->m_undoDeltas.end(), this->m_patchTreeOffset + 1);
+
+        // Bulk changes are rolled back in reverse so overlapping records restore in
+        // the opposite order they were applied
+        for (auto iter = delta.bulkChanges.rbegin(); iter != delta.bulkChanges.rend(); iter++)
+            this->m_patchStore.restoreChunks(iter->offset, iter->size, iter->before);
+
+        for (const auto &[address, change] : delta.changes) {
+            if (change.oldValue.has_value())
+                this->m_patchStore.set(address, *change.oldValue);
+            else
+                this->m_patchStore.erase(address);
+        }
+
+        this->m_patchTreeOffset++;
     }
 
     void Provider::redo() {
-        if (canRedo())
-            this->m_patchTreeOffset--;
+        if (!canRedo())
+            return;
+
+        this->m_patchTreeOffset--;
+
+        const auto &delta = *std::prev(this->m_undoDeltas.end(), this->m_patchTreeOffset + 1);
+        for (const auto &[address, change] : delta.changes) {
+            if (change.newValue.has_value())
+                this->m_patchStore.set(address, *change.newValue);
+            else
+                this->m_patchStore.erase(address);
+        }
+
+        for (const auto &bulkChange : delta.bulkChanges)
+            this->m_patchStore.restoreChunks(bulkChange.offset, bulkChange.size, bulkChange.after);
     }
 
     bool Provider::canUndo() const {
-        return this->m_patchTreeOffset < this->m_patches.size() - 1;
+        return this->m_patchTreeOffset < this->m_undoDeltas.size() - 1 || !this->m_undoSpillOffsets.empty();
     }
 
     bool Provider::canRedo() const {
@@ -248,14 +674,12 @@ namespace hex::prv {
         settings["type"]        = this->getTypeName();
 
         settings["baseAddress"] = this->m_baseAddress;
-        settings["currPage"]    = this->m_currPage;
 
         return settings;
     }
 
     void Provider::loadSettings(const nlohmann::json &settings) {
         this->m_baseAddress = settings["baseAddress"];
-        this->m_currPage    = settings["currPage"];
     }
 
     std::pair<Region, bool> Provider::getRegionValidity(u64 address) const {
@@ -276,7 +700,7 @@ namespace hex::prv {
             }
         }
 
-        for (const auto &[patchAddress, value] : this->m_patches.back()) {
+        for (const auto &[patchAddress, value] : this->m_patchStore) {
             if (!nextRegionAddress.has_value() || patchAddress < nextRegionAddress)
                 nextRegionAddress = patchAddress;
 
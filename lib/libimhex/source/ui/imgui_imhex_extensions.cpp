@@ -10,12 +10,58 @@
 
 #include <string>
 
+#include <mutex>
+#include <unordered_map>
+
 #include <imgui_impl_opengl3_loader.h>
 
 #include <hex/api/imhex_api.hpp>
 
 namespace ImGui {
 
+    namespace {
+
+        ImTextureID uploadTexture(const unsigned char *pixels, int width, int height, GLint filter) {
+            GLuint texture;
+            glGenTextures(1, &texture);
+            glBindTexture(GL_TEXTURE_2D, texture);
+
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
+
+            #if defined(GL_UNPACK_ROW_LENGTH)
+                glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+            #endif
+
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+
+            return reinterpret_cast<ImTextureID>(static_cast<intptr_t>(texture));
+        }
+
+        // Raw decode result of one image waiting for its GPU upload
+        struct StagedImage {
+            std::shared_ptr<Texture> handle;
+            unsigned char *pixels;    // stbi allocation, freed after the upload
+            int width, height;
+            GLint filter;
+        };
+
+        std::mutex s_stagingMutex;
+        std::vector<StagedImage> s_stagingQueue;
+
+        void stageDecodedImage(std::shared_ptr<Texture> handle, unsigned char *pixels, int width, int height, GLint filter) {
+            {
+                std::scoped_lock lock(s_stagingMutex);
+
+                s_stagingQueue.push_back({ std::move(handle), pixels, width, height, filter });
+            }
+
+            // The upload happens on the next frame, so one has to come around
+            hex::ImHexApi::System::markFrameDirty();
+        }
+
+    }
+
     Texture::Texture(const ImU8 *buffer, int size, int width, int height) {
         unsigned char *imageData = stbi_load_from_memory(buffer, size, &this->m_width, &this->m_height, nullptr, 4);
         if (imageData == nullptr) {
@@ -30,21 +76,8 @@ namespace ImGui {
         if (imageData == nullptr)
             return;
 
-        GLuint texture;
-        glGenTextures(1, &texture);
-        glBindTexture(GL_TEXTURE_2D, texture);
-
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-
-        #if defined(GL_UNPACK_ROW_LENGTH)
-            glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
-        #endif
-
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, this->m_width, this->m_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, imageData);
+        this->m_textureId = uploadTexture(imageData, this->m_width, this->m_height, GL_NEAREST);
         stbi_image_free(imageData);
-
-        this->m_textureId = reinterpret_cast<ImTextureID>(static_cast<intptr_t>(texture));
     }
 
     Texture::Texture(const char *path) {
@@ -52,21 +85,63 @@ namespace ImGui {
         if (imageData == nullptr)
             return;
 
-        GLuint texture;
-        glGenTextures(1, &texture);
-        glBindTexture(GL_TEXTURE_2D, texture);
+        this->m_textureId = uploadTexture(imageData, this->m_width, this->m_height, GL_LINEAR);
+        stbi_image_free(imageData);
+    }
 
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    std::shared_ptr<Texture> TextureLoader::loadAsync(std::vector<ImU8> data, int width, int height) {
+        auto handle = std::make_shared<Texture>();
 
-        #if defined(GL_UNPACK_ROW_LENGTH)
-            glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
-        #endif
+        hex::TaskManager::createBackgroundTask("Decoding image", [handle, data = std::move(data), width, height](auto &) {
+            int decodedWidth = 0, decodedHeight = 0;
+            unsigned char *pixels = stbi_load_from_memory(data.data(), int(data.size()), &decodedWidth, &decodedHeight, nullptr, 4);
 
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, this->m_width, this->m_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, imageData);
-        stbi_image_free(imageData);
+            if (pixels == nullptr) {
+                // Not a known image format; with passed dimensions the buffer counts as raw RGBA8
+                if (width * height * 4 > int(data.size()))
+                    return;
+
+                pixels = static_cast<unsigned char*>(STBI_MALLOC(data.size()));
+                std::memcpy(pixels, data.data(), data.size());
+                decodedWidth  = width;
+                decodedHeight = height;
+            }
+            if (pixels == nullptr)
+                return;
+
+            stageDecodedImage(handle, pixels, decodedWidth, decodedHeight, GL_NEAREST);
+        });
 
-        this->m_textureId = reinterpret_cast<ImTextureID>(static_cast<intptr_t>(texture));
+        return handle;
+    }
+
+    std::shared_ptr<Texture> TextureLoader::loadAsync(const std::string &path) {
+        auto handle = std::make_shared<Texture>();
+
+        hex::TaskManager::createBackgroundTask("Decoding image", [handle, path](auto &) {
+            int width = 0, height = 0;
+            unsigned char *pixels = stbi_load(path.c_str(), &width, &height, nullptr, 4);
+            if (pixels == nullptr)
+                return;
+
+            stageDecodedImage(handle, pixels, width, height, GL_LINEAR);
+        });
+
+        return handle;
+    }
+
+    void TextureLoader::processStagingQueue() {
+        std::vector<StagedImage> batch;
+        {
+            std::scoped_lock lock(s_stagingMutex);
+
+            batch.swap(s_stagingQueue);
+        }
+
+        for (auto &staged : batch) {
+            *staged.handle = Texture(uploadTexture(staged.pixels, staged.width, staged.height, staged.filter), staged.width, staged.height);
+            stbi_image_free(staged.pixels);
+        }
     }
 
     Texture::Texture(Texture&& other) noexcept {
@@ -78,6 +153,11 @@ namespace ImGui {
     }
 
     Texture& Texture::operator=(Texture&& other) noexcept {
+        if (this->m_textureId != nullptr) {
+            auto glTextureId = static_cast<GLuint>(reinterpret_cast<intptr_t>(this->m_textureId));
+            glDeleteTextures(1, &glTextureId);
+        }
+
         this->m_textureId = other.m_textureId;
         this->m_width = other.m_width;
         this->m_height = other.m_height;
@@ -569,6 +649,41 @@ namespace ImGui {
         RenderRectFilledRangeH(window->DrawList, bb, GetColorU32(ImGuiCol_PlotHistogram), 0.0f, fraction, style.FrameRounding);
     }
 
+    namespace impl {
+
+        const std::string &GetCachedFormattedText(ImU64 key, const std::function<std::string()> &format) {
+            struct CachedText {
+                std::string text;
+                int lastUsedFrame = 0;
+            };
+
+            // UI thread only, like all other ImGui state
+            static std::unordered_map<ImU64, CachedText> s_cache;
+            static int s_lastSweepFrame = 0;
+
+            const int frame = ImGui::GetFrameCount();
+
+            // Texts that stopped being submitted only hold their memory for a
+            // couple of seconds
+            constexpr static int SweepInterval = 600, RetentionFrames = 120;
+            if (frame - s_lastSweepFrame >= SweepInterval) {
+                s_lastSweepFrame = frame;
+
+                std::erase_if(s_cache, [frame](const auto &entry) {
+                    return frame - entry.second.lastUsedFrame > RetentionFrames;
+                });
+            }
+
+            auto [iter, inserted] = s_cache.try_emplace(key);
+            if (inserted)
+                iter->second.text = format();
+            iter->second.lastUsedFrame = frame;
+
+            return iter->second.text;
+        }
+
+    }
+
     bool InputText(const char *label, std::string &buffer, ImGuiInputTextFlags flags) {
         return ImGui::InputText(label, buffer.data(), buffer.size() + 1, ImGuiInputTextFlags_CallbackResize | flags, ImGui::UpdateStringSizeCallback, &buffer);
     }
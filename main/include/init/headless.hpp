@@ -0,0 +1,20 @@
+#pragma once
+
+#include <hex/helpers/fs.hpp>
+
+namespace hex::init {
+
+    /**
+     * @brief Runs a scripted job list against the application core without ever
+     * creating a window.
+     *
+     * Plugins, providers and the task system are initialized as usual but no
+     * GLFW or OpenGL state is touched, so jobs can run in CI pipelines and on
+     * machines without a display. Each job's wall-clock duration is recorded in
+     * the results so runs double as reproducible performance measurements.
+     *
+     * @return The process exit code; non-zero when any job failed
+     */
+    int runHeadless(const std::fs::path &jobFile);
+
+}
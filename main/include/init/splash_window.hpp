@@ -19,8 +19,8 @@ namespace hex::init {
 
         bool loop();
 
-        void addStartupTask(const std::string &taskName, const TaskFunction &task, bool async) {
-            this->m_tasks.emplace_back(taskName, task, async);
+        void addStartupTask(const std::string &taskName, const TaskFunction &task, const std::vector<std::string> &dependencies) {
+            this->m_tasks.emplace_back(taskName, task, dependencies);
         }
 
     private:
@@ -37,7 +37,7 @@ namespace hex::init {
 
         std::future<bool> processTasksAsync();
 
-        std::vector<std::tuple<std::string, TaskFunction, bool>> m_tasks;
+        std::vector<std::tuple<std::string, TaskFunction, std::vector<std::string>>> m_tasks;
 
         std::string m_gpuVendor;
     };
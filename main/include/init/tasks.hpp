@@ -9,9 +9,13 @@ namespace hex::init {
     struct Task {
         std::string name;
         std::function<bool()> function;
-        bool async;
+
+        // Names of tasks that have to finish before this one may start. Tasks
+        // without unfinished dependencies run concurrently on the splash screen
+        std::vector<std::string> dependencies;
     };
 
     std::vector<Task> getInitTasks();
+    std::vector<Task> getHeadlessInitTasks();
     std::vector<Task> getExitTasks();
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <filesystem>
+#include <future>
 #include <memory>
 #include <string>
 #include <list>
@@ -51,10 +52,12 @@ namespace hex {
         double m_lastFrameTime = 0;
 
         ImGui::Texture m_logoTexture;
+        ImFontAtlas *m_pendingFontAtlas = nullptr;
 
         std::mutex m_popupMutex;
         std::list<std::string> m_popupsToOpen;
         std::vector<int> m_pressedKeys;
+        std::vector<std::future<void>> m_pendingPrepares;
 
         std::fs::path m_imguiSettingsPath;
 
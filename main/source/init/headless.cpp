@@ -0,0 +1,513 @@
+#include "init/headless.hpp"
+#include "init/tasks.hpp"
+
+#include <hex/api/imhex_api.hpp>
+#include <hex/api/task.hpp>
+#include <hex/helpers/crypto.hpp>
+#include <hex/helpers/file.hpp>
+#include <hex/helpers/fmt.hpp>
+#include <hex/helpers/logger.hpp>
+#include <hex/helpers/utils.hpp>
+#include <hex/providers/provider.hpp>
+#include <hex/providers/chunk_pipeline.hpp>
+#include <hex/providers/io_tracer.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace hex::init {
+
+    /*
+        The job file is a JSON document of the following shape:
+
+        {
+            "jobs": [
+                { "action": "open",   "path": "firmware.bin" },
+                { "action": "hash",   "algorithm": "sha256" },
+                { "action": "find",   "pattern": "DE AD BE EF", "limit": 100 },
+                { "action": "entropy", "blockSize": 65536 },
+                { "action": "export", "offset": 0, "size": 256, "path": "header.bin" },
+                { "action": "trace-analyze", "path": "session.ihtrace" },
+                { "action": "replay", "path": "session.ihtrace" }
+            ],
+            "continueOnError": false,
+            "output": "results.json"
+        }
+
+        Jobs run in order against the most recently opened provider. The results,
+        including per-job wall-clock durations, are printed to stdout or written
+        to the configured output file.
+    */
+
+    namespace {
+
+        std::vector<u8> parseBytePattern(const std::string &pattern) {
+            std::string hexString;
+            for (const char c : pattern) {
+                if (std::isspace(c))
+                    continue;
+                if (!std::isxdigit(c))
+                    throw std::runtime_error(hex::format("invalid character '{}' in byte pattern", c));
+
+                hexString += c;
+            }
+
+            if (hexString.empty() || (hexString.size() % 2) != 0)
+                throw std::runtime_error("byte pattern must consist of full bytes");
+
+            std::vector<u8> bytes;
+            for (size_t i = 0; i < hexString.size(); i += 2)
+                bytes.push_back(u8(std::stoul(hexString.substr(i, 2), nullptr, 16)));
+
+            return bytes;
+        }
+
+        prv::Provider *requireProvider() {
+            auto provider = ImHexApi::Provider::get();
+            if (provider == nullptr || !provider->isAvailable() || !provider->isReadable())
+                throw std::runtime_error("no readable provider is open; add an 'open' job first");
+
+            return provider;
+        }
+
+        Region getJobRegion(const nlohmann::json &job, prv::Provider *provider) {
+            const u64 offset = job.value("offset", u64(0));
+            if (offset > provider->getActualSize())
+                throw std::runtime_error("job offset lies past the end of the provider");
+
+            const u64 size = job.value("size", provider->getActualSize() - offset);
+            if (size > provider->getActualSize() - offset)
+                throw std::runtime_error("job region exceeds the size of the provider");
+
+            return { provider->getBaseAddress() + offset, size };
+        }
+
+        std::unique_ptr<crypt::HashStream> createHashStream(const std::string &algorithm) {
+            if (algorithm == "md5")      return crypt::createMd5Stream();
+            if (algorithm == "sha1")     return crypt::createSha1Stream();
+            if (algorithm == "sha224")   return crypt::createSha224Stream();
+            if (algorithm == "sha256")   return crypt::createSha256Stream();
+            if (algorithm == "sha384")   return crypt::createSha384Stream();
+            if (algorithm == "sha512")   return crypt::createSha512Stream();
+            if (algorithm == "xxhash64") return crypt::createXxHash64Stream();
+
+            throw std::runtime_error(hex::format("unknown hash algorithm '{}'", algorithm));
+        }
+
+        nlohmann::json runOpenJob(const nlohmann::json &job) {
+            auto provider = ImHexApi::Provider::createProvider(job.value("provider", "hex.builtin.provider.file"), true);
+            if (provider == nullptr)
+                throw std::runtime_error("provider type is not registered");
+
+            auto settings = job.value("settings", nlohmann::json::object());
+            if (!settings.contains("baseAddress"))
+                settings["baseAddress"] = 0;
+            if (job.contains("path"))
+                settings["path"] = job["path"].get<std::string>();
+
+            provider->loadSettings(settings);
+
+            if (!provider->open() || !provider->isAvailable()) {
+                ImHexApi::Provider::remove(provider);
+                throw std::runtime_error("failed to open provider");
+            }
+
+            return {
+                { "name", provider->getName() },
+                { "size", provider->getActualSize() }
+            };
+        }
+
+        nlohmann::json runHashJob(const nlohmann::json &job) {
+            auto provider = requireProvider();
+            const auto region = getJobRegion(job, provider);
+            const auto algorithm = job.value("algorithm", "sha256");
+
+            auto stream = createHashStream(algorithm);
+
+            prv::ChunkPipeline pipeline(provider, region.address, region.size);
+            pipeline.subscribe([&](u64, const u8 *data, size_t size) {
+                stream->update(data, size);
+            });
+            pipeline.process();
+
+            return {
+                { "algorithm", algorithm },
+                { "digest", crypt::encode16(stream->finish()) }
+            };
+        }
+
+        nlohmann::json runFindJob(const nlohmann::json &job) {
+            auto provider = requireProvider();
+            const auto region = getJobRegion(job, provider);
+            const auto pattern = parseBytePattern(job.at("pattern").get<std::string>());
+            const auto maxMatches = job.value("limit", size_t(1'000));
+
+            std::vector<u64> matches;
+
+            // Tail of the previous chunk, so occurrences spanning a chunk boundary aren't lost
+            std::vector<u8> carry;
+
+            prv::ChunkPipeline pipeline(provider, region.address, region.size);
+            pipeline.subscribe([&](u64 address, const u8 *data, size_t size) {
+                if (matches.size() >= maxMatches)
+                    return;
+
+                if (!carry.empty() && pattern.size() > 1) {
+                    auto boundary = carry;
+                    boundary.insert(boundary.end(), data, data + std::min(size, pattern.size() - 1));
+
+                    for (auto iter = boundary.begin(); (iter = std::search(iter, boundary.end(), pattern.begin(), pattern.end())) != boundary.end(); ++iter) {
+                        // Matches starting inside the current chunk are found by the regular scan below
+                        const auto index = size_t(std::distance(boundary.begin(), iter));
+                        if (index < carry.size() && matches.size() < maxMatches)
+                            matches.push_back((address - carry.size()) + index);
+                    }
+                }
+
+                for (auto iter = data; (iter = std::search(iter, data + size, pattern.begin(), pattern.end())) != data + size; ++iter) {
+                    if (matches.size() >= maxMatches)
+                        break;
+
+                    matches.push_back(address + size_t(std::distance(data, iter)));
+                }
+
+                const auto carrySize = std::min(size, pattern.size() - 1);
+                carry.assign(data + (size - carrySize), data + size);
+            });
+            pipeline.process();
+
+            return {
+                { "matchCount", matches.size() },
+                { "matches", matches }
+            };
+        }
+
+        nlohmann::json runEntropyJob(const nlohmann::json &job) {
+            auto provider = requireProvider();
+            const auto region = getJobRegion(job, provider);
+            const auto blockSize = job.value("blockSize", u64(0x1'0000));
+
+            if (blockSize == 0)
+                throw std::runtime_error("block size must not be zero");
+
+            const auto entropyOf = [](const std::array<u64, 256> &histogram, u64 total) {
+                double entropy = 0.0;
+                for (const auto count : histogram) {
+                    if (count == 0)
+                        continue;
+
+                    const double probability = double(count) / double(total);
+                    entropy -= probability * std::log2(probability);
+                }
+
+                return entropy;
+            };
+
+            std::array<u64, 256> histogram = {}, blockHistogram = {};
+            u64 blockFilled = 0, blockCount = 0;
+            double minBlockEntropy = 8.0, maxBlockEntropy = 0.0;
+
+            const auto finishBlock = [&] {
+                if (blockFilled == 0)
+                    return;
+
+                const auto blockEntropy = entropyOf(blockHistogram, blockFilled);
+                minBlockEntropy = std::min(minBlockEntropy, blockEntropy);
+                maxBlockEntropy = std::max(maxBlockEntropy, blockEntropy);
+                blockCount++;
+
+                blockHistogram = {};
+                blockFilled    = 0;
+            };
+
+            prv::ChunkPipeline pipeline(provider, region.address, region.size);
+            pipeline.subscribe([&](u64, const u8 *data, size_t size) {
+                for (size_t i = 0; i < size; i++) {
+                    histogram[data[i]]++;
+                    blockHistogram[data[i]]++;
+                    blockFilled++;
+
+                    if (blockFilled == blockSize)
+                        finishBlock();
+                }
+            });
+            pipeline.process();
+            finishBlock();
+
+            if (blockCount == 0)
+                minBlockEntropy = maxBlockEntropy = 0.0;
+
+            return {
+                { "entropy", region.size == 0 ? 0.0 : entropyOf(histogram, region.size) },
+                { "blockSize", blockSize },
+                { "blockCount", blockCount },
+                { "minBlockEntropy", minBlockEntropy },
+                { "maxBlockEntropy", maxBlockEntropy }
+            };
+        }
+
+        nlohmann::json runExportJob(const nlohmann::json &job) {
+            auto provider = requireProvider();
+            const auto region = getJobRegion(job, provider);
+            const std::fs::path path = job.at("path").get<std::string>();
+
+            fs::File file(path, fs::File::Mode::Create);
+            if (!file.isValid())
+                throw std::runtime_error(hex::format("failed to create output file '{}'", hex::toUTF8String(path)));
+
+            prv::ChunkPipeline pipeline(provider, region.address, region.size);
+            pipeline.subscribe([&](u64, const u8 *data, size_t size) {
+                file.write(data, size);
+            });
+            pipeline.process();
+
+            return {
+                { "path", hex::toUTF8String(path) },
+                { "size", region.size }
+            };
+        }
+
+        prv::iotrace::Trace loadTraceFile(const nlohmann::json &job) {
+            const std::fs::path path = job.at("path").get<std::string>();
+
+            auto trace = prv::iotrace::load(path);
+            if (!trace.has_value())
+                throw std::runtime_error(hex::format("failed to parse trace file '{}'", hex::toUTF8String(path)));
+
+            return std::move(*trace);
+        }
+
+        nlohmann::json runTraceAnalyzeJob(const nlohmann::json &job) {
+            const auto trace = loadTraceFile(job);
+
+            u64 totalBytes = 0, totalLatencyNs = 0;
+
+            // Exact re-reads of the same (offset, size) range
+            std::map<std::pair<u64, u32>, u64> rangeCounts;
+
+            // Coalesced coverage of all reads, start address to exclusive end
+            std::map<u64, u64> coverage;
+
+            struct TagTotals { u64 reads = 0, bytes = 0, latencyNs = 0; };
+            std::map<u16, TagTotals> tagTotals;
+
+            for (const auto &record : trace.records) {
+                totalBytes     += record.size;
+                totalLatencyNs += record.latencyNs;
+                rangeCounts[{ record.offset, record.size }]++;
+
+                auto &totals = tagTotals[record.tagId];
+                totals.reads++;
+                totals.bytes     += record.size;
+                totals.latencyNs += record.latencyNs;
+
+                u64 start = record.offset, end = record.offset + record.size;
+
+                auto iter = coverage.upper_bound(start);
+                if (iter != coverage.begin() && std::prev(iter)->second >= start)
+                    --iter;
+
+                while (iter != coverage.end() && iter->first <= end) {
+                    start = std::min(start, iter->first);
+                    end   = std::max(end, iter->second);
+                    iter  = coverage.erase(iter);
+                }
+
+                coverage[start] = end;
+            }
+
+            u64 uniqueBytes = 0;
+            for (const auto &[start, end] : coverage)
+                uniqueBytes += end - start;
+
+            u64 duplicateReads = 0;
+            std::vector<std::tuple<u64, u32, u64>> repeatedRanges;
+            for (const auto &[range, count] : rangeCounts) {
+                if (count > 1) {
+                    duplicateReads += count - 1;
+                    repeatedRanges.emplace_back(range.first, range.second, count);
+                }
+            }
+
+            std::sort(repeatedRanges.begin(), repeatedRanges.end(), [](const auto &left, const auto &right) {
+                return std::get<2>(left) > std::get<2>(right);
+            });
+            if (repeatedRanges.size() > 10)
+                repeatedRanges.resize(10);
+
+            auto topRepeated = nlohmann::json::array();
+            for (const auto &[offset, size, count] : repeatedRanges) {
+                topRepeated.push_back({
+                    { "offset", offset },
+                    { "size", size },
+                    { "count", count }
+                });
+            }
+
+            auto tags = nlohmann::json::array();
+            for (const auto &[tagId, totals] : tagTotals) {
+                tags.push_back({
+                    { "name", tagId < trace.tags.size() ? trace.tags[tagId] : "unknown" },
+                    { "reads", totals.reads },
+                    { "bytes", totals.bytes },
+                    { "averageLatencyNs", totals.reads == 0 ? 0 : totals.latencyNs / totals.reads }
+                });
+            }
+
+            return {
+                { "records", trace.records.size() },
+                { "totalBytes", totalBytes },
+                { "uniqueBytes", uniqueBytes },
+                { "reReadBytes", totalBytes - uniqueBytes },
+                { "duplicateReads", duplicateReads },
+                { "averageLatencyNs", trace.records.empty() ? 0 : totalLatencyNs / trace.records.size() },
+                { "topRepeatedRanges", topRepeated },
+                { "tags", tags }
+            };
+        }
+
+        nlohmann::json runReplayJob(const nlohmann::json &job) {
+            auto provider = requireProvider();
+            const auto trace = loadTraceFile(job);
+
+            const u64 providerEnd = provider->getBaseAddress() + provider->getActualSize();
+
+            std::vector<u8> scratch;
+            u64 replayed = 0, skipped = 0, totalBytes = 0;
+
+            for (const auto &record : trace.records) {
+                // Raw records are nested inside the read that caused them, so only
+                // the read layer gets re-issued; everything below follows naturally
+                if (record.kind != u8(prv::iotrace::Kind::Read))
+                    continue;
+
+                if (record.size == 0 || record.offset < provider->getBaseAddress() || record.offset + record.size > providerEnd) {
+                    skipped++;
+                    continue;
+                }
+
+                if (scratch.size() < record.size)
+                    scratch.resize(record.size);
+
+                provider->read(record.offset, scratch.data(), record.size);
+
+                replayed++;
+                totalBytes += record.size;
+            }
+
+            return {
+                { "records", trace.records.size() },
+                { "replayed", replayed },
+                { "skipped", skipped },
+                { "bytes", totalBytes }
+            };
+        }
+
+        nlohmann::json runJob(const nlohmann::json &job) {
+            const auto action = job.value("action", "");
+
+            if (action == "open")          return runOpenJob(job);
+            if (action == "hash")          return runHashJob(job);
+            if (action == "find")          return runFindJob(job);
+            if (action == "entropy")       return runEntropyJob(job);
+            if (action == "export")        return runExportJob(job);
+            if (action == "trace-analyze") return runTraceAnalyzeJob(job);
+            if (action == "replay")        return runReplayJob(job);
+
+            throw std::runtime_error(hex::format("unknown action '{}'", action));
+        }
+
+    }
+
+    int runHeadless(const std::fs::path &jobFile) {
+        log::info("Welcome to ImHex {} running in headless mode!", IMHEX_VERSION);
+
+        TaskManager::init();
+
+        // Headless init doesn't have a splash screen to overlap tasks on, so they
+        // simply run in their listed order, which already satisfies the dependencies
+        for (const auto &[name, task, dependencies] : getHeadlessInitTasks()) {
+            hex::unused(dependencies);
+
+            if (!task()) {
+                log::error("Initialization task '{}' failed", name);
+                TaskManager::exit();
+                return EXIT_FAILURE;
+            }
+        }
+
+        log::enableAsyncMode(true);
+
+        ON_SCOPE_EXIT {
+            for (const auto &[name, task, dependencies] : getExitTasks())
+                task();
+            TaskManager::exit();
+
+            log::enableAsyncMode(false);
+        };
+
+        nlohmann::json jobList;
+        try {
+            jobList = nlohmann::json::parse(fs::File(jobFile, fs::File::Mode::Read).readString());
+        } catch (const std::exception &e) {
+            log::error("Failed to parse job file '{0}': {1}", hex::toUTF8String(jobFile), e.what());
+            return EXIT_FAILURE;
+        }
+
+        auto results = nlohmann::json::array();
+        bool success = true;
+        for (const auto &job : jobList.value("jobs", nlohmann::json::array())) {
+            const auto action = job.value("action", "");
+            const auto startTime = std::chrono::high_resolution_clock::now();
+
+            nlohmann::json result;
+            try {
+                result = runJob(job);
+                result["success"] = true;
+            } catch (const std::exception &e) {
+                result["success"] = false;
+                result["error"]   = e.what();
+                success = false;
+            }
+
+            const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - startTime);
+            result["action"]     = action;
+            result["durationUs"] = duration.count();
+
+            if (result["success"].get<bool>())
+                log::info("Job '{0}' finished after {1}us", action, duration.count());
+            else
+                log::error("Job '{0}' failed after {1}us: {2}", action, duration.count(), result["error"].get<std::string>());
+
+            results.push_back(std::move(result));
+
+            if (!success && !jobList.value("continueOnError", false))
+                break;
+        }
+
+        if (jobList.contains("output")) {
+            const std::fs::path outputPath = jobList["output"].get<std::string>();
+            fs::File outputFile(outputPath, fs::File::Mode::Create);
+            if (outputFile.isValid())
+                outputFile.write(results.dump(4));
+            else
+                log::error("Failed to write results to '{}'", hex::toUTF8String(outputPath));
+        } else {
+            std::printf("%s\n", results.dump(4).c_str());
+        }
+
+        return success ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+}
@@ -19,8 +19,12 @@
 #include <unistd.h>
 
 #include <chrono>
+#include <condition_variable>
 #include <future>
+#include <map>
 #include <numeric>
+#include <optional>
+#include <thread>
 
 using namespace std::literals::chrono_literals;
 
@@ -41,49 +45,125 @@ namespace hex::init {
 
     std::future<bool> WindowSplash::processTasksAsync() {
         return std::async(std::launch::async, [this] {
-            bool status = true;
-
+            std::atomic<bool> status = true;
             std::atomic<u32> tasksCompleted = 0;
-            for (const auto &[name, task, async] : this->m_tasks) {
-                auto runTask = [&, task = task, name = name] {
-                    {
-                        std::lock_guard guard(this->m_progressMutex);
-                        this->m_currTaskName = name;
+
+            enum class TaskState : u8 { Pending, Running, Finished };
+
+            std::mutex schedulerMutex;
+            std::condition_variable schedulerCondition;
+            std::vector<TaskState> states(this->m_tasks.size(), TaskState::Pending);
+
+            std::map<std::string, size_t> taskIndices;
+            for (size_t index = 0; index < this->m_tasks.size(); index++)
+                taskIndices[std::get<0>(this->m_tasks[index])] = index;
+
+            // Scheduler lock held by the caller
+            auto dependenciesFinished = [&](size_t index) {
+                for (const auto &dependency : std::get<2>(this->m_tasks[index])) {
+                    auto iter = taskIndices.find(dependency);
+                    if (iter == taskIndices.end()) {
+                        log::warn("Init task '{}' depends on unknown task '{}'", std::get<0>(this->m_tasks[index]), dependency);
+                        continue;
                     }
 
-                    auto startTime = std::chrono::high_resolution_clock::now();
-                    if (!task())
-                        status = false;
-                    auto endTime = std::chrono::high_resolution_clock::now();
+                    if (states[iter->second] != TaskState::Finished)
+                        return false;
+                }
 
-                    log::info("Task '{}' finished in {} ms", name, std::chrono::duration_cast<std::chrono::milliseconds>(endTime-startTime).count());
+                return true;
+            };
 
-                    tasksCompleted++;
+            auto runTask = [&](size_t index) {
+                const auto &name = std::get<0>(this->m_tasks[index]);
+                const auto &task = std::get<1>(this->m_tasks[index]);
 
-                    this->m_progress = float(tasksCompleted) / this->m_tasks.size();
-                };
+                {
+                    std::lock_guard guard(this->m_progressMutex);
+                    this->m_currTaskName = name;
+                }
 
+                auto startTime = std::chrono::high_resolution_clock::now();
                 try {
-                    if (async) {
-                        TaskManager::createBackgroundTask(name, [runTask](auto&){ runTask(); });
-                    } else {
-                        runTask();
-                    }
-
+                    if (!task())
+                        status = false;
                 } catch (std::exception &e) {
                     log::error("Init task '{}' threw an exception: {}", name, e.what());
                     status = false;
                 }
-            }
+                auto endTime = std::chrono::high_resolution_clock::now();
 
-            while (tasksCompleted < this->m_tasks.size()) {
-                std::this_thread::sleep_for(100ms);
-            }
+                log::info("Task '{}' finished in {} ms", name, std::chrono::duration_cast<std::chrono::milliseconds>(endTime-startTime).count());
+
+                tasksCompleted++;
+
+                this->m_progress = float(tasksCompleted) / this->m_tasks.size();
+            };
+
+            // Every worker picks any task whose dependencies have all finished,
+            // so independent init work overlaps instead of running back to back
+            auto worker = [&] {
+                std::unique_lock lock(schedulerMutex);
+
+                while (true) {
+                    std::optional<size_t> next;
+                    bool anyPending = false, anyRunning = false;
+
+                    for (size_t index = 0; index < states.size(); index++) {
+                        if (states[index] == TaskState::Running)
+                            anyRunning = true;
+
+                        if (states[index] != TaskState::Pending)
+                            continue;
+
+                        anyPending = true;
+                        if (!next.has_value() && dependenciesFinished(index))
+                            next = index;
+                    }
+
+                    if (!next.has_value()) {
+                        if (!anyPending)
+                            break;
+
+                        if (anyRunning) {
+                            // Everything left waits on a task that's still running
+                            schedulerCondition.wait(lock);
+                            continue;
+                        }
+
+                        // Cyclic dependencies; run the first pending task anyway instead of hanging
+                        for (size_t index = 0; index < states.size(); index++) {
+                            if (states[index] == TaskState::Pending) {
+                                log::error("Init task '{}' has cyclic dependencies, running it anyway", std::get<0>(this->m_tasks[index]));
+                                next = index;
+                                break;
+                            }
+                        }
+                    }
+
+                    states[next.value()] = TaskState::Running;
+
+                    lock.unlock();
+                    runTask(next.value());
+                    lock.lock();
+
+                    states[next.value()] = TaskState::Finished;
+                    schedulerCondition.notify_all();
+                }
+            };
+
+            const auto workerCount = std::min<size_t>(std::max<u32>(2, std::thread::hardware_concurrency() / 2), this->m_tasks.size());
+
+            std::vector<std::thread> workers;
+            for (size_t index = 0; index < workerCount; index++)
+                workers.emplace_back(worker);
+            for (auto &workerThread : workers)
+                workerThread.join();
 
             // Small extra delay so the last progress step is visible
             std::this_thread::sleep_for(100ms);
 
-            return status;
+            return status.load();
         });
     }
 
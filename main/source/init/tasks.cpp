@@ -4,9 +4,12 @@
 #include <imgui_freetype.h>
 
 #include <hex/api/content_registry.hpp>
+#include <hex/api/event.hpp>
 #include <hex/api/project_file_manager.hpp>
+#include <hex/api/task.hpp>
 #include <hex/ui/view.hpp>
 #include <hex/helpers/net.hpp>
+#include <hex/helpers/file.hpp>
 #include <hex/helpers/fs.hpp>
 #include <hex/helpers/logger.hpp>
 
@@ -16,6 +19,7 @@
 
 #include <hex/api/plugin_manager.hpp>
 
+#include <cstring>
 #include <filesystem>
 
 #include <nlohmann/json.hpp>
@@ -78,20 +82,251 @@ namespace hex::init {
         return result;
     }
 
-    bool loadFonts() {
+    constexpr u32 FontAtlasCacheMagic   = 0x41'46'48'49;    // "IHFA"
+    constexpr u32 FontAtlasCacheVersion = 1;
+
+    static std::vector<u8> buildFontAtlasCacheKey(const std::fs::path &fontFile, float fontSize, bool enableUnicode, bool extendedRanges) {
+        std::vector<u8> key;
+
+        auto append = [&key](const void *data, size_t size) {
+            const auto bytes = static_cast<const u8 *>(data);
+            key.insert(key.end(), bytes, bytes + size);
+        };
+
+        // The baked glyph data is only valid as long as everything that went into
+        // Build() is unchanged: the font set and size, the ImGui version that
+        // rasterized it and the glyph layout it was compiled with
+        const std::string imguiVersion = IMGUI_VERSION;
+        append(imguiVersion.data(), imguiVersion.size());
+        append(&fontSize, sizeof(fontSize));
+        append(&enableUnicode, sizeof(enableUnicode));
+        append(&extendedRanges, sizeof(extendedRanges));
+
+        const u64 glyphSize = sizeof(ImFontGlyph);
+        append(&glyphSize, sizeof(glyphSize));
+
+        const auto fontPath = hex::toUTF8String(fontFile);
+        append(fontPath.data(), fontPath.size());
+        if (!fontFile.empty()) {
+            u64 fontFileSize = 0;
+            if (auto file = fs::File(fontFile, fs::File::Mode::Read); file.isValid())
+                fontFileSize = file.getSize();
+            append(&fontFileSize, sizeof(fontFileSize));
+        }
+
+        return key;
+    }
+
+    static bool loadFontAtlasFromCache(ImFontAtlas *fonts, const char *cacheFile, const std::vector<u8> &cacheKey) {
+        std::vector<u8> data;
+        for (const auto &path : fs::getDefaultPaths(fs::ImHexPath::Config)) {
+            if (auto file = fs::File(path / cacheFile, fs::File::Mode::Read); file.isValid()) {
+                data = file.readBytes();
+                break;
+            }
+        }
+
+        if (data.empty())
+            return false;
+
+        size_t offset = 0;
+        auto read = [&](void *dst, size_t size) {
+            if (offset + size > data.size())
+                return false;
+
+            std::memcpy(dst, data.data() + offset, size);
+            offset += size;
+            return true;
+        };
+
+        u32 magic = 0, version = 0;
+        if (!read(&magic, sizeof(magic)) || magic != FontAtlasCacheMagic)
+            return false;
+        if (!read(&version, sizeof(version)) || version != FontAtlasCacheVersion)
+            return false;
+
+        u64 keySize = 0;
+        if (!read(&keySize, sizeof(keySize)) || keySize != cacheKey.size())
+            return false;
+        if (offset + keySize > data.size() || std::memcmp(data.data() + offset, cacheKey.data(), keySize) != 0)
+            return false;
+        offset += keySize;
+
+        u8 bytesPerPixel = 0;
+        i32 texWidth = 0, texHeight = 0;
+        ImVec2 uvScale, uvWhitePixel;
+        if (!read(&bytesPerPixel, sizeof(bytesPerPixel)) || (bytesPerPixel != 1 && bytesPerPixel != 4))
+            return false;
+        if (!read(&texWidth, sizeof(texWidth)) || !read(&texHeight, sizeof(texHeight)) || texWidth <= 0 || texHeight <= 0)
+            return false;
+        if (!read(&uvScale, sizeof(uvScale)) || !read(&uvWhitePixel, sizeof(uvWhitePixel)))
+            return false;
+
+        ImVec4 uvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];
+        if (!read(uvLines, sizeof(uvLines)))
+            return false;
+
+        const u64 pixelCount = u64(texWidth) * u64(texHeight) * bytesPerPixel;
+        if (offset + pixelCount > data.size())
+            return false;
+        const auto pixelData = data.data() + offset;
+        offset += pixelCount;
+
+        struct CachedFont {
+            float fontSize, scale, ascent, descent;
+            ImWchar fallbackChar, ellipsisChar, dotChar;
+            std::vector<ImFontGlyph> glyphs;
+        };
+
+        u32 fontCount = 0;
+        if (!read(&fontCount, sizeof(fontCount)) || fontCount == 0 || fontCount > 0x100)
+            return false;
+
+        // Parse everything into temporaries first so a truncated or corrupted
+        // file never leaves a half-initialized atlas behind
+        std::vector<CachedFont> cachedFonts(fontCount);
+        for (auto &font : cachedFonts) {
+            if (!read(&font.fontSize, sizeof(font.fontSize)) || !read(&font.scale, sizeof(font.scale)))
+                return false;
+            if (!read(&font.ascent, sizeof(font.ascent)) || !read(&font.descent, sizeof(font.descent)))
+                return false;
+            if (!read(&font.fallbackChar, sizeof(font.fallbackChar)) || !read(&font.ellipsisChar, sizeof(font.ellipsisChar)) || !read(&font.dotChar, sizeof(font.dotChar)))
+                return false;
+
+            u32 glyphCount = 0;
+            if (!read(&glyphCount, sizeof(glyphCount)) || glyphCount == 0 || glyphCount > 0x10'0000)
+                return false;
+
+            font.glyphs.resize(glyphCount);
+            if (!read(font.glyphs.data(), glyphCount * sizeof(ImFontGlyph)))
+                return false;
+        }
+
+        auto pixels = static_cast<u8 *>(IM_ALLOC(pixelCount));
+        std::memcpy(pixels, pixelData, pixelCount);
+        if (bytesPerPixel == 1) {
+            fonts->TexPixelsAlpha8 = pixels;
+        } else {
+            fonts->TexPixelsRGBA32    = reinterpret_cast<unsigned int *>(pixels);
+            fonts->TexPixelsUseColors = true;
+        }
+
+        fonts->TexWidth        = texWidth;
+        fonts->TexHeight       = texHeight;
+        fonts->TexUvScale      = uvScale;
+        fonts->TexUvWhitePixel = uvWhitePixel;
+        std::copy(std::begin(uvLines), std::end(uvLines), fonts->TexUvLines);
+
+        for (const auto &cachedFont : cachedFonts) {
+            auto font            = IM_NEW(ImFont)();
+            font->ContainerAtlas = fonts;
+            font->FontSize       = cachedFont.fontSize;
+            font->Scale          = cachedFont.scale;
+            font->Ascent         = cachedFont.ascent;
+            font->Descent        = cachedFont.descent;
+            font->FallbackChar   = cachedFont.fallbackChar;
+            font->EllipsisChar   = cachedFont.ellipsisChar;
+            font->DotChar        = cachedFont.dotChar;
+
+            font->Glyphs.resize(cachedFont.glyphs.size());
+            std::copy(cachedFont.glyphs.begin(), cachedFont.glyphs.end(), font->Glyphs.Data);
+
+            // The index tables, fallback glyph and 4K page map all derive from
+            // the glyph list, so they get rebuilt instead of being cached
+            font->DirtyLookupTables = true;
+            font->BuildLookupTable();
+
+            fonts->Fonts.push_back(font);
+        }
+
+        // The mouse cursor rects aren't part of the cache; the backends draw
+        // system cursors so the software fallback is never needed
+        fonts->Flags |= ImFontAtlasFlags_NoMouseCursors;
+        fonts->TexReady = true;
+
+        return true;
+    }
+
+    static void storeFontAtlasCache(ImFontAtlas *fonts, const char *cacheFile, const std::vector<u8> &cacheKey) {
+        const u8 bytesPerPixel = fonts->TexPixelsAlpha8 != nullptr ? 1 : 4;
+        const auto pixels      = bytesPerPixel == 1 ? fonts->TexPixelsAlpha8 : reinterpret_cast<u8 *>(fonts->TexPixelsRGBA32);
+        if (pixels == nullptr)
+            return;
+
+        std::vector<u8> data;
+        auto write = [&data](const void *src, size_t size) {
+            const auto bytes = static_cast<const u8 *>(src);
+            data.insert(data.end(), bytes, bytes + size);
+        };
+
+        write(&FontAtlasCacheMagic, sizeof(FontAtlasCacheMagic));
+        write(&FontAtlasCacheVersion, sizeof(FontAtlasCacheVersion));
+
+        const u64 keySize = cacheKey.size();
+        write(&keySize, sizeof(keySize));
+        write(cacheKey.data(), keySize);
+
+        write(&bytesPerPixel, sizeof(bytesPerPixel));
+        write(&fonts->TexWidth, sizeof(fonts->TexWidth));
+        write(&fonts->TexHeight, sizeof(fonts->TexHeight));
+        write(&fonts->TexUvScale, sizeof(fonts->TexUvScale));
+        write(&fonts->TexUvWhitePixel, sizeof(fonts->TexUvWhitePixel));
+        write(fonts->TexUvLines, sizeof(fonts->TexUvLines));
+        write(pixels, u64(fonts->TexWidth) * u64(fonts->TexHeight) * bytesPerPixel);
+
+        const u32 fontCount = fonts->Fonts.Size;
+        write(&fontCount, sizeof(fontCount));
+
+        for (const auto *font : fonts->Fonts) {
+            write(&font->FontSize, sizeof(font->FontSize));
+            write(&font->Scale, sizeof(font->Scale));
+            write(&font->Ascent, sizeof(font->Ascent));
+            write(&font->Descent, sizeof(font->Descent));
+            write(&font->FallbackChar, sizeof(font->FallbackChar));
+            write(&font->EllipsisChar, sizeof(font->EllipsisChar));
+            write(&font->DotChar, sizeof(font->DotChar));
+
+            const u32 glyphCount = font->Glyphs.Size;
+            write(&glyphCount, sizeof(glyphCount));
+            write(font->Glyphs.Data, glyphCount * sizeof(ImFontGlyph));
+        }
+
+        for (const auto &path : fs::getDefaultPaths(fs::ImHexPath::Config)) {
+            if (auto file = fs::File(path / cacheFile, fs::File::Mode::Create); file.isValid()) {
+                file.write(data);
+                break;
+            }
+        }
+    }
+
+    static ImFontAtlas *buildFontAtlas(bool extendedRanges) {
         auto fonts       = IM_NEW(ImFontAtlas)();
         ImFontConfig cfg = {};
 
+        const auto &fontFile = ImHexApi::System::getCustomFontPath();
+        float fontSize       = ImHexApi::System::getFontSize();
+        bool enableUnicode   = ContentRegistry::Settings::read("hex.builtin.setting.general", "hex.builtin.setting.general.enable_unicode", true);
+
+        // Rasterizing unifont and the icon fonts over their large glyph ranges
+        // dominates the build time, so the baked atlas is cached on disk and
+        // reused as long as the font inputs stay the same
+        const auto cacheFile = extendedRanges ? "font_atlas_ext.cache" : "font_atlas.cache";
+        const auto cacheKey  = buildFontAtlasCacheKey(fontFile, fontSize, enableUnicode, extendedRanges);
+        if (loadFontAtlasFromCache(fonts, cacheFile, cacheKey))
+            return fonts;
+
         ImVector<ImWchar> ranges;
         {
             ImFontGlyphRangesBuilder glyphRangesBuilder;
             glyphRangesBuilder.AddRanges(fonts->GetGlyphRangesDefault());
-            glyphRangesBuilder.AddRanges(fonts->GetGlyphRangesJapanese());
-            glyphRangesBuilder.AddRanges(fonts->GetGlyphRangesChineseFull());
-            glyphRangesBuilder.AddRanges(fonts->GetGlyphRangesCyrillic());
-            glyphRangesBuilder.AddRanges(fonts->GetGlyphRangesKorean());
-            glyphRangesBuilder.AddRanges(fonts->GetGlyphRangesThai());
-            glyphRangesBuilder.AddRanges(fonts->GetGlyphRangesVietnamese());
+            if (extendedRanges) {
+                glyphRangesBuilder.AddRanges(fonts->GetGlyphRangesJapanese());
+                glyphRangesBuilder.AddRanges(fonts->GetGlyphRangesChineseFull());
+                glyphRangesBuilder.AddRanges(fonts->GetGlyphRangesCyrillic());
+                glyphRangesBuilder.AddRanges(fonts->GetGlyphRangesKorean());
+                glyphRangesBuilder.AddRanges(fonts->GetGlyphRangesThai());
+                glyphRangesBuilder.AddRanges(fonts->GetGlyphRangesVietnamese());
+            }
             glyphRangesBuilder.BuildRanges(&ranges);
         }
 
@@ -107,8 +342,6 @@ namespace hex::init {
             0x0100, 0xFFF0, 0
         };
 
-        const auto &fontFile = ImHexApi::System::getCustomFontPath();
-        float fontSize = ImHexApi::System::getFontSize();
         if (fontFile.empty()) {
             // Load default font if no custom one has been specified
 
@@ -131,14 +364,38 @@ namespace hex::init {
         fonts->AddFontFromMemoryCompressedTTF(font_awesome_compressed_data, font_awesome_compressed_size, fontSize, &cfg, fontAwesomeRange);
         fonts->AddFontFromMemoryCompressedTTF(codicons_compressed_data, codicons_compressed_size, fontSize, &cfg, codiconsRange);
 
-        bool enableUnicode = ContentRegistry::Settings::read("hex.builtin.setting.general", "hex.builtin.setting.general.enable_unicode", true);
-        if (enableUnicode)
+        if (extendedRanges && enableUnicode)
             fonts->AddFontFromMemoryCompressedTTF(unifont_compressed_data, unifont_compressed_size, fontSize, &cfg, unifontRange);
 
         fonts->Build();
 
+        storeFontAtlasCache(fonts, cacheFile, cacheKey);
+
+        return fonts;
+    }
+
+    bool loadFonts() {
+        // Only the Latin set and the icon fonts are needed to put the first frame
+        // on screen, so they get built eagerly while the full unicode coverage is
+        // rasterized in the background and swapped in between frames once ready
+        auto fonts = buildFontAtlas(false);
+
         View::setFontAtlas(fonts);
-        View::setFontConfig(cfg);
+        View::setFontConfig(ImFontConfig {});
+
+        const bool wantsExtendedRanges =
+            !ImHexApi::System::getCustomFontPath().empty() ||
+            ContentRegistry::Settings::read("hex.builtin.setting.general", "hex.builtin.setting.general.enable_unicode", true);
+
+        if (wantsExtendedRanges) {
+            TaskManager::createBackgroundTask("hex.builtin.common.processing", [](auto &) {
+                auto extendedFonts = buildFontAtlas(true);
+
+                TaskManager::doLater([extendedFonts] {
+                    EventManager::post<RequestSwapFontAtlas>(extendedFonts);
+                });
+            });
+        }
 
         return true;
     }
@@ -302,20 +559,33 @@ namespace hex::init {
     }
 
     std::vector<Task> getInitTasks() {
+        // Settings need the config directory, plugins register their settings
+        // entries and fonts read the font settings; the update check only talks
+        // to the network. Everything else is free to overlap
+        return {
+            { "Creating directories",    createDirectories,   { } },
+            { "Loading settings",        loadSettings,        { "Creating directories" } },
+            { "Loading plugins",         loadPlugins,         { "Creating directories", "Loading settings" } },
+            { "Checking for updates",    checkForUpdates,     { } },
+            { "Loading fonts",           loadFonts,           { "Loading settings" } },
+        };
+    }
+
+    std::vector<Task> getHeadlessInitTasks() {
+        // Without a window there are no fonts to bake and no update notification to show
         return {
-            { "Creating directories",    createDirectories,   false },
-            { "Loading settings",        loadSettings,        false },
-            { "Loading plugins",         loadPlugins,         false },
-            { "Checking for updates",    checkForUpdates,     true  },
-            { "Loading fonts",           loadFonts,           true  },
+            { "Creating directories",    createDirectories,   { } },
+            { "Loading settings",        loadSettings,        { "Creating directories" } },
+            { "Loading plugins",         loadPlugins,         { "Creating directories", "Loading settings" } },
         };
     }
 
     std::vector<Task> getExitTasks() {
+        // Exit tasks always run sequentially in the order they are listed in
         return {
-            { "Saving settings...",         storeSettings,    false },
-            { "Cleaning up shared data...", deleteSharedData, false },
-            { "Unloading plugins...",       unloadPlugins,    false },
+            { "Saving settings...",         storeSettings,    { } },
+            { "Cleaning up shared data...", deleteSharedData, { } },
+            { "Unloading plugins...",       unloadPlugins,    { } },
         };
     }
 
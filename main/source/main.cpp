@@ -5,6 +5,7 @@
 
 #include "window.hpp"
 
+#include "init/headless.hpp"
 #include "init/splash_window.hpp"
 #include "init/tasks.hpp"
 
@@ -14,6 +15,19 @@ int main(int argc, char **argv, char **envp) {
     using namespace hex;
     ImHexApi::System::impl::setProgramArguments(argc, argv, envp);
 
+    // Headless batch mode runs a scripted job list and never creates a window
+    for (auto i = 1; i < argc; i++) {
+        if (auto argument = ImHexApi::System::getProgramArgument(i); argument == u8"--headless") {
+            if (auto jobFile = ImHexApi::System::getProgramArgument(i + 1); jobFile.has_value()) {
+                Window::initNative();
+                return init::runHeadless(jobFile.value());
+            }
+
+            log::error("--headless requires a job file argument");
+            return EXIT_FAILURE;
+        }
+    }
+
 #if defined(OS_WINDOWS)
     ImHexApi::System::impl::setBorderlessWindowMode(true);
 #endif
@@ -33,18 +47,22 @@ int main(int argc, char **argv, char **envp) {
             init::WindowSplash splashWindow;
 
             TaskManager::init();
-            for (const auto &[name, task, async] : init::getInitTasks())
-                splashWindow.addStartupTask(name, task, async);
+            for (const auto &[name, task, dependencies] : init::getInitTasks())
+                splashWindow.addStartupTask(name, task, dependencies);
 
             if (!splashWindow.loop())
                 ImHexApi::System::getInitArguments().insert({ "tasks-failed", {} });
         }
 
+        log::enableAsyncMode(true);
+
         // Clean up
         ON_SCOPE_EXIT {
-            for (const auto &[name, task, async] : init::getExitTasks())
+            for (const auto &[name, task, dependencies] : init::getExitTasks())
                 task();
             TaskManager::exit();
+
+            log::enableAsyncMode(false);
         };
 
         // Main window
@@ -7,13 +7,20 @@
 #include <hex/api/imhex_api.hpp>
 
 #include <hex/helpers/utils.hpp>
+#include <hex/helpers/fmt.hpp>
 #include <hex/helpers/fs.hpp>
+#include <hex/helpers/memory_tracker.hpp>
 #include <hex/helpers/logger.hpp>
+#include <hex/providers/frame_read_cache.hpp>
+#include <hex/providers/io_tracer.hpp>
 #include <fmt/printf.h>
 
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <csignal>
 #include <iostream>
+#include <map>
 #include <set>
 #include <thread>
 #include <cassert>
@@ -155,6 +162,31 @@ namespace hex {
             this->m_popupsToOpen.push_back(name);
         });
 
+        EventManager::subscribe<RequestSwapFontAtlas>(this, [this](ImFontAtlas *atlas) {
+            // The swap happens at the start of the next frame; draw lists of the
+            // current one still reference glyphs of the old atlas
+            if (this->m_pendingFontAtlas != nullptr)
+                IM_DELETE(this->m_pendingFontAtlas);
+
+            this->m_pendingFontAtlas = atlas;
+        });
+
+        // Data and highlighting changes alter visible content without any input
+        // event, so they count as frame damage for the idle pacing in loop()
+        EventManager::subscribe<EventRegionDirtied>(this, [](prv::Provider *provider, const Region &) {
+            prv::readcache::invalidate(provider);
+
+            ImHexApi::System::markFrameDirty();
+        });
+
+        EventManager::subscribe<EventProviderDeleted>(this, [](prv::Provider *provider) {
+            prv::readcache::invalidate(provider);
+        });
+
+        EventManager::subscribe<EventHighlightingChanged>(this, [] {
+            ImHexApi::System::markFrameDirty();
+        });
+
         #define HANDLE_SIGNAL(name) \
 		std::signal(name, [](int signalNumber){ \
             signalHandler(signalNumber, #name); \
@@ -166,26 +198,35 @@ namespace hex {
         #undef HANDLE_SIGNAL
         std::set_terminate([]{ signalHandler(SIGABRT, "Unhandled C++ exception"); });
 
-        auto logoData      = romfs::get("logo.png");
-        this->m_logoTexture = ImGui::Texture(reinterpret_cast<const ImU8 *>(logoData.data()), logoData.size());
-
         ContentRegistry::Settings::store();
         EventManager::post<EventSettingsChanged>();
         EventManager::post<EventWindowInitialized>();
+
+        // Registrations plugins chose to defer run once the first frame is up
+        TaskManager::doLater([] {
+            PluginManager::runDeferredInitializations();
+        });
     }
 
     Window::~Window() {
         EventManager::unsubscribe<EventProviderDeleted>(this);
         EventManager::unsubscribe<RequestCloseImHex>(this);
+        EventManager::unsubscribe<EventRegionDirtied>(this);
+        EventManager::unsubscribe<EventHighlightingChanged>(this);
         EventManager::unsubscribe<RequestChangeWindowTitle>(this);
         EventManager::unsubscribe<EventAbnormalTermination>(this);
         EventManager::unsubscribe<RequestOpenPopup>(this);
+        EventManager::unsubscribe<RequestSwapFontAtlas>(this);
 
         this->exitImGui();
         this->exitGLFW();
     }
 
     void Window::loop() {
+        // Redraw rate while fully idle; anything the dirty tracking misses
+        // still shows up within this interval
+        constexpr static double IdleHeartbeatInterval = 1.0;
+
         this->m_lastFrameTime = glfwGetTime();
         while (!glfwWindowShouldClose(this->m_window)) {
             if (!glfwGetWindowAttrib(this->m_window, GLFW_VISIBLE) || glfwGetWindowAttrib(this->m_window, GLFW_ICONIFIED)) {
@@ -205,8 +246,14 @@ namespace hex {
                         this->m_frameRateTemporarilyUnlocked = true;
                         this->m_frameRateUnlockTime = this->m_lastFrameTime;
                     }
-                } else {
+                } else if (ImHexApi::System::impl::takeFrameDirty()) {
+                    // A view or background thread declared changed state, so
+                    // redraw at the capped background rate
                     glfwWaitEventsTimeout(timeout);
+                } else {
+                    // Nothing changed: block on events with a low-rate heartbeat.
+                    // Input, dirty marks and deferred calls all end the wait early
+                    glfwWaitEventsTimeout(IdleHeartbeatInterval);
                 }
             }
 
@@ -229,6 +276,47 @@ namespace hex {
 
     void Window::frameBegin() {
 
+        // Prepare phases scheduled at the end of the previous frame have to be
+        // done before any view draws; see View::prepare()
+        for (auto &future : this->m_pendingPrepares)
+            future.wait();
+        this->m_pendingPrepares.clear();
+
+        // Upload asynchronously decoded images while the GL context is idle
+        ImGui::TextureLoader::processStagingQueue();
+
+        if (this->m_pendingFontAtlas != nullptr) {
+            // A freshly built font atlas finished in the background. Between two
+            // frames no draw list references the old glyph data anymore, so this
+            // is the only safe point to upload the new texture and swap it in
+            auto &io      = ImGui::GetIO();
+            auto oldAtlas = io.Fonts;
+
+            GLsizei width, height;
+            u8 *fontData;
+
+            this->m_pendingFontAtlas->GetTexDataAsRGBA32(&fontData, &width, &height);
+
+            GLuint tex;
+            glGenTextures(1, &tex);
+            glBindTexture(GL_TEXTURE_2D, tex);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA8, GL_UNSIGNED_INT, fontData);
+            this->m_pendingFontAtlas->SetTexID(reinterpret_cast<ImTextureID>(tex));
+
+            io.Fonts = this->m_pendingFontAtlas;
+            View::setFontAtlas(this->m_pendingFontAtlas);
+            this->m_pendingFontAtlas = nullptr;
+
+            if (oldAtlas != nullptr) {
+                if (auto oldTex = GLuint(reinterpret_cast<intptr_t>(oldAtlas->TexID)); oldTex != 0)
+                    glDeleteTextures(1, &oldTex);
+
+                IM_DELETE(oldAtlas);
+            }
+        }
+
         ImGui_ImplOpenGL3_NewFrame();
         ImGui_ImplGlfw_NewFrame();
         ImGui::NewFrame();
@@ -325,6 +413,12 @@ namespace hex {
             if (ImGui::BeginMainMenuBar()) {
 
                 if (ImHexApi::System::isBorderlessWindowModeEnabled()) {
+                    // Only borderless window mode ever draws the logo, so it's decoded on first use
+                    if (!this->m_logoTexture.isValid()) {
+                        auto logoData       = romfs::get("logo.png");
+                        this->m_logoTexture = ImGui::Texture(reinterpret_cast<const ImU8 *>(logoData.data()), logoData.size());
+                    }
+
                     auto menuBarHeight = ImGui::GetCurrentWindow()->MenuBarHeight();
                     ImGui::SetCursorPosX(5);
                     ImGui::Image(this->m_logoTexture, ImVec2(menuBarHeight, menuBarHeight));
@@ -449,15 +543,201 @@ namespace hex {
         }
 
         TaskManager::runDeferredCalls();
+        EventManager::drainDeferred();
 
         EventManager::post<EventFrameBegin>();
     }
 
+    namespace {
+
+        /* Per-view frame profiler. Records every view's draw time into a
+           rolling sample window and shows an overlay listing the views by
+           frame cost, together with a flame-style breakdown of the worst
+           frame seen so far. Toggled with F10 */
+
+        struct ViewProfile {
+            // Milliseconds per frame, ring buffer over the most recent frames
+            std::array<float, 120> samples = {};
+            size_t nextSample = 0;
+            float peak = 0.0F;
+
+            [[nodiscard]] float average() const {
+                float sum = 0.0F;
+                for (const auto sample : this->samples)
+                    sum += sample;
+
+                return sum / this->samples.size();
+            }
+        };
+
+        std::map<std::string, ViewProfile> s_viewProfiles;
+        std::vector<std::pair<std::string, float>> s_worstFrame;
+        float s_worstFrameTotal = 0.0F;
+        bool s_profilerEnabled  = false;
+
+        void recordViewTimings(const std::vector<std::pair<std::string, float>> &frame) {
+            float total = 0.0F;
+            for (const auto &[name, milliseconds] : frame) {
+                auto &profile = s_viewProfiles[name];
+                profile.samples[profile.nextSample] = milliseconds;
+                profile.nextSample = (profile.nextSample + 1) % profile.samples.size();
+                profile.peak = std::max(profile.peak, milliseconds);
+
+                total += milliseconds;
+            }
+
+            if (total > s_worstFrameTotal) {
+                s_worstFrameTotal = total;
+                s_worstFrame      = frame;
+            }
+        }
+
+        void drawProfilerOverlay() {
+            if (!s_profilerEnabled)
+                return;
+
+            ImGui::SetNextWindowBgAlpha(0.8F);
+            if (ImGui::Begin("View Profiler", &s_profilerEnabled, ImGuiWindowFlags_AlwaysAutoResize)) {
+                // Most expensive views first
+                std::vector<const std::pair<const std::string, ViewProfile> *> profiles;
+                for (const auto &entry : s_viewProfiles)
+                    profiles.push_back(&entry);
+                std::sort(profiles.begin(), profiles.end(), [](const auto *left, const auto *right) {
+                    return left->second.average() > right->second.average();
+                });
+
+                if (ImGui::BeginTable("views", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingStretchProp)) {
+                    ImGui::TableSetupColumn("View");
+                    ImGui::TableSetupColumn("Avg");
+                    ImGui::TableSetupColumn("Peak");
+                    ImGui::TableSetupColumn("History");
+                    ImGui::TableHeadersRow();
+
+                    for (const auto *entry : profiles) {
+                        const auto &[name, profile] = *entry;
+
+                        ImGui::TableNextRow();
+                        ImGui::TableNextColumn();
+                        ImGui::TextUnformatted(name.c_str());
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%6.2f ms", profile.average());
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%6.2f ms", profile.peak);
+                        ImGui::TableNextColumn();
+                        ImGui::PlotHistogram(hex::format("##history_{}", name).c_str(), profile.samples.data(), int(profile.samples.size()), int(profile.nextSample), nullptr, 0.0F, FLT_MAX, ImVec2(150, ImGui::GetTextLineHeight()));
+                    }
+
+                    ImGui::EndTable();
+                }
+
+                ImGui::Separator();
+                ImGui::Text("Worst frame: %.2f ms", s_worstFrameTotal);
+
+                // Flame-style breakdown: one colored segment per view, widths
+                // proportional to its share of the worst frame
+                if (s_worstFrameTotal > 0.0F) {
+                    const auto width  = std::max(ImGui::GetContentRegionAvail().x, 300.0F);
+                    const auto height = ImGui::GetTextLineHeight() * 1.5F;
+                    const auto cursor = ImGui::GetCursorScreenPos();
+                    auto drawList     = ImGui::GetWindowDrawList();
+
+                    float x = 0.0F;
+                    for (const auto &[name, milliseconds] : s_worstFrame) {
+                        const float segment = (milliseconds / s_worstFrameTotal) * width;
+                        const auto color    = ImColor::HSV(float(std::hash<std::string>{}(name) % 360) / 360.0F, 0.6F, 0.8F);
+
+                        drawList->AddRectFilled({ cursor.x + x, cursor.y }, { cursor.x + x + segment - 1.0F, cursor.y + height }, color);
+
+                        if (ImGui::IsMouseHoveringRect({ cursor.x + x, cursor.y }, { cursor.x + x + segment, cursor.y + height }))
+                            ImGui::SetTooltip("%s: %.2f ms", name.c_str(), milliseconds);
+
+                        x += segment;
+                    }
+
+                    ImGui::Dummy({ width, height });
+                }
+
+                if (ImGui::Button("Reset")) {
+                    s_viewProfiles.clear();
+                    s_worstFrame.clear();
+                    s_worstFrameTotal = 0.0F;
+                }
+
+                ImGui::Separator();
+
+                // Live allocation tracking, one row per subsystem tag
+                ImGui::TextUnformatted("Memory");
+                if (ImGui::BeginTable("memory", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingStretchProp)) {
+                    ImGui::TableSetupColumn("Tag");
+                    ImGui::TableSetupColumn("Bytes");
+                    ImGui::TableSetupColumn("Allocations");
+                    ImGui::TableSetupColumn("Peak");
+                    ImGui::TableHeadersRow();
+
+                    for (const auto &tag : mem::snapshot()) {
+                        ImGui::TableNextRow();
+                        ImGui::TableNextColumn();
+                        ImGui::TextUnformatted(tag.name.c_str());
+                        ImGui::TableNextColumn();
+                        ImGui::TextUnformatted(hex::toByteString(tag.bytes).c_str());
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%llu", static_cast<unsigned long long>(tag.allocations));
+                        ImGui::TableNextColumn();
+                        ImGui::TextUnformatted(hex::toByteString(tag.peakBytes).c_str());
+                    }
+
+                    ImGui::EndTable();
+                }
+
+                ImGui::Separator();
+
+                // Provider read-stream tracing; dumps feed the trace-analyze and
+                // replay jobs of the headless mode
+                ImGui::TextUnformatted("I/O trace");
+
+                if (prv::iotrace::isEnabled()) {
+                    if (ImGui::Button("Stop"))
+                        prv::iotrace::setEnabled(false);
+                } else {
+                    if (ImGui::Button("Start"))
+                        prv::iotrace::setEnabled(true);
+                }
+
+                ImGui::SameLine();
+                if (ImGui::Button("Dump")) {
+                    fs::openFileBrowser(fs::DialogMode::Save, { { "I/O trace", "ihtrace" } }, [](const auto &path) {
+                        if (!prv::iotrace::dump(path))
+                            log::error("Failed to write I/O trace to '{}'", hex::toUTF8String(path));
+                    });
+                }
+
+                ImGui::SameLine();
+                if (ImGui::Button("Clear"))
+                    prv::iotrace::clear();
+
+                ImGui::SameLine();
+                ImGui::Text("%llu records (%llu total)",
+                    static_cast<unsigned long long>(prv::iotrace::getRecordCount()),
+                    static_cast<unsigned long long>(prv::iotrace::getTotalCount()));
+            }
+            ImGui::End();
+        }
+
+    }
+
     void Window::frame() {
         auto &io = ImGui::GetIO();
+
+        if (ImGui::IsKeyPressed(ImGui::GetKeyIndex(ImGuiKey_F10), false))
+            s_profilerEnabled = !s_profilerEnabled;
+
+        std::vector<std::pair<std::string, float>> frameTimings;
+
         for (auto &[name, view] : ContentRegistry::Views::getEntries()) {
             ImGui::GetCurrentContext()->NextWindowData.ClearFlags();
 
+            const auto drawStart = std::chrono::steady_clock::now();
+
             view->drawAlwaysVisible();
 
             if (!view->shouldProcess())
@@ -469,6 +749,9 @@ namespace hex {
                 view->drawContent();
             }
 
+            if (s_profilerEnabled)
+                frameTimings.emplace_back(name, std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - drawStart).count());
+
             if (view->getWindowOpenState()) {
                 auto window    = ImGui::FindWindowByName(view->getName().c_str());
                 bool hasWindow = window != nullptr;
@@ -493,6 +776,11 @@ namespace hex {
         }
 
         this->m_pressedKeys.clear();
+
+        if (s_profilerEnabled) {
+            recordViewTimings(frameTimings);
+            drawProfilerOverlay();
+        }
     }
 
     void Window::frameEnd() {
@@ -516,6 +804,22 @@ namespace hex {
         glfwMakeContextCurrent(backup_current_context);
 
         glfwSwapBuffers(this->m_window);
+
+        // Let processed views produce display-ready data on worker threads while
+        // the loop sleeps or waits for events; the next drawContent() only
+        // submits it. Joined again at the top of frameBegin()
+        for (auto &[name, view] : ContentRegistry::Views::getEntries()) {
+            hex::unused(name);
+
+            if (view->shouldProcess() && view->shouldPrepare()) {
+                this->m_pendingPrepares.push_back(std::async(std::launch::async, [view] {
+                    view->prepare();
+                }));
+            }
+        }
+
+        // Cached reads never outlive the frame they were made in
+        prv::readcache::invalidateAll();
     }
 
     void Window::initGLFW() {
@@ -546,6 +850,10 @@ namespace hex {
 
         glfwSetWindowUserPointer(this->m_window, this);
 
+        // Dirty marks and deferred calls from background threads have to wake
+        // the loop out of its idle event wait
+        ImHexApi::System::impl::setFrameWakeCallback([] { glfwPostEmptyEvent(); });
+
         if (this->m_window == nullptr) {
             log::fatal("Failed to create window!");
             std::abort();
@@ -635,9 +943,6 @@ namespace hex {
         });
 
         glfwSetDropCallback(this->m_window, [](GLFWwindow *, int count, const char **paths) {
-            if (count != 1)
-                return;
-
             for (int i = 0; i < count; i++) {
                 auto path = std::fs::path(reinterpret_cast<const char8_t *>(paths[i]));
 
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <hex/providers/provider.hpp>
+
+namespace hex::plugin::builtin {
+
+    /**
+     * @brief Starts a background task hashing the entire provider once, caching the
+     * digests in ProviderExtraData. Does nothing while a pass is already running.
+     */
+    void updateFileHashes(prv::Provider *provider);
+
+    /**
+     * @brief Draws the cached whole-provider digests as a table, kicking off a new
+     * background pass first when a write invalidated the cache.
+     */
+    void drawFileHashes(prv::Provider *provider);
+
+}
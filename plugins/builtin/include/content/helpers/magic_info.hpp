@@ -0,0 +1,27 @@
+#pragma once
+
+#include <hex/providers/provider.hpp>
+
+#include <string>
+#include <utility>
+
+namespace hex::plugin::builtin {
+
+    /**
+     * @brief Starts a background task running magic-based content detection once,
+     * caching the MIME type and description in ProviderExtraData keyed by the
+     * provider's content fingerprint. Does nothing while a pass is already running.
+     */
+    void updateMagicInfo(prv::Provider *provider);
+
+    /**
+     * @brief Returns the detected { MIME type, description } of the provider's content
+     *
+     * Served from the cache when its fingerprint still matches the data; otherwise
+     * detection runs on the calling thread and the result is published for every
+     * other consumer. Callers on the UI thread should prefer having the cache filled
+     * ahead of time through updateMagicInfo().
+     */
+    [[nodiscard]] std::pair<std::string, std::string> getMagicInfo(prv::Provider *provider);
+
+}
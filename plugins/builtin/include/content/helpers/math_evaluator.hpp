@@ -99,9 +99,23 @@ namespace hex {
             };
 
             std::string name;
-            std::vector<T> arguments;
+
+            // Function arguments compile to their own postfix programs and only
+            // run at evaluation time, so cached expressions stay live
+            std::vector<std::vector<Token>> arguments;
+        };
+
+        /**
+         * @brief A parsed expression in postfix order, ready to be re-run without
+         * touching the source string again
+         */
+        struct CompiledExpression {
+            std::vector<Token> program;
+            std::string resultVariable;
         };
 
+        constexpr static size_t MaxCachedPrograms = 0x100;
+
         static i16 comparePrecedence(const Operator &a, const Operator &b);
         static bool isLeftAssociative(const Operator &op);
         static std::pair<Operator, size_t> toOperator(const std::string &input);
@@ -109,10 +123,12 @@ namespace hex {
     private:
         std::optional<std::queue<Token>> parseInput(std::string input);
         std::optional<std::queue<Token>> toPostfix(std::queue<Token> inputQueue);
-        std::optional<T> evaluate(std::queue<Token> postfixTokens);
+        std::optional<CompiledExpression> compile(const std::string &input);
+        std::optional<T> run(const std::vector<Token> &program);
 
         std::unordered_map<std::string, Variable> m_variables;
         std::unordered_map<std::string, std::function<std::optional<T>(std::vector<T>)>> m_functions;
+        std::unordered_map<std::string, CompiledExpression> m_programCache;
 
         std::optional<std::string> m_lastError;
     };
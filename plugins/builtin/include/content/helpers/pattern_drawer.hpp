@@ -4,13 +4,36 @@
 #include <pl/pattern_visitor.hpp>
 #include <hex/providers/provider.hpp>
 
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
 namespace hex {
 
+    /**
+     * @brief Draws the pattern tree as a virtualized table
+     *
+     * The tree is flattened into a list of the currently visible rows that is
+     * only rebuilt when a node gets expanded or collapsed or the pattern tree
+     * itself changes. Drawing clips that list, so a pattern producing millions of
+     * array entries only costs the rows that are actually on screen each frame.
+     */
     class PatternDrawer : public pl::PatternVisitor {
     public:
         PatternDrawer() = default;
 
-        void draw(pl::ptrn::Pattern& pattern);
+        void draw(const std::vector<pl::ptrn::Pattern*> &patterns);
+
+        /**
+         * @brief Discards the flattened rows so they get rebuilt on the next draw
+         */
+        void invalidateRows();
+
+        /**
+         * @brief Drops the cached value cells of all patterns overlapping the region
+         */
+        void invalidateValues(const Region &region);
 
         void visit(pl::ptrn::PatternArrayDynamic& pattern) override;
         void visit(pl::ptrn::PatternArrayStatic& pattern) override;
@@ -32,12 +55,49 @@ namespace hex {
 
     private:
         constexpr static auto ChunkSize = 512;
-        constexpr static auto DisplayEndStep = 64;
 
-        void drawArray(pl::ptrn::Pattern& pattern, pl::ptrn::Iteratable &iteratable, bool isInlined);
-        u64& getDisplayEnd(const pl::ptrn::Pattern& pattern);
+        /**
+         * @brief One visible table row. Chunk header rows group ChunkSize array
+         * entries and are marked by a non-zero chunkEnd
+         */
+        struct Row {
+            pl::ptrn::Pattern *pattern;
+            u32 depth;
+            u64 chunkStart, chunkEnd;
+        };
+
+        [[nodiscard]] bool isOpen(const void *node, u64 chunk) const;
+        void treeNodeToggled(const void *node, u64 chunk, bool open);
+
+        const std::string &getFormattedValue(pl::ptrn::Pattern &pattern);
+
+        void flattenPattern(pl::ptrn::Pattern &pattern, u32 depth);
+        void flattenArrayEntries(pl::ptrn::Pattern &pattern, pl::ptrn::Iteratable &iteratable, u32 depth);
+
+        void drawRow(const Row &row);
+        void drawChunkRow(const Row &row);
+        void drawArrayNode(pl::ptrn::Pattern& pattern, pl::ptrn::Iteratable &iteratable);
+        void createLeafNode(const pl::ptrn::Pattern& pattern);
+        void createTreeNode(const pl::ptrn::Pattern& pattern);
+        void createDefaultEntry(pl::ptrn::Pattern &pattern);
 
     private:
-        std::map<const pl::ptrn::Pattern*, u64> m_displayEnd;
+        std::vector<Row> m_rows;
+        std::vector<pl::ptrn::Pattern*> m_flattenedPatterns;
+        std::set<std::pair<const void *, u64>> m_openNodes;
+        bool m_rowsValid = false;
+        u32 m_currDepth  = 0;
+
+        /**
+         * @brief Formatted value cells, filled in as rows become visible
+         *
+         * Formatting a value reads provider bytes, so the result is kept until a
+         * write touches the pattern's region or the pattern tree changes
+         */
+        struct CachedCell {
+            std::string value;
+            Region region;
+        };
+        std::map<const pl::ptrn::Pattern *, CachedCell> m_formattedValues;
     };
-}
\ No newline at end of file
+}
@@ -46,19 +46,86 @@ namespace hex::plugin::builtin {
                 std::string sourceCode;
                 std::mutex runtimeMutex;
                 std::unique_ptr<pl::PatternLanguage> runtime;
-                std::vector<std::pair<pl::core::LogConsole::Level, std::string>> console;
+
+                // Console lines shown in the editor's console pane, held in a fixed
+                // capacity ring so a pattern logging in a loop can't grow memory
+                // without bound. The evaluation thread appends whole batches under
+                // the mutex while the UI reads through it
+                struct Console {
+                    using Line = std::pair<pl::core::LogConsole::Level, std::string>;
+
+                    std::mutex mutex;
+                    std::vector<Line> lines;
+                    size_t capacity = 0x1'0000;
+                    size_t head = 0;
+                    u64 droppedLines = 0;
+
+                    void reset(size_t newCapacity) {
+                        std::scoped_lock lock(this->mutex);
+
+                        this->lines.clear();
+                        this->capacity     = std::max<size_t>(1, newCapacity);
+                        this->head         = 0;
+                        this->droppedLines = 0;
+                    }
+
+                    void append(std::vector<Line> &&batch) {
+                        std::scoped_lock lock(this->mutex);
+
+                        // A batch larger than the ring would only overwrite itself,
+                        // so everything but its newest lines is dropped right away
+                        size_t first = 0;
+                        if (batch.size() > this->capacity) {
+                            first = batch.size() - this->capacity;
+                            this->droppedLines += first;
+                        }
+
+                        for (size_t i = first; i < batch.size(); i++) {
+                            if (this->lines.size() < this->capacity) {
+                                this->lines.push_back(std::move(batch[i]));
+                            } else {
+                                this->lines[this->head] = std::move(batch[i]);
+                                this->head = (this->head + 1) % this->capacity;
+                                this->droppedLines++;
+                            }
+                        }
+                    }
+
+                    [[nodiscard]] size_t size() const {
+                        return this->lines.size();
+                    }
+
+                    [[nodiscard]] const Line& get(size_t index) const {
+                        return this->lines[(this->head + index) % this->lines.size()];
+                    }
+                } console;
+
                 bool executionDone = true;
 
                 std::optional<pl::core::err::PatternLanguageError> lastEvaluationError;
-                std::vector<std::pair<pl::core::LogConsole::Level, std::string>> lastEvaluationLog;
                 std::map<std::string, pl::core::Token::Literal> lastEvaluationOutVars;
                 std::map<std::string, PatternVariable> patternVariables;
 
                 std::list<EnvVar> envVarEntries;
+
+                // Colored intervals published to the hex editor's bulk highlight
+                // provider. Rebuilt once per evaluation, sorted by start address with
+                // adjacent same-colored patterns coalesced into one interval
+                std::vector<ImHexApi::HexEditor::Highlighting> highlights;
+                u64 maxHighlightSize = 0;
             } patternLanguage;
 
             std::list<ImHexApi::Bookmarks::Entry> bookmarks;
 
+            // Interval tree over the bookmark regions, feeding the highlight and
+            // tooltip queries. Entries point into the bookmark list, so the tree only
+            // has to be rebuilt when bookmarks are added or removed, tracked by the
+            // modification counters
+            struct BookmarkIndex {
+                interval_tree::IntervalTree<u64, ImHexApi::Bookmarks::Entry *> tree;
+                u32 modifications = 0, indexedModifications = 0;
+            } bookmarkIndex;
+
             struct DataProcessor {
                 std::list<dp::Node*> endNodes;
                 std::list<std::unique_ptr<dp::Node>> nodes;
@@ -70,8 +137,53 @@ namespace hex::plugin::builtin {
 
             struct HexEditor {
                 std::optional<u64> selectionStart, selectionEnd;
+                u64 scrollSegmentRow = 0;
                 float scrollPosition = 0.0F;
             } editor;
+
+            // Cache of the minimap strip drawn beside the hex editor's scrollbar. Holds one
+            // color per strip pixel row at the resolution the strip had when it was last
+            // rebuilt by the background task
+            struct MiniMap {
+                std::vector<color_t> colors;
+                u32 sampleCount  = 0;
+                u64 analyzedSize = 0;
+                bool updating    = false;
+            } miniMap;
+
+            // Cache of the byte histogram of the current selection. When the selection
+            // grows or shrinks at one edge only the delta bytes are counted and added to
+            // or subtracted from the histogram; sum, mean, min/max and popcount all
+            // derive from it. Writes bump the generation so a stale pass never publishes
+            struct SelectionStats {
+                std::optional<Region> region;
+                std::array<u64, 256> valueCounts = { };
+                u32 generation = 0;
+                bool valid     = false;
+                bool updating  = false;
+            } selectionStats;
+
+            // Cache of the whole-provider digests computed by a background task right
+            // after the provider opens. Writes bump the generation so a pass that read
+            // through a modification never publishes its mixed-snapshot results
+            struct FileHashes {
+                std::map<std::string, std::vector<u8>> digests;
+                u32 generation = 0;
+                bool valid     = false;
+                bool updating  = false;
+            } fileHashes;
+
+            // Cache of the magic-based content detection, filled by a background task
+            // right after the provider opens. The fingerprint records which content the
+            // answer belongs to, so a stale entry is told apart from a current one
+            // without any explicit invalidation
+            struct MagicInfo {
+                std::string mimeType;
+                std::string description;
+                u64 fingerprint = 0x00;
+                bool valid      = false;
+                bool updating   = false;
+            } magicInfo;
         };
 
         static Data& getCurrent() {
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <hex/providers/provider.hpp>
+
+#include <optional>
+
+namespace hex::plugin::builtin {
+
+    /**
+     * @brief Byte statistics of a selection, derived from its byte histogram
+     */
+    struct SelectionStatistics {
+        u64 sum;
+        double mean;
+        u8 minimum, maximum;
+        u64 popcount;
+    };
+
+    /**
+     * @brief Returns the statistics of the passed selection, or std::nullopt while a
+     * background pass is still counting it.
+     *
+     * The statistics derive from a cached byte histogram of the selection. When the
+     * selection grows or shrinks at one edge, only the changed bytes are counted and
+     * added to or subtracted from the histogram instead of rescanning the whole
+     * selection, so dragging a selection edge across gigabytes stays instant.
+     */
+    [[nodiscard]] std::optional<SelectionStatistics> getSelectionStatistics(prv::Provider *provider, const Region &selection);
+
+    /**
+     * @brief Draws the statistics of the selection as a single line of text
+     */
+    void drawSelectionStatistics(prv::Provider *provider, const Region &selection);
+
+}
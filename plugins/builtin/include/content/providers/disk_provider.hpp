@@ -1,7 +1,9 @@
 #pragma once
 
-#include <hex/providers/provider.hpp>
+#include <hex/providers/cached_provider.hpp>
 
+#include <map>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
@@ -13,7 +15,7 @@
 
 namespace hex::plugin::builtin::prv {
 
-    class DiskProvider : public hex::prv::Provider {
+    class DiskProvider : public hex::prv::CachedProvider {
     public:
         DiskProvider();
         ~DiskProvider() override = default;
@@ -24,8 +26,8 @@ namespace hex::plugin::builtin::prv {
         [[nodiscard]] bool isResizable() const override;
         [[nodiscard]] bool isSavable() const override;
 
-        void readRaw(u64 offset, void *buffer, size_t size) override;
-        void writeRaw(u64 offset, const void *buffer, size_t size) override;
+        void readFromSource(u64 offset, void *buffer, size_t size) override;
+        void writeToSource(u64 offset, const void *buffer, size_t size) override;
         [[nodiscard]] size_t getActualSize() const override;
 
         void setPath(const std::fs::path &path);
@@ -51,7 +53,11 @@ namespace hex::plugin::builtin::prv {
     protected:
         void reloadDrives();
 
-        std::set<std::string> m_availableDrives;
+        void readFromDisk(u64 offset, void *buffer, size_t size);
+        void writeToDisk(u64 offset, const void *buffer, size_t size);
+        void applyPendingWrites(u64 offset, void *buffer, size_t size);
+        void flushPendingWrites();
+
         std::fs::path m_path;
 
 #if defined(OS_WINDOWS)
@@ -64,8 +70,13 @@ namespace hex::plugin::builtin::prv {
         size_t m_diskSize   = 0;
         size_t m_sectorSize = 0;
 
-        u64 m_sectorBufferAddress = 0;
-        std::vector<u8> m_sectorBuffer;
+        // Adjacent dirty ranges are combined here and written out as single
+        // large sector-aligned writes instead of one read-modify-write per sector
+        constexpr static size_t WriteCombineThreshold = 0x40'0000;
+
+        std::map<u64, std::vector<u8>> m_pendingWrites;
+        size_t m_pendingWriteBytes = 0;
+        std::mutex m_pendingWritesMutex;
 
         bool m_readable = false;
         bool m_writable = false;
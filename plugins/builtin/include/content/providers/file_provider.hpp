@@ -1,8 +1,11 @@
 #pragma once
 
 #include <hex/providers/provider.hpp>
+#include <hex/api/task.hpp>
 
+#include <mutex>
 #include <string_view>
+#include <thread>
 
 #include <sys/stat.h>
 
@@ -37,6 +40,7 @@ namespace hex::plugin::builtin::prv {
 
         void readRaw(u64 offset, void *buffer, size_t size) override;
         void writeRaw(u64 offset, const void *buffer, size_t size) override;
+        [[nodiscard]] std::optional<std::span<const u8>> readRawBorrowed(u64 offset, size_t size) const override;
         [[nodiscard]] size_t getActualSize() const override;
 
         void save() override;
@@ -50,6 +54,26 @@ namespace hex::plugin::builtin::prv {
 
         void setPath(const std::fs::path &path);
 
+        /**
+         * @brief Expected access pattern for a region of the mapping
+         *
+         * Hints are forwarded to the OS (madvise / PrefetchVirtualMemory) so cold-cache
+         * sequential scans get read-ahead while random hex-editor browsing doesn't.
+         */
+        enum class AccessPattern {
+            Normal,
+            Sequential,
+            Random,
+            WillNeed
+        };
+
+        void adviseAccessPattern(AccessPattern pattern, u64 offset = 0, size_t size = 0);
+
+        /**
+         * @brief Requests transparent huge pages for the mapping. Has to be set before open().
+         */
+        void setHugePageMode(bool enabled) { this->m_useHugePages = enabled; }
+
         [[nodiscard]] bool open() override;
         void close() override;
 
@@ -63,10 +87,67 @@ namespace hex::plugin::builtin::prv {
         std::pair<Region, bool> getRegionValidity(u64 address) const override;
 
     protected:
+        /**
+         * @brief One contiguous run of the logical file content
+         *
+         * Pieces either reference a range of the mapped file or a range of the
+         * added-bytes buffer. While the piece table is empty, the logical content
+         * is identical to the mapped file and reads take the direct path.
+         */
+        struct Piece {
+            enum class Source { File, Added };
+
+            Source source;
+            u64 offset;
+            u64 size;
+            u64 logicalStart;
+        };
+
+        void initPieceTable();
+        [[nodiscard]] std::vector<Piece>::iterator splitPieceAt(u64 offset);
+        void updatePieceOffsets();
+
+        void markPagesDirty(u64 offset, size_t size);
+        void flushDirtyPages();
+
+#if defined(OS_WINDOWS)
+        void queryAllocatedRanges(HANDLE file);
+#else
+        void queryAllocatedRanges(int file);
+#endif
+
+        void startChangeWatcher();
+        void stopChangeWatcher();
+        void remapGrownFile();
+
         std::fs::path m_path;
         void *m_mappedFile = nullptr;
         size_t m_fileSize  = 0;
 
+        std::vector<Piece> m_pieces;
+        std::vector<u8> m_addedBytes;
+        size_t m_pieceTableSize = 0;
+        bool m_pieceTableActive = false;
+
+        bool m_useHugePages = false;
+
+        // Dirty mapping pages are flushed incrementally from a background task so
+        // save() and close() don't stall on the OS writing back gigabytes at once
+        constexpr static size_t WriteBackThreshold = 0x100'0000;
+
+        std::map<u64, u64> m_dirtyRanges;
+        size_t m_dirtyBytes = 0;
+        std::mutex m_dirtyRangesMutex;
+        TaskHolder m_writeBackTask;
+
+        // Watches the file for external growth (live capture logs and the like) so the
+        // mapping can be extended in place instead of reopening the provider
+        std::jthread m_changeWatcherThread;
+
+        // Allocated (non-hole) ranges of sparse files as [start, end) file offsets, sorted by
+        // start. Empty when the file is fully allocated or the filesystem can't report holes.
+        std::vector<std::pair<u64, u64>> m_allocatedRanges;
+
         struct stat m_fileStats = { };
         bool m_fileStatsValid   = false;
         bool m_emptyFile        = false;
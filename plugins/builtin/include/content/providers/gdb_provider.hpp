@@ -1,16 +1,13 @@
 #pragma once
 
 #include <hex/helpers/socket.hpp>
-#include <hex/providers/provider.hpp>
+#include <hex/providers/cached_provider.hpp>
 
-#include <array>
-#include <mutex>
 #include <string_view>
-#include <thread>
 
 namespace hex::plugin::builtin::prv {
 
-    class GDBProvider : public hex::prv::Provider {
+    class GDBProvider : public hex::prv::CachedProvider {
     public:
         GDBProvider();
         ~GDBProvider() override = default;;
@@ -24,8 +21,8 @@ namespace hex::plugin::builtin::prv {
         void read(u64 offset, void *buffer, size_t size, bool overlays) override;
         void write(u64 offset, const void *buffer, size_t size) override;
 
-        void readRaw(u64 offset, void *buffer, size_t size) override;
-        void writeRaw(u64 offset, const void *buffer, size_t size) override;
+        void readFromSource(u64 offset, void *buffer, size_t size) override;
+        void writeToSource(u64 offset, const void *buffer, size_t size) override;
         [[nodiscard]] size_t getActualSize() const override;
 
         void save() override;
@@ -59,18 +56,9 @@ namespace hex::plugin::builtin::prv {
 
         u64 m_size = 0;
 
-        constexpr static size_t CacheLineSize = 0x1000;
-
-        struct CacheLine {
-            u64 address;
-
-            std::array<u8, CacheLineSize> data;
-        };
-
-        std::list<CacheLine> m_cache;
-
-        std::thread m_cacheUpdateThread;
-        std::mutex m_cacheLock;
+        // Mapped regions reported by the target, sorted by start address.
+        // Empty when the stub doesn't support qXfer:memory-map:read
+        std::vector<Region> m_memoryMap;
     };
 
 }
\ No newline at end of file
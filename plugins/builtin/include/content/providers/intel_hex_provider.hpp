@@ -13,7 +13,7 @@ namespace hex::plugin::builtin::prv {
 
         [[nodiscard]] bool isAvailable() const override { return this->m_dataValid; }
         [[nodiscard]] bool isReadable() const override { return true; }
-        [[nodiscard]] bool isWritable() const override { return false; }
+        [[nodiscard]] bool isWritable() const override { return true; }
         [[nodiscard]] bool isResizable() const override { return false; }
         [[nodiscard]] bool isSavable() const override { return false; }
 
@@ -26,6 +26,8 @@ namespace hex::plugin::builtin::prv {
         bool open() override;
         void close() override;
 
+        void saveAs(const std::fs::path &path) override;
+
         [[nodiscard]] std::string getName() const override;
         [[nodiscard]] std::vector<std::pair<std::string, std::string>> getDataInformation() const override { return { }; }
 
@@ -46,6 +48,9 @@ namespace hex::plugin::builtin::prv {
         size_t m_dataSize = 0x00;
         interval_tree::IntervalTree<u64, std::vector<u8>> m_data;
 
+        // Sparse overlay holding bytes modified in the editor, applied on top of the parsed records
+        std::map<u64, u8> m_modifiedBytes;
+
         std::fs::path m_sourceFilePath;
     };
 
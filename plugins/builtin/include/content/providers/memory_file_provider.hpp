@@ -21,7 +21,9 @@ namespace hex::plugin::builtin::prv {
 
         void readRaw(u64 offset, void *buffer, size_t size) override;
         void writeRaw(u64 offset, const void *buffer, size_t size) override;
-        [[nodiscard]] size_t getActualSize() const override { return this->m_data.size(); }
+        [[nodiscard]] std::optional<std::span<const u8>> readRawBorrowed(u64 offset, size_t size) const override;
+
+        [[nodiscard]] size_t getActualSize() const override { return this->m_size; }
 
         void resize(size_t newSize) override;
         void insert(u64 offset, size_t size) override;
@@ -43,7 +45,17 @@ namespace hex::plugin::builtin::prv {
         [[nodiscard]] nlohmann::json storeSettings(nlohmann::json settings) const override { return settings; }
 
     private:
-        std::vector<u8> m_data;
+        // The data is stored as a rope of blocks so growing the buffer never copies
+        // existing content and large in-memory files don't need one giant allocation
+        constexpr static size_t BlockSize = 0x10'0000;
+
+        [[nodiscard]] size_t getBlockIndex(u64 offset) const;
+        size_t splitBlockAt(u64 offset);
+        void rebuildBlockOffsets();
+
+        std::vector<std::vector<u8>> m_blocks;
+        std::vector<u64> m_blockOffsets;
+        size_t m_size = 0;
     };
 
 }
\ No newline at end of file
@@ -12,6 +12,8 @@ namespace hex::plugin::builtin::prv {
         bool open() override;
         void close() override;
 
+        void saveAs(const std::fs::path &path) override;
+
         [[nodiscard]] std::string getName() const override;
 
         [[nodiscard]] std::string getTypeName() const override {
@@ -5,6 +5,7 @@
 #include <imgui.h>
 #include <hex/ui/view.hpp>
 
+#include <memory>
 #include <vector>
 #include <tuple>
 #include <cstdio>
@@ -35,7 +36,7 @@ namespace hex::plugin::builtin {
         void drawPathsPage();
         void drawLicensePage();
 
-        ImGui::Texture m_logoTexture;
+        std::shared_ptr<ImGui::Texture> m_logoTexture;
     };
 
 }
\ No newline at end of file
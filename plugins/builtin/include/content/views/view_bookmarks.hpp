@@ -22,6 +22,16 @@ namespace hex::plugin::builtin {
     private:
         std::string m_currFilter;
 
+        // Snapshot of the bookmarks matching the current filter, in list order. It is
+        // only rebuilt when the filter, the bookmarks or the selected provider change;
+        // a filter that merely got more specific narrows the previous results instead
+        // of rescanning every label
+        std::string m_appliedFilter;
+        std::vector<std::list<ImHexApi::Bookmarks::Entry>::iterator> m_filteredBookmarks;
+        u32 m_filteredModifications = 0;
+        prv::Provider *m_filteredProvider = nullptr;
+        bool m_refilter = false;
+
         std::list<ImHexApi::Bookmarks::Entry>::iterator m_dragStartIterator;
     };
 
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <hex/ui/view.hpp>
+#include <hex/api/task.hpp>
+
+#include <string>
+#include <vector>
+
+namespace hex::plugin::builtin {
+
+    class ViewCarver : public View {
+    public:
+        ViewCarver();
+        ~ViewCarver() override = default;
+
+        void drawContent() override;
+
+    private:
+        struct CarvedFile {
+            std::string unlocalizedTypeName;
+            std::string extension;
+            Region region;
+            std::string description;
+        };
+
+        std::vector<CarvedFile> m_results;
+        TaskHolder m_carverTask;
+
+        void carve();
+        static void exportFile(const CarvedFile &file);
+    };
+
+}
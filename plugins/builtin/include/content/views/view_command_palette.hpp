@@ -2,6 +2,7 @@
 
 #include <hex.hpp>
 #include <hex/ui/view.hpp>
+#include <hex/api/content_registry.hpp>
 
 #include <imgui.h>
 
@@ -14,7 +15,7 @@ namespace hex::plugin::builtin {
     class ViewCommandPalette : public View {
     public:
         ViewCommandPalette();
-        ~ViewCommandPalette() override = default;
+        ~ViewCommandPalette() override;
 
         void drawContent() override;
 
@@ -48,10 +49,28 @@ namespace hex::plugin::builtin {
         std::vector<CommandResult> m_lastResults;
         std::string m_exactResult;
 
+        /**
+         * @brief Per-command data derived once at index build time
+         *
+         * The match key already carries the keyword commands' trailing space and
+         * exists pre-lowered, and the autocomplete label is fully formatted, so a
+         * keystroke costs one prefix compare per entry and allocates nothing for
+         * entries that fail it
+         */
+        struct IndexedCommand {
+            const ContentRegistry::CommandPaletteCommands::Entry *entry;
+            std::string matchKey, lowerMatchKey;
+            std::string autoCompleteLabel;
+        };
+
+        std::vector<IndexedCommand> m_indexedCommands;
+        bool m_indexDirty = true;
+
         void focusInputTextBox() {
             this->m_focusInputTextBox = true;
         }
 
+        void updateIndex();
         std::vector<CommandResult> getCommandResults(const std::string &command);
     };
 
@@ -29,11 +29,25 @@ namespace hex::plugin::builtin {
         void drawContent() override;
 
     private:
+        /**
+         * @brief One entry per token of a constant's fields, sorted by token
+         *
+         * Filtering resolves each query token to the prefix range in this index
+         * instead of substring-scanning every constant's strings per keystroke
+         */
+        struct TokenEntry {
+            std::string token;
+            size_t constantIndex;
+        };
+
         void reloadConstants();
+        void applyFilter();
 
         std::vector<Constant> m_constants;
+        std::vector<TokenEntry> m_tokenIndex;
         std::vector<size_t> m_filterIndices;
         std::string m_filter;
+        TaskHolder m_reloadTask;
     };
 
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include <hex/api/content_registry.hpp>
 
 #include <bit>
+#include <chrono>
 #include <cstdio>
 #include <string>
 
@@ -27,6 +28,17 @@ namespace hex::plugin::builtin {
 
         bool m_shouldInvalidate = true;
 
+        // Debounce and change detection for re-running the inspectors: evaluation only
+        // starts once the selection has been stable for a moment, and is skipped when
+        // the bytes under the inspector and the display options match the last run
+        std::chrono::steady_clock::time_point m_invalidationTime;
+        std::vector<u8> m_lastWindowBytes;
+        u64 m_lastStartAddress  = 0;
+        size_t m_lastValidBytes = 0;
+        std::endian m_lastEndian = std::endian::native;
+        bool m_lastInvert        = false;
+        ContentRegistry::DataInspector::NumberDisplayStyle m_lastNumberDisplayStyle = ContentRegistry::DataInspector::NumberDisplayStyle::Decimal;
+
         std::endian m_endian                                                    = std::endian::native;
         ContentRegistry::DataInspector::NumberDisplayStyle m_numberDisplayStyle = ContentRegistry::DataInspector::NumberDisplayStyle::Decimal;
         bool m_invert = false;
@@ -3,13 +3,17 @@
 #include <hex.hpp>
 
 #include <imgui.h>
+#include <hex/api/task.hpp>
 #include <hex/ui/view.hpp>
 #include <hex/data_processor/node.hpp>
 #include <hex/data_processor/link.hpp>
 
 #include <array>
+#include <atomic>
 #include <string>
 
+#include <content/helpers/provider_extra_data.hpp>
+
 namespace hex::plugin::builtin {
 
     class ViewDataProcessor : public View {
@@ -25,13 +29,25 @@ namespace hex::plugin::builtin {
         ImVec2 m_rightClickedCoords;
 
         bool m_continuousEvaluation = false;
+        bool m_showProfiler = false;
+
+        TaskHolder m_evaluationTask;
+        std::atomic<bool> m_evaluationRunning = false;
+        bool m_restartEvaluation = false;
 
         void eraseLink(int id);
         void eraseNodes(const std::vector<int> &ids);
+        void stopEvaluation();
         void processNodes();
+        void evaluateGraph(ProviderExtraData::Data::DataProcessor &data, Task &task);
 
+        nlohmann::json saveNodesJson(prv::Provider *provider);
         std::string saveNodes(prv::Provider *provider);
+        std::vector<u8> saveNodesBinary(prv::Provider *provider);
+
+        void loadNodesJson(prv::Provider *provider, nlohmann::json input);
         void loadNodes(prv::Provider *provider, const std::string &data);
+        void loadNodes(prv::Provider *provider, const std::vector<u8> &data);
     };
 
 }
\ No newline at end of file
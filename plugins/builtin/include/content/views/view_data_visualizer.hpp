@@ -0,0 +1,48 @@
+#pragma once
+
+#include <hex/ui/view.hpp>
+#include <hex/ui/imgui_imhex_extensions.h>
+#include <hex/api/task.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace hex::plugin::builtin {
+
+    class ViewDataVisualizer : public View {
+    public:
+        ViewDataVisualizer();
+        ~ViewDataVisualizer() override;
+
+        void drawContent() override;
+
+    private:
+        enum class Mode : int {
+            Digram  = 0,
+            ByteMap = 1
+        };
+
+        int m_mode          = int(Mode::ByteMap);
+        Mode m_renderedMode = Mode::ByteMap;
+
+        // The background task renders into this pixel buffer and bumps the revision;
+        // the GUI thread re-uploads the buffer into the texture when it notices a
+        // revision it hasn't displayed yet
+        std::mutex m_pixelMutex;
+        std::vector<u8> m_pixelBuffer;
+        std::atomic<u32> m_pixelRevision = 0;
+        u32 m_uploadedRevision           = 0;
+        u32 m_textureSize                = 0;
+
+        // How much data one byte map pixel stands for, needed to map hovered pixels
+        // back onto addresses
+        u64 m_bytesPerPixel = 0;
+
+        ImGui::Texture m_texture;
+        TaskHolder m_visualizerTask;
+
+        void visualize();
+    };
+
+}
@@ -4,11 +4,16 @@
 
 #include <imgui.h>
 #include <hex/ui/view.hpp>
+#include <hex/api/task.hpp>
 
 #include <array>
+#include <atomic>
+#include <map>
 #include <string>
 #include <vector>
 
+namespace hex::prv { class Provider; }
+
 namespace hex::plugin::builtin {
 
     class ViewDiff : public View {
@@ -18,14 +23,56 @@ namespace hex::plugin::builtin {
 
         void drawContent() override;
 
+        void prepare() override;
+        [[nodiscard]] bool shouldPrepare() const override;
+
     private:
-        void drawDiffLine(const std::array<int, 2> &providerIds, u64 row) const;
+        // One segment of the alignment map produced by the diff task: sizeA bytes at
+        // addressA of the left provider line up with sizeB bytes at addressB of the
+        // right one. Insertions and deletions become segments where one side is empty,
+        // so the content behind them still lines up instead of diffing as changed
+        struct DiffSegment {
+            enum class Type : u8 {
+                Match,      // Both sides hold the same bytes
+                Changed,    // Both sides hold bytes, but they differ
+                OnlyA,      // Bytes only exist in the left provider
+                OnlyB       // Bytes only exist in the right provider
+            };
+
+            u64 addressA, addressB;
+            u64 sizeA, sizeB;
+            u64 displayStart;
+            Type type;
+
+            [[nodiscard]] u64 getDisplaySize() const { return std::max(this->sizeA, this->sizeB); }
+        };
+
+        // One classified byte of a diff line. Lines are cached once assembled so
+        // scrolling over already computed regions never goes back to the providers
+        struct LineByte {
+            u8 byte = 0x00;
+            bool present = false;
+            DiffSegment::Type type = DiffSegment::Type::Match;
+        };
+        using DiffLine = std::array<std::vector<LineByte>, 2>;
+
+        void analyze(prv::Provider *providerA, prv::Provider *providerB, Task &task);
+        const DiffLine &getDiffLine(const std::array<int, 2> &providerIds, u64 row);
+        void drawDiffLine(const std::array<int, 2> &providerIds, u64 row);
 
         int m_providerA = -1, m_providerB = -1;
 
+        std::vector<DiffSegment> m_diffSegments, m_workSegments;
+        std::map<u64, DiffLine> m_lineCache;
+        u64 m_diffDisplaySize = 0;
+        u64 m_visibleRowStart = 0, m_visibleRowEnd = 0;
+        std::atomic<bool> m_analysisValid = false;
+        bool m_shouldReanalyze = true;
+        TaskHolder m_diffTask;
+
         bool m_greyedOutZeros = true;
         bool m_upperCaseHex   = true;
         u32 m_columnCount     = 16;
     };
 
-}
\ No newline at end of file
+}
@@ -6,18 +6,78 @@
 #include <hex/helpers/disassembler.hpp>
 
 #include <cstdio>
+#include <list>
+#include <map>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace hex::plugin::builtin {
 
-    struct Disassembly {
-        u64 address;
-        u64 offset;
-        size_t size;
-        std::string bytes;
-        std::string mnemonic;
-        std::string operators;
+    // Packed disassembly listing. Storing every instruction as a struct of
+    // strings costs hundreds of bytes and several heap blocks each, so the
+    // text columns of all instructions share one character arena and the
+    // records only carry offsets into it. The 32 bit text offset caps the
+    // arena at 4 GiB, far beyond what the listing can usefully hold anyway
+    struct DisassemblyListing {
+        // Fixed 24 byte record per instruction
+        struct Instruction {
+            u64 address;
+            u64 offset;
+            u32 textOffset;
+            u8 bytesLength;
+            u8 mnemonicLength;
+            u16 operatorsLength;
+
+            [[nodiscard]] u16 size() const {
+                // The bytes column is formatted as three characters per instruction byte
+                return u16((this->bytesLength + 1) / 3);
+            }
+        };
+
+        std::vector<Instruction> instructions;
+        std::vector<char> textArena;
+
+        void addInstruction(u64 address, u64 offset, std::string_view bytes, std::string_view mnemonic, std::string_view operators) {
+            const auto textOffset = u32(this->textArena.size());
+
+            this->textArena.insert(this->textArena.end(), bytes.begin(), bytes.end());
+            this->textArena.insert(this->textArena.end(), mnemonic.begin(), mnemonic.end());
+            this->textArena.insert(this->textArena.end(), operators.begin(), operators.end());
+
+            this->instructions.push_back({ address, offset, textOffset, u8(bytes.size()), u8(mnemonic.size()), u16(operators.size()) });
+        }
+
+        [[nodiscard]] std::string_view getBytes(const Instruction &instruction) const {
+            return { this->textArena.data() + instruction.textOffset, instruction.bytesLength };
+        }
+
+        [[nodiscard]] std::string_view getMnemonic(const Instruction &instruction) const {
+            return { this->textArena.data() + instruction.textOffset + instruction.bytesLength, instruction.mnemonicLength };
+        }
+
+        [[nodiscard]] std::string_view getOperators(const Instruction &instruction) const {
+            return { this->textArena.data() + instruction.textOffset + instruction.bytesLength + instruction.mnemonicLength, instruction.operatorsLength };
+        }
+
+        void append(DisassemblyListing &&other) {
+            const auto textBase = u32(this->textArena.size());
+
+            this->textArena.insert(this->textArena.end(), other.textArena.begin(), other.textArena.end());
+
+            this->instructions.reserve(this->instructions.size() + other.instructions.size());
+            for (auto instruction : other.instructions) {
+                instruction.textOffset += textBase;
+                this->instructions.push_back(instruction);
+            }
+
+            other.clear();
+        }
+
+        void clear() {
+            this->instructions.clear();
+            this->textArena.clear();
+        }
     };
 
     class ViewDisassembler : public View {
@@ -37,9 +97,57 @@ namespace hex::plugin::builtin {
         Architecture m_architecture = Architecture::ARM;
         cs_mode m_mode              = cs_mode(0);
 
-        std::vector<Disassembly> m_disassembly;
+        DisassemblyListing m_disassembly;
+
+        // Search index over the full listing, built while it decodes. The
+        // mnemonic map doubles as the interned mnemonic table; postings are
+        // instruction indices in listing order
+        struct DisassemblyIndex {
+            std::map<std::string, std::vector<u32>> mnemonics;
+            std::map<u64, std::vector<u32>> operandValues;
+
+            void clear() {
+                this->mnemonics.clear();
+                this->operandValues.clear();
+            }
+        };
+
+        DisassemblyIndex m_searchIndex;
+        std::string m_searchMnemonic;
+        std::string m_searchValue;
+        std::vector<u32> m_searchResults;
+        size_t m_searchCursor = 0;
+        i64 m_jumpToLine      = -1;
+
+        // Windowed mode decodes fixed size byte windows around the viewport on
+        // demand instead of materializing the whole region up front
+        struct DisassemblyWindow {
+            u64 index;
+            DisassemblyListing listing;
+        };
+
+        bool m_windowedMode = false;
+
+        Region m_windowRegion              = { 0, 0 };
+        u64 m_windowBaseAddress            = 0;
+        Architecture m_windowArchitecture  = Architecture::ARM;
+        cs_mode m_windowMode               = cs_mode(0);
+
+        std::list<DisassemblyWindow> m_windowCache;
+        std::map<u64, std::list<DisassemblyWindow>::iterator> m_windowCacheIndex;
+        std::vector<u64> m_windowLineCounts;
+        u64 m_totalWindowLines = 0;
+
+        u64 m_windowScanIndex    = 0;
+        u64 m_windowScanLineBase = 0;
 
         void disassemble();
+        void exportDisassembly();
+
+        void resetWindowedDisassembly();
+        DisassemblyListing disassembleWindow(u64 windowIndex);
+        const DisassemblyListing &getWindow(u64 windowIndex);
+        const DisassemblyListing *getWindowedLine(u64 line, size_t &windowLine);
     };
 
 }
\ No newline at end of file
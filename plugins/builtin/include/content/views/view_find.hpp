@@ -7,16 +7,15 @@
 #include <ui/widgets.hpp>
 
 #include <atomic>
+#include <optional>
 #include <vector>
 
-#include <IntervalTree.h>
-
 namespace hex::plugin::builtin {
 
     class ViewFind : public View {
     public:
         ViewFind();
-        ~ViewFind() override = default;
+        ~ViewFind() override;
 
         void drawContent() override;
 
@@ -59,6 +58,7 @@ namespace hex::plugin::builtin {
 
             struct Sequence {
                 std::string sequence;
+                bool multiPattern = false;
             } bytes;
 
             struct Regex {
@@ -84,27 +84,44 @@ namespace hex::plugin::builtin {
 
         } m_searchSettings, m_decodeSettings;
 
-        using OccurrenceTree = interval_tree::IntervalTree<u64, Occurrence>;
-
-        std::map<prv::Provider*, std::vector<Occurrence>> m_foundOccurrences, m_sortedOccurrences;
-        std::map<prv::Provider*, OccurrenceTree> m_occurrenceTree;
+        // Occurrences are kept packed and sorted by start address; the display order after
+        // filtering and column sorting only lives in an index vector, and decoded previews
+        // are produced lazily for visible rows. With millions of hits this keeps memory at
+        // one Occurrence per hit and makes address lookups a binary search
+        std::map<prv::Provider*, std::vector<Occurrence>> m_foundOccurrences;
+        std::map<prv::Provider*, std::vector<size_t>> m_sortedOccurrenceIndices;
+        std::map<prv::Provider*, size_t> m_maxOccurrenceSize;
         std::map<prv::Provider*, std::string> m_currFilter;
 
-        TaskHolder m_searchTask;
+        // End (exclusive) of the last whole-data search per provider, used to extend
+        // results incrementally when data gets appended to the provider
+        std::map<prv::Provider*, u64> m_searchedEnd;
+
+        TaskHolder m_searchTask, m_exportTask;
         bool m_settingsValid = false;
 
     private:
         static std::vector<Occurrence> searchStrings(Task &task, prv::Provider *provider, Region searchRegion, const SearchSettings::Strings &settings);
         static std::vector<Occurrence> searchSequence(Task &task, prv::Provider *provider, Region searchRegion, const SearchSettings::Sequence &settings);
+        static std::vector<Occurrence> searchMultiSequence(Task &task, prv::Provider *provider, Region searchRegion, const SearchSettings::Sequence &settings);
         static std::vector<Occurrence> searchRegex(Task &task, prv::Provider *provider, Region searchRegion, const SearchSettings::Regex &settings);
         static std::vector<Occurrence> searchBinaryPattern(Task &task, prv::Provider *provider, Region searchRegion, const SearchSettings::BinaryPattern &settings);
         static std::vector<Occurrence> searchValue(Task &task, prv::Provider *provider, Region searchRegion, const SearchSettings::Value &settings);
 
+        static std::vector<Occurrence> searchWithSettings(Task &task, prv::Provider *provider, Region searchRegion, const SearchSettings &settings);
+        static std::vector<Occurrence> searchWithSettingsParallel(Task &task, prv::Provider *provider, const std::vector<Region> &searchRegions, const SearchSettings &settings);
+
+        static std::optional<size_t> getPatternSize(const SearchSettings &settings);
+
         static std::vector<BinaryPattern> parseBinaryPatternString(std::string string);
         static std::tuple<bool, std::variant<u64, i64, float, double>, size_t> parseNumericValueInput(const std::string &input, SearchSettings::Value::Type type);
 
         void runSearch();
+        void exportResults(prv::Provider *provider, bool asJson);
         std::string decodeValue(prv::Provider *provider, Occurrence occurrence) const;
+
+        void updateOccurrenceIndex(prv::Provider *provider);
+        [[nodiscard]] std::vector<const Occurrence *> getOccurrencesAt(prv::Provider *provider, u64 address) const;
     };
 
 }
\ No newline at end of file
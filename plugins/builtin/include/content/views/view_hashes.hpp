@@ -17,11 +17,20 @@ namespace hex::plugin::builtin {
 
         void drawContent() override;
 
+    private:
+        void updateHashes(const Region &region, prv::Provider *provider);
+
     private:
         ContentRegistry::Hashes::Hash *m_selectedHash = nullptr;
         std::string m_newHashName;
 
         std::vector<ContentRegistry::Hashes::Hash::Function> m_hashFunctions;
+
+        // Rolling state for the streamable hashes: as long as the selection keeps its
+        // start address and only grows, the contexts are fed just the new bytes
+        std::vector<std::unique_ptr<ContentRegistry::Hashes::Hash::Function::Context>> m_liveContexts;
+        std::optional<u64> m_liveStart;
+        u64 m_liveProcessed = 0;
     };
 
 }
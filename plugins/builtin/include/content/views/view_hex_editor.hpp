@@ -1,6 +1,7 @@
 #pragma once
 
 #include <hex/api/content_registry.hpp>
+#include <hex/api/task.hpp>
 
 #include <hex/ui/view.hpp>
 #include <hex/helpers/concepts.hpp>
@@ -10,6 +11,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <map>
 
 namespace hex::plugin::builtin {
 
@@ -113,6 +115,8 @@ namespace hex::plugin::builtin {
 
     private:
         void drawEditor(const ImVec2 &size);
+        void drawMiniMap(const ImVec2 &size);
+        void updateMiniMap(prv::Provider *provider, u32 sampleCount);
         void drawFooter(const ImVec2 &size);
 
         void handleSelection(u64 address, u32 bytesPerCell, const u8 *data, bool cellHovered);
@@ -132,6 +136,38 @@ namespace hex::plugin::builtin {
         bool m_selectionChanged = false;
 
         u16 m_visibleRowCount = 0;
+        u64 m_lastScrollRow = 0;
+
+        // First row of the scroll segment the editor table currently spans. The table
+        // never scrolls more than a bounded number of rows at once so the float scroll
+        // position keeps full precision over the whole 64-bit address space
+        u64 m_scrollSegmentRow = 0;
+
+        // One glyph of the custom encoding column: the decoded string, the number of
+        // bytes its sequence consumed and the color class it renders in
+        struct DecodedGlyph {
+            u64 address;
+            std::string displayValue;
+            size_t advance;
+            ImColor color;
+        };
+
+        // Bytes of the visible rows, cached across frames so redrawing an
+        // unchanged viewport doesn't consult the provider, its patches and
+        // overlays again for every cell. The formatted cell text and decoded
+        // encoding glyphs live next to the bytes they were rendered from and
+        // are dropped whenever those change
+        struct CachedRow {
+            std::vector<u8> bytes;
+            u64 frame = 0;
+
+            std::map<u64, std::string> hexText, asciiText;
+            std::vector<DecodedGlyph> encoding;
+        };
+        std::map<u64, CachedRow> m_rowCache;
+
+        void readRowBytes(u64 address, u8 *bytes, size_t count);
+        void decodeRowEncoding(u64 address);
 
         CellType m_editingCellType = CellType::None;
         std::optional<u64> m_editingAddress;
@@ -144,9 +180,22 @@ namespace hex::plugin::builtin {
         bool m_upperCaseHex = true;
         bool m_grayOutZero = true;
         bool m_showAscii = true;
+        bool m_showMiniMap = true;
         bool m_syncScrolling = false;
         u32 m_byteCellPadding = 0, m_characterCellPadding = 0;
 
+        // Opt-in low-overhead rendering: static cells skip the text widget and push
+        // their glyphs straight into the draw list, which matters on dense grids
+        bool m_fastRender = false;
+        ImVec2 m_characterSize;
+
+        // Scroll state mirrored out of the editor table so the minimap can display and
+        // drive it from outside the table's scroll region
+        float m_scrollFraction  = 0.0F;
+        float m_visibleFraction = 1.0F;
+        std::optional<float> m_miniMapScrollRequest;
+        TaskHolder m_miniMapTask;
+
         bool m_shouldOpenPopup = false;
         std::unique_ptr<Popup> m_currPopup;
 
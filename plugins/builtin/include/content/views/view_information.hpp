@@ -7,6 +7,7 @@
 #include <atomic>
 #include <cstdio>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace hex::plugin::builtin {
@@ -25,9 +26,19 @@ namespace hex::plugin::builtin {
         float m_highestBlockEntropy = 0;
         std::vector<float> m_blockEntropy;
 
+        // Mip pyramid of min/max-decimated entropy samples. Each level stores interleaved
+        // minimum/maximum pairs of progressively larger block buckets, so the plot can
+        // submit only a few points per pixel without flattening any spikes
+        std::vector<std::vector<float>> m_decimatedEntropy;
+
         double m_entropyHandlePosition;
 
         std::array<ImU64, 256> m_valueCounts = { 0 };
+
+        // Per-block byte histograms so a dirtied block can swap out its contribution
+        // to m_valueCounts without rescanning the rest of the data
+        std::vector<std::array<u64, 256>> m_blockValueCounts;
+
         TaskHolder m_analyzerTask;
 
         Region m_analyzedRegion = { 0, 0 };
@@ -35,7 +46,13 @@ namespace hex::plugin::builtin {
         std::string m_dataDescription;
         std::string m_dataMimeType;
 
+        // Results of the registered streaming metrics as unlocalized name / formatted value pairs
+        std::vector<std::pair<std::string, std::string>> m_metricResults;
+
         void analyze();
+        void analyzeBlocks(Task &task, prv::Provider *provider, u64 start, u64 end);
+        void updateEntropyPyramid();
+        void classifyBlocks(prv::Provider *provider);
     };
 
 }
\ No newline at end of file
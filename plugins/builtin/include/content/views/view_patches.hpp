@@ -6,18 +6,30 @@
 #include <hex/ui/view.hpp>
 
 #include <optional>
+#include <vector>
 
 namespace hex::plugin::builtin {
 
     class ViewPatches : public View {
     public:
         explicit ViewPatches();
-        ~ViewPatches() override = default;
+        ~ViewPatches() override;
 
         void drawContent() override;
 
     private:
-        u64 m_selectedPatch = 0x00;
+        u64 m_selectedPatch     = 0x00;
+        u64 m_selectedPatchSize = 0x00;
+
+        // Flat snapshot of the contiguous patch runs, rebuilt only when patches
+        // change, so the table clipper indexes into it instead of walking the patch
+        // store every frame
+        struct PatchRun {
+            u64 address;
+            u64 size;
+        };
+        std::vector<PatchRun> m_patchRuns;
+        bool m_runsValid = false;
     };
 
 }
\ No newline at end of file
@@ -17,9 +17,18 @@ namespace hex::plugin::builtin {
 
         void drawContent() override;
 
+    private:
+        enum class ExportFormat {
+            Json,
+            Csv
+        };
+
+        void exportPatterns(ExportFormat format);
+
     private:
         std::map<prv::Provider *, std::vector<pl::ptrn::Pattern*>> m_sortedPatterns;
         hex::PatternDrawer m_patternDrawer;
+        TaskHolder m_exportTask;
     };
 
 }
\ No newline at end of file
@@ -6,8 +6,11 @@
 #include <hex/providers/provider.hpp>
 #include <content/helpers/provider_extra_data.hpp>
 
+#include <chrono>
 #include <cstring>
 #include <filesystem>
+#include <map>
+#include <mutex>
 #include <string_view>
 #include <thread>
 #include <vector>
@@ -40,6 +43,16 @@ namespace hex::plugin::builtin {
 
         std::vector<std::fs::path> m_possiblePatternFiles;
         u32 m_selectedPatternFile = 0;
+
+        // MIME pragma values found in a bundled pattern file, keyed by path and
+        // invalidated by write time. Opening further providers only stats the
+        // files instead of re-reading and re-preprocessing each of them
+        struct PatternMimeCacheEntry {
+            std::fs::file_time_type writeTime;
+            std::vector<std::string> mimeTypes;
+        };
+        std::map<std::fs::path, PatternMimeCacheEntry> m_patternMimeCache;
+        std::mutex m_patternMimeCacheMutex;
         bool m_runAutomatically   = false;
 
         bool m_lastEvaluationProcessed = true;
@@ -50,6 +63,12 @@ namespace hex::plugin::builtin {
 
         bool m_hasUnevaluatedChanges = false;
 
+        // Auto-evaluation only starts once typing has paused for a moment; an edit
+        // while an evaluation is in flight aborts it instead of queueing behind it.
+        // Writes landing during an evaluation mark its result stale
+        std::chrono::steady_clock::time_point m_lastEditTime;
+        bool m_dataModifiedDuringEvaluation = false;
+
         bool m_acceptPatternWindowOpen = false;
 
         TextEditor m_textEditor;
@@ -61,7 +80,7 @@ namespace hex::plugin::builtin {
         bool m_autoLoadPatterns = true;
 
     private:
-        void drawConsole(ImVec2 size, const std::vector<std::pair<pl::core::LogConsole::Level, std::string>> &console);
+        void drawConsole(ImVec2 size, PlData::Console &console);
         void drawEnvVars(ImVec2 size, std::list<PlData::EnvVar> &envVars);
         void drawVariableSettings(ImVec2 size, std::map<std::string, PlData::PatternVariable> &patternVariables);
 
@@ -71,6 +90,7 @@ namespace hex::plugin::builtin {
 
         void parsePattern(const std::string &code, prv::Provider *provider);
         void evaluatePattern(const std::string &code, prv::Provider *provider);
+        void updatePatternHighlights(prv::Provider *provider);
 
         void registerEvents();
         void registerMenuItems();
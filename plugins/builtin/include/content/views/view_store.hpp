@@ -8,9 +8,12 @@
 
 #include <array>
 #include <future>
+#include <list>
 #include <string>
 #include <filesystem>
 
+#include <nlohmann/json_fwd.hpp>
+
 namespace hex::plugin::builtin {
 
     enum class RequestStatus {
@@ -48,21 +51,48 @@ namespace hex::plugin::builtin {
         [[nodiscard]] ImVec2 getMaxSize() const override { return { 500, 400 }; }
 
     private:
+        // Each active transfer owns its Net instance since a Net handle only
+        // carries one transmission at a time
+        struct Download {
+            Net net;
+            std::future<Response<void>> future;
+            fs::ImHexPath pathType;
+            std::fs::path path;
+            std::string fileName;
+        };
+
+        struct QueuedDownload {
+            fs::ImHexPath pathType;
+            std::string fileName, url;
+            std::fs::path path;
+        };
+
         Net m_net;
-        std::future<Response<std::string>> m_apiRequest;
-        std::future<Response<void>> m_download;
-        std::fs::path m_downloadPath;
+        std::future<ConditionalResponse> m_apiRequest;
+        std::list<Download> m_downloads;
+        std::list<QueuedDownload> m_downloadQueue;
+        size_t m_downloadTotalCount = 0;
         RequestStatus m_requestStatus = RequestStatus::NotAttempted;
 
         std::vector<StoreEntry> m_patterns, m_includes, m_magics, m_constants, m_yara, m_encodings;
 
+        std::string m_indexEtag, m_indexLastModified;
+        bool m_hasCachedIndex = false;
+
         void drawStore();
 
         void refresh();
         void parseResponse();
+        void parseStoreJson(const nlohmann::json &json);
+
+        void loadCachedIndex();
+        void storeCachedIndex(const nlohmann::json &index, const std::string &etag, const std::string &lastModified);
 
         bool download(fs::ImHexPath pathType, const std::string &fileName, const std::string &url, bool update);
         bool remove(fs::ImHexPath pathType, const std::string &fileName);
+
+        void processDownloads();
+        StoreEntry *findEntry(fs::ImHexPath pathType, const std::string &fileName);
     };
 
 }
\ No newline at end of file
@@ -17,20 +17,22 @@ namespace hex::plugin::builtin {
         void drawContent() override;
 
     private:
+        // Rule and variable names repeat across thousands of matches, so they
+        // are interned once and matches only carry indices into the pool
         struct YaraMatch {
-            std::string identifier;
-            std::string variable;
+            u32 identifierIndex;
+            u32 variableIndex;
             u64 address;
             size_t size;
             bool wholeDataMatch;
-
-            u32 highlightId;
-            u32 tooltipId;
         };
 
         std::vector<std::pair<std::fs::path, std::fs::path>> m_rules;
         std::vector<YaraMatch> m_matches;
+        std::vector<std::string> m_matchStrings;
+        size_t m_maxMatchSize = 0;
         u32 m_selectedRule = 0;
+        bool m_parallelScan = false;
         TaskHolder m_matcherTask;
 
         std::vector<std::string> m_consoleMessages;
@@ -38,6 +40,8 @@ namespace hex::plugin::builtin {
         void reloadRules();
         void applyRules();
         void clearResult();
+
+        [[nodiscard]] std::vector<const YaraMatch *> getMatchesAt(u64 address) const;
     };
 
 }
\ No newline at end of file
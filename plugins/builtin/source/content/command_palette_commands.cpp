@@ -16,9 +16,14 @@ namespace hex::plugin::builtin {
             "#",
             "hex.builtin.command.calc.desc",
             [](auto input) {
-                hex::MathEvaluator<long double> evaluator;
-                evaluator.registerStandardVariables();
-                evaluator.registerStandardFunctions();
+                // Keep the evaluator alive across invocations so the compiled-program
+                // cache takes effect while the query is being typed
+                static hex::MathEvaluator<long double> evaluator = [] {
+                    hex::MathEvaluator<long double> evaluator;
+                    evaluator.registerStandardVariables();
+                    evaluator.registerStandardFunctions();
+                    return evaluator;
+                }();
 
                 std::optional<long double> result;
 
@@ -5,91 +5,125 @@
 #include <hex/helpers/fmt.hpp>
 #include <hex/helpers/crypto.hpp>
 
+#include <array>
+
 namespace hex::plugin::builtin {
 
-    static std::string formatLanguageArray(prv::Provider *provider, u64 offset, size_t size, const std::string &start, const std::string &byteFormat, const std::string &end) {
+    // Shared by the hexdump style formatters below; the table form avoids running
+    // the formatter once per byte
+    static const std::array<std::string, 0x100>& hexByteTable() {
+        static const auto Table = [] {
+            std::array<std::string, 0x100> table;
+            for (u32 byte = 0; byte < table.size(); byte++)
+                table[byte] = hex::format("{0:02X} ", byte);
+
+            return table;
+        }();
+
+        return Table;
+    }
+
+    // Running the format string through hex::format dominates the cost of large
+    // exports, so every possible byte is formatted exactly once up front and the
+    // loops only copy from the table
+    static std::array<std::string, 0x100> buildFormattedByteTable(const std::string &byteFormat) {
+        std::array<std::string, 0x100> table;
+        for (u32 byte = 0; byte < table.size(); byte++)
+            table[byte] = hex::format(byteFormat, byte);
+
+        return table;
+    }
+
+    static std::string formatLanguageArrayChunk(prv::Provider *provider, u64 address, size_t size, u64 startAddress, size_t totalSize, const std::string &byteFormat) {
         constexpr static auto NewLineIndent = "\n    ";
         constexpr static auto LineLength = 16;
 
-        std::string result;
-        result.reserve(start.size() + hex::format(byteFormat, 0x00).size() * size +  + std::string(NewLineIndent).size() / LineLength + end.size());
+        const auto formattedBytes = buildFormattedByteTable(byteFormat);
 
-        result += start;
+        std::string result;
+        result.reserve((formattedBytes[0].size() + 1) * size);
 
         auto reader = prv::BufferedReader(provider);
-        reader.seek(offset);
-        reader.setEndAddress(offset + size - 1);
+        reader.seek(address);
+        reader.setEndAddress(address + size - 1);
 
-        u64 index = 0x00;
+        // Line breaks depend only on the position relative to the region start, so
+        // chunks formatted independently concatenate cleanly
+        u64 index = address - startAddress;
         for (u8 byte : reader) {
             if ((index % LineLength) == 0x00)
                 result += NewLineIndent;
 
-            result += hex::format(byteFormat, byte);
+            result += formattedBytes[byte];
 
             index++;
         }
 
         // Remove trailing comma
-        if (provider->getActualSize() > 0) {
+        if (address + size == startAddress + totalSize && !result.empty()) {
             result.pop_back();
             result.pop_back();
         }
 
+        return result;
+    }
+
+    static std::string formatLanguageArray(prv::Provider *provider, u64 offset, size_t size, const std::string &start, const std::string &byteFormat, const std::string &end) {
+        std::string result;
+        result.reserve(start.size() + (hex::format(byteFormat, 0x00).size() + 1) * size + end.size());
+
+        result += start;
+        result += formatLanguageArrayChunk(provider, offset, size, offset, size, byteFormat);
         result += "\n" + end;
 
         return result;
     }
 
+    // Registers both the clipboard formatter and its streaming counterpart used by
+    // the export-as menu, which formats chunks on parallel workers
+    static void addLanguageArrayFormatter(const std::string &unlocalizedName, const std::function<std::string(size_t)> &start, const std::string &byteFormat, const std::string &end) {
+        ContentRegistry::DataFormatter::add(unlocalizedName, [start, byteFormat, end](prv::Provider *provider, u64 offset, size_t size) {
+            return formatLanguageArray(provider, offset, size, start(size), byteFormat, end);
+        });
+
+        ContentRegistry::DataFormatter::addExport(
+            unlocalizedName, 16,
+            [start](u64, size_t totalSize) {
+                return start(totalSize);
+            },
+            [byteFormat](prv::Provider *provider, u64 address, size_t size, u64 startAddress, size_t totalSize) {
+                return formatLanguageArrayChunk(provider, address, size, startAddress, totalSize, byteFormat);
+            },
+            [end](u64, size_t) {
+                return "\n" + end;
+            });
+    }
+
     void registerDataFormatters() {
 
-        ContentRegistry::DataFormatter::add("hex.builtin.view.hex_editor.copy.c", [](prv::Provider *provider, u64 offset, size_t size) {
-            return formatLanguageArray(provider, offset, size, hex::format("const uint8_t data[{0}] = {{", size), "0x{0:02X}, ", "};");
-        });
+        addLanguageArrayFormatter("hex.builtin.view.hex_editor.copy.c", [](size_t size) { return hex::format("const uint8_t data[{0}] = {{", size); }, "0x{0:02X}, ", "};");
 
-        ContentRegistry::DataFormatter::add("hex.builtin.view.hex_editor.copy.cpp", [](prv::Provider *provider, u64 offset, size_t size) {
-            return formatLanguageArray(provider, offset, size, hex::format("constexpr std::array<uint8_t, {0}> data = {{", size), "0x{0:02X}, ", "};");
-        });
+        addLanguageArrayFormatter("hex.builtin.view.hex_editor.copy.cpp", [](size_t size) { return hex::format("constexpr std::array<uint8_t, {0}> data = {{", size); }, "0x{0:02X}, ", "};");
 
-        ContentRegistry::DataFormatter::add("hex.builtin.view.hex_editor.copy.java", [](prv::Provider *provider, u64 offset, size_t size) {
-            return formatLanguageArray(provider, offset, size, "final byte[] data = {", "0x{0:02X}, ", "};");
-        });
+        addLanguageArrayFormatter("hex.builtin.view.hex_editor.copy.java", [](size_t) { return std::string("final byte[] data = {"); }, "0x{0:02X}, ", "};");
 
-        ContentRegistry::DataFormatter::add("hex.builtin.view.hex_editor.copy.csharp", [](prv::Provider *provider, u64 offset, size_t size) {
-            return formatLanguageArray(provider, offset, size, "const byte[] data = {", "0x{0:02X}, ", "};");
-        });
+        addLanguageArrayFormatter("hex.builtin.view.hex_editor.copy.csharp", [](size_t) { return std::string("const byte[] data = {"); }, "0x{0:02X}, ", "};");
 
-        ContentRegistry::DataFormatter::add("hex.builtin.view.hex_editor.copy.rust", [](prv::Provider *provider, u64 offset, size_t size) {
-            return formatLanguageArray(provider, offset, size, hex::format("let data: [u8; 0x{0:02X}] = [", size), "0x{0:02X}, ", "];");
-        });
+        addLanguageArrayFormatter("hex.builtin.view.hex_editor.copy.rust", [](size_t size) { return hex::format("let data: [u8; 0x{0:02X}] = [", size); }, "0x{0:02X}, ", "];");
 
-        ContentRegistry::DataFormatter::add("hex.builtin.view.hex_editor.copy.python", [](prv::Provider *provider, u64 offset, size_t size) {
-            return formatLanguageArray(provider, offset, size, "data = bytes([", "0x{0:02X}, ", "])");
-        });
+        addLanguageArrayFormatter("hex.builtin.view.hex_editor.copy.python", [](size_t) { return std::string("data = bytes(["); }, "0x{0:02X}, ", "])");
 
-        ContentRegistry::DataFormatter::add("hex.builtin.view.hex_editor.copy.js", [](prv::Provider *provider, u64 offset, size_t size) {
-            return formatLanguageArray(provider, offset, size, "const data = new Uint8Array([", "0x{0:02X}, ", "]);");
-        });
+        addLanguageArrayFormatter("hex.builtin.view.hex_editor.copy.js", [](size_t) { return std::string("const data = new Uint8Array(["); }, "0x{0:02X}, ", "]);");
 
-        ContentRegistry::DataFormatter::add("hex.builtin.view.hex_editor.copy.lua", [](prv::Provider *provider, u64 offset, size_t size) {
-            return formatLanguageArray(provider, offset, size, "data = {", "0x{0:02X}, ", "}");
-        });
+        addLanguageArrayFormatter("hex.builtin.view.hex_editor.copy.lua", [](size_t) { return std::string("data = {"); }, "0x{0:02X}, ", "}");
 
-        ContentRegistry::DataFormatter::add("hex.builtin.view.hex_editor.copy.go", [](prv::Provider *provider, u64 offset, size_t size) {
-            return formatLanguageArray(provider, offset, size, "data := [...]byte {", "0x{0:02X}, ", "}");
-        });
+        addLanguageArrayFormatter("hex.builtin.view.hex_editor.copy.go", [](size_t) { return std::string("data := [...]byte {"); }, "0x{0:02X}, ", "}");
 
-        ContentRegistry::DataFormatter::add("hex.builtin.view.hex_editor.copy.crystal", [](prv::Provider *provider, u64 offset, size_t size) {
-            return formatLanguageArray(provider, offset, size, "data = [", "0x{0:02X}, ", "] of UInt8");
-        });
+        addLanguageArrayFormatter("hex.builtin.view.hex_editor.copy.crystal", [](size_t) { return std::string("data = ["); }, "0x{0:02X}, ", "] of UInt8");
 
-        ContentRegistry::DataFormatter::add("hex.builtin.view.hex_editor.copy.swift", [](prv::Provider *provider, u64 offset, size_t size) {
-            return formatLanguageArray(provider, offset, size, "let data: [Uint8] = [", "0x{0:02X}, ", "]");
-        });
+        addLanguageArrayFormatter("hex.builtin.view.hex_editor.copy.swift", [](size_t) { return std::string("let data: [Uint8] = ["); }, "0x{0:02X}, ", "]");
 
-        ContentRegistry::DataFormatter::add("hex.builtin.view.hex_editor.copy.pascal", [](prv::Provider *provider, u64 offset, size_t size) {
-            return formatLanguageArray(provider, offset, size, hex::format("data: array[0..{0}] of Byte = (", size - 1), "${0:02X}, ", ")");
-        });
+        addLanguageArrayFormatter("hex.builtin.view.hex_editor.copy.pascal", [](size_t size) { return hex::format("data: array[0..{0}] of Byte = (", size - 1); }, "${0:02X}, ", ")");
 
         ContentRegistry::DataFormatter::add("hex.builtin.view.hex_editor.copy.base64", [](prv::Provider *provider, u64 offset, size_t size) {
             std::vector<u8> data(size, 0x00);
@@ -100,6 +134,59 @@ namespace hex::plugin::builtin {
             return std::string(result.begin(), result.end());
         });
 
+        // Base64 encodes groups of three bytes independently, so chunks split on a
+        // multiple of three concatenate into one valid stream
+        ContentRegistry::DataFormatter::addExport(
+            "hex.builtin.view.hex_editor.copy.base64", 3,
+            [](u64, size_t) { return std::string(); },
+            [](prv::Provider *provider, u64 address, size_t size, u64, size_t) {
+                std::vector<u8> data(size, 0x00);
+                provider->read(address, data.data(), size);
+
+                auto result = crypt::encode64(data);
+
+                return std::string(result.begin(), result.end());
+            },
+            [](u64, size_t) { return std::string(); });
+
+        // The streamed hex dump aligns its rows to the region start instead of the
+        // absolute addresses, so every chunk begins on a fresh row
+        ContentRegistry::DataFormatter::addExport(
+            "hex.builtin.view.hex_editor.copy.ascii", 16,
+            [](u64, size_t) { return std::string("Hex View  00 01 02 03 04 05 06 07  08 09 0A 0B 0C 0D 0E 0F"); },
+            [](prv::Provider *provider, u64 address, size_t size, u64, size_t) {
+                std::vector<u8> data(size, 0x00);
+                provider->read(address, data.data(), size);
+
+                std::string result;
+                result.reserve((size / 0x10 + 1) * 80);
+
+                for (size_t row = 0; row < size; row += 0x10) {
+                    const size_t rowSize = std::min<size_t>(0x10, size - row);
+
+                    result += hex::format("\n{0:08X}  ", address + row);
+
+                    std::string asciiRow;
+                    for (size_t i = 0; i < 0x10; i++) {
+                        if (i < rowSize) {
+                            result += hexByteTable()[data[row + i]];
+                            asciiRow += std::isprint(data[row + i]) ? char(data[row + i]) : '.';
+                        } else {
+                            result += "   ";
+                        }
+
+                        if (i == 0x07)
+                            result += " ";
+                    }
+
+                    result += " ";
+                    result += asciiRow;
+                }
+
+                return result;
+            },
+            [](u64, size_t) { return std::string(); });
+
         ContentRegistry::DataFormatter::add("hex.builtin.view.hex_editor.copy.ascii", [](prv::Provider *provider, u64 offset, size_t size) {
             constexpr static auto HeaderLine = "Hex View  00 01 02 03 04 05 06 07  08 09 0A 0B 0C 0D 0E 0F\n";
             std::string result;
@@ -129,7 +216,7 @@ namespace hex::plugin::builtin {
                     }
                 }
 
-                result += hex::format("{0:02X} ", byte);
+                result += hexByteTable()[byte];
                 asciiRow += std::isprint(byte) ? char(byte) : '.';
                 if ((address % 0x10) == 0x07)
                     result += " ";
@@ -182,7 +269,7 @@ namespace hex::plugin::builtin {
                     result += "</span>";
                 }
 
-                result += hex::format("{0:02X} ", byte);
+                result += hexByteTable()[byte];
                 asciiRow += std::isprint(byte) ? char(byte) : '.';
                 if ((address % 0x10) == 0x07)
                     result += "&nbsp";
@@ -0,0 +1,183 @@
+#include <hex/api/content_registry.hpp>
+
+#include <hex/helpers/fmt.hpp>
+#include <hex/helpers/utils.hpp>
+
+#include <array>
+#include <cctype>
+#include <cmath>
+
+namespace hex::plugin::builtin {
+
+    // Pearson's chi-squared statistic of the byte distribution against a uniform
+    // distribution. Random data scores close to 256; text and code score far higher
+    class ChiSquaredMetric : public ContentRegistry::DataMetrics::Metric {
+    public:
+        ChiSquaredMetric() : Metric("hex.builtin.metric.chi_squared") {}
+
+        void reset() override {
+            this->m_valueCounts = { };
+            this->m_totalCount  = 0;
+        }
+
+        void process(std::span<const u8> data) override {
+            hex::countByteOccurrences(data, this->m_valueCounts);
+            this->m_totalCount += data.size();
+        }
+
+        std::string getResult() override {
+            if (this->m_totalCount == 0)
+                return "-";
+
+            const double expected = double(this->m_totalCount) / 256.0;
+
+            double chiSquared = 0;
+            for (const auto count : this->m_valueCounts) {
+                const double deviation = double(count) - expected;
+                chiSquared += (deviation * deviation) / expected;
+            }
+
+            return hex::format("{:.2f}", chiSquared);
+        }
+
+    private:
+        std::array<u64, 256> m_valueCounts = { };
+        u64 m_totalCount = 0;
+    };
+
+    // Fraction of bytes that are printable ASCII characters
+    class PrintableRatioMetric : public ContentRegistry::DataMetrics::Metric {
+    public:
+        PrintableRatioMetric() : Metric("hex.builtin.metric.printable_ratio") {}
+
+        void reset() override {
+            this->m_valueCounts = { };
+            this->m_totalCount  = 0;
+        }
+
+        void process(std::span<const u8> data) override {
+            hex::countByteOccurrences(data, this->m_valueCounts);
+            this->m_totalCount += data.size();
+        }
+
+        std::string getResult() override {
+            if (this->m_totalCount == 0)
+                return "-";
+
+            u64 printableCount = 0;
+            for (u32 byte = 0; byte < this->m_valueCounts.size(); byte++) {
+                if (std::isprint(byte) || std::isspace(byte))
+                    printableCount += this->m_valueCounts[byte];
+            }
+
+            return hex::format("{:.2f}%", (double(printableCount) / this->m_totalCount) * 100);
+        }
+
+    private:
+        std::array<u64, 256> m_valueCounts = { };
+        u64 m_totalCount = 0;
+    };
+
+    // Longest run of one repeated byte value. Long runs point at padding, erased
+    // flash regions or sparse areas
+    class LongestRunMetric : public ContentRegistry::DataMetrics::Metric {
+    public:
+        LongestRunMetric() : Metric("hex.builtin.metric.longest_run") {}
+
+        void reset() override {
+            this->m_currentByte   = 0x00;
+            this->m_currentLength = 0;
+            this->m_longestByte   = 0x00;
+            this->m_longestLength = 0;
+        }
+
+        void process(std::span<const u8> data) override {
+            // Runs continue across chunk boundaries, so the current run carries over
+            for (const u8 byte : data) {
+                if (byte == this->m_currentByte && this->m_currentLength > 0) {
+                    this->m_currentLength++;
+                } else {
+                    this->m_currentByte   = byte;
+                    this->m_currentLength = 1;
+                }
+
+                if (this->m_currentLength > this->m_longestLength) {
+                    this->m_longestByte   = this->m_currentByte;
+                    this->m_longestLength = this->m_currentLength;
+                }
+            }
+        }
+
+        std::string getResult() override {
+            if (this->m_longestLength == 0)
+                return "-";
+
+            return hex::format("{} x 0x{:02X}", this->m_longestLength, this->m_longestByte);
+        }
+
+    private:
+        u8 m_currentByte   = 0x00;
+        u64 m_currentLength = 0;
+        u8 m_longestByte   = 0x00;
+        u64 m_longestLength = 0;
+    };
+
+    // Serial correlation coefficient between consecutive bytes. Random data scores
+    // close to zero; structured data correlates noticeably
+    class SerialCorrelationMetric : public ContentRegistry::DataMetrics::Metric {
+    public:
+        SerialCorrelationMetric() : Metric("hex.builtin.metric.serial_correlation") {}
+
+        void reset() override {
+            this->m_productSum = 0;
+            this->m_valueSum   = 0;
+            this->m_squareSum  = 0;
+            this->m_pairCount  = 0;
+            this->m_hasPrevious = false;
+        }
+
+        void process(std::span<const u8> data) override {
+            for (const u8 byte : data) {
+                if (this->m_hasPrevious) {
+                    this->m_productSum += double(this->m_previousByte) * byte;
+                    this->m_valueSum   += this->m_previousByte;
+                    this->m_squareSum  += double(this->m_previousByte) * this->m_previousByte;
+                    this->m_pairCount++;
+                }
+
+                this->m_previousByte = byte;
+                this->m_hasPrevious  = true;
+            }
+        }
+
+        std::string getResult() override {
+            if (this->m_pairCount < 2)
+                return "-";
+
+            const double count       = this->m_pairCount;
+            const double numerator   = count * this->m_productSum - this->m_valueSum * this->m_valueSum;
+            const double denominator = count * this->m_squareSum - this->m_valueSum * this->m_valueSum;
+
+            if (denominator == 0)
+                return "-";
+
+            return hex::format("{:.6f}", numerator / denominator);
+        }
+
+    private:
+        double m_productSum = 0;
+        double m_valueSum   = 0;
+        double m_squareSum  = 0;
+        u64 m_pairCount     = 0;
+        u8 m_previousByte   = 0x00;
+        bool m_hasPrevious  = false;
+    };
+
+    void registerDataMetrics() {
+        ContentRegistry::DataMetrics::add<ChiSquaredMetric>();
+        ContentRegistry::DataMetrics::add<PrintableRatioMetric>();
+        ContentRegistry::DataMetrics::add<LongestRunMetric>();
+        ContentRegistry::DataMetrics::add<SerialCorrelationMetric>();
+    }
+
+}
@@ -10,6 +10,7 @@
 #include <content/helpers/provider_extra_data.hpp>
 
 #include <cctype>
+#include <optional>
 #include <random>
 
 #include <nlohmann/json.hpp>
@@ -26,7 +27,7 @@ namespace hex::plugin::builtin {
         NodeNullptr() : Node("hex.builtin.nodes.constants.nullptr.header", { dp::Attribute(dp::Attribute::IOType::Out, dp::Attribute::Type::Buffer, "") }) { }
 
         void process() override {
-            this->setBufferOnOutput(0, {});
+            this->setBufferOnOutput(0, std::vector<u8> { });
         }
     };
 
@@ -53,12 +54,19 @@ namespace hex::plugin::builtin {
             j = nlohmann::json::object();
 
             j["size"] = this->m_size;
-            j["data"] = this->m_buffer;
+
+            // Stored as a raw blob, so binary serialized graphs embed the buffer
+            // byte for byte instead of as one array element per byte
+            j["data"] = nlohmann::json::binary(std::vector<u8>(this->m_buffer));
         }
 
         void load(nlohmann::json &j) override {
-            this->m_size   = j["size"];
-            this->m_buffer = j["data"].get<std::vector<u8>>();
+            this->m_size = j["size"];
+
+            if (j["data"].is_binary())
+                this->m_buffer = j["data"].get_binary();
+            else
+                this->m_buffer = j["data"].get<std::vector<u8>>();
         }
 
     private:
@@ -277,7 +285,12 @@ namespace hex::plugin::builtin {
             if (ImGui::BeginChild("##hex_view", scaled(ImVec2(ImGui::CalcTextSize(Header.c_str()).x, 200)), true)) {
                 ImGui::TextUnformatted(Header.c_str());
 
-                auto size = this->m_buffer.size();
+                // The node only references the producer's immutable output, so the
+                // clipper formats just the visible lines and previewing a large
+                // intermediate neither copies it nor touches the rest of it
+                auto buffer = this->m_buffer;
+
+                auto size = buffer == nullptr ? 0 : buffer->size();
                 ImGuiListClipper clipper;
 
                 clipper.Begin((size + 0x0F) / 0x10);
@@ -289,7 +302,7 @@ namespace hex::plugin::builtin {
                         std::string line = hex::format(" {:08X}:  ", y * 0x10);
                         for (u32 x = 0; x < 0x10; x++) {
                             if (x < lineSize)
-                                line += hex::format("{:02X} ", this->m_buffer[y * 0x10 + x]);
+                                line += hex::format("{:02X} ", (*buffer)[y * 0x10 + x]);
                             else
                                 line += "   ";
 
@@ -299,7 +312,7 @@ namespace hex::plugin::builtin {
                         line += "   ";
 
                         for (u32 x = 0; x < lineSize; x++) {
-                            auto c = char(this->m_buffer[y * 0x10 + x]);
+                            auto c = char((*buffer)[y * 0x10 + x]);
                             if (std::isprint(c))
                                 line += c;
                             else
@@ -314,11 +327,11 @@ namespace hex::plugin::builtin {
         }
 
         void process() override {
-            this->m_buffer = this->getBufferOnInput(0);
+            this->m_buffer = this->getBufferSharedOnInput(0);
         }
 
     private:
-        std::vector<u8> m_buffer;
+        std::shared_ptr<std::vector<u8>> m_buffer;
     };
 
     class NodeDisplayString : public dp::Node {
@@ -328,17 +341,23 @@ namespace hex::plugin::builtin {
         void drawNode() override {
             constexpr static auto LineLength = 50;
             if (ImGui::BeginChild("##string_view", scaled(ImVec2(ImGui::CalcTextSize(" ").x * (LineLength + 4), 150)), true)) {
-                std::string_view string = this->m_value;
+                // Only the lines the clipper brings into view are escaped each
+                // frame, so a large input is never materialized as a full copy
+                auto buffer = this->m_buffer;
+
+                const u64 size = buffer == nullptr ? 0 : buffer->size();
 
                 ImGuiListClipper clipper;
-                clipper.Begin((string.length() + (LineLength - 1)) / LineLength);
+                clipper.Begin((size + (LineLength - 1)) / LineLength);
 
                 while (clipper.Step())
                     for (auto i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
-                        auto line = string.substr(i * LineLength, LineLength);
+                        const auto offset = u64(i) * LineLength;
+                        const auto line   = hex::encodeByteString({ buffer->begin() + offset, buffer->begin() + offset + std::min<u64>(LineLength, size - offset) });
+
                         ImGui::TextUnformatted("");
                         ImGui::SameLine();
-                        ImGui::TextUnformatted(line.data(), line.data() + line.length());
+                        ImGui::TextUnformatted(line.c_str());
                     }
 
                 clipper.End();
@@ -347,13 +366,11 @@ namespace hex::plugin::builtin {
         }
 
         void process() override {
-            auto input = this->getBufferOnInput(0);
-
-            this->m_value = hex::encodeByteString(input);
+            this->m_buffer = this->getBufferSharedOnInput(0);
         }
 
     private:
-        std::string m_value;
+        std::shared_ptr<std::vector<u8>> m_buffer;
     };
 
 
@@ -362,13 +379,21 @@ namespace hex::plugin::builtin {
         NodeBitwiseNOT() : Node("hex.builtin.nodes.bitwise.not.header", { dp::Attribute(dp::Attribute::IOType::In, dp::Attribute::Type::Buffer, "hex.builtin.nodes.common.input"), dp::Attribute(dp::Attribute::IOType::Out, dp::Attribute::Type::Buffer, "hex.builtin.nodes.common.output") }) { }
 
         void process() override {
-            auto input = this->getBufferOnInput(0);
+            auto output = this->getBufferOnInput(0);
 
-            std::vector<u8> output = input;
-            for (auto &byte : output)
-                byte = ~byte;
+            hex::bitwiseNot(output);
 
-            this->setBufferOnOutput(1, output);
+            this->setBufferOnOutput(1, std::move(output));
+        }
+
+        [[nodiscard]] bool isStreamable() const override { return true; }
+
+        std::optional<std::array<u8, 0x100>> getStreamByteMap() override {
+            std::array<u8, 0x100> table;
+            for (u32 byte = 0; byte < table.size(); byte++)
+                table[byte] = ~u8(byte);
+
+            return table;
         }
     };
 
@@ -377,16 +402,41 @@ namespace hex::plugin::builtin {
         NodeBitwiseAND() : Node("hex.builtin.nodes.bitwise.and.header", { dp::Attribute(dp::Attribute::IOType::In, dp::Attribute::Type::Buffer, "hex.builtin.nodes.common.input.a"), dp::Attribute(dp::Attribute::IOType::In, dp::Attribute::Type::Buffer, "hex.builtin.nodes.common.input.b"), dp::Attribute(dp::Attribute::IOType::Out, dp::Attribute::Type::Buffer, "hex.builtin.nodes.common.output") }) { }
 
         void process() override {
-            auto inputA = this->getBufferOnInput(0);
-            auto inputB = this->getBufferOnInput(1);
+            const auto &inputA = this->getBufferOnInput(0);
+            const auto &inputB = this->getBufferOnInput(1);
+
+            std::vector<u8> output(inputA.begin(), inputA.begin() + std::min(inputA.size(), inputB.size()));
+
+            hex::bitwiseAnd(output, inputB);
+
+            this->setBufferOnOutput(2, std::move(output));
+        }
+
+        [[nodiscard]] bool isStreamable() const override { return true; }
+        [[nodiscard]] std::optional<u32> getStreamInputIndex() const override { return 0; }
+
+        void resetStreamState() override {
+            this->m_streamOperand = this->getBufferSharedOnInput(1);
+            this->m_streamOffset  = 0;
+        }
+
+        // Same semantics as the materialized run: the output ends where the
+        // shorter of the two inputs ends
+        std::vector<u8> processStreamChunk(std::vector<u8> chunk) override {
+            const auto &operand = *this->m_streamOperand;
+            const auto remaining = operand.size() - std::min<u64>(operand.size(), this->m_streamOffset);
 
-            std::vector<u8> output(std::min(inputA.size(), inputB.size()), 0x00);
+            chunk.resize(std::min<u64>(chunk.size(), remaining));
+            hex::bitwiseAnd(chunk, std::span(operand).subspan(this->m_streamOffset, chunk.size()));
 
-            for (u32 i = 0; i < output.size(); i++)
-                output[i] = inputA[i] & inputB[i];
+            this->m_streamOffset += chunk.size();
 
-            this->setBufferOnOutput(2, output);
+            return chunk;
         }
+
+    private:
+        std::shared_ptr<std::vector<u8>> m_streamOperand;
+        u64 m_streamOffset = 0;
     };
 
     class NodeBitwiseOR : public dp::Node {
@@ -394,16 +444,39 @@ namespace hex::plugin::builtin {
         NodeBitwiseOR() : Node("hex.builtin.nodes.bitwise.or.header", { dp::Attribute(dp::Attribute::IOType::In, dp::Attribute::Type::Buffer, "hex.builtin.nodes.common.input.a"), dp::Attribute(dp::Attribute::IOType::In, dp::Attribute::Type::Buffer, "hex.builtin.nodes.common.input.b"), dp::Attribute(dp::Attribute::IOType::Out, dp::Attribute::Type::Buffer, "hex.builtin.nodes.common.output") }) { }
 
         void process() override {
-            auto inputA = this->getBufferOnInput(0);
-            auto inputB = this->getBufferOnInput(1);
+            const auto &inputA = this->getBufferOnInput(0);
+            const auto &inputB = this->getBufferOnInput(1);
+
+            std::vector<u8> output(inputA.begin(), inputA.begin() + std::min(inputA.size(), inputB.size()));
 
-            std::vector<u8> output(std::min(inputA.size(), inputB.size()), 0x00);
+            hex::bitwiseOr(output, inputB);
+
+            this->setBufferOnOutput(2, std::move(output));
+        }
 
-            for (u32 i = 0; i < output.size(); i++)
-                output[i] = inputA[i] | inputB[i];
+        [[nodiscard]] bool isStreamable() const override { return true; }
+        [[nodiscard]] std::optional<u32> getStreamInputIndex() const override { return 0; }
 
-            this->setBufferOnOutput(2, output);
+        void resetStreamState() override {
+            this->m_streamOperand = this->getBufferSharedOnInput(1);
+            this->m_streamOffset  = 0;
         }
+
+        std::vector<u8> processStreamChunk(std::vector<u8> chunk) override {
+            const auto &operand = *this->m_streamOperand;
+            const auto remaining = operand.size() - std::min<u64>(operand.size(), this->m_streamOffset);
+
+            chunk.resize(std::min<u64>(chunk.size(), remaining));
+            hex::bitwiseOr(chunk, std::span(operand).subspan(this->m_streamOffset, chunk.size()));
+
+            this->m_streamOffset += chunk.size();
+
+            return chunk;
+        }
+
+    private:
+        std::shared_ptr<std::vector<u8>> m_streamOperand;
+        u64 m_streamOffset = 0;
     };
 
     class NodeBitwiseXOR : public dp::Node {
@@ -411,16 +484,39 @@ namespace hex::plugin::builtin {
         NodeBitwiseXOR() : Node("hex.builtin.nodes.bitwise.xor.header", { dp::Attribute(dp::Attribute::IOType::In, dp::Attribute::Type::Buffer, "hex.builtin.nodes.common.input.a"), dp::Attribute(dp::Attribute::IOType::In, dp::Attribute::Type::Buffer, "hex.builtin.nodes.common.input.b"), dp::Attribute(dp::Attribute::IOType::Out, dp::Attribute::Type::Buffer, "hex.builtin.nodes.common.output") }) { }
 
         void process() override {
-            auto inputA = this->getBufferOnInput(0);
-            auto inputB = this->getBufferOnInput(1);
+            const auto &inputA = this->getBufferOnInput(0);
+            const auto &inputB = this->getBufferOnInput(1);
 
-            std::vector<u8> output(std::min(inputA.size(), inputB.size()), 0x00);
+            std::vector<u8> output(inputA.begin(), inputA.begin() + std::min(inputA.size(), inputB.size()));
 
-            for (u32 i = 0; i < output.size(); i++)
-                output[i] = inputA[i] ^ inputB[i];
+            hex::bitwiseXor(output, inputB);
 
-            this->setBufferOnOutput(2, output);
+            this->setBufferOnOutput(2, std::move(output));
         }
+
+        [[nodiscard]] bool isStreamable() const override { return true; }
+        [[nodiscard]] std::optional<u32> getStreamInputIndex() const override { return 0; }
+
+        void resetStreamState() override {
+            this->m_streamOperand = this->getBufferSharedOnInput(1);
+            this->m_streamOffset  = 0;
+        }
+
+        std::vector<u8> processStreamChunk(std::vector<u8> chunk) override {
+            const auto &operand = *this->m_streamOperand;
+            const auto remaining = operand.size() - std::min<u64>(operand.size(), this->m_streamOffset);
+
+            chunk.resize(std::min<u64>(chunk.size(), remaining));
+            hex::bitwiseXor(chunk, std::span(operand).subspan(this->m_streamOffset, chunk.size()));
+
+            this->m_streamOffset += chunk.size();
+
+            return chunk;
+        }
+
+    private:
+        std::shared_ptr<std::vector<u8>> m_streamOperand;
+        u64 m_streamOffset = 0;
     };
 
     class NodeReadData : public dp::Node {
@@ -436,8 +532,31 @@ namespace hex::plugin::builtin {
 
             ImHexApi::Provider::get()->readRaw(address, data.data(), size);
 
-            this->setBufferOnOutput(2, data);
+            this->setBufferOnOutput(2, std::move(data));
+        }
+
+        [[nodiscard]] bool isStreamSource() const override { return true; }
+
+        void resetStreamState() override {
+            this->m_streamAddress = u64(this->getIntegerOnInput(0));
+            this->m_streamSize    = u64(this->getIntegerOnInput(1));
+        }
+
+        u64 getStreamSize() override {
+            return this->m_streamSize;
+        }
+
+        std::vector<u8> readStreamChunk(u64 offset, size_t size) override {
+            std::vector<u8> data;
+            data.resize(size);
+
+            ImHexApi::Provider::get()->readRaw(this->m_streamAddress + offset, data.data(), size);
+
+            return data;
         }
+
+    private:
+        u64 m_streamAddress = 0, m_streamSize = 0;
     };
 
     class NodeWriteData : public dp::Node {
@@ -445,11 +564,21 @@ namespace hex::plugin::builtin {
         NodeWriteData() : Node("hex.builtin.nodes.data_access.write.header", { dp::Attribute(dp::Attribute::IOType::In, dp::Attribute::Type::Integer, "hex.builtin.nodes.data_access.write.address"), dp::Attribute(dp::Attribute::IOType::In, dp::Attribute::Type::Buffer, "hex.builtin.nodes.data_access.write.data") }) { }
 
         void process() override {
-            auto address = this->getIntegerOnInput(0);
-            auto data    = this->getBufferOnInput(1);
+            auto address      = this->getIntegerOnInput(0);
+            const auto &data  = this->getBufferOnInput(1);
 
             this->setOverlayData(address, data);
         }
+
+        [[nodiscard]] bool isStreamSink() const override { return true; }
+
+        void resetStreamState() override {
+            this->setOverlayData(u64(this->getIntegerOnInput(0)), { });
+        }
+
+        void writeStreamChunk(std::vector<u8> chunk) override {
+            this->appendOverlayData(chunk);
+        }
     };
 
     class NodeDataSize : public dp::Node {
@@ -496,7 +625,7 @@ namespace hex::plugin::builtin {
             std::vector<u8> output(sizeof(input), 0x00);
             std::memcpy(output.data(), &input, sizeof(input));
 
-            this->setBufferOnOutput(1, output);
+            this->setBufferOnOutput(1, std::move(output));
         }
     };
 
@@ -505,7 +634,7 @@ namespace hex::plugin::builtin {
         NodeCastBufferToInteger() : Node("hex.builtin.nodes.casting.buffer_to_int.header", { dp::Attribute(dp::Attribute::IOType::In, dp::Attribute::Type::Buffer, "hex.builtin.nodes.common.input"), dp::Attribute(dp::Attribute::IOType::Out, dp::Attribute::Type::Integer, "hex.builtin.nodes.common.output") }) { }
 
         void process() override {
-            auto input = this->getBufferOnInput(0);
+            const auto &input = this->getBufferOnInput(0);
 
             i64 output = 0;
             if (input.empty() || input.size() > sizeof(output))
@@ -527,7 +656,7 @@ namespace hex::plugin::builtin {
             std::vector<u8> output(sizeof(input), 0x00);
             std::memcpy(output.data(), &input, sizeof(input));
 
-            this->setBufferOnOutput(1, output);
+            this->setBufferOnOutput(1, std::move(output));
         }
     };
 
@@ -536,7 +665,7 @@ namespace hex::plugin::builtin {
         NodeCastBufferToFloat() : Node("hex.builtin.nodes.casting.buffer_to_float.header", { dp::Attribute(dp::Attribute::IOType::In, dp::Attribute::Type::Buffer, "hex.builtin.nodes.common.input"), dp::Attribute(dp::Attribute::IOType::Out, dp::Attribute::Type::Float, "hex.builtin.nodes.common.output") }) { }
 
         void process() override {
-            auto input = this->getBufferOnInput(0);
+            const auto &input = this->getBufferOnInput(0);
 
             float output = 0;
             if (input.empty() || input.size() != sizeof(output))
@@ -629,7 +758,7 @@ namespace hex::plugin::builtin {
         NodeArithmeticAverage() : Node("hex.builtin.nodes.arithmetic.average.header", { dp::Attribute(dp::Attribute::IOType::In, dp::Attribute::Type::Buffer, "hex.builtin.nodes.common.input"), dp::Attribute(dp::Attribute::IOType::Out, dp::Attribute::Type::Integer, "hex.builtin.nodes.common.output") }) { }
 
         void process() override {
-            auto input = this->getBufferOnInput(0);
+            const auto &input = this->getBufferOnInput(0);
 
             double output = std::reduce(input.begin(), input.end(), double(0)) / double(input.size());
 
@@ -664,13 +793,12 @@ namespace hex::plugin::builtin {
         NodeBufferCombine() : Node("hex.builtin.nodes.buffer.combine.header", { dp::Attribute(dp::Attribute::IOType::In, dp::Attribute::Type::Buffer, "hex.builtin.nodes.common.input.a"), dp::Attribute(dp::Attribute::IOType::In, dp::Attribute::Type::Buffer, "hex.builtin.nodes.common.input.b"), dp::Attribute(dp::Attribute::IOType::Out, dp::Attribute::Type::Buffer, "hex.builtin.nodes.common.output") }) { }
 
         void process() override {
-            auto inputA = this->getBufferOnInput(0);
-            auto inputB = this->getBufferOnInput(1);
+            auto output = this->getBufferOnInput(0);
+            const auto &inputB = this->getBufferOnInput(1);
 
-            auto &output = inputA;
             std::copy(inputB.begin(), inputB.end(), std::back_inserter(output));
 
-            this->setBufferOnOutput(2, output);
+            this->setBufferOnOutput(2, std::move(output));
         }
     };
 
@@ -679,7 +807,7 @@ namespace hex::plugin::builtin {
         NodeBufferSlice() : Node("hex.builtin.nodes.buffer.slice.header", { dp::Attribute(dp::Attribute::IOType::In, dp::Attribute::Type::Buffer, "hex.builtin.nodes.buffer.slice.input.buffer"), dp::Attribute(dp::Attribute::IOType::In, dp::Attribute::Type::Integer, "hex.builtin.nodes.buffer.slice.input.from"), dp::Attribute(dp::Attribute::IOType::In, dp::Attribute::Type::Integer, "hex.builtin.nodes.buffer.slice.input.to"), dp::Attribute(dp::Attribute::IOType::Out, dp::Attribute::Type::Buffer, "hex.builtin.nodes.common.output") }) { }
 
         void process() override {
-            auto input = this->getBufferOnInput(0);
+            const auto &input = this->getBufferOnInput(0);
             auto from  = this->getIntegerOnInput(1);
             auto to    = this->getIntegerOnInput(2);
 
@@ -699,7 +827,7 @@ namespace hex::plugin::builtin {
         NodeBufferRepeat() : Node("hex.builtin.nodes.buffer.repeat.header", { dp::Attribute(dp::Attribute::IOType::In, dp::Attribute::Type::Buffer, "hex.builtin.nodes.buffer.repeat.input.buffer"), dp::Attribute(dp::Attribute::IOType::In, dp::Attribute::Type::Integer, "hex.builtin.nodes.buffer.repeat.input.count"), dp::Attribute(dp::Attribute::IOType::Out, dp::Attribute::Type::Buffer, "hex.builtin.nodes.common.output") }) { }
 
         void process() override {
-            auto buffer = this->getBufferOnInput(0);
+            const auto &buffer = this->getBufferOnInput(0);
             auto count  = this->getIntegerOnInput(1);
 
             std::vector<u8> output;
@@ -708,7 +836,7 @@ namespace hex::plugin::builtin {
             for (u32 i = 0; i < count; i++)
                 std::copy(buffer.begin(), buffer.end(), output.begin() + buffer.size() * i);
 
-            this->setBufferOnOutput(2, output);
+            this->setBufferOnOutput(2, std::move(output));
         }
     };
 
@@ -717,9 +845,9 @@ namespace hex::plugin::builtin {
         NodeBufferPatch() : Node("hex.builtin.nodes.buffer.patch.header", { dp::Attribute(dp::Attribute::IOType::In, dp::Attribute::Type::Buffer, "hex.builtin.nodes.common.input"), dp::Attribute(dp::Attribute::IOType::In, dp::Attribute::Type::Buffer, "hex.builtin.nodes.buffer.patch.input.patch"), dp::Attribute(dp::Attribute::IOType::In, dp::Attribute::Type::Integer, "hex.builtin.common.address"), dp::Attribute(dp::Attribute::IOType::Out, dp::Attribute::Type::Buffer, "hex.builtin.nodes.common.output") }) { }
 
         void process() override {
-            auto buffer     = this->getBufferOnInput(0);
-            auto patch      = this->getBufferOnInput(1);
-            auto address    = this->getIntegerOnInput(2);
+            auto buffer        = this->getBufferOnInput(0);
+            const auto &patch  = this->getBufferOnInput(1);
+            auto address       = this->getIntegerOnInput(2);
 
             if (address < 0 || static_cast<u128>(address) >= buffer.size())
                 throwNodeError("Address out of range");
@@ -729,7 +857,7 @@ namespace hex::plugin::builtin {
 
             std::copy(patch.begin(), patch.end(), buffer.begin() + address);
 
-            this->setBufferOnOutput(3, buffer);
+            this->setBufferOnOutput(3, std::move(buffer));
         }
     };
 
@@ -743,13 +871,13 @@ namespace hex::plugin::builtin {
 
         void process() override {
             auto cond      = this->getIntegerOnInput(0);
-            auto trueData  = this->getBufferOnInput(1);
-            auto falseData = this->getBufferOnInput(2);
+            auto trueData  = this->getBufferSharedOnInput(1);
+            auto falseData = this->getBufferSharedOnInput(2);
 
             if (cond != 0)
-                this->setBufferOnOutput(3, trueData);
+                this->setBufferOnOutput(3, std::move(trueData));
             else
-                this->setBufferOnOutput(3, falseData);
+                this->setBufferOnOutput(3, std::move(falseData));
         }
     };
 
@@ -858,10 +986,10 @@ namespace hex::plugin::builtin {
         }
 
         void process() override {
-            auto key   = this->getBufferOnInput(0);
-            auto iv    = this->getBufferOnInput(1);
-            auto nonce = this->getBufferOnInput(2);
-            auto input = this->getBufferOnInput(3);
+            const auto &key   = this->getBufferOnInput(0);
+            const auto &iv    = this->getBufferOnInput(1);
+            const auto &nonce = this->getBufferOnInput(2);
+            const auto &input = this->getBufferOnInput(3);
 
             if (key.empty())
                 throwNodeError("Key cannot be empty");
@@ -876,7 +1004,7 @@ namespace hex::plugin::builtin {
 
             auto output = crypt::aesDecrypt(static_cast<crypt::AESMode>(this->m_mode), static_cast<crypt::KeyLength>(this->m_keyLength), key, nonceData, ivData, input);
 
-            this->setBufferOnOutput(4, output);
+            this->setBufferOnOutput(4, std::move(output));
         }
 
         void store(nlohmann::json &j) override {
@@ -902,12 +1030,42 @@ namespace hex::plugin::builtin {
         NodeDecodingBase64() : Node("hex.builtin.nodes.decoding.base64.header", { dp::Attribute(dp::Attribute::IOType::In, dp::Attribute::Type::Buffer, "hex.builtin.nodes.common.input"), dp::Attribute(dp::Attribute::IOType::Out, dp::Attribute::Type::Buffer, "hex.builtin.nodes.common.output") }) { }
 
         void process() override {
-            auto input = this->getBufferOnInput(0);
+            const auto &input = this->getBufferOnInput(0);
 
             auto output = crypt::decode64(input);
 
-            this->setBufferOnOutput(1, output);
+            this->setBufferOnOutput(1, std::move(output));
+        }
+
+        [[nodiscard]] bool isStreamable() const override { return true; }
+
+        void resetStreamState() override {
+            this->m_carry.clear();
+        }
+
+        // Base64 decodes groups of four characters independently, so everything up
+        // to the last full group can be decoded right away and the remainder is
+        // carried over into the next chunk
+        std::vector<u8> processStreamChunk(std::vector<u8> chunk) override {
+            if (!this->m_carry.empty()) {
+                chunk.insert(chunk.begin(), this->m_carry.begin(), this->m_carry.end());
+                this->m_carry.clear();
+            }
+
+            const auto remainder = chunk.size() % 4;
+            this->m_carry.assign(chunk.end() - remainder, chunk.end());
+            chunk.resize(chunk.size() - remainder);
+
+            return crypt::decode64(chunk);
         }
+
+        void finishStream() override {
+            if (!this->m_carry.empty())
+                throwNodeError("Base64 stream ended with a partial group");
+        }
+
+    private:
+        std::vector<u8> m_carry;
     };
 
     class NodeDecodingHex : public dp::Node {
@@ -915,12 +1073,46 @@ namespace hex::plugin::builtin {
         NodeDecodingHex() : Node("hex.builtin.nodes.decoding.hex.header", { dp::Attribute(dp::Attribute::IOType::In, dp::Attribute::Type::Buffer, "hex.builtin.nodes.common.input"), dp::Attribute(dp::Attribute::IOType::Out, dp::Attribute::Type::Buffer, "hex.builtin.nodes.common.output") }) { }
 
         void process() override {
-            auto input = this->getBufferOnInput(0);
+            const auto &input = this->getBufferOnInput(0);
 
             if (input.size() % 2 != 0)
                 throwNodeError("Can't decode odd number of hex characters");
 
+            this->setBufferOnOutput(1, decodeHex(input));
+        }
+
+        [[nodiscard]] bool isStreamable() const override { return true; }
+
+        void resetStreamState() override {
+            this->m_carry.reset();
+        }
+
+        // Hex decodes pairs of characters independently, so an odd chunk keeps its
+        // last character around until the next chunk provides the second nibble
+        std::vector<u8> processStreamChunk(std::vector<u8> chunk) override {
+            if (this->m_carry.has_value()) {
+                chunk.insert(chunk.begin(), *this->m_carry);
+                this->m_carry.reset();
+            }
+
+            if (chunk.size() % 2 != 0) {
+                this->m_carry = chunk.back();
+                chunk.pop_back();
+            }
+
+            return decodeHex(chunk);
+        }
+
+        void finishStream() override {
+            if (this->m_carry.has_value())
+                throwNodeError("Can't decode odd number of hex characters");
+        }
+
+    private:
+        std::vector<u8> decodeHex(const std::vector<u8> &input) {
             std::vector<u8> output;
+            output.reserve(input.size() / 2);
+
             for (u32 i = 0; i < input.size(); i += 2) {
                 char c1 = static_cast<char>(std::tolower(input[i]));
                 char c2 = static_cast<char>(std::tolower(input[i + 1]));
@@ -942,8 +1134,10 @@ namespace hex::plugin::builtin {
                 output.push_back(value);
             }
 
-            this->setBufferOnOutput(1, output);
+            return output;
         }
+
+        std::optional<u8> m_carry;
     };
 
     class NodeVisualizerDigram : public dp::Node {
@@ -988,7 +1182,7 @@ namespace hex::plugin::builtin {
 
             this->m_buffer.clear();
 
-            auto buffer = this->getBufferOnInput(0);
+            const auto &buffer = this->getBufferOnInput(0);
             if (buffer.size() < SampleSize)
                 this->m_buffer = buffer;
             else {
@@ -1079,7 +1273,7 @@ namespace hex::plugin::builtin {
 
             this->m_buffer.clear();
 
-            auto buffer = this->getBufferOnInput(0);
+            const auto &buffer = this->getBufferOnInput(0);
             if (buffer.size() < SampleSize)
                 this->m_buffer = buffer;
             else {
@@ -1143,7 +1337,7 @@ namespace hex::plugin::builtin {
         }
 
         void process() override {
-            auto rawData = this->getBufferOnInput(0);
+            const auto &rawData = this->getBufferOnInput(0);
 
             this->m_texture = ImGui::Texture(rawData.data(), rawData.size());
         }
@@ -1168,7 +1362,7 @@ namespace hex::plugin::builtin {
         void process() override {
             this->m_texture = { };
 
-            const auto rawData = this->getBufferOnInput(0);
+            const auto &rawData = this->getBufferOnInput(0);
             const auto width = this->getIntegerOnInput(1);
             const auto height = this->getIntegerOnInput(2);
 
@@ -1216,7 +1410,7 @@ namespace hex::plugin::builtin {
         }
 
         void process() override {
-            auto buffer = this->getBufferOnInput(0);
+            const auto &buffer = this->getBufferOnInput(0);
 
             this->m_counts.fill(0x00);
             for (const auto &byte : buffer) {
@@ -1253,7 +1447,7 @@ namespace hex::plugin::builtin {
                         std::vector<u8> buffer(std::min<size_t>(sizeof(value), 8));
                         std::memcpy(buffer.data(), &value, buffer.size());
 
-                        this->setBufferOnOutput(0, buffer);
+                        this->setBufferOnOutput(0, std::move(buffer));
                     }
                 }, outVars.at(this->m_name));
             } else {
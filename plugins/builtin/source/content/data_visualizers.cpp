@@ -50,6 +50,15 @@ namespace hex::plugin::builtin {
                 ImGui::TextFormatted("{: {}s}", CharCount);
         }
 
+        [[nodiscard]] std::optional<std::string> format(u64 address, const u8 *data, size_t size, bool upperCase) override {
+            hex::unused(address);
+
+            if (size == ByteCount)
+                return hex::format(upperCase ? "{:0{}X}" : "{:0{}x}", *reinterpret_cast<const T*>(data), CharCount);
+            else
+                return std::string(CharCount, ' ');
+        }
+
         bool drawEditing(u64 address, u8 *data, size_t size, bool upperCase, bool startedEditing) override {
             hex::unused(address, startedEditing);
 
@@ -103,6 +112,26 @@ namespace hex::plugin::builtin {
                 ImGui::TextFormatted("{: {}s}", CharCount);
         }
 
+        [[nodiscard]] std::optional<std::string> format(u64 address, const u8 *data, size_t size, bool upperCase) override {
+            hex::unused(address);
+
+            if (size != ByteCount)
+                return std::string(CharCount, ' ');
+
+            const u8 c = data[0];
+            switch (c) {
+                case 0x00:
+                    return "  ";
+                case 0xFF:
+                    // Rendered greyed-out, which cached plain text can't reproduce
+                    return std::nullopt;
+                case ' ' ... '~':
+                    return std::string { '.', char(c) };
+                default:
+                    return hex::format(upperCase ? "{:02X}" : "{:02x}", c);
+            }
+        }
+
         bool drawEditing(u64 address, u8 *data, size_t size, bool upperCase, bool startedEditing) override {
             hex::unused(address, startedEditing);
 
@@ -146,6 +175,19 @@ namespace hex::plugin::builtin {
                 ImGui::TextFormatted("{: {}s}", CharCount);
         }
 
+        [[nodiscard]] std::optional<std::string> format(u64 address, const u8 *data, size_t size, bool upperCase) override {
+            hex::unused(address, upperCase);
+
+            if (size == ByteCount) {
+                if (std::is_signed<T>::value)
+                    return hex::format("{:{}}", static_cast<i64>(*reinterpret_cast<const T*>(data)), CharCount);
+                else
+                    return hex::format("{:{}}", static_cast<u64>(*reinterpret_cast<const T*>(data)), CharCount);
+            }
+            else
+                return std::string(CharCount, ' ');
+        }
+
         bool drawEditing(u64 address, u8 *data, size_t size, bool upperCase, bool startedEditing) override {
             hex::unused(address, upperCase, startedEditing);
 
@@ -190,6 +232,15 @@ namespace hex::plugin::builtin {
                 ImGui::TextFormatted("{: {}s}", CharCount);
         }
 
+        [[nodiscard]] std::optional<std::string> format(u64 address, const u8 *data, size_t size, bool upperCase) override {
+            hex::unused(address);
+
+            if (size == ByteCount)
+                return hex::format(upperCase ? "{:{}G}" : "{:{}g}", *reinterpret_cast<const T*>(data), CharCount);
+            else
+                return std::string(CharCount, ' ');
+        }
+
         bool drawEditing(u64 address, u8 *data, size_t size, bool upperCase, bool startedEditing) override {
             hex::unused(address, upperCase, startedEditing);
 
@@ -236,6 +287,15 @@ namespace hex::plugin::builtin {
                 ImGui::TextFormatted("{: {}s}", CharCount);
         }
 
+        [[nodiscard]] std::optional<std::string> format(u64 address, const u8 *data, size_t size, bool upperCase) override {
+            hex::unused(address);
+
+            if (size == ByteCount)
+                return hex::format(upperCase ? "{:{}G}" : "{:{}g}", hex::float16ToFloat32(*reinterpret_cast<const u16*>(data)), CharCount);
+            else
+                return std::string(CharCount, ' ');
+        }
+
         bool drawEditing(u64 address, u8 *data, size_t size, bool upperCase, bool startedEditing) override {
             hex::unused(startedEditing);
 
@@ -6,11 +6,16 @@
 #include <hex/api/localization.hpp>
 #include <hex/helpers/file.hpp>
 #include <hex/helpers/logger.hpp>
+#include <hex/helpers/memory_tracker.hpp>
+#include <hex/api/memory_governor.hpp>
+#include <hex/api/crash_recovery.hpp>
 #include <hex/api/project_file_manager.hpp>
 
 #include <imgui.h>
 #include <nlohmann/json.hpp>
 
+#include <content/helpers/file_hashes.hpp>
+#include <content/helpers/magic_info.hpp>
 #include <content/helpers/provider_extra_data.hpp>
 
 #include <content/providers/file_provider.hpp>
@@ -21,8 +26,23 @@ namespace hex::plugin::builtin {
         auto provider = ImHexApi::Provider::createProvider("hex.builtin.provider.file", true);
         if (auto *fileProvider = dynamic_cast<prv::FileProvider*>(provider); fileProvider != nullptr) {
             fileProvider->setPath(path);
-            if (fileProvider->open())
-                EventManager::post<EventProviderOpened>(fileProvider);
+
+            // Mapping the file can take a while and a drop can carry many files at
+            // once, so every file opens in its own background task. The tabs appear
+            // immediately and each becomes ready as soon as its open finishes,
+            // instead of the UI thread blocking on one open after another
+            TaskManager::createBackgroundTask("hex.builtin.common.processing", [fileProvider](auto &) {
+                const bool opened = fileProvider->open();
+
+                TaskManager::doLater([fileProvider, opened] {
+                    if (opened) {
+                        EventManager::post<EventProviderOpened>(fileProvider);
+                    } else {
+                        View::showErrorPopup("hex.builtin.popup.error.open"_lang);
+                        ImHexApi::Provider::remove(fileProvider);
+                    }
+                });
+            });
         }
     }
 
@@ -55,6 +75,34 @@ namespace hex::plugin::builtin {
         EventManager::subscribe<EventProviderOpened>([](hex::prv::Provider *provider) {
             if (provider != nullptr && ImHexApi::Provider::get() == provider)
                 EventManager::post<RequestChangeWindowTitle>(provider->getName());
+
+            if (provider != nullptr && provider->isReadable()) {
+                updateFileHashes(provider);
+                updateMagicInfo(provider);
+            }
+        });
+
+        EventManager::subscribe<EventRegionDirtied>([](hex::prv::Provider *provider, const Region &) {
+            // The cached whole-file digests cover the old contents now. The views kick
+            // off a new pass lazily the next time the cache is looked at
+            auto &fileHashes = ProviderExtraData::get(provider).fileHashes;
+
+            fileHashes.valid = false;
+            fileHashes.generation++;
+
+            // Same for the selection statistics histogram
+            auto &selectionStats = ProviderExtraData::get(provider).selectionStats;
+
+            selectionStats.valid = false;
+            selectionStats.generation++;
+
+            // The changed patches get journaled with the next group commit
+            CrashRecovery::providerDirtied(provider);
+        });
+
+        // Throttled internally, so this only turns into disk writes every few seconds
+        EventManager::subscribe<EventFrameEnd>([] {
+            CrashRecovery::commit();
         });
 
         EventManager::subscribe<RequestOpenFile>(openFile);
@@ -89,7 +137,105 @@ namespace hex::plugin::builtin {
             EventManager::post<EventHighlightingChanged>();
         });
 
+        // The reconstructible analysis caches count towards the memory budget. With
+        // many large providers open, the least-recently-viewed ones get their caches
+        // dropped; the views rebuild them lazily when the tab is revisited
+        MemoryGovernor::registerReclaimer({
+            .name = "Provider analysis caches",
+            .getFootprint = [](hex::prv::Provider *provider) {
+                const auto &data = ProviderExtraData::get(provider);
+
+                size_t footprint = data.miniMap.colors.capacity() * sizeof(color_t);
+                for (const auto &[name, digest] : data.fileHashes.digests)
+                    footprint += digest.capacity();
+
+                return footprint;
+            },
+            .evict = [](hex::prv::Provider *provider) {
+                auto &data = ProviderExtraData::get(provider);
+
+                auto &miniMap = data.miniMap;
+                if (!miniMap.updating) {
+                    miniMap.colors       = { };
+                    miniMap.sampleCount  = 0;
+                    miniMap.analyzedSize = 0;
+                }
+
+                auto &fileHashes = data.fileHashes;
+                if (!fileHashes.updating) {
+                    fileHashes.digests.clear();
+                    fileHashes.valid = false;
+                    fileHashes.generation++;
+                }
+            }
+        });
+
+        EventManager::subscribe<EventProviderChanged>([](hex::prv::Provider *, hex::prv::Provider *newProvider) {
+            MemoryGovernor::providerTouched(newProvider);
+            MemoryGovernor::enforce();
+        });
+
+        // Feed the tagged allocation tracker the sizes of the per-provider
+        // blobs, so memory growth in long sessions shows up attributed to its
+        // owner instead of as one opaque RSS number
+        mem::registerPolledTag("Pattern console", [] {
+            u64 bytes = 0, allocations = 0;
+            for (const auto provider : ImHexApi::Provider::getProviders()) {
+                auto &console = ProviderExtraData::get(provider).patternLanguage.console;
+
+                std::scoped_lock lock(console.mutex);
+                for (const auto &[level, line] : console.lines)
+                    bytes += sizeof(ProviderExtraData::Data::PatternLanguage::Console::Line) + line.capacity();
+                allocations += console.lines.size();
+            }
+
+            return std::pair(bytes, allocations);
+        });
+
+        mem::registerPolledTag("Analysis caches", [] {
+            u64 bytes = 0, allocations = 0;
+            for (const auto provider : ImHexApi::Provider::getProviders()) {
+                const auto &data = ProviderExtraData::get(provider);
+
+                bytes += data.miniMap.colors.capacity() * sizeof(color_t);
+                if (!data.miniMap.colors.empty())
+                    allocations++;
+
+                for (const auto &[name, digest] : data.fileHashes.digests) {
+                    bytes += digest.capacity();
+                    allocations++;
+                }
+            }
+
+            return std::pair(bytes, allocations);
+        });
+
+        mem::registerPolledTag("Bookmarks", [] {
+            u64 bytes = 0, allocations = 0;
+            for (const auto provider : ImHexApi::Provider::getProviders()) {
+                for (const auto &bookmark : ProviderExtraData::get(provider).bookmarks) {
+                    bytes += sizeof(bookmark) + bookmark.name.capacity() + bookmark.comment.capacity();
+                    allocations++;
+                }
+            }
+
+            return std::pair(bytes, allocations);
+        });
+
+        EventManager::subscribe<EventSettingsChanged>([] {
+            const auto budget = std::max<i64>(0, ContentRegistry::Settings::read("hex.builtin.setting.general", "hex.builtin.setting.general.cache_budget", 0));
+
+            MemoryGovernor::setBudget(size_t(budget) * 0x10'0000);
+
+            const auto undoBudget = std::max<i64>(0, ContentRegistry::Settings::read("hex.builtin.setting.general", "hex.builtin.setting.general.undo_budget", 256));
+            for (const auto provider : ImHexApi::Provider::getProviders())
+                provider->setUndoMemoryLimit(size_t(undoBudget) * 0x10'0000);
+        });
+
         EventManager::subscribe<EventProviderCreated>([](hex::prv::Provider *provider) {
+            const auto undoBudget = std::max<i64>(0, ContentRegistry::Settings::read("hex.builtin.setting.general", "hex.builtin.setting.general.undo_budget", 256));
+            provider->setUndoMemoryLimit(size_t(undoBudget) * 0x10'0000);
+
             if (provider->shouldSkipLoadInterface())
                 return;
 
@@ -120,9 +266,47 @@ namespace hex::plugin::builtin {
         });
 
         EventManager::subscribe<EventProviderDeleted>([](hex::prv::Provider *provider) {
+            MemoryGovernor::providerClosed(provider);
+            CrashRecovery::providerClosed(provider);
             ProviderExtraData::erase(provider);
         });
 
+        EventManager::subscribe<EventWindowInitialized>([] {
+            for (const auto &recovery : CrashRecovery::getPendingRecoveries()) {
+                auto provider = ImHexApi::Provider::createProvider(recovery.providerType, true);
+                if (provider == nullptr) {
+                    // Leave the journal alone, the missing provider type might come
+                    // from a plugin that simply isn't loaded right now
+                    log::error("Cannot restore unsaved changes, provider type '{}' is not available", recovery.providerType);
+                    continue;
+                }
+
+                bool restored = false;
+                try {
+                    provider->loadSettings(nlohmann::json::parse(recovery.settings));
+
+                    if (provider->open() && provider->isAvailable())
+                        restored = CrashRecovery::restore(recovery, provider);
+                } catch (const std::exception &e) {
+                    log::error("Failed to restore unsaved changes of '{}': {}", recovery.providerType, e.what());
+                }
+
+                if (restored) {
+                    log::info("Restored unsaved changes of provider '{}'", provider->getName());
+
+                    // Re-journal the restored patches immediately so another crash
+                    // before the next edit doesn't lose them, then drop the old journal
+                    CrashRecovery::providerDirtied(provider);
+                    CrashRecovery::commit(true);
+                    CrashRecovery::discard(recovery);
+
+                    EventManager::post<EventProviderOpened>(provider);
+                } else {
+                    ImHexApi::Provider::remove(provider);
+                }
+            }
+        });
+
         fs::setFileBrowserErrorCallback([]{
             #if defined(NFD_PORTAL)
                 View::showErrorPopup("hex.builtin.popup.error.file_dialog.portal"_lang);
@@ -1,11 +1,36 @@
 #include <hex/api/content_registry.hpp>
 #include <hex/api/localization.hpp>
 #include <hex/helpers/crypto.hpp>
+#include <hex/helpers/literals.hpp>
+#include <hex/providers/chunk_pipeline.hpp>
 
 #include <hex/ui/imgui_imhex_extensions.h>
 
+#include <atomic>
+#include <thread>
+
 namespace hex::plugin::builtin {
 
+    using namespace hex::literals;
+
+    // Adapts the crypt streaming contexts to the registry's context interface so
+    // views can feed all selected hashes from one shared pass over the data
+    class StreamContext : public ContentRegistry::Hashes::Hash::Function::Context {
+    public:
+        explicit StreamContext(std::unique_ptr<crypt::HashStream> &&stream) : m_stream(std::move(stream)) {}
+
+        void update(const u8 *data, size_t size) override {
+            this->m_stream->update(data, size);
+        }
+
+        std::vector<u8> finish() override {
+            return this->m_stream->finish();
+        }
+
+    private:
+        std::unique_ptr<crypt::HashStream> m_stream;
+    };
+
     class HashMD5 : public ContentRegistry::Hashes::Hash {
     public:
         HashMD5() : Hash("hex.builtin.hash.md5") {}
@@ -15,6 +40,8 @@ namespace hex::plugin::builtin {
                 auto array = crypt::md5(provider, region.address, region.size);
 
                 return { array.begin(), array.end() };
+            }, [] {
+                return std::make_unique<StreamContext>(crypt::createMd5Stream());
             });
         }
     };
@@ -28,6 +55,8 @@ namespace hex::plugin::builtin {
                 auto array = crypt::sha1(provider, region.address, region.size);
 
                 return { array.begin(), array.end() };
+            }, [] {
+                return std::make_unique<StreamContext>(crypt::createSha1Stream());
             });
         }
     };
@@ -41,6 +70,8 @@ namespace hex::plugin::builtin {
                 auto array = crypt::sha224(provider, region.address, region.size);
 
                 return { array.begin(), array.end() };
+            }, [] {
+                return std::make_unique<StreamContext>(crypt::createSha224Stream());
             });
         }
     };
@@ -54,6 +85,8 @@ namespace hex::plugin::builtin {
                 auto array = crypt::sha256(provider, region.address, region.size);
 
                 return { array.begin(), array.end() };
+            }, [] {
+                return std::make_unique<StreamContext>(crypt::createSha256Stream());
             });
         }
     };
@@ -67,6 +100,8 @@ namespace hex::plugin::builtin {
                 auto array = crypt::sha384(provider, region.address, region.size);
 
                 return { array.begin(), array.end() };
+            }, [] {
+                return std::make_unique<StreamContext>(crypt::createSha384Stream());
             });
         }
     };
@@ -80,6 +115,8 @@ namespace hex::plugin::builtin {
                 auto array = crypt::sha512(provider, region.address, region.size);
 
                 return { array.begin(), array.end() };
+            }, [] {
+                return std::make_unique<StreamContext>(crypt::createSha512Stream());
             });
         }
     };
@@ -88,8 +125,8 @@ namespace hex::plugin::builtin {
     class HashCRC : public ContentRegistry::Hashes::Hash {
     public:
         using CRCFunction = T(*)(prv::Provider*&, u64, size_t, u32, u32, u32, bool, bool);
-        HashCRC(const std::string &name, const CRCFunction &crcFunction, u32 polynomial, u32 initialValue, u32 xorOut)
-            : Hash(name), m_crcFunction(crcFunction), m_polynomial(polynomial), m_initialValue(initialValue), m_xorOut(xorOut) {}
+        HashCRC(const std::string &name, const CRCFunction &crcFunction, u32 width, u32 polynomial, u32 initialValue, u32 xorOut)
+            : Hash(name), m_crcFunction(crcFunction), m_width(width), m_polynomial(polynomial), m_initialValue(initialValue), m_xorOut(xorOut) {}
 
         void draw() override {
             ImGui::InputHexadecimal("hex.builtin.hash.crc.poly"_lang, &this->m_polynomial);
@@ -110,18 +147,76 @@ namespace hex::plugin::builtin {
                 std::memcpy(bytes.data(), &result, bytes.size());
 
                 return bytes;
+            }, [hash = *this] {
+                return std::make_unique<StreamContext>(crypt::createCrcStream(hash.m_width, hash.m_polynomial, hash.m_initialValue, hash.m_xorOut, hash.m_reflectIn, hash.m_reflectOut, sizeof(T)));
             });
         }
 
     private:
         CRCFunction m_crcFunction;
 
+        u32 m_width;
         u32 m_polynomial;
         u32 m_initialValue;
         u32 m_xorOut;
         bool m_reflectIn = false, m_reflectOut = false;
     };
 
+    // Tree hash over a streaming hash primitive: the region is split into fixed
+    // size chunks hashed in parallel, then the root digest hashes the ordered
+    // chunk digests. The chunk size is part of the construction, so the result
+    // doesn't depend on how many workers happened to run
+    class HashTree : public ContentRegistry::Hashes::Hash {
+    public:
+        using StreamFactory = std::unique_ptr<crypt::HashStream> (*)();
+
+        HashTree(const std::string &name, const StreamFactory &streamFactory)
+            : Hash(name), m_streamFactory(streamFactory) {}
+
+        Function create(std::string name) override {
+            return Hash::create(name, [factory = this->m_streamFactory](const Region& region, prv::Provider *provider) -> std::vector<u8> {
+                constexpr static u64 TreeChunkSize = 4_MiB;
+
+                const u64 chunkCount = std::max<u64>(1, (region.size + TreeChunkSize - 1) / TreeChunkSize);
+                std::vector<std::vector<u8>> chunkDigests(chunkCount);
+
+                const auto threadCount = std::min<u64>(chunkCount, std::max<u32>(std::thread::hardware_concurrency(), 1));
+                std::atomic<u64> nextChunk = 0;
+
+                {
+                    std::vector<std::jthread> workers;
+                    for (u64 i = 0; i < threadCount; i++) {
+                        workers.emplace_back([&] {
+                            for (u64 chunk = 0; (chunk = nextChunk.fetch_add(1)) < chunkCount;) {
+                                const u64 chunkAddress = region.address + chunk * TreeChunkSize;
+                                const u64 chunkSize    = std::min<u64>(TreeChunkSize, region.size - chunk * TreeChunkSize);
+
+                                auto stream = factory();
+
+                                prv::ChunkPipeline pipeline(provider, chunkAddress, chunkSize);
+                                pipeline.subscribe([&stream](u64, const u8 *data, size_t size) {
+                                    stream->update(data, size);
+                                });
+                                pipeline.process();
+
+                                chunkDigests[chunk] = stream->finish();
+                            }
+                        });
+                    }
+                }
+
+                auto rootStream = factory();
+                for (const auto &digest : chunkDigests)
+                    rootStream->update(digest.data(), digest.size());
+
+                return rootStream->finish();
+            });
+        }
+
+    private:
+        StreamFactory m_streamFactory;
+    };
+
     void registerHashes() {
         ContentRegistry::Hashes::add<HashMD5>();
 
@@ -131,10 +226,12 @@ namespace hex::plugin::builtin {
         ContentRegistry::Hashes::add<HashSHA384>();
         ContentRegistry::Hashes::add<HashSHA512>();
 
-        ContentRegistry::Hashes::add<HashCRC<u16>>("hex.builtin.hash.crc8",  crypt::crc8,  0x07,        0x0000,      0x0000);
-        ContentRegistry::Hashes::add<HashCRC<u16>>("hex.builtin.hash.crc16", crypt::crc16, 0x8005,      0x0000,      0x0000);
-        ContentRegistry::Hashes::add<HashCRC<u32>>("hex.builtin.hash.crc32", crypt::crc32, 0x04C1'1DB7, 0xFFFF'FFFF, 0xFFFF'FFFF);
+        ContentRegistry::Hashes::add<HashCRC<u16>>("hex.builtin.hash.crc8",  crypt::crc8,  8,  0x07,        0x0000,      0x0000);
+        ContentRegistry::Hashes::add<HashCRC<u16>>("hex.builtin.hash.crc16", crypt::crc16, 16, 0x8005,      0x0000,      0x0000);
+        ContentRegistry::Hashes::add<HashCRC<u32>>("hex.builtin.hash.crc32", crypt::crc32, 32, 0x04C1'1DB7, 0xFFFF'FFFF, 0xFFFF'FFFF);
 
+        ContentRegistry::Hashes::add<HashTree>("hex.builtin.hash.tree_xxh64",  crypt::createXxHash64Stream);
+        ContentRegistry::Hashes::add<HashTree>("hex.builtin.hash.tree_sha256", crypt::createSha256Stream);
     }
 
 }
\ No newline at end of file
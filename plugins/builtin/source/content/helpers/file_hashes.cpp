@@ -0,0 +1,137 @@
+#include <content/helpers/file_hashes.hpp>
+#include <content/helpers/provider_extra_data.hpp>
+
+#include <hex/api/imhex_api.hpp>
+#include <hex/api/localization.hpp>
+#include <hex/api/task.hpp>
+#include <hex/helpers/crypto.hpp>
+#include <hex/helpers/utils.hpp>
+#include <hex/providers/chunk_pipeline.hpp>
+
+#include <hex/ui/imgui_imhex_extensions.h>
+
+#include <algorithm>
+#include <array>
+
+namespace hex::plugin::builtin {
+
+    // Digests computed for every opened provider, in display order. The keys double
+    // as the localization entries of the hashes they belong to
+    constexpr static std::array<const char *, 4> FileHashNames = {
+        "hex.builtin.hash.crc32",
+        "hex.builtin.hash.md5",
+        "hex.builtin.hash.sha1",
+        "hex.builtin.hash.sha256"
+    };
+
+    static std::unique_ptr<crypt::HashStream> createFileHashStream(const std::string &name) {
+        if (name == "hex.builtin.hash.crc32")
+            return crypt::createCrcStream(32, 0x04C1'1DB7, 0xFFFF'FFFF, 0xFFFF'FFFF, true, true, sizeof(u32));
+        else if (name == "hex.builtin.hash.md5")
+            return crypt::createMd5Stream();
+        else if (name == "hex.builtin.hash.sha1")
+            return crypt::createSha1Stream();
+        else if (name == "hex.builtin.hash.sha256")
+            return crypt::createSha256Stream();
+        else
+            return nullptr;
+    }
+
+    void updateFileHashes(prv::Provider *provider) {
+        auto &fileHashes = ProviderExtraData::get(provider).fileHashes;
+        if (fileHashes.updating)
+            return;
+
+        fileHashes.updating = true;
+
+        const auto baseAddress = provider->getBaseAddress();
+        const auto dataSize    = provider->getActualSize();
+        const auto generation  = fileHashes.generation;
+
+        TaskManager::createBackgroundTask("hex.builtin.view.hashes.file_hashes", [provider, baseAddress, dataSize, generation](Task &task) {
+            task.setMaxValue(dataSize);
+
+            // An interrupted pass still has to release the updating flag, otherwise the
+            // cache would never be filled again
+            ON_SCOPE_EXIT {
+                TaskManager::doLater([provider] {
+                    const auto &providers = ImHexApi::Provider::getProviders();
+                    if (std::find(providers.begin(), providers.end(), provider) != providers.end())
+                        ProviderExtraData::get(provider).fileHashes.updating = false;
+                });
+            };
+
+            std::vector<std::pair<std::string, std::unique_ptr<crypt::HashStream>>> streams;
+            for (const auto &name : FileHashNames)
+                streams.emplace_back(name, createFileHashStream(name));
+
+            prv::ChunkPipeline pipeline(provider, baseAddress, dataSize);
+            for (auto &[name, stream] : streams) {
+                pipeline.subscribe([&stream = *stream](u64, const u8 *data, size_t size) {
+                    stream.update(data, size);
+                });
+            }
+
+            pipeline.process(&task);
+
+            std::map<std::string, std::vector<u8>> digests;
+            for (auto &[name, stream] : streams)
+                digests.emplace(name, stream->finish());
+
+            TaskManager::doLater([provider, generation, digests = std::move(digests)]() mutable {
+                const auto &providers = ImHexApi::Provider::getProviders();
+                if (std::find(providers.begin(), providers.end(), provider) == providers.end())
+                    return;
+
+                auto &fileHashes = ProviderExtraData::get(provider).fileHashes;
+
+                // A write that happened mid-pass may have been partially included in the
+                // digests, so they only count when the data stayed untouched throughout
+                if (fileHashes.generation != generation)
+                    return;
+
+                fileHashes.digests = std::move(digests);
+                fileHashes.valid   = true;
+            });
+        });
+    }
+
+    void drawFileHashes(prv::Provider *provider) {
+        auto &fileHashes = ProviderExtraData::get(provider).fileHashes;
+
+        if (!fileHashes.valid && !fileHashes.updating && provider->isReadable())
+            updateFileHashes(provider);
+
+        if (ImGui::BeginTable("##file_hashes", 2, ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_Borders, ImVec2(ImGui::GetContentRegionAvail().x, 0))) {
+            ImGui::TableSetupColumn("hex.builtin.view.hashes.table.name"_lang);
+            ImGui::TableSetupColumn("hex.builtin.view.hashes.table.result"_lang, ImGuiTableColumnFlags_WidthStretch);
+
+            ImGui::TableHeadersRow();
+
+            for (const auto &name : FileHashNames) {
+                ImGui::PushID(name);
+
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextFormatted("{}", LangEntry(name));
+
+                ImGui::TableNextColumn();
+
+                std::string result;
+                if (const auto digest = fileHashes.digests.find(name); fileHashes.valid && digest != fileHashes.digests.end())
+                    result = crypt::encode16(digest->second);
+                else
+                    result = "...";
+
+                ImGui::PushItemWidth(ImGui::GetContentRegionAvail().x);
+                ImGui::InputText("##result", result, ImGuiInputTextFlags_ReadOnly);
+                ImGui::PopItemWidth();
+
+                ImGui::PopID();
+            }
+
+            ImGui::EndTable();
+        }
+    }
+
+}
@@ -0,0 +1,60 @@
+#include <content/helpers/magic_info.hpp>
+#include <content/helpers/provider_extra_data.hpp>
+
+#include <hex/api/imhex_api.hpp>
+#include <hex/api/task.hpp>
+#include <hex/helpers/magic.hpp>
+
+#include <algorithm>
+
+namespace hex::plugin::builtin {
+
+    void updateMagicInfo(prv::Provider *provider) {
+        auto &magicInfo = ProviderExtraData::get(provider).magicInfo;
+        if (magicInfo.updating)
+            return;
+
+        magicInfo.updating = true;
+
+        TaskManager::createBackgroundTask("hex.builtin.task.magic_detection", [provider](Task &) {
+            // An interrupted pass still has to release the updating flag, otherwise the
+            // cache would never be filled again
+            ON_SCOPE_EXIT {
+                TaskManager::doLater([provider] {
+                    const auto &providers = ImHexApi::Provider::getProviders();
+                    if (std::find(providers.begin(), providers.end(), provider) != providers.end())
+                        ProviderExtraData::get(provider).magicInfo.updating = false;
+                });
+            };
+
+            const auto &providers = ImHexApi::Provider::getProviders();
+            if (std::find(providers.begin(), providers.end(), provider) == providers.end())
+                return;
+
+            getMagicInfo(provider);
+        });
+    }
+
+    std::pair<std::string, std::string> getMagicInfo(prv::Provider *provider) {
+        // The fingerprint is sampled before detection, so a write racing the pass
+        // leaves a mismatching key behind instead of a stale-but-matching one
+        const auto fingerprint = provider->getContentFingerprint();
+
+        auto &magicInfo = ProviderExtraData::get(provider).magicInfo;
+        if (magicInfo.valid && magicInfo.fingerprint == fingerprint)
+            return { magicInfo.mimeType, magicInfo.description };
+
+        magic::compile();
+
+        auto description = magic::getDescription(provider);
+        auto mimeType    = magic::getMIMEType(provider);
+
+        magicInfo.mimeType    = mimeType;
+        magicInfo.description = description;
+        magicInfo.fingerprint = fingerprint;
+        magicInfo.valid       = true;
+
+        return { mimeType, description };
+    }
+
+}
@@ -196,13 +196,15 @@ namespace hex {
                             if (!postfixTokens.has_value())
                                 return std::nullopt;
 
-                            auto result = evaluate(*postfixTokens);
-                            if (!result.has_value()) {
-                                this->setError("Invalid argument for function!");
-                                return std::nullopt;
+                            // Compile the argument to its own program instead of evaluating it
+                            // here, so it sees the current variable values on every run
+                            std::vector<Token> argumentProgram;
+                            while (!postfixTokens->empty()) {
+                                argumentProgram.push_back(std::move(postfixTokens->front()));
+                                postfixTokens->pop();
                             }
 
-                            token.arguments.push_back(result.value());
+                            token.arguments.push_back(std::move(argumentProgram));
                         }
 
                         token.type = TokenType::Function;
@@ -227,13 +229,10 @@ namespace hex {
     }
 
     template<typename T>
-    std::optional<T> MathEvaluator<T>::evaluate(std::queue<Token> postfixTokens) {
+    std::optional<T> MathEvaluator<T>::run(const std::vector<Token> &program) {
         std::stack<T> evaluationStack;
 
-        while (!postfixTokens.empty()) {
-            auto front = postfixTokens.front();
-            postfixTokens.pop();
-
+        for (const auto &front : program) {
             if (front.type == TokenType::Number)
                 evaluationStack.push(front.number);
             else if (front.type == TokenType::Operator) {
@@ -356,7 +355,18 @@ namespace hex {
                     return std::nullopt;
                 }
 
-                auto result = this->m_functions[front.name](front.arguments);
+                std::vector<T> arguments;
+                for (const auto &argumentProgram : front.arguments) {
+                    auto argument = run(argumentProgram);
+                    if (!argument.has_value()) {
+                        this->setError("Invalid argument for function!");
+                        return std::nullopt;
+                    }
+
+                    arguments.push_back(argument.value());
+                }
+
+                auto result = this->m_functions[front.name](arguments);
 
                 if (result.has_value())
                     evaluationStack.push(result.value());
@@ -380,7 +390,7 @@ namespace hex {
 
 
     template<typename T>
-    std::optional<T> MathEvaluator<T>::evaluate(const std::string &input) {
+    std::optional<typename MathEvaluator<T>::CompiledExpression> MathEvaluator<T>::compile(const std::string &input) {
         auto inputQueue = parseInput(input);
         if (!inputQueue.has_value() || inputQueue->empty())
             return std::nullopt;
@@ -405,7 +415,35 @@ namespace hex {
         if (!postfixTokens.has_value())
             return std::nullopt;
 
-        auto result = evaluate(*postfixTokens);
+        CompiledExpression compiled;
+        compiled.resultVariable = std::move(resultVariable);
+        while (!postfixTokens->empty()) {
+            compiled.program.push_back(std::move(postfixTokens->front()));
+            postfixTokens->pop();
+        }
+
+        return compiled;
+    }
+
+    template<typename T>
+    std::optional<T> MathEvaluator<T>::evaluate(const std::string &input) {
+        // Expressions get compiled once and re-run from the cache afterwards, so
+        // re-evaluating the same input per keystroke skips tokenizing and parsing
+        auto cached = this->m_programCache.find(input);
+        if (cached == this->m_programCache.end()) {
+            auto compiled = compile(input);
+            if (!compiled.has_value())
+                return std::nullopt;
+
+            if (this->m_programCache.size() >= MaxCachedPrograms)
+                this->m_programCache.clear();
+
+            cached = this->m_programCache.emplace(input, std::move(*compiled)).first;
+        }
+
+        const auto &[program, resultVariable] = cached->second;
+
+        auto result = run(program);
 
         if (result.has_value() && !this->getVariables()[resultVariable].constant)
             this->setVariable(resultVariable, result.value());
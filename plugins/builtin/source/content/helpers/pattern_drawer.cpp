@@ -29,9 +29,6 @@ namespace hex {
 
     namespace {
 
-        constexpr auto DisplayEndDefault = 50U;
-        constexpr auto DisplayEndStep = 50U;
-
         using namespace ::std::literals::string_literals;
 
         bool isPatternSelected(u64 address, u64 size) {
@@ -71,25 +68,6 @@ namespace hex {
             return highlightWhenSelected(pattern.getOffset(), pattern.getSize(), callback);
         }
 
-        void createLeafNode(const pl::ptrn::Pattern& pattern) {
-            ImGui::TreeNodeEx(pattern.getDisplayName().c_str(), ImGuiTreeNodeFlags_Leaf |
-                                                                ImGuiTreeNodeFlags_NoTreePushOnOpen |
-                                                                ImGuiTreeNodeFlags_SpanFullWidth |
-                                                                ImGuiTreeNodeFlags_AllowItemOverlap);
-        }
-
-        bool createTreeNode(const pl::ptrn::Pattern& pattern) {
-            if (pattern.isSealed()) {
-                ImGui::Indent();
-                highlightWhenSelected(pattern, [&]{ ImGui::TextUnformatted(pattern.getDisplayName().c_str()); });
-                ImGui::Unindent();
-                return false;
-            }
-            else {
-                return highlightWhenSelected(pattern, [&]{ return ImGui::TreeNodeEx(pattern.getDisplayName().c_str(), ImGuiTreeNodeFlags_SpanFullWidth);});
-            }
-        }
-
         void drawTypenameColumn(const pl::ptrn::Pattern& pattern, const std::string& pattern_name) {
             ImGui::TextFormattedColored(ImColor(0xFFD69C56), pattern_name);
             ImGui::SameLine();
@@ -139,37 +117,73 @@ namespace hex {
             ImGui::PopID();
         }
 
-        void createDefaultEntry(pl::ptrn::Pattern &pattern) {
-            ImGui::TableNextRow();
-            createLeafNode(pattern);
-            ImGui::TableNextColumn();
-            makeSelectable(pattern);
-            drawCommentTooltip(pattern);
-            ImGui::SameLine();
-            drawNameColumn(pattern);
-            drawColorColumn(pattern);
-            drawOffsetColumn(pattern);
-            drawSizeColumn(pattern);
-            ImGui::TextFormattedColored(ImColor(0xFF9BC64D), "{}", pattern.getFormattedName().empty() ? pattern.getTypeName() : pattern.getFormattedName());
-            ImGui::TableNextColumn();
-            ImGui::TextFormatted("{}", pattern.getFormattedValue());
+    }
+
+
+    void PatternDrawer::createLeafNode(const pl::ptrn::Pattern& pattern) {
+        const float indent = float(this->m_currDepth) * ImGui::GetTreeNodeToLabelSpacing();
+        if (indent > 0)
+            ImGui::Indent(indent);
+
+        ImGui::TreeNodeEx(pattern.getDisplayName().c_str(), ImGuiTreeNodeFlags_Leaf |
+                                                            ImGuiTreeNodeFlags_NoTreePushOnOpen |
+                                                            ImGuiTreeNodeFlags_SpanFullWidth |
+                                                            ImGuiTreeNodeFlags_AllowItemOverlap);
+
+        if (indent > 0)
+            ImGui::Unindent(indent);
+    }
+
+    void PatternDrawer::createTreeNode(const pl::ptrn::Pattern& pattern) {
+        const float indent = float(this->m_currDepth) * ImGui::GetTreeNodeToLabelSpacing();
+        if (indent > 0)
+            ImGui::Indent(indent);
+
+        if (pattern.isSealed()) {
+            highlightWhenSelected(pattern, [&]{ ImGui::TextUnformatted(pattern.getDisplayName().c_str()); });
+        }
+        else {
+            // The open state lives in the drawer so the flattened rows can be
+            // rebuilt from it. ImGui's own state is overridden every frame
+            ImGui::SetNextItemOpen(this->isOpen(&pattern, 0), ImGuiCond_Always);
+            const bool open = highlightWhenSelected(pattern, [&]{ return ImGui::TreeNodeEx(pattern.getDisplayName().c_str(), ImGuiTreeNodeFlags_SpanFullWidth | ImGuiTreeNodeFlags_NoTreePushOnOpen); });
+
+            if (ImGui::IsItemToggledOpen())
+                this->treeNodeToggled(&pattern, 0, open);
         }
 
+        if (indent > 0)
+            ImGui::Unindent(indent);
     }
 
+    void PatternDrawer::createDefaultEntry(pl::ptrn::Pattern &pattern) {
+        ImGui::TableNextRow();
+        this->createLeafNode(pattern);
+        ImGui::TableNextColumn();
+        makeSelectable(pattern);
+        drawCommentTooltip(pattern);
+        ImGui::SameLine();
+        drawNameColumn(pattern);
+        drawColorColumn(pattern);
+        drawOffsetColumn(pattern);
+        drawSizeColumn(pattern);
+        ImGui::TextFormattedColored(ImColor(0xFF9BC64D), "{}", pattern.getFormattedName().empty() ? pattern.getTypeName() : pattern.getFormattedName());
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(this->getFormattedValue(pattern).c_str());
+    }
 
 
     void PatternDrawer::visit(pl::ptrn::PatternArrayDynamic& pattern) {
-        drawArray(pattern, pattern, pattern.isInlined());
+        this->drawArrayNode(pattern, pattern);
     }
 
     void PatternDrawer::visit(pl::ptrn::PatternArrayStatic& pattern) {
-        drawArray(pattern, pattern, pattern.isInlined());
+        this->drawArrayNode(pattern, pattern);
     }
 
     void PatternDrawer::visit(pl::ptrn::PatternBitfieldField& pattern) {
         ImGui::TableNextRow();
-        createLeafNode(pattern);
+        this->createLeafNode(pattern);
         ImGui::TableNextColumn();
 
         makeSelectable(pattern);
@@ -194,34 +208,22 @@ namespace hex {
         ImGui::TextFormattedColored(ImColor(0xFF9BC64D), "bits");
         ImGui::TableNextColumn();
 
-        ImGui::TextFormatted("{}", pattern.getFormattedValue());
+        ImGui::TextUnformatted(this->getFormattedValue(pattern).c_str());
     }
 
     void PatternDrawer::visit(pl::ptrn::PatternBitfield& pattern) {
-        bool open = true;
-        if (!pattern.isInlined()) {
-            ImGui::TableNextRow();
-            ImGui::TableNextColumn();
-            open = createTreeNode(pattern);
-            ImGui::TableNextColumn();
-            makeSelectable(pattern);
-            drawCommentTooltip(pattern);
-            drawColorColumn(pattern);
-            drawOffsetColumn(pattern);
-            drawSizeColumn(pattern);
-            drawTypenameColumn(pattern, "bitfield");
-
-            ImGui::TextFormatted("{}", pattern.getFormattedValue());
-        }
-
-        if (open) {
-            pattern.forEachMember([&] (auto &field) {
-                this->draw(field);
-            });
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        this->createTreeNode(pattern);
+        ImGui::TableNextColumn();
+        makeSelectable(pattern);
+        drawCommentTooltip(pattern);
+        drawColorColumn(pattern);
+        drawOffsetColumn(pattern);
+        drawSizeColumn(pattern);
+        drawTypenameColumn(pattern, "bitfield");
 
-            if (!pattern.isInlined())
-                ImGui::TreePop();
-        }
+        ImGui::TextUnformatted(this->getFormattedValue(pattern).c_str());
     }
 
     void PatternDrawer::visit(pl::ptrn::PatternBoolean& pattern) {
@@ -234,7 +236,7 @@ namespace hex {
 
     void PatternDrawer::visit(pl::ptrn::PatternEnum& pattern) {
         ImGui::TableNextRow();
-        createLeafNode(pattern);
+        this->createLeafNode(pattern);
         drawCommentTooltip(pattern);
         ImGui::TableNextColumn();
         makeSelectable(pattern);
@@ -244,7 +246,7 @@ namespace hex {
         drawOffsetColumn(pattern);
         drawSizeColumn(pattern);
         drawTypenameColumn(pattern, "enum");
-        ImGui::TextFormatted("{}", pattern.getFormattedValue());
+        ImGui::TextUnformatted(this->getFormattedValue(pattern).c_str());
     }
 
     void PatternDrawer::visit(pl::ptrn::PatternFloat& pattern) {
@@ -257,29 +259,18 @@ namespace hex {
     }
 
     void PatternDrawer::visit(pl::ptrn::PatternPointer& pattern) {
-        bool open = true;
-
-        if (!pattern.isInlined()) {
-            ImGui::TableNextRow();
-            ImGui::TableNextColumn();
-            open = createTreeNode(pattern);
-            ImGui::TableNextColumn();
-            makeSelectable(pattern);
-            drawCommentTooltip(pattern);
-            drawColorColumn(pattern);
-            drawOffsetColumn(pattern);
-            drawSizeColumn(pattern);
-            ImGui::TextFormattedColored(ImColor(0xFF9BC64D), "{}", pattern.getFormattedName());
-            ImGui::TableNextColumn();
-            ImGui::TextFormatted("{}", pattern.getFormattedValue());
-        }
-
-        if (open) {
-            pattern.getPointedAtPattern()->accept(*this);
-
-            if (!pattern.isInlined())
-                ImGui::TreePop();
-        }
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        this->createTreeNode(pattern);
+        ImGui::TableNextColumn();
+        makeSelectable(pattern);
+        drawCommentTooltip(pattern);
+        drawColorColumn(pattern);
+        drawOffsetColumn(pattern);
+        drawSizeColumn(pattern);
+        ImGui::TextFormattedColored(ImColor(0xFF9BC64D), "{}", pattern.getFormattedName());
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(this->getFormattedValue(pattern).c_str());
     }
 
     void PatternDrawer::visit(pl::ptrn::PatternSigned& pattern) {
@@ -292,63 +283,37 @@ namespace hex {
         }
 
     void PatternDrawer::visit(pl::ptrn::PatternStruct& pattern) {
-        bool open = true;
-
-        if (!pattern.isInlined()) {
-            ImGui::TableNextRow();
-            ImGui::TableNextColumn();
-            open = createTreeNode(pattern);
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        this->createTreeNode(pattern);
+        ImGui::TableNextColumn();
+        makeSelectable(pattern);
+        drawCommentTooltip(pattern);
+        if (pattern.isSealed())
+            drawColorColumn(pattern);
+        else
             ImGui::TableNextColumn();
-            makeSelectable(pattern);
-            drawCommentTooltip(pattern);
-            if (pattern.isSealed())
-                drawColorColumn(pattern);
-            else
-                ImGui::TableNextColumn();
-            drawOffsetColumn(pattern);
-            drawSizeColumn(pattern);
-            drawTypenameColumn(pattern, "struct");
-            ImGui::TextFormatted("{}", pattern.getFormattedValue());
-        }
-
-        if (open) {
-            pattern.forEachEntry(0, pattern.getMembers().size(), [&](u64, auto *member){
-                this->draw(*member);
-            });
-
-            if (!pattern.isInlined())
-                ImGui::TreePop();
-        }
+        drawOffsetColumn(pattern);
+        drawSizeColumn(pattern);
+        drawTypenameColumn(pattern, "struct");
+        ImGui::TextUnformatted(this->getFormattedValue(pattern).c_str());
     }
 
     void PatternDrawer::visit(pl::ptrn::PatternUnion& pattern) {
-        bool open = true;
-
-        if (!pattern.isInlined()) {
-            ImGui::TableNextRow();
-            ImGui::TableNextColumn();
-            open = createTreeNode(pattern);
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        this->createTreeNode(pattern);
+        ImGui::TableNextColumn();
+        makeSelectable(pattern);
+        drawCommentTooltip(pattern);
+        if (pattern.isSealed())
+            drawColorColumn(pattern);
+        else
             ImGui::TableNextColumn();
-            makeSelectable(pattern);
-            drawCommentTooltip(pattern);
-            if (pattern.isSealed())
-                drawColorColumn(pattern);
-            else
-                ImGui::TableNextColumn();
-            drawOffsetColumn(pattern);
-            drawSizeColumn(pattern);
-            drawTypenameColumn(pattern, "union");
-            ImGui::TextFormatted("{}", pattern.getFormattedValue());
-        }
-
-        if (open) {
-            pattern.forEachEntry(0, pattern.getEntryCount(), [&](u64, auto *member) {
-                this->draw(*member);
-            });
-
-            if (!pattern.isInlined())
-                ImGui::TreePop();
-        }
+        drawOffsetColumn(pattern);
+        drawSizeColumn(pattern);
+        drawTypenameColumn(pattern, "union");
+        ImGui::TextUnformatted(this->getFormattedValue(pattern).c_str());
     }
 
     void PatternDrawer::visit(pl::ptrn::PatternUnsigned& pattern) {
@@ -364,108 +329,238 @@ namespace hex {
             createDefaultEntry(pattern);
     }
 
-    void PatternDrawer::draw(pl::ptrn::Pattern& pattern) {
+    void PatternDrawer::draw(const std::vector<pl::ptrn::Pattern*> &patterns) {
+        // Re-flatten the visible rows when a node was expanded or collapsed or
+        // when the pattern tree itself changed since the last frame
+        if (!this->m_rowsValid || patterns != this->m_flattenedPatterns) {
+            // A different pattern tree means the cached cells belong to dead patterns
+            if (patterns != this->m_flattenedPatterns)
+                this->m_formattedValues.clear();
+
+            this->m_flattenedPatterns = patterns;
+            this->m_rows.clear();
+
+            for (const auto &pattern : patterns)
+                this->flattenPattern(*pattern, 0);
+
+            this->m_rowsValid = true;
+        }
+
+        ImGuiListClipper clipper;
+
+        clipper.Begin(int(this->m_rows.size()), ImGui::GetTextLineHeightWithSpacing());
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+                this->drawRow(this->m_rows[i]);
+        }
+    }
+
+    void PatternDrawer::invalidateRows() {
+        this->m_rowsValid = false;
+    }
+
+    void PatternDrawer::invalidateValues(const Region &region) {
+        std::erase_if(this->m_formattedValues, [&](const auto &entry) {
+            return entry.second.region.overlaps(region);
+        });
+    }
+
+    const std::string &PatternDrawer::getFormattedValue(pl::ptrn::Pattern &pattern) {
+        auto it = this->m_formattedValues.find(&pattern);
+        if (it == this->m_formattedValues.end())
+            it = this->m_formattedValues.emplace(&pattern, CachedCell { pattern.getFormattedValue(), Region { pattern.getOffset(), pattern.getSize() } }).first;
+
+        return it->second.value;
+    }
+
+    bool PatternDrawer::isOpen(const void *node, u64 chunk) const {
+        return this->m_openNodes.contains({ node, chunk });
+    }
+
+    void PatternDrawer::treeNodeToggled(const void *node, u64 chunk, bool open) {
+        if (open)
+            this->m_openNodes.insert({ node, chunk });
+        else
+            this->m_openNodes.erase({ node, chunk });
+
+        this->m_rowsValid = false;
+    }
+
+    void PatternDrawer::flattenPattern(pl::ptrn::Pattern &pattern, u32 depth) {
         if (pattern.isHidden())
             return;
 
-        pattern.accept(*this);
-    }
+        // Inlined containers contribute no row of their own, their children show
+        // up at the parent's depth instead
+        auto flattenContainer = [&](auto &concretePattern, const auto &flattenChildren) {
+            const bool inlined = concretePattern.isInlined();
 
-    void PatternDrawer::drawArray(pl::ptrn::Pattern& pattern, pl::ptrn::Iteratable &iteratable, bool isInlined) {
-        if (iteratable.getEntryCount() == 0)
+            if (!inlined) {
+                this->m_rows.push_back({ &pattern, depth, 0, 0 });
+
+                if (pattern.isSealed() || !this->isOpen(&pattern, 0))
+                    return;
+            }
+
+            flattenChildren(depth + (inlined ? 0 : 1));
+        };
+
+        if (dynamic_cast<pl::ptrn::PatternPadding *>(&pattern) != nullptr) {
             return;
+        } else if (auto pointer = dynamic_cast<pl::ptrn::PatternPointer *>(&pattern); pointer != nullptr) {
+            flattenContainer(*pointer, [&](u32 childDepth) {
+                this->flattenPattern(*pointer->getPointedAtPattern(), childDepth);
+            });
+        } else if (auto bitfield = dynamic_cast<pl::ptrn::PatternBitfield *>(&pattern); bitfield != nullptr) {
+            flattenContainer(*bitfield, [&](u32 childDepth) {
+                bitfield->forEachMember([&](auto &field) {
+                    this->flattenPattern(field, childDepth);
+                });
+            });
+        } else if (auto structPattern = dynamic_cast<pl::ptrn::PatternStruct *>(&pattern); structPattern != nullptr) {
+            flattenContainer(*structPattern, [&](u32 childDepth) {
+                structPattern->forEachEntry(0, structPattern->getMembers().size(), [&](u64, auto *member) {
+                    this->flattenPattern(*member, childDepth);
+                });
+            });
+        } else if (auto unionPattern = dynamic_cast<pl::ptrn::PatternUnion *>(&pattern); unionPattern != nullptr) {
+            flattenContainer(*unionPattern, [&](u32 childDepth) {
+                unionPattern->forEachEntry(0, unionPattern->getEntryCount(), [&](u64, auto *member) {
+                    this->flattenPattern(*member, childDepth);
+                });
+            });
+        } else if (auto dynamicArray = dynamic_cast<pl::ptrn::PatternArrayDynamic *>(&pattern); dynamicArray != nullptr) {
+            if (dynamicArray->getEntryCount() == 0)
+                return;
+            flattenContainer(*dynamicArray, [&](u32 childDepth) {
+                this->flattenArrayEntries(pattern, *dynamicArray, childDepth);
+            });
+        } else if (auto staticArray = dynamic_cast<pl::ptrn::PatternArrayStatic *>(&pattern); staticArray != nullptr) {
+            if (staticArray->getEntryCount() == 0)
+                return;
+            flattenContainer(*staticArray, [&](u32 childDepth) {
+                this->flattenArrayEntries(pattern, *staticArray, childDepth);
+            });
+        } else {
+            // Empty strings draw nothing, a row for them would show up blank
+            if (pattern.getSize() == 0 && (dynamic_cast<pl::ptrn::PatternString *>(&pattern) != nullptr || dynamic_cast<pl::ptrn::PatternWideString *>(&pattern) != nullptr))
+                return;
 
-        bool open = true;
-        if (!isInlined) {
-            ImGui::TableNextRow();
-            ImGui::TableNextColumn();
-            open = createTreeNode(pattern);
-            ImGui::TableNextColumn();
-            makeSelectable(pattern);
-            drawCommentTooltip(pattern);
-            if (pattern.isSealed())
-                drawColorColumn(pattern);
-            else
-                ImGui::TableNextColumn();
-            drawOffsetColumn(pattern);
-            drawSizeColumn(pattern);
-            ImGui::TextFormattedColored(ImColor(0xFF9BC64D), "{0}", pattern.getTypeName());
-            ImGui::SameLine(0, 0);
+            this->m_rows.push_back({ &pattern, depth, 0, 0 });
+        }
+    }
 
-            ImGui::TextUnformatted("[");
-            ImGui::SameLine(0, 0);
-            ImGui::TextFormattedColored(ImColor(0xFF00FF00), "{0}", iteratable.getEntryCount());
-            ImGui::SameLine(0, 0);
-            ImGui::TextUnformatted("]");
+    void PatternDrawer::flattenArrayEntries(pl::ptrn::Pattern &pattern, pl::ptrn::Iteratable &iteratable, u32 depth) {
+        const auto entryCount = iteratable.getEntryCount();
 
-            ImGui::TableNextColumn();
-            ImGui::TextFormatted("{}", pattern.getFormattedValue());
+        if (entryCount <= ChunkSize) {
+            iteratable.forEachEntry(0, entryCount, [&](u64, auto *entry) {
+                this->flattenPattern(*entry, depth);
+            });
+
+            return;
         }
 
-        if (open) {
-            u64 chunkCount = 0;
-            for (u64 i = 0; i < iteratable.getEntryCount(); i += ChunkSize) {
-                ImGui::TableNextRow();
-                ImGui::TableNextColumn();
-
-                chunkCount++;
-
-                auto &displayEnd = this->getDisplayEnd(pattern);
-                if (chunkCount > displayEnd) {
-                    ImGui::Selectable("... (Double-click to see more items)", false, ImGuiSelectableFlags_SpanAllColumns);
-                    if (ImGui::IsItemHovered() && ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left))
-                        displayEnd += DisplayEndStep;
-                    break;
-                } else {
-                    auto endIndex = std::min<u64>(iteratable.getEntryCount(), i + ChunkSize);
-
-                    auto startOffset = iteratable.getEntry(i)->getOffset();
-                    auto endOffset = iteratable.getEntry(endIndex - 1)->getOffset();
-                    auto endSize = iteratable.getEntry(endIndex - 1)->getSize();
-
-                    size_t chunkSize = (endOffset - startOffset) + endSize;
-
-                    auto chunkOpen = highlightWhenSelected(startOffset, ((endOffset + endSize) - startOffset) - 1, [&]{ return ImGui::TreeNodeEx(hex::format("[{} ... {}]", i, endIndex - 1).c_str(), ImGuiTreeNodeFlags_SpanFullWidth); });
-                    ImGui::TableNextColumn();
-                    drawColorColumn(pattern);
-                    ImGui::TextFormatted("0x{0:08X} : 0x{1:08X}", startOffset, startOffset + chunkSize - (pattern.getSize() == 0 ? 0 : 1));
-                    ImGui::TableNextColumn();
-                    ImGui::TextFormatted("0x{0:04X}", chunkSize);
-                    ImGui::TableNextColumn();
-                    ImGui::TextFormattedColored(ImColor(0xFF9BC64D), "{0}", pattern.getTypeName());
-                    ImGui::SameLine(0, 0);
-
-                    ImGui::TextUnformatted("[");
-                    ImGui::SameLine(0, 0);
-                    ImGui::TextFormattedColored(ImColor(0xFF00FF00), "{0}", endIndex - i);
-                    ImGui::SameLine(0, 0);
-                    ImGui::TextUnformatted("]");
-
-                    ImGui::TableNextColumn();
-                    ImGui::TextFormatted("[ ... ]");
-
-                    if (chunkOpen) {
-                        iteratable.forEachEntry(i, endIndex, [&](u64, auto *entry){
-                            this->draw(*entry);
-                        });
-
-                        ImGui::TreePop();
-                    }
-                }
-            }
+        // Large arrays get paged into chunk header rows. Only the entries of
+        // chunks that are actually open are materialized
+        for (u64 i = 0; i < entryCount; i += ChunkSize) {
+            const auto endIndex = std::min<u64>(entryCount, i + ChunkSize);
+
+            this->m_rows.push_back({ &pattern, depth, i, endIndex });
 
-            if (!isInlined)
-                ImGui::TreePop();
+            if (this->isOpen(&pattern, i + 1)) {
+                iteratable.forEachEntry(i, endIndex, [&](u64, auto *entry) {
+                    this->flattenPattern(*entry, depth + 1);
+                });
+            }
         }
     }
 
-    u64& PatternDrawer::getDisplayEnd(const pl::ptrn::Pattern& pattern) {
-        auto it = this->m_displayEnd.find(&pattern);
-        if (it != this->m_displayEnd.end()) {
-            return it->second;
-        }
+    void PatternDrawer::drawRow(const Row &row) {
+        this->m_currDepth = row.depth;
+
+        ImGui::PushID(row.pattern);
+        ImGui::PushID(int(row.chunkStart));
+
+        if (row.chunkEnd != 0)
+            this->drawChunkRow(row);
+        else
+            row.pattern->accept(*this);
+
+        ImGui::PopID();
+        ImGui::PopID();
+    }
+
+    void PatternDrawer::drawArrayNode(pl::ptrn::Pattern& pattern, pl::ptrn::Iteratable &iteratable) {
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        this->createTreeNode(pattern);
+        ImGui::TableNextColumn();
+        makeSelectable(pattern);
+        drawCommentTooltip(pattern);
+        if (pattern.isSealed())
+            drawColorColumn(pattern);
+        else
+            ImGui::TableNextColumn();
+        drawOffsetColumn(pattern);
+        drawSizeColumn(pattern);
+        ImGui::TextFormattedColored(ImColor(0xFF9BC64D), "{0}", pattern.getTypeName());
+        ImGui::SameLine(0, 0);
+
+        ImGui::TextUnformatted("[");
+        ImGui::SameLine(0, 0);
+        ImGui::TextFormattedColored(ImColor(0xFF00FF00), "{0}", iteratable.getEntryCount());
+        ImGui::SameLine(0, 0);
+        ImGui::TextUnformatted("]");
+
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(this->getFormattedValue(pattern).c_str());
+    }
+
+    void PatternDrawer::drawChunkRow(const Row &row) {
+        auto iteratable = dynamic_cast<pl::ptrn::Iteratable *>(row.pattern);
+        if (iteratable == nullptr)
+            return;
+
+        auto &pattern = *row.pattern;
+
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+
+        auto startOffset = iteratable->getEntry(row.chunkStart)->getOffset();
+        auto endOffset   = iteratable->getEntry(row.chunkEnd - 1)->getOffset();
+        auto endSize     = iteratable->getEntry(row.chunkEnd - 1)->getSize();
 
-        auto [value, success] = this->m_displayEnd.emplace(&pattern, DisplayEndDefault);
-        return value->second;
+        size_t chunkSize = (endOffset - startOffset) + endSize;
+
+        const float indent = float(row.depth) * ImGui::GetTreeNodeToLabelSpacing();
+        if (indent > 0)
+            ImGui::Indent(indent);
+
+        ImGui::SetNextItemOpen(this->isOpen(&pattern, row.chunkStart + 1), ImGuiCond_Always);
+        const bool open = highlightWhenSelected(startOffset, ((endOffset + endSize) - startOffset) - 1, [&]{ return ImGui::TreeNodeEx(hex::format("[{} ... {}]", row.chunkStart, row.chunkEnd - 1).c_str(), ImGuiTreeNodeFlags_SpanFullWidth | ImGuiTreeNodeFlags_NoTreePushOnOpen); });
+        if (ImGui::IsItemToggledOpen())
+            this->treeNodeToggled(&pattern, row.chunkStart + 1, open);
+
+        if (indent > 0)
+            ImGui::Unindent(indent);
+
+        ImGui::TableNextColumn();
+        drawColorColumn(pattern);
+        ImGui::TextFormatted("0x{0:08X} : 0x{1:08X}", startOffset, startOffset + chunkSize - (pattern.getSize() == 0 ? 0 : 1));
+        ImGui::TableNextColumn();
+        ImGui::TextFormatted("0x{0:04X}", chunkSize);
+        ImGui::TableNextColumn();
+        ImGui::TextFormattedColored(ImColor(0xFF9BC64D), "{0}", pattern.getTypeName());
+        ImGui::SameLine(0, 0);
+
+        ImGui::TextUnformatted("[");
+        ImGui::SameLine(0, 0);
+        ImGui::TextFormattedColored(ImColor(0xFF00FF00), "{0}", row.chunkEnd - row.chunkStart);
+        ImGui::SameLine(0, 0);
+        ImGui::TextUnformatted("]");
+
+        ImGui::TableNextColumn();
+        ImGui::TextFormatted("[ ... ]");
     }
 }
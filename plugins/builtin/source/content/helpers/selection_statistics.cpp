@@ -0,0 +1,201 @@
+#include <content/helpers/selection_statistics.hpp>
+#include <content/helpers/provider_extra_data.hpp>
+
+#include <hex/api/imhex_api.hpp>
+#include <hex/api/localization.hpp>
+#include <hex/api/task.hpp>
+#include <hex/helpers/fmt.hpp>
+#include <hex/helpers/literals.hpp>
+#include <hex/helpers/utils.hpp>
+
+#include <hex/ui/imgui_imhex_extensions.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <vector>
+
+namespace hex::plugin::builtin {
+
+    using namespace hex::literals;
+
+    // Deltas below this size are counted synchronously so the statistics never flicker
+    // through a placeholder for changes a single read can service
+    constexpr static size_t SynchronousThreshold = 1_MiB;
+
+    namespace {
+
+        // A range whose byte counts have to be added to or subtracted from the histogram
+        struct CountDelta {
+            u64 address;
+            size_t size;
+            bool subtract;
+        };
+
+    }
+
+    static void countRange(prv::Provider *provider, const CountDelta &delta, std::array<u64, 256> &counts, Task *task = nullptr, u64 progressBase = 0) {
+        constexpr static size_t ChunkSize = 8_MiB;
+
+        std::array<u64, 256> rangeCounts = { };
+
+        std::vector<u8> buffer(std::min(delta.size, ChunkSize));
+        for (size_t offset = 0; offset < delta.size; offset += buffer.size()) {
+            const auto readSize = std::min(buffer.size(), delta.size - offset);
+            provider->read(delta.address + provider->getBaseAddress() + offset, buffer.data(), readSize);
+            hex::countByteOccurrences({ buffer.data(), readSize }, rangeCounts);
+
+            if (task != nullptr)
+                task->update(progressBase + offset);
+        }
+
+        for (u32 value = 0; value < counts.size(); value++) {
+            if (delta.subtract)
+                counts[value] -= rangeCounts[value];
+            else
+                counts[value] += rangeCounts[value];
+        }
+    }
+
+    static void updateSelectionStatistics(prv::Provider *provider, const Region &selection) {
+        auto &cache = ProviderExtraData::get(provider).selectionStats;
+        if (cache.updating)
+            return;
+
+        std::vector<CountDelta> deltas;
+        auto counts = cache.valueCounts;
+
+        // A selection that only moved one edge reuses the cached histogram and counts
+        // just the bytes the move added or removed
+        if (cache.valid && cache.region.has_value() &&
+            (selection.getStartAddress() == cache.region->getStartAddress() ||
+             selection.getEndAddress()   == cache.region->getEndAddress())) {
+            const auto &oldRegion = *cache.region;
+
+            if (selection.getStartAddress() < oldRegion.getStartAddress())
+                deltas.push_back({ selection.getStartAddress(), size_t(oldRegion.getStartAddress() - selection.getStartAddress()), false });
+            else if (selection.getStartAddress() > oldRegion.getStartAddress())
+                deltas.push_back({ oldRegion.getStartAddress(), size_t(selection.getStartAddress() - oldRegion.getStartAddress()), true });
+
+            if (selection.getEndAddress() > oldRegion.getEndAddress())
+                deltas.push_back({ oldRegion.getEndAddress() + 1, size_t(selection.getEndAddress() - oldRegion.getEndAddress()), false });
+            else if (selection.getEndAddress() < oldRegion.getEndAddress())
+                deltas.push_back({ selection.getEndAddress() + 1, size_t(oldRegion.getEndAddress() - selection.getEndAddress()), true });
+        } else {
+            counts = { };
+            deltas.push_back({ selection.getStartAddress(), selection.getSize(), false });
+        }
+
+        size_t deltaSize = 0;
+        for (const auto &delta : deltas)
+            deltaSize += delta.size;
+
+        if (deltaSize == 0) {
+            cache.region = selection;
+            return;
+        }
+
+        if (deltaSize <= SynchronousThreshold) {
+            for (const auto &delta : deltas)
+                countRange(provider, delta, counts);
+
+            cache.valueCounts = counts;
+            cache.region      = selection;
+            cache.valid       = true;
+            return;
+        }
+
+        cache.updating = true;
+        const auto generation = cache.generation;
+
+        TaskManager::createBackgroundTask("hex.builtin.view.hex_editor.stats.counting", [provider, selection, deltas, counts, deltaSize, generation](Task &task) mutable {
+            task.setMaxValue(deltaSize);
+
+            // An interrupted pass still has to release the updating flag, otherwise the
+            // cache would never be filled again
+            ON_SCOPE_EXIT {
+                TaskManager::doLater([provider] {
+                    const auto &providers = ImHexApi::Provider::getProviders();
+                    if (std::find(providers.begin(), providers.end(), provider) != providers.end())
+                        ProviderExtraData::get(provider).selectionStats.updating = false;
+                });
+            };
+
+            u64 progress = 0;
+            for (const auto &delta : deltas) {
+                countRange(provider, delta, counts, &task, progress);
+                progress += delta.size;
+            }
+
+            TaskManager::doLater([provider, selection, generation, counts] {
+                const auto &providers = ImHexApi::Provider::getProviders();
+                if (std::find(providers.begin(), providers.end(), provider) == providers.end())
+                    return;
+
+                auto &cache = ProviderExtraData::get(provider).selectionStats;
+
+                // A write that happened mid-pass may be partially included in the counts,
+                // so they only count when the data stayed untouched throughout
+                if (cache.generation != generation)
+                    return;
+
+                cache.valueCounts = counts;
+                cache.region      = selection;
+                cache.valid       = true;
+            });
+        });
+    }
+
+    std::optional<SelectionStatistics> getSelectionStatistics(prv::Provider *provider, const Region &selection) {
+        if (selection == Region::Invalid() || selection.getSize() == 0)
+            return std::nullopt;
+
+        auto &cache = ProviderExtraData::get(provider).selectionStats;
+
+        if (!cache.updating && provider->isReadable() && (!cache.valid || cache.region != selection))
+            updateSelectionStatistics(provider, selection);
+
+        if (!cache.valid || cache.region != selection)
+            return std::nullopt;
+
+        SelectionStatistics result = { };
+        result.minimum = 0xFF;
+
+        u64 total = 0;
+        for (u32 value = 0; value < cache.valueCounts.size(); value++) {
+            const auto count = cache.valueCounts[value];
+            if (count == 0)
+                continue;
+
+            total           += count;
+            result.sum      += u64(value) * count;
+            result.popcount += u64(std::popcount(value)) * count;
+            result.minimum   = std::min<u8>(result.minimum, value);
+            result.maximum   = std::max<u8>(result.maximum, value);
+        }
+
+        if (total == 0)
+            return std::nullopt;
+
+        result.mean = double(result.sum) / double(total);
+
+        return result;
+    }
+
+    void drawSelectionStatistics(prv::Provider *provider, const Region &selection) {
+        std::string value;
+        if (const auto stats = getSelectionStatistics(provider, selection); stats.has_value()) {
+            value = hex::format("{0}: 0x{1:X} | {2}: {3:.2f} | {4}: 0x{5:02X} | {6}: 0x{7:02X} | {8}: {9}",
+                                "hex.builtin.view.hex_editor.stats.sum"_lang,      stats->sum,
+                                "hex.builtin.view.hex_editor.stats.mean"_lang,     stats->mean,
+                                "hex.builtin.view.hex_editor.stats.min"_lang,      stats->minimum,
+                                "hex.builtin.view.hex_editor.stats.max"_lang,      stats->maximum,
+                                "hex.builtin.view.hex_editor.stats.popcount"_lang, stats->popcount);
+        } else {
+            value = "...";
+        }
+
+        ImGui::TextFormatted("{0}: {1}", "hex.builtin.view.hex_editor.stats"_lang, value);
+    }
+
+}
@@ -141,44 +141,30 @@ namespace hex::plugin::builtin {
                 if (ImGui::MenuItem("hex.builtin.menu.file.import.ips"_lang, nullptr, false)) {
 
                     fs::openFileBrowser(fs::DialogMode::Open, {}, [](const auto &path) {
-                        TaskManager::createTask("hex.builtin.common.processing", TaskManager::NoProgress, [path](auto &task) {
-                            auto patchData = fs::File(path, fs::File::Mode::Read).readBytes();
-                            auto patch     = hex::loadIPSPatch(patchData);
-
-                            task.setMaxValue(patch.size());
+                        TaskManager::createTask("hex.builtin.common.processing", TaskManager::NoProgress, [path](auto &) {
+                            auto patchFile = fs::File(path, fs::File::Mode::Read);
+                            if (!patchFile.isValid())
+                                return;
 
+                            // Records are applied to the provider as they are read, so
+                            // the patch file is never held in memory as a whole
                             auto provider = ImHexApi::Provider::get();
-
-                            u64 progress = 0;
-                            for (auto &[address, value] : patch) {
-                                provider->addPatch(address, &value, 1);
-                                progress++;
-                                task.update(progress);
-                            }
-
-                            provider->createUndoPoint();
+                            if (hex::applyIPSPatch(provider, patchFile))
+                                provider->createUndoPoint();
                         });
                     });
                 }
 
                 if (ImGui::MenuItem("hex.builtin.menu.file.import.ips32"_lang, nullptr, false)) {
                     fs::openFileBrowser(fs::DialogMode::Open, {}, [](const auto &path) {
-                        TaskManager::createTask("hex.builtin.common.processing", TaskManager::NoProgress, [path](auto &task) {
-                            auto patchData = fs::File(path, fs::File::Mode::Read).readBytes();
-                            auto patch     = hex::loadIPS32Patch(patchData);
-
-                            task.setMaxValue(patch.size());
+                        TaskManager::createTask("hex.builtin.common.processing", TaskManager::NoProgress, [path](auto &) {
+                            auto patchFile = fs::File(path, fs::File::Mode::Read);
+                            if (!patchFile.isValid())
+                                return;
 
                             auto provider = ImHexApi::Provider::get();
-
-                            u64 progress = 0;
-                            for (auto &[address, value] : patch) {
-                                provider->addPatch(address, &value, 1);
-                                progress++;
-                                task.update(progress);
-                            }
-
-                            provider->createUndoPoint();
+                            if (hex::applyIPS32Patch(provider, patchFile))
+                                provider->createUndoPoint();
                         });
                     });
                 }
@@ -190,51 +176,55 @@ namespace hex::plugin::builtin {
             /* Export */
             if (ImGui::BeginMenu("hex.builtin.menu.file.export"_lang, providerValid && provider->isWritable())) {
                 if (ImGui::MenuItem("hex.builtin.menu.file.export.ips"_lang, nullptr, false)) {
-                    Patches patches = provider->getPatches();
-                    if (!patches.contains(0x00454F45) && patches.contains(0x00454F46)) {
-                        u8 value = 0;
-                        provider->read(0x00454F45, &value, sizeof(u8));
-                        patches[0x00454F45] = value;
-                    }
+                    fs::openFileBrowser(fs::DialogMode::Save, {}, [](const auto &path) {
+                        TaskManager::createTask("hex.builtin.common.processing", TaskManager::NoProgress, [path](auto &) {
+                            auto provider = ImHexApi::Provider::get();
 
-                    TaskManager::createTask("hex.builtin.common.processing", TaskManager::NoProgress, [patches](auto &) {
-                        auto data = generateIPSPatch(patches);
+                            // Copying the patch store only shares its chunks; the extra
+                            // patch below doesn't modify the provider's own patches
+                            auto patches = provider->getPatches();
+                            if (!patches.contains(0x00454F45) && patches.contains(0x00454F46)) {
+                                u8 value = 0;
+                                provider->read(0x00454F45, &value, sizeof(u8));
+                                patches.set(0x00454F45, value);
+                            }
 
-                        TaskManager::doLater([data] {
-                            fs::openFileBrowser(fs::DialogMode::Save, {}, [&data](const auto &path) {
-                                auto file = fs::File(path, fs::File::Mode::Create);
-                                if (!file.isValid()) {
-                                    View::showErrorPopup("hex.builtin.menu.file.export.base64.popup.export_error"_lang);
-                                    return;
-                                }
+                            auto file = fs::File(path, fs::File::Mode::Create);
+                            if (!file.isValid()) {
+                                TaskManager::doLater([] { View::showErrorPopup("hex.builtin.menu.file.export.base64.popup.export_error"_lang); });
+                                return;
+                            }
 
-                                file.write(data);
-                            });
+                            if (!hex::generateIPSPatch(patches, file)) {
+                                file.remove();
+                                TaskManager::doLater([] { View::showErrorPopup("hex.builtin.menu.file.export.base64.popup.export_error"_lang); });
+                            }
                         });
                     });
                 }
 
                 if (ImGui::MenuItem("hex.builtin.menu.file.export.ips32"_lang, nullptr, false)) {
-                    Patches patches = provider->getPatches();
-                    if (!patches.contains(0x00454F45) && patches.contains(0x45454F46)) {
-                        u8 value = 0;
-                        provider->read(0x45454F45, &value, sizeof(u8));
-                        patches[0x45454F45] = value;
-                    }
+                    fs::openFileBrowser(fs::DialogMode::Save, {}, [](const auto &path) {
+                        TaskManager::createTask("hex.builtin.common.processing", TaskManager::NoProgress, [path](auto &) {
+                            auto provider = ImHexApi::Provider::get();
 
-                    TaskManager::createTask("hex.builtin.common.processing", TaskManager::NoProgress, [patches](auto &) {
-                        auto data = generateIPS32Patch(patches);
+                            auto patches = provider->getPatches();
+                            if (!patches.contains(0x45454F45) && patches.contains(0x45454F46)) {
+                                u8 value = 0;
+                                provider->read(0x45454F45, &value, sizeof(u8));
+                                patches.set(0x45454F45, value);
+                            }
 
-                        TaskManager::doLater([data] {
-                            fs::openFileBrowser(fs::DialogMode::Save, {}, [&data](const auto &path) {
-                                auto file = fs::File(path, fs::File::Mode::Create);
-                                if (!file.isValid()) {
-                                    View::showErrorPopup("hex.builtin.menu.file.export.base64.popup.export_error"_lang);
-                                    return;
-                                }
+                            auto file = fs::File(path, fs::File::Mode::Create);
+                            if (!file.isValid()) {
+                                TaskManager::doLater([] { View::showErrorPopup("hex.builtin.menu.file.export.base64.popup.export_error"_lang); });
+                                return;
+                            }
 
-                                file.write(data);
-                            });
+                            if (!hex::generateIPS32Patch(patches, file)) {
+                                file.remove();
+                                TaskManager::doLater([] { View::showErrorPopup("hex.builtin.menu.file.export.base64.popup.export_error"_lang); });
+                            }
                         });
                     });
                 }
@@ -1,6 +1,9 @@
 #include <hex/api/content_registry.hpp>
 
+#include <hex/helpers/crypto.hpp>
 #include <hex/helpers/net.hpp>
+#include <hex/providers/buffered_reader.hpp>
+#include <hex/providers/provider.hpp>
 
 #include <pl/core/token.hpp>
 #include <pl/core/log_console.hpp>
@@ -27,6 +30,74 @@ namespace hex::plugin::builtin {
             });
         }
 
+        pl::api::Namespace nsHexMem = { "builtin", "hex", "mem" };
+        {
+            // Bulk bridges into the provider. A pattern loop reading values one by one
+            // crosses the patch and overlay resolution once per element; these cross it
+            // once per region, so checksumming or transforming large regions stays fast
+
+            // Clamps a pattern-visible region against the provider's address space and
+            // returns the readable byte count
+            constexpr static auto clampRegion = [](prv::Provider *provider, u64 address, u64 size) -> u64 {
+                const auto baseAddress  = provider->getBaseAddress();
+                const auto providerSize = provider->getActualSize();
+
+                if (address < baseAddress || address - baseAddress >= providerSize)
+                    return 0;
+
+                return std::min<u64>(size, providerSize - (address - baseAddress));
+            };
+
+            /* read_bytes(address, size) */
+            ContentRegistry::PatternLanguage::addFunction(nsHexMem, "read_bytes", FunctionParameterCount::exactly(2), [](Evaluator *, auto params) -> std::optional<Token::Literal> {
+                const u64 address = Token::literalToUnsigned(params[0]);
+                const u64 size    = Token::literalToUnsigned(params[1]);
+
+                auto provider = ImHexApi::Provider::get();
+
+                std::string data;
+                data.resize(clampRegion(provider, address, size));
+                if (!data.empty())
+                    provider->read(address, data.data(), data.size());
+
+                return data;
+            });
+
+            /* sum(address, size) */
+            ContentRegistry::PatternLanguage::addFunction(nsHexMem, "sum", FunctionParameterCount::exactly(2), [](Evaluator *, auto params) -> std::optional<Token::Literal> {
+                const u64 address = Token::literalToUnsigned(params[0]);
+                const u64 size    = Token::literalToUnsigned(params[1]);
+
+                auto provider = ImHexApi::Provider::get();
+
+                const auto readableSize = clampRegion(provider, address, size);
+                if (readableSize == 0)
+                    return u128(0);
+
+                auto reader = prv::BufferedReader(provider);
+                reader.seek(address);
+                reader.setEndAddress((address + readableSize) - 1);
+
+                u128 sum = 0;
+                for (const auto &byte : reader)
+                    sum += byte;
+
+                return sum;
+            });
+
+            /* crc32(address, size) */
+            ContentRegistry::PatternLanguage::addFunction(nsHexMem, "crc32", FunctionParameterCount::exactly(2), [](Evaluator *, auto params) -> std::optional<Token::Literal> {
+                const u64 address = Token::literalToUnsigned(params[0]);
+                const u64 size    = Token::literalToUnsigned(params[1]);
+
+                auto provider = ImHexApi::Provider::get();
+
+                const auto readableSize = clampRegion(provider, address, size);
+
+                return u128(crypt::crc32(provider, address, readableSize, 0x04C1'1DB7, 0xFFFF'FFFF, 0xFFFF'FFFF, true, true));
+            });
+        }
+
         pl::api::Namespace nsHexDec = { "builtin", "hex", "dec" };
         {
             /* demangle(mangled_string) */
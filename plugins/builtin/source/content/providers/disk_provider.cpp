@@ -1,13 +1,17 @@
 #include "content/providers/disk_provider.hpp"
 
 #include <hex/api/localization.hpp>
+#include <hex/api/task.hpp>
 
 #include <hex/helpers/fmt.hpp>
 #include <hex/helpers/utils.hpp>
 #include <hex/ui/imgui_imhex_extensions.h>
 
+#include <atomic>
 #include <bitset>
 #include <filesystem>
+#include <mutex>
+#include <set>
 
 #include <imgui.h>
 
@@ -26,7 +30,9 @@
 
 namespace hex::plugin::builtin::prv {
 
-    DiskProvider::DiskProvider() : Provider() {
+    // 1 MiB cache blocks act as a sequential read-ahead window: a single sector touched
+    // by the hex editor pulls in the whole surrounding megabyte with one device request
+    DiskProvider::DiskProvider() : CachedProvider(0x10'0000, 0x40) {
 
     }
 
@@ -94,7 +100,6 @@ namespace hex::plugin::builtin::prv {
                         nullptr)) {
                     this->m_diskSize   = diskGeometry.DiskSize.QuadPart;
                     this->m_sectorSize = diskGeometry.Geometry.BytesPerSector;
-                    this->m_sectorBuffer.resize(this->m_sectorSize);
                 }
             }
 
@@ -112,12 +117,13 @@ namespace hex::plugin::builtin::prv {
 
             struct stat driveStat;
 
-            if (::stat(path.c_str(), &driveStat) == 0)
+            if (::stat(path.c_str(), &driveStat) == 0) {
                 this->m_diskSize   = driveStat.st_size;
-            else
-                this->m_diskSize = 0;
-
-            this->m_sectorSize = 0;
+                this->m_sectorSize = driveStat.st_blksize > 0 ? driveStat.st_blksize : 512;
+            } else {
+                this->m_diskSize   = 0;
+                this->m_sectorSize = 512;
+            }
 
             this->m_diskHandle = ::open(path.c_str(), O_RDWR);
             if (this->m_diskHandle == -1) {
@@ -132,10 +138,17 @@ namespace hex::plugin::builtin::prv {
 
         #endif
 
+        if (this->m_sectorSize == 0)
+            this->m_sectorSize = 512;
+
+        this->invalidateCache();
+
         return true;
     }
 
     void DiskProvider::close() {
+        this->flushPendingWrites();
+
         #if defined(OS_WINDOWS)
 
             if (this->m_diskHandle != INVALID_HANDLE_VALUE)
@@ -153,105 +166,191 @@ namespace hex::plugin::builtin::prv {
         #endif
     }
 
-    void DiskProvider::readRaw(u64 offset, void *buffer, size_t size) {
+    void DiskProvider::readFromDisk(u64 offset, void *buffer, size_t size) {
         #if defined(OS_WINDOWS)
 
-            DWORD bytesRead = 0;
-
-            u64 startOffset = offset;
+            auto bytes = static_cast<u8 *>(buffer);
 
             while (size > 0) {
                 LARGE_INTEGER seekPosition;
-                seekPosition.LowPart  = (offset & 0xFFFF'FFFF) - (offset % this->m_sectorSize);
-                seekPosition.HighPart = offset >> 32;
+                seekPosition.QuadPart = offset;
 
-                if (this->m_sectorBufferAddress != static_cast<u64>(seekPosition.QuadPart)) {
-                    ::SetFilePointer(this->m_diskHandle, seekPosition.LowPart, &seekPosition.HighPart, FILE_BEGIN);
-                    ::ReadFile(this->m_diskHandle, this->m_sectorBuffer.data(), this->m_sectorBuffer.size(), &bytesRead, nullptr);
-                    this->m_sectorBufferAddress = seekPosition.QuadPart;
-                }
+                ::SetFilePointer(this->m_diskHandle, seekPosition.LowPart, &seekPosition.HighPart, FILE_BEGIN);
 
-                std::memcpy(reinterpret_cast<u8 *>(buffer) + (offset - startOffset), this->m_sectorBuffer.data() + (offset & (this->m_sectorSize - 1)), std::min(this->m_sectorSize, size));
+                DWORD bytesRead = 0;
+                if (!::ReadFile(this->m_diskHandle, bytes, size, &bytesRead, nullptr) || bytesRead == 0)
+                    break;
 
-                size = std::max<ssize_t>(static_cast<ssize_t>(size) - this->m_sectorSize, 0);
-                offset += this->m_sectorSize;
+                bytes  += bytesRead;
+                offset += bytesRead;
+                size   -= bytesRead;
             }
 
         #else
 
-        u64 startOffset    = offset;
+            auto bytes = static_cast<u8 *>(buffer);
+
+            ::lseek(this->m_diskHandle, offset, SEEK_SET);
+            while (size > 0) {
+                auto bytesRead = ::read(this->m_diskHandle, bytes, size);
+                if (bytesRead <= 0)
+                    break;
+
+                bytes += bytesRead;
+                size  -= bytesRead;
+            }
+
+        #endif
+    }
 
-        while (size > 0) {
-            u64 seekPosition = offset - (offset % this->m_sectorSize);
+    void DiskProvider::writeToDisk(u64 offset, const void *buffer, size_t size) {
+        #if defined(OS_WINDOWS)
+
+            auto bytes = static_cast<const u8 *>(buffer);
+
+            while (size > 0) {
+                LARGE_INTEGER seekPosition;
+                seekPosition.QuadPart = offset;
 
-            if (this->m_sectorBufferAddress != seekPosition) {
-                ::lseek(this->m_diskHandle, seekPosition, SEEK_SET);
-                if (::read(this->m_diskHandle, buffer, size) < 0)
+                ::SetFilePointer(this->m_diskHandle, seekPosition.LowPart, &seekPosition.HighPart, FILE_BEGIN);
+
+                DWORD bytesWritten = 0;
+                if (!::WriteFile(this->m_diskHandle, bytes, size, &bytesWritten, nullptr) || bytesWritten == 0)
                     break;
 
-                this->m_sectorBufferAddress = seekPosition;
+                bytes  += bytesWritten;
+                offset += bytesWritten;
+                size   -= bytesWritten;
             }
 
-            std::memcpy(reinterpret_cast<u8 *>(buffer) + (offset - startOffset), this->m_sectorBuffer.data() + (offset & (this->m_sectorSize - 1)), std::min(this->m_sectorSize, size));
+        #else
 
-            size = std::max<ssize_t>(static_cast<ssize_t>(size) - this->m_sectorSize, 0);
-            offset += this->m_sectorSize;
-        }
+            auto bytes = static_cast<const u8 *>(buffer);
+
+            ::lseek(this->m_diskHandle, offset, SEEK_SET);
+            while (size > 0) {
+                auto bytesWritten = ::write(this->m_diskHandle, bytes, size);
+                if (bytesWritten <= 0)
+                    break;
+
+                bytes += bytesWritten;
+                size  -= bytesWritten;
+            }
 
         #endif
     }
 
-    void DiskProvider::writeRaw(u64 offset, const void *buffer, size_t size) {
-        #if defined(OS_WINDOWS)
+    void DiskProvider::readFromSource(u64 offset, void *buffer, size_t size) {
+        if (size == 0 || !this->isAvailable())
+            return;
 
-            DWORD bytesWritten = 0;
+        const auto sectorSize = this->m_sectorSize;
 
-            u64 startOffset = offset;
+        // Raw device reads have to be sector aligned, so widen the requested range
+        // to sector boundaries and copy the relevant part out afterwards
+        const u64 alignedStart = offset - (offset % sectorSize);
+        const u64 alignedEnd   = ((offset + size + sectorSize - 1) / sectorSize) * sectorSize;
 
-            std::vector<u8> modifiedSectorBuffer;
-            modifiedSectorBuffer.resize(this->m_sectorSize);
+        std::vector<u8> sectorData(alignedEnd - alignedStart, 0x00);
+        this->readFromDisk(alignedStart, sectorData.data(), sectorData.size());
 
-            while (size > 0) {
-                u64 sectorBase  = offset - (offset % this->m_sectorSize);
-                size_t currSize = std::min(size, this->m_sectorSize);
+        std::memcpy(buffer, sectorData.data() + (offset - alignedStart), size);
 
-                this->readRaw(sectorBase, modifiedSectorBuffer.data(), modifiedSectorBuffer.size());
-                std::memcpy(modifiedSectorBuffer.data() + ((offset - sectorBase) % this->m_sectorSize), reinterpret_cast<const u8 *>(buffer) + (startOffset - offset), currSize);
+        this->applyPendingWrites(offset, buffer, size);
+    }
 
-                LARGE_INTEGER seekPosition;
-                seekPosition.LowPart  = (offset & 0xFFFF'FFFF) - (offset % this->m_sectorSize);
-                seekPosition.HighPart = offset >> 32;
+    void DiskProvider::writeToSource(u64 offset, const void *buffer, size_t size) {
+        if (size == 0 || !this->isAvailable())
+            return;
 
-                ::SetFilePointer(this->m_diskHandle, seekPosition.LowPart, &seekPosition.HighPart, FILE_BEGIN);
-                ::WriteFile(this->m_diskHandle, modifiedSectorBuffer.data(), modifiedSectorBuffer.size(), &bytesWritten, nullptr);
+        std::unique_lock lock(this->m_pendingWritesMutex);
+
+        // Merge the new range with any pending ranges it touches or directly abuts so
+        // neighbouring sector writes end up as one large write instead of many small ones
+        u64 newStart = offset;
+        u64 newEnd   = offset + size;
+
+        auto iter = this->m_pendingWrites.lower_bound(offset);
+        if (iter != this->m_pendingWrites.begin())
+            --iter;
 
-                offset += currSize;
-                size -= currSize;
+        std::vector<std::pair<u64, std::vector<u8>>> overlapping;
+        while (iter != this->m_pendingWrites.end() && iter->first <= newEnd) {
+            const u64 rangeEnd = iter->first + iter->second.size();
+
+            if (rangeEnd >= newStart) {
+                newStart = std::min(newStart, iter->first);
+                newEnd   = std::max(newEnd, rangeEnd);
+
+                this->m_pendingWriteBytes -= iter->second.size();
+                overlapping.emplace_back(iter->first, std::move(iter->second));
+                iter = this->m_pendingWrites.erase(iter);
+            } else {
+                ++iter;
             }
+        }
 
-        #else
+        std::vector<u8> merged(newEnd - newStart, 0x00);
+        for (const auto &[rangeStart, rangeData] : overlapping)
+            std::memcpy(merged.data() + (rangeStart - newStart), rangeData.data(), rangeData.size());
+        std::memcpy(merged.data() + (offset - newStart), buffer, size);
+
+        this->m_pendingWriteBytes += merged.size();
+        this->m_pendingWrites.emplace(newStart, std::move(merged));
 
-            u64 startOffset = offset;
+        if (this->m_pendingWriteBytes >= WriteCombineThreshold) {
+            lock.unlock();
+            this->flushPendingWrites();
+        }
+    }
 
-            std::vector<u8> modifiedSectorBuffer;
-            modifiedSectorBuffer.resize(this->m_sectorSize);
+    void DiskProvider::applyPendingWrites(u64 offset, void *buffer, size_t size) {
+        std::scoped_lock lock(this->m_pendingWritesMutex);
 
-            while (size > 0) {
-                u64 sectorBase  = offset - (offset % this->m_sectorSize);
-                size_t currSize = std::min(size, this->m_sectorSize);
+        auto bytes = static_cast<u8 *>(buffer);
 
-                this->readRaw(sectorBase, modifiedSectorBuffer.data(), modifiedSectorBuffer.size());
-                std::memcpy(modifiedSectorBuffer.data() + ((offset - sectorBase) % this->m_sectorSize), reinterpret_cast<const u8 *>(buffer) + (startOffset - offset), currSize);
+        auto iter = this->m_pendingWrites.lower_bound(offset);
+        if (iter != this->m_pendingWrites.begin())
+            --iter;
 
-                ::lseek(this->m_diskHandle, sectorBase, SEEK_SET);
-                if (::write(this->m_diskHandle, modifiedSectorBuffer.data(), modifiedSectorBuffer.size()) < 0)
-                    break;
+        for (; iter != this->m_pendingWrites.end() && iter->first < offset + size; ++iter) {
+            const u64 overlapStart = std::max(offset, iter->first);
+            const u64 overlapEnd   = std::min(offset + size, iter->first + iter->second.size());
+            if (overlapStart >= overlapEnd)
+                continue;
 
-                offset += currSize;
-                size -= currSize;
-            }
+            std::memcpy(bytes + (overlapStart - offset), iter->second.data() + (overlapStart - iter->first), overlapEnd - overlapStart);
+        }
+    }
 
-        #endif
+    void DiskProvider::flushPendingWrites() {
+        std::scoped_lock lock(this->m_pendingWritesMutex);
+
+        if (this->m_pendingWrites.empty() || !this->isAvailable())
+            return;
+
+        const auto sectorSize = this->m_sectorSize;
+
+        for (const auto &[rangeStart, rangeData] : this->m_pendingWrites) {
+            const u64 alignedStart = rangeStart - (rangeStart % sectorSize);
+            const u64 alignedEnd   = ((rangeStart + rangeData.size() + sectorSize - 1) / sectorSize) * sectorSize;
+
+            std::vector<u8> sectorData(alignedEnd - alignedStart, 0x00);
+
+            // Only the partially covered boundary sectors need a read-modify-write,
+            // everything in between is overwritten wholesale
+            if (alignedStart < rangeStart)
+                this->readFromDisk(alignedStart, sectorData.data(), sectorSize);
+            if (alignedEnd > rangeStart + rangeData.size() && alignedEnd - sectorSize >= rangeStart)
+                this->readFromDisk(alignedEnd - sectorSize, sectorData.data() + (alignedEnd - sectorSize - alignedStart), sectorSize);
+
+            std::memcpy(sectorData.data() + (rangeStart - alignedStart), rangeData.data(), rangeData.size());
+
+            this->writeToDisk(alignedStart, sectorData.data(), sectorData.size());
+        }
+
+        this->m_pendingWrites.clear();
+        this->m_pendingWriteBytes = 0;
     }
 
     size_t DiskProvider::getActualSize() const {
@@ -271,41 +370,85 @@ namespace hex::plugin::builtin::prv {
     }
 
 
+    // Drive enumeration results are shared between all disk providers, so reopening
+    // the dialog shows the last enumeration instantly while a refresh runs behind it
+    namespace {
+
+        std::mutex s_drivesMutex;
+        std::set<std::string> s_availableDrives;
+        std::atomic<bool> s_enumeratingDrives = false;
+
+    }
+
     void DiskProvider::reloadDrives() {
         #if defined(OS_WINDOWS)
 
-            this->m_availableDrives.clear();
-            std::bitset<32> drives = ::GetLogicalDrives();
-            for (char i = 0; i < 26; i++) {
-                if (drives[i])
-                    this->m_availableDrives.insert(hex::format(R"(\\.\{:c}:)", 'A' + i));
-            }
+            // Probing a sleeping device can block for seconds, so the whole enumeration
+            // runs on a background task, publishing each entry as soon as it's found
+            if (s_enumeratingDrives.exchange(true))
+                return;
 
-            auto logicalDrives = this->m_availableDrives;
-            for (const auto &drive : logicalDrives) {
-                auto handle = reinterpret_cast<HANDLE>(::CreateFile(drive.data(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, 0, nullptr));
-
-                if (handle == INVALID_HANDLE_VALUE) continue;
-
-                VOLUME_DISK_EXTENTS diskExtents = { };
-                DWORD bytesRead                 = 0;
-                auto result                     = ::DeviceIoControl(
-                    handle,
-                    IOCTL_VOLUME_GET_VOLUME_DISK_EXTENTS,
-                    nullptr,
-                    0,
-                    &diskExtents,
-                    sizeof(VOLUME_DISK_EXTENTS),
-                    &bytesRead,
-                    nullptr);
-
-                if (result) {
-                    auto diskPath = hex::format(R"(\\.\PhysicalDrive{})", diskExtents.Extents[0].DiskNumber);
-                    this->m_availableDrives.insert(diskPath);
+            TaskManager::createBackgroundTask("hex.builtin.provider.disk.enumerating", [](auto &) {
+                ON_SCOPE_EXIT { s_enumeratingDrives = false; };
+
+                // How long a single device may take to answer the extent query before
+                // it's skipped for this pass
+                constexpr static DWORD DeviceQueryTimeout = 2'000;
+
+                std::set<std::string> logicalDrives;
+                std::bitset<32> drives = ::GetLogicalDrives();
+                for (char i = 0; i < 26; i++) {
+                    if (drives[i])
+                        logicalDrives.insert(hex::format(R"(\\.\{:c}:)", 'A' + i));
                 }
 
-                ::CloseHandle(handle);
-            }
+                // The logical drives are known instantly and show up right away; mapping
+                // them to physical drives below is what may have to wake devices up
+                {
+                    std::scoped_lock lock(s_drivesMutex);
+                    s_availableDrives = logicalDrives;
+                }
+
+                for (const auto &drive : logicalDrives) {
+                    auto handle = reinterpret_cast<HANDLE>(::CreateFile(drive.data(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_FLAG_OVERLAPPED, nullptr));
+
+                    if (handle == INVALID_HANDLE_VALUE) continue;
+
+                    OVERLAPPED overlapped = { };
+                    overlapped.hEvent     = ::CreateEvent(nullptr, TRUE, FALSE, nullptr);
+
+                    VOLUME_DISK_EXTENTS diskExtents = { };
+                    DWORD bytesRead                 = 0;
+                    bool result                     = ::DeviceIoControl(
+                        handle,
+                        IOCTL_VOLUME_GET_VOLUME_DISK_EXTENTS,
+                        nullptr,
+                        0,
+                        &diskExtents,
+                        sizeof(VOLUME_DISK_EXTENTS),
+                        &bytesRead,
+                        &overlapped);
+
+                    // The query runs overlapped with a timeout so one unresponsive
+                    // device can't stall the rest of the enumeration
+                    if (!result && ::GetLastError() == ERROR_IO_PENDING) {
+                        if (::WaitForSingleObject(overlapped.hEvent, DeviceQueryTimeout) == WAIT_OBJECT_0)
+                            result = ::GetOverlappedResult(handle, &overlapped, &bytesRead, FALSE);
+                        else
+                            ::CancelIo(handle);
+                    }
+
+                    if (result) {
+                        auto diskPath = hex::format(R"(\\.\PhysicalDrive{})", diskExtents.Extents[0].DiskNumber);
+
+                        std::scoped_lock lock(s_drivesMutex);
+                        s_availableDrives.insert(diskPath);
+                    }
+
+                    ::CloseHandle(overlapped.hEvent);
+                    ::CloseHandle(handle);
+                }
+            });
 
         #endif
     }
@@ -313,24 +456,33 @@ namespace hex::plugin::builtin::prv {
     void DiskProvider::drawLoadInterface() {
         #if defined(OS_WINDOWS)
 
-            if (this->m_availableDrives.empty())
-                this->reloadDrives();
+            {
+                std::scoped_lock lock(s_drivesMutex);
 
-            if (ImGui::BeginListBox("hex.builtin.provider.disk.selected_disk"_lang)) {
+                if (s_availableDrives.empty() && !s_enumeratingDrives)
+                    this->reloadDrives();
 
-                for (const auto &drive : this->m_availableDrives) {
-                    if (ImGui::Selectable(drive.c_str(), this->m_path == drive))
-                        this->m_path = drive;
-                }
+                if (ImGui::BeginListBox("hex.builtin.provider.disk.selected_disk"_lang)) {
+
+                    for (const auto &drive : s_availableDrives) {
+                        if (ImGui::Selectable(drive.c_str(), this->m_path == drive))
+                            this->m_path = drive;
+                    }
 
-                ImGui::EndListBox();
+                    ImGui::EndListBox();
+                }
             }
 
             ImGui::SameLine();
 
             if (ImGui::Button("hex.builtin.provider.disk.reload"_lang)) {
                 this->reloadDrives();
-        }
+            }
+
+            if (s_enumeratingDrives) {
+                ImGui::SameLine();
+                ImGui::TextSpinner("hex.builtin.provider.disk.enumerating"_lang);
+            }
 
         #else
 
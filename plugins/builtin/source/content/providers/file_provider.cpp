@@ -1,15 +1,26 @@
 #include "content/providers/file_provider.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cstring>
 
+#include <hex/api/event.hpp>
 #include <hex/api/imhex_api.hpp>
 #include <hex/api/localization.hpp>
 #include <hex/helpers/utils.hpp>
 #include <hex/helpers/file.hpp>
 #include <hex/helpers/fmt.hpp>
+#include <hex/providers/io_tracer.hpp>
 
 #include <nlohmann/json.hpp>
 
+#if defined(OS_WINDOWS)
+    #include <winioctl.h>
+#elif defined(OS_LINUX)
+    #include <poll.h>
+    #include <sys/inotify.h>
+#endif
+
 namespace hex::plugin::builtin::prv {
 
     bool FileProvider::isAvailable() const {
@@ -29,7 +40,7 @@ namespace hex::plugin::builtin::prv {
     }
 
     bool FileProvider::isSavable() const {
-        return !this->getPatches().empty();
+        return this->m_pieceTableActive || !this->getPatches().empty();
     }
 
 
@@ -37,11 +48,11 @@ namespace hex::plugin::builtin::prv {
         if ((offset - this->getBaseAddress()) > (this->getActualSize() - size) || buffer == nullptr || size == 0)
             return;
 
+        hex::prv::iotrace::Scope trace(hex::prv::iotrace::Kind::Read, offset, size);
+
         this->readRaw(offset - this->getBaseAddress(), buffer, size);
 
-        for (u64 i = 0; i < size; i++)
-            if (getPatches().contains(offset + i))
-                reinterpret_cast<u8 *>(buffer)[i] = getPatches()[offset + i];
+        getPatches().apply(offset, buffer, size);
 
         if (overlays)
             this->applyOverlays(offset, buffer, size);
@@ -58,17 +69,123 @@ namespace hex::plugin::builtin::prv {
         if ((offset + size) > this->getActualSize() || buffer == nullptr || size == 0)
             return;
 
-        std::memcpy(buffer, reinterpret_cast<u8 *>(this->m_mappedFile) + offset, size);
+        if (!this->m_pieceTableActive) {
+            std::memcpy(buffer, reinterpret_cast<u8 *>(this->m_mappedFile) + offset, size);
+            return;
+        }
+
+        auto piece = std::prev(std::upper_bound(this->m_pieces.begin(), this->m_pieces.end(), offset, [](u64 address, const Piece &piece) {
+            return address < piece.logicalStart;
+        }));
+
+        auto bytes = static_cast<u8 *>(buffer);
+        while (size > 0 && piece != this->m_pieces.end()) {
+            const auto pieceOffset = offset - piece->logicalStart;
+            const auto copySize    = std::min<size_t>(size, piece->size - pieceOffset);
+
+            const u8 *source;
+            if (piece->source == Piece::Source::File)
+                source = reinterpret_cast<const u8 *>(this->m_mappedFile) + piece->offset + pieceOffset;
+            else
+                source = this->m_addedBytes.data() + piece->offset + pieceOffset;
+
+            std::memcpy(bytes, source, copySize);
+
+            bytes  += copySize;
+            offset += copySize;
+            size   -= copySize;
+            piece++;
+        }
+    }
+
+    std::optional<std::span<const u8>> FileProvider::readRawBorrowed(u64 offset, size_t size) const {
+        if ((offset + size) > this->getActualSize() || size == 0 || this->m_mappedFile == nullptr)
+            return std::nullopt;
+
+        // Only the plain mapping is contiguous; with an active piece table the data has to be copied
+        if (this->m_pieceTableActive)
+            return std::nullopt;
+
+        return std::span(reinterpret_cast<const u8 *>(this->m_mappedFile) + offset, size);
     }
 
     void FileProvider::writeRaw(u64 offset, const void *buffer, size_t size) {
         if ((offset + size) > this->getActualSize() || buffer == nullptr || size == 0)
             return;
 
-        std::memcpy(reinterpret_cast<u8 *>(this->m_mappedFile) + offset, buffer, size);
+        // Writing through the mapping can allocate previously sparse regions,
+        // so the hole map can't be trusted anymore
+        if (!this->m_allocatedRanges.empty())
+            this->m_allocatedRanges.clear();
+
+        if (!this->m_pieceTableActive) {
+            std::memcpy(reinterpret_cast<u8 *>(this->m_mappedFile) + offset, buffer, size);
+            this->markPagesDirty(offset, size);
+            return;
+        }
+
+        auto piece = std::prev(std::upper_bound(this->m_pieces.begin(), this->m_pieces.end(), offset, [](u64 address, const Piece &piece) {
+            return address < piece.logicalStart;
+        }));
+
+        auto bytes = static_cast<const u8 *>(buffer);
+        while (size > 0 && piece != this->m_pieces.end()) {
+            const auto pieceOffset = offset - piece->logicalStart;
+            const auto copySize    = std::min<size_t>(size, piece->size - pieceOffset);
+
+            u8 *destination;
+            if (piece->source == Piece::Source::File) {
+                destination = reinterpret_cast<u8 *>(this->m_mappedFile) + piece->offset + pieceOffset;
+                this->markPagesDirty(piece->offset + pieceOffset, copySize);
+            } else {
+                destination = this->m_addedBytes.data() + piece->offset + pieceOffset;
+            }
+
+            std::memcpy(destination, bytes, copySize);
+
+            bytes  += copySize;
+            offset += copySize;
+            size   -= copySize;
+            piece++;
+        }
     }
 
     void FileProvider::save() {
+        if (this->m_pieceTableActive) {
+            auto tempPath = this->m_path;
+            tempPath += ".tmp";
+
+            {
+                fs::File file(tempPath, fs::File::Mode::Create);
+                if (!file.isValid())
+                    return;
+
+                std::vector<u8> buffer(0x10'0000);
+                const auto totalSize = this->getActualSize();
+
+                for (u64 offset = 0; offset < totalSize;) {
+                    const auto blockSize = std::min<size_t>(buffer.size(), totalSize - offset);
+
+                    this->readRaw(offset, buffer.data(), blockSize);
+                    file.write(buffer.data(), blockSize);
+
+                    offset += blockSize;
+                }
+            }
+
+            this->close();
+
+            std::fs::remove(this->m_path);
+            std::fs::rename(tempPath, this->m_path);
+
+            this->m_pieces.clear();
+            this->m_addedBytes.clear();
+            this->m_pieceTableSize   = 0;
+            this->m_pieceTableActive = false;
+
+            (void)this->open();
+        }
+
         this->applyPatches();
     }
 
@@ -92,6 +209,17 @@ namespace hex::plugin::builtin::prv {
     }
 
     void FileProvider::resize(size_t newSize) {
+        if (this->m_pieceTableActive) {
+            const auto oldSize = this->getActualSize();
+
+            if (newSize > oldSize)
+                this->insert(oldSize, newSize - oldSize);
+            else if (newSize < oldSize)
+                this->remove(newSize, oldSize - newSize);
+
+            return;
+        }
+
         this->close();
 
         {
@@ -104,52 +232,81 @@ namespace hex::plugin::builtin::prv {
         (void)this->open();
     }
 
-    void FileProvider::insert(u64 offset, size_t size) {
-        auto oldSize = this->getActualSize();
-        this->resize(oldSize + size);
+    void FileProvider::initPieceTable() {
+        if (this->m_pieceTableActive)
+            return;
 
-        std::vector<u8> buffer(0x1000);
-        const std::vector<u8> zeroBuffer(0x1000);
+        if (this->m_fileSize > 0)
+            this->m_pieces.push_back({ Piece::Source::File, 0, this->m_fileSize, 0 });
 
-        auto position = oldSize;
-        while (position > offset) {
-            const auto readSize = std::min<size_t>(position - offset, buffer.size());
+        this->m_pieceTableSize   = this->m_fileSize;
+        this->m_pieceTableActive = true;
+    }
 
-            position -= readSize;
+    std::vector<FileProvider::Piece>::iterator FileProvider::splitPieceAt(u64 offset) {
+        auto piece = std::lower_bound(this->m_pieces.begin(), this->m_pieces.end(), offset, [](const Piece &piece, u64 address) {
+            return piece.logicalStart < address;
+        });
 
-            this->readRaw(position, buffer.data(), readSize);
-            this->writeRaw(position, zeroBuffer.data(), readSize);
-            this->writeRaw(position + size, buffer.data(), readSize);
-        }
+        if (piece != this->m_pieces.end() && piece->logicalStart == offset)
+            return piece;
+        if (piece == this->m_pieces.begin())
+            return piece;
 
-        Provider::insert(offset, size);
+        piece--;
+        if (offset >= piece->logicalStart + piece->size)
+            return std::next(piece);
+
+        // Split the piece containing the offset in two
+        const auto leftSize = offset - piece->logicalStart;
+        Piece right = { piece->source, piece->offset + leftSize, piece->size - leftSize, offset };
+        piece->size = leftSize;
+
+        return this->m_pieces.insert(std::next(piece), right);
     }
 
-    void FileProvider::remove(u64 offset, size_t size) {
-        auto oldSize = this->getActualSize();
-        this->resize(oldSize + size);
+    void FileProvider::updatePieceOffsets() {
+        u64 logicalStart = 0;
+        for (auto &piece : this->m_pieces) {
+            piece.logicalStart = logicalStart;
+            logicalStart += piece.size;
+        }
 
-        std::vector<u8> buffer(0x1000);
+        this->m_pieceTableSize = logicalStart;
+    }
 
-        const auto newSize = oldSize - size;
-        auto position = offset;
-        while (position < newSize) {
-            const auto readSize = std::min<size_t>(newSize - position, buffer.size());
+    void FileProvider::insert(u64 offset, size_t size) {
+        this->initPieceTable();
 
-            this->readRaw(position + size, buffer.data(), readSize);
-            this->writeRaw(position, buffer.data(), readSize);
+        auto iter = this->splitPieceAt(offset);
 
-            position += readSize;
-        }
+        Piece piece = { Piece::Source::Added, this->m_addedBytes.size(), size, 0 };
+        this->m_addedBytes.insert(this->m_addedBytes.end(), size, 0x00);
+        this->m_pieces.insert(iter, piece);
 
-        this->resize(newSize);
+        this->updatePieceOffsets();
 
         Provider::insert(offset, size);
+    }
+
+    void FileProvider::remove(u64 offset, size_t size) {
+        if (offset >= this->getActualSize() || size == 0)
+            return;
+        size = std::min<size_t>(size, this->getActualSize() - offset);
+
+        this->initPieceTable();
+
+        const auto beginIndex = this->splitPieceAt(offset) - this->m_pieces.begin();
+        const auto endIter    = this->splitPieceAt(offset + size);
+        this->m_pieces.erase(this->m_pieces.begin() + beginIndex, endIter);
+
+        this->updatePieceOffsets();
+
         Provider::remove(offset, size);
     }
 
     size_t FileProvider::getActualSize() const {
-        return this->m_fileSize;
+        return this->m_pieceTableActive ? this->m_pieceTableSize : this->m_fileSize;
     }
 
     std::string FileProvider::getName() const {
@@ -181,6 +338,99 @@ namespace hex::plugin::builtin::prv {
         this->m_path = path;
     }
 
+    void FileProvider::markPagesDirty(u64 offset, size_t size) {
+        if (size == 0 || this->m_mappedFile == nullptr)
+            return;
+
+        bool scheduleFlush = false;
+
+        {
+            std::scoped_lock lock(this->m_dirtyRangesMutex);
+
+            u64 start = offset, end = offset + size;
+
+            // Coalesce with overlapping or adjacent dirty ranges
+            auto iter = this->m_dirtyRanges.upper_bound(start);
+            if (iter != this->m_dirtyRanges.begin() && std::prev(iter)->second >= start)
+                iter--;
+
+            while (iter != this->m_dirtyRanges.end() && iter->first <= end) {
+                start = std::min(start, iter->first);
+                end   = std::max(end, iter->second);
+                iter  = this->m_dirtyRanges.erase(iter);
+            }
+
+            this->m_dirtyRanges[start] = end;
+            this->m_dirtyBytes += size;
+
+            scheduleFlush = this->m_dirtyBytes >= WriteBackThreshold && !this->m_writeBackTask.isRunning();
+        }
+
+        if (scheduleFlush) {
+            this->m_writeBackTask = TaskManager::createIoTask("hex.builtin.common.processing", [this](auto &) {
+                this->flushDirtyPages();
+            });
+        }
+    }
+
+    void FileProvider::flushDirtyPages() {
+        std::scoped_lock lock(this->m_dirtyRangesMutex);
+
+        if (this->m_mappedFile != nullptr) {
+            for (const auto &[start, end] : this->m_dirtyRanges) {
+                #if defined(OS_WINDOWS)
+
+                    ::FlushViewOfFile(reinterpret_cast<u8 *>(this->m_mappedFile) + start, end - start);
+
+                #else
+
+                    const auto pageSize     = static_cast<u64>(::sysconf(_SC_PAGESIZE));
+                    const auto alignedStart = start - (start % pageSize);
+
+                    ::msync(reinterpret_cast<u8 *>(this->m_mappedFile) + alignedStart, end - alignedStart, MS_ASYNC);
+
+                #endif
+            }
+        }
+
+        this->m_dirtyRanges.clear();
+        this->m_dirtyBytes = 0;
+    }
+
+    void FileProvider::adviseAccessPattern(AccessPattern pattern, u64 offset, size_t size) {
+        if (this->m_mappedFile == nullptr || this->m_fileSize == 0)
+            return;
+
+        if (size == 0 || (offset + size) > this->m_fileSize) {
+            offset = 0;
+            size   = this->m_fileSize;
+        }
+
+        #if defined(OS_WINDOWS)
+
+            // Windows only supports explicit prefetching, access pattern hints have no equivalent
+            if (pattern == AccessPattern::Sequential || pattern == AccessPattern::WillNeed) {
+                WIN32_MEMORY_RANGE_ENTRY range = { reinterpret_cast<u8 *>(this->m_mappedFile) + offset, size };
+                ::PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+            }
+
+        #else
+
+            const auto pageSize    = static_cast<u64>(::sysconf(_SC_PAGESIZE));
+            const auto alignedBase = offset - (offset % pageSize);
+            auto address           = reinterpret_cast<u8 *>(this->m_mappedFile) + alignedBase;
+            const auto length      = size + (offset - alignedBase);
+
+            switch (pattern) {
+                case AccessPattern::Normal:     ::madvise(address, length, MADV_NORMAL);     break;
+                case AccessPattern::Sequential: ::madvise(address, length, MADV_SEQUENTIAL); break;
+                case AccessPattern::Random:     ::madvise(address, length, MADV_RANDOM);     break;
+                case AccessPattern::WillNeed:   ::madvise(address, length, MADV_WILLNEED);   break;
+            }
+
+        #endif
+    }
+
     bool FileProvider::open() {
         this->m_readable = true;
         this->m_writable = true;
@@ -230,6 +480,8 @@ namespace hex::plugin::builtin::prv {
                         return false;
                     }
                 }
+
+                this->queryAllocatedRanges(file);
             } else if (!this->m_emptyFile) {
                 this->m_emptyFile = true;
                 this->resize(1);
@@ -263,12 +515,29 @@ namespace hex::plugin::builtin::prv {
             if (this->m_mappedFile == MAP_FAILED)
                 return false;
 
+            #if defined(MADV_HUGEPAGE)
+                if (this->m_useHugePages)
+                    ::madvise(this->m_mappedFile, this->m_fileSize, MADV_HUGEPAGE);
+            #endif
+
+            this->queryAllocatedRanges(file);
+
         #endif
 
+        this->startChangeWatcher();
+
         return true;
     }
 
     void FileProvider::close() {
+        this->stopChangeWatcher();
+
+        // Start write-back of any remaining dirty pages before unmapping so the
+        // unmap doesn't have to flush everything at once
+        this->flushDirtyPages();
+
+        std::scoped_lock lock(this->m_dirtyRangesMutex);
+
         #if defined(OS_WINDOWS)
 
             if (this->m_mappedFile != nullptr)
@@ -280,6 +549,8 @@ namespace hex::plugin::builtin::prv {
                 ::munmap(this->m_mappedFile, this->m_fileSize);
 
         #endif
+
+        this->m_mappedFile = nullptr;
     }
 
     void FileProvider::loadSettings(const nlohmann::json &settings) {
@@ -295,13 +566,273 @@ namespace hex::plugin::builtin::prv {
         return Provider::storeSettings(settings);
     }
 
+#if defined(OS_WINDOWS)
+
+    void FileProvider::queryAllocatedRanges(HANDLE file) {
+        this->m_allocatedRanges.clear();
+
+        FILE_ALLOCATED_RANGE_BUFFER queryRange = { };
+        queryRange.FileOffset.QuadPart = 0;
+        queryRange.Length.QuadPart     = this->m_fileSize;
+
+        std::array<FILE_ALLOCATED_RANGE_BUFFER, 0x40> ranges = { };
+        while (queryRange.Length.QuadPart > 0) {
+            DWORD bytesReturned = 0;
+            bool moreData = false;
+
+            if (!::DeviceIoControl(file, FSCTL_QUERY_ALLOCATED_RANGES, &queryRange, sizeof(queryRange), ranges.data(), sizeof(ranges), &bytesReturned, nullptr)) {
+                if (::GetLastError() != ERROR_MORE_DATA) {
+                    // Filesystem doesn't support the query, treat the file as fully allocated
+                    this->m_allocatedRanges.clear();
+                    return;
+                }
+
+                moreData = true;
+            }
+
+            const auto rangeCount = bytesReturned / sizeof(FILE_ALLOCATED_RANGE_BUFFER);
+            if (rangeCount == 0)
+                break;
+
+            for (size_t i = 0; i < rangeCount; i++)
+                this->m_allocatedRanges.emplace_back(ranges[i].FileOffset.QuadPart, ranges[i].FileOffset.QuadPart + ranges[i].Length.QuadPart);
+
+            if (!moreData)
+                break;
+
+            const auto nextOffset = this->m_allocatedRanges.back().second;
+            queryRange.FileOffset.QuadPart = nextOffset;
+            queryRange.Length.QuadPart     = this->m_fileSize - nextOffset;
+        }
+
+        // A single range covering the whole file means there are no holes to exploit
+        if (this->m_allocatedRanges.size() == 1 && this->m_allocatedRanges.front().first == 0 && this->m_allocatedRanges.front().second >= this->m_fileSize)
+            this->m_allocatedRanges.clear();
+    }
+
+#else
+
+    void FileProvider::queryAllocatedRanges(int file) {
+        this->m_allocatedRanges.clear();
+
+        #if defined(SEEK_DATA) && defined(SEEK_HOLE)
+
+            u64 offset = 0;
+            while (offset < this->m_fileSize) {
+                const auto dataStart = ::lseek(file, offset, SEEK_DATA);
+                if (dataStart < 0)
+                    break;
+
+                auto holeStart = ::lseek(file, dataStart, SEEK_HOLE);
+                if (holeStart < 0)
+                    holeStart = this->m_fileSize;
+
+                this->m_allocatedRanges.emplace_back(dataStart, holeStart);
+                offset = holeStart;
+            }
+
+            // A single range covering the whole file means there are no holes to exploit
+            if (this->m_allocatedRanges.size() == 1 && this->m_allocatedRanges.front().first == 0 && this->m_allocatedRanges.front().second >= this->m_fileSize)
+                this->m_allocatedRanges.clear();
+
+        #else
+
+            hex::unused(file);
+
+        #endif
+    }
+
+#endif
+
+    void FileProvider::startChangeWatcher() {
+        this->stopChangeWatcher();
+
+        this->m_changeWatcherThread = std::jthread([this](const std::stop_token &stopToken) {
+            #if defined(OS_LINUX)
+
+                // Block on inotify where available so appends are picked up promptly
+                int inotifyFd = ::inotify_init1(IN_NONBLOCK);
+                if (inotifyFd >= 0 && ::inotify_add_watch(inotifyFd, this->m_path.native().c_str(), IN_MODIFY) < 0) {
+                    ::close(inotifyFd);
+                    inotifyFd = -1;
+                }
+
+            #endif
+
+            while (!stopToken.stop_requested()) {
+                #if defined(OS_LINUX)
+
+                    if (inotifyFd >= 0) {
+                        struct pollfd pollFd = { inotifyFd, POLLIN, 0 };
+                        ::poll(&pollFd, 1, 500);
+
+                        std::array<u8, 0x1000> eventBuffer;
+                        while (::read(inotifyFd, eventBuffer.data(), eventBuffer.size()) > 0)
+                            ;
+                    } else {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+                    }
+
+                #else
+
+                    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+                #endif
+
+                if (stopToken.stop_requested())
+                    break;
+
+                #if defined(OS_WINDOWS)
+                    struct stat fileStats = { };
+                    if (wstat(this->m_path.native().c_str(), &fileStats) != 0)
+                        continue;
+                #else
+                    struct stat fileStats = { };
+                    if (::stat(this->m_path.native().c_str(), &fileStats) != 0)
+                        continue;
+                #endif
+
+                if (u64(fileStats.st_size) <= this->m_fileSize)
+                    continue;
+
+                // Remap on the main thread so nothing is reading through the mapping mid-swap
+                TaskManager::doLater([this] {
+                    const auto &providers = ImHexApi::Provider::getProviders();
+                    if (std::find(providers.begin(), providers.end(), this) == providers.end())
+                        return;
+
+                    this->remapGrownFile();
+                });
+            }
+
+            #if defined(OS_LINUX)
+                if (inotifyFd >= 0)
+                    ::close(inotifyFd);
+            #endif
+        });
+    }
+
+    void FileProvider::stopChangeWatcher() {
+        if (this->m_changeWatcherThread.joinable()) {
+            this->m_changeWatcherThread.request_stop();
+            this->m_changeWatcherThread.join();
+        }
+    }
+
+    void FileProvider::remapGrownFile() {
+        const u64 oldSize = this->m_fileSize;
+
+        #if defined(OS_WINDOWS)
+
+            const auto &path = this->m_path.native();
+
+            auto file = reinterpret_cast<HANDLE>(CreateFileW(path.c_str(), GENERIC_READ | (this->m_writable ? GENERIC_WRITE : 0), FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr));
+            if (file == nullptr || file == INVALID_HANDLE_VALUE)
+                return;
+
+            ON_SCOPE_EXIT { CloseHandle(file); };
+
+            LARGE_INTEGER fileSize = { };
+            GetFileSizeEx(file, &fileSize);
+            const u64 newSize = fileSize.QuadPart;
+            if (newSize <= oldSize)
+                return;
+
+            HANDLE mapping = CreateFileMapping(file, nullptr, this->m_writable ? PAGE_READWRITE : PAGE_READONLY, 0, 0, nullptr);
+            if (mapping == nullptr || mapping == INVALID_HANDLE_VALUE)
+                return;
+
+            ON_SCOPE_EXIT { CloseHandle(mapping); };
+
+            auto newMapping = MapViewOfFile(mapping, this->m_writable ? FILE_MAP_ALL_ACCESS : FILE_MAP_READ, 0, 0, newSize);
+            if (newMapping == nullptr)
+                return;
+
+            auto oldMapping = this->m_mappedFile;
+            this->m_mappedFile = newMapping;
+            this->m_fileSize   = newSize;
+
+            if (oldMapping != nullptr)
+                ::UnmapViewOfFile(oldMapping);
+
+        #else
+
+            struct stat fileStats = { };
+            if (::stat(this->m_path.native().c_str(), &fileStats) != 0)
+                return;
+
+            const u64 newSize = fileStats.st_size;
+            if (newSize <= oldSize)
+                return;
+
+            #if defined(OS_LINUX)
+
+                auto newMapping = ::mremap(this->m_mappedFile, oldSize, newSize, MREMAP_MAYMOVE);
+                if (newMapping == MAP_FAILED)
+                    return;
+
+            #else
+
+                // No mremap on this platform, map the grown file fresh and swap
+                int file = ::open(this->m_path.native().c_str(), this->m_writable ? O_RDWR : O_RDONLY);
+                if (file == -1)
+                    return;
+
+                ON_SCOPE_EXIT { ::close(file); };
+
+                auto newMapping = ::mmap(nullptr, newSize, PROT_READ | (this->m_writable ? PROT_WRITE : 0), MAP_SHARED, file, 0);
+                if (newMapping == MAP_FAILED)
+                    return;
+
+                ::munmap(this->m_mappedFile, oldSize);
+
+            #endif
+
+            this->m_mappedFile = newMapping;
+            this->m_fileSize   = newSize;
+
+        #endif
+
+        // External growth may have filled holes or added new ones, the old map is stale either way
+        this->m_allocatedRanges.clear();
+
+        // When the piece table is active, the appended range becomes a new piece at the logical end
+        u64 dirtyStart = oldSize;
+        if (this->m_pieceTableActive) {
+            dirtyStart = this->m_pieceTableSize;
+            this->m_pieces.push_back({ Piece::Source::File, oldSize, newSize - oldSize, this->m_pieceTableSize });
+            this->m_pieceTableSize += newSize - oldSize;
+        }
+
+        EventManager::post<EventRegionDirtied>(this, Region { this->getBaseAddress() + dirtyStart, newSize - oldSize });
+    }
+
     std::pair<Region, bool> FileProvider::getRegionValidity(u64 address) const {
         address -= this->getBaseAddress();
 
-        if (address < this->getActualSize())
-            return { Region { this->getBaseAddress() + address, this->getActualSize() - address }, true };
-        else
+        if (address >= this->getActualSize())
             return { Region::Invalid(), false };
+
+        // Once the piece table is active, logical offsets no longer line up with file offsets,
+        // so the sparse map can't be consulted anymore
+        if (this->m_allocatedRanges.empty() || this->m_pieceTableActive)
+            return { Region { this->getBaseAddress() + address, this->getActualSize() - address }, true };
+
+        auto iter = std::upper_bound(this->m_allocatedRanges.begin(), this->m_allocatedRanges.end(), address,
+            [](u64 address, const auto &range) { return address < range.first; });
+
+        if (iter != this->m_allocatedRanges.begin()) {
+            const auto &range = *std::prev(iter);
+            if (address < range.second)
+                return { Region { this->getBaseAddress() + address, range.second - address }, true };
+        }
+
+        // Inside a hole. Patches and overlays placed over holes still count as data
+        if (auto baseValidity = Provider::getRegionValidity(this->getBaseAddress() + address); baseValidity.second)
+            return baseValidity;
+
+        const u64 nextDataStart = (iter == this->m_allocatedRanges.end()) ? this->getActualSize() : iter->first;
+        return { Region { this->getBaseAddress() + address, nextDataStart - address }, false };
     }
 
 }
@@ -1,8 +1,8 @@
 #include "content/providers/gdb_provider.hpp"
 
+#include <algorithm>
+#include <cstdlib>
 #include <cstring>
-#include <thread>
-#include <chrono>
 
 #include <imgui.h>
 #include <hex/ui/imgui_imhex_extensions.h>
@@ -10,13 +10,12 @@
 #include <hex/helpers/fmt.hpp>
 #include <hex/helpers/crypto.hpp>
 #include <hex/api/localization.hpp>
+#include <hex/providers/io_tracer.hpp>
 
 #include <nlohmann/json.hpp>
 
 namespace hex::plugin::builtin::prv {
 
-    using namespace std::chrono_literals;
-
     namespace gdb {
 
         namespace {
@@ -83,6 +82,46 @@ namespace hex::plugin::builtin::prv {
             return data;
         }
 
+        std::vector<u8> readMemoryPipelined(Socket &socket, u64 address, size_t size) {
+            constexpr static size_t MaxPacketSize = 0x1000;
+
+            if (size <= MaxPacketSize)
+                return readMemory(socket, address, size);
+
+            // Issue all requests with one gathered send so they're in flight while
+            // earlier responses are still being received and decoded
+            std::vector<std::string> packets;
+            std::vector<size_t> requestSizes;
+            for (u64 requestOffset = 0; requestOffset < size; requestOffset += MaxPacketSize) {
+                const auto requestSize = std::min<size_t>(MaxPacketSize, size - requestOffset);
+
+                packets.push_back(createPacket(hex::format("m{:X},{:X}", address + requestOffset, requestSize)));
+                requestSizes.push_back(requestSize);
+            }
+
+            socket.writeVectored(packets);
+
+            std::vector<u8> result;
+            result.reserve(size);
+
+            for (const auto requestSize : requestSizes) {
+                auto receivedPacket = socket.readString(requestSize * 2 + 4);
+                auto receivedData   = receivedPacket.empty() ? std::nullopt : parsePacket(receivedPacket);
+
+                if (!receivedData.has_value() || (receivedData->size() == 3 && receivedData->starts_with("E"))) {
+                    result.resize(result.size() + requestSize);
+                    continue;
+                }
+
+                auto data = crypt::decode16(receivedData.value());
+                data.resize(requestSize);
+
+                result.insert(result.end(), data.begin(), data.end());
+            }
+
+            return result;
+        }
+
         void writeMemory(Socket &socket, u64 address, const void *buffer, size_t size) {
             std::vector<u8> bytes(size);
             std::memcpy(bytes.data(), buffer, size);
@@ -96,6 +135,80 @@ namespace hex::plugin::builtin::prv {
             auto receivedPacket = socket.readString(3);
         }
 
+        std::string readPacket(Socket &socket) {
+            std::string packet = socket.readString();
+
+            // A response is only complete once both checksum digits after the '#' arrived
+            for (u32 retry = 0; retry < 32; retry++) {
+                const auto hashPos = packet.rfind('#');
+                if (hashPos != std::string::npos && packet.size() >= hashPos + 3)
+                    break;
+
+                auto more = socket.readString();
+                if (more.empty())
+                    break;
+
+                packet += more;
+            }
+
+            return packet;
+        }
+
+        /**
+         * @brief Queries the target's memory map via qXfer:memory-map:read
+         *
+         * Returns the mapped regions sorted by start address, or an empty vector
+         * when the stub doesn't implement the memory map query
+         */
+        std::vector<Region> queryMemoryMap(Socket &socket) {
+            constexpr static size_t BlockSize = 0xF00;
+
+            std::string xml;
+            for (u64 offset = 0;;) {
+                socket.writeString(createPacket(hex::format("qXfer:memory-map:read::{:x},{:x}", offset, BlockSize)));
+
+                auto response = parsePacket(readPacket(socket));
+                if (!response.has_value() || response->empty() || response->starts_with("E"))
+                    return {};
+
+                const char marker = response->front();
+                if (marker != 'm' && marker != 'l')
+                    return {};
+
+                xml += response->substr(1);
+                offset += response->size() - 1;
+
+                if (marker == 'l')
+                    break;
+            }
+
+            std::vector<Region> regions;
+            for (size_t pos = xml.find("<memory "); pos != std::string::npos; pos = xml.find("<memory ", pos + 1)) {
+                const auto tagEnd = xml.find('>', pos);
+                if (tagEnd == std::string::npos)
+                    break;
+
+                const auto tag = xml.substr(pos, tagEnd - pos);
+
+                const auto attribute = [&tag](const std::string &name) -> std::optional<u64> {
+                    const auto attributePos = tag.find(name + "=\"");
+                    if (attributePos == std::string::npos)
+                        return std::nullopt;
+
+                    return std::strtoull(tag.c_str() + attributePos + name.size() + 2, nullptr, 0);
+                };
+
+                const auto start  = attribute("start");
+                const auto length = attribute("length");
+                if (start.has_value() && length.has_value() && *length > 0)
+                    regions.push_back(Region { *start, *length });
+            }
+
+            std::sort(regions.begin(), regions.end(), [](const Region &a, const Region &b) { return a.getStartAddress() < b.getStartAddress(); });
+
+            return regions;
+        }
+
         bool enableNoAckMode(Socket &socket) {
             socket.writeString(createPacket("QStartNoAckMode"));
 
@@ -118,7 +231,7 @@ namespace hex::plugin::builtin::prv {
 
     }
 
-    GDBProvider::GDBProvider() : Provider(), m_size(0xFFFF'FFFF) {
+    GDBProvider::GDBProvider() : CachedProvider(0x1000, 0x100), m_size(0xFFFF'FFFF) {
     }
 
     bool GDBProvider::isAvailable() const {
@@ -146,41 +259,13 @@ namespace hex::plugin::builtin::prv {
         if ((offset - this->getBaseAddress()) > (this->getActualSize() - size) || buffer == nullptr || size == 0)
             return;
 
-        offset -= this->getBaseAddress();
-
-        u64 alignedOffset = offset - (offset % CacheLineSize);
-
-        if (size <= CacheLineSize) {
-            std::scoped_lock lock(this->m_cacheLock);
-
-            const auto &cacheLine = std::find_if(this->m_cache.begin(), this->m_cache.end(), [&](auto &line) {
-                return line.address == alignedOffset;
-            });
+        hex::prv::iotrace::Scope trace(hex::prv::iotrace::Kind::Read, offset, size);
 
-            if (cacheLine != this->m_cache.end()) {
-                // Cache hit
-
-            } else {
-                // Cache miss
-
-                this->m_cache.push_back({ alignedOffset, { 0 } });
-            }
-
-            if (cacheLine != this->m_cache.end())
-                std::memcpy(buffer, &cacheLine->data[0] + (offset % CacheLineSize), size);
-        } else {
-            while (size > 0) {
-                size_t readSize = std::min(size, CacheLineSize);
-                this->readRaw(offset, buffer, readSize);
+        offset -= this->getBaseAddress();
 
-                size -= readSize;
-                offset += readSize;
-            }
-        }
+        this->readRaw(offset, buffer, size);
 
-        for (u64 i = 0; i < size; i++)
-            if (getPatches().contains(offset + i))
-                reinterpret_cast<u8 *>(buffer)[i] = getPatches()[offset + PageSize * this->m_currPage + i];
+        getPatches().apply(offset, buffer, size);
 
         if (overlays)
             this->applyOverlays(offset, buffer, size);
@@ -192,19 +277,20 @@ namespace hex::plugin::builtin::prv {
 
         offset -= this->getBaseAddress();
 
-        gdb::writeMemory(this->m_socket, offset, buffer, size);
+        this->writeRaw(offset, buffer, size);
     }
 
-    void GDBProvider::readRaw(u64 offset, void *buffer, size_t size) {
-        if ((offset - this->getBaseAddress()) > (this->getActualSize() - size) || buffer == nullptr || size == 0)
+    void GDBProvider::readFromSource(u64 offset, void *buffer, size_t size) {
+        if ((offset + size) > this->getActualSize() || buffer == nullptr || size == 0)
             return;
 
-        auto data = gdb::readMemory(this->m_socket, offset, size);
-        std::memcpy(buffer, &data[0], data.size());
+        auto data = gdb::readMemoryPipelined(this->m_socket, offset, size);
+        if (!data.empty())
+            std::memcpy(buffer, &data[0], std::min(size, data.size()));
     }
 
-    void GDBProvider::writeRaw(u64 offset, const void *buffer, size_t size) {
-        if ((offset - this->getBaseAddress()) > (this->getActualSize() - size) || buffer == nullptr || size == 0)
+    void GDBProvider::writeToSource(u64 offset, const void *buffer, size_t size) {
+        if ((offset + size) > this->getActualSize() || buffer == nullptr || size == 0)
             return;
 
         gdb::writeMemory(this->m_socket, offset, buffer, size);
@@ -248,30 +334,11 @@ namespace hex::plugin::builtin::prv {
         }
 
         if (this->m_socket.isConnected()) {
-            this->m_cacheUpdateThread = std::thread([this]() {
-                auto cacheLine = this->m_cache.begin();
-                while (this->isConnected()) {
-                    {
-                        std::scoped_lock lock(this->m_cacheLock);
-
-                        if (cacheLine != this->m_cache.end()) {
-                            auto data = gdb::readMemory(this->m_socket, cacheLine->address, 0x1000);
-
-                            while (this->m_cache.size() > 10) {
-                                this->m_cache.pop_front();
-                                cacheLine = this->m_cache.begin();
-                            }
-
-                            std::memcpy(cacheLine->data.data(), data.data(), data.size());
-                        }
-
-                        cacheLine++;
-                        if (cacheLine == this->m_cache.end())
-                            cacheLine = this->m_cache.begin();
-                    }
-                    std::this_thread::sleep_for(100ms);
-                }
-            });
+            // Without the map every probe of an unmapped address costs a doomed
+            // packet exchange ending in a timeout, so grab it once per connection
+            this->m_memoryMap = gdb::queryMemoryMap(this->m_socket);
+
+            this->invalidateCache();
 
             return true;
         } else {
@@ -281,10 +348,6 @@ namespace hex::plugin::builtin::prv {
 
     void GDBProvider::close() {
         this->m_socket.disconnect();
-
-        if (this->m_cacheUpdateThread.joinable()) {
-            this->m_cacheUpdateThread.join();
-        }
     }
 
     bool GDBProvider::isConnected() const {
@@ -325,10 +388,30 @@ namespace hex::plugin::builtin::prv {
     std::pair<Region, bool> GDBProvider::getRegionValidity(u64 address) const {
         address -= this->getBaseAddress();
 
-        if (address < this->getActualSize())
-            return { Region { this->getBaseAddress() + address, this->getActualSize() - address }, true };
-        else
+        if (address >= this->getActualSize())
             return { Region::Invalid(), false };
+
+        // Stubs without a memory map keep the old whole-address-space behavior
+        if (this->m_memoryMap.empty())
+            return { Region { this->getBaseAddress() + address, this->getActualSize() - address }, true };
+
+        // Inside a mapped region the rest of that region is readable; in a hole
+        // everything up to the next mapped region can be skipped outright
+        std::optional<u64> nextMappedStart;
+        for (const auto &region : this->m_memoryMap) {
+            if (address >= region.getStartAddress() && address <= region.getEndAddress()) {
+                const auto end = std::min<u64>(region.getEndAddress(), this->getActualSize() - 1);
+                return { Region { this->getBaseAddress() + address, (end - address) + 1 }, true };
+            }
+
+            if (region.getStartAddress() > address) {
+                nextMappedStart = region.getStartAddress();
+                break;
+            }
+        }
+
+        const auto holeEnd = std::min<u64>(nextMappedStart.value_or(this->getActualSize()), this->getActualSize());
+        return { Region { this->getBaseAddress() + address, holeEnd - address }, false };
     }
 
 }
\ No newline at end of file
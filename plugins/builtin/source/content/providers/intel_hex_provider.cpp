@@ -4,10 +4,16 @@
 
 #include <hex/api/imhex_api.hpp>
 #include <hex/api/localization.hpp>
+#include <hex/api/task.hpp>
 #include <hex/helpers/utils.hpp>
 #include <hex/helpers/file.hpp>
 #include <hex/helpers/fmt.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <string_view>
+#include <thread>
+
 #include <nlohmann/json.hpp>
 
 namespace hex::plugin::builtin::prv {
@@ -25,15 +31,24 @@ namespace hex::plugin::builtin::prv {
                 throw std::runtime_error("Failed to parse hex digit");
         }
 
-        std::map<u64, std::vector<u8>> parseIntelHex(const std::string &string) {
+        /**
+         * @brief Base addresses that are in effect when a parser starts on a chunk
+         *
+         * Extended segment/linear address records modify all following data records, so chunks
+         * handed to parallel workers carry the address state established by earlier records.
+         */
+        struct ParserState {
+            u32 segmentAddress        = 0x0000'0000;
+            u32 extendedLinearAddress = 0x0000'0000;
+        };
+
+        static std::map<u64, std::vector<u8>> parseIntelHexChunk(std::string_view string, ParserState state, Task *task) {
             std::map<u64, std::vector<u8>> result;
 
             u8 checksum = 0x00;
             u64 offset = 0x00;
 
             u8 byteCount = 0x00;
-            u32 segmentAddress = 0x0000'0000;
-            u32 extendedLinearAddress = 0x0000'0000;
             u16 address = 0x0000;
             std::vector<u8> data;
 
@@ -47,7 +62,7 @@ namespace hex::plugin::builtin::prv {
             } recordType;
 
             auto c = [&]() {
-                while (std::isspace(string[offset]) && offset < string.length())
+                while (offset < string.length() && std::isspace(string[offset]))
                     offset++;
 
                 if (offset >= string.length())
@@ -71,81 +86,207 @@ namespace hex::plugin::builtin::prv {
             };
 
             bool endOfFile = false;
-            try {
-                while (offset < string.length()) {
-                    // Parse start code
-                    if (c() != ':')
-                        return { };
+            while (true) {
+                while (offset < string.length() && std::isspace(string[offset]))
+                    offset++;
+                if (offset >= string.length())
+                    break;
+
+                if (endOfFile)
+                    throw std::runtime_error("Unexpected end of file");
 
-                    checksum = 0x00;
+                // Parse start code
+                if (c() != ':')
+                    throw std::runtime_error("Invalid start code");
 
-                    if (endOfFile)
-                        throw std::runtime_error("Unexpected end of file");
+                checksum = 0x00;
 
-                    // Parse byte count
-                    byteCount = parseValue(1);
+                // Parse byte count
+                byteCount = parseValue(1);
 
-                    // Parse address
-                    address = parseValue(2);
+                // Parse address
+                address = parseValue(2);
 
-                    // Parse record type
-                    recordType = static_cast<RecordType>(parseValue(1));
+                // Parse record type
+                recordType = static_cast<RecordType>(parseValue(1));
 
-                    data.clear();
-                    for (u32 i = 0; i < byteCount; i++) {
-                        data.push_back(parseValue(1));
+                data.clear();
+                for (u32 i = 0; i < byteCount; i++) {
+                    data.push_back(parseValue(1));
+                }
+
+                parseValue(1);
+                if (!data.empty() && checksum != 0x00)
+                    throw std::runtime_error("Checksum mismatch");
+
+                if (task != nullptr)
+                    task->update(offset);
+
+                // Construct region
+                switch (recordType) {
+                    case RecordType::Data: {
+                        result[state.extendedLinearAddress | (state.segmentAddress + address)] = data;
+                        break;
+                    }
+                    case RecordType::EndOfFile: {
+                        endOfFile = true;
+                        break;
                     }
+                    case RecordType::ExtendedSegmentAddress: {
+                        if (byteCount != 2)
+                            throw std::runtime_error("Unexpected byte count");
 
-                    parseValue(1);
-                    if (!data.empty() && checksum != 0x00)
-                        throw std::runtime_error("Checksum mismatch");
+                        state.segmentAddress = (data[0] << 8 | data[1]) * 16;
+                        break;
+                    }
+                    case RecordType::StartSegmentAddress: {
+                        if (byteCount != 4)
+                            throw std::runtime_error("Unexpected byte count");
 
-                    while (std::isspace(string[offset]) && offset < string.length())
-                        offset++;
+                        // Can be safely ignored
+                        break;
+                    }
+                    case RecordType::ExtendedLinearAddress: {
+                        if (byteCount != 2)
+                            throw std::runtime_error("Unexpected byte count");
 
-                    // Construct region
-                    switch (recordType) {
-                        case RecordType::Data: {
-                            result[extendedLinearAddress | (segmentAddress + address)] = data;
-                            break;
-                        }
-                        case RecordType::EndOfFile: {
-                            endOfFile = true;
-                            break;
-                        }
-                        case RecordType::ExtendedSegmentAddress: {
-                            if (byteCount != 2)
-                                throw std::runtime_error("Unexpected byte count");
+                        state.extendedLinearAddress = (data[0] << 8 | data[1]) << 16;
+                        break;
+                    }
+                    case RecordType::StartLinearAddress: {
+                        if (byteCount != 4)
+                            throw std::runtime_error("Unexpected byte count");
 
-                            segmentAddress = (data[0] << 8 | data[1]) * 16;
-                            break;
-                        }
-                        case RecordType::StartSegmentAddress: {
-                            if (byteCount != 4)
-                                throw std::runtime_error("Unexpected byte count");
+                        // Can be safely ignored
+                        break;
+                    }
+                }
+            }
 
-                            // Can be safely ignored
-                            break;
+            return result;
+        }
+
+        std::map<u64, std::vector<u8>> parseIntelHex(const std::string &string) {
+            // Chunks below this size aren't worth the scheduling overhead of a worker task
+            constexpr static size_t ChunkSize = 0x40'0000;
+
+            struct Chunk {
+                size_t begin, end;
+                ParserState state;
+            };
+
+            // Split the file into line-aligned chunks that can be parsed independently.
+            // Extended address records change the state of all following data records, so a chunk
+            // boundary is forced before each of them and the running state is tracked here so every
+            // chunk knows the base addresses it starts out with. Only the record type and the payload
+            // of extended address records are inspected in this pass, everything else is validated
+            // by the chunk parsers.
+            std::vector<Chunk> chunks;
+            {
+                ParserState runningState, chunkState;
+                size_t chunkStart = 0x00;
+                size_t lineStart  = 0x00;
+
+                try {
+                    while (lineStart < string.length()) {
+                        auto lineEnd = string.find('\n', lineStart);
+                        if (lineEnd == std::string::npos)
+                            lineEnd = string.length();
+
+                        auto colon = string.find_first_not_of(" \t\r", lineStart);
+                        if (colon == std::string::npos || colon >= lineEnd) {
+                            lineStart = lineEnd + 1;
+                            continue;
                         }
-                        case RecordType::ExtendedLinearAddress: {
-                            if (byteCount != 2)
-                                throw std::runtime_error("Unexpected byte count");
 
-                            extendedLinearAddress = (data[0] << 8 | data[1]) << 16;
-                            break;
+                        if (string[colon] == ':' && (colon + 8) < lineEnd) {
+                            u8 recordType = (parseHexDigit(string[colon + 7]) << 4) | parseHexDigit(string[colon + 8]);
+
+                            if ((recordType == 0x02 || recordType == 0x04) && (colon + 12) < lineEnd) {
+                                if (lineStart > chunkStart)
+                                    chunks.push_back({ chunkStart, lineStart, chunkState });
+
+                                chunkStart = lineStart;
+                                chunkState = runningState;
+
+                                u32 value = 0x00;
+                                for (u8 i = 0; i < 4; i++)
+                                    value = (value << 4) | parseHexDigit(string[colon + 9 + i]);
+
+                                if (recordType == 0x02)
+                                    runningState.segmentAddress = value * 16;
+                                else
+                                    runningState.extendedLinearAddress = value << 16;
+                            }
                         }
-                        case RecordType::StartLinearAddress: {
-                            if (byteCount != 4)
-                                throw std::runtime_error("Unexpected byte count");
 
-                            // Can be safely ignored
-                            break;
+                        lineStart = lineEnd + 1;
+
+                        if ((lineStart - chunkStart) >= ChunkSize) {
+                            chunks.push_back({ chunkStart, lineStart, chunkState });
+                            chunkStart = lineStart;
+                            chunkState = runningState;
                         }
                     }
+                } catch (const std::runtime_error &) {
+                    return { };
                 }
 
-            } catch (const std::runtime_error &e) {
+                if (chunkStart < string.length())
+                    chunks.push_back({ chunkStart, string.length(), chunkState });
+            }
+
+            if (chunks.empty())
+                return { };
+
+            // Small files aren't worth parallelizing
+            if (chunks.size() == 1) {
+                try {
+                    return parseIntelHexChunk(std::string_view(string).substr(chunks.front().begin, chunks.front().end - chunks.front().begin), chunks.front().state, nullptr);
+                } catch (const std::runtime_error &) {
+                    return { };
+                }
+            }
+
+            // Parse all chunks in parallel on scoped workers joined on the way out. The
+            // shared TaskManager pool can't be borrowed here: open() runs synchronously,
+            // so waiting on its workers would stall the UI behind unrelated long tasks
+            std::vector<std::map<u64, std::vector<u8>>> chunkResults(chunks.size());
+            std::atomic<size_t> nextChunk = 0;
+            std::atomic<bool> success     = true;
+
+            const auto threadCount = std::min<size_t>(chunks.size(), std::max<u32>(1, std::thread::hardware_concurrency()));
+
+            {
+                std::vector<std::jthread> workers;
+                for (size_t workerIndex = 0; workerIndex < threadCount; workerIndex++) {
+                    workers.emplace_back([&] {
+                        while (true) {
+                            const size_t index = nextChunk.fetch_add(1);
+                            if (index >= chunks.size())
+                                break;
+
+                            const auto &chunk = chunks[index];
+
+                            try {
+                                chunkResults[index] = parseIntelHexChunk(std::string_view(string).substr(chunk.begin, chunk.end - chunk.begin), chunk.state, nullptr);
+                            } catch (const std::runtime_error &) {
+                                success = false;
+                            }
+                        }
+                    });
+                }
+            }
+
+            if (!success)
                 return { };
+
+            // Merge the per-chunk results in file order so later records overwrite earlier ones,
+            // exactly like the sequential parser did
+            std::map<u64, std::vector<u8>> result;
+            for (auto &chunkResult : chunkResults) {
+                for (auto &[address, data] : chunkResult)
+                    result[address] = std::move(data);
             }
 
             return result;
@@ -178,10 +319,15 @@ namespace hex::plugin::builtin::prv {
                 bytes[i - offset] =  interval.value[i - interval.start];
             }
         }
+
+        for (auto iter = this->m_modifiedBytes.lower_bound(offset); iter != this->m_modifiedBytes.end() && iter->first < (offset + size); ++iter)
+            bytes[iter->first - offset] = iter->second;
     }
 
     void IntelHexProvider::writeRaw(u64 offset, const void *buffer, size_t size) {
-        hex::unused(offset, buffer, size);
+        auto bytes = reinterpret_cast<const u8*>(buffer);
+        for (size_t i = 0; i < size; i++)
+            this->m_modifiedBytes[offset + i] = bytes[i];
     }
 
     size_t IntelHexProvider::getActualSize() const {
@@ -217,6 +363,93 @@ namespace hex::plugin::builtin::prv {
 
     }
 
+    void IntelHexProvider::saveAs(const std::fs::path &path) {
+        constexpr static size_t RecordLength    = 0x20;
+        constexpr static size_t ReadChunkSize   = 0x10'0000;
+        constexpr static size_t WriteBufferSize = 0x10'0000;
+        constexpr static char HexChars[]        = "0123456789ABCDEF";
+
+        auto file = fs::File(path, fs::File::Mode::Create);
+        if (!file.isValid())
+            return;
+
+        // Collect the populated regions in address order, only they end up in the output
+        std::vector<std::pair<u64, u64>> regions;
+        this->m_data.visit_all([&regions](const auto &interval) {
+            regions.emplace_back(interval.start, interval.stop);
+        });
+        std::sort(regions.begin(), regions.end());
+
+        // Records are formatted into a preallocated buffer that is flushed to disk in large
+        // blocks, so the export never materializes the whole file in memory
+        std::string buffer;
+        buffer.reserve(WriteBufferSize + 0x100);
+
+        auto flush = [&]() {
+            file.write(reinterpret_cast<const u8 *>(buffer.data()), buffer.size());
+            buffer.clear();
+        };
+
+        auto emitRecord = [&](u8 recordType, u16 address, const u8 *data, size_t size) {
+            u8 checksum = 0x00;
+
+            auto appendByte = [&](u8 byte) {
+                buffer += HexChars[byte >> 4];
+                buffer += HexChars[byte & 0x0F];
+                checksum += byte;
+            };
+
+            buffer += ':';
+            appendByte(size);
+            appendByte(address >> 8);
+            appendByte(address & 0xFF);
+            appendByte(recordType);
+            for (size_t i = 0; i < size; i++)
+                appendByte(data[i]);
+            appendByte(0x100 - checksum);
+            buffer += '\n';
+
+            if (buffer.size() >= WriteBufferSize)
+                flush();
+        };
+
+        std::optional<u32> currentUpperAddress;
+        std::vector<u8> chunk(ReadChunkSize);
+
+        for (const auto &[start, stop] : regions) {
+            const u64 regionSize = (stop - start) + 1;
+
+            for (u64 chunkOffset = 0; chunkOffset < regionSize; chunkOffset += ReadChunkSize) {
+                const auto chunkSize = std::min<u64>(ReadChunkSize, regionSize - chunkOffset);
+                this->read(start + chunkOffset + this->getBaseAddress(), chunk.data(), chunkSize);
+
+                u64 recordOffset = 0;
+                while (recordOffset < chunkSize) {
+                    const u64 recordAddress = start + chunkOffset + recordOffset;
+
+                    // Emit a new extended linear address record whenever the upper 16 address bits change
+                    const u32 upperAddress = u32(recordAddress) >> 16;
+                    if (currentUpperAddress != upperAddress) {
+                        const u8 upperBytes[] = { u8(upperAddress >> 8), u8(upperAddress & 0xFF) };
+                        emitRecord(0x04, 0x0000, upperBytes, sizeof(upperBytes));
+                        currentUpperAddress = upperAddress;
+                    }
+
+                    // Data records may neither span chunks nor cross a 64 KiB address boundary
+                    const auto recordSize = std::min<u64>({ RecordLength, chunkSize - recordOffset, 0x1'0000 - (recordAddress & 0xFFFF) });
+                    emitRecord(0x00, recordAddress & 0xFFFF, chunk.data() + recordOffset, recordSize);
+
+                    recordOffset += recordSize;
+                }
+            }
+        }
+
+        // End-of-file record
+        emitRecord(0x01, 0x0000, nullptr, 0);
+
+        flush();
+    }
+
     [[nodiscard]] std::string IntelHexProvider::getName() const {
         return hex::format("hex.builtin.provider.intel_hex.name"_lang, hex::toUTF8String(this->m_sourceFilePath.filename()));
     }
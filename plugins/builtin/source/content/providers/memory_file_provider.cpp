@@ -1,6 +1,7 @@
 #include "content/providers/memory_file_provider.hpp"
 #include "content/providers/file_provider.hpp"
 
+#include <algorithm>
 #include <cstring>
 
 #include <hex/api/imhex_api.hpp>
@@ -11,23 +12,97 @@
 namespace hex::plugin::builtin::prv {
 
     bool MemoryFileProvider::open() {
-        this->m_data.resize(1);
+        this->resize(1);
         this->markDirty();
         return true;
     }
 
+    size_t MemoryFileProvider::getBlockIndex(u64 offset) const {
+        const auto iter = std::upper_bound(this->m_blockOffsets.begin(), this->m_blockOffsets.end(), offset);
+
+        return std::distance(this->m_blockOffsets.begin(), std::prev(iter));
+    }
+
+    void MemoryFileProvider::rebuildBlockOffsets() {
+        this->m_blockOffsets.resize(this->m_blocks.size());
+
+        u64 offset = 0;
+        for (size_t index = 0; index < this->m_blocks.size(); index++) {
+            this->m_blockOffsets[index] = offset;
+            offset += this->m_blocks[index].size();
+        }
+
+        this->m_size = offset;
+    }
+
+    size_t MemoryFileProvider::splitBlockAt(u64 offset) {
+        if (offset >= this->m_size)
+            return this->m_blocks.size();
+
+        const auto index       = this->getBlockIndex(offset);
+        const auto blockOffset = offset - this->m_blockOffsets[index];
+
+        if (blockOffset == 0)
+            return index;
+
+        auto &block = this->m_blocks[index];
+        std::vector<u8> right(block.begin() + blockOffset, block.end());
+        block.resize(blockOffset);
+
+        this->m_blocks.insert(this->m_blocks.begin() + index + 1, std::move(right));
+        this->rebuildBlockOffsets();
+
+        return index + 1;
+    }
+
     void MemoryFileProvider::readRaw(u64 offset, void *buffer, size_t size) {
         if ((offset + size) > this->getActualSize() || buffer == nullptr || size == 0)
             return;
 
-        std::memcpy(buffer, &this->m_data.front() + offset, size);
+        auto bytes = static_cast<u8 *>(buffer);
+        for (auto index = this->getBlockIndex(offset); size > 0 && index < this->m_blocks.size(); index++) {
+            const auto &block      = this->m_blocks[index];
+            const auto blockOffset = offset - this->m_blockOffsets[index];
+            const auto copySize    = std::min<size_t>(size, block.size() - blockOffset);
+
+            std::memcpy(bytes, block.data() + blockOffset, copySize);
+
+            bytes  += copySize;
+            offset += copySize;
+            size   -= copySize;
+        }
     }
 
     void MemoryFileProvider::writeRaw(u64 offset, const void *buffer, size_t size) {
         if ((offset + size) > this->getActualSize() || buffer == nullptr || size == 0)
             return;
 
-        std::memcpy(&this->m_data.front() + offset, buffer, size);
+        auto bytes = static_cast<const u8 *>(buffer);
+        for (auto index = this->getBlockIndex(offset); size > 0 && index < this->m_blocks.size(); index++) {
+            auto &block            = this->m_blocks[index];
+            const auto blockOffset = offset - this->m_blockOffsets[index];
+            const auto copySize    = std::min<size_t>(size, block.size() - blockOffset);
+
+            std::memcpy(block.data() + blockOffset, bytes, copySize);
+
+            bytes  += copySize;
+            offset += copySize;
+            size   -= copySize;
+        }
+    }
+
+    std::optional<std::span<const u8>> MemoryFileProvider::readRawBorrowed(u64 offset, size_t size) const {
+        if ((offset + size) > this->getActualSize() || size == 0)
+            return std::nullopt;
+
+        // Borrowed views need to be contiguous, so only ranges within a single block can be served
+        const auto index       = this->getBlockIndex(offset);
+        const auto blockOffset = offset - this->m_blockOffsets[index];
+
+        if ((blockOffset + size) > this->m_blocks[index].size())
+            return std::nullopt;
+
+        return std::span(this->m_blocks[index].data() + blockOffset, size);
     }
 
     void MemoryFileProvider::save() {
@@ -69,53 +144,74 @@ namespace hex::plugin::builtin::prv {
     }
 
     void MemoryFileProvider::resize(size_t newSize) {
-        this->m_data.resize(newSize);
+        while (this->m_size < newSize) {
+            const auto deficit = newSize - this->m_size;
+
+            if (!this->m_blocks.empty() && this->m_blocks.back().size() < BlockSize) {
+                auto &block = this->m_blocks.back();
+                const auto growth = std::min<size_t>(deficit, BlockSize - block.size());
+
+                block.resize(block.size() + growth, 0x00);
+                this->m_size += growth;
+            } else {
+                this->m_blocks.emplace_back(std::min<size_t>(deficit, BlockSize), 0x00);
+                this->m_size += this->m_blocks.back().size();
+            }
+        }
+
+        while (this->m_size > newSize) {
+            const auto excess = this->m_size - newSize;
+            auto &block = this->m_blocks.back();
+
+            if (block.size() <= excess) {
+                this->m_size -= block.size();
+                this->m_blocks.pop_back();
+            } else {
+                block.resize(block.size() - excess);
+                this->m_size -= excess;
+            }
+        }
+
+        this->rebuildBlockOffsets();
 
         Provider::resize(newSize);
     }
 
     void MemoryFileProvider::insert(u64 offset, size_t size) {
-        auto oldSize = this->getActualSize();
-        this->resize(oldSize + size);
-
-        std::vector<u8> buffer(0x1000);
-        const std::vector<u8> zeroBuffer(0x1000);
+        if (offset >= this->m_size) {
+            this->resize(this->m_size + size);
+            Provider::insert(offset, size);
+            return;
+        }
 
-        auto position = oldSize;
-        while (position > offset) {
-            const auto readSize = std::min<size_t>(position - offset, buffer.size());
+        auto index = this->splitBlockAt(offset);
 
-            position -= readSize;
+        for (size_t inserted = 0; inserted < size; index++) {
+            const auto blockSize = std::min<size_t>(size - inserted, BlockSize);
 
-            this->readRaw(position, buffer.data(), readSize);
-            this->writeRaw(position, zeroBuffer.data(), readSize);
-            this->writeRaw(position + size, buffer.data(), readSize);
+            this->m_blocks.insert(this->m_blocks.begin() + index, std::vector<u8>(blockSize, 0x00));
+            inserted += blockSize;
         }
 
+        this->rebuildBlockOffsets();
+
         Provider::insert(offset, size);
+        this->markDirty();
     }
 
     void MemoryFileProvider::remove(u64 offset, size_t size) {
-        auto oldSize = this->getActualSize();
-        this->resize(oldSize + size);
-
-        std::vector<u8> buffer(0x1000);
-
-        const auto newSize = oldSize - size;
-        auto position = offset;
-        while (position < newSize) {
-            const auto readSize = std::min<size_t>(newSize - position, buffer.size());
-
-            this->readRaw(position + size, buffer.data(), readSize);
-            this->writeRaw(position, buffer.data(), readSize);
+        if (offset >= this->m_size || size == 0)
+            return;
+        size = std::min<size_t>(size, this->m_size - offset);
 
-            position += readSize;
-        }
+        const auto beginIndex = this->splitBlockAt(offset);
+        const auto endIndex   = this->splitBlockAt(offset + size);
 
-        this->resize(newSize);
+        this->m_blocks.erase(this->m_blocks.begin() + beginIndex, this->m_blocks.begin() + endIndex);
+        this->rebuildBlockOffsets();
 
-        Provider::insert(offset, size);
         Provider::remove(offset, size);
+        this->markDirty();
     }
 
     std::pair<Region, bool> MemoryFileProvider::getRegionValidity(u64 address) const {
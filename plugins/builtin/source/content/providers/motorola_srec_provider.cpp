@@ -2,10 +2,16 @@
 
 
 #include <hex/api/localization.hpp>
+#include <hex/api/task.hpp>
 #include <hex/helpers/utils.hpp>
 #include <hex/helpers/file.hpp>
 #include <hex/helpers/fmt.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <string_view>
+#include <thread>
+
 namespace hex::plugin::builtin::prv {
 
     namespace motorola_srec {
@@ -21,7 +27,7 @@ namespace hex::plugin::builtin::prv {
                 throw std::runtime_error("Failed to parse hex digit");
         }
 
-        std::map<u64, std::vector<u8>> parseMotorolaSREC(const std::string &string) {
+        static std::map<u64, std::vector<u8>> parseMotorolaSRECChunk(std::string_view string, Task *task) {
             std::map<u64, std::vector<u8>> result;
 
             u64 offset = 0x00;
@@ -31,7 +37,7 @@ namespace hex::plugin::builtin::prv {
             std::vector<u8> data;
 
             auto c = [&]() {
-                while (std::isspace(string[offset]) && offset < string.length())
+                while (offset < string.length() && std::isspace(string[offset]))
                     offset++;
 
                 if (offset >= string.length())
@@ -67,96 +73,181 @@ namespace hex::plugin::builtin::prv {
             } recordType;
 
             bool endOfFile = false;
-            try {
-                while (offset < string.length()) {
-                    // Parse record start
-                    if (c() != 'S')
-                        return { };
-
-                    if (endOfFile)
-                        throw std::runtime_error("Unexpected end of file");
-
-                    // Parse record type
-                    {
-                        char typeCharacter = c();
-                        if (typeCharacter < '0' || typeCharacter > '9')
-                            throw std::runtime_error("Invalid record type");
-                        recordType = static_cast<RecordType>(typeCharacter - '0');
-                    }
+            while (true) {
+                while (offset < string.length() && std::isspace(string[offset]))
+                    offset++;
+                if (offset >= string.length())
+                    break;
 
-                    checksum = 0x00;
-
-                    // Parse byte count
-                    byteCount = parseValue(1);
-
-                    // Parse address
-                    switch (recordType) {
-                        case RecordType::Reserved:
-                            break;
-                        case RecordType::Header:
-                        case RecordType::Data16:
-                        case RecordType::Count16:
-                        case RecordType::StartAddress16:
-                            byteCount -= 2;
-                            address = parseValue(2);
-                            break;
-                        case RecordType::Data24:
-                        case RecordType::Count24:
-                        case RecordType::StartAddress24:
-                            byteCount -= 3;
-                            address = parseValue(3);
-                            break;
-                        case RecordType::Data32:
-                        case RecordType::StartAddress32:
-                            byteCount -= 4;
-                            address = parseValue(4);
-                            break;
-                    }
+                if (endOfFile)
+                    throw std::runtime_error("Unexpected end of file");
 
-                    byteCount -= 1;
+                // Parse record start
+                if (c() != 'S')
+                    throw std::runtime_error("Invalid record start");
 
-                    auto readData = [&byteCount, &parseValue]() {
-                        std::vector<u8> bytes;
-                        bytes.resize(byteCount);
-                        for (u8 i = 0; i < byteCount; i++) {
-                            bytes[i] = parseValue(1);
-                        }
+                // Parse record type
+                {
+                    char typeCharacter = c();
+                    if (typeCharacter < '0' || typeCharacter > '9')
+                        throw std::runtime_error("Invalid record type");
+                    recordType = static_cast<RecordType>(typeCharacter - '0');
+                }
 
-                        return bytes;
-                    };
+                checksum = 0x00;
+
+                // Parse byte count
+                byteCount = parseValue(1);
+
+                // Parse address
+                switch (recordType) {
+                    case RecordType::Reserved:
+                        break;
+                    case RecordType::Header:
+                    case RecordType::Data16:
+                    case RecordType::Count16:
+                    case RecordType::StartAddress16:
+                        byteCount -= 2;
+                        address = parseValue(2);
+                        break;
+                    case RecordType::Data24:
+                    case RecordType::Count24:
+                    case RecordType::StartAddress24:
+                        byteCount -= 3;
+                        address = parseValue(3);
+                        break;
+                    case RecordType::Data32:
+                    case RecordType::StartAddress32:
+                        byteCount -= 4;
+                        address = parseValue(4);
+                        break;
+                }
 
-                    // Parse data
-                    data = readData();
+                byteCount -= 1;
 
-                    // Parse checksum
-                    {
-                        auto value = parseValue(1);
-                        if (((checksum - value) ^ 0xFF) != value)
-                            throw std::runtime_error("Invalid checksum");
+                auto readData = [&byteCount, &parseValue]() {
+                    std::vector<u8> bytes;
+                    bytes.resize(byteCount);
+                    for (u8 i = 0; i < byteCount; i++) {
+                        bytes[i] = parseValue(1);
                     }
 
-                    // Construct region
-                    switch (recordType) {
-                        case RecordType::Data16:
-                        case RecordType::Data24:
-                        case RecordType::Data32:
-                            result[address] = data;
-                            break;
-                        case RecordType::Header:
-                        case RecordType::Reserved:
-                            break;
-                        case RecordType::Count16:
-                        case RecordType::Count24:
-                            break;
-                        case RecordType::StartAddress32:
-                        case RecordType::StartAddress24:
-                        case RecordType::StartAddress16:
-                            endOfFile = true;
-                            break;
+                    return bytes;
+                };
+
+                // Parse data
+                data = readData();
+
+                // Parse checksum
+                {
+                    auto value = parseValue(1);
+                    if (((checksum - value) ^ 0xFF) != value)
+                        throw std::runtime_error("Invalid checksum");
+                }
+
+                if (task != nullptr)
+                    task->update(offset);
+
+                // Construct region
+                switch (recordType) {
+                    case RecordType::Data16:
+                    case RecordType::Data24:
+                    case RecordType::Data32:
+                        result[address] = data;
+                        break;
+                    case RecordType::Header:
+                    case RecordType::Reserved:
+                        break;
+                    case RecordType::Count16:
+                    case RecordType::Count24:
+                        break;
+                    case RecordType::StartAddress32:
+                    case RecordType::StartAddress24:
+                    case RecordType::StartAddress16:
+                        endOfFile = true;
+                        break;
+                }
+            }
+
+            return result;
+        }
+
+        std::map<u64, std::vector<u8>> parseMotorolaSREC(const std::string &string) {
+            // Chunks below this size aren't worth the scheduling overhead of a worker task
+            constexpr static size_t ChunkSize = 0x40'0000;
+
+            // Every SREC record carries its full address, so the file can simply be cut into
+            // line-aligned chunks that are parsed completely independently of each other
+            std::vector<std::pair<size_t, size_t>> chunks;
+            {
+                size_t chunkStart = 0x00;
+
+                while (chunkStart < string.length()) {
+                    auto chunkEnd = chunkStart + ChunkSize;
+                    if (chunkEnd >= string.length()) {
+                        chunkEnd = string.length();
+                    } else {
+                        chunkEnd = string.find('\n', chunkEnd);
+                        if (chunkEnd == std::string::npos)
+                            chunkEnd = string.length();
+                        else
+                            chunkEnd += 1;
                     }
+
+                    chunks.emplace_back(chunkStart, chunkEnd);
+                    chunkStart = chunkEnd;
                 }
-            } catch (const std::runtime_error &e) {
+            }
+
+            if (chunks.empty())
                 return { };
+
+            // Small files aren't worth parallelizing
+            if (chunks.size() == 1) {
+                try {
+                    return parseMotorolaSRECChunk(std::string_view(string).substr(chunks.front().first, chunks.front().second - chunks.front().first), nullptr);
+                } catch (const std::runtime_error &) {
+                    return { };
+                }
+            }
+
+            // Parse all chunks in parallel on scoped workers joined on the way out. The
+            // shared TaskManager pool can't be borrowed here: open() runs synchronously,
+            // so waiting on its workers would stall the UI behind unrelated long tasks
+            std::vector<std::map<u64, std::vector<u8>>> chunkResults(chunks.size());
+            std::atomic<size_t> nextChunk = 0;
+            std::atomic<bool> success     = true;
+
+            const auto threadCount = std::min<size_t>(chunks.size(), std::max<u32>(1, std::thread::hardware_concurrency()));
+
+            {
+                std::vector<std::jthread> workers;
+                for (size_t workerIndex = 0; workerIndex < threadCount; workerIndex++) {
+                    workers.emplace_back([&] {
+                        while (true) {
+                            const size_t index = nextChunk.fetch_add(1);
+                            if (index >= chunks.size())
+                                break;
+
+                            try {
+                                chunkResults[index] = parseMotorolaSRECChunk(std::string_view(string).substr(chunks[index].first, chunks[index].second - chunks[index].first), nullptr);
+                            } catch (const std::runtime_error &) {
+                                success = false;
+                            }
+                        }
+                    });
+                }
+            }
+
+            if (!success)
+                return { };
+
+            // Merge the per-chunk results in file order so later records overwrite earlier ones,
+            // exactly like the sequential parser did
+            std::map<u64, std::vector<u8>> result;
+            for (auto &chunkResult : chunkResults) {
+                for (auto &[address, data] : chunkResult)
+                    result[address] = std::move(data);
             }
 
             return result;
@@ -193,6 +284,85 @@ namespace hex::plugin::builtin::prv {
 
     }
 
+    void MotorolaSRECProvider::saveAs(const std::fs::path &path) {
+        constexpr static size_t RecordLength    = 0x20;
+        constexpr static size_t ReadChunkSize   = 0x10'0000;
+        constexpr static size_t WriteBufferSize = 0x10'0000;
+        constexpr static char HexChars[]        = "0123456789ABCDEF";
+
+        auto file = fs::File(path, fs::File::Mode::Create);
+        if (!file.isValid())
+            return;
+
+        // Collect the populated regions in address order, only they end up in the output
+        std::vector<std::pair<u64, u64>> regions;
+        this->m_data.visit_all([&regions](const auto &interval) {
+            regions.emplace_back(interval.start, interval.stop);
+        });
+        std::sort(regions.begin(), regions.end());
+
+        // Records are formatted into a preallocated buffer that is flushed to disk in large
+        // blocks, so the export never materializes the whole file in memory
+        std::string buffer;
+        buffer.reserve(WriteBufferSize + 0x100);
+
+        auto flush = [&]() {
+            file.write(reinterpret_cast<const u8 *>(buffer.data()), buffer.size());
+            buffer.clear();
+        };
+
+        auto emitRecord = [&](char recordType, u32 address, u8 addressBytes, const u8 *data, size_t size) {
+            u8 checksum = 0x00;
+
+            auto appendByte = [&](u8 byte) {
+                buffer += HexChars[byte >> 4];
+                buffer += HexChars[byte & 0x0F];
+                checksum += byte;
+            };
+
+            buffer += 'S';
+            buffer += recordType;
+            appendByte(addressBytes + size + 1);
+            for (u8 i = addressBytes; i > 0; i--)
+                appendByte((address >> ((i - 1) * 8)) & 0xFF);
+            for (size_t i = 0; i < size; i++)
+                appendByte(data[i]);
+            appendByte(~checksum);
+            buffer += '\n';
+
+            if (buffer.size() >= WriteBufferSize)
+                flush();
+        };
+
+        // Header record
+        emitRecord('0', 0x0000, 2, nullptr, 0);
+
+        std::vector<u8> chunk(ReadChunkSize);
+        for (const auto &[start, stop] : regions) {
+            const u64 regionSize = (stop - start) + 1;
+
+            for (u64 chunkOffset = 0; chunkOffset < regionSize; chunkOffset += ReadChunkSize) {
+                const auto chunkSize = std::min<u64>(ReadChunkSize, regionSize - chunkOffset);
+                this->read(start + chunkOffset + this->getBaseAddress(), chunk.data(), chunkSize);
+
+                // Every record carries its full 32 bit address, so regions simply split
+                // into fixed-length S3 records
+                u64 recordOffset = 0;
+                while (recordOffset < chunkSize) {
+                    const auto recordSize = std::min<u64>(RecordLength, chunkSize - recordOffset);
+                    emitRecord('3', start + chunkOffset + recordOffset, 4, chunk.data() + recordOffset, recordSize);
+
+                    recordOffset += recordSize;
+                }
+            }
+        }
+
+        // Start address record terminating the file
+        emitRecord('7', 0x0000'0000, 4, nullptr, 0);
+
+        flush();
+    }
+
     [[nodiscard]] std::string MotorolaSRECProvider::getName() const {
         return hex::format("hex.builtin.provider.motorola_srec.name"_lang, hex::toUTF8String(this->m_sourceFilePath.filename()));
     }
@@ -79,6 +79,54 @@ namespace hex::plugin::builtin {
             return false;
         });
 
+        ContentRegistry::Settings::add("hex.builtin.setting.general", "hex.builtin.setting.general.cache_budget", 0, [](auto name, nlohmann::json &setting) {
+            static int budget = static_cast<int>(setting);
+
+            auto format = budget <= 0 ? "hex.builtin.setting.general.cache_budget.unlimited"_lang : "%d MiB";
+
+            if (ImGui::SliderInt(name.data(), &budget, 0, 4096, format, ImGuiSliderFlags_AlwaysClamp)) {
+                setting = budget;
+                return true;
+            }
+
+            return false;
+        });
+
+        ContentRegistry::Settings::add("hex.builtin.setting.general", "hex.builtin.setting.general.undo_budget", 256, [](auto name, nlohmann::json &setting) {
+            static int budget = static_cast<int>(setting);
+
+            auto format = budget <= 0 ? "hex.builtin.setting.general.undo_budget.unlimited"_lang : "%d MiB";
+
+            if (ImGui::SliderInt(name.data(), &budget, 0, 4096, format, ImGuiSliderFlags_AlwaysClamp)) {
+                setting = budget;
+                return true;
+            }
+
+            return false;
+        });
+
+        ContentRegistry::Settings::add("hex.builtin.setting.general", "hex.builtin.setting.general.concurrent_downloads", 4, [](auto name, nlohmann::json &setting) {
+            static int downloadCount = static_cast<int>(setting);
+
+            if (ImGui::SliderInt(name.data(), &downloadCount, 1, 8, "%d", ImGuiSliderFlags_AlwaysClamp)) {
+                setting = downloadCount;
+                return true;
+            }
+
+            return false;
+        });
+
+        ContentRegistry::Settings::add("hex.builtin.setting.general", "hex.builtin.setting.general.pattern_console_lines", 0x1'0000, [](auto name, nlohmann::json &setting) {
+            static int lineCount = static_cast<int>(setting);
+
+            if (ImGui::SliderInt(name.data(), &lineCount, 0x400, 0x10'0000, "%d", ImGuiSliderFlags_AlwaysClamp | ImGuiSliderFlags_Logarithmic)) {
+                setting = lineCount;
+                return true;
+            }
+
+            return false;
+        });
+
         /* Interface */
 
         ContentRegistry::Settings::add("hex.builtin.setting.interface", "hex.builtin.setting.interface.color", 0, [](auto name, nlohmann::json &setting) {
@@ -308,6 +356,17 @@ namespace hex::plugin::builtin {
             return result;
         });
 
+        ContentRegistry::Settings::add("hex.builtin.setting.hex_editor", "hex.builtin.setting.hex_editor.minimap", 1, [](auto name, nlohmann::json &setting) {
+            static bool miniMap = static_cast<int>(setting);
+
+            if (ImGui::Checkbox(name.data(), &miniMap)) {
+                setting = static_cast<int>(miniMap);
+                return true;
+            }
+
+            return false;
+        });
+
         ContentRegistry::Settings::add("hex.builtin.setting.hex_editor", "hex.builtin.setting.hex_editor.sync_scrolling", 0, [](auto name, nlohmann::json &setting) {
             static bool syncScrolling = static_cast<int>(setting);
 
@@ -319,6 +378,17 @@ namespace hex::plugin::builtin {
             return false;
         });
 
+        ContentRegistry::Settings::add("hex.builtin.setting.hex_editor", "hex.builtin.setting.hex_editor.fast_render", 0, [](auto name, nlohmann::json &setting) {
+            static bool fastRender = static_cast<int>(setting);
+
+            if (ImGui::Checkbox(name.data(), &fastRender)) {
+                setting = static_cast<int>(fastRender);
+                return true;
+            }
+
+            return false;
+        });
+
         ContentRegistry::Settings::add("hex.builtin.setting.hex_editor", "hex.builtin.setting.hex_editor.byte_padding", 0, [](auto name, nlohmann::json &setting) {
             static int padding = static_cast<int>(setting);
 
@@ -11,9 +11,14 @@
 
 #include <hex/ui/view.hpp>
 #include <hex/providers/provider.hpp>
+#include <hex/api/task.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <limits>
+#include <list>
+#include <mutex>
 #include <random>
 #include <regex>
 
@@ -27,6 +32,12 @@
 
 #include <nlohmann/json.hpp>
 
+#if defined(OS_LINUX)
+    #include <fcntl.h>
+    #include <sys/uio.h>
+    #include <unistd.h>
+#endif
+
 namespace hex::plugin::builtin {
 
     namespace {
@@ -35,22 +46,118 @@ namespace hex::plugin::builtin {
         using namespace std::literals::chrono_literals;
         using namespace hex::literals;
 
+        std::string demangleName(const std::string &mangledName) {
+            // Most recently used names stay at the front so repeated edits of the
+            // same symbol never pay for a second demangle
+            constexpr static size_t MaxCachedNames = 0x80;
+            static std::list<std::pair<std::string, std::string>> cache;
+            static std::mutex cacheMutex;
+
+            {
+                std::scoped_lock lock(cacheMutex);
+
+                auto cached = std::find_if(cache.begin(), cache.end(), [&](const auto &entry) { return entry.first == mangledName; });
+                if (cached != cache.end()) {
+                    cache.splice(cache.begin(), cache, cached);
+                    return cache.front().second;
+                }
+            }
+
+            auto demangledName = llvm::demangle(mangledName);
+            if (demangledName == mangledName)
+                demangledName = "???";
+
+            {
+                std::scoped_lock lock(cacheMutex);
+
+                cache.emplace_front(mangledName, demangledName);
+                if (cache.size() > MaxCachedNames)
+                    cache.pop_back();
+            }
+
+            return demangledName;
+        }
+
         void drawDemangler() {
+            constexpr static auto DebounceInterval = 150ms;
+
             static std::string mangledName, demangledName;
+            static std::chrono::steady_clock::time_point lastInputTime;
+            static bool demanglePending = false;
+            static std::atomic<bool> demangling = false;
 
             if (ImGui::InputTextWithHint("hex.builtin.tools.demangler.mangled"_lang, "Itanium, MSVC, Dlang & Rust", mangledName)) {
-                demangledName = llvm::demangle(mangledName);
+                lastInputTime   = std::chrono::steady_clock::now();
+                demanglePending = true;
+            }
 
-                if (demangledName == mangledName) {
-                    demangledName = "???";
-                }
+            // Demangling only starts once typing has paused, and runs on a background
+            // task so long Itanium names never stall the frame
+            if (demanglePending && !demangling && (std::chrono::steady_clock::now() - lastInputTime) > DebounceInterval) {
+                demanglePending = false;
+                demangling      = true;
+
+                TaskManager::createBackgroundTask("hex.builtin.common.processing", [input = mangledName](auto &) {
+                    auto result = demangleName(input);
+
+                    TaskManager::doLater([input = std::move(input), result = std::move(result)] {
+                        if (input == mangledName)
+                            demangledName = result;
+                        demangling = false;
+                    });
+                });
             }
 
             ImGui::Header("hex.builtin.tools.demangler.demangled"_lang);
             if (ImGui::BeginChild("demangled", ImVec2(0, 200_scaled), true)) {
-                ImGui::TextFormattedWrapped("{}", demangledName);
+                if (demangling || demanglePending)
+                    ImGui::TextSpinner("");
+                else
+                    ImGui::TextFormattedWrapped("{}", demangledName);
             }
             ImGui::EndChild();
+
+            // Bulk mode for pasted symbol dumps, demangled line by line in parallel
+            if (ImGui::CollapsingHeader("hex.builtin.tools.demangler.bulk"_lang)) {
+                static std::string bulkInput, bulkOutput;
+                static std::atomic<bool> bulkProcessing = false;
+
+                ImGui::InputTextMultiline("hex.builtin.tools.demangler.bulk.input"_lang, bulkInput, ImVec2(0, 150_scaled));
+
+                ImGui::BeginDisabled(bulkProcessing);
+                if (ImGui::Button("hex.builtin.tools.demangler.bulk.demangle"_lang)) {
+                    bulkProcessing = true;
+
+                    TaskManager::createBackgroundTask("hex.builtin.common.processing", [input = bulkInput](auto &task) {
+                        auto lines = hex::splitString(input, "\n");
+
+                        std::vector<std::string> demangledLines(lines.size());
+                        TaskManager::parallelFor(task, 0, lines.size(), 0x40, [&](u64 chunkBegin, u64 chunkEnd) {
+                            for (u64 i = chunkBegin; i < chunkEnd; i++) {
+                                auto line = lines[i];
+                                hex::trim(line);
+
+                                demangledLines[i] = line.empty() ? line : demangleName(line);
+                            }
+                        });
+
+                        std::string result = hex::combineStrings(demangledLines, "\n");
+
+                        TaskManager::doLater([result = std::move(result)] {
+                            bulkOutput     = result;
+                            bulkProcessing = false;
+                        });
+                    });
+                }
+                ImGui::EndDisabled();
+
+                if (bulkProcessing) {
+                    ImGui::SameLine();
+                    ImGui::TextSpinner("");
+                }
+
+                ImGui::InputTextMultiline("hex.builtin.tools.demangler.bulk.output"_lang, bulkOutput.data(), bulkOutput.size(), ImVec2(0, 150_scaled), ImGuiInputTextFlags_ReadOnly);
+            }
         }
 
         void drawASCIITable() {
@@ -119,6 +226,107 @@ namespace hex::plugin::builtin {
 
             ImGui::InputTextMultiline("hex.builtin.tools.regex_replacer.output"_lang, regexOutput.data(), regexOutput.size(), ImVec2(0, 0), ImGuiInputTextFlags_ReadOnly);
             ImGui::NewLine();
+
+            // File mode streams a chosen file through the patterns above chunk by
+            // chunk, so multi-GB logs never have to fit into the widgets
+            if (ImGui::CollapsingHeader("hex.builtin.tools.regex_replacer.file"_lang)) {
+                static std::u8string inputPath, outputPath;
+                static TaskHolder replacerTask;
+
+                ImGui::BeginDisabled(replacerTask.isRunning());
+                {
+                    ImGui::InputText("##regex_input_path", inputPath);
+                    ImGui::SameLine();
+                    if (ImGui::Button("...##regex_input")) {
+                        fs::openFileBrowser(fs::DialogMode::Open, {}, [](const auto &path) {
+                            inputPath = path.u8string();
+                        });
+                    }
+                    ImGui::SameLine();
+                    ImGui::TextUnformatted("hex.builtin.tools.regex_replacer.file.input"_lang);
+
+                    ImGui::InputText("##regex_output_path", outputPath);
+                    ImGui::SameLine();
+                    if (ImGui::Button("...##regex_output")) {
+                        fs::openFileBrowser(fs::DialogMode::Save, {}, [](const auto &path) {
+                            outputPath = path.u8string();
+                        });
+                    }
+                    ImGui::SameLine();
+                    ImGui::TextUnformatted("hex.builtin.tools.regex_replacer.file.output"_lang);
+                }
+                ImGui::EndDisabled();
+
+                ImGui::BeginDisabled(inputPath.empty() || outputPath.empty() || regexPattern.empty());
+                {
+                    if (replacerTask.isRunning())
+                        ImGui::TextSpinner("hex.builtin.tools.regex_replacer.file.replacing"_lang);
+                    else if (ImGui::Button("hex.builtin.tools.regex_replacer.file.replace"_lang)) {
+                        replacerTask = TaskManager::createTask("hex.builtin.tools.regex_replacer.file.replacing", 0,
+                            [pattern = std::string(regexPattern.data()), replace = std::string(replacePattern.data())](auto &task) {
+                                fs::File inputFile(inputPath, fs::File::Mode::Read);
+                                if (!inputFile.isValid()) {
+                                    View::showErrorPopup("hex.builtin.tools.regex_replacer.file.error.open"_lang);
+                                    return;
+                                }
+
+                                fs::File outputFile(outputPath, fs::File::Mode::Create);
+                                if (!outputFile.isValid()) {
+                                    View::showErrorPopup("hex.builtin.tools.regex_replacer.file.error.create"_lang);
+                                    return;
+                                }
+
+                                std::regex regex;
+                                try {
+                                    regex = std::regex(pattern);
+                                } catch (const std::regex_error &) {
+                                    View::showErrorPopup("hex.builtin.tools.regex_replacer.file.error.pattern"_lang);
+                                    return;
+                                }
+
+                                task.setMaxValue(inputFile.getSize());
+
+                                constexpr static size_t ChunkSize = 1_MiB;
+
+                                // Only complete lines get matched; the unterminated tail of each
+                                // chunk carries over so matches never get cut at a chunk boundary.
+                                // A file without any newlines is flushed in blocks once the carry
+                                // exceeds its cap, so memory stays bounded either way
+                                constexpr static size_t MaxCarrySize = 16_MiB;
+
+                                std::vector<u8> buffer(ChunkSize);
+                                std::string carry;
+                                u64 processed = 0;
+
+                                while (true) {
+                                    const auto bytesRead = inputFile.readBuffer(buffer.data(), buffer.size());
+                                    if (bytesRead == 0) {
+                                        if (!carry.empty())
+                                            outputFile.write(std::regex_replace(carry, regex, replace));
+                                        break;
+                                    }
+
+                                    carry.append(reinterpret_cast<const char *>(buffer.data()), bytesRead);
+
+                                    const auto lastNewline = carry.rfind('\n');
+                                    if (lastNewline != std::string::npos) {
+                                        outputFile.write(std::regex_replace(carry.substr(0, lastNewline + 1), regex, replace));
+                                        carry.erase(0, lastNewline + 1);
+                                    } else if (carry.size() > MaxCarrySize) {
+                                        outputFile.write(std::regex_replace(carry, regex, replace));
+                                        carry.clear();
+                                    }
+
+                                    processed += bytesRead;
+                                    task.update(processed);
+                                }
+
+                                View::showInfoPopup("hex.builtin.tools.regex_replacer.file.success"_lang);
+                            });
+                    }
+                }
+                ImGui::EndDisabled();
+            }
         }
 
         void drawColorPicker() {
@@ -445,33 +653,163 @@ namespace hex::plugin::builtin {
             }
         }
 
+        /* Limb based big integer helpers for the base converter. Only the
+           operations radix conversion needs are implemented */
+
+        // Largest power of the base that still fits a 64 bit limb, together
+        // with its digit count. Conversion moves this many digits per limb
+        // operation instead of one
+        struct DigitChunk {
+            u64 value;
+            u32 digits;
+        };
+
+        DigitChunk getDigitChunk(u8 base) {
+            static std::array<DigitChunk, 37> chunks = {};
+
+            auto &chunk = chunks[base];
+            if (chunk.digits == 0) {
+                u64 value  = base;
+                u32 digits = 1;
+                while (value <= std::numeric_limits<u64>::max() / base) {
+                    value *= base;
+                    digits++;
+                }
+
+                chunk = { value, digits };
+            }
+
+            return chunk;
+        }
+
+        void bigIntMulAdd(std::vector<u64> &limbs, u64 factor, u64 addend) {
+            u64 carry = addend;
+            for (auto &limb : limbs) {
+                u128 product = u128(limb) * factor + carry;
+                limb  = u64(product);
+                carry = u64(product >> 64);
+            }
+
+            if (carry != 0)
+                limbs.push_back(carry);
+        }
+
+        u64 bigIntDivMod(std::vector<u64> &limbs, u64 divisor) {
+            u64 remainder = 0;
+            for (auto it = limbs.rbegin(); it != limbs.rend(); ++it) {
+                u128 value = (u128(remainder) << 64) | *it;
+                *it       = u64(value / divisor);
+                remainder = u64(value % divisor);
+            }
+
+            while (!limbs.empty() && limbs.back() == 0)
+                limbs.pop_back();
+
+            return remainder;
+        }
+
+        std::optional<std::vector<u64>> parseBigInt(std::string_view string, u8 base) {
+            constexpr static std::string_view Alphabet = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+            // Skip the prefixes the converter prints back into the fields
+            if (base == 16 && (string.starts_with("0x") || string.starts_with("0X")))
+                string.remove_prefix(2);
+            else if (base == 8 && string.size() > 1 && string.starts_with('0'))
+                string.remove_prefix(1);
+
+            const auto chunk = getDigitChunk(base);
+
+            std::vector<u64> limbs;
+            u64 group       = 0;
+            u32 groupDigits = 0;
+            for (char c : string) {
+                const auto digit = Alphabet.find(char(std::tolower(c)));
+                if (digit == std::string_view::npos || digit >= base)
+                    return std::nullopt;
+
+                group = group * base + digit;
+                groupDigits++;
+
+                if (groupDigits == chunk.digits) {
+                    bigIntMulAdd(limbs, chunk.value, group);
+                    group       = 0;
+                    groupDigits = 0;
+                }
+            }
+
+            if (groupDigits > 0) {
+                u64 factor = 1;
+                for (u32 i = 0; i < groupDigits; i++)
+                    factor *= base;
+
+                bigIntMulAdd(limbs, factor, group);
+            }
+
+            return limbs;
+        }
+
+        std::string formatBigInt(std::vector<u64> limbs, u8 base) {
+            constexpr static std::string_view Alphabet = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+            if (limbs.empty())
+                return "0";
+
+            const auto chunk = getDigitChunk(base);
+
+            std::string result;
+            while (!limbs.empty()) {
+                u64 group = bigIntDivMod(limbs, chunk.value);
+
+                if (limbs.empty()) {
+                    // Most significant group, no leading zero padding
+                    do {
+                        result += Alphabet[group % base];
+                        group /= base;
+                    } while (group != 0);
+                } else {
+                    for (u32 i = 0; i < chunk.digits; i++) {
+                        result += Alphabet[group % base];
+                        group /= base;
+                    }
+                }
+            }
+
+            std::reverse(result.begin(), result.end());
+
+            return result;
+        }
+
         void drawBaseConverter() {
             static std::array<std::string, 4> buffers;
 
             static auto ConvertBases = [](u8 base) {
-                u64 number;
+                std::optional<std::vector<u64>> number;
 
                 switch (base) {
                     case 16:
-                        number = std::strtoull(buffers[1].c_str(), nullptr, base);
+                        number = parseBigInt(buffers[1], base);
                         break;
                     case 10:
-                        number = std::strtoull(buffers[0].c_str(), nullptr, base);
+                        number = parseBigInt(buffers[0], base);
                         break;
                     case 8:
-                        number = std::strtoull(buffers[2].c_str(), nullptr, base);
+                        number = parseBigInt(buffers[2], base);
                         break;
                     case 2:
-                        number = std::strtoull(buffers[3].c_str(), nullptr, base);
+                        number = parseBigInt(buffers[3], base);
                         break;
                     default:
                         return;
                 }
 
-                buffers[0] = std::to_string(number);
-                buffers[1] = hex::format("0x{0:X}", number);
-                buffers[2]  = hex::format("{0:#o}", number);
-                buffers[3]  = hex::toBinaryString(number);
+                // Leave the other fields alone while the edited one is invalid
+                if (!number.has_value())
+                    return;
+
+                buffers[0] = formatBigInt(*number, 10);
+                buffers[1] = "0x" + formatBigInt(*number, 16);
+                buffers[2] = number->empty() ? "0" : "0" + formatBigInt(*number, 8);
+                buffers[3] = formatBigInt(*number, 2);
             };
 
             if (ImGui::InputTextIcon("hex.builtin.tools.base_converter.dec"_lang, ICON_VS_SYMBOL_NUMERIC, buffers[0]))
@@ -758,8 +1096,6 @@ namespace hex::plugin::builtin {
                                 return;
                             }
 
-                            task.setMaxValue(file.getSize());
-
                             std::vector<std::array<u8, 3>> overwritePattern;
                             if (fastMode) {
                                 /* Should be sufficient for modern disks */
@@ -817,13 +1153,86 @@ namespace hex::plugin::builtin {
 
                             size_t fileSize = file.getSize();
 
+                            // Counting bytes across all passes makes the task throughput
+                            // readout show the live overwrite rate
+                            task.setMaxValue(fileSize * overwritePattern.size());
+
+                            // The block is a multiple of both the 3 byte pattern period and
+                            // the 4 KiB sector size direct I/O cares about
+                            constexpr static size_t BlockSize      = 0x30'0000;
+                            constexpr static size_t BlocksPerWrite = 8;
+
+                            std::vector<u8> blockStorage(BlockSize + 0x1000);
+                            auto block = reinterpret_cast<u8 *>((reinterpret_cast<uintptr_t>(blockStorage.data()) + 0xFFF) & ~uintptr_t(0xFFF));
+
+                            #if defined(OS_LINUX)
+                                const int fd        = fileno(file.getHandle());
+                                const int fileFlags = ::fcntl(fd, F_GETFL);
+
+                                // Probe once whether the filesystem takes O_DIRECT so the
+                                // passes hit the device instead of piling up in the page cache
+                                const bool direct = ::fcntl(fd, F_SETFL, fileFlags | O_DIRECT) == 0;
+                                ::fcntl(fd, F_SETFL, fileFlags);
+                            #endif
+
+                            u64 totalWritten = 0;
                             for (const auto &pattern : overwritePattern) {
-                                for (u64 offset = 0; offset < fileSize; offset += 3) {
-                                    file.write(pattern.data(), std::min<u64>(pattern.size(), fileSize - offset));
-                                    task.update(offset);
+                                for (size_t i = 0; i < BlockSize; i++)
+                                    block[i] = pattern[i % pattern.size()];
+
+                                u64 offset = 0;
+
+                                #if defined(OS_LINUX)
+                                    // Submit the pass as large vectored writes straight to the
+                                    // file descriptor. With O_DIRECT only sector-aligned sizes
+                                    // are allowed, so the tail stays on the buffered path below
+                                    const u64 alignedSize = direct ? (fileSize & ~u64(0xFFF)) : fileSize;
+
+                                    if (direct)
+                                        ::fcntl(fd, F_SETFL, fileFlags | O_DIRECT);
+
+                                    while (offset < alignedSize) {
+                                        std::array<iovec, BlocksPerWrite> blocks;
+
+                                        size_t blockCount = 0;
+                                        u64 batchSize     = 0;
+                                        while (blockCount < blocks.size() && (offset + batchSize) < alignedSize) {
+                                            const auto size = std::min<u64>(BlockSize, alignedSize - (offset + batchSize));
+                                            blocks[blockCount] = { block, size };
+                                            blockCount++;
+                                            batchSize += size;
+                                        }
+
+                                        const auto written = ::pwritev(fd, blocks.data(), blockCount, offset);
+                                        if (written <= 0)
+                                            break;
+
+                                        offset += written;
+                                        task.update(totalWritten + offset);
+                                    }
+
+                                    if (direct)
+                                        ::fcntl(fd, F_SETFL, fileFlags);
+                                #endif
+
+                                // Tail bytes, platforms without pwritev and anything the
+                                // kernel refused take the buffered path
+                                file.seek(offset);
+                                while (offset < fileSize) {
+                                    const auto phase   = offset % pattern.size();
+                                    const auto toWrite = std::min<u64>(BlockSize - phase, fileSize - offset);
+
+                                    file.write(block + phase, toWrite);
+                                    offset += toWrite;
+                                    task.update(totalWritten + offset);
                                 }
 
                                 file.flush();
+                                #if defined(OS_LINUX)
+                                    ::fsync(fd);
+                                #endif
+
+                                totalWritten += fileSize;
                             }
 
                             file.remove();
@@ -836,6 +1245,51 @@ namespace hex::plugin::builtin {
             }
         }
 
+        bool copyFileRegion(const std::fs::path &inputPath, u64 inputOffset, fs::File &outputFile, u64 outputOffset, u64 size) {
+            fs::File inputFile(inputPath, fs::File::Mode::Read);
+
+            if (!inputFile.isValid() || !outputFile.isValid())
+                return false;
+
+            u64 copied = 0;
+
+            #if defined(OS_LINUX)
+                // Let the kernel move the bytes between the two files directly. On
+                // reflink-capable filesystems this shares extents instead of copying
+                off64_t inOffset  = inputOffset;
+                off64_t outOffset = outputOffset;
+                while (copied < size) {
+                    auto result = ::copy_file_range(fileno(inputFile.getHandle()), &inOffset, fileno(outputFile.getHandle()), &outOffset, size - copied, 0);
+                    if (result <= 0)
+                        break;
+
+                    copied += result;
+                }
+            #endif
+
+            if (copied == size)
+                return true;
+
+            // Buffered copy for the other platforms and for whatever the kernel
+            // refused, e.g. regions that cross a filesystem boundary
+            constexpr static auto BufferSize = 0xFF'FFFF;
+
+            inputFile.seek(inputOffset + copied);
+            outputFile.seek(outputOffset + copied);
+
+            std::vector<u8> buffer(std::min<u64>(BufferSize, size - copied));
+            while (copied < size) {
+                auto bytesRead = inputFile.readBuffer(buffer.data(), std::min<u64>(buffer.size(), size - copied));
+                if (bytesRead == 0)
+                    return false;
+
+                outputFile.write(buffer.data(), bytesRead);
+                copied += bytesRead;
+            }
+
+            return true;
+        }
+
         void drawFileToolSplitter() {
             std::array sizeText = {
                 (const char *)"hex.builtin.tools.file_tools.splitter.sizes.5_75_floppy"_lang,
@@ -923,37 +1377,43 @@ namespace hex::plugin::builtin {
                                 return;
                             }
 
-                            if (file.getSize() < splitSize) {
+                            const u64 fileSize = file.getSize();
+
+                            if (fileSize < splitSize) {
                                 View::showErrorPopup("hex.builtin.tools.file_tools.splitter.error.size"_lang);
                                 return;
                             }
 
-                            task.setMaxValue(file.getSize());
+                            // Each part gets its own handles, so the workers only need the path
+                            file.close();
 
-                            u32 index = 1;
-                            for (u64 offset = 0; offset < file.getSize(); offset += splitSize) {
-                                task.update(offset);
+                            const u64 partCount = (fileSize + splitSize - 1) / splitSize;
 
-                                std::fs::path path = baseOutputPath;
-                                path += hex::format(".{:05}", index);
+                            std::atomic<u32> failedPart = 0;
+                            const auto startTime = std::chrono::steady_clock::now();
 
-                                fs::File partFile(path, fs::File::Mode::Create);
+                            TaskManager::parallelFor(task, 0, partCount, 1, [&](u64 partBegin, u64 partEnd) {
+                                for (u64 part = partBegin; part < partEnd; part++) {
+                                    std::fs::path path = baseOutputPath;
+                                    path += hex::format(".{:05}", part + 1);
 
-                                if (!partFile.isValid()) {
-                                    View::showErrorPopup(hex::format("hex.builtin.tools.file_tools.splitter.error.create"_lang, index));
-                                    return;
-                                }
+                                    fs::File partFile(path, fs::File::Mode::Create);
 
-                                constexpr static auto BufferSize = 0xFF'FFFF;
-                                for (u64 partOffset = 0; partOffset < splitSize; partOffset += BufferSize) {
-                                    partFile.write(file.readBytes(std::min<u64>(BufferSize, splitSize - partOffset)));
-                                    partFile.flush();
+                                    const u64 offset = part * splitSize;
+                                    if (!copyFileRegion(selectedFile, offset, partFile, 0, std::min<u64>(splitSize, fileSize - offset)))
+                                        failedPart = part + 1;
                                 }
+                            });
 
-                                index++;
+                            if (failedPart != 0) {
+                                View::showErrorPopup(hex::format("hex.builtin.tools.file_tools.splitter.error.create"_lang, failedPart.load()));
+                                return;
                             }
 
-                            View::showInfoPopup("hex.builtin.tools.file_tools.splitter.success"_lang);
+                            const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+                            const u64 throughput = seconds > 0 ? fileSize / seconds : fileSize;
+
+                            View::showInfoPopup(hex::format("{} ({}/s)", "hex.builtin.tools.file_tools.splitter.success"_lang.get(), hex::toByteString(throughput)));
                         });
                     }
                 }
@@ -1053,32 +1513,52 @@ namespace hex::plugin::builtin {
 
                         combinerTask = TaskManager::createTask("hex.builtin.tools.file_tools.combiner.combining", 0, [](auto &task) {
 
-                            fs::File output(outputPath, fs::File::Mode::Create);
-
-                            if (!output.isValid()) {
-                                View::showErrorPopup("hex.builtin.tools.file_tools.combiner.error.open_output"_lang);
-                                return;
-                            }
-
-                            task.setMaxValue(files.size());
-
-                            u64 fileIndex = 0;
+                            // Lay out the inputs first so every file's region in the output is known up front
+                            std::vector<std::pair<u64, u64>> regions;
+                            u64 totalSize = 0;
                             for (const auto &file : files) {
-                                task.update(fileIndex);
-                                fileIndex++;
-
                                 fs::File input(file, fs::File::Mode::Read);
                                 if (!input.isValid()) {
                                     View::showErrorPopup(hex::format("hex.builtin.tools.file_tools.combiner.open_input"_lang, hex::toUTF8String(file)));
                                     return;
                                 }
 
-                                constexpr static auto BufferSize = 0xFF'FFFF;
-                                auto inputSize            = input.getSize();
-                                for (u64 inputOffset = 0; inputOffset < inputSize; inputOffset += BufferSize) {
-                                    output.write(input.readBytes(std::min<u64>(BufferSize, inputSize - inputOffset)));
-                                    output.flush();
+                                regions.emplace_back(totalSize, input.getSize());
+                                totalSize += input.getSize();
+                            }
+
+                            {
+                                fs::File output(outputPath, fs::File::Mode::Create);
+
+                                if (!output.isValid()) {
+                                    View::showErrorPopup("hex.builtin.tools.file_tools.combiner.error.open_output"_lang);
+                                    return;
                                 }
+
+                                // Preallocate the full output so the parallel writers never race to extend it
+                                output.setSize(totalSize);
+                                #if defined(OS_LINUX)
+                                    if (totalSize > 0)
+                                        ::posix_fallocate(fileno(output.getHandle()), 0, totalSize);
+                                #endif
+                            }
+
+                            std::atomic<u32> failedFile = 0;
+
+                            TaskManager::parallelFor(task, 0, files.size(), 1, [&](u64 begin, u64 end) {
+                                for (u64 index = begin; index < end; index++) {
+                                    // Every worker writes through its own handle into its file's region
+                                    fs::File output(outputPath, fs::File::Mode::Write);
+
+                                    const auto &[offset, size] = regions[index];
+                                    if (!copyFileRegion(files[index], 0, output, offset, size))
+                                        failedFile = index + 1;
+                                }
+                            });
+
+                            if (failedFile != 0) {
+                                View::showErrorPopup(hex::format("hex.builtin.tools.file_tools.combiner.open_input"_lang, hex::toUTF8String(files[failedFile - 1])));
+                                return;
                             }
 
                             files.clear();
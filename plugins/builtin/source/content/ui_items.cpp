@@ -242,7 +242,14 @@ namespace hex::plugin::builtin {
                 ImGui::InvisibleButton("FrontTask", ImVec2(widgetEnd.x - widgetStart.x, ImGui::GetCurrentWindow()->MenuBarHeight()));
                 ImGui::SetCursorPos(widgetEnd);
 
-                ImGui::InfoTooltip(LangEntry(frontTask->getUnlocalizedName()).get().c_str());
+                std::string tooltipText = LangEntry(frontTask->getUnlocalizedName()).get();
+                if (const auto throughput = frontTask->getThroughput(); throughput > 0) {
+                    tooltipText += hex::format("\n{}/s", hex::toByteString(u64(throughput)));
+
+                    if (const auto eta = frontTask->getEstimatedRemainingSeconds(); eta.has_value())
+                        tooltipText += hex::format(" | {} {:02}:{:02}:{:02}", "hex.builtin.common.task.eta"_lang.get(), *eta / 3600, (*eta / 60) % 60, *eta % 60);
+                }
+                ImGui::InfoTooltip(tooltipText.c_str());
 
                 if (ImGui::BeginPopupContextItem("FrontTask", ImGuiPopupFlags_MouseButtonLeft)) {
                     for (const auto &task : tasks) {
@@ -18,6 +18,8 @@
 #include "content/views/view_diff.hpp"
 #include "content/views/view_provider_settings.hpp"
 #include "content/views/view_find.hpp"
+#include "content/views/view_carver.hpp"
+#include "content/views/view_data_visualizer.hpp"
 
 namespace hex::plugin::builtin {
 
@@ -42,6 +44,8 @@ namespace hex::plugin::builtin {
         ContentRegistry::Views::add<ViewDiff>();
         ContentRegistry::Views::add<ViewProviderSettings>();
         ContentRegistry::Views::add<ViewFind>();
+        ContentRegistry::Views::add<ViewCarver>();
+        ContentRegistry::Views::add<ViewDataVisualizer>();
     }
 
 }
\ No newline at end of file
@@ -46,12 +46,18 @@ namespace hex::plugin::builtin {
             ImGui::TableNextRow();
             ImGui::TableNextColumn();
 
-            if (!this->m_logoTexture.isValid()) {
+            if (this->m_logoTexture == nullptr) {
                 auto logo           = romfs::get("logo.png");
-                this->m_logoTexture = ImGui::Texture(reinterpret_cast<const ImU8 *>(logo.data()), logo.size());
+                const auto data     = reinterpret_cast<const ImU8 *>(logo.data());
+
+                this->m_logoTexture = ImGui::TextureLoader::loadAsync(std::vector<ImU8>(data, data + logo.size()));
             }
 
-            ImGui::Image(this->m_logoTexture, scaled({ 64, 64 }));
+            // The decode may still be in flight for the first couple of frames
+            if (this->m_logoTexture->isValid())
+                ImGui::Image(*this->m_logoTexture, scaled({ 64, 64 }));
+            else
+                ImGui::Dummy(scaled({ 64, 64 }));
             ImGui::TableNextColumn();
 
             ImGui::TextFormatted("ImHex Hex Editor v{} by WerWolv - " ICON_FA_CODE_BRANCH, IMHEX_VERSION);
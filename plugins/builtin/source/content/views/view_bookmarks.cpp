@@ -8,11 +8,27 @@
 
 #include <nlohmann/json.hpp>
 #include <cstring>
+#include <optional>
 
 #include <content/helpers/provider_extra_data.hpp>
 
 namespace hex::plugin::builtin {
 
+    static void updateBookmarkIndex(ProviderExtraData::Data &data) {
+        auto &index = data.bookmarkIndex;
+        if (index.indexedModifications == index.modifications)
+            return;
+
+        decltype(index.tree)::interval_vector intervals;
+        for (auto &bookmark : data.bookmarks) {
+            if (bookmark.region.size > 0)
+                intervals.emplace_back(bookmark.region.getStartAddress(), bookmark.region.getEndAddress(), &bookmark);
+        }
+
+        index.tree = decltype(index.tree)(std::move(intervals));
+        index.indexedModifications = index.modifications;
+    }
+
     ViewBookmarks::ViewBookmarks() : View("hex.builtin.view.bookmarks.name") {
         EventManager::subscribe<RequestAddBookmark>(this, [](Region region, std::string name, std::string comment, color_t color) {
             if (name.empty()) {
@@ -22,13 +38,15 @@ namespace hex::plugin::builtin {
             if (color == 0x00)
                 color = ImGui::GetColorU32(ImGuiCol_Header);
 
-            ProviderExtraData::getCurrent().bookmarks.push_back({
+            auto &data = ProviderExtraData::getCurrent();
+            data.bookmarks.push_back({
                 region,
                 name,
                 std::move(comment),
                 color,
                 false
             });
+            data.bookmarkIndex.modifications++;
 
             ImHexApi::Provider::markDirty();
         });
@@ -36,9 +54,15 @@ namespace hex::plugin::builtin {
         ImHexApi::HexEditor::addBackgroundHighlightingProvider([](u64 address, const u8* data, size_t size, bool) -> std::optional<color_t> {
             hex::unused(data);
 
-            for (const auto &bookmark : ProviderExtraData::getCurrent().bookmarks) {
-                if (Region { address, size }.isWithin(bookmark.region))
-                    return bookmark.color;
+            auto &extraData = ProviderExtraData::getCurrent();
+            if (extraData.bookmarks.empty())
+                return std::nullopt;
+
+            updateBookmarkIndex(extraData);
+
+            for (const auto &interval : extraData.bookmarkIndex.tree.findOverlapping(address, (address + size) - 1)) {
+                if (Region { address, size }.isWithin(interval.value->region))
+                    return interval.value->color;
             }
 
             return std::nullopt;
@@ -46,7 +70,15 @@ namespace hex::plugin::builtin {
 
         ImHexApi::HexEditor::addTooltipProvider([](u64 address, const u8 *data, size_t size) {
             hex::unused(data);
-            for (const auto &bookmark : ProviderExtraData::getCurrent().bookmarks) {
+
+            auto &extraData = ProviderExtraData::getCurrent();
+            if (extraData.bookmarks.empty())
+                return;
+
+            updateBookmarkIndex(extraData);
+
+            for (const auto &interval : extraData.bookmarkIndex.tree.findOverlapping(address, (address + size) - 1)) {
+                const auto &bookmark = *interval.value;
                 if (!Region { address, size }.isWithin(bookmark.region))
                     continue;
 
@@ -177,21 +209,49 @@ namespace hex::plugin::builtin {
             ImGui::NewLine();
 
             if (ImGui::BeginChild("##bookmarks")) {
-                auto &bookmarks = ProviderExtraData::getCurrent().bookmarks;
+                auto provider  = ImHexApi::Provider::get();
+                auto &data      = ProviderExtraData::getCurrent();
+                auto &bookmarks = data.bookmarks;
                 if (bookmarks.empty()) {
                     ImGui::TextFormattedCentered("hex.builtin.view.bookmarks.no_bookmarks"_lang);
                 }
 
-                int id = 1;
-                auto bookmarkToRemove = bookmarks.end();
-                for (auto iter = bookmarks.begin(); iter != bookmarks.end(); iter++) {
-                    auto &[region, name, comment, color, locked] = *iter;
+                // Rebuild the filtered snapshot when the filter, the bookmarks or the
+                // selected provider changed; a filter that only got more specific is
+                // narrowed within the previous results
+                const bool bookmarksChanged = this->m_filteredModifications != data.bookmarkIndex.modifications || this->m_filteredProvider != provider;
+                if (bookmarksChanged || this->m_refilter || this->m_appliedFilter != this->m_currFilter) {
+                    const auto matches = [this](const auto &bookmark) {
+                        return this->m_currFilter.empty() || bookmark.name.contains(this->m_currFilter) || bookmark.comment.contains(this->m_currFilter);
+                    };
 
-                    if (!this->m_currFilter.empty()) {
-                        if (!name.contains(this->m_currFilter) && !comment.contains(this->m_currFilter))
-                            continue;
+                    if (!bookmarksChanged && !this->m_refilter && !this->m_appliedFilter.empty() && this->m_currFilter.starts_with(this->m_appliedFilter)) {
+                        std::erase_if(this->m_filteredBookmarks, [&](const auto &entry) { return !matches(*entry); });
+                    } else {
+                        this->m_filteredBookmarks.clear();
+                        for (auto iter = bookmarks.begin(); iter != bookmarks.end(); ++iter) {
+                            if (matches(*iter))
+                                this->m_filteredBookmarks.push_back(iter);
+                        }
                     }
 
+                    this->m_appliedFilter         = this->m_currFilter;
+                    this->m_filteredModifications = data.bookmarkIndex.modifications;
+                    this->m_filteredProvider      = provider;
+                    this->m_refilter              = false;
+                }
+
+                std::optional<std::list<ImHexApi::Bookmarks::Entry>::iterator> bookmarkToRemove;
+
+                ImGuiListClipper clipper;
+                clipper.Begin(int(this->m_filteredBookmarks.size()), ImGui::GetFrameHeightWithSpacing());
+                while (clipper.Step())
+                for (int entryIndex = clipper.DisplayStart; entryIndex < clipper.DisplayEnd; entryIndex++) {
+                    auto iter = this->m_filteredBookmarks[entryIndex];
+                    auto &[region, name, comment, color, locked] = *iter;
+
+                    const int id = entryIndex + 1;
+
                     auto headerColor = ImColor(color);
                     auto hoverColor  = ImColor(color);
                     hoverColor.Value.w *= 1.3F;
@@ -204,7 +264,6 @@ namespace hex::plugin::builtin {
                     ON_SCOPE_EXIT {
                         ImGui::PopID();
                         ImGui::PopStyleColor(3);
-                        id++;
                     };
 
                     bool open = true;
@@ -296,19 +355,23 @@ namespace hex::plugin::builtin {
 
                         ImGui::SameLine();
 
-                        if (locked)
+                        if (locked) {
                             ImGui::TextUnformatted(name.data());
-                        else
-                            ImGui::InputText("##nameInput", name);
+                        } else {
+                            if (ImGui::InputText("##nameInput", name))
+                                this->m_refilter = true;
+                        }
 
                         ImGui::NewLine();
                         ImGui::TextUnformatted("hex.builtin.view.bookmarks.header.comment"_lang);
                         ImGui::Separator();
 
-                        if (locked)
+                        if (locked) {
                             ImGui::TextFormattedWrapped("{}", comment.data());
-                        else
-                            ImGui::InputTextMultiline("##commentInput", comment);
+                        } else {
+                            if (ImGui::InputTextMultiline("##commentInput", comment))
+                                this->m_refilter = true;
+                        }
 
                         ImGui::NewLine();
                     }
@@ -317,8 +380,9 @@ namespace hex::plugin::builtin {
                         bookmarkToRemove = iter;
                 }
 
-                if (bookmarkToRemove != bookmarks.end()) {
-                    bookmarks.erase(bookmarkToRemove);
+                if (bookmarkToRemove.has_value()) {
+                    bookmarks.erase(*bookmarkToRemove);
+                    data.bookmarkIndex.modifications++;
                 }
             }
             ImGui::EndChild();
@@ -348,6 +412,8 @@ namespace hex::plugin::builtin {
             });
         }
 
+        ProviderExtraData::get(provider).bookmarkIndex.modifications++;
+
         return true;
     }
 
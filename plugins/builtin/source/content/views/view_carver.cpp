@@ -0,0 +1,326 @@
+#include "content/views/view_carver.hpp"
+
+#include <hex/api/imhex_api.hpp>
+
+#include <hex/providers/provider.hpp>
+#include <hex/providers/buffered_reader.hpp>
+
+#include <hex/helpers/file.hpp>
+#include <hex/helpers/fs.hpp>
+#include <hex/helpers/magic.hpp>
+#include <hex/helpers/utils.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <span>
+#include <thread>
+
+namespace hex::plugin::builtin {
+
+    using namespace hex::literals;
+
+    namespace {
+
+        struct CarveSignature {
+            std::string unlocalizedName;
+            std::string extension;
+
+            std::vector<u8> header;
+            std::vector<u8> footer;
+            u64 footerTrailingBytes;    // Bytes belonging to the file after the footer pattern
+            u64 maxSize;
+
+            std::string mimePrefix;     // Expected start of the magic MIME type, empty skips validation
+
+            // Some formats carry their exact size in the header instead of having a footer
+            std::function<std::optional<u64>(std::span<const u8>)> sizeParser;
+        };
+
+        std::optional<u64> parseSqliteSize(std::span<const u8> header) {
+            // Page size (big endian, offset 16) times the page count (big endian, offset 28)
+            if (header.size() < 0x20)
+                return std::nullopt;
+
+            u64 pageSize = (u64(header[16]) << 8) | header[17];
+            if (pageSize == 1)
+                pageSize = 0x1'0000;
+
+            const u64 pageCount = (u64(header[28]) << 24) | (u64(header[29]) << 16) | (u64(header[30]) << 8) | header[31];
+            if (pageSize == 0 || pageCount == 0)
+                return std::nullopt;
+
+            return pageSize * pageCount;
+        }
+
+        std::optional<u64> parseBitmapSize(std::span<const u8> header) {
+            // File size (little endian, offset 2)
+            if (header.size() < 0x06)
+                return std::nullopt;
+
+            const u64 size = u64(header[2]) | (u64(header[3]) << 8) | (u64(header[4]) << 16) | (u64(header[5]) << 24);
+            if (size < 0x20)
+                return std::nullopt;
+
+            return size;
+        }
+
+        const std::vector<CarveSignature>& getCarveSignatures() {
+            static const std::vector<CarveSignature> signatures = {
+                { "hex.builtin.view.carver.type.jpeg",   "jpg",     { 0xFF, 0xD8, 0xFF },                               { 0xFF, 0xD9 },             0, 256_MiB, "image/jpeg",               nullptr },
+                { "hex.builtin.view.carver.type.png",    "png",     { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A },    { 'I', 'E', 'N', 'D' },     4, 256_MiB, "image/png",                nullptr },
+                { "hex.builtin.view.carver.type.gif",    "gif",     { 'G', 'I', 'F', '8' },                             { 0x00, 0x3B },             0, 256_MiB, "image/gif",                nullptr },
+                { "hex.builtin.view.carver.type.pdf",    "pdf",     { '%', 'P', 'D', 'F', '-' },                        { '%', '%', 'E', 'O', 'F' }, 0, 1_GiB,  "application/pdf",          nullptr },
+                { "hex.builtin.view.carver.type.zip",    "zip",     { 'P', 'K', 0x03, 0x04 },                           { 'P', 'K', 0x05, 0x06 },   18, 4_GiB,  "application/zip",          nullptr },
+                { "hex.builtin.view.carver.type.sqlite", "sqlite3", { 'S', 'Q', 'L', 'i', 't', 'e', ' ', 'f', 'o', 'r', 'm', 'a', 't', ' ', '3', 0x00 }, { }, 0, 16_GiB, "application/x-sqlite3", parseSqliteSize },
+                { "hex.builtin.view.carver.type.bmp",    "bmp",     { 'B', 'M' },                                       { },                        0, 256_MiB, "image/",                   parseBitmapSize },
+            };
+
+            return signatures;
+        }
+
+        struct Candidate {
+            size_t signatureIndex;
+            u64 address;
+        };
+
+    }
+
+    ViewCarver::ViewCarver() : View("hex.builtin.view.carver.name") { }
+
+    void ViewCarver::drawContent() {
+        if (ImGui::Begin(View::toWindowName("hex.builtin.view.carver.name").c_str(), &this->getWindowOpenState(), ImGuiWindowFlags_NoCollapse)) {
+
+            ImGui::BeginDisabled(this->m_carverTask.isRunning() || !ImHexApi::Provider::isValid());
+            if (ImGui::Button("hex.builtin.view.carver.carve"_lang))
+                this->carve();
+            ImGui::EndDisabled();
+
+            if (this->m_carverTask.isRunning()) {
+                ImGui::SameLine();
+                ImGui::TextSpinner("hex.builtin.view.carver.carving"_lang);
+            }
+
+            ImGui::NewLine();
+            ImGui::TextUnformatted("hex.builtin.view.carver.results"_lang);
+            ImGui::Separator();
+
+            if (ImGui::BeginTable("results", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY)) {
+                ImGui::TableSetupScrollFreeze(0, 1);
+                ImGui::TableSetupColumn("hex.builtin.view.carver.results.type"_lang);
+                ImGui::TableSetupColumn("hex.builtin.common.address"_lang);
+                ImGui::TableSetupColumn("hex.builtin.common.size"_lang);
+                ImGui::TableSetupColumn("hex.builtin.view.carver.results.description"_lang, ImGuiTableColumnFlags_WidthStretch);
+
+                ImGui::TableHeadersRow();
+
+                if (!this->m_carverTask.isRunning()) {
+                    ImGuiListClipper clipper;
+                    clipper.Begin(this->m_results.size());
+
+                    while (clipper.Step()) {
+                        for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+                            const auto &file = this->m_results[i];
+
+                            ImGui::TableNextRow();
+                            ImGui::TableNextColumn();
+                            ImGui::PushID(i);
+                            if (ImGui::Selectable("##carved_file", false, ImGuiSelectableFlags_SpanAllColumns | ImGuiSelectableFlags_AllowItemOverlap)) {
+                                ImHexApi::HexEditor::setSelection(file.region);
+                            }
+
+                            if (ImGui::BeginPopupContextItem("##carver_context")) {
+                                if (ImGui::MenuItem("hex.builtin.view.carver.bookmark"_lang)) {
+                                    ImHexApi::Bookmarks::add(file.region.getStartAddress(), file.region.getSize(), LangEntry(file.unlocalizedTypeName).get(), file.description);
+                                }
+                                if (ImGui::MenuItem("hex.builtin.view.carver.export"_lang)) {
+                                    exportFile(file);
+                                }
+                                ImGui::EndPopup();
+                            }
+                            ImGui::PopID();
+
+                            ImGui::SameLine();
+                            ImGui::TextFormatted("{}", LangEntry(file.unlocalizedTypeName));
+                            ImGui::TableNextColumn();
+                            ImGui::TextFormatted("0x{0:X} : 0x{1:X}", file.region.getStartAddress(), file.region.getEndAddress());
+                            ImGui::TableNextColumn();
+                            ImGui::TextFormatted("{}", hex::toByteString(file.region.getSize()));
+                            ImGui::TableNextColumn();
+                            ImGui::TextFormattedWrapped("{}", file.description);
+                        }
+                    }
+
+                    clipper.End();
+                }
+
+                ImGui::EndTable();
+            }
+        }
+        ImGui::End();
+    }
+
+    void ViewCarver::exportFile(const CarvedFile &file) {
+        fs::openFileBrowser(fs::DialogMode::Save, { }, [&file](const std::fs::path &path) {
+            auto provider = ImHexApi::Provider::get();
+
+            fs::File outputFile(path, fs::File::Mode::Create);
+            if (!outputFile.isValid())
+                return;
+
+            // The carved region gets streamed out in chunks instead of being read into memory at once
+            constexpr static size_t ChunkSize = 0x100'0000;
+
+            std::vector<u8> buffer;
+            for (u64 offset = 0; offset < file.region.getSize(); offset += ChunkSize) {
+                const size_t readSize = std::min<u64>(ChunkSize, file.region.getSize() - offset);
+
+                buffer.resize(readSize);
+                provider->read(file.region.getStartAddress() + offset, buffer.data(), readSize);
+                outputFile.write(buffer);
+            }
+        });
+    }
+
+    void ViewCarver::carve() {
+        this->m_results.clear();
+
+        this->m_carverTask = TaskManager::createTask("hex.builtin.view.carver.carving", 0, [this](auto &task) {
+            if (!ImHexApi::Provider::isValid()) return;
+
+            auto provider = ImHexApi::Provider::get();
+
+            const auto &signatures = getCarveSignatures();
+
+            const u64 baseAddress = provider->getBaseAddress();
+            const u64 dataSize    = provider->getActualSize();
+            if (dataSize == 0) return;
+
+            task.setMaxValue(dataSize);
+
+            size_t maxHeaderSize = 0;
+            for (const auto &signature : signatures)
+                maxHeaderSize = std::max(maxHeaderSize, signature.header.size());
+
+            // Phase one scans all signature headers over the data in parallel. Chunks overlap
+            // by the longest header so no candidate straddling a chunk edge gets lost, and
+            // all signatures share every chunk read instead of scanning one by one
+            constexpr static u64 ChunkSize = 0x100'0000;
+
+            const u64 chunkCount = (dataSize + ChunkSize - 1) / ChunkSize;
+
+            std::vector<std::vector<Candidate>> chunkCandidates(chunkCount);
+
+            TaskManager::parallelFor(task, 0, dataSize, ChunkSize, [&](u64 chunkBegin, u64 chunkEnd) {
+                auto reader = prv::BufferedReader(provider);
+
+                const u64 chunkAddress = baseAddress + chunkBegin;
+                const auto chunk = reader.readSpan(chunkAddress, (chunkEnd - chunkBegin) + (maxHeaderSize - 1));
+
+                auto &candidates = chunkCandidates[chunkBegin / ChunkSize];
+                for (size_t signatureIndex = 0; signatureIndex < signatures.size(); signatureIndex++) {
+                    const auto &header = signatures[signatureIndex].header;
+                    if (chunk.size() < header.size())
+                        continue;
+
+                    const u8 *candidate     = chunk.data();
+                    const u8 *const scanEnd = chunk.data() + (chunk.size() - header.size()) + 1;
+                    while (candidate < scanEnd) {
+                        candidate = static_cast<const u8 *>(std::memchr(candidate, header[0], scanEnd - candidate));
+                        if (candidate == nullptr)
+                            break;
+
+                        // Hits inside the overlap extension belong to the next chunk
+                        if (u64(candidate - chunk.data()) >= chunkEnd - chunkBegin)
+                            break;
+
+                        if (std::memcmp(candidate, header.data(), header.size()) == 0)
+                            candidates.push_back(Candidate { signatureIndex, chunkAddress + (candidate - chunk.data()) });
+
+                        candidate++;
+                    }
+                }
+            });
+
+            // Phase two resolves every candidate's extent and validates it against the magic
+            // database; false header hits in random data get rejected here
+            magic::compile();
+
+            std::vector<CarvedFile> results;
+
+            auto reader = prv::BufferedReader(provider);
+
+            for (const auto &candidates : chunkCandidates) {
+                for (const auto &candidate : candidates) {
+                    const auto &signature = signatures[candidate.signatureIndex];
+
+                    const u64 availableSize = (baseAddress + dataSize) - candidate.address;
+
+                    std::optional<u64> fileSize;
+                    if (signature.sizeParser != nullptr) {
+                        const auto header = reader.readSpan(candidate.address, std::max<size_t>(signature.header.size(), 0x40));
+                        fileSize = signature.sizeParser(header);
+                    } else if (!signature.footer.empty()) {
+                        // Search for the footer within the signature's size limit
+                        const auto &footer = signature.footer;
+                        const u64 searchLimit = std::min<u64>(signature.maxSize, availableSize);
+
+                        for (u64 offset = signature.header.size(); offset < searchLimit && !fileSize.has_value(); offset += 1_MiB) {
+                            const auto chunk = reader.readSpan(candidate.address + offset, std::min<u64>(1_MiB + (footer.size() - 1), searchLimit - offset));
+                            if (chunk.size() < footer.size())
+                                break;
+
+                            const u8 *footerCandidate = chunk.data();
+                            const u8 *const scanEnd   = chunk.data() + (chunk.size() - footer.size()) + 1;
+                            while (footerCandidate < scanEnd) {
+                                footerCandidate = static_cast<const u8 *>(std::memchr(footerCandidate, footer[0], scanEnd - footerCandidate));
+                                if (footerCandidate == nullptr)
+                                    break;
+
+                                if (std::memcmp(footerCandidate, footer.data(), footer.size()) == 0) {
+                                    fileSize = offset + (footerCandidate - chunk.data()) + footer.size() + signature.footerTrailingBytes;
+                                    break;
+                                }
+
+                                footerCandidate++;
+                            }
+                        }
+                    }
+
+                    if (!fileSize.has_value() || *fileSize < signature.header.size() || *fileSize > signature.maxSize)
+                        continue;
+
+                    const u64 carvedSize = std::min<u64>(*fileSize, availableSize);
+
+                    // Validation and description both come from one read of the candidate's start
+                    std::vector<u8> headerData(std::min<u64>(carvedSize, 0x2000));
+                    provider->read(candidate.address, headerData.data(), headerData.size());
+
+                    if (!signature.mimePrefix.empty()) {
+                        if (!magic::getMIMEType(headerData).starts_with(signature.mimePrefix))
+                            continue;
+                    }
+
+                    results.push_back(CarvedFile {
+                        signature.unlocalizedName,
+                        signature.extension,
+                        Region { candidate.address, carvedSize },
+                        magic::getDescription(headerData)
+                    });
+                }
+            }
+
+            std::sort(results.begin(), results.end(), [](const auto &left, const auto &right) {
+                return left.region.getStartAddress() < right.region.getStartAddress();
+            });
+
+            TaskManager::doLater([this, results = std::move(results)] {
+                this->m_results = results;
+            });
+        });
+    }
+
+}
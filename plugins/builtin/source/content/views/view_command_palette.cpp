@@ -2,6 +2,7 @@
 
 #include <hex/api/content_registry.hpp>
 
+#include <cctype>
 #include <cstring>
 
 namespace hex::plugin::builtin {
@@ -14,6 +15,16 @@ namespace hex::plugin::builtin {
             this->m_commandPaletteOpen = true;
             this->m_justOpened         = true;
         });
+
+        // The autocomplete labels bake in localized descriptions, so a language
+        // switch invalidates the index
+        EventManager::subscribe<EventSettingsChanged>(this, [this] {
+            this->m_indexDirty = true;
+        });
+    }
+
+    ViewCommandPalette::~ViewCommandPalette() {
+        EventManager::unsubscribe<EventSettingsChanged>(this);
     }
 
     void ViewCommandPalette::drawContent() {
@@ -74,51 +85,69 @@ namespace hex::plugin::builtin {
         }
     }
 
+    void ViewCommandPalette::updateIndex() {
+        const auto &entries = ContentRegistry::CommandPaletteCommands::getEntries();
+
+        this->m_indexedCommands.clear();
+        this->m_indexedCommands.reserve(entries.size());
+
+        for (const auto &entry : entries) {
+            auto matchKey = entry.command;
+            if (entry.type == ContentRegistry::CommandPaletteCommands::Type::KeywordCommand)
+                matchKey += ' ';
+
+            auto lowerMatchKey = matchKey;
+            for (auto &c : lowerMatchKey)
+                c = char(std::tolower(u8(c)));
+
+            this->m_indexedCommands.push_back(IndexedCommand {
+                &entry,
+                std::move(matchKey),
+                std::move(lowerMatchKey),
+                entry.command + " (" + LangEntry(entry.unlocalizedDescription) + ")"
+            });
+        }
+
+        this->m_indexDirty = false;
+    }
+
     std::vector<ViewCommandPalette::CommandResult> ViewCommandPalette::getCommandResults(const std::string &input) {
-        constexpr static auto MatchCommand = [](const std::string &currCommand, const std::string &commandToMatch) -> std::pair<MatchType, std::string_view> {
-            if (currCommand.empty()) {
-                return { MatchType::InfoMatch, "" };
-            } else if (currCommand.size() <= commandToMatch.size()) {
-                if (commandToMatch.starts_with(currCommand))
-                    return { MatchType::PartialMatch, currCommand };
-                else
-                    return { MatchType::NoMatch, {} };
-            } else {
-                if (currCommand.starts_with(commandToMatch))
-                    return { MatchType::PerfectMatch, currCommand.substr(commandToMatch.length()) };
-                else
-                    return { MatchType::NoMatch, {} };
-            }
-        };
+        // Registration only ever appends, so a size mismatch is the only way the
+        // index can be missing entries
+        if (this->m_indexDirty || this->m_indexedCommands.size() != ContentRegistry::CommandPaletteCommands::getEntries().size())
+            this->updateIndex();
+
+        auto lowerInput = input;
+        for (auto &c : lowerInput)
+            c = char(std::tolower(u8(c)));
 
         std::vector<CommandResult> results;
 
-        for (const auto &[type, command, unlocalizedDescription, displayCallback, executeCallback] : ContentRegistry::CommandPaletteCommands::getEntries()) {
+        for (const auto &indexed : this->m_indexedCommands) {
+            const auto &lowerKey = indexed.lowerMatchKey;
 
-            auto AutoComplete = [this, &currCommand = command](auto) {
-                focusInputTextBox();
-                std::strncpy(this->m_commandBuffer.data(), currCommand.data(), this->m_commandBuffer.size());
-                this->m_lastResults = this->getCommandResults(currCommand);
-            };
-
-            if (type == ContentRegistry::CommandPaletteCommands::Type::SymbolCommand) {
-                if (auto [match, value] = MatchCommand(input, command); match != MatchType::NoMatch) {
-                    if (match != MatchType::PerfectMatch)
-                        results.push_back({ command + " (" + LangEntry(unlocalizedDescription) + ")", "", AutoComplete });
-                    else {
-                        auto matchedCommand = input.substr(command.length());
-                        results.push_back({ displayCallback(matchedCommand), matchedCommand, executeCallback });
-                    }
-                }
-            } else if (type == ContentRegistry::CommandPaletteCommands::Type::KeywordCommand) {
-                if (auto [match, value] = MatchCommand(input, command + " "); match != MatchType::NoMatch) {
-                    if (match != MatchType::PerfectMatch)
-                        results.push_back({ command + " (" + LangEntry(unlocalizedDescription) + ")", "", AutoComplete });
-                    else {
-                        auto matchedCommand = input.substr(command.length() + 1);
-                        results.push_back({ displayCallback(matchedCommand), matchedCommand, executeCallback });
-                    }
-                }
+            MatchType match;
+            if (lowerInput.empty())
+                match = MatchType::InfoMatch;
+            else if (lowerInput.size() <= lowerKey.size())
+                match = lowerKey.starts_with(lowerInput) ? MatchType::PartialMatch : MatchType::NoMatch;
+            else
+                match = lowerInput.starts_with(lowerKey) ? MatchType::PerfectMatch : MatchType::NoMatch;
+
+            if (match == MatchType::NoMatch)
+                continue;
+
+            if (match == MatchType::PerfectMatch) {
+                auto matchedCommand = input.substr(indexed.matchKey.length());
+                results.push_back({ indexed.entry->displayCallback(matchedCommand), matchedCommand, indexed.entry->executeCallback });
+            } else {
+                auto AutoComplete = [this, &currCommand = indexed.entry->command](auto) {
+                    focusInputTextBox();
+                    std::strncpy(this->m_commandBuffer.data(), currCommand.data(), this->m_commandBuffer.size());
+                    this->m_lastResults = this->getCommandResults(currCommand);
+                };
+
+                results.push_back({ indexed.autoCompleteLabel, "", AutoComplete });
             }
         }
 
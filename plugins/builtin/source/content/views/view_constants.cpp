@@ -4,8 +4,11 @@
 #include <hex/helpers/logger.hpp>
 #include <hex/helpers/utils.hpp>
 
+#include <algorithm>
+#include <cctype>
 #include <fstream>
 #include <filesystem>
+#include <numeric>
 #include <nlohmann/json.hpp>
 
 namespace hex::plugin::builtin {
@@ -17,47 +20,126 @@ namespace hex::plugin::builtin {
         std::memset(this->m_filter.data(), 0x00, this->m_filter.capacity());
     }
 
+    // Maximal alphanumeric runs, lowered. Both the index and the query go through
+    // this so a query token can only ever need a prefix compare
+    static std::vector<std::string> tokenize(std::string_view string) {
+        std::vector<std::string> tokens;
+
+        std::string token;
+        for (const char c : string) {
+            if (std::isalnum(u8(c))) {
+                token += char(std::tolower(u8(c)));
+            } else if (!token.empty()) {
+                tokens.push_back(std::move(token));
+                token.clear();
+            }
+        }
+        if (!token.empty())
+            tokens.push_back(std::move(token));
+
+        return tokens;
+    }
+
     void ViewConstants::reloadConstants() {
         this->m_constants.clear();
+        this->m_tokenIndex.clear();
         this->m_filterIndices.clear();
 
-        for (const auto &path : fs::getDefaultPaths(fs::ImHexPath::Constants)) {
-            if (!fs::exists(path)) continue;
-
-            std::error_code error;
-            for (auto &file : std::fs::directory_iterator(path, error)) {
-                if (!file.is_regular_file()) continue;
-
-                try {
-                    nlohmann::json content;
-                    std::ifstream(file.path()) >> content;
-
-                    for (auto value : content["values"]) {
-                        Constant constant;
-                        constant.category = content["name"].get<std::string>();
-                        constant.name     = value["name"].get<std::string>();
-                        if (value.contains("desc"))
-                            constant.description = value["desc"].get<std::string>();
-                        constant.value = value["value"].get<std::string>();
-
-                        auto type = value["type"];
-                        if (type == "int10")
-                            constant.type = ConstantType::Int10;
-                        else if (type == "int16be")
-                            constant.type = ConstantType::Int16BigEndian;
-                        else if (type == "int16le")
-                            constant.type = ConstantType::Int16LittleEndian;
-                        else
-                            throw std::runtime_error("Invalid type");
-
-                        this->m_filterIndices.push_back(this->m_constants.size());
-                        this->m_constants.push_back(constant);
+        // Parsing a large constants pack shouldn't hold up startup. The files are
+        // parsed and indexed on a background task and the result is swapped into
+        // the view on the main thread once complete
+        this->m_reloadTask = TaskManager::createBackgroundTask("hex.builtin.view.constants.loading", [this](auto &) {
+            auto constants  = std::make_shared<std::vector<Constant>>();
+            auto tokenIndex = std::make_shared<std::vector<TokenEntry>>();
+
+            for (const auto &path : fs::getDefaultPaths(fs::ImHexPath::Constants)) {
+                if (!fs::exists(path)) continue;
+
+                std::error_code error;
+                for (auto &file : std::fs::directory_iterator(path, error)) {
+                    if (!file.is_regular_file()) continue;
+
+                    try {
+                        nlohmann::json content;
+                        std::ifstream(file.path()) >> content;
+
+                        for (auto value : content["values"]) {
+                            Constant constant;
+                            constant.category = content["name"].get<std::string>();
+                            constant.name     = value["name"].get<std::string>();
+                            if (value.contains("desc"))
+                                constant.description = value["desc"].get<std::string>();
+                            constant.value = value["value"].get<std::string>();
+
+                            auto type = value["type"];
+                            if (type == "int10")
+                                constant.type = ConstantType::Int10;
+                            else if (type == "int16be")
+                                constant.type = ConstantType::Int16BigEndian;
+                            else if (type == "int16le")
+                                constant.type = ConstantType::Int16LittleEndian;
+                            else
+                                throw std::runtime_error("Invalid type");
+
+                            const auto constantIndex = constants->size();
+                            for (const auto &field : { &constant.category, &constant.name, &constant.description, &constant.value }) {
+                                for (auto &token : tokenize(*field))
+                                    tokenIndex->push_back(TokenEntry { std::move(token), constantIndex });
+                            }
+
+                            constants->push_back(std::move(constant));
+                        }
+                    } catch (...) {
+                        log::error("Failed to parse constants file {}", hex::toUTF8String(file.path()));
+                        continue;
                     }
-                } catch (...) {
-                    log::error("Failed to parse constants file {}", hex::toUTF8String(file.path()));
-                    continue;
                 }
             }
+
+            std::sort(tokenIndex->begin(), tokenIndex->end(), [](const TokenEntry &left, const TokenEntry &right) {
+                return left.token < right.token;
+            });
+
+            TaskManager::doLater([this, constants, tokenIndex] {
+                this->m_constants  = std::move(*constants);
+                this->m_tokenIndex = std::move(*tokenIndex);
+                this->applyFilter();
+            });
+        });
+    }
+
+    void ViewConstants::applyFilter() {
+        this->m_filterIndices.clear();
+
+        const auto queryTokens = tokenize(this->m_filter);
+
+        if (queryTokens.empty()) {
+            this->m_filterIndices.resize(this->m_constants.size());
+            std::iota(this->m_filterIndices.begin(), this->m_filterIndices.end(), 0);
+            return;
+        }
+
+        // A constant matches when every query token prefix-matches one of its
+        // indexed tokens. matchedTokens[i] counts how many query tokens constant i
+        // has matched so far; a constant only advances once per query token
+        std::vector<u32> matchedTokens(this->m_constants.size(), 0);
+
+        for (u32 tokenIndex = 0; tokenIndex < queryTokens.size(); tokenIndex++) {
+            const auto &queryToken = queryTokens[tokenIndex];
+
+            auto entry = std::lower_bound(this->m_tokenIndex.begin(), this->m_tokenIndex.end(), queryToken, [](const TokenEntry &left, const std::string &right) {
+                return left.token < right;
+            });
+
+            for (; entry != this->m_tokenIndex.end() && entry->token.starts_with(queryToken); ++entry) {
+                if (matchedTokens[entry->constantIndex] == tokenIndex)
+                    matchedTokens[entry->constantIndex]++;
+            }
+        }
+
+        for (size_t i = 0; i < matchedTokens.size(); i++) {
+            if (matchedTokens[i] == queryTokens.size())
+                this->m_filterIndices.push_back(i);
         }
     }
 
@@ -69,15 +151,7 @@ namespace hex::plugin::builtin {
                     auto &view = *static_cast<ViewConstants *>(data->UserData);
                     view.m_filter.resize(data->BufTextLen);
 
-                    view.m_filterIndices.clear();
-                    for (u64 i = 0; i < view.m_constants.size(); i++) {
-                        auto &constant = view.m_constants[i];
-                        if (hex::containsIgnoreCase(constant.name, data->Buf) ||
-                            hex::containsIgnoreCase(constant.category, data->Buf) ||
-                            hex::containsIgnoreCase(constant.description, data->Buf) ||
-                            hex::containsIgnoreCase(constant.value, data->Buf))
-                            view.m_filterIndices.push_back(i);
-                    }
+                    view.applyFilter();
 
                     return 0;
                 },
@@ -93,7 +167,12 @@ namespace hex::plugin::builtin {
                 auto sortSpecs = ImGui::TableGetSortSpecs();
 
                 if (sortSpecs->SpecsDirty) {
-                    std::sort(this->m_constants.begin(), this->m_constants.end(), [&sortSpecs](Constant &left, Constant &right) -> bool {
+                    // The constants themselves stay in load order since the token
+                    // index refers to them by position; only the view order sorts
+                    std::sort(this->m_filterIndices.begin(), this->m_filterIndices.end(), [&](size_t leftIndex, size_t rightIndex) -> bool {
+                        const auto &left  = this->m_constants[leftIndex];
+                        const auto &right = this->m_constants[rightIndex];
+
                         if (sortSpecs->Specs->ColumnUserID == ImGui::GetID("category")) {
                             if (sortSpecs->Specs->SortDirection == ImGuiSortDirection_Ascending)
                                 return left.category > right.category;
@@ -1,8 +1,11 @@
 #include "content/views/view_data_inspector.hpp"
 
+#include <content/helpers/selection_statistics.hpp>
+
 #include <hex/ui/imgui_imhex_extensions.h>
 
 #include <hex/providers/provider.hpp>
+#include <hex/providers/frame_read_cache.hpp>
 
 #include <cstring>
 
@@ -17,6 +20,13 @@ namespace hex::plugin::builtin {
 
     using NumberDisplayStyle = ContentRegistry::DataInspector::NumberDisplayStyle;
 
+    // How long the selection has to stay put before the inspectors re-evaluate, and how
+    // many leading bytes of the selection are compared to detect that nothing changed.
+    // Custom pattern inspectors may read past that window; an edit that far out already
+    // re-selects through the hex editor and invalidates the cache that way
+    constexpr static auto DebounceInterval    = std::chrono::milliseconds(150);
+    constexpr static size_t MaxComparedWindow = 0x1000;
+
     ViewDataInspector::ViewDataInspector() : View("hex.builtin.view.data_inspector.name") {
         EventManager::subscribe<EventRegionSelected>(this, [this](Region region) {
             if (!ImHexApi::Provider::isValid() || region == Region::Invalid()) {
@@ -29,6 +39,7 @@ namespace hex::plugin::builtin {
             }
 
             this->m_shouldInvalidate = true;
+            this->m_invalidationTime = std::chrono::steady_clock::now();
         });
     }
 
@@ -42,9 +53,37 @@ namespace hex::plugin::builtin {
             this->m_cachedData = std::move(this->m_workData);
         }
 
-        if (this->m_shouldInvalidate && !this->m_updateTask.isRunning()) {
+        // Evaluation is debounced so dragging a selection across a row doesn't re-run
+        // every registered inspector for each intermediate selection, and skipped
+        // entirely when neither the selected bytes nor the display options changed
+        bool evaluate = false;
+        if (this->m_shouldInvalidate && !this->m_updateTask.isRunning() && std::chrono::steady_clock::now() - this->m_invalidationTime >= DebounceInterval) {
             this->m_shouldInvalidate = false;
 
+            std::vector<u8> windowBytes;
+            if (this->m_validBytes > 0 && ImHexApi::Provider::isValid()) {
+                windowBytes.resize(std::min<size_t>(this->m_validBytes, MaxComparedWindow));
+                hex::prv::readcache::read(ImHexApi::Provider::get(), this->m_startAddress, windowBytes.data(), windowBytes.size());
+            }
+
+            evaluate = this->m_validBytes         != this->m_lastValidBytes         ||
+                       this->m_startAddress       != this->m_lastStartAddress       ||
+                       this->m_endian             != this->m_lastEndian             ||
+                       this->m_invert             != this->m_lastInvert             ||
+                       this->m_numberDisplayStyle != this->m_lastNumberDisplayStyle ||
+                       windowBytes                != this->m_lastWindowBytes;
+
+            if (evaluate) {
+                this->m_lastValidBytes         = this->m_validBytes;
+                this->m_lastStartAddress       = this->m_startAddress;
+                this->m_lastEndian             = this->m_endian;
+                this->m_lastInvert             = this->m_invert;
+                this->m_lastNumberDisplayStyle = this->m_numberDisplayStyle;
+                this->m_lastWindowBytes        = std::move(windowBytes);
+            }
+        }
+
+        if (evaluate) {
             this->m_updateTask = TaskManager::createBackgroundTask("Update Inspector",
                [this, validBytes = this->m_validBytes, startAddress = this->m_startAddress, endian = this->m_endian, invert = this->m_invert, numberDisplayStyle = this->m_numberDisplayStyle](auto &) {
                 auto provider = ImHexApi::Provider::get();
@@ -57,7 +96,7 @@ namespace hex::plugin::builtin {
                         continue;
 
                     std::vector<u8> buffer(validBytes > entry.maxSize ? entry.maxSize : validBytes);
-                    provider->read(startAddress, buffer.data(), buffer.size());
+                    hex::prv::readcache::read(provider, startAddress, buffer.data(), buffer.size());
 
                     if (invert) {
                         for (auto &byte : buffer)
@@ -197,6 +236,12 @@ namespace hex::plugin::builtin {
                     ImGui::EndTable();
                 }
 
+                // Whole-selection statistics, maintained incrementally by the histogram cache
+                if (auto selection = ImHexApi::HexEditor::getSelection(); selection.has_value() && selection->getSize() > 1) {
+                    ImGui::NewLine();
+                    drawSelectionStatistics(provider, *selection);
+                }
+
                 ImGui::NewLine();
                 ImGui::Separator();
                 ImGui::NewLine();
@@ -10,6 +10,16 @@
 #include <imnodes.h>
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <thread>
+
 #include <content/helpers/provider_extra_data.hpp>
 
 namespace hex::plugin::builtin {
@@ -36,20 +46,20 @@ namespace hex::plugin::builtin {
             .basePath = "data_processor.json",
             .required = false,
             .load = [this](prv::Provider *provider, const std::fs::path &basePath, Tar &tar) {
-                auto save = tar.readString(basePath);
-
-                this->loadNodes(provider, save);
+                this->loadNodes(provider, tar.read(basePath));
 
                 return true;
             },
             .store = [this](prv::Provider *provider, const std::fs::path &basePath, Tar &tar) {
-                tar.write(basePath, this->saveNodes(provider));
+                tar.write(basePath, this->saveNodesBinary(provider));
 
                 return true;
             }
         });
 
         EventManager::subscribe<EventProviderChanged>(this, [this](const auto &, const auto &) {
+            this->stopEvaluation();
+
             auto &data = ProviderExtraData::getCurrent().dataProcessor;
             for (auto &node : data.nodes) {
                 node->setCurrentOverlay(nullptr);
@@ -59,6 +69,13 @@ namespace hex::plugin::builtin {
         });
 
         EventManager::subscribe<EventDataChanged>(this, [this] {
+            this->stopEvaluation();
+
+            // A data edit can change what any provider reading node sees, so the
+            // whole graph has to be re-evaluated
+            for (auto &node : ProviderExtraData::getCurrent().dataProcessor.nodes)
+                node->markDirty();
+
             this->processNodes();
         });
 
@@ -98,13 +115,33 @@ namespace hex::plugin::builtin {
     }
 
     ViewDataProcessor::~ViewDataProcessor() {
+        this->stopEvaluation();
+
         EventManager::unsubscribe<RequestChangeTheme>(this);
         EventManager::unsubscribe<EventFileLoaded>(this);
         EventManager::unsubscribe<EventDataChanged>(this);
     }
 
 
+    void ViewDataProcessor::stopEvaluation() {
+        // An edit makes the result of the run currently in flight stale, so the
+        // run is cancelled and the graph isn't touched until it has wound down at
+        // its next node or chunk boundary. The replacement run only starts once
+        // the old one is gone, so any number of edits arriving during one run
+        // collapse into a single new run instead of one run per edit
+        if (!this->m_evaluationRunning)
+            return;
+
+        this->m_restartEvaluation = true;
+        this->m_evaluationTask.interrupt();
+
+        while (this->m_evaluationRunning)
+            std::this_thread::yield();
+    }
+
     void ViewDataProcessor::eraseLink(int id) {
+        this->stopEvaluation();
+
         auto &data = ProviderExtraData::getCurrent().dataProcessor;
 
         auto link = std::find_if(data.links.begin(), data.links.end(), [&id](auto link) { return link.getId() == id; });
@@ -114,7 +151,15 @@ namespace hex::plugin::builtin {
 
         for (auto &node : data.nodes) {
             for (auto &attribute : node->getAttributes()) {
+                if (!attribute.getConnectedAttributes().contains(id))
+                    continue;
+
                 attribute.removeConnectedAttribute(id);
+
+                // The node at the input end of the link just lost one of its inputs
+                // and will compute something different from now on
+                if (attribute.getIOType() == dp::Attribute::IOType::In)
+                    node->markDirty();
             }
         }
 
@@ -124,6 +169,8 @@ namespace hex::plugin::builtin {
     }
 
     void ViewDataProcessor::eraseNodes(const std::vector<int> &ids) {
+        this->stopEvaluation();
+
         auto &data = ProviderExtraData::getCurrent().dataProcessor;
         for (int id : ids) {
             auto node = std::find_if(data.nodes.begin(), data.nodes.end(),
@@ -155,6 +202,14 @@ namespace hex::plugin::builtin {
     void ViewDataProcessor::processNodes() {
         auto &data = ProviderExtraData::getCurrent().dataProcessor;
 
+        // A single evaluation runs at a time. While one is in flight nothing new
+        // is dispatched; edits cancel it through stopEvaluation() and the restart
+        // is picked up here once it's gone
+        if (this->m_evaluationRunning)
+            return;
+
+        this->m_restartEvaluation = false;
+
         if (data.dataOverlays.size() != data.endNodes.size()) {
             for (auto overlay : data.dataOverlays)
                 ImHexApi::Provider::get()->deleteOverlay(overlay);
@@ -162,6 +217,11 @@ namespace hex::plugin::builtin {
 
             for (u32 i = 0; i < data.endNodes.size(); i++)
                 data.dataOverlays.push_back(ImHexApi::Provider::get()->newOverlay());
+
+            // The fresh overlays are empty, so every end node has to run again to
+            // fill them even if its inputs didn't change
+            for (auto endNode : data.endNodes)
+                endNode->markDirty();
         }
 
         u32 overlayIndex = 0;
@@ -170,23 +230,341 @@ namespace hex::plugin::builtin {
             overlayIndex++;
         }
 
+        // With nothing modified since the last run every cached output is still
+        // valid and the graph doesn't need to be touched at all, which makes
+        // continuous evaluation of an idle graph free
+        if (std::none_of(data.nodes.begin(), data.nodes.end(), [](const auto &node) { return node->isDirty(); }))
+            return;
+
         data.currNodeError.reset();
+        this->m_evaluationRunning = true;
+
+        // The evaluation happens on a task thread, so a heavy graph doesn't stall
+        // the interface mid-frame anymore. Display nodes keep drawing the result
+        // of the previous run until the new one has landed
+        this->m_evaluationTask = TaskManager::createTask("hex.builtin.view.data_processor.evaluating", TaskManager::NoProgress, [this, &data](auto &task) {
+            ON_SCOPE_EXIT { this->m_evaluationRunning = false; };
+
+            this->evaluateGraph(data, task);
+        });
+    }
+
+    void ViewDataProcessor::evaluateGraph(ProviderExtraData::Data::DataProcessor &data, Task &task) {
+        // Bails out right away if this run was cancelled while it was still queued
+        task.update();
 
         try {
-            for (auto &endNode : data.endNodes) {
-                endNode->resetOutputData();
+            // Only the outputs downstream of a modification are stale; every clean
+            // node keeps the results of its previous run
+            for (auto &node : data.nodes) {
+                if (node->isDirty()) {
+                    node->resetOutputData();
+                    node->resetProcessedInputs();
+                }
+            }
 
-                for (auto &node : data.nodes)
+            // Just like the old pull based evaluation, only nodes an end node actually
+            // depends on take part in the run; half connected leftovers on the canvas
+            // don't produce errors
+            std::set<dp::Node *> reachable;
+            std::vector<dp::Node *> pending(data.endNodes.begin(), data.endNodes.end());
+            while (!pending.empty()) {
+                auto node = pending.back();
+                pending.pop_back();
+
+                if (!reachable.insert(node).second)
+                    continue;
+
+                for (auto &attribute : node->getAttributes()) {
+                    if (attribute.getIOType() != dp::Attribute::IOType::In)
+                        continue;
+
+                    for (auto &[linkId, connectedAttribute] : attribute.getConnectedAttributes())
+                        pending.push_back(connectedAttribute->getParentNode());
+                }
+            }
+
+            // A linear run from a stream source through streamable transforms into
+            // a stream sink is executed chunk by chunk instead of materializing
+            // every intermediate buffer. Chain members are taken out of the regular
+            // evaluation below; only their non-buffer side inputs go through it
+            std::vector<std::vector<dp::Node *>> streamChains;
+            std::set<dp::Node *> streamedNodes;
+            for (auto endNode : data.endNodes) {
+                if (!endNode->isStreamSink() || !endNode->isDirty())
+                    continue;
+
+                std::vector<dp::Node *> chain { endNode };
+                for (auto node = endNode; node != nullptr;) {
+                    // The streamed data enters through the node's designated stream
+                    // input or, failing that, its only connected buffer input. Its
+                    // producer may feed nothing else; any other shape needs the
+                    // producer's output materialized and falls back to a normal run
+                    dp::Attribute *producerAttribute = nullptr;
+                    if (auto streamInput = node->getStreamInputIndex(); streamInput.has_value()) {
+                        auto &attribute = node->getAttributes()[*streamInput];
+                        if (!attribute.getConnectedAttributes().empty())
+                            producerAttribute = attribute.getConnectedAttributes().begin()->second;
+                    } else {
+                        for (auto &attribute : node->getAttributes()) {
+                            if (attribute.getIOType() != dp::Attribute::IOType::In || attribute.getType() != dp::Attribute::Type::Buffer)
+                                continue;
+                            if (attribute.getConnectedAttributes().empty())
+                                continue;
+
+                            producerAttribute = producerAttribute == nullptr ? attribute.getConnectedAttributes().begin()->second : nullptr;
+                            if (producerAttribute == nullptr)
+                                break;
+                        }
+                    }
+
+                    if (producerAttribute == nullptr || producerAttribute->getConnectedAttributes().size() != 1) {
+                        chain.clear();
+                        break;
+                    }
+
+                    auto producer = producerAttribute->getParentNode();
+                    if (std::find(chain.begin(), chain.end(), producer) != chain.end()) {
+                        chain.clear();
+                        break;
+                    }
+
+                    chain.push_back(producer);
+
+                    if (producer->isStreamSource())
+                        break;
+
+                    if (!producer->isStreamable()) {
+                        chain.clear();
+                        break;
+                    }
+
+                    node = producer;
+                }
+
+                if (chain.empty() || !chain.back()->isStreamSource())
+                    continue;
+
+                std::reverse(chain.begin(), chain.end());
+                streamedNodes.insert(chain.begin(), chain.end());
+                streamChains.push_back(std::move(chain));
+            }
+
+            // Dirtiness spreads downstream when a node is modified, so the dirty
+            // part of the reachable graph is self-contained: every producer of a
+            // clean node is clean as well and its cached output can be handed out
+            // by the memoized input lookups without running the node again
+            std::set<dp::Node *> dirtyNodes;
+            for (auto node : reachable) {
+                if (node->isDirty() && !streamedNodes.contains(node))
+                    dirtyNodes.insert(node);
+            }
+
+            if (dirtyNodes.empty() && streamChains.empty())
+                return;
+
+            // Progress is reported per node, so the task list shows how far along
+            // a long running graph is
+            u64 nodeCount = dirtyNodes.size();
+            for (const auto &chain : streamChains)
+                nodeCount += chain.size();
+            task.setMaxValue(nodeCount);
+
+            std::atomic<u64> processedNodes = 0;
+
+            // The dirty subgraph is evaluated in topological waves: a node is
+            // scheduled once all of its stale producers have run, so the nodes of
+            // one wave are independent of each other and independent branches
+            // spread across parallel workers
+            std::map<dp::Node *, u32> remainingInputs;
+            std::map<dp::Node *, std::vector<dp::Node *>> dependents;
+
+            for (auto node : dirtyNodes) {
+                u32 inputCount = 0;
+                for (auto &attribute : node->getAttributes()) {
+                    if (attribute.getIOType() != dp::Attribute::IOType::In)
+                        continue;
+
+                    for (auto &[linkId, connectedAttribute] : attribute.getConnectedAttributes()) {
+                        auto producer = connectedAttribute->getParentNode();
+
+                        // Inputs fed by a clean producer are already available
+                        if (!dirtyNodes.contains(producer))
+                            continue;
+
+                        inputCount++;
+                        dependents[producer].push_back(node);
+                    }
+                }
+
+                remainingInputs[node] = inputCount;
+            }
+
+            std::vector<dp::Node *> wave;
+            for (auto node : dirtyNodes) {
+                if (remainingInputs[node] == 0)
+                    wave.push_back(node);
+            }
+
+            size_t scheduledCount = 0;
+            while (!wave.empty()) {
+                scheduledCount += wave.size();
+
+                std::mutex exceptionMutex;
+                std::exception_ptr workerException;
+
+                {
+                    std::atomic<size_t> nextNode = 0;
+                    const auto workerCount = std::min<size_t>(wave.size(), std::max<u32>(std::thread::hardware_concurrency(), 1));
+
+                    std::vector<std::jthread> workers;
+                    for (size_t worker = 0; worker < workerCount; worker++) {
+                        workers.emplace_back([&] {
+                            for (size_t index = 0; (index = nextNode.fetch_add(1)) < wave.size();) {
+                                try {
+                                    // Winds the run down at the node boundary when
+                                    // it has been cancelled by an edit
+                                    task.update(processedNodes);
+
+                                    wave[index]->resetProfile();
+
+                                    const auto startTime = std::chrono::steady_clock::now();
+                                    wave[index]->process();
+                                    wave[index]->addProcessingTime(std::chrono::nanoseconds(std::chrono::steady_clock::now() - startTime).count());
+
+                                    // A node that failed stays dirty and is retried
+                                    // by the next run
+                                    wave[index]->markClean();
+                                    processedNodes += 1;
+                                } catch (...) {
+                                    std::scoped_lock lock(exceptionMutex);
+
+                                    if (!workerException)
+                                        workerException = std::current_exception();
+                                }
+                            }
+                        });
+                    }
+                }
+
+                if (workerException)
+                    std::rethrow_exception(workerException);
+
+                std::vector<dp::Node *> nextWave;
+                for (auto node : wave) {
+                    for (auto dependent : dependents[node]) {
+                        if (--remainingInputs[dependent] == 0)
+                            nextWave.push_back(dependent);
+                    }
+                }
+
+                wave = std::move(nextWave);
+            }
+
+            // Nodes that never became ready are part of a cycle
+            if (scheduledCount != dirtyNodes.size()) {
+                for (auto node : dirtyNodes) {
+                    if (remainingInputs[node] > 0)
+                        throw dp::Node::NodeError { node, "Recursion detected!" };
+                }
+            }
+
+            // Stream chains run after the regular evaluation so the side inputs
+            // they pull in resetStreamState() are already computed. Chunks flow
+            // through the whole chain one at a time, keeping memory usage bounded
+            // by the chunk size no matter how large the streamed region is
+            constexpr static size_t StreamChunkSize = 0x10'0000;
+
+            for (auto &chain : streamChains) {
+                for (auto node : chain) {
+                    node->resetOutputData();
                     node->resetProcessedInputs();
+                    node->resetProfile();
+                    node->resetStreamState();
+                }
 
-                endNode->process();
+                // Maximal runs of elementwise stages collapse into one fused lookup
+                // table, so a chain of byte transforms costs a single table pass
+                // per chunk instead of one interpreted pass per node
+                struct StreamStage {
+                    dp::Node *node;
+                    std::optional<std::array<u8, 0x100>> table;
+                };
+
+                std::vector<StreamStage> stages;
+                for (size_t stage = 1; stage < chain.size() - 1; stage++) {
+                    auto node = chain[stage];
+
+                    if (auto table = node->getStreamByteMap(); table.has_value()) {
+                        if (!stages.empty() && stages.back().table.has_value()) {
+                            auto &fused = *stages.back().table;
+
+                            std::array<u8, 0x100> composed;
+                            for (u32 byte = 0; byte < composed.size(); byte++)
+                                composed[byte] = (*table)[fused[byte]];
+
+                            fused = composed;
+                        } else {
+                            stages.push_back({ node, std::move(table) });
+                        }
+                    } else {
+                        stages.push_back({ node, std::nullopt });
+                    }
+                }
+
+                auto source     = chain.front();
+                const auto size = source->getStreamSize();
+
+                for (u64 offset = 0; offset < size; offset += StreamChunkSize) {
+                    // Winds the run down at the chunk boundary when it has been
+                    // cancelled by an edit
+                    task.update(processedNodes);
+
+                    auto startTime = std::chrono::steady_clock::now();
+                    auto chunk     = source->readStreamChunk(offset, std::min<u64>(StreamChunkSize, size - offset));
+                    source->addProcessingTime(std::chrono::nanoseconds(std::chrono::steady_clock::now() - startTime).count());
+                    source->addProcessedBytes(chunk.size());
+
+                    for (auto &stage : stages) {
+                        startTime = std::chrono::steady_clock::now();
+
+                        if (stage.table.has_value()) {
+                            for (auto &byte : chunk)
+                                byte = (*stage.table)[byte];
+                        } else {
+                            chunk = stage.node->processStreamChunk(std::move(chunk));
+                        }
+
+                        // A fused run of elementwise stages is booked on its first node
+                        stage.node->addProcessingTime(std::chrono::nanoseconds(std::chrono::steady_clock::now() - startTime).count());
+                        stage.node->addProcessedBytes(chunk.size());
+                    }
+
+                    const auto chunkSize = chunk.size();
+
+                    startTime = std::chrono::steady_clock::now();
+                    chain.back()->writeStreamChunk(std::move(chunk));
+                    chain.back()->addProcessingTime(std::chrono::nanoseconds(std::chrono::steady_clock::now() - startTime).count());
+                    chain.back()->addProcessedBytes(chunkSize);
+                }
+
+                for (auto node : chain) {
+                    node->finishStream();
+                    node->markClean();
+                }
+
+                processedNodes += chain.size();
             }
         } catch (dp::Node::NodeError &e) {
             data.currNodeError = e;
 
-            for (auto overlay : data.dataOverlays)
-                ImHexApi::Provider::get()->deleteOverlay(overlay);
-            data.dataOverlays.clear();
+            // Overlays belong to the provider and are handled on the main thread
+            // everywhere else, so releasing them is deferred there as well
+            TaskManager::doLater([&data] {
+                for (auto overlay : data.dataOverlays)
+                    ImHexApi::Provider::get()->deleteOverlay(overlay);
+                data.dataOverlays.clear();
+            });
 
         } catch (std::runtime_error &e) {
             printf("Node implementation bug! %s\n", e.what());
@@ -297,15 +675,50 @@ namespace hex::plugin::builtin {
                 }
             }
 
+            {
+                int nodeId;
+                if (this->m_showProfiler && ImNodes::IsNodeHovered(&nodeId)) {
+                    for (const auto &node : data.nodes) {
+                        if (node->getId() != nodeId || node->getProcessingTime() == 0)
+                            continue;
+
+                        const auto seconds = node->getProcessingTime() / 1e9;
+
+                        ImGui::BeginTooltip();
+                        ImGui::TextUnformatted(LangEntry(node->getUnlocalizedTitle()));
+                        ImGui::Separator();
+                        ImGui::TextFormatted("{}: {:.3f} ms", "hex.builtin.view.data_processor.profiler.time"_lang, node->getProcessingTime() / 1e6);
+                        ImGui::TextFormatted("{}: {}", "hex.builtin.view.data_processor.profiler.bytes"_lang, hex::toByteString(node->getProcessedBytes()));
+                        ImGui::TextFormatted("{}: {}/s", "hex.builtin.view.data_processor.profiler.throughput"_lang, hex::toByteString(u64(node->getProcessedBytes() / seconds)));
+                        ImGui::EndTooltip();
+                    }
+                }
+            }
+
             if (ImGui::BeginChild("##node_editor", ImGui::GetContentRegionAvail() - ImVec2(0, ImGui::GetTextLineHeightWithSpacing() * 1.3))) {
                 ImNodes::BeginNodeEditor();
 
+                // With the profiler enabled node headers are heat colored relative
+                // to the most expensive node of the last run
+                u64 maxProcessingTime = 0;
+                if (this->m_showProfiler) {
+                    for (const auto &node : data.nodes)
+                        maxProcessingTime = std::max(maxProcessingTime, node->getProcessingTime());
+                }
+
                 for (auto &node : data.nodes) {
                     const bool hasError = data.currNodeError.has_value() && data.currNodeError->node == node.get();
 
                     if (hasError)
                         ImNodes::PushColorStyle(ImNodesCol_NodeOutline, 0xFF0000FF);
 
+                    const bool heatColored = this->m_showProfiler && maxProcessingTime > 0 && node->getProcessingTime() > 0;
+                    if (heatColored) {
+                        // The hue runs from green for cheap nodes to red for the bottleneck
+                        const float fraction = float(node->getProcessingTime()) / float(maxProcessingTime);
+                        ImNodes::PushColorStyle(ImNodesCol_TitleBar, ImColor::HSV(0.33F * (1.0F - fraction), 0.8F, 0.5F));
+                    }
+
                     int nodeId = node->getId();
                     if (!this->m_justSwitchedProvider)
                         node->setPosition(ImNodes::GetNodeGridSpacePos(nodeId));
@@ -318,7 +731,16 @@ namespace hex::plugin::builtin {
                     ImGui::TextUnformatted(LangEntry(node->getUnlocalizedTitle()));
                     ImNodes::EndNodeTitleBar();
 
+                    // The group makes the node's widgets act as one item, so a tweak
+                    // of any parameter invalidates the node's cached outputs
+                    ImGui::BeginGroup();
                     node->drawNode();
+                    ImGui::EndGroup();
+
+                    if (ImGui::IsItemEdited()) {
+                        this->stopEvaluation();
+                        node->markDirty();
+                    }
 
                     for (auto &attribute : node->getAttributes()) {
                         ImNodesPinShape pinShape;
@@ -351,6 +773,9 @@ namespace hex::plugin::builtin {
 
                     ImNodes::SetNodeGridSpacePos(nodeId, node->getPosition());
 
+                    if (heatColored)
+                        ImNodes::PopColorStyle();
+
                     if (hasError)
                         ImNodes::PopColorStyle();
                 }
@@ -367,11 +792,22 @@ namespace hex::plugin::builtin {
             }
             ImGui::EndChild();
 
-            if (ImGui::IconButton(ICON_VS_DEBUG_START, ImGui::GetCustomColorVec4(ImGuiCustomCol_ToolbarGreen)) || this->m_continuousEvaluation)
+            if (ImGui::IconButton(ICON_VS_DEBUG_START, ImGui::GetCustomColorVec4(ImGuiCustomCol_ToolbarGreen))) {
+                this->stopEvaluation();
+
+                // An explicit run request recomputes everything from scratch
+                for (auto &node : data.nodes)
+                    node->markDirty();
+
                 this->processNodes();
+            } else if (this->m_continuousEvaluation || this->m_restartEvaluation) {
+                this->processNodes();
+            }
 
             ImGui::SameLine();
             ImGui::Checkbox("Continuous evaluation", &this->m_continuousEvaluation);
+            ImGui::SameLine();
+            ImGui::Checkbox("Profiler", &this->m_showProfiler);
 
             {
                 int linkId;
@@ -407,10 +843,19 @@ namespace hex::plugin::builtin {
                         if (!toAttr->getConnectedAttributes().empty())
                             break;
 
+                        this->stopEvaluation();
+
                         auto newLink = data.links.emplace_back(from, to);
 
                         fromAttr->addConnectedAttribute(newLink.getId(), toAttr);
                         toAttr->addConnectedAttribute(newLink.getId(), fromAttr);
+
+                        // The node on the input end of the new link computes
+                        // something different from now on
+                        if (toAttr->getIOType() == dp::Attribute::IOType::In)
+                            toAttr->getParentNode()->markDirty();
+                        else
+                            fromAttr->getParentNode()->markDirty();
                     } while (false);
                 }
             }
@@ -442,9 +887,71 @@ namespace hex::plugin::builtin {
             this->m_justSwitchedProvider = false;
         }
         ImGui::End();
+
+        if (this->m_showProfiler) {
+            if (ImGui::Begin(View::toWindowName("hex.builtin.view.data_processor.profiler").c_str(), &this->m_showProfiler, ImGuiWindowFlags_NoCollapse)) {
+                if (ImGui::BeginTable("##profile", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY)) {
+                    ImGui::TableSetupScrollFreeze(0, 1);
+                    ImGui::TableSetupColumn("hex.builtin.view.data_processor.profiler.node"_lang);
+                    ImGui::TableSetupColumn("hex.builtin.view.data_processor.profiler.time"_lang);
+                    ImGui::TableSetupColumn("hex.builtin.view.data_processor.profiler.bytes"_lang);
+                    ImGui::TableSetupColumn("hex.builtin.view.data_processor.profiler.throughput"_lang);
+                    ImGui::TableHeadersRow();
+
+                    // The most expensive node of the last run comes first
+                    std::vector<dp::Node *> profiledNodes;
+                    for (const auto &node : data.nodes) {
+                        if (node->getProcessingTime() > 0)
+                            profiledNodes.push_back(node.get());
+                    }
+                    std::sort(profiledNodes.begin(), profiledNodes.end(), [](const auto *lhs, const auto *rhs) { return lhs->getProcessingTime() > rhs->getProcessingTime(); });
+
+                    u64 totalTime = 0, totalBytes = 0;
+                    for (const auto node : profiledNodes) {
+                        totalTime  += node->getProcessingTime();
+                        totalBytes += node->getProcessedBytes();
+                    }
+
+                    for (const auto node : profiledNodes) {
+                        ImGui::TableNextRow();
+
+                        ImGui::TableNextColumn();
+                        ImGui::TextUnformatted(LangEntry(node->getUnlocalizedTitle()));
+
+                        ImGui::TableNextColumn();
+                        ImGui::TextFormatted("{:.3f} ms ({:.1f}%)", node->getProcessingTime() / 1e6, double(node->getProcessingTime()) * 100 / double(totalTime));
+
+                        ImGui::TableNextColumn();
+                        ImGui::TextFormatted("{}", hex::toByteString(node->getProcessedBytes()));
+
+                        ImGui::TableNextColumn();
+                        ImGui::TextFormatted("{}/s", hex::toByteString(u64(node->getProcessedBytes() / (node->getProcessingTime() / 1e9))));
+                    }
+
+                    if (!profiledNodes.empty()) {
+                        ImGui::TableNextRow();
+
+                        ImGui::TableNextColumn();
+                        ImGui::TextUnformatted("hex.builtin.view.data_processor.profiler.total"_lang);
+
+                        ImGui::TableNextColumn();
+                        ImGui::TextFormatted("{:.3f} ms", totalTime / 1e6);
+
+                        ImGui::TableNextColumn();
+                        ImGui::TextFormatted("{}", hex::toByteString(totalBytes));
+
+                        ImGui::TableNextColumn();
+                        ImGui::TextFormatted("{}/s", hex::toByteString(u64(totalBytes / (totalTime / 1e9))));
+                    }
+
+                    ImGui::EndTable();
+                }
+            }
+            ImGui::End();
+        }
     }
 
-    std::string ViewDataProcessor::saveNodes(prv::Provider *provider) {
+    nlohmann::json ViewDataProcessor::saveNodesJson(prv::Provider *provider) {
         auto &data = ProviderExtraData::get(provider).dataProcessor;
 
         using json = nlohmann::json;
@@ -485,17 +992,60 @@ namespace hex::plugin::builtin {
             currOutput["to"]   = link.getToId();
         }
 
+        return output;
+    }
+
+    // Raw binary blobs inside the tree have no text representation, so the JSON
+    // export turns them back into the plain byte arrays older files used
+    static void convertBinaryValuesToArrays(nlohmann::json &value) {
+        if (value.is_binary()) {
+            std::vector<u8> bytes = value.get_binary();
+            value = bytes;
+        } else if (value.is_object() || value.is_array()) {
+            for (auto &child : value)
+                convertBinaryValuesToArrays(child);
+        }
+    }
+
+    std::string ViewDataProcessor::saveNodes(prv::Provider *provider) {
+        auto output = this->saveNodesJson(provider);
+
+        convertBinaryValuesToArrays(output);
+
         return output.dump(4);
     }
 
+    // Projects store the graph in MessagePack: the same document tree serialized
+    // as length prefixed records with buffer constants as raw blobs, so graphs
+    // with large embedded buffers neither bloat the project file nor spend
+    // seconds in the text parser on load. The text format above stays around for
+    // export and interchange
+    std::vector<u8> ViewDataProcessor::saveNodesBinary(prv::Provider *provider) {
+        return nlohmann::json::to_msgpack(this->saveNodesJson(provider));
+    }
+
     void ViewDataProcessor::loadNodes(prv::Provider *provider, const std::string &jsonData) {
-        if (!ImHexApi::Provider::isValid()) return;
+        this->loadNodesJson(provider, nlohmann::json::parse(jsonData));
+    }
 
-        auto &data = ProviderExtraData::get(provider).dataProcessor;
+    void ViewDataProcessor::loadNodes(prv::Provider *provider, const std::vector<u8> &data) {
+        if (data.empty())
+            return;
 
-        using json = nlohmann::json;
+        // Projects written before the binary format as well as imported text
+        // exports still start with a JSON object
+        if (data.front() == '{')
+            this->loadNodesJson(provider, nlohmann::json::parse(data.begin(), data.end()));
+        else
+            this->loadNodesJson(provider, nlohmann::json::from_msgpack(data));
+    }
+
+    void ViewDataProcessor::loadNodesJson(prv::Provider *provider, nlohmann::json input) {
+        if (!ImHexApi::Provider::isValid()) return;
 
-        json input = json::parse(jsonData);
+        this->stopEvaluation();
+
+        auto &data = ProviderExtraData::get(provider).dataProcessor;
 
         u32 maxNodeId = 0;
         u32 maxAttrId = 0;
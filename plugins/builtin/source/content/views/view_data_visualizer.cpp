@@ -0,0 +1,334 @@
+#include "content/views/view_data_visualizer.hpp"
+
+#include <hex/providers/provider.hpp>
+#include <hex/providers/buffered_reader.hpp>
+
+#include <array>
+#include <cctype>
+#include <cstring>
+
+#include <implot.h>
+
+namespace hex::plugin::builtin {
+
+    using namespace hex::literals;
+
+    namespace {
+
+        // Side lengths of the generated textures. The digram is fixed by the value range,
+        // the byte map trades off detail against upload size; both are uploaded once per
+        // publish, not once per point, so the file size doesn't matter for drawing
+        constexpr static u32 DigramSize  = 256;
+        constexpr static u32 ByteMapSize = 512;
+
+        // How much data gets processed between two texture updates, so big files fade in
+        // instead of appearing only once the whole pass is done
+        constexpr static u64 PublishInterval = 64_MiB;
+
+        // Maps an index along the Hilbert curve onto its x/y position. Neighbouring file
+        // offsets end up in neighbouring pixels, which keeps structure recognizable at
+        // every zoom level
+        void hilbertIndexToPosition(u32 sideLength, u32 index, u32 &x, u32 &y) {
+            x = y = 0;
+
+            for (u32 side = 1; side < sideLength; side *= 2) {
+                const u32 rx = 1 & (index / 2);
+                const u32 ry = 1 & (index ^ rx);
+
+                if (ry == 0) {
+                    if (rx == 1) {
+                        x = side - 1 - x;
+                        y = side - 1 - y;
+                    }
+
+                    std::swap(x, y);
+                }
+
+                x += side * rx;
+                y += side * ry;
+                index /= 4;
+            }
+        }
+
+        // Inverse of hilbertIndexToPosition, used to map the hovered pixel back onto an address
+        u32 hilbertPositionToIndex(u32 sideLength, u32 x, u32 y) {
+            u32 index = 0;
+
+            for (u32 side = sideLength / 2; side > 0; side /= 2) {
+                const u32 rx = (x & side) > 0 ? 1 : 0;
+                const u32 ry = (y & side) > 0 ? 1 : 0;
+
+                index += side * side * ((3 * rx) ^ ry);
+
+                if (ry == 0) {
+                    if (rx == 1) {
+                        x = sideLength - 1 - x;
+                        y = sideLength - 1 - y;
+                    }
+
+                    std::swap(x, y);
+                }
+            }
+
+            return index;
+        }
+
+        // Byte classes and their colors in the byte map, loosely following the usual
+        // binary visualization conventions: black for zeros, white for 0xFF, blue for
+        // printable characters and orange for everything else
+        enum ByteClass : u8 {
+            ByteClassZero      = 0,
+            ByteClassPrintable = 1,
+            ByteClassHigh      = 2,
+            ByteClassOther     = 3
+        };
+
+        constexpr static std::array<std::array<u8, 3>, 4> ByteClassColors = {
+            {
+                { 0x10, 0x10, 0x10 },
+                { 0x4A, 0x8C, 0xE8 },
+                { 0xE8, 0xE8, 0xE8 },
+                { 0xE8, 0x68, 0x3C }
+            }
+        };
+
+        ByteClass getByteClass(u8 byte) {
+            if (byte == 0x00)
+                return ByteClassZero;
+            else if (byte == 0xFF)
+                return ByteClassHigh;
+            else if (std::isprint(byte) || std::isspace(byte))
+                return ByteClassPrintable;
+            else
+                return ByteClassOther;
+        }
+
+    }
+
+    ViewDataVisualizer::ViewDataVisualizer() : View("hex.builtin.view.data_visualizer.name") {
+        EventManager::subscribe<EventProviderChanged>(this, [this](const auto *, const auto *) {
+            std::scoped_lock lock(this->m_pixelMutex);
+
+            this->m_texture       = {};
+            this->m_pixelBuffer.clear();
+            this->m_pixelRevision = 0;
+            this->m_uploadedRevision = 0;
+        });
+    }
+
+    ViewDataVisualizer::~ViewDataVisualizer() {
+        EventManager::unsubscribe<EventProviderChanged>(this);
+    }
+
+    void ViewDataVisualizer::visualize() {
+        const auto mode = Mode(this->m_mode);
+
+        this->m_visualizerTask = TaskManager::createTask("hex.builtin.view.data_visualizer.visualizing", 0, [this, mode](auto &task) {
+            auto provider = ImHexApi::Provider::get();
+
+            const auto baseAddress = provider->getBaseAddress();
+            const auto dataSize    = provider->getActualSize();
+            task.setMaxValue(dataSize);
+
+            const u32 textureSize = mode == Mode::Digram ? DigramSize : ByteMapSize;
+            const u64 pixelCount  = u64(textureSize) * textureSize;
+            const u64 bytesPerPixel = std::max<u64>(1, (dataSize + pixelCount - 1) / pixelCount);
+
+            // Counters accumulated while streaming over the data. The digram counts
+            // consecutive byte pairs, the byte map counts byte classes per pixel
+            std::vector<u32> digramCounts;
+            std::vector<std::array<u32, 4>> classCounts;
+            std::vector<u32> pixelPositions;
+
+            if (mode == Mode::Digram) {
+                digramCounts.resize(pixelCount, 0x00);
+            } else {
+                classCounts.resize(pixelCount, { 0 });
+
+                // The curve walk per pixel is only computed once up front
+                pixelPositions.resize(pixelCount);
+                for (u64 pixel = 0; pixel < pixelCount; pixel++) {
+                    u32 x = 0, y = 0;
+                    hilbertIndexToPosition(textureSize, u32(pixel), x, y);
+                    pixelPositions[pixel] = y * textureSize + x;
+                }
+            }
+
+            // Converts the counters accumulated so far into pixels and hands them to the
+            // GUI thread, which re-uploads the texture the next time it draws
+            const auto publish = [&] {
+                std::vector<u8> pixels(pixelCount * 4, 0x00);
+
+                if (mode == Mode::Digram) {
+                    u32 maxCount = 1;
+                    for (const auto count : digramCounts)
+                        maxCount = std::max(maxCount, count);
+
+                    // Pair counts span many orders of magnitude, linear brightness would
+                    // leave everything but the hottest pairs invisible
+                    const float scale = 255.0F / std::log1p(float(maxCount));
+                    for (u64 pixel = 0; pixel < pixelCount; pixel++) {
+                        const u8 brightness = u8(std::log1p(float(digramCounts[pixel])) * scale);
+
+                        pixels[pixel * 4 + 0] = brightness;
+                        pixels[pixel * 4 + 1] = brightness;
+                        pixels[pixel * 4 + 2] = brightness;
+                        pixels[pixel * 4 + 3] = 0xFF;
+                    }
+                } else {
+                    for (u64 pixel = 0; pixel < pixelCount; pixel++) {
+                        const auto &counts = classCounts[pixel];
+                        const u64 total    = u64(counts[0]) + counts[1] + counts[2] + counts[3];
+                        const u64 position = pixelPositions[pixel];
+
+                        if (total == 0) {
+                            pixels[position * 4 + 3] = 0xFF;
+                            continue;
+                        }
+
+                        // Pixels covering multiple classes blend their colors by share
+                        for (u32 channel = 0; channel < 3; channel++) {
+                            u64 value = 0;
+                            for (u32 byteClass = 0; byteClass < 4; byteClass++)
+                                value += u64(ByteClassColors[byteClass][channel]) * counts[byteClass];
+
+                            pixels[position * 4 + channel] = u8(value / total);
+                        }
+                        pixels[position * 4 + 3] = 0xFF;
+                    }
+                }
+
+                std::scoped_lock lock(this->m_pixelMutex);
+
+                this->m_pixelBuffer   = std::move(pixels);
+                this->m_textureSize   = textureSize;
+                this->m_bytesPerPixel = bytesPerPixel;
+                this->m_renderedMode  = mode;
+                this->m_pixelRevision += 1;
+            };
+
+            auto reader = prv::BufferedReader(provider);
+            reader.seek(baseAddress);
+            reader.setEndAddress(baseAddress + dataSize - 1);
+
+            u64 previousByte     = 0;
+            bool hasPreviousByte = false;
+            u64 nextPublish      = PublishInterval;
+
+            for (const auto &chunk : reader.chunks(1_MiB)) {
+                if (mode == Mode::Digram) {
+                    for (const u8 byte : chunk.data) {
+                        if (hasPreviousByte)
+                            digramCounts[previousByte * 256 + byte]++;
+
+                        previousByte    = byte;
+                        hasPreviousByte = true;
+                    }
+                } else {
+                    u64 offset = chunk.address - baseAddress;
+                    for (const u8 byte : chunk.data) {
+                        classCounts[offset / bytesPerPixel][getByteClass(byte)]++;
+                        offset++;
+                    }
+                }
+
+                const u64 processed = (chunk.address - baseAddress) + chunk.data.size();
+                if (processed >= nextPublish) {
+                    publish();
+                    nextPublish += PublishInterval;
+                }
+
+                task.update(processed);
+            }
+
+            publish();
+        });
+    }
+
+    void ViewDataVisualizer::drawContent() {
+        if (ImGui::Begin(View::toWindowName("hex.builtin.view.data_visualizer.name").c_str(), &this->getWindowOpenState(), ImGuiWindowFlags_NoCollapse)) {
+            auto provider = ImHexApi::Provider::get();
+            if (ImHexApi::Provider::isValid() && provider->isReadable()) {
+
+                ImGui::BeginDisabled(this->m_visualizerTask.isRunning());
+                {
+                    constexpr static std::array ModeNames = {
+                        "hex.builtin.view.data_visualizer.mode.digram",
+                        "hex.builtin.view.data_visualizer.mode.byte_map"
+                    };
+
+                    if (ImGui::BeginCombo("hex.builtin.view.data_visualizer.mode"_lang, LangEntry(ModeNames[this->m_mode]))) {
+                        for (int mode = 0; mode < int(ModeNames.size()); mode++) {
+                            if (ImGui::Selectable(LangEntry(ModeNames[mode]), this->m_mode == mode))
+                                this->m_mode = mode;
+                        }
+
+                        ImGui::EndCombo();
+                    }
+
+                    if (ImGui::Button("hex.builtin.view.data_visualizer.visualize"_lang, ImVec2(ImGui::GetContentRegionAvail().x, 0)))
+                        this->visualize();
+                }
+                ImGui::EndDisabled();
+
+                if (this->m_visualizerTask.isRunning())
+                    ImGui::TextSpinner("hex.builtin.view.data_visualizer.visualizing"_lang);
+                else
+                    ImGui::NewLine();
+
+                // A new revision of the pixel buffer replaces the texture. This is the only
+                // place the texture gets touched, so all GL work stays on the GUI thread
+                if (this->m_pixelRevision.load() != this->m_uploadedRevision) {
+                    std::scoped_lock lock(this->m_pixelMutex);
+
+                    if (!this->m_pixelBuffer.empty()) {
+                        this->m_texture = ImGui::Texture(this->m_pixelBuffer.data(), this->m_pixelBuffer.size(), this->m_textureSize, this->m_textureSize);
+                        this->m_uploadedRevision = this->m_pixelRevision;
+                    }
+                }
+
+                // The visualization is one textured quad, so panning and zooming never
+                // replays any points no matter how big the file is
+                if (this->m_texture.isValid()) {
+                    if (ImPlot::BeginPlot("##visualization", ImVec2(-1, -1), ImPlotFlags_NoChild | ImPlotFlags_CanvasOnly | ImPlotFlags_Equal)) {
+                        ImPlot::SetupAxes(nullptr, nullptr, ImPlotAxisFlags_NoDecorations, ImPlotAxisFlags_NoDecorations);
+                        ImPlot::SetupAxesLimits(0, this->m_textureSize, 0, this->m_textureSize, ImGuiCond_Once);
+
+                        ImPlot::PlotImage("##texture", this->m_texture, ImPlotPoint(0, 0), ImPlotPoint(this->m_textureSize, this->m_textureSize));
+
+                        if (ImPlot::IsPlotHovered()) {
+                            const auto mousePos = ImPlot::GetPlotMousePos();
+
+                            if (mousePos.x >= 0 && mousePos.y >= 0 && mousePos.x < this->m_textureSize && mousePos.y < this->m_textureSize) {
+                                // Texture rows start at the top, plot coordinates at the bottom
+                                const u32 pixelX = u32(mousePos.x);
+                                const u32 pixelY = (this->m_textureSize - 1) - u32(mousePos.y);
+
+                                if (this->m_renderedMode == Mode::Digram) {
+                                    ImGui::SetTooltip("0x%02X 0x%02X", pixelY, pixelX);
+                                } else if (this->m_bytesPerPixel > 0) {
+                                    const u64 pixelIndex   = hilbertPositionToIndex(this->m_textureSize, pixelX, pixelY);
+                                    const u64 startAddress = provider->getBaseAddress() + pixelIndex * this->m_bytesPerPixel;
+                                    const u64 dataEnd      = provider->getBaseAddress() + provider->getActualSize();
+
+                                    if (startAddress < dataEnd) {
+                                        const u64 endAddress = std::min(startAddress + this->m_bytesPerPixel, dataEnd) - 1;
+
+                                        ImGui::SetTooltip("0x%llX - 0x%llX", static_cast<unsigned long long>(startAddress), static_cast<unsigned long long>(endAddress));
+
+                                        if (ImGui::IsMouseClicked(ImGuiMouseButton_Left))
+                                            ImHexApi::HexEditor::setSelection(startAddress, (endAddress - startAddress) + 1);
+                                    }
+                                }
+                            }
+                        }
+
+                        ImPlot::EndPlot();
+                    }
+                }
+            }
+        }
+        ImGui::End();
+    }
+
+}
@@ -1,15 +1,227 @@
 #include "content/views/view_diff.hpp"
 
 #include <hex/api/imhex_api.hpp>
+#include <hex/api/project_file_manager.hpp>
 #include <hex/providers/provider.hpp>
 
 #include <hex/helpers/fmt.hpp>
+#include <hex/helpers/literals.hpp>
 
 #include <hex/api/content_registry.hpp>
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <thread>
+
 namespace hex::plugin::builtin {
 
+    using namespace hex::literals;
+
+    constexpr static u32 DiffCacheVersion = 1;
+
+    namespace {
+
+        // Gear table of the content defined chunker, filled from a splitmix64 stream so
+        // chunk boundaries depend only on the bytes themselves. An insertion therefore
+        // only moves the boundaries of the chunks it touches and everything behind it
+        // re-anchors at identical chunk digests
+        constexpr auto GearTable = [] {
+            std::array<u64, 0x100> table = { };
+
+            u64 state = 0x9E37'79B9'7F4A'7C15;
+            for (auto &entry : table) {
+                u64 value = (state += 0x9E37'79B9'7F4A'7C15);
+                value = (value ^ (value >> 30)) * 0xBF58'476D'1CE4'E5B9;
+                value = (value ^ (value >> 27)) * 0x94D0'49BB'1331'11EB;
+                entry = value ^ (value >> 31);
+            }
+
+            return table;
+        }();
+
+        constexpr u64 ChunkBoundaryMask = 0x0FFF;   // 4 KiB chunks on average
+        constexpr u64 MinChunkSize      = 0x100;
+        constexpr u64 MaxChunkSize      = 0x1'0000;
+
+        constexpr u64 ResyncWindow      = 0x200;    // Chunks scanned to find a new anchor behind a difference
+        constexpr u64 MyersLimit        = 0x1000;   // Largest gap that is refined byte by byte
+        constexpr u64 MaxEditDistance   = 0x200;    // Largest edit script the refinement searches for
+
+        struct Chunk {
+            u64 offset;
+            u64 size;
+            u64 digest;
+        };
+
+        std::vector<Chunk> chunkRange(prv::Provider *provider, u64 start, u64 end, std::atomic<u64> &progress, const std::atomic<bool> &cancelled) {
+            constexpr static u64 FnvOffsetBasis = 0xCBF2'9CE4'8422'2325;
+            constexpr static u64 FnvPrime       = 0x0000'0100'0000'01B3;
+
+            std::vector<Chunk> chunks;
+            std::vector<u8> buffer(8_MiB);
+
+            u64 gearHash   = 0x00;
+            u64 digest     = FnvOffsetBasis;
+            u64 chunkStart = start;
+
+            for (u64 offset = start; offset < end && !cancelled; ) {
+                const size_t blockSize = std::min<u64>(buffer.size(), end - offset);
+                provider->read(offset, buffer.data(), blockSize);
+
+                for (size_t index = 0; index < blockSize; index++) {
+                    const u8 byte = buffer[index];
+
+                    gearHash = (gearHash << 1) + GearTable[byte];
+                    digest   = (digest ^ byte) * FnvPrime;
+
+                    const u64 chunkSize = (offset + index + 1) - chunkStart;
+                    if ((chunkSize >= MinChunkSize && (gearHash & ChunkBoundaryMask) == 0x00) || chunkSize >= MaxChunkSize) {
+                        chunks.push_back({ chunkStart, chunkSize, digest ^ chunkSize });
+
+                        chunkStart = offset + index + 1;
+                        gearHash   = 0x00;
+                        digest     = FnvOffsetBasis;
+                    }
+                }
+
+                offset   += blockSize;
+                progress += blockSize;
+            }
+
+            if (chunkStart < end)
+                chunks.push_back({ chunkStart, end - chunkStart, digest ^ (end - chunkStart) });
+
+            return chunks;
+        }
+
+        // Chunking is embarrassingly parallel: the provider is cut into one slice per
+        // hardware thread and each slice is hashed independently. The gear hash only
+        // looks 64 bytes back, so slice-local boundaries match the sequential ones
+        // everywhere except right at a seam, and seam chunks that fail to pair up are
+        // resolved by the byte-level gap refinement like any other difference
+        std::vector<Chunk> chunkProvider(prv::Provider *provider, Task &task, u64 progressBase) {
+            constexpr static u64 MinSliceSize = 64_MiB;
+
+            const u64 providerSize = provider->getActualSize();
+
+            u32 threadCount = std::thread::hardware_concurrency();
+            threadCount = std::max<u32>(1, std::min<u64>(threadCount, providerSize / MinSliceSize));
+
+            const u64 sliceSize = providerSize / threadCount;
+
+            std::atomic<u64> progress   = 0;
+            std::atomic<bool> cancelled = false;
+            std::atomic<u32> active     = threadCount;
+
+            std::vector<std::vector<Chunk>> slices(threadCount);
+            {
+                std::vector<std::jthread> workers;
+                for (u32 i = 0; i < threadCount; i++) {
+                    const u64 start = i * sliceSize;
+                    const u64 end   = i == threadCount - 1 ? providerSize : start + sliceSize;
+
+                    workers.emplace_back([&, i, start, end] {
+                        slices[i] = chunkRange(provider, start, end, progress, cancelled);
+                        active--;
+                    });
+                }
+
+                // Forward progress and cancellation while the slices are being hashed
+                while (active > 0) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+                    try {
+                        task.update(progressBase + progress);
+                    } catch (...) {
+                        cancelled = true;
+                        throw;
+                    }
+                }
+            }
+
+            std::vector<Chunk> chunks;
+            for (auto &slice : slices)
+                std::move(slice.begin(), slice.end(), std::back_inserter(chunks));
+
+            return chunks;
+        }
+
+        // Greedy Myers diff over two small byte ranges. Returns the edit script as one
+        // entry per byte (0 = match, 1 = only in a, 2 = only in b), or nothing when the
+        // ranges are further than maxDistance edits apart
+        std::optional<std::vector<u8>> myersDiff(std::span<const u8> a, std::span<const u8> b, u64 maxDistance) {
+            const i64 lengthA = a.size(), lengthB = b.size();
+            const i64 max = std::min<i64>(lengthA + lengthB, maxDistance);
+
+            std::vector<i64> frontier(2 * max + 3, 0);
+            const auto V = [&](i64 k) -> i64& { return frontier[k + max + 1]; };
+
+            std::vector<std::vector<i64>> trace;
+
+            i64 distance = 0;
+            bool found = false;
+            for (; distance <= max && !found; distance++) {
+                trace.push_back(frontier);
+
+                for (i64 k = -distance; k <= distance; k += 2) {
+                    i64 x;
+                    if (k == -distance || (k != distance && V(k - 1) < V(k + 1)))
+                        x = V(k + 1);
+                    else
+                        x = V(k - 1) + 1;
+
+                    i64 y = x - k;
+                    while (x < lengthA && y < lengthB && a[x] == b[y]) { x++; y++; }
+                    V(k) = x;
+
+                    if (x >= lengthA && y >= lengthB) {
+                        found = true;
+                        break;
+                    }
+                }
+            }
+
+            if (!found)
+                return std::nullopt;
+            distance--;
+
+            // Walk the trace backwards to recover which byte went where
+            std::vector<u8> ops;
+            i64 x = lengthA, y = lengthB;
+            for (; distance > 0; distance--) {
+                const auto &previous = trace[distance];
+                const auto P = [&](i64 k) -> i64 { return previous[k + max + 1]; };
+
+                const i64 k = x - y;
+
+                i64 previousK;
+                if (k == -distance || (k != distance && P(k - 1) < P(k + 1)))
+                    previousK = k + 1;
+                else
+                    previousK = k - 1;
+
+                const i64 previousX = P(previousK);
+                const i64 previousY = previousX - previousK;
+
+                while (x > previousX && y > previousY) { ops.push_back(0); x--; y--; }
+
+                if (previousK == k + 1) { ops.push_back(2); y--; }
+                else                    { ops.push_back(1); x--; }
+            }
+            while (x > 0 && y > 0) { ops.push_back(0); x--; y--; }
+
+            std::reverse(ops.begin(), ops.end());
+            return ops;
+        }
+
+    }
+
     ViewDiff::ViewDiff() : View("hex.builtin.view.diff.name") {
 
         EventManager::subscribe<EventSettingsChanged>(this, [this] {
@@ -33,21 +245,144 @@ namespace hex::plugin::builtin {
                 if (upperCaseHex.is_number())
                     this->m_upperCaseHex = static_cast<int>(upperCaseHex);
             }
+
+            this->m_lineCache.clear();
         });
 
         EventManager::subscribe<EventProviderClosed>(this, [this](prv::Provider *) {
             this->m_providerA = -1;
             this->m_providerB = -1;
+
+            this->m_diffTask.interrupt();
+            this->m_diffSegments.clear();
+            this->m_lineCache.clear();
+            this->m_diffDisplaySize = 0;
+            this->m_shouldReanalyze = true;
+        });
+
+        EventManager::subscribe<EventRegionDirtied>(this, [this](prv::Provider *, const Region &) {
+            this->m_lineCache.clear();
+            this->m_shouldReanalyze = true;
+        });
+
+        // The alignment map is persisted with the project, stored under the left-hand
+        // provider and keyed by the content fingerprints of both sides, so re-opening a
+        // diff session doesn't re-run the whole comparison unless a file changed
+        ProjectFile::registerPerProviderHandler({
+            .basePath = "diff_cache.bin",
+            .required = false,
+            .load = [this](prv::Provider *provider, const std::fs::path &basePath, Tar &tar) -> bool {
+                if (!tar.contains(basePath))
+                    return true;
+
+                const auto data = tar.read(basePath);
+                if (data.empty())
+                    return true;
+
+                size_t offset = 0;
+                auto read = [&](void *dest, size_t size) {
+                    if (offset + size > data.size())
+                        throw std::runtime_error("Diff cache is truncated");
+                    std::memcpy(dest, data.data() + offset, size);
+                    offset += size;
+                };
+                auto readU8  = [&] { u8 value  = 0; read(&value, sizeof(value)); return value; };
+                auto readU32 = [&] { u32 value = 0; read(&value, sizeof(value)); return value; };
+                auto readU64 = [&] { u64 value = 0; read(&value, sizeof(value)); return value; };
+
+                if (readU32() != DiffCacheVersion)
+                    return true;
+
+                // Cached results are discarded when either side's data changed
+                if (readU64() != provider->getContentFingerprint())
+                    return true;
+
+                const u64 fingerprintB = readU64();
+
+                auto &providers = ImHexApi::Provider::getProviders();
+                int providerA = -1, providerB = -1;
+                for (size_t i = 0; i < providers.size(); i++) {
+                    if (providers[i] == provider)
+                        providerA = i;
+                    else if (providerB < 0 && providers[i]->getContentFingerprint() == fingerprintB)
+                        providerB = i;
+                }
+
+                if (providerA < 0 || providerB < 0)
+                    return true;
+
+                std::vector<DiffSegment> segments(readU64());
+                for (auto &segment : segments) {
+                    segment.addressA     = readU64();
+                    segment.addressB     = readU64();
+                    segment.sizeA        = readU64();
+                    segment.sizeB        = readU64();
+                    segment.displayStart = readU64();
+                    segment.type         = static_cast<DiffSegment::Type>(readU8());
+                }
+
+                this->m_providerA    = providerA;
+                this->m_providerB    = providerB;
+                this->m_diffSegments = std::move(segments);
+                this->m_lineCache.clear();
+
+                if (this->m_diffSegments.empty())
+                    this->m_diffDisplaySize = 0;
+                else
+                    this->m_diffDisplaySize = this->m_diffSegments.back().displayStart + this->m_diffSegments.back().getDisplaySize();
+
+                this->m_shouldReanalyze = false;
+
+                return true;
+            },
+            .store = [this](prv::Provider *provider, const std::fs::path &basePath, Tar &tar) -> bool {
+                auto &providers = ImHexApi::Provider::getProviders();
+
+                // Only the left-hand provider of a completed comparison carries the cache
+                if (this->m_providerA < 0 || this->m_providerB < 0 || this->m_diffSegments.empty() || this->m_diffTask.isRunning())
+                    return true;
+                if (size_t(this->m_providerA) >= providers.size() || providers[this->m_providerA] != provider)
+                    return true;
+
+                std::vector<u8> data;
+                auto write = [&data](const void *src, size_t size) {
+                    const auto bytes = reinterpret_cast<const u8 *>(src);
+                    data.insert(data.end(), bytes, bytes + size);
+                };
+                auto writeU8  = [&write](u8 value)  { write(&value, sizeof(value)); };
+                auto writeU32 = [&write](u32 value) { write(&value, sizeof(value)); };
+                auto writeU64 = [&write](u64 value) { write(&value, sizeof(value)); };
+
+                writeU32(DiffCacheVersion);
+                writeU64(provider->getContentFingerprint());
+                writeU64(providers[this->m_providerB]->getContentFingerprint());
+
+                writeU64(this->m_diffSegments.size());
+                for (const auto &segment : this->m_diffSegments) {
+                    writeU64(segment.addressA);
+                    writeU64(segment.addressB);
+                    writeU64(segment.sizeA);
+                    writeU64(segment.sizeB);
+                    writeU64(segment.displayStart);
+                    writeU8(u8(segment.type));
+                }
+
+                tar.write(basePath, data);
+
+                return true;
+            }
         });
     }
 
     ViewDiff::~ViewDiff() {
         EventManager::unsubscribe<EventSettingsChanged>(this);
         EventManager::unsubscribe<EventProviderClosed>(this);
+        EventManager::unsubscribe<EventRegionDirtied>(this);
     }
 
-    static void drawProviderSelector(int &provider) {
+    static bool drawProviderSelector(int &provider) {
         auto &providers = ImHexApi::Provider::getProviders();
+        bool changed = false;
 
         std::string preview;
         if (ImHexApi::Provider::isValid() && provider >= 0)
@@ -59,64 +394,250 @@ namespace hex::plugin::builtin {
             for (size_t i = 0; i < providers.size(); i++) {
                 if (ImGui::Selectable(providers[i]->getName().c_str())) {
                     provider = i;
+                    changed  = true;
                 }
             }
 
             ImGui::EndCombo();
         }
+
+        return changed;
     }
 
     static u32 getDiffColor(u32 color) {
         return (color & 0x00FFFFFF) | 0x40000000;
     }
 
-    enum class DiffResult {
-        Same,
-        Changed,
-        Added,
-        Removed
-    };
-    struct LineInfo {
-        std::vector<u8> bytes;
-        i64 validBytes = 0;
-    };
-
-    static DiffResult diffBytes(u8 index, const LineInfo &a, const LineInfo &b) {
-        /* Very simple binary diff. Only detects additions and changes */
-        if (a.validBytes > index) {
-            if (b.validBytes <= index)
-                return DiffResult::Added;
-            else if (a.bytes[index] != b.bytes[index])
-                return DiffResult::Changed;
+    void ViewDiff::analyze(prv::Provider *providerA, prv::Provider *providerB, Task &task) {
+        auto &segments = this->m_workSegments;
+        segments.clear();
+
+        // Append to the alignment map, merging runs of the same type so the map stays
+        // compact even when large regions differ
+        const auto append = [&segments](u64 addressA, u64 addressB, u64 sizeA, u64 sizeB, DiffSegment::Type type) {
+            if (sizeA == 0x00 && sizeB == 0x00)
+                return;
+
+            if (!segments.empty()) {
+                auto &last = segments.back();
+                if (last.type == type && last.addressA + last.sizeA == addressA && last.addressB + last.sizeB == addressB) {
+                    last.sizeA += sizeA;
+                    last.sizeB += sizeB;
+                    return;
+                }
+            }
+
+            u64 displayStart = 0x00;
+            if (!segments.empty())
+                displayStart = segments.back().displayStart + segments.back().getDisplaySize();
+
+            segments.push_back({ addressA, addressB, sizeA, sizeB, displayStart, type });
+        };
+
+        // Byte level refinement of the region between two anchors. Small gaps run
+        // through a Myers diff so a lone changed or inserted byte is reported exactly,
+        // anything bigger or wilder becomes one coarse difference
+        const auto refineGap = [&](u64 addressA, u64 sizeA, u64 addressB, u64 sizeB) {
+            if (sizeA == 0x00 || sizeB == 0x00) {
+                append(addressA, addressB, sizeA, 0x00, DiffSegment::Type::OnlyA);
+                append(addressA + sizeA, addressB, 0x00, sizeB, DiffSegment::Type::OnlyB);
+                return;
+            }
+
+            std::optional<std::vector<u8>> ops;
+            if (sizeA <= MyersLimit && sizeB <= MyersLimit) {
+                std::vector<u8> bytesA(sizeA), bytesB(sizeB);
+                providerA->read(addressA, bytesA.data(), bytesA.size());
+                providerB->read(addressB, bytesB.data(), bytesB.size());
+
+                ops = myersDiff(bytesA, bytesB, MaxEditDistance);
+            }
+
+            if (!ops.has_value()) {
+                // Too large or too different for an exact script; pair up what overlaps
+                const u64 common = std::min(sizeA, sizeB);
+                append(addressA, addressB, common, common, DiffSegment::Type::Changed);
+                append(addressA + common, addressB + common, sizeA - common, 0x00, DiffSegment::Type::OnlyA);
+                append(addressA + sizeA, addressB + common, 0x00, sizeB - common, DiffSegment::Type::OnlyB);
+                return;
+            }
+
+            // Turn the edit script into segments, pairing a deletion that is directly
+            // followed by an insertion into a changed range
+            u64 posA = addressA, posB = addressB;
+            for (size_t index = 0; index < ops->size(); ) {
+                const u8 op = (*ops)[index];
+
+                u64 count = 0;
+                while (index < ops->size() && (*ops)[index] == op) { count++; index++; }
+
+                if (op == 0) {
+                    append(posA, posB, count, count, DiffSegment::Type::Match);
+                    posA += count;
+                    posB += count;
+                } else if (op == 1) {
+                    u64 inserted = 0;
+                    while (index + inserted < ops->size() && (*ops)[index + inserted] == 2)
+                        inserted++;
+                    index += inserted;
+
+                    const u64 common = std::min(count, inserted);
+                    append(posA, posB, common, common, DiffSegment::Type::Changed);
+                    append(posA + common, posB + common, count - common, 0x00, DiffSegment::Type::OnlyA);
+                    append(posA + count, posB + common, 0x00, inserted - common, DiffSegment::Type::OnlyB);
+
+                    posA += count;
+                    posB += inserted;
+                } else {
+                    append(posA, posB, 0x00, count, DiffSegment::Type::OnlyB);
+                    posB += count;
+                }
+            }
+        };
+
+        const u64 sizeA = providerA->getActualSize();
+        const u64 sizeB = providerB->getActualSize();
+        task.setMaxValue(sizeA + sizeB);
+
+        const auto chunksA = chunkProvider(providerA, task, 0x00);
+        const auto chunksB = chunkProvider(providerB, task, sizeA);
+
+        size_t indexA = 0, indexB = 0;
+        while (indexA < chunksA.size() && indexB < chunksB.size()) {
+            const auto &chunkA = chunksA[indexA];
+            const auto &chunkB = chunksB[indexB];
+
+            if (chunkA.digest == chunkB.digest && chunkA.size == chunkB.size) {
+                append(chunkA.offset, chunkB.offset, chunkA.size, chunkB.size, DiffSegment::Type::Match);
+                indexA++;
+                indexB++;
+                continue;
+            }
+
+            // The anchors diverged; scan an expanding window on both sides for the next
+            // pair of chunks with the same digest to re-synchronize behind the edit
+            size_t nextA = indexA + 1, nextB = indexB + 1;
+            bool resynced = false;
+            for (u64 distance = 1; distance <= ResyncWindow && !resynced; distance++) {
+                if (indexA + distance < chunksA.size()) {
+                    const auto &candidate = chunksA[indexA + distance];
+                    for (size_t offsetB = indexB; offsetB <= indexB + distance && offsetB < chunksB.size(); offsetB++) {
+                        if (candidate.digest == chunksB[offsetB].digest && candidate.size == chunksB[offsetB].size) {
+                            nextA = indexA + distance;
+                            nextB = offsetB;
+                            resynced = true;
+                            break;
+                        }
+                    }
+                }
+
+                if (!resynced && indexB + distance < chunksB.size()) {
+                    const auto &candidate = chunksB[indexB + distance];
+                    for (size_t offsetA = indexA; offsetA <= indexA + distance && offsetA < chunksA.size(); offsetA++) {
+                        if (candidate.digest == chunksA[offsetA].digest && candidate.size == chunksA[offsetA].size) {
+                            nextA = offsetA;
+                            nextB = indexB + distance;
+                            resynced = true;
+                            break;
+                        }
+                    }
+                }
+            }
+
+            const u64 gapEndA = nextA < chunksA.size() ? chunksA[nextA].offset : sizeA;
+            const u64 gapEndB = nextB < chunksB.size() ? chunksB[nextB].offset : sizeB;
+            refineGap(chunkA.offset, gapEndA - chunkA.offset, chunkB.offset, gapEndB - chunkB.offset);
+
+            indexA = nextA;
+            indexB = nextB;
+
+            task.update(sizeA + sizeB);
         }
 
-        return DiffResult::Same;
+        // Whatever is left on either side after the last shared anchor
+        const u64 tailA = indexA < chunksA.size() ? chunksA[indexA].offset : sizeA;
+        const u64 tailB = indexB < chunksB.size() ? chunksB[indexB].offset : sizeB;
+        refineGap(tailA, sizeA - tailA, tailB, sizeB - tailB);
     }
 
-    void ViewDiff::drawDiffLine(const std::array<int, 2> &providerIds, u64 row) const {
+    const ViewDiff::DiffLine &ViewDiff::getDiffLine(const std::array<int, 2> &providerIds, u64 row) {
+        // The cache is only allowed to grow so far before all entries are thrown away.
+        // Throwing everything away keeps lookups cheap without tracking usage order
+        constexpr static size_t MaxCachedLines = 0x400;
+        if (this->m_lineCache.size() > MaxCachedLines)
+            this->m_lineCache.clear();
 
-        std::array<LineInfo, 2> lineInfo;
+        if (auto cached = this->m_lineCache.find(row); cached != this->m_lineCache.end())
+            return cached->second;
+
+        auto &lines = this->m_lineCache[row];
+
+        const u64 displayStart = row * this->m_columnCount;
+
+        // Locate the first segment covering this row
+        auto segment = std::upper_bound(this->m_diffSegments.begin(), this->m_diffSegments.end(), displayStart,
+            [](u64 offset, const DiffSegment &entry) { return offset < entry.displayStart; });
+        if (segment != this->m_diffSegments.begin())
+            --segment;
+
+        auto &providers = ImHexApi::Provider::getProviders();
 
-        u8 addressDigitCount = 0;
         for (u8 i = 0; i < 2; i++) {
-            int id = providerIds[i];
-            if (id < 0) continue;
+            if (providerIds[i] < 0)
+                continue;
+
+            auto &provider = providers[providerIds[i]];
+
+            auto &line = lines[i];
+            line.resize(this->m_columnCount);
+
+            auto iter = segment;
+            for (u32 col = 0; col < this->m_columnCount; ) {
+                const u64 offset = displayStart + col;
 
-            auto &provider = ImHexApi::Provider::getProviders()[id];
+                while (iter != this->m_diffSegments.end() && offset >= iter->displayStart + iter->getDisplaySize())
+                    ++iter;
+                if (iter == this->m_diffSegments.end())
+                    break;
 
-            // Read one line of each provider
-            lineInfo[i].bytes.resize(this->m_columnCount);
-            provider->read(row * this->m_columnCount, lineInfo[i].bytes.data(), lineInfo[i].bytes.size());
-            lineInfo[i].validBytes = std::min<i64>(this->m_columnCount, provider->getSize() - row * this->m_columnCount);
+                const u64 local = offset - iter->displayStart;
+                const u64 size  = i == 0 ? iter->sizeA : iter->sizeB;
+                const u64 span  = std::min<u64>(this->m_columnCount - col, iter->getDisplaySize() - local);
 
-            // Calculate address width
-            u8 addressDigits = 0;
-            for (size_t n = provider->getSize() - 1; n > 0; n >>= 4)
-                addressDigits++;
+                if (local < size) {
+                    const u64 readSize = std::min<u64>(span, size - local);
 
-            addressDigitCount = std::max(addressDigits, addressDigitCount);
+                    std::vector<u8> buffer(readSize);
+                    provider->read((i == 0 ? iter->addressA : iter->addressB) + local, buffer.data(), buffer.size());
+
+                    for (u64 n = 0; n < readSize; n++)
+                        line[col + n] = { buffer[n], true, iter->type };
+                    for (u64 n = readSize; n < span; n++)
+                        line[col + n] = { 0x00, false, iter->type };
+                } else {
+                    for (u64 n = 0; n < span; n++)
+                        line[col + n] = { 0x00, false, iter->type };
+                }
+
+                col += span;
+            }
         }
 
+        return lines;
+    }
+
+    void ViewDiff::drawDiffLine(const std::array<int, 2> &providerIds, u64 row) {
+        if (this->m_diffSegments.empty())
+            return;
+
+        const auto &lines = this->getDiffLine(providerIds, row);
+
+        const u64 displayStart = row * this->m_columnCount;
+
+        u8 addressDigitCount = 0;
+        for (u64 n = this->m_diffDisplaySize - 1; n > 0; n >>= 4)
+            addressDigitCount++;
+
         ImDrawList *drawList = ImGui::GetWindowDrawList();
 
         auto glyphWidth           = ImGui::CalcTextSize("0").x + 1;
@@ -125,44 +646,55 @@ namespace hex::plugin::builtin {
         auto startY = ImGui::GetCursorPosY();
 
         ImGui::TableNextColumn();
-        ImGui::TextFormatted(this->m_upperCaseHex ? "{:0{}X}:" : "{:0{}x}:", row * this->m_columnCount, addressDigitCount);
+        ImGui::TextFormatted(this->m_upperCaseHex ? "{:0{}X}:" : "{:0{}x}:", displayStart, addressDigitCount);
         ImGui::SetCursorPosY(startY);
 
         const ImColor colorText     = ImGui::GetColorU32(ImGuiCol_Text);
         const ImColor colorDisabled = this->m_greyedOutZeros ? ImGui::GetColorU32(ImGuiCol_TextDisabled) : static_cast<u32>(colorText);
 
-
         for (i8 curr = 0; curr < 2; curr++) {
             ImGui::TableNextColumn();
-            auto other = !curr;
 
             bool hasLastHighlight = false;
             ImVec2 lastHighlightEnd = { };
 
-            for (i64 col = 0; col < lineInfo[curr].validBytes; col++) {
+            const auto &line = lines[curr];
+            if (line.size() < this->m_columnCount)
+                continue;
+
+            for (u32 col = 0; col < this->m_columnCount; col++) {
+                // Stop at the trailing part of the last row where neither side has bytes
+                if (!line[col].present && line[col].type == DiffSegment::Type::Match)
+                    break;
+
                 auto pos = ImGui::GetCursorScreenPos();
 
-                // Diff bytes
                 std::optional<u32> highlightColor;
-                switch (diffBytes(col, lineInfo[curr], lineInfo[other])) {
+                switch (line[col].type) {
                     default:
-                    case DiffResult::Same:
+                    case DiffSegment::Type::Match:
                         /* No highlight */
                         break;
-                    case DiffResult::Changed:
+                    case DiffSegment::Type::Changed:
                         highlightColor = getDiffColor(ImGui::GetCustomColorU32(ImGuiCustomCol_ToolbarYellow));
                         break;
-                    case DiffResult::Added:
-                        highlightColor = getDiffColor(ImGui::GetCustomColorU32(ImGuiCustomCol_ToolbarGreen));
-                        break;
-                    case DiffResult::Removed:
-                        highlightColor = getDiffColor(ImGui::GetCustomColorU32(ImGuiCustomCol_ToolbarRed));
+                    case DiffSegment::Type::OnlyA:
+                    case DiffSegment::Type::OnlyB:
+                        // Green on the side that has the bytes, red on the one missing them
+                        if (line[col].present)
+                            highlightColor = getDiffColor(ImGui::GetCustomColorU32(ImGuiCustomCol_ToolbarGreen));
+                        else
+                            highlightColor = getDiffColor(ImGui::GetCustomColorU32(ImGuiCustomCol_ToolbarRed));
                         break;
                 }
 
-                // Draw byte
-                u8 byte = lineInfo[curr].bytes[col];
-                ImGui::TextFormattedColored(byte == 0x00 ? colorDisabled : colorText, this->m_upperCaseHex ? "{:02X}" : "{:02x}", byte);
+                // Draw byte, or a gap where only the other provider has data
+                if (line[col].present) {
+                    u8 byte = line[col].byte;
+                    ImGui::TextFormattedColored(byte == 0x00 ? colorDisabled : colorText, this->m_upperCaseHex ? "{:02X}" : "{:02x}", byte);
+                } else {
+                    ImGui::TextUnformatted("  ");
+                }
                 ImGui::SameLine(0.0F, col % 8 == 7 ? glyphWidth * 1.5F : glyphWidth * 0.75F);
 
                 ImGui::SetCursorPosY(startY);
@@ -183,12 +715,33 @@ namespace hex::plugin::builtin {
         }
     }
 
+    void ViewDiff::prepare() {
+        if (this->m_diffSegments.empty() || this->m_providerA < 0 || this->m_providerB < 0)
+            return;
+
+        const u64 rowCount    = (this->m_diffDisplaySize / this->m_columnCount) + 1;
+        const u64 visibleRows = this->m_visibleRowEnd - this->m_visibleRowStart;
+
+        // One screenful of margin in both directions, so slow scrolling never
+        // has to read the providers on the render thread
+        const u64 first = this->m_visibleRowStart - std::min(this->m_visibleRowStart, visibleRows);
+        const u64 last  = std::min(rowCount, this->m_visibleRowEnd + visibleRows);
+
+        for (u64 row = first; row < last; row++)
+            this->getDiffLine({ this->m_providerA, this->m_providerB }, row);
+    }
+
+    bool ViewDiff::shouldPrepare() const {
+        return !this->m_diffSegments.empty();
+    }
+
     void ViewDiff::drawContent() {
         if (ImGui::Begin(View::toWindowName("hex.builtin.view.diff.name").c_str(), &this->getWindowOpenState(), ImGuiWindowFlags_NoCollapse)) {
 
             ImGui::SameLine();
             ImGui::PushID(1);
-            drawProviderSelector(this->m_providerA);
+            if (drawProviderSelector(this->m_providerA))
+                this->m_shouldReanalyze = true;
             ImGui::PopID();
             ImGui::SameLine();
             ImGui::Spacing();
@@ -198,10 +751,36 @@ namespace hex::plugin::builtin {
             ImGui::Spacing();
             ImGui::SameLine();
             ImGui::PushID(2);
-            drawProviderSelector(this->m_providerB);
+            if (drawProviderSelector(this->m_providerB))
+                this->m_shouldReanalyze = true;
             ImGui::PopID();
             ImGui::Separator();
 
+            if (this->m_providerA >= 0 && this->m_providerB >= 0 && this->m_shouldReanalyze && !this->m_diffTask.isRunning()) {
+                this->m_shouldReanalyze = false;
+                this->m_analysisValid   = false;
+
+                auto &providers = ImHexApi::Provider::getProviders();
+                auto providerA = providers[this->m_providerA];
+                auto providerB = providers[this->m_providerB];
+
+                this->m_diffTask = TaskManager::createTask("hex.builtin.view.diff.analyzing", TaskManager::NoProgress, [this, providerA, providerB](auto &task) {
+                    this->analyze(providerA, providerB, task);
+                    this->m_analysisValid = true;
+                });
+            }
+
+            if (this->m_analysisValid) {
+                this->m_analysisValid  = false;
+                this->m_diffSegments   = std::move(this->m_workSegments);
+                this->m_lineCache.clear();
+
+                if (this->m_diffSegments.empty())
+                    this->m_diffDisplaySize = 0;
+                else
+                    this->m_diffDisplaySize = this->m_diffSegments.back().displayStart + this->m_diffSegments.back().getDisplaySize();
+            }
+
             ImGui::PushStyleVar(ImGuiStyleVar_CellPadding, ImVec2(20, 0));
             if (ImGui::BeginTable("diff", 3, ImGuiTableFlags_ScrollY | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_SizingFixedFit)) {
                 ImGui::TableSetupScrollFreeze(0, 1);
@@ -216,19 +795,22 @@ namespace hex::plugin::builtin {
                     for (u8 i = 0; i < 2; i++) {
                         ImGui::TableNextColumn();
                         for (u32 col = 0; col < this->m_columnCount; col++) {
-                            ImGui::TextFormatted(this->m_upperCaseHex ? "{:02X}" : "{:02x}", col);
+                            ImGui::TextFormattedCached(this->m_upperCaseHex ? "{:02X}" : "{:02x}", col);
                             ImGui::SameLine(0.0F, col % 8 == 7 ? glyphWidth * 1.5F : glyphWidth * 0.75F);
                         }
                     }
                 }
 
-                if (this->m_providerA >= 0 && this->m_providerB >= 0) {
-                    auto &providers = ImHexApi::Provider::getProviders();
+                if (this->m_providerA >= 0 && this->m_providerB >= 0 && !this->m_diffSegments.empty()) {
                     ImGuiListClipper clipper;
-                    clipper.Begin(std::max(providers[this->m_providerA]->getSize() / this->m_columnCount, providers[this->m_providerB]->getSize() / this->m_columnCount) + 1, ImGui::GetTextLineHeight());
+                    clipper.Begin(int(this->m_diffDisplaySize / this->m_columnCount) + 1, ImGui::GetTextLineHeight());
 
                     // Draw diff lines
                     while (clipper.Step()) {
+                        // The visible range drives which lines prepare() assembles ahead of time
+                        this->m_visibleRowStart = u64(clipper.DisplayStart);
+                        this->m_visibleRowEnd   = u64(clipper.DisplayEnd);
+
                         for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++) {
                             ImGui::TableNextRow();
                             drawDiffLine({ this->m_providerA, this->m_providerB }, row);
@@ -242,4 +824,4 @@ namespace hex::plugin::builtin {
         ImGui::End();
     }
 
-}
\ No newline at end of file
+}
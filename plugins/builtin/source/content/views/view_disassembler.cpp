@@ -1,8 +1,15 @@
 #include "content/views/view_disassembler.hpp"
 
 #include <hex/providers/provider.hpp>
+#include <hex/helpers/file.hpp>
 #include <hex/helpers/fmt.hpp>
+#include <hex/helpers/fs.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
 #include <cstring>
 #include <thread>
 
@@ -10,9 +17,30 @@ using namespace std::literals::string_literals;
 
 namespace hex::plugin::builtin {
 
+    // Byte window decoded at once in windowed mode and how many decoded windows
+    // are kept around. Decoding starts a bit before the window, so variable
+    // length instruction streams have resynced to the real instruction
+    // boundaries by the time the window itself starts
+    constexpr static u64 WindowSize     = 0x2000;
+    constexpr static u64 WindowLookBack = 0x40;
+    constexpr static u64 MaxInstructionSize = 0x10;
+    constexpr static size_t WindowCacheSize = 64;
+
+    // Average instruction length used to guess the line count of windows that
+    // haven't been decoded yet
+    constexpr static u64 EstimatedInstructionSize = 4;
+
     ViewDisassembler::ViewDisassembler() : View("hex.builtin.view.disassembler.name") {
         EventManager::subscribe<EventProviderDeleted>(this, [this](const auto*) {
             this->m_disassembly.clear();
+            this->m_searchIndex.clear();
+            this->m_searchResults.clear();
+            this->m_searchCursor = 0;
+
+            this->m_windowCache.clear();
+            this->m_windowCacheIndex.clear();
+            this->m_windowLineCounts.clear();
+            this->m_totalWindowLines = 0;
         });
     }
 
@@ -22,63 +50,390 @@ namespace hex::plugin::builtin {
         EventManager::unsubscribe<EventProviderDeleted>(this);
     }
 
+    // Pulls immediate values out of a formatted operand string. A number only
+    // counts when it doesn't continue an identifier, so the 12 in "r12" is not
+    // indexed while "#0x2000" and plain decimals are
+    static void collectOperandValues(const char *operators, u32 instructionIndex, std::map<u64, std::vector<u32>> &postings) {
+        char previous   = ' ';
+        const char *ptr = operators;
+        while (*ptr != '\0') {
+            if (std::isdigit(*ptr) != 0 && std::isalnum(previous) == 0 && previous != '_') {
+                char *end       = nullptr;
+                const u64 value = std::strtoull(ptr, &end, 0);
+
+                auto &entries = postings[value];
+                if (entries.empty() || entries.back() != instructionIndex)
+                    entries.push_back(instructionIndex);
+
+                previous = *(end - 1);
+                ptr      = end;
+            } else {
+                previous = *ptr;
+                ptr += 1;
+            }
+        }
+    }
+
     void ViewDisassembler::disassemble() {
         this->m_disassembly.clear();
+        this->m_searchIndex.clear();
+        this->m_searchResults.clear();
+        this->m_searchCursor = 0;
 
         this->m_disassemblerTask = TaskManager::createTask("hex.builtin.view.disassembler.disassembling", this->m_codeRegion.getSize(), [this](auto &task) {
-            csh capstoneHandle;
-            cs_insn *instructions = nullptr;
+            // The region is cut into fixed size chunks that are decoded in
+            // parallel, each worker on its own capstone handle. Chunks use the
+            // same look-back resynchronization as the windowed mode, so the
+            // stitched listing agrees with a straight serial decode
+            constexpr static u64 ChunkSize = 0x40'0000;
+
+            const auto mode         = this->m_mode;
+            const auto architecture = this->m_architecture;
+            const auto baseAddress  = this->m_baseAddress;
+            const auto codeRegion   = this->m_codeRegion;
+            const u64 size          = codeRegion.getSize();
+
+            const u64 chunkCount  = std::max<u64>(1, (size + ChunkSize - 1) / ChunkSize);
+            const u64 workerCount = std::min<u64>(std::max<u64>(1, std::thread::hardware_concurrency()), chunkCount);
+
+            std::vector<DisassemblyListing> chunkResults(chunkCount);
+            std::vector<DisassemblyIndex> chunkIndexes(chunkCount);
+
+            std::atomic<u64> nextChunk     = 0;
+            std::atomic<u64> processedSize = 0;
+            std::atomic<u32> activeWorkers = u32(workerCount);
+            std::atomic<bool> stopped      = false;
+
+            {
+                std::vector<std::jthread> workers;
+                for (u64 worker = 0; worker < workerCount; worker++) {
+                    workers.emplace_back([&] {
+                        ON_SCOPE_EXIT { activeWorkers -= 1; };
+
+                        csh capstoneHandle;
+                        if (cs_open(Disassembler::toCapstoneArchitecture(architecture), mode, &capstoneHandle) != CS_ERR_OK) {
+                            stopped = true;
+                            return;
+                        }
+                        ON_SCOPE_EXIT { cs_close(&capstoneHandle); };
+
+                        cs_option(capstoneHandle, CS_OPT_SKIPDATA, CS_OPT_ON);
 
-            cs_mode mode = this->m_mode;
+                        // One instruction object reused across the whole decode;
+                        // cs_disasm_iter never allocates beyond it
+                        cs_insn *instruction = cs_malloc(capstoneHandle);
+                        if (instruction == nullptr) {
+                            stopped = true;
+                            return;
+                        }
+                        ON_SCOPE_EXIT { cs_free(instruction, 1); };
+
+                        for (u64 chunk = 0; (chunk = nextChunk.fetch_add(1)) < chunkCount && !stopped;) {
+                            const u64 chunkStart = chunk * ChunkSize;
+                            const u64 chunkEnd   = std::min(size, chunkStart + ChunkSize);
+
+                            // Decode a bit before and past the chunk edges, so the
+                            // instruction stream has resynced when the chunk starts
+                            // and its last instruction isn't truncated
+                            const u64 decodeStart = chunkStart - std::min(chunkStart, WindowLookBack);
+                            const u64 decodeEnd   = std::min(size, chunkEnd + MaxInstructionSize);
+
+                            std::vector<u8> buffer(decodeEnd - decodeStart);
+                            ImHexApi::Provider::get()->read(codeRegion.getStartAddress() + decodeStart, buffer.data(), buffer.size());
+
+                            auto &result = chunkResults[chunk];
+
+                            const u8 *code  = buffer.data();
+                            size_t codeSize = buffer.size();
+                            u64 address     = baseAddress + decodeStart;
+
+                            while (!stopped && cs_disasm_iter(capstoneHandle, &code, &codeSize, &address, instruction)) {
+                                const u64 offset = instruction->address - baseAddress;
+
+                                // Instructions in the look-back prefix belong to the
+                                // previous chunk, ones in the overread tail to the next
+                                if (offset < chunkStart)
+                                    continue;
+                                if (offset >= chunkEnd)
+                                    break;
+
+                                std::string bytes;
+                                for (u16 j = 0; j < instruction->size; j++)
+                                    bytes += hex::format("{0:02X} ", instruction->bytes[j]);
+                                bytes.pop_back();
+
+                                // Indexed under its chunk-local position; the indices are
+                                // rebased to listing order when the chunks are stitched
+                                auto &index           = chunkIndexes[chunk];
+                                const auto localIndex = u32(result.instructions.size());
+                                index.mnemonics[instruction->mnemonic].push_back(localIndex);
+                                collectOperandValues(instruction->op_str, localIndex, index.operandValues);
+
+                                result.addInstruction(instruction->address, codeRegion.getStartAddress() + offset, bytes, instruction->mnemonic, instruction->op_str);
+                            }
+
+                            processedSize += chunkEnd - chunkStart;
+                        }
+                    });
+                }
+
+                // Progress and cancellation are handled here; on cancellation every
+                // worker finishes its current chunk and winds down
+                try {
+                    while (activeWorkers > 0) {
+                        task.update(processedSize);
+                        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                    }
+                } catch (...) {
+                    stopped = true;
+                    throw;
+                }
+            }
+
+            if (stopped)
+                return;
+
+            size_t totalInstructions = 0;
+            size_t totalText         = 0;
+            for (const auto &chunkResult : chunkResults) {
+                totalInstructions += chunkResult.instructions.size();
+                totalText         += chunkResult.textArena.size();
+            }
+
+            this->m_disassembly.instructions.reserve(totalInstructions);
+            this->m_disassembly.textArena.reserve(totalText);
+
+            u32 instructionBase = 0;
+            for (u64 chunk = 0; chunk < chunkCount; chunk++) {
+                auto &chunkResult = chunkResults[chunk];
+
+                const auto chunkInstructionCount = u32(chunkResult.instructions.size());
+
+                for (const auto &[mnemonic, postings] : chunkIndexes[chunk].mnemonics) {
+                    auto &merged = this->m_searchIndex.mnemonics[mnemonic];
+                    merged.reserve(merged.size() + postings.size());
+                    for (const auto index : postings)
+                        merged.push_back(instructionBase + index);
+                }
+
+                for (const auto &[value, postings] : chunkIndexes[chunk].operandValues) {
+                    auto &merged = this->m_searchIndex.operandValues[value];
+                    merged.reserve(merged.size() + postings.size());
+                    for (const auto index : postings)
+                        merged.push_back(instructionBase + index);
+                }
+
+                this->m_disassembly.append(std::move(chunkResult));
+                instructionBase += chunkInstructionCount;
+            }
+        });
+    }
 
-            if (cs_open(Disassembler::toCapstoneArchitecture(this->m_architecture), mode, &capstoneHandle) == CS_ERR_OK) {
+    void ViewDisassembler::exportDisassembly() {
+        fs::openFileBrowser(fs::DialogMode::Save, { { "Disassembly listing", "asm" } }, [this](const std::fs::path &path) {
+            this->m_disassemblerTask = TaskManager::createTask("hex.builtin.view.disassembler.exporting", this->m_codeRegion.getSize(), [this, path](auto &task) {
+                // Formatted lines are streamed to disk one chunk at a time, so a
+                // full listing never has to be materialized in memory
+                constexpr static u64 ExportChunkSize = 0x10'0000;
+
+                const auto mode         = this->m_mode;
+                const auto architecture = this->m_architecture;
+                const auto baseAddress  = this->m_baseAddress;
+                const auto codeRegion   = this->m_codeRegion;
+                const u64 size          = codeRegion.getSize();
+
+                fs::File file(path, fs::File::Mode::Create);
+                if (!file.isValid())
+                    return;
+
+                csh capstoneHandle;
+                if (cs_open(Disassembler::toCapstoneArchitecture(architecture), mode, &capstoneHandle) != CS_ERR_OK)
+                    return;
+                ON_SCOPE_EXIT { cs_close(&capstoneHandle); };
 
                 cs_option(capstoneHandle, CS_OPT_SKIPDATA, CS_OPT_ON);
 
-                auto provider = ImHexApi::Provider::get();
-                std::vector<u8> buffer(2048, 0x00);
-                size_t size = this->m_codeRegion.getSize();
+                cs_insn *instruction = cs_malloc(capstoneHandle);
+                if (instruction == nullptr)
+                    return;
+                ON_SCOPE_EXIT { cs_free(instruction, 1); };
 
-                for (u64 address = 0; address < size; address += 2048) {
-                    task.update(address);
+                std::string lineBuffer;
+                std::vector<u8> buffer;
 
-                    size_t bufferSize = std::min(u64(2048), (size - address));
-                    provider->read(this->m_codeRegion.getStartAddress() + address, buffer.data(), bufferSize);
+                u64 cursor = 0;
+                while (cursor < size) {
+                    task.update(cursor);
 
-                    size_t instructionCount = cs_disasm(capstoneHandle, buffer.data(), bufferSize, this->m_baseAddress + address, 0, &instructions);
-                    if (instructionCount == 0)
-                        break;
+                    const u64 decodeEnd = std::min(size, cursor + ExportChunkSize);
 
-                    this->m_disassembly.reserve(this->m_disassembly.size() + instructionCount);
+                    buffer.resize(decodeEnd - cursor);
+                    ImHexApi::Provider::get()->read(codeRegion.getStartAddress() + cursor, buffer.data(), buffer.size());
 
-                    u64 usedBytes = 0;
-                    for (u32 i = 0; i < instructionCount; i++) {
-                        const auto &instr       = instructions[i];
-                        Disassembly disassembly = { };
-                        disassembly.address     = instr.address;
-                        disassembly.offset      = this->m_codeRegion.getStartAddress() + address + usedBytes;
-                        disassembly.size        = instr.size;
-                        disassembly.mnemonic    = instr.mnemonic;
-                        disassembly.operators   = instr.op_str;
+                    const u8 *code  = buffer.data();
+                    size_t codeSize = buffer.size();
+                    u64 address     = baseAddress + cursor;
+
+                    const u64 chunkBase = cursor;
+
+                    lineBuffer.clear();
+                    while (cs_disasm_iter(capstoneHandle, &code, &codeSize, &address, instruction)) {
+                        const u64 offset = instruction->address - baseAddress;
+
+                        // An instruction this close to the chunk edge may have been
+                        // truncated by it; it's decoded again with the next chunk
+                        if (decodeEnd < size && offset + MaxInstructionSize > decodeEnd)
+                            break;
 
-                        for (u16 j = 0; j < instr.size; j++)
-                            disassembly.bytes += hex::format("{0:02X} ", instr.bytes[j]);
-                        disassembly.bytes.pop_back();
+                        std::string bytes;
+                        for (u16 j = 0; j < instruction->size; j++)
+                            bytes += hex::format("{0:02X} ", instruction->bytes[j]);
 
-                        this->m_disassembly.push_back(disassembly);
+                        lineBuffer += hex::format("{0:016X}  {1:<48} {2} {3}\n", instruction->address, bytes, instruction->mnemonic, instruction->op_str);
 
-                        usedBytes += instr.size;
+                        cursor = offset + instruction->size;
                     }
 
-                    if (instructionCount < bufferSize)
-                        address -= (bufferSize - usedBytes);
+                    file.write(lineBuffer);
+
+                    if (cursor == chunkBase)
+                        break;
+                }
+            });
+        });
+    }
+
+    void ViewDisassembler::resetWindowedDisassembly() {
+        this->m_windowCache.clear();
+        this->m_windowCacheIndex.clear();
+
+        // The settings are captured here, so scrolling stays consistent while
+        // the selection or the architecture options change in the UI
+        this->m_windowRegion       = this->m_codeRegion;
+        this->m_windowBaseAddress  = this->m_baseAddress;
+        this->m_windowArchitecture = this->m_architecture;
+        this->m_windowMode         = this->m_mode;
+
+        const auto regionSize  = this->m_windowRegion.getSize();
+        const auto windowCount = (regionSize + WindowSize - 1) / WindowSize;
+
+        // Until a window has been decoded its line count is only an estimate;
+        // it's corrected once the window comes into view
+        this->m_windowLineCounts.assign(windowCount, WindowSize / EstimatedInstructionSize);
+        if (windowCount > 0)
+            this->m_windowLineCounts.back() = std::max<u64>(1, (regionSize - (windowCount - 1) * WindowSize) / EstimatedInstructionSize);
+
+        this->m_totalWindowLines = 0;
+        for (const auto lineCount : this->m_windowLineCounts)
+            this->m_totalWindowLines += lineCount;
+
+        this->m_windowScanIndex    = 0;
+        this->m_windowScanLineBase = 0;
+    }
+
+    DisassemblyListing ViewDisassembler::disassembleWindow(u64 windowIndex) {
+        DisassemblyListing result;
+
+        const auto regionSize = this->m_windowRegion.getSize();
+        const u64 windowStart = windowIndex * WindowSize;
+        const u64 windowEnd   = std::min<u64>(regionSize, windowStart + WindowSize);
+
+        // The decoded range extends past both window edges; the look-back
+        // prefix resyncs the instruction boundaries, the tail makes sure the
+        // last instruction of the window isn't truncated
+        const u64 decodeStart = windowStart - std::min<u64>(windowStart, WindowLookBack);
+        const u64 decodeEnd   = std::min<u64>(regionSize, windowEnd + MaxInstructionSize);
+
+        csh capstoneHandle;
+        if (cs_open(Disassembler::toCapstoneArchitecture(this->m_windowArchitecture), this->m_windowMode, &capstoneHandle) != CS_ERR_OK)
+            return result;
+        ON_SCOPE_EXIT { cs_close(&capstoneHandle); };
+
+        cs_option(capstoneHandle, CS_OPT_SKIPDATA, CS_OPT_ON);
+
+        std::vector<u8> buffer(decodeEnd - decodeStart);
+        ImHexApi::Provider::get()->read(this->m_windowRegion.getStartAddress() + decodeStart, buffer.data(), buffer.size());
+
+        cs_insn *instruction = cs_malloc(capstoneHandle);
+        if (instruction == nullptr)
+            return result;
+        ON_SCOPE_EXIT { cs_free(instruction, 1); };
+
+        const u8 *code  = buffer.data();
+        size_t codeSize = buffer.size();
+        u64 address     = this->m_windowBaseAddress + decodeStart;
+
+        while (cs_disasm_iter(capstoneHandle, &code, &codeSize, &address, instruction)) {
+            const u64 offset = instruction->address - this->m_windowBaseAddress;
+
+            // Instructions in the look-back prefix belong to the previous
+            // window, ones in the overread tail to the next
+            if (offset < windowStart)
+                continue;
+            if (offset >= windowEnd)
+                break;
 
-                    cs_free(instructions, instructionCount);
+            std::string bytes;
+            for (u16 j = 0; j < instruction->size; j++)
+                bytes += hex::format("{0:02X} ", instruction->bytes[j]);
+            bytes.pop_back();
+
+            result.addInstruction(instruction->address, this->m_windowRegion.getStartAddress() + offset, bytes, instruction->mnemonic, instruction->op_str);
+        }
+
+        return result;
+    }
+
+    const DisassemblyListing &ViewDisassembler::getWindow(u64 windowIndex) {
+        if (auto entry = this->m_windowCacheIndex.find(windowIndex); entry != this->m_windowCacheIndex.end()) {
+            this->m_windowCache.splice(this->m_windowCache.begin(), this->m_windowCache, entry->second);
+            return entry->second->listing;
+        }
+
+        if (this->m_windowCache.size() >= WindowCacheSize) {
+            this->m_windowCacheIndex.erase(this->m_windowCache.back().index);
+            this->m_windowCache.pop_back();
+        }
+
+        this->m_windowCache.push_front({ windowIndex, this->disassembleWindow(windowIndex) });
+        this->m_windowCacheIndex.emplace(windowIndex, this->m_windowCache.begin());
+
+        auto &window = this->m_windowCache.front();
+
+        // Replace the estimated line count of this window with the real one
+        auto &lineCount = this->m_windowLineCounts[windowIndex];
+        this->m_totalWindowLines = this->m_totalWindowLines - lineCount + window.listing.instructions.size();
+        lineCount = window.listing.instructions.size();
+
+        return window.listing;
+    }
+
+    const DisassemblyListing *ViewDisassembler::getWindowedLine(u64 line, size_t &windowLine) {
+        // Lines are requested in increasing order while rendering, so the scan
+        // for the right window continues where the previous lookup stopped
+        if (line < this->m_windowScanLineBase) {
+            this->m_windowScanIndex    = 0;
+            this->m_windowScanLineBase = 0;
+        }
+
+        while (this->m_windowScanIndex < this->m_windowLineCounts.size()) {
+            if (line - this->m_windowScanLineBase < this->m_windowLineCounts[this->m_windowScanIndex]) {
+                const auto &listing = this->getWindow(this->m_windowScanIndex);
+                if (line - this->m_windowScanLineBase < listing.instructions.size()) {
+                    windowLine = line - this->m_windowScanLineBase;
+                    return &listing;
                 }
 
-                cs_close(&capstoneHandle);
+                // The estimate for this window was too high. The total line
+                // count was corrected above; the clipper picks it up next frame
+                return nullptr;
             }
-        });
+
+            this->m_windowScanLineBase += this->m_windowLineCounts[this->m_windowScanIndex];
+            this->m_windowScanIndex    += 1;
+        }
+
+        return nullptr;
     }
 
     void ViewDisassembler::drawContent() {
@@ -319,8 +674,17 @@ namespace hex::plugin::builtin {
 
                 ImGui::BeginDisabled(this->m_disassemblerTask.isRunning());
                 {
-                    if (ImGui::Button("hex.builtin.view.disassembler.disassemble"_lang))
-                        this->disassemble();
+                    if (ImGui::Button("hex.builtin.view.disassembler.disassemble"_lang)) {
+                        if (this->m_windowedMode)
+                            this->resetWindowedDisassembly();
+                        else
+                            this->disassemble();
+                    }
+                    ImGui::SameLine();
+                    if (ImGui::Button("hex.builtin.view.disassembler.export"_lang))
+                        this->exportDisassembly();
+                    ImGui::SameLine();
+                    ImGui::Checkbox("hex.builtin.view.disassembler.windowed"_lang, &this->m_windowedMode);
                 }
                 ImGui::EndDisabled();
 
@@ -334,6 +698,67 @@ namespace hex::plugin::builtin {
                 ImGui::TextUnformatted("hex.builtin.view.disassembler.disassembly.title"_lang);
                 ImGui::Separator();
 
+                // Queries run against the decode-time index, so only the fully
+                // materialized listing can be searched
+                ImGui::BeginDisabled(this->m_windowedMode || this->m_disassemblerTask.isRunning());
+                {
+                    ImGui::PushItemWidth(ImGui::GetTextLineHeight() * 8);
+                    ImGui::InputText("hex.builtin.view.disassembler.search.mnemonic"_lang, this->m_searchMnemonic);
+                    ImGui::SameLine();
+                    ImGui::InputText("hex.builtin.view.disassembler.search.value"_lang, this->m_searchValue, ImGuiInputTextFlags_CharsHexadecimal);
+                    ImGui::PopItemWidth();
+                    ImGui::SameLine();
+
+                    if (ImGui::Button("hex.builtin.view.disassembler.search"_lang)) {
+                        this->m_searchResults.clear();
+                        this->m_searchCursor = 0;
+
+                        const std::vector<u32> *mnemonicPostings = nullptr;
+                        if (!this->m_searchMnemonic.empty()) {
+                            if (auto entry = this->m_searchIndex.mnemonics.find(this->m_searchMnemonic); entry != this->m_searchIndex.mnemonics.end())
+                                mnemonicPostings = &entry->second;
+                        }
+
+                        const std::vector<u32> *valuePostings = nullptr;
+                        if (!this->m_searchValue.empty()) {
+                            const u64 value = std::strtoull(this->m_searchValue.c_str(), nullptr, 16);
+                            if (auto entry = this->m_searchIndex.operandValues.find(value); entry != this->m_searchIndex.operandValues.end())
+                                valuePostings = &entry->second;
+                        }
+
+                        const bool mnemonicMissed = !this->m_searchMnemonic.empty() && mnemonicPostings == nullptr;
+                        const bool valueMissed    = !this->m_searchValue.empty() && valuePostings == nullptr;
+
+                        if (!mnemonicMissed && !valueMissed) {
+                            if (mnemonicPostings != nullptr && valuePostings != nullptr)
+                                std::set_intersection(mnemonicPostings->begin(), mnemonicPostings->end(), valuePostings->begin(), valuePostings->end(), std::back_inserter(this->m_searchResults));
+                            else if (mnemonicPostings != nullptr)
+                                this->m_searchResults = *mnemonicPostings;
+                            else if (valuePostings != nullptr)
+                                this->m_searchResults = *valuePostings;
+                        }
+
+                        if (!this->m_searchResults.empty())
+                            this->m_jumpToLine = i64(this->m_searchResults.front());
+                    }
+
+                    if (!this->m_searchResults.empty()) {
+                        ImGui::SameLine();
+                        if (ImGui::ArrowButton("search_prev", ImGuiDir_Left)) {
+                            this->m_searchCursor = (this->m_searchCursor + this->m_searchResults.size() - 1) % this->m_searchResults.size();
+                            this->m_jumpToLine   = i64(this->m_searchResults[this->m_searchCursor]);
+                        }
+                        ImGui::SameLine();
+                        if (ImGui::ArrowButton("search_next", ImGuiDir_Right)) {
+                            this->m_searchCursor = (this->m_searchCursor + 1) % this->m_searchResults.size();
+                            this->m_jumpToLine   = i64(this->m_searchResults[this->m_searchCursor]);
+                        }
+                        ImGui::SameLine();
+                        ImGui::TextFormatted("hex.builtin.view.disassembler.search.results"_lang, this->m_searchCursor + 1, this->m_searchResults.size());
+                    }
+                }
+                ImGui::EndDisabled();
+
                 if (ImGui::BeginTable("##disassembly", 4, ImGuiTableFlags_ScrollY | ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_RowBg | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable)) {
                     ImGui::TableSetupScrollFreeze(0, 1);
                     ImGui::TableSetupColumn("hex.builtin.view.disassembler.disassembly.address"_lang);
@@ -341,29 +766,59 @@ namespace hex::plugin::builtin {
                     ImGui::TableSetupColumn("hex.builtin.view.disassembler.disassembly.bytes"_lang);
                     ImGui::TableSetupColumn("hex.builtin.view.disassembler.disassembly.title"_lang);
 
-                    if (!this->m_disassemblerTask.isRunning()) {
+                    const static auto drawInstructionLine = [](int i, const DisassemblyListing &listing, size_t line) {
+                        const auto &instruction = listing.instructions[line];
+                        const auto bytes        = listing.getBytes(instruction);
+                        const auto operators    = listing.getOperators(instruction);
+
+                        ImGui::TableNextRow();
+                        ImGui::TableNextColumn();
+                        if (ImGui::Selectable(("##DisassemblyLine"s + std::to_string(i)).c_str(), false, ImGuiSelectableFlags_SpanAllColumns)) {
+                            ImHexApi::HexEditor::setSelection(instruction.offset, instruction.size());
+                        }
+                        ImGui::SameLine();
+                        ImGui::TextFormatted("0x{0:X}", instruction.address);
+                        ImGui::TableNextColumn();
+                        ImGui::TextFormatted("0x{0:X}", instruction.offset);
+                        ImGui::TableNextColumn();
+                        ImGui::TextUnformatted(bytes.data(), bytes.data() + bytes.size());
+                        ImGui::TableNextColumn();
+                        ImGui::TextFormattedColored(ImColor(0xFFD69C56), "{}", listing.getMnemonic(instruction));
+                        ImGui::SameLine();
+                        ImGui::TextUnformatted(operators.data(), operators.data() + operators.size());
+                    };
+
+                    if (this->m_windowedMode) {
                         ImGuiListClipper clipper;
-                        clipper.Begin(this->m_disassembly.size());
+                        clipper.Begin(int(std::min<u64>(this->m_totalWindowLines, 0x7FFF'FFFF)));
 
                         ImGui::TableHeadersRow();
                         while (clipper.Step()) {
                             for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
-                                const auto &instruction = this->m_disassembly[i];
-                                ImGui::TableNextRow();
-                                ImGui::TableNextColumn();
-                                if (ImGui::Selectable(("##DisassemblyLine"s + std::to_string(i)).c_str(), false, ImGuiSelectableFlags_SpanAllColumns)) {
-                                    ImHexApi::HexEditor::setSelection(instruction.offset, instruction.size);
-                                }
-                                ImGui::SameLine();
-                                ImGui::TextFormatted("0x{0:X}", instruction.address);
-                                ImGui::TableNextColumn();
-                                ImGui::TextFormatted("0x{0:X}", instruction.offset);
-                                ImGui::TableNextColumn();
-                                ImGui::TextUnformatted(instruction.bytes.c_str());
-                                ImGui::TableNextColumn();
-                                ImGui::TextFormattedColored(ImColor(0xFFD69C56), "{}", instruction.mnemonic);
-                                ImGui::SameLine();
-                                ImGui::TextUnformatted(instruction.operators.c_str());
+                                size_t windowLine   = 0;
+                                const auto *listing = this->getWindowedLine(u64(i), windowLine);
+                                if (listing == nullptr)
+                                    break;
+
+                                drawInstructionLine(i, *listing, windowLine);
+                            }
+                        }
+
+                        clipper.End();
+                    } else if (!this->m_disassemblerTask.isRunning()) {
+                        ImGuiListClipper clipper;
+                        clipper.Begin(this->m_disassembly.instructions.size());
+
+                        ImGui::TableHeadersRow();
+
+                        if (this->m_jumpToLine >= 0) {
+                            ImGui::SetScrollY(ImGui::GetTextLineHeightWithSpacing() * float(this->m_jumpToLine));
+                            this->m_jumpToLine = -1;
+                        }
+
+                        while (clipper.Step()) {
+                            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+                                drawInstructionLine(i, this->m_disassembly, size_t(i));
                             }
                         }
 
@@ -1,9 +1,22 @@
 #include "content/views/view_find.hpp"
 
 #include <hex/api/imhex_api.hpp>
+#include <hex/api/project_file_manager.hpp>
 #include <hex/providers/buffered_reader.hpp>
+#include <hex/helpers/file.hpp>
+#include <hex/helpers/fs.hpp>
 
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <iterator>
+#include <numeric>
+#include <thread>
 #include <regex>
 #include <string>
 #include <utility>
@@ -13,6 +26,9 @@
 
 namespace hex::plugin::builtin {
 
+    // Version of the binary find results cache stored in project files. Bump whenever the layout changes
+    constexpr static u32 FindResultsCacheVersion = 1;
+
     ViewFind::ViewFind() : View("hex.builtin.view.find.name") {
         const static auto HighlightColor = [] { return (ImGui::GetCustomColorU32(ImGuiCustomCol_ToolbarPurple) & 0x00FFFFFF) | 0x70000000; };
 
@@ -24,7 +40,7 @@ namespace hex::plugin::builtin {
 
             auto provider = ImHexApi::Provider::get();
 
-            if (!this->m_occurrenceTree[provider].findOverlapping(address, address).empty())
+            if (!this->getOccurrencesAt(provider, address).empty())
                 return HighlightColor();
             else
                 return std::nullopt;
@@ -38,20 +54,20 @@ namespace hex::plugin::builtin {
 
             auto provider = ImHexApi::Provider::get();
 
-            auto occurrences = this->m_occurrenceTree[provider].findOverlapping(address, address);
+            auto occurrences = this->getOccurrencesAt(provider, address);
             if (occurrences.empty())
                 return;
 
             ImGui::BeginTooltip();
 
-            for (const auto &occurrence : occurrences) {
-                ImGui::PushID(&occurrence);
+            for (const auto *occurrence : occurrences) {
+                ImGui::PushID(occurrence);
                 if (ImGui::BeginTable("##tooltips", 1, ImGuiTableFlags_RowBg | ImGuiTableFlags_NoClip)) {
                     ImGui::TableNextRow();
                     ImGui::TableNextColumn();
 
                     {
-                        const auto value = this->decodeValue(ImHexApi::Provider::get(), occurrence.value);
+                        const auto value = this->decodeValue(ImHexApi::Provider::get(), *occurrence);
 
                         ImGui::ColorButton("##color", ImColor(HighlightColor()));
                         ImGui::SameLine(0, 10);
@@ -65,7 +81,7 @@ namespace hex::plugin::builtin {
                                 ImGui::TableNextColumn();
                                 ImGui::TextFormatted("{}: ", "hex.builtin.common.region"_lang.get());
                                 ImGui::TableNextColumn();
-                                ImGui::TextFormatted("[ 0x{:08X} - 0x{:08X} ]", occurrence.value.region.getStartAddress(), occurrence.value.region.getEndAddress());
+                                ImGui::TextFormatted("[ 0x{:08X} - 0x{:08X} ]", occurrence->region.getStartAddress(), occurrence->region.getEndAddress());
 
                                 auto demangledValue = llvm::demangle(value);
 
@@ -94,6 +110,143 @@ namespace hex::plugin::builtin {
 
             ImGui::EndTooltip();
         });
+
+        EventManager::subscribe<EventRegionDirtied>(this, [this](prv::Provider *provider, Region region) {
+            if (this->m_searchTask.isRunning() || !this->m_settingsValid)
+                return;
+
+            // Only whole-data searches keep track of how far they got and can be updated in place
+            auto searchedEnd = this->m_searchedEnd.find(provider);
+            if (searchedEnd == this->m_searchedEnd.end())
+                return;
+
+            // Instead of re-searching the entire data, only a window around the dirtied region
+            // gets re-searched. The window extends past the region on both sides by the pattern
+            // length so occurrences straddling its edges are still found; modes without a fixed
+            // pattern length (strings, regexes) fall back to a generous fixed overlap
+            const u64 overlap = getPatternSize(this->m_searchSettings).value_or(0x400);
+
+            const auto dataEnd = provider->getBaseAddress() + provider->getActualSize();
+
+            const auto windowStart = std::max(provider->getBaseAddress(), region.getStartAddress() - std::min(region.getStartAddress(), overlap));
+            const auto windowEnd   = std::min<u64>(dataEnd, region.getEndAddress() + 1 + overlap);
+            if (windowStart >= windowEnd)
+                return;
+
+            const Region searchRegion = { windowStart, windowEnd - windowStart };
+
+            this->m_searchTask = TaskManager::createTask("hex.builtin.view.find.searching", searchRegion.getSize(), [this, provider, searchRegion, settings = this->m_searchSettings](auto &task) {
+                auto newOccurrences = searchWithSettingsParallel(task, provider, { searchRegion }, settings);
+
+                auto &occurrences = this->m_foundOccurrences[provider];
+
+                // Results inside the re-searched window or past the end of the data are stale now
+                const auto dataEnd = provider->getBaseAddress() + provider->getActualSize();
+                std::erase_if(occurrences, [&](const auto &occurrence) {
+                    const auto &occurrenceRegion = occurrence.region;
+
+                    if (occurrenceRegion.getEndAddress() >= dataEnd)
+                        return true;
+
+                    return occurrenceRegion.getStartAddress() <= searchRegion.getEndAddress() &&
+                           occurrenceRegion.getEndAddress()   >= searchRegion.getStartAddress();
+                });
+
+                std::move(newOccurrences.begin(), newOccurrences.end(), std::back_inserter(occurrences));
+
+                this->m_searchedEnd[provider] = dataEnd;
+
+                this->updateOccurrenceIndex(provider);
+            });
+        });
+
+        ProjectFile::registerPerProviderHandler({
+            .basePath = "find_results.bin",
+            .required = false,
+            .load = [this](prv::Provider *provider, const std::fs::path &basePath, Tar &tar) -> bool {
+                if (!tar.contains(basePath))
+                    return true;
+
+                const auto data = tar.read(basePath);
+                if (data.empty())
+                    return true;
+
+                size_t offset = 0;
+                auto read = [&](void *dest, size_t size) {
+                    if (offset + size > data.size())
+                        throw std::runtime_error("Find results cache is truncated");
+                    std::memcpy(dest, data.data() + offset, size);
+                    offset += size;
+                };
+                auto readU8  = [&] { u8 value = 0; read(&value, sizeof(value)); return value; };
+                auto readU32 = [&] { u32 value = 0; read(&value, sizeof(value)); return value; };
+                auto readU64 = [&] { u64 value = 0; read(&value, sizeof(value)); return value; };
+
+                if (readU32() != FindResultsCacheVersion)
+                    return true;
+
+                // Cached results belonging to a different revision of the data are silently discarded
+                if (readU64() != provider->getContentFingerprint())
+                    return true;
+
+                if (readU8() != 0)
+                    this->m_searchedEnd[provider] = readU64();
+                else
+                    hex::unused(readU64());
+
+                std::vector<Occurrence> occurrences(readU32());
+                for (auto &occurrence : occurrences) {
+                    occurrence.region     = { readU64(), readU64() };
+                    occurrence.decodeType = static_cast<Occurrence::DecodeType>(readU8());
+                    occurrence.endian     = readU8() == 0 ? std::endian::little : std::endian::big;
+                }
+
+                this->m_foundOccurrences[provider] = std::move(occurrences);
+                this->updateOccurrenceIndex(provider);
+
+                return true;
+            },
+            .store = [this](prv::Provider *provider, const std::fs::path &basePath, Tar &tar) -> bool {
+                if (this->m_searchTask.isRunning())
+                    return true;
+
+                auto occurrences = this->m_foundOccurrences.find(provider);
+                if (occurrences == this->m_foundOccurrences.end() || occurrences->second.empty())
+                    return true;
+
+                std::vector<u8> data;
+                auto write = [&data](const void *src, size_t size) {
+                    const auto bytes = reinterpret_cast<const u8 *>(src);
+                    data.insert(data.end(), bytes, bytes + size);
+                };
+                auto writeU8  = [&write](u8 value)  { write(&value, sizeof(value)); };
+                auto writeU32 = [&write](u32 value) { write(&value, sizeof(value)); };
+                auto writeU64 = [&write](u64 value) { write(&value, sizeof(value)); };
+
+                writeU32(FindResultsCacheVersion);
+                writeU64(provider->getContentFingerprint());
+
+                auto searchedEnd = this->m_searchedEnd.find(provider);
+                writeU8(searchedEnd != this->m_searchedEnd.end() ? 1 : 0);
+                writeU64(searchedEnd != this->m_searchedEnd.end() ? searchedEnd->second : 0);
+
+                writeU32(occurrences->second.size());
+                for (const auto &occurrence : occurrences->second) {
+                    writeU64(occurrence.region.address);
+                    writeU64(occurrence.region.size);
+                    writeU8(u8(occurrence.decodeType));
+                    writeU8(occurrence.endian == std::endian::little ? 0 : 1);
+                }
+
+                tar.write(basePath, data);
+
+                return true;
+            }
+        });
+    }
+
+    ViewFind::~ViewFind() {
+        EventManager::unsubscribe<EventRegionDirtied>(this);
     }
 
 
@@ -204,45 +357,11 @@ namespace hex::plugin::builtin {
 
         std::vector<Occurrence> results;
 
-        if (settings.type == ASCII_UTF16BE || settings.type == ASCII_UTF16LE) {
-            auto newSettings = settings;
-
-            newSettings.type = ASCII;
-            auto asciiResults = searchStrings(task, provider, searchRegion, newSettings);
-            std::copy(asciiResults.begin(), asciiResults.end(), std::back_inserter(results));
-
-            if (settings.type == ASCII_UTF16BE) {
-                newSettings.type = UTF16BE;
-                auto utf16Results = searchStrings(task, provider, searchRegion, newSettings);
-                std::copy(utf16Results.begin(), utf16Results.end(), std::back_inserter(results));
-            } else if (settings.type == ASCII_UTF16LE) {
-                newSettings.type = UTF16LE;
-                auto utf16Results = searchStrings(task, provider, searchRegion, newSettings);
-                std::copy(utf16Results.begin(), utf16Results.end(), std::back_inserter(results));
-            }
-
-            return results;
-        }
-
-        auto reader = prv::BufferedReader(provider);
-        reader.seek(searchRegion.getStartAddress());
-        reader.setEndAddress(searchRegion.getEndAddress());
-
-        const auto [decodeType, endian] = [&] -> std::pair<Occurrence::DecodeType, std::endian> {
-            if (settings.type == ASCII)
-                return { Occurrence::DecodeType::ASCII, std::endian::native };
-            else if (settings.type == SearchSettings::Strings::Type::UTF16BE)
-                return { Occurrence::DecodeType::UTF16, std::endian::big };
-            else if (settings.type == SearchSettings::Strings::Type::UTF16LE)
-                return { Occurrence::DecodeType::UTF16, std::endian::little };
-            else
-                return { Occurrence::DecodeType::Binary, std::endian::native };
-        }();
-
-        size_t countedCharacters = 0;
-        u64 startAddress = reader.begin().getAddress();
-        for (u8 byte : reader) {
-            bool validChar =
+        // Folding the per-byte settings checks into a precomputed table turns the
+        // classification of each byte into a single load
+        std::array<bool, 256> validCharTable = { };
+        for (u32 byte = 0; byte < validCharTable.size(); byte++) {
+            validCharTable[byte] =
                 (settings.m_lowerCaseLetters    && std::islower(byte))  ||
                 (settings.m_upperCaseLetters    && std::isupper(byte))  ||
                 (settings.m_numbers             && std::isdigit(byte))  ||
@@ -250,88 +369,326 @@ namespace hex::plugin::builtin {
                 (settings.m_underscores         && byte == '_')             ||
                 (settings.m_symbols             && std::ispunct(byte))  ||
                 (settings.m_lineFeeds           && byte == '\n');
+        }
 
-            if (settings.type == UTF16LE) {
-                // Check if second byte of UTF-16 encoded string is 0x00
-                if (countedCharacters % 2 == 1)
-                    validChar =  byte == 0x00;
-            } else if (settings.type == UTF16BE) {
-                // Check if first byte of UTF-16 encoded string is 0x00
-                if (countedCharacters % 2 == 0)
-                    validChar =  byte == 0x00;
+        // Combined searches run one scanner per string type over the same chunk, so the
+        // data only gets read once instead of once per type
+        struct Scanner {
+            SearchSettings::Strings::Type type;
+            Occurrence::DecodeType decodeType;
+            std::endian endian;
+
+            size_t countedCharacters = 0;
+            u64 startAddress;
+        };
+
+        const u64 regionStart = searchRegion.getStartAddress();
+        const u64 regionEnd   = searchRegion.getEndAddress();
+
+        std::vector<Scanner> scanners;
+        if (settings.type == ASCII || settings.type == ASCII_UTF16LE || settings.type == ASCII_UTF16BE)
+            scanners.push_back(Scanner { ASCII, Occurrence::DecodeType::ASCII, std::endian::native, 0, regionStart });
+        if (settings.type == UTF16LE || settings.type == ASCII_UTF16LE)
+            scanners.push_back(Scanner { UTF16LE, Occurrence::DecodeType::UTF16, std::endian::little, 0, regionStart });
+        if (settings.type == UTF16BE || settings.type == ASCII_UTF16BE)
+            scanners.push_back(Scanner { UTF16BE, Occurrence::DecodeType::UTF16, std::endian::big, 0, regionStart });
+
+        const auto endRun = [&](Scanner &scanner, u8 terminator, u64 nextAddress) {
+            if (scanner.countedCharacters >= size_t(settings.minLength)) {
+                if (!(settings.nullTermination && terminator != 0x00)) {
+                    results.push_back(Occurrence { Region { scanner.startAddress, scanner.countedCharacters }, scanner.decodeType, scanner.endian });
+                }
             }
 
-            if (validChar)
-                countedCharacters++;
-            else {
-                if (countedCharacters >= size_t(settings.minLength)) {
-                    if (!(settings.nullTermination && byte != 0x00)) {
-                        results.push_back(Occurrence { Region { startAddress, countedCharacters }, decodeType, endian });
-                    }
+            scanner.startAddress      = nextAddress;
+            scanner.countedCharacters = 0;
+        };
+
+        const auto scanChunk = [&](Scanner &scanner, u64 chunkAddress, const u8 *data, size_t chunkSize) {
+            if (scanner.type == ASCII) {
+                for (size_t offset = 0; offset < chunkSize; offset++) {
+                    if (validCharTable[data[offset]]) [[likely]]
+                        scanner.countedCharacters++;
+                    else
+                        endRun(scanner, data[offset], chunkAddress + offset + 1);
                 }
+            } else {
+                // UTF-16 strings are runs of printable,0x00 pairs (0x00,printable for big endian).
+                // Inside a run whole pairs get checked in one step; the single-byte path only
+                // handles run starts, chunk edges and mismatches
+                const bool littleEndian = scanner.type == UTF16LE;
+
+                size_t offset = 0;
+                while (offset < chunkSize) {
+                    if (scanner.countedCharacters % 2 == 0 && offset + 1 < chunkSize) {
+                        const u8 first  = data[offset];
+                        const u8 second = data[offset + 1];
+
+                        const bool pairValid = littleEndian ? (validCharTable[first] && second == 0x00)
+                                                            : (first == 0x00 && validCharTable[second]);
+                        if (pairValid) {
+                            scanner.countedCharacters += 2;
+                            offset += 2;
+                            continue;
+                        }
+                    }
+
+                    const u8 byte = data[offset];
 
-                startAddress += countedCharacters + 1;
-                countedCharacters = 0;
-                task.update(startAddress - searchRegion.getStartAddress());
+                    bool validChar;
+                    if (scanner.countedCharacters % 2 == 0)
+                        validChar = littleEndian ? validCharTable[byte] : byte == 0x00;
+                    else
+                        validChar = littleEndian ? byte == 0x00 : validCharTable[byte];
+
+                    if (validChar)
+                        scanner.countedCharacters++;
+                    else
+                        endRun(scanner, byte, chunkAddress + offset + 1);
+
+                    offset++;
+                }
             }
+        };
+
+        constexpr static size_t ChunkSize = 0x10'0000;
+
+        auto reader = prv::BufferedReader(provider);
+        reader.seek(regionStart);
+        reader.setEndAddress(regionEnd);
+
+        // Runs of valid characters get tracked across chunk boundaries, so scanning whole
+        // chunks of contiguous memory doesn't change which strings are found
+        for (const auto &chunk : reader.chunks(ChunkSize)) {
+            for (auto &scanner : scanners)
+                scanChunk(scanner, chunk.address, chunk.data.data(), chunk.data.size());
+
+            task.update((chunk.address - regionStart) + chunk.data.size());
         }
 
         return results;
     }
 
     std::vector<ViewFind::Occurrence> ViewFind::searchSequence(Task &task, prv::Provider *provider, hex::Region searchRegion, const SearchSettings::Sequence &settings) {
+        if (settings.multiPattern)
+            return searchMultiSequence(task, provider, searchRegion, settings);
+
         std::vector<Occurrence> results;
 
+        auto bytes = hex::decodeByteString(settings.sequence);
+
+        if (bytes.empty() || bytes.size() > searchRegion.getSize())
+            return { };
+
+        // Scanning whole chunks at once keeps the inner loop on contiguous memory instead of
+        // fetching one byte at a time through the provider. memchr compiles down to a vectorized
+        // first-byte scan, so the full comparison only runs where the first byte already matches
+        constexpr static size_t ChunkSize = 0x10'0000;
+
+        const u64 startAddress = searchRegion.getStartAddress();
+        const u64 endAddress   = searchRegion.getEndAddress();
+        const u8 firstByte     = bytes[0];
+
         auto reader = prv::BufferedReader(provider);
-        reader.seek(searchRegion.getStartAddress());
-        reader.setEndAddress(searchRegion.getEndAddress());
+        reader.seek(startAddress);
+        reader.setEndAddress(endAddress);
 
-        auto bytes = hex::decodeByteString(settings.sequence);
+        for (u64 address = startAddress; address <= endAddress; address += ChunkSize) {
+            // Each chunk reads pattern-length - 1 bytes of lookahead so matches straddling chunk edges are found
+            const auto chunk = reader.readSpan(address, ChunkSize + (bytes.size() - 1));
+            if (chunk.size() < bytes.size())
+                break;
+
+            const u8 *candidate     = chunk.data();
+            const u8 *const scanEnd = chunk.data() + (chunk.size() - bytes.size()) + 1;
+            while (candidate < scanEnd) {
+                candidate = static_cast<const u8 *>(std::memchr(candidate, firstByte, scanEnd - candidate));
+                if (candidate == nullptr)
+                    break;
 
-        if (bytes.empty())
+                if (std::memcmp(candidate, bytes.data(), bytes.size()) == 0)
+                    results.push_back(Occurrence { Region { address + (candidate - chunk.data()), bytes.size() }, Occurrence::DecodeType::Binary, std::endian::native });
+
+                candidate++;
+            }
+
+            task.update((address - startAddress) + chunk.size());
+        }
+
+        return results;
+    }
+
+    std::vector<ViewFind::Occurrence> ViewFind::searchMultiSequence(Task &task, prv::Provider *provider, hex::Region searchRegion, const SearchSettings::Sequence &settings) {
+        // One pattern per line; lines that don't decode to any bytes are skipped
+        std::vector<std::vector<u8>> patterns;
+        for (const auto &line : hex::splitString(settings.sequence, "\n")) {
+            auto bytes = hex::decodeByteString(line);
+            if (!bytes.empty() && bytes.size() <= searchRegion.getSize())
+                patterns.push_back(std::move(bytes));
+        }
+
+        if (patterns.empty())
             return { };
 
-        auto occurrence = reader.begin();
-        while (true) {
-            occurrence = std::search(reader.begin(), reader.end(), std::boyer_moore_horspool_searcher(bytes.begin(), bytes.end()));
-            if (occurrence == reader.end())
+        // All patterns are compiled into one Aho-Corasick automaton, so a whole
+        // signature set costs a single pass over the data instead of one pass per
+        // pattern. The failure function is folded into full 256-entry transition
+        // tables up front, keeping the hot loop at one table load per byte
+        struct Node {
+            std::array<u32, 256> next;
+            std::vector<u32> matches;    // Patterns ending at this state
+        };
+
+        std::vector<Node> automaton(1);
+        automaton.front().next.fill(0);
+
+        for (u32 patternIndex = 0; patternIndex < patterns.size(); patternIndex++) {
+            u32 state = 0;
+            for (const u8 byte : patterns[patternIndex]) {
+                if (automaton[state].next[byte] == 0) {
+                    automaton[state].next[byte] = automaton.size();
+                    automaton.emplace_back().next.fill(0);
+                }
+
+                state = automaton[state].next[byte];
+            }
+
+            automaton[state].matches.push_back(patternIndex);
+        }
+
+        std::vector<u32> failure(automaton.size(), 0);
+        std::vector<u32> queue;
+        for (u32 byte = 0; byte < 256; byte++) {
+            if (automaton[0].next[byte] != 0)
+                queue.push_back(automaton[0].next[byte]);
+        }
+
+        for (size_t head = 0; head < queue.size(); head++) {
+            const auto state = queue[head];
+
+            for (u32 byte = 0; byte < 256; byte++) {
+                auto &child         = automaton[state].next[byte];
+                const auto fallback = automaton[failure[state]].next[byte];
+
+                if (child == 0) {
+                    child = fallback;
+                } else {
+                    failure[child] = fallback;
+
+                    const auto &inherited = automaton[fallback].matches;
+                    automaton[child].matches.insert(automaton[child].matches.end(), inherited.begin(), inherited.end());
+
+                    queue.push_back(child);
+                }
+            }
+        }
+
+        // The automaton sits in its root state for the overwhelming majority of
+        // bytes; ones that can't start any pattern skip the transition tables entirely
+        std::array<bool, 256> staysInRoot;
+        for (u32 byte = 0; byte < 256; byte++)
+            staysInRoot[byte] = automaton[0].next[byte] == 0;
+
+        constexpr static size_t ChunkSize = 0x10'0000;
+
+        std::vector<Occurrence> results;
+
+        const u64 startAddress = searchRegion.getStartAddress();
+        const u64 endAddress   = searchRegion.getEndAddress();
+
+        auto reader = prv::BufferedReader(provider);
+        reader.seek(startAddress);
+        reader.setEndAddress(endAddress);
+
+        // The automaton state carries across chunk boundaries, so no lookahead or
+        // chunk overlap is needed for matches straddling a boundary
+        u32 state = 0;
+        for (u64 address = startAddress; address <= endAddress; address += ChunkSize) {
+            const auto chunk = reader.readSpan(address, ChunkSize);
+            if (chunk.empty())
                 break;
 
-            auto address = occurrence.getAddress();
-            reader.seek(address + 1);
-            results.push_back(Occurrence{ Region { address, bytes.size() }, Occurrence::DecodeType::Binary, std::endian::native });
-            task.update(address - searchRegion.getStartAddress());
+            for (size_t index = 0; index < chunk.size(); index++) {
+                const u8 byte = chunk[index];
+
+                if (state == 0 && staysInRoot[byte])
+                    continue;
+
+                state = automaton[state].next[byte];
+
+                for (const auto patternIndex : automaton[state].matches) {
+                    const auto length = patterns[patternIndex].size();
+
+                    results.push_back(Occurrence { Region { (address + index) - (length - 1), length }, Occurrence::DecodeType::Binary, std::endian::native });
+                }
+            }
+
+            task.update((address - startAddress) + chunk.size());
         }
 
         return results;
     }
 
     std::vector<ViewFind::Occurrence> ViewFind::searchRegex(Task &task, prv::Provider *provider, hex::Region searchRegion, const SearchSettings::Regex &settings) {
-        auto stringOccurrences = searchStrings(task, provider, searchRegion, SearchSettings::Strings {
-            .minLength          = 1,
-            .type               = SearchSettings::Strings::Type::ASCII,
-            .m_lowerCaseLetters = true,
-            .m_upperCaseLetters = true,
-            .m_numbers          = true,
-            .m_underscores      = true,
-            .m_symbols          = true,
-            .m_spaces           = true,
-            .m_lineFeeds        = true
-        });
-
         std::vector<Occurrence> result;
         std::regex regex(settings.pattern);
-        for (const auto &occurrence : stringOccurrences) {
-            std::string string(occurrence.region.getSize(), '\x00');
-            provider->read(occurrence.region.getStartAddress(), string.data(), occurrence.region.getSize());
 
-            if (settings.fullMatch) {
+        // Full matches are defined in terms of extracted strings, so that mode still runs
+        // over the string scanner's results
+        if (settings.fullMatch) {
+            auto stringOccurrences = searchStrings(task, provider, searchRegion, SearchSettings::Strings {
+                .minLength          = 1,
+                .type               = SearchSettings::Strings::Type::ASCII,
+                .m_lowerCaseLetters = true,
+                .m_upperCaseLetters = true,
+                .m_numbers          = true,
+                .m_underscores      = true,
+                .m_symbols          = true,
+                .m_spaces           = true,
+                .m_lineFeeds        = true
+            });
+
+            for (const auto &occurrence : stringOccurrences) {
+                std::string string(occurrence.region.getSize(), '\x00');
+                provider->read(occurrence.region.getStartAddress(), string.data(), occurrence.region.getSize());
+
                 if (std::regex_match(string, regex))
                     result.push_back(occurrence);
-            } else {
-                if (std::regex_search(string, regex))
-                    result.push_back(occurrence);
             }
+
+            return result;
+        }
+
+        // Substring matches run directly over chunks of the raw data, so patterns can match
+        // across non-printable boundaries and no per-string allocations happen. std::regex
+        // can't suspend its automaton at a buffer edge, so consecutive chunks share a fixed
+        // lookahead window; matches longer than that window get cut off at its end
+        constexpr static size_t ChunkSize   = 0x10'0000;
+        constexpr static size_t OverlapSize = 0x1000;
+
+        const u64 regionStart = searchRegion.getStartAddress();
+        const u64 regionEnd   = searchRegion.getEndAddress();
+
+        auto reader = prv::BufferedReader(provider);
+        reader.seek(regionStart);
+        reader.setEndAddress(regionEnd);
+
+        for (u64 address = regionStart; address <= regionEnd; address += ChunkSize) {
+            const auto chunk = reader.readSpan(address, ChunkSize + OverlapSize);
+
+            const char *const chunkBegin = reinterpret_cast<const char *>(chunk.data());
+            for (std::cregex_iterator it(chunkBegin, chunkBegin + chunk.size(), regex), end; it != end; ++it) {
+                const auto &match = (*it)[0];
+
+                // Matches starting inside the lookahead window belong to the next chunk
+                const u64 matchOffset = match.first - chunkBegin;
+                if (matchOffset >= ChunkSize)
+                    break;
+
+                result.push_back(Occurrence { Region { address + matchOffset, size_t(match.length()) }, Occurrence::DecodeType::ASCII, std::endian::native });
+            }
+
+            task.update((address - regionStart) + chunk.size());
         }
 
         return result;
@@ -340,31 +697,75 @@ namespace hex::plugin::builtin {
     std::vector<ViewFind::Occurrence> ViewFind::searchBinaryPattern(Task &task, prv::Provider *provider, hex::Region searchRegion, const SearchSettings::BinaryPattern &settings) {
         std::vector<Occurrence> results;
 
+        const auto &pattern = settings.pattern;
+        const size_t patternSize = pattern.size();
+
+        if (patternSize == 0 || patternSize > searchRegion.getSize())
+            return { };
+
+        // Pick the most selective pattern byte as the anchor of the skip loop. A fully
+        // masked anchor lets the scan run through memchr's vectorized byte search and the
+        // masked comparison of the whole pattern only happens at anchor hits
+        size_t anchorIndex = 0;
+        for (size_t i = 0; i < patternSize; i++) {
+            if (std::popcount(pattern[i].mask) > std::popcount(pattern[anchorIndex].mask))
+                anchorIndex = i;
+        }
+
+        const u8 anchorMask  = pattern[anchorIndex].mask;
+        const u8 anchorValue = pattern[anchorIndex].value;
+
+        const auto matchesAt = [&pattern, patternSize](const u8 *data) {
+            for (size_t i = 0; i < patternSize; i++) {
+                if ((data[i] & pattern[i].mask) != pattern[i].value)
+                    return false;
+            }
+
+            return true;
+        };
+
+        constexpr static size_t ChunkSize = 0x10'0000;
+
+        const u64 regionStart = searchRegion.getStartAddress();
+        const u64 regionEnd   = searchRegion.getEndAddress();
+
         auto reader = prv::BufferedReader(provider);
-        reader.seek(searchRegion.getStartAddress());
-        reader.setEndAddress(searchRegion.getEndAddress());
+        reader.seek(regionStart);
+        reader.setEndAddress(regionEnd);
+
+        for (u64 address = regionStart; address <= regionEnd; address += ChunkSize) {
+            // Each chunk reads pattern-length - 1 bytes of lookahead so matches straddling chunk edges are found
+            const auto chunk = reader.readSpan(address, ChunkSize + (patternSize - 1));
+            if (chunk.size() < patternSize)
+                break;
 
-        u32 matchedBytes = 0;
-        const size_t patternSize = settings.pattern.size();
+            const u8 *const chunkStart = chunk.data();
+            const size_t positionCount = (chunk.size() - patternSize) + 1;
 
-        for (auto it = reader.begin(); it != reader.end(); ++it) {
-            auto byte = *it;
+            if (anchorMask == 0xFF) {
+                const u8 *candidate            = chunkStart + anchorIndex;
+                const u8 *const candidateLimit = chunkStart + anchorIndex + positionCount;
+                while (candidate < candidateLimit) {
+                    candidate = static_cast<const u8 *>(std::memchr(candidate, anchorValue, candidateLimit - candidate));
+                    if (candidate == nullptr)
+                        break;
 
-            if ((byte & settings.pattern[matchedBytes].mask) == settings.pattern[matchedBytes].value) {
-                matchedBytes++;
-                if (matchedBytes == settings.pattern.size()) {
-                    auto occurrenceAddress = it.getAddress() - (patternSize - 1);
+                    if (matchesAt(candidate - anchorIndex))
+                        results.push_back(Occurrence { Region { address + (candidate - anchorIndex - chunkStart), patternSize }, Occurrence::DecodeType::Binary, std::endian::native });
 
-                    results.push_back(Occurrence { Region { occurrenceAddress, patternSize }, Occurrence::DecodeType::Binary, std::endian::native });
-                    task.update(occurrenceAddress);
-                    it.setAddress(occurrenceAddress);
-                    matchedBytes = 0;
+                    candidate++;
                 }
             } else {
-                if (matchedBytes > 0)
-                    it -= matchedBytes;
-                matchedBytes = 0;
+                for (size_t position = 0; position < positionCount; position++) {
+                    if ((chunkStart[position + anchorIndex] & anchorMask) != anchorValue)
+                        continue;
+
+                    if (matchesAt(chunkStart + position))
+                        results.push_back(Occurrence { Region { address + position, patternSize }, Occurrence::DecodeType::Binary, std::endian::native });
+                }
             }
+
+            task.update((address - regionStart) + chunk.size());
         }
 
         return results;
@@ -385,58 +786,202 @@ namespace hex::plugin::builtin {
 
         const auto size = sizeMin;
 
+        constexpr static size_t ChunkSize = 0x10'0000;
+
         u64 bytes = 0x00;
         u64 address = searchRegion.getStartAddress();
         size_t validBytes = 0;
-        for (u8 byte : reader) {
-            bytes <<= 8;
-            bytes |= byte;
-
-            if (validBytes == size) {
-                bytes &= hex::bitmask(size * 8);
-
-                auto result = std::visit([&](auto tag) {
-                    using T = std::remove_cvref_t<std::decay_t<decltype(tag)>>;
-
-                    auto minValue = std::get<T>(min);
-                    auto maxValue = std::get<T>(max);
-
-                    T value = 0;
-                    std::memcpy(&value, &bytes, size);
-                    value = hex::changeEndianess(value, size, std::endian::big);
-                    value = hex::changeEndianess(value, size, settings.endian);
-
-                    return value >= minValue && value <= maxValue;
-                }, min);
-
-                if (result) {
-                    Occurrence::DecodeType decodeType = [&]{
-                        switch (settings.type) {
-                            using enum SearchSettings::Value::Type;
-                            using enum Occurrence::DecodeType;
-
-                            case U8 ... U64:    return Unsigned;
-                            case I8 ... I64:    return Signed;
-                            case F32:           return Float;
-                            case F64:           return Double;
-                            default:            return Binary;
-                        }
-                    }();
+        for (const auto &chunk : reader.chunks(ChunkSize)) {
+            for (u8 byte : chunk.data) {
+                bytes <<= 8;
+                bytes |= byte;
+
+                if (validBytes == size) {
+                    bytes &= hex::bitmask(size * 8);
+
+                    auto result = std::visit([&](auto tag) {
+                        using T = std::remove_cvref_t<std::decay_t<decltype(tag)>>;
+
+                        auto minValue = std::get<T>(min);
+                        auto maxValue = std::get<T>(max);
+
+                        T value = 0;
+                        std::memcpy(&value, &bytes, size);
+                        value = hex::changeEndianess(value, size, std::endian::big);
+                        value = hex::changeEndianess(value, size, settings.endian);
+
+                        return value >= minValue && value <= maxValue;
+                    }, min);
+
+                    if (result) {
+                        Occurrence::DecodeType decodeType = [&]{
+                            switch (settings.type) {
+                                using enum SearchSettings::Value::Type;
+                                using enum Occurrence::DecodeType;
+
+                                case U8 ... U64:    return Unsigned;
+                                case I8 ... I64:    return Signed;
+                                case F32:           return Float;
+                                case F64:           return Double;
+                                default:            return Binary;
+                            }
+                        }();
 
 
-                    results.push_back(Occurrence { Region { address - (size - 1), size }, decodeType, settings.endian });
+                        results.push_back(Occurrence { Region { address - (size - 1), size }, decodeType, settings.endian });
+                    }
+                } else {
+                    validBytes++;
                 }
-            } else {
-                validBytes++;
+
+                address++;
             }
 
-            address++;
             task.update(address);
         }
 
         return results;
     }
 
+    std::vector<ViewFind::Occurrence> ViewFind::searchWithSettings(Task &task, prv::Provider *provider, Region searchRegion, const SearchSettings &settings) {
+        switch (settings.mode) {
+            using enum SearchSettings::Mode;
+            case Strings:
+                return searchStrings(task, provider, searchRegion, settings.strings);
+            case Sequence:
+                return searchSequence(task, provider, searchRegion, settings.bytes);
+            case Regex:
+                return searchRegex(task, provider, searchRegion, settings.regex);
+            case BinaryPattern:
+                return searchBinaryPattern(task, provider, searchRegion, settings.binaryPattern);
+            case Value:
+                return searchValue(task, provider, searchRegion, settings.value);
+        }
+
+        return { };
+    }
+
+    std::optional<size_t> ViewFind::getPatternSize(const SearchSettings &settings) {
+        switch (settings.mode) {
+            using enum SearchSettings::Mode;
+            case Sequence:
+                if (settings.bytes.multiPattern) {
+                    // Parallel chunks only need to overlap by the longest pattern
+                    size_t maxSize = 0;
+                    for (const auto &line : hex::splitString(settings.bytes.sequence, "\n"))
+                        maxSize = std::max(maxSize, hex::decodeByteString(line).size());
+
+                    return maxSize;
+                }
+
+                return hex::decodeByteString(settings.bytes.sequence).size();
+            case BinaryPattern:
+                return settings.binaryPattern.pattern.size();
+            case Value: {
+                const auto [valid, min, size] = parseNumericValueInput(settings.value.inputMin, settings.value.type);
+                hex::unused(valid, min);
+                return size;
+            }
+            default:
+                // String and regex matches have no fixed length
+                return std::nullopt;
+        }
+    }
+
+    std::vector<ViewFind::Occurrence> ViewFind::searchWithSettingsParallel(Task &task, prv::Provider *provider, const std::vector<Region> &searchRegions, const SearchSettings &settings) {
+        std::vector<Occurrence> results;
+
+        // Matches of these modes have a fixed maximum length, so the regions can be cut into
+        // independent chunks that only need to overlap by the pattern length. String and regex
+        // matches can get arbitrarily long, those modes keep searching sequentially
+        const auto patternSize = getPatternSize(settings);
+
+        struct Chunk {
+            Region region;
+            u64 scanLimit;    // Matches starting at or past this address belong to the next chunk
+        };
+
+        constexpr static u64 ChunkSize = 0x100'0000;
+
+        std::vector<Chunk> chunks;
+        if (patternSize.has_value() && *patternSize > 0) {
+            for (const auto &region : searchRegions) {
+                for (u64 address = region.getStartAddress(); address <= region.getEndAddress(); address += ChunkSize) {
+                    const auto chunkEnd = std::min<u64>(region.getEndAddress(), (address + ChunkSize - 1) + (*patternSize - 1));
+                    chunks.push_back(Chunk { Region { address, (chunkEnd - address) + 1 }, address + ChunkSize });
+                }
+            }
+        }
+
+        const auto threadCount = std::min<size_t>(std::max<u32>(std::thread::hardware_concurrency(), 1), chunks.size());
+        if (threadCount <= 1) {
+            for (const auto &region : searchRegions) {
+                auto regionOccurrences = searchWithSettings(task, provider, region, settings);
+                std::move(regionOccurrences.begin(), regionOccurrences.end(), std::back_inserter(results));
+            }
+
+            return results;
+        }
+
+        std::vector<std::vector<Occurrence>> chunkResults(chunks.size());
+        std::atomic<size_t> nextChunk       = 0;
+        std::atomic<size_t> finishedChunks  = 0;
+        std::atomic<u64> progress           = 0;
+        std::atomic<bool> stop              = false;
+
+        const auto worker = [&] {
+            // Chunks get handed out dynamically, so workers that draw cheap chunks
+            // (sparse or already cached pages) simply grab more work from the rest
+            while (!stop) {
+                const auto chunkIndex = nextChunk++;
+                if (chunkIndex >= chunks.size())
+                    break;
+
+                const auto &chunk = chunks[chunkIndex];
+
+                Task chunkTask;
+                auto occurrences = searchWithSettings(chunkTask, provider, chunk.region, settings);
+
+                // The next chunk reports the matches inside this chunk's overlap extension
+                std::erase_if(occurrences, [&chunk](const auto &occurrence) {
+                    return occurrence.region.getStartAddress() >= chunk.scanLimit;
+                });
+
+                chunkResults[chunkIndex] = std::move(occurrences);
+
+                progress += chunk.region.getSize();
+                finishedChunks++;
+            }
+        };
+
+        {
+            std::vector<std::jthread> workers;
+            for (size_t i = 0; i < threadCount; i++)
+                workers.emplace_back(worker);
+
+            // Interrupting the search makes update() throw; the workers notice the stop
+            // flag at their next chunk boundary and get joined on the way out
+            try {
+                while (finishedChunks < chunks.size()) {
+                    task.update(progress);
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                }
+
+                task.update(progress);
+            } catch (...) {
+                stop = true;
+                throw;
+            }
+        }
+
+        // The chunks were created in ascending address order and each chunk's results are
+        // sorted already, so concatenating keeps the merged result sorted
+        for (auto &chunkResult : chunkResults)
+            std::move(chunkResult.begin(), chunkResult.end(), std::back_inserter(results));
+
+        return results;
+    }
+
     void ViewFind::runSearch() {
         Region searchRegion = [this]{
             if (this->m_searchSettings.range == ui::SelectedRegion::EntireData || !ImHexApi::HexEditor::isSelectionValid()) {
@@ -447,34 +992,100 @@ namespace hex::plugin::builtin {
             }
         }();
 
-        this->m_searchTask = TaskManager::createTask("hex.builtin.view.find.searching", searchRegion.getSize(), [this, settings = this->m_searchSettings, searchRegion](auto &task) {
+        // Split the search region at unallocated regions of sparse files. Holes only read as
+        // zeros, so skipping them entirely avoids scanning gigabytes of nothing
+        std::vector<Region> subRegions;
+        {
             auto provider = ImHexApi::Provider::get();
 
-            switch (settings.mode) {
-                using enum SearchSettings::Mode;
-                case Strings:
-                    this->m_foundOccurrences[provider] = searchStrings(task, provider, searchRegion, settings.strings);
+            for (u64 address = searchRegion.getStartAddress(); address <= searchRegion.getEndAddress();) {
+                const auto [region, hasData] = provider->getRegionValidity(address);
+                if (region == Region::Invalid() || region.getEndAddress() < address)
                     break;
-                case Sequence:
-                    this->m_foundOccurrences[provider] = searchSequence(task, provider, searchRegion, settings.bytes);
-                    break;
-                case Regex:
-                    this->m_foundOccurrences[provider] = searchRegex(task, provider, searchRegion, settings.regex);
-                    break;
-                case BinaryPattern:
-                    this->m_foundOccurrences[provider] = searchBinaryPattern(task, provider, searchRegion, settings.binaryPattern);
-                    break;
-                case Value:
-                    this->m_foundOccurrences[provider] = searchValue(task, provider, searchRegion, settings.value);
+
+                const auto end = std::min(region.getEndAddress(), searchRegion.getEndAddress());
+                if (hasData)
+                    subRegions.push_back(Region { address, (end - address) + 1 });
+
+                if (end >= searchRegion.getEndAddress())
                     break;
+                address = end + 1;
             }
 
-            this->m_sortedOccurrences[provider] = this->m_foundOccurrences[provider];
+            // Providers without meaningful validity information get searched as one region
+            if (subRegions.empty())
+                subRegions.push_back(searchRegion);
+        }
+
+        this->m_searchTask = TaskManager::createTask("hex.builtin.view.find.searching", searchRegion.getSize(), [this, settings = this->m_searchSettings, searchRegion, subRegions](auto &task) {
+            auto provider = ImHexApi::Provider::get();
+
+            auto occurrences = searchWithSettingsParallel(task, provider, subRegions, settings);
+
+            // Whole-data searches can be extended incrementally when data gets appended
+            if (settings.range == ui::SelectedRegion::EntireData)
+                this->m_searchedEnd[provider] = searchRegion.getEndAddress() + 1;
+            else
+                this->m_searchedEnd.erase(provider);
+
+            this->m_foundOccurrences[provider] = std::move(occurrences);
+            this->updateOccurrenceIndex(provider);
+        });
+    }
+
+    void ViewFind::exportResults(prv::Provider *provider, bool asJson) {
+        if (this->m_exportTask.isRunning())
+            return;
+
+        const std::string formatName = asJson ? "JSON lines" : "CSV";
+        const std::string extension  = asJson ? "jsonl" : "csv";
+
+        fs::openFileBrowser(fs::DialogMode::Save, { { formatName, extension } }, [this, provider, asJson](const std::fs::path &path) {
+            this->m_exportTask = TaskManager::createTask("hex.builtin.view.find.exporting", this->m_foundOccurrences[provider].size(), [this, provider, asJson, path](auto &task) {
+                // One line per occurrence, streamed to disk chunk-wise, so the export
+                // runs at constant memory no matter how many hits the search produced
+                constexpr static size_t WriteBufferSize = 0x10'0000;
+
+                fs::File file(path, fs::File::Mode::Create);
+                if (!file.isValid())
+                    return;
+
+                const auto &occurrences = this->m_foundOccurrences[provider];
+
+                std::string buffer;
+                buffer.reserve(WriteBufferSize + 0x1000);
+
+                if (!asJson)
+                    buffer += "address,size,value\n";
+
+                for (size_t index = 0; index < occurrences.size(); index++) {
+                    task.update(index);
+
+                    const auto &occurrence = occurrences[index];
+                    const auto value       = this->decodeValue(provider, occurrence);
+
+                    if (asJson) {
+                        const nlohmann::json line = {
+                            { "address", occurrence.region.getStartAddress() },
+                            { "size",    occurrence.region.getSize()         },
+                            { "value",   value                               }
+                        };
+
+                        buffer += line.dump();
+                        buffer += '\n';
+                    } else {
+                        // The value column is quoted with embedded quotes doubled, per RFC 4180
+                        buffer += hex::format("0x{:X},{},\"{}\"\n", occurrence.region.getStartAddress(), occurrence.region.getSize(), hex::replaceStrings(value, "\"", "\"\""));
+                    }
+
+                    if (buffer.size() >= WriteBufferSize) {
+                        file.write(buffer);
+                        buffer.clear();
+                    }
+                }
 
-            OccurrenceTree::interval_vector intervals;
-            for (const auto &occurrence : this->m_foundOccurrences[provider])
-                intervals.push_back(OccurrenceTree::interval(occurrence.region.getStartAddress(), occurrence.region.getEndAddress(), occurrence));
-            this->m_occurrenceTree[provider] = std::move(intervals);
+                file.write(buffer);
+            });
         });
     }
 
@@ -527,6 +1138,54 @@ namespace hex::plugin::builtin {
         return result;
     }
 
+    void ViewFind::updateOccurrenceIndex(prv::Provider *provider) {
+        auto &occurrences = this->m_foundOccurrences[provider];
+
+        // Keeping the packed occurrence list sorted by start address makes
+        // lookups from the hex editor a binary search
+        std::sort(occurrences.begin(), occurrences.end(), [](const auto &left, const auto &right) {
+            return left.region.getStartAddress() < right.region.getStartAddress();
+        });
+
+        size_t maxSize = 0;
+        for (const auto &occurrence : occurrences)
+            maxSize = std::max<size_t>(maxSize, occurrence.region.getSize());
+        this->m_maxOccurrenceSize[provider] = maxSize;
+
+        auto &displayIndices = this->m_sortedOccurrenceIndices[provider];
+        displayIndices.resize(occurrences.size());
+        std::iota(displayIndices.begin(), displayIndices.end(), 0);
+    }
+
+    std::vector<const ViewFind::Occurrence *> ViewFind::getOccurrencesAt(prv::Provider *provider, u64 address) const {
+        auto foundOccurrences = this->m_foundOccurrences.find(provider);
+        if (foundOccurrences == this->m_foundOccurrences.end() || foundOccurrences->second.empty())
+            return { };
+
+        const auto &occurrences = foundOccurrences->second;
+
+        size_t maxSize = 0;
+        if (auto maxSizeEntry = this->m_maxOccurrenceSize.find(provider); maxSizeEntry != this->m_maxOccurrenceSize.end())
+            maxSize = maxSizeEntry->second;
+        if (maxSize == 0)
+            return { };
+
+        // Only occurrences starting at most one maximum occurrence length before the address can overlap it
+        const u64 lowestStart = address - std::min<u64>(address, maxSize - 1);
+
+        auto candidate = std::lower_bound(occurrences.begin(), occurrences.end(), lowestStart, [](const Occurrence &occurrence, u64 startAddress) {
+            return occurrence.region.getStartAddress() < startAddress;
+        });
+
+        std::vector<const Occurrence *> result;
+        for (; candidate != occurrences.end() && candidate->region.getStartAddress() <= address; ++candidate) {
+            if (candidate->region.getEndAddress() >= address)
+                result.push_back(&*candidate);
+        }
+
+        return result;
+    }
+
     static void drawContextMenu(const std::string &value) {
         if (ImGui::IsMouseClicked(ImGuiMouseButton_Right) && ImGui::IsItemHovered()) {
             ImGui::OpenPopup("FindContextMenu");
@@ -602,9 +1261,21 @@ namespace hex::plugin::builtin {
 
                         mode = SearchSettings::Mode::Sequence;
 
-                        ImGui::InputTextIcon("hex.builtin.common.value"_lang, ICON_VS_SYMBOL_KEY, settings.sequence);
+                        if (settings.multiPattern) {
+                            ImGui::InputTextMultiline("hex.builtin.common.value"_lang, settings.sequence);
+
+                            bool anyPattern = false;
+                            for (const auto &line : hex::splitString(settings.sequence, "\n"))
+                                anyPattern = anyPattern || !hex::decodeByteString(line).empty();
+
+                            this->m_settingsValid = anyPattern;
+                        } else {
+                            ImGui::InputTextIcon("hex.builtin.common.value"_lang, ICON_VS_SYMBOL_KEY, settings.sequence);
+
+                            this->m_settingsValid = !settings.sequence.empty() && !hex::decodeByteString(settings.sequence).empty();
+                        }
 
-                        this->m_settingsValid = !settings.sequence.empty() && !hex::decodeByteString(settings.sequence).empty();
+                        ImGui::Checkbox("hex.builtin.view.find.sequences.multi"_lang, &settings.multiPattern);
 
                         ImGui::EndTabItem();
                     }
@@ -728,9 +1399,17 @@ namespace hex::plugin::builtin {
                 {
                     if (ImGui::Button("hex.builtin.view.find.search.reset"_lang)) {
                         this->m_foundOccurrences[provider].clear();
-                        this->m_sortedOccurrences[provider].clear();
-                        this->m_occurrenceTree[provider].clear();
+                        this->m_sortedOccurrenceIndices[provider].clear();
+                        this->m_maxOccurrenceSize[provider] = 0;
                     }
+
+                    ImGui::SameLine();
+                    if (ImGui::Button("hex.builtin.view.find.search.export.csv"_lang))
+                        this->exportResults(provider, false);
+
+                    ImGui::SameLine();
+                    if (ImGui::Button("hex.builtin.view.find.search.export.json"_lang))
+                        this->exportResults(provider, true);
                 }
                 ImGui::EndDisabled();
             }
@@ -740,15 +1419,17 @@ namespace hex::plugin::builtin {
             ImGui::Separator();
             ImGui::NewLine();
 
-            auto &currOccurrences = this->m_sortedOccurrences[provider];
+            const auto &occurrences = this->m_foundOccurrences[provider];
+            auto &displayIndices    = this->m_sortedOccurrenceIndices[provider];
 
             ImGui::PushItemWidth(ImGui::GetContentRegionAvail().x);
             if (ImGui::InputTextWithHint("##filter", "hex.builtin.common.filter"_lang, this->m_currFilter[provider])) {
-                this->m_sortedOccurrences[provider] = this->m_foundOccurrences[provider];
+                displayIndices.resize(occurrences.size());
+                std::iota(displayIndices.begin(), displayIndices.end(), 0);
 
-                currOccurrences.erase(std::remove_if(currOccurrences.begin(), currOccurrences.end(), [this, provider](const auto &region) {
-                    return !this->decodeValue(provider, region).contains(this->m_currFilter[provider]);
-                }), currOccurrences.end());
+                std::erase_if(displayIndices, [this, provider, &occurrences](size_t index) {
+                    return !this->decodeValue(provider, occurrences[index]).contains(this->m_currFilter[provider]);
+                });
             }
             ImGui::PopItemWidth();
 
@@ -761,7 +1442,11 @@ namespace hex::plugin::builtin {
                 auto sortSpecs = ImGui::TableGetSortSpecs();
 
                 if (sortSpecs->SpecsDirty) {
-                    std::sort(currOccurrences.begin(), currOccurrences.end(), [this, &sortSpecs, provider](Occurrence &left, Occurrence &right) -> bool {
+                    // Sorting only rearranges the display indices; the occurrences themselves stay address-sorted
+                    std::sort(displayIndices.begin(), displayIndices.end(), [this, &sortSpecs, provider, &occurrences](size_t leftIndex, size_t rightIndex) -> bool {
+                        const auto &left  = occurrences[leftIndex];
+                        const auto &right = occurrences[rightIndex];
+
                         if (sortSpecs->Specs->ColumnUserID == ImGui::GetID("offset")) {
                             if (sortSpecs->Specs->SortDirection == ImGuiSortDirection_Ascending)
                                 return left.region.getStartAddress() > right.region.getStartAddress();
@@ -788,11 +1473,11 @@ namespace hex::plugin::builtin {
                 ImGui::TableHeadersRow();
 
                 ImGuiListClipper clipper;
-                clipper.Begin(currOccurrences.size(), ImGui::GetTextLineHeightWithSpacing());
+                clipper.Begin(displayIndices.size(), ImGui::GetTextLineHeightWithSpacing());
 
                 while (clipper.Step()) {
-                    for (size_t i = clipper.DisplayStart; i < std::min<size_t>(clipper.DisplayEnd, currOccurrences.size()); i++) {
-                        auto &foundItem = currOccurrences[i];
+                    for (size_t i = clipper.DisplayStart; i < std::min<size_t>(clipper.DisplayEnd, displayIndices.size()); i++) {
+                        const auto &foundItem = occurrences[displayIndices[i]];
 
                         ImGui::TableNextRow();
                         ImGui::TableNextColumn();
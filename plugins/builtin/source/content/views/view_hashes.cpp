@@ -1,13 +1,32 @@
 #include "content/views/view_hashes.hpp"
 
+#include <content/helpers/file_hashes.hpp>
+
 #include <hex/helpers/crypto.hpp>
+#include <hex/helpers/literals.hpp>
+#include <hex/providers/chunk_pipeline.hpp>
 
 #include <vector>
 
 namespace hex::plugin::builtin {
 
+    using namespace hex::literals;
+
     ViewHashes::ViewHashes() : View("hex.builtin.view.hashes.name") {
         EventManager::subscribe<EventRegionSelected>(this, [this](const Region &) {
+            // Streamable hashes keep their last complete digest on display until their
+            // rolling contexts have caught up with the new selection
+            for (auto &function : this->m_hashFunctions) {
+                if (!function.isStreamable())
+                    function.reset();
+            }
+        });
+
+        EventManager::subscribe<EventProviderChanged>(this, [this](prv::Provider *, prv::Provider *) {
+            this->m_liveContexts.clear();
+            this->m_liveStart.reset();
+            this->m_liveProcessed = 0;
+
             for (auto &function : this->m_hashFunctions)
                 function.reset();
         });
@@ -31,6 +50,10 @@ namespace hex::plugin::builtin {
                         ImGui::Indent();
                         if (ImGui::BeginTable("##hashes_tooltip", 3, ImGuiTableFlags_NoHostExtendX | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit)) {
                             auto provider  = ImHexApi::Provider::get();
+
+                            if (provider != nullptr)
+                                this->updateHashes(*selection, provider);
+
                             for (auto &function : this->m_hashFunctions) {
                                 ImGui::TableNextRow();
                                 ImGui::TableNextColumn();
@@ -40,8 +63,12 @@ namespace hex::plugin::builtin {
                                 ImGui::TextFormatted("    ");
 
                                 ImGui::TableNextColumn();
-                                if (provider != nullptr)
-                                    ImGui::TextFormatted("{}", crypt::encode16(function.get(*selection, provider)));
+                                if (provider != nullptr) {
+                                    if (!function.isStreamable() || function.isCached())
+                                        ImGui::TextFormatted("{}", crypt::encode16(function.get(*selection, provider)));
+                                    else
+                                        ImGui::TextUnformatted("...");
+                                }
                             }
 
                             ImGui::EndTable();
@@ -59,9 +86,57 @@ namespace hex::plugin::builtin {
 
     ViewHashes::~ViewHashes() {
         EventManager::unsubscribe<EventRegionSelected>(this);
+        EventManager::unsubscribe<EventProviderChanged>(this);
     }
 
 
+    void ViewHashes::updateHashes(const Region &region, prv::Provider *provider) {
+        // Streamable hashes roll forward: while the selection keeps its start address
+        // and only grows, each context is fed just the newly selected bytes from one
+        // shared read. Any other selection change starts the contexts over. Large
+        // jumps are consumed in per-frame slices, with the last complete digests
+        // staying on display until the contexts have caught up
+        constexpr static u64 FrameBudget = 16_MiB;
+
+        const bool extendable = this->m_liveStart == region.getStartAddress()
+                             && this->m_liveProcessed <= region.getSize()
+                             && this->m_liveContexts.size() == this->m_hashFunctions.size();
+
+        if (!extendable) {
+            this->m_liveContexts.clear();
+            for (auto &function : this->m_hashFunctions)
+                this->m_liveContexts.push_back(function.isStreamable() ? function.createContext() : nullptr);
+
+            this->m_liveStart     = region.getStartAddress();
+            this->m_liveProcessed = 0;
+        }
+
+        if (this->m_liveProcessed < region.getSize()) {
+            const u64 sliceAddress = region.getStartAddress() + this->m_liveProcessed;
+            const u64 sliceSize    = std::min<u64>(region.getSize() - this->m_liveProcessed, FrameBudget);
+
+            prv::ChunkPipeline pipeline(provider, sliceAddress, sliceSize);
+            for (auto &context : this->m_liveContexts) {
+                if (context != nullptr) {
+                    pipeline.subscribe([&context](u64, const u8 *data, size_t size) {
+                        context->update(data, size);
+                    });
+                }
+            }
+
+            pipeline.process();
+
+            this->m_liveProcessed += sliceSize;
+        }
+
+        if (this->m_liveProcessed == region.getSize()) {
+            for (size_t i = 0; i < this->m_hashFunctions.size(); i++) {
+                if (this->m_liveContexts[i] != nullptr)
+                    this->m_hashFunctions[i].setCache(this->m_liveContexts[i]->finish());
+            }
+        }
+    }
+
     void ViewHashes::drawContent() {
         const auto &hashes = ContentRegistry::Hashes::impl::getHashes();
 
@@ -70,6 +145,15 @@ namespace hex::plugin::builtin {
         }
 
         if (ImGui::Begin(View::toWindowName("hex.builtin.view.hashes.name").c_str(), &this->getWindowOpenState(), ImGuiWindowFlags_NoCollapse)) {
+            // The whole-file digests come straight from the background cache computed
+            // when the provider was opened, no matter what's currently selected
+            if (ImHexApi::Provider::isValid()) {
+                ImGui::Header("hex.builtin.view.hashes.file_hashes"_lang, true);
+                drawFileHashes(ImHexApi::Provider::get());
+
+                ImGui::NewLine();
+            }
+
             if (ImGui::BeginCombo("hex.builtin.view.hashes.function"_lang, this->m_selectedHash != nullptr ? LangEntry(this->m_selectedHash->getUnlocalizedName()) : "")) {
 
                 for (const auto hash : hashes) {
@@ -120,6 +204,9 @@ namespace hex::plugin::builtin {
                 auto provider  = ImHexApi::Provider::get();
                 auto selection = ImHexApi::HexEditor::getSelection();
 
+                if (provider != nullptr && selection.has_value())
+                    this->updateHashes(*selection, provider);
+
                 std::optional<u32> indexToRemove;
                 for (u32 i = 0; i < this->m_hashFunctions.size(); i++) {
                     auto &function = this->m_hashFunctions[i];
@@ -154,10 +241,14 @@ namespace hex::plugin::builtin {
 
                     ImGui::TableNextColumn();
                     std::string result;
-                    if (provider != nullptr && selection.has_value())
-                        result = crypt::encode16(function.get(*selection, provider));
-                    else
+                    if (provider != nullptr && selection.has_value()) {
+                        if (!function.isStreamable() || function.isCached())
+                            result = crypt::encode16(function.get(*selection, provider));
+                        else
+                            result = "...";
+                    } else {
                         result = "???";
+                    }
 
                     ImGui::PushItemWidth(ImGui::GetContentRegionAvail().x);
                     ImGui::InputText("##result", result, ImGuiInputTextFlags_ReadOnly);
@@ -2,18 +2,86 @@
 
 #include <hex/api/content_registry.hpp>
 #include <hex/helpers/utils.hpp>
+#include <hex/helpers/file.hpp>
+#include <hex/helpers/literals.hpp>
 #include <hex/providers/buffered_reader.hpp>
+#include <hex/providers/cached_provider.hpp>
+#include <hex/providers/frame_read_cache.hpp>
+#include <hex/providers/io_tracer.hpp>
 #include <hex/helpers/crypto.hpp>
 
 #include <content/helpers/math_evaluator.hpp>
+#include <content/helpers/selection_statistics.hpp>
 
 #include <imgui_internal.h>
 #include <nlohmann/json.hpp>
+#include <IntervalTree.h>
 
+#include <array>
+#include <cctype>
+#include <cstring>
+#include <memory>
+#include <mutex>
 #include <thread>
 
 namespace hex::plugin::builtin {
 
+    using namespace hex::literals;
+
+    // Number of rows the editor table spans at once. Scrolling past a segment's edge
+    // shifts the segment instead of the scroll position, so this only needs to be small
+    // enough for the scroll position in pixels to stay exactly representable in a float
+    constexpr static u64 ScrollSegmentRows = 0x8'0000;
+
+    // Parses a hex string with arbitrary interspersed whitespace into bytes. Clipboard
+    // pastes can be hundreds of megabytes, so validation, whitespace skipping and
+    // decoding all happen in a single table-driven pass without rewriting the input
+    static std::optional<std::vector<u8>> parseHexString(std::string_view string) {
+        // Hex digit value per character; -1 marks invalid characters, -2 whitespace
+        constexpr static auto HexValue = [] {
+            std::array<i8, 0x100> table = {};
+            table.fill(-1);
+
+            for (u8 character = '0'; character <= '9'; character++)
+                table[character] = i8(character - '0');
+            for (u8 character = 'A'; character <= 'F'; character++)
+                table[character] = i8(character - 'A' + 0x0A);
+            for (u8 character = 'a'; character <= 'f'; character++)
+                table[character] = i8(character - 'a' + 0x0A);
+            for (u8 character : std::string_view(" \t\n\v\f\r"))
+                table[character] = -2;
+
+            return table;
+        }();
+
+        std::vector<u8> result;
+        result.reserve(string.size() / 2);
+
+        u8 currentByte  = 0x00;
+        bool highNibble = true;
+        for (u8 character : string) {
+            const auto value = HexValue[character];
+
+            if (value == -2)
+                continue;
+            if (value == -1)
+                return std::nullopt;
+
+            if (highNibble)
+                currentByte = u8(value) << 4;
+            else
+                result.push_back(currentByte | u8(value));
+
+            highNibble = !highNibble;
+        }
+
+        // Only whole bytes can be parsed
+        if (!highNibble)
+            return std::nullopt;
+
+        return result;
+    }
+
     /* Popups */
 
     class PopupGoto : public ViewHexEditor::Popup {
@@ -64,7 +132,7 @@ namespace hex::plugin::builtin {
                                 }
                                 break;
                             case Mode::Begin: {
-                                    newAddress = provider->getBaseAddress() + provider->getCurrentPageAddress() + inputResult;
+                                    newAddress = provider->getBaseAddress() + inputResult;
                                 }
                                 break;
                             case Mode::End: {
@@ -147,13 +215,23 @@ namespace hex::plugin::builtin {
     public:
         PopupFind() {
             EventManager::subscribe<EventRegionSelected>(this, [this](Region region) {
-                this->m_searchPosition = this->m_nextSearchPosition.value_or(region.getStartAddress());
-                this->m_nextSearchPosition.reset();
+                this->m_searchPosition = region.getStartAddress();
+
+                // Selections made by the user move the search cursor, but the ones
+                // the search itself makes must not clobber the match position
+                if (this->m_currentMatch != region.getStartAddress())
+                    this->m_currentMatch.reset();
+            });
+
+            // Edits can add or destroy matches, so the cached session goes stale
+            EventManager::subscribe<EventRegionDirtied>(this, [this](prv::Provider *, const Region &) {
+                this->m_session.reset();
             });
         }
 
         ~PopupFind() override {
             EventManager::unsubscribe<EventRegionSelected>(this);
+            EventManager::unsubscribe<EventRegionDirtied>(this);
         }
 
         void draw(ViewHexEditor *editor) override {
@@ -202,34 +280,22 @@ namespace hex::plugin::builtin {
                 ImGui::EndTabBar();
             }
 
-            if (!this->m_searchTask.isRunning() && !searchSequence.empty() && this->m_shouldSearch) {
-                this->m_searchTask = TaskManager::createTask("hex.builtin.common.processing", ImHexApi::Provider::get()->getActualSize(), [this, editor, searchSequence](auto &) {
-                    for (u8 retry = 0; retry < 2; retry++) {
-                        auto region = this->findSequence(searchSequence, this->m_backwards);
-
-                        if (region.has_value()) {
-                            if (ViewHexEditor::getSelection() == region) {
-                                if (this->m_nextSearchPosition.has_value())
-                                    this->m_searchPosition = this->m_nextSearchPosition.value();
-                                this->m_nextSearchPosition.reset();
+            if (!searchSequence.empty() && this->m_shouldSearch) {
+                auto provider = ImHexApi::Provider::get();
 
-                                continue;
-                            } else {
-                                TaskManager::doLater([editor, region]{
-                                    editor->setSelection(region->getStartAddress(), region->getEndAddress());
-                                    editor->jumpToSelection();
-                                });
+                // As long as the sequence and the data stayed the same, the previous scan's
+                // results are still valid and every find-next is just a lookup into them
+                if (this->m_session != nullptr && this->m_session->sequence == searchSequence && this->m_session->provider == provider) {
+                    this->navigate(editor, this->m_backwards);
 
-                                break;
-                            }
-                        } else {
-                            this->m_reachedEnd = true;
-                        }
-                    }
+                    this->m_shouldSearch = false;
+                    this->m_requestFocus = true;
+                } else if (!this->m_searchTask.isRunning()) {
+                    this->startSession(editor, searchSequence);
 
                     this->m_shouldSearch = false;
                     this->m_requestFocus = true;
-                });
+                }
             }
         }
 
@@ -250,11 +316,9 @@ namespace hex::plugin::builtin {
                     this->m_shouldSearch = true;
                     this->m_backwards = false;
                     this->m_reachedEnd = false;
-                    this->m_searchPosition.reset();
-                    this->m_nextSearchPosition.reset();
                 }
 
-                ImGui::BeginDisabled(!this->m_searchPosition.has_value());
+                ImGui::BeginDisabled(this->m_session == nullptr);
                 {
                     ImGui::BeginDisabled(this->m_reachedEnd && this->m_backwards);
                     {
@@ -284,38 +348,144 @@ namespace hex::plugin::builtin {
             ImGui::EndDisabled();
         }
 
-        std::optional<Region> findSequence(const std::vector<u8> &sequence, bool backwards) {
-            hex::prv::BufferedReader reader(ImHexApi::Provider::get());
+        // One scan per sequence: the background task fills the match list once and
+        // every subsequent find-next/find-prev becomes a lookup into it
+        struct SearchSession {
+            std::vector<u8> sequence;
+            prv::Provider *provider = nullptr;
 
-            reader.seek(this->m_searchPosition.value_or(0x00));
+            std::mutex mutex;
+            std::vector<u64> matches;
+            std::atomic<bool> complete = false;
+        };
 
-            constexpr static auto searchFunction = [](const auto &haystackBegin, const auto &haystackEnd, const auto &needleBegin, const auto &needleEnd) {
-                return std::search(haystackBegin, haystackEnd, std::boyer_moore_horspool_searcher(needleBegin, needleEnd));
-            };
+        void startSession(ViewHexEditor *editor, const std::vector<u8> &sequence) {
+            auto session = std::make_shared<SearchSession>();
+            session->sequence = sequence;
+            session->provider = ImHexApi::Provider::get();
+
+            this->m_session = session;
+            this->m_currentMatch.reset();
+
+            const u64 endAddress = session->provider->getActualSize();
+            const u64 cursor     = std::min(this->m_searchPosition.value_or(0x00), endAddress);
+
+            this->m_searchTask = TaskManager::createTask("hex.builtin.common.processing", endAddress, [this, editor, session, cursor, endAddress](auto &task) {
+                constexpr static size_t ChunkSize = 0x10'0000;
+
+                const auto &sequence = session->sequence;
+                auto reader = prv::BufferedReader(session->provider);
+
+                u64 progress = 0;
+                bool firstReported = false;
+
+                // Reports every match starting inside [begin, end), allowing the
+                // sequence itself to run past 'end' so straddling matches aren't lost
+                auto scanRange = [&](u64 begin, u64 end) {
+                    if (begin >= end)
+                        return;
 
-            if (!backwards) {
-                auto occurrence = searchFunction(reader.begin(), reader.end(), sequence.begin(), sequence.end());
-                if (occurrence != reader.end()) {
-                    this->m_nextSearchPosition = occurrence.getAddress() + sequence.size();
-                    return Region { occurrence.getAddress(), sequence.size() };
+                    reader.seek(begin);
+                    reader.setEndAddress(end + sequence.size() - 2);
+
+                    for (u64 address = begin; address < end; address += ChunkSize) {
+                        auto chunk = reader.readSpan(address, ChunkSize + (sequence.size() - 1));
+                        if (chunk.size() < sequence.size())
+                            break;
+
+                        const u8 *candidate     = chunk.data();
+                        const u8 *const scanEnd = chunk.data() + (chunk.size() - sequence.size()) + 1;
+                        while (candidate < scanEnd) {
+                            candidate = static_cast<const u8*>(std::memchr(candidate, sequence[0], scanEnd - candidate));
+                            if (candidate == nullptr)
+                                break;
+
+                            // Starts inside the overlap tail belong to the next chunk
+                            const u64 matchAddress = address + (candidate - chunk.data());
+                            if (matchAddress >= std::min<u64>(end, address + ChunkSize))
+                                break;
+
+                            if (std::memcmp(candidate, sequence.data(), sequence.size()) == 0) {
+                                {
+                                    std::scoped_lock lock(session->mutex);
+                                    session->matches.push_back(matchAddress);
+                                }
+
+                                // The first match past the cursor is selected right away,
+                                // the rest keep filling in behind it
+                                if (!firstReported) {
+                                    firstReported = true;
+
+                                    TaskManager::doLater([this, editor, matchAddress, size = sequence.size()] {
+                                        this->m_currentMatch = matchAddress;
+                                        editor->setSelection(matchAddress, matchAddress + size - 1);
+                                        editor->jumpToSelection();
+                                    });
+                                }
+                            }
+
+                            candidate++;
+                        }
+
+                        progress += std::min<u64>(ChunkSize, end - address);
+                        task.update(progress);
+                    }
+                };
+
+                // Everything past the cursor first so the visible hit shows up as
+                // soon as possible, then the wrapped-around remainder
+                scanRange(cursor, endAddress);
+                scanRange(0x00, cursor);
+
+                {
+                    std::scoped_lock lock(session->mutex);
+                    std::sort(session->matches.begin(), session->matches.end());
                 }
-            } else {
-                auto occurrence = searchFunction(reader.rbegin(), reader.rend(), sequence.rbegin(), sequence.rend());
-                if (occurrence != reader.rend()) {
-                    if (occurrence.getAddress() < sequence.size())
-                        this->m_nextSearchPosition = 0x00;
-                    else
-                        this->m_nextSearchPosition = occurrence.getAddress() - sequence.size();
+                session->complete = true;
+
+                if (!firstReported)
+                    this->m_reachedEnd = true;
+            });
+        }
+
+        void navigate(ViewHexEditor *editor, bool backwards) {
+            auto session = this->m_session;
+            if (session == nullptr)
+                return;
+
+            const bool haveCurrent = this->m_currentMatch.has_value();
+            const u64 from = haveCurrent ? this->m_currentMatch.value() : this->m_searchPosition.value_or(0x00);
 
-                    return Region { occurrence.getAddress() - (sequence.size() - 1), sequence.size() };
+            // While the scan is still running the list is unsorted, so simply take
+            // the closest match in the wanted direction instead of binary searching
+            std::optional<u64> target;
+            {
+                std::scoped_lock lock(session->mutex);
+                for (const auto address : session->matches) {
+                    if (backwards) {
+                        if (address < from && (!target.has_value() || address > target.value()))
+                            target = address;
+                    } else {
+                        if ((address > from || (!haveCurrent && address >= from)) && (!target.has_value() || address < target.value()))
+                            target = address;
+                    }
                 }
             }
 
-            return std::nullopt;
+            if (target.has_value()) {
+                this->m_currentMatch = target;
+
+                const auto size = session->sequence.size();
+                editor->setSelection(target.value(), target.value() + size - 1);
+                editor->jumpToSelection();
+            } else if (session->complete) {
+                this->m_reachedEnd = true;
+            }
         }
 
         std::string m_input;
-        std::optional<u64> m_searchPosition, m_nextSearchPosition;
+        std::optional<u64> m_searchPosition, m_currentMatch;
+        std::shared_ptr<SearchSession> m_session;
 
         bool m_requestFocus = true;
         std::atomic<bool> m_shouldSearch = false;
@@ -455,6 +625,60 @@ namespace hex::plugin::builtin {
         u64 m_size;
     };
 
+    class PopupFill : public ViewHexEditor::Popup {
+    public:
+        PopupFill(u64 address, size_t size) : m_address(address), m_size(size) {}
+
+        void draw(ViewHexEditor *editor) override {
+            ImGui::TextUnformatted("hex.builtin.view.hex_editor.menu.edit.fill"_lang);
+
+            ImGui::InputHexadecimal("hex.builtin.common.address"_lang, &this->m_address);
+            ImGui::InputHexadecimal("hex.builtin.common.size"_lang, &this->m_size);
+
+            ImGui::InputTextIcon("hex.builtin.view.hex_editor.fill.pattern"_lang, ICON_VS_SYMBOL_OPERATOR, this->m_input);
+
+            View::confirmButtons("hex.builtin.common.set"_lang, "hex.builtin.common.cancel"_lang,
+                [&, this]{
+                    fill(this->m_address, static_cast<size_t>(this->m_size), this->m_input);
+                    editor->closePopup();
+                },
+                [&]{
+                    editor->closePopup();
+                });
+        }
+
+    private:
+        static void fill(u64 address, size_t size, const std::string &input) {
+            if (!ImHexApi::Provider::isValid())
+                return;
+
+            auto provider = ImHexApi::Provider::get();
+            if (address >= provider->getActualSize() || size == 0)
+                return;
+            size = std::min<size_t>(size, provider->getActualSize() - address);
+
+            auto pattern = parseHexString(input);
+            if (!pattern.has_value() || pattern->empty())
+                return;
+
+            // The pattern is repeated into a block first so the provider sees a few
+            // large bulk patches instead of one patch per repetition
+            const size_t blockSize = std::max(1_MiB - 1_MiB % pattern->size(), pattern->size());
+            std::vector<u8> block(blockSize);
+            for (size_t offset = 0; offset < block.size(); offset += pattern->size())
+                std::memcpy(block.data() + offset, pattern->data(), std::min(pattern->size(), block.size() - offset));
+
+            // Only the first block opens a new undo point so the whole fill undoes as one step
+            for (size_t offset = 0; offset < size; offset += block.size())
+                provider->addBulkPatch(address + offset, block.data(), std::min(block.size(), size - offset), offset == 0);
+        }
+
+    private:
+        u64 m_address;
+        u64 m_size;
+        std::string m_input;
+    };
+
 
     /* Data Visualizer */
 
@@ -476,6 +700,17 @@ namespace hex::plugin::builtin {
                 ImGui::TextDisabled(".");
         }
 
+        [[nodiscard]] std::optional<std::string> format(u64 address, const u8 *data, size_t size, bool upperCase) override {
+            hex::unused(address, upperCase);
+
+            // The placeholder dot for non-printable bytes is greyed-out, which
+            // cached plain text can't reproduce
+            if (size == 1 && std::isprint(data[0]))
+                return std::string(1, char(data[0]));
+            else
+                return std::nullopt;
+        }
+
         bool drawEditing(u64 address, u8 *data, size_t size, bool upperCase, bool startedEditing) override {
             hex::unused(address, startedEditing, upperCase);
 
@@ -550,40 +785,60 @@ namespace hex::plugin::builtin {
         return currColumn > 0 && (currColumn) < columnCount && ((currColumn) % 8) == 0;
     }
 
-    static std::optional<color_t> queryBackgroundColor(u64 address, const u8 *data, size_t size) {
+    using HighlightTree = interval_tree::IntervalTree<u64, color_t>;
+
+    // Collects the highlights of the interval-based providers and the static highlight
+    // regions that fall into the visible region into one interval tree. The tree is built
+    // once per frame; the per-cell queries below then answer from it instead of walking
+    // every provider for every byte
+    static HighlightTree buildHighlightTree(const std::map<u32, ImHexApi::HexEditor::impl::RegionHighlightingFunction> &functions, const std::map<u32, ImHexApi::HexEditor::Highlighting> &highlights, const Region &visibleRegion) {
+        HighlightTree::interval_vector intervals;
+
+        for (const auto &[id, callback] : functions) {
+            for (const auto &highlighting : callback(visibleRegion)) {
+                const auto &region = highlighting.getRegion();
+                if (region.size > 0 && region.overlaps(visibleRegion))
+                    intervals.emplace_back(region.getStartAddress(), region.getEndAddress(), highlighting.getColor());
+            }
+        }
+
+        for (const auto &[id, highlighting] : highlights) {
+            const auto &region = highlighting.getRegion();
+            if (region.size > 0 && region.overlaps(visibleRegion))
+                intervals.emplace_back(region.getStartAddress(), region.getEndAddress(), highlighting.getColor());
+        }
+
+        return HighlightTree(std::move(intervals));
+    }
+
+    static std::optional<color_t> queryBackgroundColor(u64 address, const u8 *data, size_t size, const HighlightTree &regionHighlights) {
         std::optional<color_t> result;
+        regionHighlights.visit_overlapping(address, (address + size) - 1, [&result](const auto &interval) {
+            result = interval.value;
+        });
+
+        // The per-byte callbacks are a compatibility fallback for highlights that
+        // depend on the bytes' values and can't be expressed as regions
         for (const auto &[id, callback] : ImHexApi::HexEditor::impl::getBackgroundHighlightingFunctions()) {
             if (auto color = callback(address, data, size, result.has_value()); color.has_value())
                 return color.value();
         }
 
-        if (result.has_value())
-            return result;
-
-        for (const auto &[id, highlighting] : ImHexApi::HexEditor::impl::getBackgroundHighlights()) {
-            if (highlighting.getRegion().overlaps({ address, size }))
-                return highlighting.getColor();
-        }
-
-        return std::nullopt;
+        return result;
     }
 
-    static std::optional<color_t> queryForegroundColor(u64 address, const u8 *data, size_t size) {
+    static std::optional<color_t> queryForegroundColor(u64 address, const u8 *data, size_t size, const HighlightTree &regionHighlights) {
         std::optional<color_t> result;
+        regionHighlights.visit_overlapping(address, (address + size) - 1, [&result](const auto &interval) {
+            result = interval.value;
+        });
+
         for (const auto &[id, callback] : ImHexApi::HexEditor::impl::getForegroundHighlightingFunctions()) {
             if (auto color = callback(address, data, size, result.has_value()); color.has_value())
                 result = color;
         }
 
-        if (result.has_value())
-            return result;
-
-        for (const auto &[id, highlighting] : ImHexApi::HexEditor::impl::getForegroundHighlights()) {
-            if (highlighting.getRegion().overlaps({ address, size }))
-                return highlighting.getColor();
-        }
-
-        return std::nullopt;
+        return result;
     }
 
     std::optional<color_t> ViewHexEditor::applySelectionColor(u64 byteAddress, std::optional<color_t> color) {
@@ -620,7 +875,7 @@ namespace hex::plugin::builtin {
         size_t size   = std::min<size_t>(longestSequence, provider->getActualSize() - address);
 
         std::vector<u8> buffer(size);
-        provider->read(address + provider->getBaseAddress() + provider->getCurrentPageAddress(), buffer.data(), size);
+        hex::prv::readcache::read(provider, address + provider->getBaseAddress(), buffer.data(), size);
 
         const auto [decoded, advance] = encodingFile.getEncodingFor(buffer);
         const ImColor color = [&decoded = decoded, &advance = advance]{
@@ -691,10 +946,43 @@ namespace hex::plugin::builtin {
         }
 
         if (this->m_editingAddress != address || this->m_editingCellType != cellType) {
-            if (cellType == CellType::Hex)
-                this->m_currDataVisualizer->draw(address, data, size, this->m_upperCaseHex);
-            else
-                asciiVisualizer.draw(address, data, size, this->m_upperCaseHex);
+            ContentRegistry::HexEditor::DataVisualizer *visualizer = cellType == CellType::Hex ? this->m_currDataVisualizer : &asciiVisualizer;
+
+            // Formatting, not drawing, dominates the per-cell cost at high cell
+            // counts, so the rendered text is cached next to the row's bytes and
+            // only rebuilt when those change. Visualizers that draw something
+            // richer than text fall through to draw() every frame
+            const auto rowBase   = provider->getBaseAddress();
+            const auto cachedRow = address >= rowBase ? this->m_rowCache.find(address - ((address - rowBase) % this->m_bytesPerRow)) : this->m_rowCache.end();
+
+            // When fast rendering is enabled, static cells bypass the text widget and
+            // emit their glyphs straight into the draw list. The glyph quads are the
+            // same either way; what's saved is the per-cell layout and item overhead,
+            // which dominates at 32+ columns on high-resolution displays
+            const auto drawCellText = [this](const std::string &text) {
+                if (this->m_fastRender) {
+                    const auto pos = ImGui::GetCursorScreenPos();
+                    ImGui::GetWindowDrawList()->AddText(pos, ImGui::GetColorU32(ImGuiCol_Text), text.c_str(), text.c_str() + text.size());
+                    ImGui::Dummy(ImVec2(this->m_characterSize.x * text.size(), this->m_characterSize.y));
+                } else {
+                    ImGui::TextUnformatted(text.c_str());
+                }
+            };
+
+            if (cachedRow != this->m_rowCache.end()) {
+                auto &cellTexts = cellType == CellType::Hex ? cachedRow->second.hexText : cachedRow->second.asciiText;
+
+                if (auto cellText = cellTexts.find(address); cellText != cellTexts.end())
+                    drawCellText(cellText->second);
+                else if (auto text = visualizer->format(address, data, size, this->m_upperCaseHex); text.has_value()) {
+                    drawCellText(*text);
+                    cellTexts.emplace(address, std::move(*text));
+                } else {
+                    visualizer->draw(address, data, size, this->m_upperCaseHex);
+                }
+            } else {
+                visualizer->draw(address, data, size, this->m_upperCaseHex);
+            }
 
             if (hovered && provider->isWritable()) {
                 // Enter editing mode when double-clicking a cell
@@ -819,16 +1107,83 @@ namespace hex::plugin::builtin {
         }
     }
 
+    void ViewHexEditor::readRowBytes(u64 address, u8 *bytes, size_t count) {
+        // How long a cached row stays valid without an invalidation event, and
+        // how many rows are kept. Some data changes don't come with an event
+        // (overlays being filled in, exotic providers), so rows are re-read
+        // every few frames instead of living until explicitly invalidated
+        constexpr static u64 RefreshInterval  = 8;
+        constexpr static size_t MaxCachedRows = 0x400;
+
+        const auto frame     = u64(ImGui::GetFrameCount());
+        const auto byteCount = std::min<size_t>(count, this->m_bytesPerRow);
+
+        // Scrolling far away leaves stale rows behind; dropping everything is
+        // cheaper than tracking them individually
+        if (this->m_rowCache.size() > MaxCachedRows)
+            this->m_rowCache.clear();
+
+        auto &row = this->m_rowCache[address];
+        if (row.bytes.size() != size_t(this->m_bytesPerRow) || frame - row.frame >= RefreshInterval) {
+            std::vector<u8> freshBytes(this->m_bytesPerRow, 0x00);
+            hex::prv::readcache::read(ImHexApi::Provider::get(), address, freshBytes.data(), byteCount);
+
+            // Formatted cell text and decoded encoding glyphs only go stale when
+            // the bytes do, so a periodic re-read that found identical data keeps them
+            if (freshBytes != row.bytes) {
+                row.hexText.clear();
+                row.asciiText.clear();
+                row.encoding.clear();
+            }
+
+            row.bytes = std::move(freshBytes);
+            row.frame = frame;
+        }
+
+        std::memcpy(bytes, row.bytes.data(), byteCount);
+    }
+
+    void ViewHexEditor::decodeRowEncoding(u64 address) {
+        if (const auto iter = this->m_rowCache.find(address); iter != this->m_rowCache.end() && !iter->second.encoding.empty())
+            return;
+
+        auto provider = ImHexApi::Provider::get();
+        const u64 providerOffset = address - provider->getBaseAddress();
+        if (providerOffset >= provider->getSize())
+            return;
+
+        // Reading the bytes first ties the run's lifetime to theirs: the cached run
+        // is dropped whenever a re-read finds the row's bytes changed
+        std::vector<u8> bytes(this->m_bytesPerRow, 0x00);
+        this->readRowBytes(address, bytes.data(), std::min<size_t>(this->m_bytesPerRow, provider->getSize() - providerOffset));
+
+        auto &row = this->m_rowCache[address];
+
+        u32 offset = 0;
+        do {
+            auto result = queryCustomEncodingData(*this->m_currCustomEncoding, address + offset);
+
+            row.encoding.push_back({ address + offset, std::move(result.displayValue), result.advance, result.color });
+            offset += std::max<size_t>(1, result.advance);
+        } while (offset < this->m_bytesPerRow);
+    }
+
     void ViewHexEditor::drawEditor(const ImVec2 &size) {
         const float SeparatorColumWidth   = 6_scaled;
+        const float MiniMapWidth          = 14_scaled;
         const auto CharacterSize          = ImGui::CalcTextSize("0");
+        this->m_characterSize             = CharacterSize;
+
+        auto tableSize = size;
+        if (this->m_showMiniMap)
+            tableSize.x -= MiniMapWidth + ImGui::GetStyle().ItemSpacing.x;
 
         const auto bytesPerCell    = this->m_currDataVisualizer->getBytesPerCell();
         const u16 columnCount      = this->m_bytesPerRow / bytesPerCell;
         const auto byteColumnCount = columnCount + getByteColumnSeparatorCount(columnCount);
 
         ImGui::PushStyleVar(ImGuiStyleVar_CellPadding, ImVec2(0.5, 0));
-        if (ImGui::BeginTable("##hex", 2 + byteColumnCount + 2 + 2 , ImGuiTableFlags_ScrollY | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_NoKeepColumnsVisible, size)) {
+        if (ImGui::BeginTable("##hex", 2 + byteColumnCount + 2 + 2 , ImGuiTableFlags_ScrollY | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_NoKeepColumnsVisible, tableSize)) {
             View::discardNavigationRequests();
             ImGui::TableSetupScrollFreeze(0, 2);
 
@@ -876,37 +1231,58 @@ namespace hex::plugin::builtin {
                     return currRegionValid;
                 };
 
+                // The full 64-bit address space is scrolled natively: the table only ever
+                // spans a bounded segment of rows so the float scroll position keeps full
+                // precision, and the segment is shifted underneath the view when it nears
+                // one of the segment's edges
+                const u64 totalRows     = (u64(provider->getSize()) + this->m_bytesPerRow - 1) / this->m_bytesPerRow;
+                const u64 segmentRows   = std::min<u64>(totalRows, ScrollSegmentRows);
+                const u64 maxSegmentRow = totalRows - segmentRows;
+
+                if (this->m_scrollSegmentRow > maxSegmentRow)
+                    this->m_scrollSegmentRow = maxSegmentRow;
+
                 ImGuiListClipper clipper;
 
-                clipper.Begin(std::ceil(provider->getSize() / (long double)(this->m_bytesPerRow)), CharacterSize.y);
+                clipper.Begin(int(segmentRows), CharacterSize.y);
                 while (clipper.Step()) {
                     this->m_visibleRowCount = clipper.DisplayEnd - clipper.DisplayStart;
 
+                    // Ask the interval-based highlighting providers once for everything
+                    // that's visible instead of once per byte
+                    const Region visibleRegion = {
+                        (this->m_scrollSegmentRow + u64(clipper.DisplayStart)) * this->m_bytesPerRow + provider->getBaseAddress(),
+                        u64(this->m_visibleRowCount) * this->m_bytesPerRow
+                    };
+                    const auto backgroundHighlights = buildHighlightTree(ImHexApi::HexEditor::impl::getBackgroundRegionHighlightingFunctions(), ImHexApi::HexEditor::impl::getBackgroundHighlights(), visibleRegion);
+                    const auto foregroundHighlights = buildHighlightTree(ImHexApi::HexEditor::impl::getForegroundRegionHighlightingFunctions(), ImHexApi::HexEditor::impl::getForegroundHighlights(), visibleRegion);
+
                     // Loop over rows
                     for (u64 y = u64(clipper.DisplayStart); y < u64(clipper.DisplayEnd); y++) {
+                        const u64 row = this->m_scrollSegmentRow + y;
 
                         // Draw address column
                         ImGui::TableNextRow();
                         ImGui::TableNextColumn();
-                        ImGui::TextFormatted(this->m_upperCaseHex ? "{:08X}: " : "{:08x}: ", y * this->m_bytesPerRow + provider->getBaseAddress() + provider->getCurrentPageAddress());
+                        ImGui::TextFormattedCached(this->m_upperCaseHex ? "{:08X}: " : "{:08x}: ", row * this->m_bytesPerRow + provider->getBaseAddress());
                         ImGui::TableNextColumn();
 
-                        const u8 validBytes = std::min<u64>(this->m_bytesPerRow, provider->getSize() - y * this->m_bytesPerRow);
+                        const u8 validBytes = std::min<u64>(this->m_bytesPerRow, provider->getSize() - row * this->m_bytesPerRow);
 
                         std::vector<u8> bytes(this->m_bytesPerRow, 0x00);
-                        provider->read(y * this->m_bytesPerRow + provider->getBaseAddress() + provider->getCurrentPageAddress(), bytes.data(), validBytes);
+                        this->readRowBytes(row * this->m_bytesPerRow + provider->getBaseAddress(), bytes.data(), validBytes);
 
                         std::vector<std::tuple<std::optional<color_t>, std::optional<color_t>>> cellColors;
                         {
                             for (u64 x = 0; x <  std::ceil(float(validBytes) / bytesPerCell); x++) {
-                                const u64 byteAddress = y * this->m_bytesPerRow + x * bytesPerCell + provider->getBaseAddress() + provider->getCurrentPageAddress();
+                                const u64 byteAddress = row * this->m_bytesPerRow + x * bytesPerCell + provider->getBaseAddress();
 
                                 const auto cellBytes = std::min<u64>(validBytes, bytesPerCell);
 
                                 // Query cell colors
                                 if (x < std::ceil(float(validBytes) / bytesPerCell)) {
-                                    const auto foregroundColor = queryForegroundColor(byteAddress, &bytes[x * cellBytes], cellBytes);
-                                    const auto backgroundColor = queryBackgroundColor(byteAddress, &bytes[x * cellBytes], cellBytes);
+                                    const auto foregroundColor = queryForegroundColor(byteAddress, &bytes[x * cellBytes], cellBytes, foregroundHighlights);
+                                    const auto backgroundColor = queryBackgroundColor(byteAddress, &bytes[x * cellBytes], cellBytes, backgroundHighlights);
 
                                     cellColors.emplace_back(
                                         foregroundColor,
@@ -925,7 +1301,7 @@ namespace hex::plugin::builtin {
                         ImGui::PushStyleVar(ImGuiStyleVar_CellPadding, ImVec2(3, 0));
 
                         for (u64 x = 0; x < columnCount; x++) {
-                            const u64 byteAddress = y * this->m_bytesPerRow + x * bytesPerCell + provider->getBaseAddress() + provider->getCurrentPageAddress();
+                            const u64 byteAddress = row * this->m_bytesPerRow + x * bytesPerCell + provider->getBaseAddress();
 
                             ImGui::TableNextColumn();
                             if (isColumnSeparatorColumn(x, columnCount))
@@ -939,7 +1315,7 @@ namespace hex::plugin::builtin {
                                 auto [foregroundColor, backgroundColor] = cellColors[x];
 
                                 if (isColumnSeparatorColumn(x + 1, columnCount) && cellColors.size() > x + 1) {
-                                    auto separatorAddress = x + y * columnCount;
+                                    auto separatorAddress = x + row * columnCount;
                                     auto [nextForegroundColor, nextBackgroundColor] = cellColors[x + 1];
                                     if ((isSelectionValid() && getSelection().overlaps({ separatorAddress, 1 }) && getSelection().getEndAddress() != separatorAddress) || backgroundColor == nextBackgroundColor)
                                         cellSize.x += SeparatorColumWidth + 1;
@@ -1000,7 +1376,7 @@ namespace hex::plugin::builtin {
                                 for (u64 x = 0; x < this->m_bytesPerRow; x++) {
                                     ImGui::TableNextColumn();
 
-                                    const u64 byteAddress = y * this->m_bytesPerRow + x + provider->getBaseAddress() + provider->getCurrentPageAddress();
+                                    const u64 byteAddress = row * this->m_bytesPerRow + x + provider->getBaseAddress();
 
                                     const auto cellStartPos = getCellPosition();
                                     const auto cellSize = CharacterSize + ImVec2(this->m_characterCellPadding, 0);
@@ -1046,27 +1422,23 @@ namespace hex::plugin::builtin {
 
                         // Draw Custom encoding column
                         if (this->m_currCustomEncoding.has_value()) {
-                            std::vector<std::pair<u64, CustomEncodingData>> encodingData;
-                            u32 offset = 0;
-                            do {
-                                const u64 address = y * this->m_bytesPerRow + offset + provider->getBaseAddress() + provider->getCurrentPageAddress();
-
-                                auto result = queryCustomEncodingData(*this->m_currCustomEncoding, address);
-                                offset += std::max<size_t>(1, result.advance);
-
-                                encodingData.emplace_back(address, result);
-                            } while (offset < this->m_bytesPerRow);
+                            // Decoding through the encoding table anew every frame halves the
+                            // frame rate for multi-byte encodings, so each row's glyph run is
+                            // cached next to the bytes it was decoded from
+                            const u64 rowAddress = row * this->m_bytesPerRow + provider->getBaseAddress();
+                            this->decodeRowEncoding(rowAddress);
+                            const auto &encodingData = this->m_rowCache[rowAddress].encoding;
 
                             ImGui::PushStyleVar(ImGuiStyleVar_CellPadding, ImVec2(0, 0));
                             ImGui::PushID(y);
-                            if (ImGui::BeginTable("##encoding_cell", encodingData.size(), ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_NoKeepColumnsVisible)) {
+                            if (!encodingData.empty() && ImGui::BeginTable("##encoding_cell", encodingData.size(), ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_NoKeepColumnsVisible)) {
                                 ImGui::TableNextRow();
 
-                                for (const auto &[address, data] : encodingData) {
+                                for (const auto &[address, displayValue, advance, glyphColor] : encodingData) {
                                     ImGui::TableNextColumn();
 
                                     const auto cellStartPos = getCellPosition();
-                                    const auto cellSize = ImGui::CalcTextSize(data.displayValue.c_str()) * ImVec2(1, 0) + ImVec2(0, CharacterSize.y);
+                                    const auto cellSize = ImGui::CalcTextSize(displayValue.c_str()) * ImVec2(1, 0) + ImVec2(0, CharacterSize.y);
                                     const bool cellHovered = ImGui::IsMouseHoveringRect(cellStartPos, cellStartPos + cellSize, true);
 
 
@@ -1087,10 +1459,10 @@ namespace hex::plugin::builtin {
                                         }
 
                                         ImGui::PushItemWidth(cellSize.x);
-                                        ImGui::TextFormattedColored(data.color, "{}", data.displayValue);
+                                        ImGui::TextFormattedColored(glyphColor, "{}", displayValue);
                                         ImGui::PopItemWidth();
 
-                                        this->handleSelection(address, data.advance, &bytes[address % this->m_bytesPerRow], cellHovered);
+                                        this->handleSelection(address, advance, &bytes[address % this->m_bytesPerRow], cellHovered);
                                     }
                                 }
 
@@ -1108,13 +1480,13 @@ namespace hex::plugin::builtin {
                                 auto fractionPerLine = 1.0 / (this->m_visibleRowCount + 1);
 
                                 if (y == (u64(clipper.DisplayStart) + 3)) {
-                                    if (i128(*providerData.selectionEnd - provider->getBaseAddress() - provider->getCurrentPageAddress()) <= (i64(clipper.DisplayStart + 3) * this->m_bytesPerRow)) {
+                                    if (i128(*providerData.selectionEnd - provider->getBaseAddress()) <= (i128(this->m_scrollSegmentRow + clipper.DisplayStart + 3) * this->m_bytesPerRow)) {
                                         this->m_shouldScrollToSelection = false;
                                         ImGui::SetScrollHereY(fractionPerLine * 5);
 
                                     }
                                 } else if (y == (u64(clipper.DisplayEnd) - 1)) {
-                                    if (i128(*providerData.selectionEnd - provider->getBaseAddress() - provider->getCurrentPageAddress()) >= (i64(clipper.DisplayEnd - 2) * this->m_bytesPerRow)) {
+                                    if (i128(*providerData.selectionEnd - provider->getBaseAddress()) >= (i128(this->m_scrollSegmentRow + clipper.DisplayEnd - 2) * this->m_bytesPerRow)) {
                                         this->m_shouldScrollToSelection = false;
                                         ImGui::SetScrollHereY(fractionPerLine * (this->m_visibleRowCount));
                                     }
@@ -1125,13 +1497,12 @@ namespace hex::plugin::builtin {
                             if (this->m_shouldJumpWhenOffScreen) {
                                 this->m_shouldJumpWhenOffScreen = false;
 
-                                const auto pageAddress = provider->getCurrentPageAddress() + provider->getBaseAddress();
                                 auto newSelection = getSelection();
-                                newSelection.address -= pageAddress;
+                                newSelection.address -= provider->getBaseAddress();
 
-                                if ((newSelection.getStartAddress()) < u64(clipper.DisplayStart * this->m_bytesPerRow))
+                                if ((newSelection.getStartAddress()) < (this->m_scrollSegmentRow + u64(clipper.DisplayStart)) * this->m_bytesPerRow)
                                     this->jumpToSelection(false);
-                                if ((newSelection.getEndAddress()) > u64(clipper.DisplayEnd * this->m_bytesPerRow))
+                                if ((newSelection.getEndAddress()) > (this->m_scrollSegmentRow + u64(clipper.DisplayEnd)) * this->m_bytesPerRow)
                                     this->jumpToSelection(false);
 
                             }
@@ -1144,11 +1515,15 @@ namespace hex::plugin::builtin {
                     this->m_shouldJumpToSelection = false;
 
                     auto newSelection = getSelection();
-                    provider->setCurrentPage(provider->getPageOfAddress(newSelection.address).value_or(0));
 
-                    const auto pageAddress = provider->getCurrentPageAddress() + provider->getBaseAddress();
-                    auto scrollPos = (static_cast<long double>(newSelection.getStartAddress() - pageAddress) / this->m_bytesPerRow) * CharacterSize.y;
-                    bool scrollUpwards = scrollPos < ImGui::GetScrollY();
+                    // Re-center the scroll segment on the target so there's room to keep
+                    // scrolling in both directions afterwards
+                    const u64 targetRow     = (newSelection.getStartAddress() - provider->getBaseAddress()) / this->m_bytesPerRow;
+                    const u64 oldSegmentRow = this->m_scrollSegmentRow;
+                    this->m_scrollSegmentRow = std::min(targetRow - std::min(targetRow, segmentRows / 2), maxSegmentRow);
+
+                    auto scrollPos = (static_cast<long double>(targetRow - this->m_scrollSegmentRow)) * CharacterSize.y;
+                    bool scrollUpwards = targetRow < oldSegmentRow + u64(ImGui::GetScrollY() / CharacterSize.y);
                     auto scrollFraction = scrollUpwards ? 0.0F : (1.0F - ((1.0F / this->m_visibleRowCount) * 2));
 
                     if (this->m_centerOnJump) {
@@ -1157,14 +1532,93 @@ namespace hex::plugin::builtin {
                     }
 
                     ImGui::SetScrollFromPosY(ImGui::GetCursorStartPos().y + scrollPos, scrollFraction);
+                } else if (totalRows > segmentRows) {
+                    // Shift the scroll segment when the view nears one of its edges. The scroll
+                    // position is corrected by the same number of rows, so the same bytes stay
+                    // on screen and the segment change is invisible
+                    const float marginHeight = (u64(this->m_visibleRowCount) * 2 + 1) * CharacterSize.y;
+                    const auto scrollY = ImGui::GetScrollY();
+
+                    if (this->m_scrollSegmentRow > 0 && scrollY < marginHeight) {
+                        const u64 shift = std::min(this->m_scrollSegmentRow, segmentRows / 2);
+                        this->m_scrollSegmentRow -= shift;
+                        ImGui::SetScrollY(scrollY + shift * CharacterSize.y);
+                    } else if (this->m_scrollSegmentRow < maxSegmentRow && scrollY > ImGui::GetScrollMaxY() - marginHeight) {
+                        const u64 shift = std::min(maxSegmentRow - this->m_scrollSegmentRow, segmentRows / 2);
+                        this->m_scrollSegmentRow += shift;
+                        ImGui::SetScrollY(scrollY - shift * CharacterSize.y);
+                    }
                 }
 
                 if (!this->m_syncScrolling) {
                     if (this->m_shouldUpdateScrollPosition) {
                         this->m_shouldUpdateScrollPosition = false;
+                        this->m_scrollSegmentRow = std::min(providerData.scrollSegmentRow, maxSegmentRow);
                         ImGui::SetScrollY(providerData.scrollPosition);
                     } else {
-                        providerData.scrollPosition = ImGui::GetScrollY();
+                        providerData.scrollSegmentRow = this->m_scrollSegmentRow;
+                        providerData.scrollPosition   = ImGui::GetScrollY();
+                    }
+                }
+
+                // The minimap drawn next to the table mirrors this scroll position and
+                // drives it when it gets clicked
+                if (this->m_miniMapScrollRequest.has_value()) {
+                    const u64 scrollableRows = totalRows > this->m_visibleRowCount ? totalRows - this->m_visibleRowCount : 0;
+                    const u64 targetRow      = u64(*this->m_miniMapScrollRequest * scrollableRows);
+
+                    this->m_scrollSegmentRow = std::min(targetRow - std::min(targetRow, segmentRows / 2), maxSegmentRow);
+                    ImGui::SetScrollY((targetRow - this->m_scrollSegmentRow) * CharacterSize.y);
+                    this->m_miniMapScrollRequest.reset();
+                }
+
+                {
+                    const u64 scrollableRows = totalRows > this->m_visibleRowCount ? totalRows - this->m_visibleRowCount : 0;
+                    const u64 currentRow     = this->m_scrollSegmentRow + u64(ImGui::GetScrollY() / CharacterSize.y);
+
+                    this->m_scrollFraction  = scrollableRows > 0 ? std::min(1.0F, float(currentRow / (long double)scrollableRows)) : 0.0F;
+                    this->m_visibleFraction = totalRows > 0 ? std::min(1.0F, float(this->m_visibleRowCount / (long double)totalRows)) : 1.0F;
+                }
+
+                const u64 currentScrollRow = this->m_scrollSegmentRow + u64(ImGui::GetScrollY() / CharacterSize.y);
+                const i64 scrollDelta      = i64(currentScrollRow) - i64(this->m_lastScrollRow);
+                this->m_lastScrollRow      = currentScrollRow;
+
+                // Warm the cache of slow providers a few viewport-heights ahead in the
+                // scroll direction so continuous scrolling doesn't block on the backend
+                if (auto cachedProvider = dynamic_cast<hex::prv::CachedProvider *>(provider); cachedProvider != nullptr && this->m_visibleRowCount > 0) {
+                    if (scrollDelta != 0) {
+                        const u64 visibleBytes  = u64(this->m_visibleRowCount) * this->m_bytesPerRow;
+                        const u64 prefetchBytes = visibleBytes * 3;
+                        const u64 viewportStart = currentScrollRow * this->m_bytesPerRow;
+
+                        if (scrollDelta > 0)
+                            cachedProvider->prefetchAsync(viewportStart + visibleBytes, prefetchBytes);
+                        else
+                            cachedProvider->prefetchAsync(viewportStart > prefetchBytes ? viewportStart - prefetchBytes : 0, prefetchBytes);
+                    }
+                }
+
+                // Decode ahead of the viewport in the scroll direction so the custom
+                // encoding column never decodes on first visibility while scrolling.
+                // The amount per frame is bounded; rows already decoded cost a lookup
+                if (this->m_currCustomEncoding.has_value() && this->m_visibleRowCount > 0 && scrollDelta != 0) {
+                    constexpr static u64 MaxDecodeAheadRows = 64;
+
+                    const u64 aheadRows = std::min<u64>(MaxDecodeAheadRows, u64(this->m_visibleRowCount) * 2);
+                    for (u64 i = 0; i < aheadRows; i++) {
+                        u64 aheadRow = 0;
+                        if (scrollDelta > 0)
+                            aheadRow = currentScrollRow + this->m_visibleRowCount + i;
+                        else if (currentScrollRow > i)
+                            aheadRow = currentScrollRow - 1 - i;
+                        else
+                            break;
+
+                        if (aheadRow >= totalRows)
+                            break;
+
+                        this->decodeRowEncoding(aheadRow * this->m_bytesPerRow + provider->getBaseAddress());
                     }
                 }
 
@@ -1177,14 +1631,171 @@ namespace hex::plugin::builtin {
         }
         ImGui::PopStyleVar();
 
+        if (this->m_showMiniMap && ImHexApi::Provider::isValid()) {
+            ImGui::SameLine();
+            this->drawMiniMap(ImVec2(MiniMapWidth, size.y));
+        }
+
         this->m_enteredEditingMode = false;
     }
 
+    // Color a typed region gets in the minimap, matching the palette of the data
+    // analysis' region map. Unknown means the sample has to be probed instead
+    static color_t getRegionTypeColor(ImHexApi::DataRegions::RegionType type) {
+        switch (type) {
+            case ImHexApi::DataRegions::RegionType::Padding:     return IM_COL32(0x99, 0x99, 0x99, 0xFF);
+            case ImHexApi::DataRegions::RegionType::Text:        return IM_COL32(0x4D, 0xCC, 0x4D, 0xFF);
+            case ImHexApi::DataRegions::RegionType::Code:        return IM_COL32(0x66, 0x99, 0xF2, 0xFF);
+            case ImHexApi::DataRegions::RegionType::HighEntropy: return IM_COL32(0xEB, 0x66, 0x4D, 0xFF);
+            default:                                             return 0x00;
+        }
+    }
+
+    void ViewHexEditor::drawMiniMap(const ImVec2 &size) {
+        auto provider = ImHexApi::Provider::get();
+        auto &miniMap = ProviderExtraData::get(provider).miniMap;
+
+        const u32 sampleCount = std::max<u32>(u32(size.y), 1);
+
+        // The strip gets rebuilt in the background whenever it has never been computed
+        // at the current resolution or the data size changed. The stale colors stay on
+        // screen until the new ones are ready, so the frame never waits for anything
+        if (!this->m_miniMapTask.isRunning() && !miniMap.updating) {
+            if (miniMap.sampleCount != sampleCount || miniMap.analyzedSize != provider->getActualSize())
+                this->updateMiniMap(provider, sampleCount);
+        }
+
+        const auto pos = ImGui::GetCursorScreenPos();
+        auto drawList  = ImGui::GetWindowDrawList();
+
+        ImGui::InvisibleButton("##minimap", size);
+
+        drawList->AddRectFilled(pos, pos + size, ImGui::GetColorU32(ImGuiCol_FrameBg));
+
+        if (!miniMap.colors.empty()) {
+            // Runs of equally colored samples collapse into single rectangles
+            const auto runCount = u32(miniMap.colors.size());
+            u32 runStart = 0;
+            for (u32 i = 1; i <= runCount; i++) {
+                if (i != runCount && miniMap.colors[i] == miniMap.colors[runStart])
+                    continue;
+
+                const float yStart = (float(runStart) / runCount) * size.y;
+                const float yEnd   = (float(i) / runCount) * size.y;
+                drawList->AddRectFilled(pos + ImVec2(1_scaled, yStart), pos + ImVec2(size.x - 1_scaled, yEnd), miniMap.colors[runStart]);
+
+                runStart = i;
+            }
+        }
+
+        // Frame around the currently visible part of the data
+        const float indicatorHeight = std::max(this->m_visibleFraction * size.y, 2.0_scaled);
+        const float indicatorY      = this->m_scrollFraction * (size.y - indicatorHeight);
+        drawList->AddRect(pos + ImVec2(0, indicatorY), pos + ImVec2(size.x, indicatorY + indicatorHeight), ImGui::GetColorU32(ImGuiCol_Text));
+
+        // Clicking or dragging centers the editor on the hit spot
+        if (ImGui::IsItemActive() && ImGui::IsMouseDown(ImGuiMouseButton_Left) && this->m_visibleFraction < 1.0F) {
+            const float fraction = std::clamp((ImGui::GetMousePos().y - pos.y) / size.y - this->m_visibleFraction / 2, 0.0F, 1.0F - this->m_visibleFraction);
+            this->m_miniMapScrollRequest = fraction / (1.0F - this->m_visibleFraction);
+        }
+    }
+
+    void ViewHexEditor::updateMiniMap(prv::Provider *provider, u32 sampleCount) {
+        auto &miniMap    = ProviderExtraData::get(provider).miniMap;
+        miniMap.updating = true;
+
+        const auto baseAddress = provider->getBaseAddress();
+        const auto dataSize    = provider->getActualSize();
+
+        // When the data analysis already classified the data, its typed regions color the
+        // samples directly; everything else gets a small probe read and byte-class blend.
+        // The region list is copied here so the background task doesn't race its publisher
+        auto typedRegions = ImHexApi::DataRegions::get(provider);
+
+        this->m_miniMapTask = TaskManager::createBackgroundTask("hex.builtin.view.hex_editor.minimap", [provider, sampleCount, baseAddress, dataSize, typedRegions = std::move(typedRegions)](auto &task) {
+            const u64 bytesPerSample = std::max<u64>(1, dataSize / sampleCount);
+
+            const auto findRegionType = [&typedRegions](u64 address) {
+                auto iter = std::upper_bound(typedRegions.begin(), typedRegions.end(), address, [](u64 address, const auto &entry) {
+                    return address < entry.region.getStartAddress();
+                });
+
+                if (iter == typedRegions.begin())
+                    return ImHexApi::DataRegions::RegionType::Unknown;
+
+                iter = std::prev(iter);
+                if (address <= iter->region.getEndAddress())
+                    return iter->type;
+
+                return ImHexApi::DataRegions::RegionType::Unknown;
+            };
+
+            std::vector<color_t> colors(sampleCount, 0x00);
+            std::vector<u8> probe(std::min<u64>(bytesPerSample, 0x200));
+
+            // An interrupted run still has to release the updating flag, otherwise the
+            // strip would never be rebuilt again
+            ON_SCOPE_EXIT {
+                TaskManager::doLater([provider] {
+                    const auto &providers = ImHexApi::Provider::getProviders();
+                    if (std::find(providers.begin(), providers.end(), provider) != providers.end())
+                        ProviderExtraData::get(provider).miniMap.updating = false;
+                });
+            };
+
+            for (u32 sample = 0; sample < sampleCount; sample++) {
+                const u64 address = baseAddress + u64(sample) * bytesPerSample;
+                if (address >= baseAddress + dataSize)
+                    break;
+
+                if (const auto type = findRegionType(address); type != ImHexApi::DataRegions::RegionType::Unknown) {
+                    colors[sample] = getRegionTypeColor(type);
+                } else {
+                    const auto probeSize = std::min<u64>(probe.size(), (baseAddress + dataSize) - address);
+                    provider->read(address, probe.data(), probeSize);
+
+                    // Blend of the byte class colors: zeros dark, printable blue,
+                    // 0xFF white, everything else orange
+                    u64 r = 0, g = 0, b = 0;
+                    for (u64 i = 0; i < probeSize; i++) {
+                        const u8 byte = probe[i];
+
+                        if (byte == 0x00) {
+                            r += 0x10; g += 0x10; b += 0x10;
+                        } else if (byte == 0xFF) {
+                            r += 0xE8; g += 0xE8; b += 0xE8;
+                        } else if (std::isprint(byte) || std::isspace(byte)) {
+                            r += 0x4A; g += 0x8C; b += 0xE8;
+                        } else {
+                            r += 0xE8; g += 0x68; b += 0x3C;
+                        }
+                    }
+
+                    if (probeSize > 0)
+                        colors[sample] = IM_COL32(r / probeSize, g / probeSize, b / probeSize, 0xFF);
+                }
+
+                task.update();
+            }
+
+            // The cache entry belongs to the GUI thread; it also might be gone already
+            // if the provider got closed while the task was running
+            TaskManager::doLater([provider, sampleCount, dataSize, colors = std::move(colors)]() mutable {
+                const auto &providers = ImHexApi::Provider::getProviders();
+                if (std::find(providers.begin(), providers.end(), provider) == providers.end())
+                    return;
+
+                auto &miniMap        = ProviderExtraData::get(provider).miniMap;
+                miniMap.colors       = std::move(colors);
+                miniMap.sampleCount  = sampleCount;
+                miniMap.analyzedSize = dataSize;
+            });
+        });
+    }
+
     void ViewHexEditor::drawFooter(const ImVec2 &size) {
         if (ImHexApi::Provider::isValid()) {
             auto provider = ImHexApi::Provider::get();
-            const auto pageCount = provider->getPageCount();
-            constexpr static u32 MinPage = 1;
 
             const auto windowEndPos = ImGui::GetWindowPos() + ImGui::GetWindowSize() - ImGui::GetStyle().WindowPadding;
             ImGui::GetWindowDrawList()->AddLine(windowEndPos - ImVec2(0, size.y - 1_scaled), windowEndPos - size + ImVec2(0, 1_scaled), ImGui::GetColorU32(ImGuiCol_Separator), 2.0_scaled);
@@ -1193,26 +1804,20 @@ namespace hex::plugin::builtin {
                 if (ImGui::BeginTable("##footer_table", 2)) {
                     ImGui::TableNextRow();
 
-                    // Page slider
+                    // Addressable region
                     ImGui::TableNextColumn();
                     {
-                        u32 page = provider->getCurrentPage() + 1;
-
-                        ImGui::TextFormatted("{}: ", "hex.builtin.view.hex_editor.page"_lang);
-                        ImGui::SameLine();
-
-                        ImGui::BeginDisabled(pageCount <= 1);
-                        {
-                            if (ImGui::SliderScalar("##page_selection", ImGuiDataType_U32, &page, &MinPage, &pageCount, hex::format("%d / {}", pageCount).c_str()))
-                                provider->setCurrentPage(page - 1);
-                        }
-                        ImGui::EndDisabled();
+                        ImGui::TextFormattedCached("{0}: 0x{1:08X} - 0x{2:08X}", "hex.builtin.view.hex_editor.region"_lang.get(),
+                                             provider->getBaseAddress(),
+                                             provider->getBaseAddress() + (provider->getSize() == 0 ? 0 : provider->getSize() - 1)
+                                             );
                     }
 
-                    // Page Address
+                    // Selection statistics
                     ImGui::TableNextColumn();
                     {
-                        ImGui::TextFormatted("{0}: 0x{1:08X} - 0x{2:08X} ({1} - {2})", "hex.builtin.view.hex_editor.region"_lang, provider->getCurrentPageAddress(), provider->getSize());
+                        if (isSelectionValid())
+                            drawSelectionStatistics(provider, getSelection());
                     }
 
                     ImGui::TableNextRow();
@@ -1233,13 +1838,13 @@ namespace hex::plugin::builtin {
                         else
                             value = std::string("hex.builtin.view.hex_editor.selection.none"_lang);
 
-                        ImGui::TextFormatted("{0}: {1}", "hex.builtin.view.hex_editor.selection"_lang, value);
+                        ImGui::TextFormattedCached("{0}: {1}", "hex.builtin.view.hex_editor.selection"_lang.get(), value);
                     }
 
                     // Loaded data size
                     ImGui::TableNextColumn();
                     {
-                        ImGui::TextFormatted("{0}: 0x{1:08X} (0x{2:X} | {3})", "hex.builtin.view.hex_editor.data_size"_lang,
+                        ImGui::TextFormattedCached("{0}: 0x{1:08X} (0x{2:X} | {3})", "hex.builtin.view.hex_editor.data_size"_lang.get(),
                                              provider->getActualSize(),
                                              provider->getActualSize(),
                                              hex::toByteString(provider->getActualSize())
@@ -1277,6 +1882,7 @@ namespace hex::plugin::builtin {
     }
 
     void ViewHexEditor::drawContent() {
+        hex::prv::iotrace::ScopedTag traceTag("hex editor");
 
         if (ImGui::Begin(View::toWindowName(this->getUnlocalizedName()).c_str(), &this->getWindowOpenState(), ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoScrollWithMouse)) {
             const auto FooterSize = ImVec2(ImGui::GetContentRegionAvail().x, ImGui::GetTextLineHeightWithSpacing() * 2.3);
@@ -1304,17 +1910,27 @@ namespace hex::plugin::builtin {
     static void copyBytes(const Region &selection) {
         constexpr static auto Format = "{0:02X} ";
 
+        // Formatting each byte through fmt is too slow for large selections, so every
+        // possible byte is formatted once and the loop only copies from the table
+        static const auto FormattedBytes = [] {
+            std::array<std::string, 0x100> table;
+            for (u32 byte = 0; byte < table.size(); byte++)
+                table[byte] = fmt::format(Format, byte);
+
+            return table;
+        }();
+
         auto provider = ImHexApi::Provider::get();
 
         auto reader = prv::BufferedReader(provider);
-        reader.seek(selection.getStartAddress() + provider->getBaseAddress() + provider->getCurrentPageAddress());
-        reader.setEndAddress(selection.getEndAddress() + provider->getBaseAddress() + provider->getCurrentPageAddress());
+        reader.seek(selection.getStartAddress() + provider->getBaseAddress());
+        reader.setEndAddress(selection.getEndAddress() + provider->getBaseAddress());
 
         std::string result;
         result.reserve(fmt::format(Format, 0x00).size() * selection.getSize());
 
         for (const auto &byte : reader)
-            result += fmt::format(Format, byte);
+            result += FormattedBytes[byte];
         result.pop_back();
 
         ImGui::SetClipboardText(result.c_str());
@@ -1323,34 +1939,74 @@ namespace hex::plugin::builtin {
     static void pasteBytes(const Region &selection, bool selectionCheck) {
         auto provider = ImHexApi::Provider::get();
 
-        std::string clipboard = ImGui::GetClipboardText();
-        if (clipboard.empty())
+        const char *clipboard = ImGui::GetClipboardText();
+        if (clipboard == nullptr)
             return;
 
-        // Check for non-hex characters
-        bool isValidHexString = std::find_if(clipboard.begin(), clipboard.end(), [](char c) {
-            return !std::isxdigit(c) && !std::isspace(c);
-        }) == clipboard.end();
+        auto buffer = parseHexString(clipboard);
+        if (!buffer.has_value() || buffer->empty())
+            return;
 
-        if (!isValidHexString) return;
+        if (!selectionCheck) {
+            if (selection.getStartAddress() + buffer->size() >= provider->getActualSize())
+                provider->resize(selection.getStartAddress() + buffer->size());
+        }
 
-        // Remove all whitespace
-        clipboard.erase(std::remove_if(clipboard.begin(), clipboard.end(), [](char c) { return std::isspace(c); }), clipboard.end());
+        // A single bulk patch instead of one raw write, which also makes large pastes undoable
+        const auto size = selectionCheck ? std::min(buffer->size(), selection.getSize()) : buffer->size();
+        provider->addBulkPatch(selection.getStartAddress(), buffer->data(), size, true);
+    }
 
-        // Only paste whole bytes
-        if (clipboard.length() % 2 != 0) return;
+    static void exportBytes(const Region &selection, const ContentRegistry::DataFormatter::impl::ExportEntry &entry) {
+        fs::openFileBrowser(fs::DialogMode::Save, {}, [selection, entry](const auto &path) {
+            auto provider = ImHexApi::Provider::get();
 
-        // Convert hex string to bytes
-        std::vector<u8> buffer = crypt::decode16(clipboard);
+            const u64 startAddress   = selection.getStartAddress() + provider->getBaseAddress();
+            const size_t totalSize   = selection.getSize();
 
-        if (!selectionCheck) {
-            if (selection.getStartAddress() + buffer.size() >= provider->getActualSize())
-                provider->resize(selection.getStartAddress() + buffer.size());
-        }
+            TaskManager::createTask("hex.builtin.view.hex_editor.exporting", totalSize, [path, entry, provider, startAddress, totalSize](auto &task) {
+                fs::File file(path, fs::File::Mode::Create);
+                if (!file.isValid()) {
+                    TaskManager::doLater([] { View::showErrorPopup("hex.builtin.popup.error.create"_lang); });
+                    return;
+                }
+
+                // Unlike the clipboard formatters, the export never holds the complete
+                // output in memory: batches of chunks are formatted by parallel workers
+                // and written out in order, so memory stays bounded by one batch
+                const size_t chunkSize   = std::max<size_t>(entry.chunkAlignment, 1_MiB - 1_MiB % entry.chunkAlignment);
+                const u64    chunkCount  = (totalSize + chunkSize - 1) / chunkSize;
+                const u64    workerCount = std::min<u64>(chunkCount, std::max<u32>(std::thread::hardware_concurrency(), 1));
 
-        // Write bytes
-        auto size = selectionCheck ? std::min(buffer.size(), selection.getSize()) : buffer.size();
-        provider->write(selection.getStartAddress() + provider->getBaseAddress() + provider->getCurrentPageAddress(), buffer.data(), size);
+                file.write(entry.begin(startAddress, totalSize));
+
+                std::vector<std::string> batch(workerCount);
+                for (u64 batchStart = 0; batchStart < chunkCount; batchStart += workerCount) {
+                    const u64 batchCount = std::min<u64>(workerCount, chunkCount - batchStart);
+
+                    {
+                        std::vector<std::jthread> workers;
+                        for (u64 i = 0; i < batchCount; i++) {
+                            workers.emplace_back([&, i] {
+                                const u64 chunkAddress     = startAddress + (batchStart + i) * chunkSize;
+                                const size_t currChunkSize = std::min<size_t>(chunkSize, totalSize - (batchStart + i) * chunkSize);
+
+                                batch[i] = entry.chunk(provider, chunkAddress, currChunkSize, startAddress, totalSize);
+                            });
+                        }
+                    }
+
+                    for (u64 i = 0; i < batchCount; i++) {
+                        file.write(batch[i]);
+                        batch[i].clear();
+                    }
+
+                    task.update(std::min<u64>((batchStart + batchCount) * chunkSize, totalSize));
+                }
+
+                file.write(entry.end(startAddress, totalSize));
+            });
+        });
     }
 
     static void copyString(const Region &selection) {
@@ -1358,7 +2014,7 @@ namespace hex::plugin::builtin {
 
         std::string buffer(selection.size, 0x00);
         buffer.reserve(selection.size);
-        provider->read(selection.getStartAddress() + provider->getBaseAddress() + provider->getCurrentPageAddress(), buffer.data(), selection.size);
+        provider->read(selection.getStartAddress() + provider->getBaseAddress(), buffer.data(), selection.size);
 
         ImGui::SetClipboardText(buffer.c_str());
     }
@@ -1567,12 +2223,10 @@ namespace hex::plugin::builtin {
                 return;
             }
 
-            auto page = provider->getPageOfAddress(region.getStartAddress());
-            if (!page.has_value())
+            if (region.getStartAddress() - provider->getBaseAddress() >= provider->getActualSize())
                 return;
 
             if (region.size != 0) {
-                provider->setCurrentPage(page.value());
                 this->setSelection(region);
                 this->jumpToSelection();
             }
@@ -1585,11 +2239,32 @@ namespace hex::plugin::builtin {
 
         EventManager::subscribe<EventProviderChanged>(this, [this](auto, auto) {
             this->m_shouldUpdateScrollPosition = true;
+            this->m_rowCache.clear();
 
             if (isSelectionValid())
                 EventManager::post<EventRegionSelected>(getSelection());
         });
 
+        EventManager::subscribe<EventRegionDirtied>(this, [this](prv::Provider *provider, const Region &region) {
+            // Modified data has to show up in the minimap strip as well
+            ProviderExtraData::get(provider).miniMap.sampleCount = 0;
+
+            // Drop the cached bytes of every row the modification touches. Custom
+            // encoding sequences can start before the modified range and still cover
+            // it, so the look-behind extends to the longest sequence of the encoding
+            if (region.getSize() == 0) {
+                this->m_rowCache.clear();
+            } else {
+                const u64 lookBehind = std::max<u64>(u64(this->m_bytesPerRow) - 1,
+                                                     this->m_currCustomEncoding.has_value() ? this->m_currCustomEncoding->getLongestSequence() : 0);
+                const u64 firstRow = region.getStartAddress() - std::min<u64>(region.getStartAddress(), lookBehind);
+
+                auto row = this->m_rowCache.lower_bound(firstRow);
+                while (row != this->m_rowCache.end() && row->first <= region.getEndAddress())
+                    row = this->m_rowCache.erase(row);
+            }
+        });
+
         EventManager::subscribe<EventSettingsChanged>(this, [this] {
             {
                 auto bytesPerRow = ContentRegistry::Settings::getSetting("hex.builtin.setting.hex_editor", "hex.builtin.setting.hex_editor.bytes_per_row");
@@ -1636,6 +2311,17 @@ namespace hex::plugin::builtin {
                     this->m_currDataVisualizer = visualizers["hex.builtin.visualizer.hexadecimal.8bit"];
             }
 
+            // The cached cell text depends on the selected visualizer and the
+            // hex case, both of which may just have changed
+            this->m_rowCache.clear();
+
+            {
+                auto miniMap = ContentRegistry::Settings::getSetting("hex.builtin.setting.hex_editor", "hex.builtin.setting.hex_editor.minimap");
+
+                if (miniMap.is_number())
+                    this->m_showMiniMap = static_cast<int>(miniMap);
+            }
+
             {
                 auto syncScrolling = ContentRegistry::Settings::getSetting("hex.builtin.setting.hex_editor", "hex.builtin.setting.hex_editor.sync_scrolling");
 
@@ -1643,6 +2329,13 @@ namespace hex::plugin::builtin {
                     this->m_syncScrolling = static_cast<int>(syncScrolling);
             }
 
+            {
+                auto fastRender = ContentRegistry::Settings::getSetting("hex.builtin.setting.hex_editor", "hex.builtin.setting.hex_editor.fast_render");
+
+                if (fastRender.is_number())
+                    this->m_fastRender = static_cast<int>(fastRender);
+            }
+
             {
                 auto padding = ContentRegistry::Settings::getSetting("hex.builtin.setting.hex_editor", "hex.builtin.setting.hex_editor.byte_padding");
 
@@ -1694,6 +2387,9 @@ namespace hex::plugin::builtin {
                 View::showFileChooserPopup(paths, { {"Thingy Table File", "tbl"} },
                     [this](const auto &path) {
                         this->m_currCustomEncoding = EncodingFile(EncodingFile::Type::Thingy, path);
+
+                        // Cached glyph runs belong to the previous encoding
+                        this->m_rowCache.clear();
                     });
             }
         });
@@ -1739,7 +2435,7 @@ namespace hex::plugin::builtin {
                         ImGui::SetClipboardText(
                             callback(
                                 provider,
-                                selection->getStartAddress() + provider->getBaseAddress() + provider->getCurrentPageAddress(),
+                                selection->getStartAddress() + provider->getBaseAddress(),
                                 selection->size
                                 ).c_str()
                         );
@@ -1749,6 +2445,15 @@ namespace hex::plugin::builtin {
                 ImGui::EndMenu();
             }
 
+            if (ImGui::BeginMenu("hex.builtin.view.hex_editor.menu.edit.export_as"_lang, selection.has_value() && providerValid)) {
+                for (const auto &entry : ContentRegistry::DataFormatter::getExportEntries()) {
+                    if (ImGui::MenuItem(LangEntry(entry.unlocalizedName)))
+                        exportBytes(*selection, entry);
+                }
+
+                ImGui::EndMenu();
+            }
+
             if (ImGui::MenuItem("hex.builtin.view.hex_editor.menu.edit.paste"_lang, "CTRL + V", false, selection.has_value()))
                 pasteBytes(*selection, true);
             if (ImGui::MenuItem("hex.builtin.view.hex_editor.menu.edit.paste_all"_lang, "CTRL + SHIFT + V", false, selection.has_value()))
@@ -1780,6 +2485,10 @@ namespace hex::plugin::builtin {
                 this->openPopup<PopupRemove>(selection->getStartAddress(), selection->getSize());
             }
 
+            if (ImGui::MenuItem("hex.builtin.view.hex_editor.menu.edit.fill"_lang, nullptr, false, providerValid && provider->isWritable() && selection.has_value())) {
+                this->openPopup<PopupFill>(selection->getStartAddress(), selection->getSize());
+            }
+
             if (ImGui::MenuItem("hex.builtin.view.hex_editor.menu.edit.jump_to"_lang, nullptr, false, providerValid && provider->isResizable() && selection.has_value())) {
                 if (selection->getSize() <= sizeof(u64)) {
                     u64 value = 0;
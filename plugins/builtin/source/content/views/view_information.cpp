@@ -1,18 +1,26 @@
 #include "content/views/view_information.hpp"
 
+#include <content/helpers/file_hashes.hpp>
+#include <content/helpers/magic_info.hpp>
+
 #include <hex/api/content_registry.hpp>
+#include <hex/api/project_file_manager.hpp>
 
 #include <hex/providers/provider.hpp>
 #include <hex/providers/buffered_reader.hpp>
 
 #include <hex/helpers/fs.hpp>
-#include <hex/helpers/magic.hpp>
+#include <hex/helpers/utils.hpp>
 
+#include <atomic>
+#include <cctype>
+#include <chrono>
 #include <cstring>
 #include <cmath>
 #include <filesystem>
 #include <numeric>
 #include <span>
+#include <thread>
 
 #include <implot.h>
 
@@ -20,16 +28,24 @@ namespace hex::plugin::builtin {
 
     using namespace hex::literals;
 
+    // Version of the binary analysis cache stored in project files. Bump whenever the layout changes
+    constexpr static u32 AnalysisCacheVersion = 2;
+
+    // The magic type detection reads at most this much from the start of the data
+    constexpr static u64 MagicHeaderSize = 5_MiB;
+
     ViewInformation::ViewInformation() : View("hex.builtin.view.information.name") {
         EventManager::subscribe<EventDataChanged>(this, [this]() {
             this->m_dataValid = false;
             this->m_highestBlockEntropy = 0;
             this->m_blockEntropy.clear();
+            this->m_decimatedEntropy.clear();
             this->m_averageEntropy = 0;
             this->m_blockSize = 0;
             this->m_valueCounts.fill(0x00);
             this->m_dataMimeType.clear();
             this->m_dataDescription.clear();
+            this->m_metricResults.clear();
             this->m_analyzedRegion  = { 0, 0 };
         });
 
@@ -42,6 +58,172 @@ namespace hex::plugin::builtin {
             this->m_dataValid = false;
         });
 
+        EventManager::subscribe<EventRegionDirtied>(this, [this](prv::Provider *provider, Region region) {
+            if (!this->m_dataValid || this->m_analyzerTask.isRunning())
+                return;
+            if (!ImHexApi::Provider::isValid() || provider != ImHexApi::Provider::get())
+                return;
+
+            // m_analyzedRegion.size holds the exclusive end address of the analyzed range.
+            // Dirty regions starting past it can't happen as long as the analysis covered
+            // the entire data, so everything before the region is still up to date
+            if (region.getStartAddress() > this->m_analyzedRegion.size)
+                return;
+
+            this->m_analyzerTask = TaskManager::createTask("hex.builtin.view.information.analyzing", region.getSize(), [this, region](auto &task) {
+                auto provider = ImHexApi::Provider::get();
+                const auto dataEnd = provider->getBaseAddress() + provider->getActualSize();
+
+                // Only the blocks touched by the dirtied region get recomputed
+                this->analyzeBlocks(task, provider, region.getStartAddress(), std::min<u64>(region.getEndAddress() + 1, dataEnd));
+
+                // If the data shrunk, drop the analysis results past its new end
+                if (dataEnd < this->m_analyzedRegion.size) {
+                    const auto blockCount = ((dataEnd - this->m_analyzedRegion.address) + this->m_blockSize - 1) / this->m_blockSize;
+
+                    while (this->m_blockValueCounts.size() > blockCount) {
+                        for (u32 i = 0; i < 256; i++)
+                            this->m_valueCounts[i] -= this->m_blockValueCounts.back()[i];
+                        this->m_blockValueCounts.pop_back();
+                    }
+
+                    if (this->m_blockEntropy.size() > blockCount)
+                        this->m_blockEntropy.resize(blockCount);
+                }
+
+                this->m_analyzedRegion.size = dataEnd;
+
+                this->m_averageEntropy = calculateEntropy(this->m_valueCounts, provider->getSize());
+                if (!this->m_blockEntropy.empty())
+                    this->m_highestBlockEntropy = *std::max_element(this->m_blockEntropy.begin(), this->m_blockEntropy.end());
+                else
+                    this->m_highestBlockEntropy = 0;
+
+                this->updateEntropyPyramid();
+                this->classifyBlocks(provider);
+
+                // The magic type detection only ever looks at the start of the data, so it
+                // only needs to be redone when the dirtied region touches the file header
+                if (region.getStartAddress() < provider->getBaseAddress() + MagicHeaderSize)
+                    std::tie(this->m_dataMimeType, this->m_dataDescription) = getMagicInfo(provider);
+            });
+        });
+
+        ProjectFile::registerPerProviderHandler({
+            .basePath = "analysis_cache.bin",
+            .required = false,
+            .load = [this](prv::Provider *provider, const std::fs::path &basePath, Tar &tar) -> bool {
+                if (!tar.contains(basePath))
+                    return true;
+
+                const auto data = tar.read(basePath);
+                if (data.empty())
+                    return true;
+
+                size_t offset = 0;
+                auto read = [&](void *dest, size_t size) {
+                    if (offset + size > data.size())
+                        throw std::runtime_error("Analysis cache is truncated");
+                    std::memcpy(dest, data.data() + offset, size);
+                    offset += size;
+                };
+                auto readU32    = [&] { u32 value = 0; read(&value, sizeof(value)); return value; };
+                auto readU64    = [&] { u64 value = 0; read(&value, sizeof(value)); return value; };
+                auto readF32    = [&] { float value = 0; read(&value, sizeof(value)); return value; };
+                auto readString = [&readU32, &read] { std::string value(readU32(), '\x00'); read(value.data(), value.size()); return value; };
+
+                if (readU32() != AnalysisCacheVersion)
+                    return true;
+
+                // Cached results belonging to a different revision of the data are silently discarded
+                if (readU64() != provider->getContentFingerprint())
+                    return true;
+
+                // The information view only tracks the analysis of the currently selected provider
+                if (provider != ImHexApi::Provider::get())
+                    return true;
+
+                this->m_blockSize           = readU32();
+                this->m_analyzedRegion      = { readU64(), readU64() };
+                this->m_averageEntropy      = readF32();
+                this->m_highestBlockEntropy = readF32();
+                this->m_dataDescription     = readString();
+                this->m_dataMimeType        = readString();
+
+                for (auto &count : this->m_valueCounts)
+                    count = readU64();
+
+                this->m_blockEntropy.resize(readU32());
+                for (auto &entropy : this->m_blockEntropy)
+                    entropy = readF32();
+                this->updateEntropyPyramid();
+
+                this->m_blockValueCounts.resize(readU32());
+                for (auto &blockCounts : this->m_blockValueCounts)
+                    for (auto &count : blockCounts)
+                        count = readU64();
+                this->classifyBlocks(provider);
+
+                this->m_metricResults.resize(readU32());
+                for (auto &[name, value] : this->m_metricResults) {
+                    name  = readString();
+                    value = readString();
+                }
+
+                this->m_dataValid = true;
+
+                return true;
+            },
+            .store = [this](prv::Provider *provider, const std::fs::path &basePath, Tar &tar) -> bool {
+                // Only the currently analyzed provider has results worth caching
+                if (!this->m_dataValid || this->m_analyzerTask.isRunning() || provider != ImHexApi::Provider::get())
+                    return true;
+
+                std::vector<u8> data;
+                auto write = [&data](const void *src, size_t size) {
+                    const auto bytes = reinterpret_cast<const u8 *>(src);
+                    data.insert(data.end(), bytes, bytes + size);
+                };
+                auto writeU32    = [&write](u32 value) { write(&value, sizeof(value)); };
+                auto writeU64    = [&write](u64 value) { write(&value, sizeof(value)); };
+                auto writeF32    = [&write](float value) { write(&value, sizeof(value)); };
+                auto writeString = [&writeU32, &write](const std::string &value) { writeU32(value.size()); write(value.data(), value.size()); };
+
+                writeU32(AnalysisCacheVersion);
+                writeU64(provider->getContentFingerprint());
+
+                writeU32(this->m_blockSize);
+                writeU64(this->m_analyzedRegion.address);
+                writeU64(this->m_analyzedRegion.size);
+                writeF32(this->m_averageEntropy);
+                writeF32(this->m_highestBlockEntropy);
+                writeString(this->m_dataDescription);
+                writeString(this->m_dataMimeType);
+
+                for (const auto count : this->m_valueCounts)
+                    writeU64(count);
+
+                writeU32(this->m_blockEntropy.size());
+                for (const auto entropy : this->m_blockEntropy)
+                    writeF32(entropy);
+
+                writeU32(this->m_blockValueCounts.size());
+                for (const auto &blockCounts : this->m_blockValueCounts)
+                    for (const auto count : blockCounts)
+                        writeU64(count);
+
+                writeU32(this->m_metricResults.size());
+                for (const auto &[name, value] : this->m_metricResults) {
+                    writeString(name);
+                    writeString(value);
+                }
+
+                tar.write(basePath, data);
+
+                return true;
+            }
+        });
+
         ContentRegistry::FileHandler::add({ ".mgc" }, [](const auto &path) {
             for (const auto &destPath : fs::getDefaultPaths(fs::ImHexPath::Magic)) {
                 if (fs::copyFile(path, destPath / path.filename(), std::fs::copy_options::overwrite_existing)) {
@@ -58,9 +240,11 @@ namespace hex::plugin::builtin {
         EventManager::unsubscribe<EventDataChanged>(this);
         EventManager::unsubscribe<EventRegionSelected>(this);
         EventManager::unsubscribe<EventProviderDeleted>(this);
+        EventManager::unsubscribe<EventRegionDirtied>(this);
     }
 
-    static float calculateEntropy(std::array<ImU64, 256> &valueCounts, size_t blockSize) {
+    template<typename T>
+    static float calculateEntropy(const std::array<T, 256> &valueCounts, size_t blockSize) {
         float entropy = 0;
 
         for (auto count : valueCounts) {
@@ -78,51 +262,290 @@ namespace hex::plugin::builtin {
         this->m_analyzerTask = TaskManager::createTask("hex.builtin.view.information.analyzing", 0, [this](auto &task) {
             auto provider = ImHexApi::Provider::get();
 
-            task.setMaxValue(provider->getActualSize());
+            // One unit of progress for the block pass and one for the metric pass
+            task.setMaxValue(provider->getActualSize() * 2);
 
             this->m_analyzedRegion = { provider->getBaseAddress(), provider->getBaseAddress() + provider->getSize() };
 
-            {
-                magic::compile();
-
-                this->m_dataDescription = magic::getDescription(provider);
-                this->m_dataMimeType    = magic::getMIMEType(provider);
-            }
+            // Usually served from the cache filled right after the provider opened
+            std::tie(this->m_dataMimeType, this->m_dataDescription) = getMagicInfo(provider);
 
             this->m_dataValid = true;
 
             {
                 this->m_blockSize = std::max<u32>(std::ceil(provider->getActualSize() / 2048.0F), 256);
 
-                std::array<ImU64, 256> blockValueCounts = { 0 };
-
                 this->m_blockEntropy.clear();
+                this->m_blockValueCounts.clear();
                 this->m_valueCounts.fill(0);
 
-                auto reader = prv::BufferedReader(provider);
-
-                u64 count = 0;
-                for (u8 byte : reader) {
-                    this->m_valueCounts[byte]++;
-                    blockValueCounts[byte]++;
-
-                    count++;
-                    if ((count % this->m_blockSize) == 0) [[unlikely]] {
-                        this->m_blockEntropy.push_back(calculateEntropy(blockValueCounts, this->m_blockSize));
-                        blockValueCounts = { 0 };
-                        task.update(count);
-                    }
-                }
+                this->analyzeBlocks(task, provider, provider->getBaseAddress(), provider->getBaseAddress() + provider->getActualSize());
 
                 this->m_averageEntropy = calculateEntropy(this->m_valueCounts, provider->getSize());
                 if (!this->m_blockEntropy.empty())
                     this->m_highestBlockEntropy = *std::max_element(this->m_blockEntropy.begin(), this->m_blockEntropy.end());
                 else
                     this->m_highestBlockEntropy = 0;
+
+                this->updateEntropyPyramid();
+                this->classifyBlocks(provider);
+            }
+
+            // All registered metrics consume the same chunk stream, so adding more
+            // metrics doesn't add more passes over the data
+            {
+                const auto &metrics = ContentRegistry::DataMetrics::impl::getMetrics();
+
+                for (auto *metric : metrics)
+                    metric->reset();
+
+                auto reader = prv::BufferedReader(provider);
+                reader.seek(provider->getBaseAddress());
+                reader.setEndAddress(provider->getBaseAddress() + provider->getActualSize() - 1);
+
+                for (const auto &chunk : reader.chunks(1_MiB)) {
+                    for (auto *metric : metrics)
+                        metric->process(chunk.data);
+
+                    task.update(provider->getActualSize() + (chunk.address - provider->getBaseAddress()) + chunk.data.size());
+                }
+
+                this->m_metricResults.clear();
+                for (auto *metric : metrics)
+                    this->m_metricResults.emplace_back(metric->getUnlocalizedName(), metric->getResult());
             }
         });
     }
 
+    void ViewInformation::analyzeBlocks(Task &task, prv::Provider *provider, u64 start, u64 end) {
+        const auto analysisStart = this->m_analyzedRegion.address;
+        const auto dataEnd       = provider->getBaseAddress() + provider->getActualSize();
+
+        // Work on whole blocks so partially dirtied blocks get recomputed completely
+        const u64 firstBlock  = (start - analysisStart) / this->m_blockSize;
+        const u64 totalBlocks = ((dataEnd - analysisStart) + this->m_blockSize - 1) / this->m_blockSize;
+        const u64 lastBlock   = std::min(((end - analysisStart) + this->m_blockSize - 1) / this->m_blockSize, totalBlocks);
+
+        if (firstBlock >= lastBlock)
+            return;
+
+        // Every block's histogram and entropy slot is written by exactly one worker, so the
+        // vectors get sized up front and the workers fill their slices without any merging
+        if (this->m_blockValueCounts.size() < lastBlock)
+            this->m_blockValueCounts.resize(lastBlock, { 0 });
+
+        const u64 fullBlocks = (dataEnd - analysisStart) / this->m_blockSize;
+        if (this->m_blockEntropy.size() < std::min(lastBlock, fullBlocks))
+            this->m_blockEntropy.resize(std::min(lastBlock, fullBlocks), 0.0F);
+
+        std::atomic<u64> progress = 0;
+        std::atomic<bool> stop    = false;
+
+        // Blocks are independent, so each worker owns a contiguous slice of them. Only the
+        // slice's contribution to the global histogram needs to be accounted separately;
+        // it gets collected as a signed delta and folded in once the slice is done
+        const auto processBlocks = [&](u64 blockBegin, u64 blockEnd, std::array<i64, 256> &valueDelta, Task *updateTask) {
+            std::array<u64, 256> blockValueCounts = { 0 };
+            std::vector<u8> blockData(this->m_blockSize);
+
+            for (u64 block = blockBegin; block < blockEnd && !stop; block++) {
+                const auto address   = analysisStart + block * u64(this->m_blockSize);
+                const auto blockSize = std::min<u64>(this->m_blockSize, dataEnd - address);
+
+                // Unallocated regions of sparse files only read as zeros, so blocks that lie
+                // entirely inside one don't need to be read or counted byte by byte
+                const auto [validRegion, hasData] = provider->getRegionValidity(address);
+                if (!hasData && validRegion != Region::Invalid() && validRegion.getEndAddress() >= (address + blockSize) - 1) {
+                    blockValueCounts = { 0 };
+                    blockValueCounts[0x00] = blockSize;
+                } else {
+                    provider->read(address, blockData.data(), blockSize);
+
+                    blockValueCounts = { 0 };
+                    hex::countByteOccurrences({ blockData.data(), blockSize }, blockValueCounts);
+                }
+
+                // Swap out this block's previous contribution to the global histogram
+                auto &oldCounts = this->m_blockValueCounts[block];
+                for (u32 i = 0; i < 256; i++)
+                    valueDelta[i] += i64(blockValueCounts[i]) - i64(oldCounts[i]);
+                oldCounts = blockValueCounts;
+
+                // The entropy plot only contains full blocks
+                if (blockSize == this->m_blockSize) [[likely]]
+                    this->m_blockEntropy[block] = calculateEntropy(blockValueCounts, this->m_blockSize);
+
+                progress += blockSize;
+                if (updateTask != nullptr)
+                    updateTask->update(progress);
+            }
+        };
+
+        // Re-analyses of small dirty windows stay on the calling thread; whole-image
+        // analyses get partitioned across all cores
+        constexpr static u64 MinBlocksPerThread = 8;
+
+        const u64 blockCount = lastBlock - firstBlock;
+        const size_t threadCount = std::min<u64>(std::max<u32>(std::thread::hardware_concurrency(), 1), blockCount / MinBlocksPerThread);
+
+        if (threadCount <= 1) {
+            std::array<i64, 256> valueDelta = { 0 };
+            processBlocks(firstBlock, lastBlock, valueDelta, &task);
+
+            for (u32 i = 0; i < 256; i++)
+                this->m_valueCounts[i] += valueDelta[i];
+
+            return;
+        }
+
+        std::vector<std::array<i64, 256>> valueDeltas(threadCount, { 0 });
+        std::atomic<size_t> finishedWorkers = 0;
+
+        {
+            const u64 blocksPerWorker = (blockCount + threadCount - 1) / threadCount;
+
+            std::vector<std::jthread> workers;
+            for (size_t workerIndex = 0; workerIndex < threadCount; workerIndex++) {
+                const u64 blockBegin = firstBlock + workerIndex * blocksPerWorker;
+                const u64 blockEnd   = std::min(blockBegin + blocksPerWorker, lastBlock);
+
+                workers.emplace_back([&, blockBegin, blockEnd, workerIndex] {
+                    processBlocks(blockBegin, blockEnd, valueDeltas[workerIndex], nullptr);
+                    finishedWorkers++;
+                });
+            }
+
+            // Interrupting the analysis makes update() throw; the workers notice the stop
+            // flag at their next block and get joined on the way out
+            try {
+                while (finishedWorkers < threadCount) {
+                    task.update(progress);
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                }
+
+                task.update(progress);
+            } catch (...) {
+                stop = true;
+                throw;
+            }
+        }
+
+        for (const auto &valueDelta : valueDeltas) {
+            for (u32 i = 0; i < 256; i++)
+                this->m_valueCounts[i] += valueDelta[i];
+        }
+    }
+
+    void ViewInformation::updateEntropyPyramid() {
+        this->m_decimatedEntropy.clear();
+
+        // Levels coarser than this are pointless, the raw samples are cheap enough to draw
+        constexpr static size_t CoarsestLevelSize = 1024;
+
+        if (this->m_blockEntropy.size() <= CoarsestLevelSize)
+            return;
+
+        // The first level collapses buckets of two raw samples into an interleaved
+        // minimum/maximum pair each
+        {
+            std::vector<float> level;
+            level.reserve(this->m_blockEntropy.size());
+            for (size_t i = 0; i < this->m_blockEntropy.size(); i += 2) {
+                const float first  = this->m_blockEntropy[i];
+                const float second = this->m_blockEntropy[std::min(i + 1, this->m_blockEntropy.size() - 1)];
+
+                level.push_back(std::min(first, second));
+                level.push_back(std::max(first, second));
+            }
+
+            this->m_decimatedEntropy.push_back(std::move(level));
+        }
+
+        // Every further level merges two neighbouring min/max buckets of the previous one
+        while (this->m_decimatedEntropy.back().size() > CoarsestLevelSize) {
+            const auto &previous = this->m_decimatedEntropy.back();
+
+            std::vector<float> level;
+            level.reserve(previous.size() / 2 + 2);
+            for (size_t i = 0; (i + 1) < previous.size(); i += 4) {
+                float minValue = previous[i];
+                float maxValue = previous[i + 1];
+                if ((i + 3) < previous.size()) {
+                    minValue = std::min(minValue, previous[i + 2]);
+                    maxValue = std::max(maxValue, previous[i + 3]);
+                }
+
+                level.push_back(minValue);
+                level.push_back(maxValue);
+            }
+
+            this->m_decimatedEntropy.push_back(std::move(level));
+        }
+    }
+
+    // Turns the per-block histograms and entropy values into the provider's typed region
+    // map. This is a pure post-pass over statistics that already exist; it never reads
+    // the data again, so re-running it after every (partial) analysis is essentially free
+    void ViewInformation::classifyBlocks(prv::Provider *provider) {
+        using RegionType = ImHexApi::DataRegions::RegionType;
+
+        // Bytes that dominate compiled x86 code: REX.W and common ModRM mov forms,
+        // 0x0F/0xFF opcode groups, call and ret. Real machine code packs these densely,
+        // everything else rarely does at medium entropy
+        constexpr static std::array<u8, 8> CodeBytes = { 0x0F, 0x48, 0x83, 0x89, 0x8B, 0xC3, 0xE8, 0xFF };
+
+        const auto analysisStart = this->m_analyzedRegion.address;
+        const auto dataEnd       = this->m_analyzedRegion.size;
+
+        std::vector<ImHexApi::DataRegions::TypedRegion> regions;
+
+        for (u64 block = 0; block < this->m_blockValueCounts.size(); block++) {
+            const auto &counts = this->m_blockValueCounts[block];
+
+            u64 totalCount = 0, maxCount = 0, printableCount = 0, codeCount = 0;
+            for (u32 value = 0; value < 256; value++) {
+                totalCount += counts[value];
+                maxCount    = std::max(maxCount, counts[value]);
+
+                if (std::isprint(value) || std::isspace(value))
+                    printableCount += counts[value];
+            }
+
+            for (const auto value : CodeBytes)
+                codeCount += counts[value];
+
+            if (totalCount == 0)
+                continue;
+
+            // The tail block has no precomputed entropy, its histogram provides it instead
+            const float entropy = block < this->m_blockEntropy.size() ? this->m_blockEntropy[block] : calculateEntropy(counts, totalCount);
+
+            auto type = RegionType::Unknown;
+            if (maxCount >= (totalCount * 95) / 100)
+                type = RegionType::Padding;
+            else if (printableCount >= (totalCount * 90) / 100)
+                type = RegionType::Text;
+            else if (entropy > 0.90F)
+                type = RegionType::HighEntropy;
+            else if (entropy > 0.35F && codeCount >= (totalCount * 15) / 100)
+                type = RegionType::Code;
+
+            if (type == RegionType::Unknown)
+                continue;
+
+            const u64 blockStart = analysisStart + block * u64(this->m_blockSize);
+            const u64 blockEnd   = std::min<u64>(blockStart + this->m_blockSize, dataEnd);
+
+            // Runs of equally classified blocks collapse into one region
+            if (!regions.empty() && regions.back().type == type && regions.back().region.getEndAddress() + 1 == blockStart)
+                regions.back().region.size += blockEnd - blockStart;
+            else
+                regions.push_back({ Region { blockStart, blockEnd - blockStart }, type });
+        }
+
+        ImHexApi::DataRegions::set(provider, std::move(regions));
+    }
+
     void ViewInformation::drawContent() {
         if (ImGui::Begin(View::toWindowName("hex.builtin.view.information.name").c_str(), &this->getWindowOpenState(), ImGuiWindowFlags_NoCollapse)) {
             if (ImGui::BeginChild("##scrolling", ImVec2(0, 0), false, ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoNav)) {
@@ -142,6 +565,15 @@ namespace hex::plugin::builtin {
                         ImGui::NewLine();
                     }
 
+                    // Whole-file hashes come from the cache filled in the background when the
+                    // provider was opened, so they're available without running the analysis
+                    {
+                        ImGui::Header("hex.builtin.view.information.file_hashes"_lang, true);
+                        drawFileHashes(provider);
+
+                        ImGui::NewLine();
+                    }
+
                     if (this->m_dataValid) {
 
                         // Analyzed region
@@ -230,7 +662,26 @@ namespace hex::plugin::builtin {
                                 ImPlot::SetupAxes("hex.builtin.common.address"_lang, "hex.builtin.view.information.entropy"_lang, ImPlotAxisFlags_Lock, ImPlotAxisFlags_Lock);
                                 ImPlot::SetupAxesLimits(0, this->m_blockEntropy.size(), -0.1F, 1.1F, ImGuiCond_Always);
 
-                                ImPlot::PlotLine("##entropy_line", this->m_blockEntropy.data(), this->m_blockEntropy.size());
+                                // Submitting more than about two points per pixel only costs time, so pick the
+                                // finest decimation level that stays below that for the currently visible range
+                                const auto  plotLimits    = ImPlot::GetPlotLimits();
+                                const auto  visibleBlocks = std::max(plotLimits.X.Size(), 1.0);
+                                const auto  targetPoints  = std::max<double>(ImPlot::GetPlotSize().x * 2, 2);
+                                const auto  visibleRatio  = visibleBlocks / std::max<double>(this->m_blockEntropy.size(), 1);
+
+                                if (double(this->m_blockEntropy.size()) * visibleRatio <= targetPoints || this->m_decimatedEntropy.empty()) {
+                                    ImPlot::PlotLine("##entropy_line", this->m_blockEntropy.data(), this->m_blockEntropy.size());
+                                } else {
+                                    size_t level = this->m_decimatedEntropy.size() - 1;
+                                    while (level > 0 && double(this->m_decimatedEntropy[level - 1].size()) * visibleRatio <= targetPoints)
+                                        level--;
+
+                                    // Each level stores interleaved min/max pairs, so the sample stream gets
+                                    // mapped back onto block indices through the x scale
+                                    const auto &samples = this->m_decimatedEntropy[level];
+                                    const auto xScale   = double(this->m_blockEntropy.size()) / double(samples.size());
+                                    ImPlot::PlotLine("##entropy_line", samples.data(), samples.size(), xScale);
+                                }
 
                                 if (ImPlot::DragLineX(1, &this->m_entropyHandlePosition, ImGui::GetStyleColorVec4(ImGuiCol_Text))) {
                                     u64 address = u64(std::max<double>(this->m_entropyHandlePosition, 0) * this->m_blockSize) + provider->getBaseAddress();
@@ -272,6 +723,73 @@ namespace hex::plugin::builtin {
                             ImGui::EndTable();
                         }
 
+                        // Streaming metric results
+                        if (!this->m_metricResults.empty()) {
+                            ImGui::NewLine();
+                            ImGui::Header("hex.builtin.view.information.metrics"_lang);
+
+                            if (ImGui::BeginTable("metrics", 2, ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_RowBg)) {
+                                ImGui::TableSetupColumn("type");
+                                ImGui::TableSetupColumn("value", ImGuiTableColumnFlags_WidthStretch);
+
+                                ImGui::TableNextRow();
+
+                                for (const auto &[unlocalizedName, value] : this->m_metricResults) {
+                                    ImGui::TableNextColumn();
+                                    ImGui::TextFormatted("{}", LangEntry(unlocalizedName));
+                                    ImGui::TableNextColumn();
+                                    ImGui::TextFormatted("{}", value);
+                                }
+
+                                ImGui::EndTable();
+                            }
+                        }
+
+                        // Typed region map
+                        if (const auto &typedRegions = ImHexApi::DataRegions::get(provider); !typedRegions.empty()) {
+                            ImGui::NewLine();
+                            ImGui::Header("hex.builtin.view.information.region_map"_lang);
+
+                            const auto regionTypeStyle = [](ImHexApi::DataRegions::RegionType type) -> std::pair<const char *, ImVec4> {
+                                switch (type) {
+                                    case ImHexApi::DataRegions::RegionType::Padding:     return { "hex.builtin.view.information.region_map.padding",      ImVec4(0.60F, 0.60F, 0.60F, 1.0F) };
+                                    case ImHexApi::DataRegions::RegionType::Text:        return { "hex.builtin.view.information.region_map.text",         ImVec4(0.30F, 0.80F, 0.30F, 1.0F) };
+                                    case ImHexApi::DataRegions::RegionType::Code:        return { "hex.builtin.view.information.region_map.code",         ImVec4(0.40F, 0.60F, 0.95F, 1.0F) };
+                                    case ImHexApi::DataRegions::RegionType::HighEntropy: return { "hex.builtin.view.information.region_map.high_entropy", ImVec4(0.92F, 0.40F, 0.30F, 1.0F) };
+                                    default:                                             return { "hex.builtin.view.information.region_map.unknown",      ImVec4(1.00F, 1.00F, 1.00F, 1.0F) };
+                                }
+                            };
+
+                            if (ImGui::BeginTable("region_map", 3, ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_RowBg)) {
+                                ImGui::TableSetupColumn("type");
+                                ImGui::TableSetupColumn("region", ImGuiTableColumnFlags_WidthStretch);
+                                ImGui::TableSetupColumn("size");
+
+                                for (u32 index = 0; index < typedRegions.size(); index++) {
+                                    const auto &entry = typedRegions[index];
+                                    const auto [unlocalizedName, color] = regionTypeStyle(entry.type);
+
+                                    ImGui::TableNextRow();
+
+                                    ImGui::TableNextColumn();
+                                    ImGui::PushID(index);
+                                    if (ImGui::Selectable("##typed_region", false, ImGuiSelectableFlags_SpanAllColumns | ImGuiSelectableFlags_AllowItemOverlap))
+                                        ImHexApi::HexEditor::setSelection(entry.region);
+                                    ImGui::PopID();
+                                    ImGui::SameLine();
+                                    ImGui::TextFormattedColored(color, "{}", LangEntry(unlocalizedName));
+
+                                    ImGui::TableNextColumn();
+                                    ImGui::TextFormatted("0x{:X} - 0x{:X}", entry.region.getStartAddress(), entry.region.getEndAddress());
+
+                                    ImGui::TableNextColumn();
+                                    ImGui::TextFormatted("{}", hex::toByteString(entry.region.getSize()));
+                                }
+
+                                ImGui::EndTable();
+                            }
+                        }
+
                         if (this->m_averageEntropy > 0.83 && this->m_highestBlockEntropy > 0.9) {
                             ImGui::NewLine();
                             ImGui::TextFormattedColored(ImVec4(0.92F, 0.25F, 0.2F, 1.0F), "{}", "hex.builtin.view.information.encrypted"_lang);
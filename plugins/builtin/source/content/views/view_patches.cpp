@@ -3,8 +3,12 @@
 #include <hex/providers/provider.hpp>
 
 #include <hex/api/project_file_manager.hpp>
+#include <hex/helpers/fmt.hpp>
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
+#include <array>
+#include <span>
 #include <string>
 
 using namespace std::literals::string_literals;
@@ -18,18 +22,26 @@ namespace hex::plugin::builtin {
             .required = false,
             .load = [](prv::Provider *provider, const std::fs::path &basePath, Tar &tar) {
                 auto json = nlohmann::json::parse(tar.read(basePath));
-                provider->getPatches() = json["patches"].get<std::map<u64, u8>>();
+                provider->getPatches().fromMap(json["patches"].get<std::map<u64, u8>>());
                 return true;
             },
             .store = [](prv::Provider *provider, const std::fs::path &basePath, Tar &tar) {
                 nlohmann::json json;
-                json["patches"] = provider->getPatches();
+                json["patches"] = provider->getPatches().toMap();
                 tar.write(basePath, json.dump(4));
 
                 return true;
             }
         });
 
+        EventManager::subscribe<EventRegionDirtied>(this, [this](prv::Provider *, const Region &) {
+            this->m_runsValid = false;
+        });
+
+        EventManager::subscribe<EventProviderChanged>(this, [this](prv::Provider *, prv::Provider *) {
+            this->m_runsValid = false;
+        });
+
         ImHexApi::HexEditor::addForegroundHighlightingProvider([](u64 offset, const u8* buffer, size_t, bool) -> std::optional<color_t> {
             hex::unused(buffer);
 
@@ -49,12 +61,35 @@ namespace hex::plugin::builtin {
         });
     }
 
+    ViewPatches::~ViewPatches() {
+        EventManager::unsubscribe<EventRegionDirtied>(this);
+        EventManager::unsubscribe<EventProviderChanged>(this);
+    }
+
     void ViewPatches::drawContent() {
         if (ImGui::Begin(View::toWindowName("hex.builtin.view.patches.name").c_str(), &this->getWindowOpenState(), ImGuiWindowFlags_NoCollapse)) {
             auto provider = ImHexApi::Provider::get();
 
             if (ImHexApi::Provider::isValid() && provider->isReadable()) {
 
+                auto &patches = provider->getPatches();
+
+                // Contiguous patches are grouped into one run row each. The runs are
+                // snapshotted into a flat array whenever the patches changed so the
+                // clipper can index rows directly
+                if (!this->m_runsValid) {
+                    this->m_patchRuns.clear();
+
+                    patches.forEachRun([this](u64 address, std::span<const u8> bytes) {
+                        if (!this->m_patchRuns.empty() && this->m_patchRuns.back().address + this->m_patchRuns.back().size == address)
+                            this->m_patchRuns.back().size += bytes.size();
+                        else
+                            this->m_patchRuns.push_back({ address, bytes.size() });
+                    });
+
+                    this->m_runsValid = true;
+                }
+
                 if (ImGui::BeginTable("##patchesTable", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_Sortable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY)) {
                     ImGui::TableSetupScrollFreeze(0, 1);
                     ImGui::TableSetupColumn("hex.builtin.view.patches.offset"_lang);
@@ -63,49 +98,66 @@ namespace hex::plugin::builtin {
 
                     ImGui::TableHeadersRow();
 
-                    auto &patches = provider->getPatches();
-                    u32 index     = 0;
+                    constexpr static u64 MaxShownBytes = 8;
 
                     ImGuiListClipper clipper;
 
-                    clipper.Begin(patches.size());
+                    clipper.Begin(int(this->m_patchRuns.size()));
                     while (clipper.Step()) {
-                        auto iter = patches.begin();
-                        for (auto i = 0; i < clipper.DisplayStart; i++)
-                            iter++;
-
                         for (auto i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
-                            const auto &[address, patch] = *iter;
+                            const auto &[address, size] = this->m_patchRuns[i];
 
                             ImGui::TableNextRow();
                             ImGui::TableNextColumn();
 
-                            if (ImGui::Selectable(("##patchLine" + std::to_string(index)).c_str(), false, ImGuiSelectableFlags_SpanAllColumns)) {
-                                ImHexApi::HexEditor::setSelection(address, 1);
+                            if (ImGui::Selectable(("##patchLine" + std::to_string(i)).c_str(), false, ImGuiSelectableFlags_SpanAllColumns)) {
+                                ImHexApi::HexEditor::setSelection(address, size);
                             }
                             if (ImGui::IsMouseReleased(1) && ImGui::IsItemHovered()) {
                                 ImGui::OpenPopup("PatchContextMenu");
-                                this->m_selectedPatch = address;
+                                this->m_selectedPatch     = address;
+                                this->m_selectedPatchSize = size;
                             }
                             ImGui::SameLine();
-                            ImGui::TextFormatted("0x{0:08X}", address);
 
-                            ImGui::TableNextColumn();
-                            u8 previousValue = 0x00;
-                            provider->readRaw(address, &previousValue, sizeof(u8));
-                            ImGui::TextFormatted("0x{0:02X}", previousValue);
+                            if (size == 1)
+                                ImGui::TextFormatted("0x{0:08X}", address);
+                            else
+                                ImGui::TextFormatted("0x{0:08X} - 0x{1:08X}", address, address + size - 1);
+
+                            const u64 shownBytes = std::min(size, MaxShownBytes);
 
                             ImGui::TableNextColumn();
-                            ImGui::TextFormatted("0x{0:02X}", patch);
-                            index += 1;
+                            {
+                                std::array<u8, MaxShownBytes> previousValues = { };
+                                provider->readRaw(address, previousValues.data(), shownBytes);
+
+                                std::string text;
+                                for (u64 n = 0; n < shownBytes; n++)
+                                    text += hex::format("{0:02X} ", previousValues[n]);
+                                if (size > shownBytes)
+                                    text += "...";
+                                ImGui::TextUnformatted(text.c_str());
+                            }
 
-                            iter++;
+                            ImGui::TableNextColumn();
+                            {
+                                std::string text;
+                                for (u64 n = 0; n < shownBytes; n++)
+                                    text += hex::format("{0:02X} ", patches.at(address + n));
+                                if (size > shownBytes)
+                                    text += "...";
+                                ImGui::TextUnformatted(text.c_str());
+                            }
                         }
                     }
 
                     if (ImGui::BeginPopup("PatchContextMenu")) {
                         if (ImGui::MenuItem("hex.builtin.view.patches.remove"_lang)) {
-                            patches.erase(this->m_selectedPatch);
+                            for (u64 n = 0; n < this->m_selectedPatchSize; n++)
+                                patches.erase(this->m_selectedPatch + n);
+
+                            this->m_runsValid = false;
                         }
                         ImGui::EndPopup();
                     }
@@ -1,11 +1,25 @@
 #include "content/views/view_pattern_data.hpp"
 
 #include <hex/providers/provider.hpp>
+#include <hex/helpers/file.hpp>
+#include <hex/helpers/fmt.hpp>
+#include <hex/helpers/fs.hpp>
+#include <hex/ui/imgui_imhex_extensions.h>
 
 #include <pl/patterns/pattern.hpp>
+#include <pl/patterns/pattern_array_dynamic.hpp>
+#include <pl/patterns/pattern_array_static.hpp>
+#include <pl/patterns/pattern_bitfield.hpp>
+#include <pl/patterns/pattern_padding.hpp>
+#include <pl/patterns/pattern_pointer.hpp>
+#include <pl/patterns/pattern_struct.hpp>
+#include <pl/patterns/pattern_union.hpp>
 
 #include <content/helpers/provider_extra_data.hpp>
 
+#include <functional>
+#include <string>
+
 namespace hex::plugin::builtin {
 
     ViewPatternData::ViewPatternData() : View("hex.builtin.view.pattern_data.name") {
@@ -19,10 +33,15 @@ namespace hex::plugin::builtin {
         EventManager::subscribe<EventProviderClosed>([this](auto *provider) {
             this->m_sortedPatterns[provider].clear();
         });
+
+        EventManager::subscribe<EventRegionDirtied>(this, [this](prv::Provider *, const Region &region) {
+            this->m_patternDrawer.invalidateValues(region);
+        });
     }
 
     ViewPatternData::~ViewPatternData() {
         EventManager::unsubscribe<EventHighlightingChanged>(this);
+        EventManager::unsubscribe<EventRegionDirtied>(this);
     }
 
     static bool sortPatterns(prv::Provider *provider, const ImGuiTableSortSpecs* sortSpecs, const pl::ptrn::Pattern * left, const pl::ptrn::Pattern * right) {
@@ -72,7 +91,7 @@ namespace hex::plugin::builtin {
         return false;
     }
 
-    static bool beginPatternTable(prv::Provider *&provider, const std::vector<std::shared_ptr<pl::ptrn::Pattern>> &patterns, std::vector<pl::ptrn::Pattern*> &sortedPatterns) {
+    static bool beginPatternTable(prv::Provider *&provider, const std::vector<std::shared_ptr<pl::ptrn::Pattern>> &patterns, std::vector<pl::ptrn::Pattern*> &sortedPatterns, PatternDrawer &drawer) {
         if (ImGui::BeginTable("##Patterntable", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_Sortable | ImGuiTableFlags_Hideable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY)) {
             ImGui::TableSetupScrollFreeze(0, 1);
             ImGui::TableSetupColumn("hex.builtin.view.pattern_data.var_name"_lang, ImGuiTableColumnFlags_PreferSortAscending, 0, ImGui::GetID("name"));
@@ -99,6 +118,10 @@ namespace hex::plugin::builtin {
                         return sortPatterns(provider, sortSpecs, left, right);
                     });
 
+                // Re-sorting reorders children inside the patterns too, so the
+                // drawer's flattened rows are stale even if the top level matches
+                drawer.invalidateRows();
+
                 sortSpecs->SpecsDirty = false;
             }
 
@@ -108,6 +131,207 @@ namespace hex::plugin::builtin {
         return false;
     }
 
+    // The output is streamed through this buffer, so exporting even a huge parse
+    // tree never materializes more than one buffer worth of text in memory
+    constexpr static size_t ExportBufferFlushSize = 0x10'0000;
+
+    static void flushExportBuffer(fs::File &file, std::string &buffer) {
+        if (buffer.size() < ExportBufferFlushSize)
+            return;
+
+        file.write(buffer);
+        buffer.clear();
+    }
+
+    static std::string escapeJsonString(const std::string &value) {
+        std::string result;
+        result.reserve(value.size());
+
+        for (const char c : value) {
+            switch (c) {
+                case '\"': result += "\\\""; break;
+                case '\\': result += "\\\\"; break;
+                case '\n': result += "\\n";  break;
+                case '\r': result += "\\r";  break;
+                case '\t': result += "\\t";  break;
+                default:
+                    if (u8(c) < 0x20)
+                        result += hex::format("\\u{:04X}", c);
+                    else
+                        result += c;
+            }
+        }
+
+        return result;
+    }
+
+    static std::string escapeCsvField(const std::string &value) {
+        if (value.find_first_of(",\"\n\r") == std::string::npos)
+            return value;
+
+        std::string result = "\"";
+        for (const char c : value) {
+            if (c == '\"')
+                result += "\"\"";
+            else
+                result += c;
+        }
+        result += '\"';
+
+        return result;
+    }
+
+    // Invokes the callback for every child the pattern contributes to the export,
+    // nested the same way the pattern data table nests them. Returns whether the
+    // pattern is a container at all; sealed containers export as plain values
+    static bool forEachExportChild(pl::ptrn::Pattern &pattern, const std::function<void(pl::ptrn::Pattern &)> &callback) {
+        if (pattern.isSealed())
+            return false;
+
+        if (auto pointer = dynamic_cast<pl::ptrn::PatternPointer *>(&pattern); pointer != nullptr) {
+            if (callback)
+                callback(*pointer->getPointedAtPattern());
+        } else if (auto bitfield = dynamic_cast<pl::ptrn::PatternBitfield *>(&pattern); bitfield != nullptr) {
+            if (callback)
+                bitfield->forEachMember([&](auto &field) {
+                    callback(field);
+                });
+        } else if (auto structPattern = dynamic_cast<pl::ptrn::PatternStruct *>(&pattern); structPattern != nullptr) {
+            if (callback)
+                structPattern->forEachEntry(0, structPattern->getMembers().size(), [&](u64, auto *member) {
+                    callback(*member);
+                });
+        } else if (auto unionPattern = dynamic_cast<pl::ptrn::PatternUnion *>(&pattern); unionPattern != nullptr) {
+            if (callback)
+                unionPattern->forEachEntry(0, unionPattern->getEntryCount(), [&](u64, auto *member) {
+                    callback(*member);
+                });
+        } else if (auto dynamicArray = dynamic_cast<pl::ptrn::PatternArrayDynamic *>(&pattern); dynamicArray != nullptr) {
+            if (callback)
+                dynamicArray->forEachEntry(0, dynamicArray->getEntryCount(), [&](u64, auto *entry) {
+                    callback(*entry);
+                });
+        } else if (auto staticArray = dynamic_cast<pl::ptrn::PatternArrayStatic *>(&pattern); staticArray != nullptr) {
+            if (callback)
+                staticArray->forEachEntry(0, staticArray->getEntryCount(), [&](u64, auto *entry) {
+                    callback(*entry);
+                });
+        } else {
+            return false;
+        }
+
+        return true;
+    }
+
+    // Returns whether the pattern produced an element, so the caller knows if the
+    // next sibling needs a separating comma
+    static bool exportPatternAsJson(Task &task, u64 progress, fs::File &file, std::string &buffer, pl::ptrn::Pattern &pattern, bool firstElement) {
+        if (pattern.isHidden() || dynamic_cast<pl::ptrn::PatternPadding *>(&pattern) != nullptr)
+            return false;
+
+        task.update(progress);
+
+        if (!firstElement)
+            buffer += ',';
+
+        buffer += hex::format(R"({{"name":"{}","offset":{},"size":{},"type":"{}","value":"{}")",
+            escapeJsonString(pattern.getDisplayName()),
+            pattern.getOffset(),
+            pattern.getSize(),
+            escapeJsonString(pattern.getTypeName()),
+            escapeJsonString(pattern.getFormattedValue()));
+
+        if (forEachExportChild(pattern, nullptr)) {
+            buffer += R"(,"children":[)";
+
+            bool firstChild = true;
+            forEachExportChild(pattern, [&](pl::ptrn::Pattern &child) {
+                if (exportPatternAsJson(task, progress, file, buffer, child, firstChild))
+                    firstChild = false;
+            });
+
+            buffer += ']';
+        }
+
+        buffer += '}';
+
+        flushExportBuffer(file, buffer);
+
+        return true;
+    }
+
+    static void exportPatternAsCsv(Task &task, u64 progress, fs::File &file, std::string &buffer, pl::ptrn::Pattern &pattern, const std::string &parentPath) {
+        if (pattern.isHidden() || dynamic_cast<pl::ptrn::PatternPadding *>(&pattern) != nullptr)
+            return;
+
+        task.update(progress);
+
+        const auto path = parentPath.empty() ? pattern.getDisplayName() : parentPath + "." + pattern.getDisplayName();
+
+        buffer += hex::format("{},{},{},{},{}\n",
+            escapeCsvField(path),
+            pattern.getOffset(),
+            pattern.getSize(),
+            escapeCsvField(pattern.getTypeName()),
+            escapeCsvField(pattern.getFormattedValue()));
+
+        flushExportBuffer(file, buffer);
+
+        forEachExportChild(pattern, [&](pl::ptrn::Pattern &child) {
+            exportPatternAsCsv(task, progress, file, buffer, child, path);
+        });
+    }
+
+    void ViewPatternData::exportPatterns(ExportFormat format) {
+        const std::vector<nfdfilteritem_t> extensions = format == ExportFormat::Json
+            ? std::vector<nfdfilteritem_t>{ { "JSON file", "json" } }
+            : std::vector<nfdfilteritem_t>{ { "CSV file", "csv" } };
+
+        fs::openFileBrowser(fs::DialogMode::Save, extensions, [this, format](const std::fs::path &path) {
+            auto &patternLanguage = ProviderExtraData::getCurrent().patternLanguage;
+            if (patternLanguage.runtime == nullptr)
+                return;
+
+            const auto patternCount = patternLanguage.runtime->getAllPatterns().size();
+
+            this->m_exportTask = TaskManager::createTask("hex.builtin.view.pattern_data.exporting", patternCount, [&patternLanguage, path, format](auto &task) {
+                // The runtime stays locked for the whole walk, so a re-evaluation
+                // cannot free the pattern tree while it's being written out
+                std::scoped_lock lock(patternLanguage.runtimeMutex);
+
+                fs::File file(path, fs::File::Mode::Create);
+                if (!file.isValid()) {
+                    TaskManager::doLater([] { View::showErrorPopup("hex.builtin.popup.error.create"_lang); });
+                    return;
+                }
+
+                std::string buffer;
+                buffer.reserve(ExportBufferFlushSize + 0x1000);
+
+                const auto &patterns = patternLanguage.runtime->getAllPatterns();
+
+                if (format == ExportFormat::Json) {
+                    buffer += '[';
+
+                    bool firstElement = true;
+                    for (u64 i = 0; i < patterns.size(); i++) {
+                        if (exportPatternAsJson(task, i, file, buffer, *patterns[i], firstElement))
+                            firstElement = false;
+                    }
+
+                    buffer += "]\n";
+                } else {
+                    buffer += "name,offset,size,type,value\n";
+
+                    for (u64 i = 0; i < patterns.size(); i++)
+                        exportPatternAsCsv(task, i, file, buffer, *patterns[i], "");
+                }
+
+                file.write(buffer);
+            });
+        });
+    }
+
     void ViewPatternData::drawContent() {
         if (ImGui::Begin(View::toWindowName("hex.builtin.view.pattern_data.name").c_str(), &this->getWindowOpenState(), ImGuiWindowFlags_NoCollapse)) {
             if (ImHexApi::Provider::isValid()) {
@@ -123,15 +347,27 @@ namespace hex::plugin::builtin {
                     }
                 }();
 
+                ImGui::BeginDisabled(patterns.empty() || this->m_exportTask.isRunning());
+                {
+                    if (ImGui::Button("hex.builtin.view.pattern_data.export.json"_lang))
+                        this->exportPatterns(ExportFormat::Json);
+                    ImGui::SameLine();
+                    if (ImGui::Button("hex.builtin.view.pattern_data.export.csv"_lang))
+                        this->exportPatterns(ExportFormat::Csv);
+                }
+                ImGui::EndDisabled();
+
+                if (this->m_exportTask.isRunning()) {
+                    ImGui::SameLine();
+                    ImGui::TextSpinner("hex.builtin.view.pattern_data.exporting"_lang);
+                }
+
                 auto &sortedPatterns = this->m_sortedPatterns[ImHexApi::Provider::get()];
-                if (beginPatternTable(provider, patterns, sortedPatterns)) {
+                if (beginPatternTable(provider, patterns, sortedPatterns, this->m_patternDrawer)) {
                     ImGui::TableHeadersRow();
 
-                    if (!sortedPatterns.empty()) {
-                        for (auto &pattern : sortedPatterns) {
-                            this->m_patternDrawer.draw(*pattern);
-                        }
-                    }
+                    if (!sortedPatterns.empty())
+                        this->m_patternDrawer.draw(sortedPatterns);
 
                     ImGui::EndTable();
                 }
@@ -3,6 +3,13 @@
 #include <hex/api/content_registry.hpp>
 
 #include <pl/patterns/pattern.hpp>
+#include <pl/patterns/pattern_array_dynamic.hpp>
+#include <pl/patterns/pattern_array_static.hpp>
+#include <pl/patterns/pattern_bitfield.hpp>
+#include <pl/patterns/pattern_padding.hpp>
+#include <pl/patterns/pattern_pointer.hpp>
+#include <pl/patterns/pattern_struct.hpp>
+#include <pl/patterns/pattern_union.hpp>
 #include <pl/core/preprocessor.hpp>
 #include <pl/core/parser.hpp>
 #include <pl/core/ast/ast_node_variable_decl.hpp>
@@ -13,12 +20,14 @@
 #include <hex/helpers/utils.hpp>
 #include <hex/helpers/file.hpp>
 #include <hex/api/project_file_manager.hpp>
-#include <hex/helpers/magic.hpp>
 
+#include <content/helpers/magic_info.hpp>
 #include <content/helpers/provider_extra_data.hpp>
 
 #include <nlohmann/json.hpp>
+#include <algorithm>
 #include <chrono>
+#include <functional>
 
 namespace hex::plugin::builtin {
 
@@ -95,6 +104,7 @@ namespace hex::plugin::builtin {
 
     ViewPatternEditor::~ViewPatternEditor() {
         EventManager::unsubscribe<RequestSetPatternLanguageCode>(this);
+        EventManager::unsubscribe<EventRegionDirtied>(this);
         EventManager::unsubscribe<EventFileLoaded>(this);
         EventManager::unsubscribe<EventProviderDeleted>(this);
         EventManager::unsubscribe<RequestChangeTheme>(this);
@@ -168,10 +178,19 @@ namespace hex::plugin::builtin {
 
                 if (this->m_textEditor.IsTextChanged()) {
                     this->m_hasUnevaluatedChanges = true;
+                    this->m_lastEditTime = std::chrono::steady_clock::now();
                     ImHexApi::Provider::markDirty();
+
+                    // Typing cancels the in-flight evaluation right away instead of
+                    // waiting for it to finish before the next run can start
+                    if (this->m_runAutomatically && this->m_runningEvaluators != 0)
+                        runtime->abort();
                 }
 
-                if (this->m_hasUnevaluatedChanges && this->m_runningEvaluators == 0 && this->m_runningParsers == 0) {
+                constexpr static auto EvaluationDebounceInterval = std::chrono::milliseconds(250);
+
+                if (this->m_hasUnevaluatedChanges && this->m_runningEvaluators == 0 && this->m_runningParsers == 0
+                    && std::chrono::steady_clock::now() - this->m_lastEditTime >= EvaluationDebounceInterval) {
                     this->m_hasUnevaluatedChanges = false;
 
 
@@ -184,8 +203,6 @@ namespace hex::plugin::builtin {
                 }
 
                 if (!this->m_lastEvaluationProcessed) {
-                    extraData.console = extraData.lastEvaluationLog;
-
                     if (!this->m_lastEvaluationResult) {
                         if (extraData.lastEvaluationError) {
                             TextEditor::ErrorMarkers errorMarkers = {
@@ -204,6 +221,15 @@ namespace hex::plugin::builtin {
 
                     this->m_lastEvaluationProcessed = true;
                     extraData.executionDone = true;
+
+                    // A run that raced a data write produced results over torn data,
+                    // so it gets thrown away and evaluated again
+                    if (this->m_dataModifiedDuringEvaluation) {
+                        this->m_dataModifiedDuringEvaluation = false;
+
+                        if (this->m_runAutomatically)
+                            this->m_hasUnevaluatedChanges = true;
+                    }
                 }
             }
 
@@ -235,16 +261,21 @@ namespace hex::plugin::builtin {
         ImGui::End();
     }
 
-    void ViewPatternEditor::drawConsole(ImVec2 size, const std::vector<std::pair<pl::core::LogConsole::Level, std::string>> &console) {
+    void ViewPatternEditor::drawConsole(ImVec2 size, PlData::Console &console) {
         ImGui::PushStyleColor(ImGuiCol_ChildBg, this->m_textEditor.GetPalette()[u32(TextEditor::PaletteIndex::Background)]);
         if (ImGui::BeginChild("##console", size, true, ImGuiWindowFlags_AlwaysVerticalScrollbar | ImGuiWindowFlags_HorizontalScrollbar)) {
+            std::scoped_lock lock(console.mutex);
+
+            if (console.droppedLines > 0)
+                ImGui::TextFormattedDisabled("hex.builtin.view.pattern_editor.console.dropped"_lang, console.droppedLines);
+
             ImGuiListClipper clipper;
 
             clipper.Begin(console.size());
 
             while (clipper.Step())
                 for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
-                    const auto &[level, message] = console[i];
+                    const auto &[level, message] = console.get(i);
 
                     switch (level) {
                         using enum pl::core::LogConsole::Level;
@@ -588,16 +619,20 @@ namespace hex::plugin::builtin {
 
         this->m_runningEvaluators++;
         patternLanguage.executionDone = false;
+        this->m_dataModifiedDuringEvaluation = false;
 
         this->m_textEditor.SetErrorMarkers({});
-        patternLanguage.console.clear();
+
+        // The capacity is re-read here so a settings change applies from the next run on
+        const auto consoleCapacity = ContentRegistry::Settings::read("hex.builtin.setting.general", "hex.builtin.setting.general.pattern_console_lines", 0x1'0000);
+        patternLanguage.console.reset(std::max<i64>(1, consoleCapacity));
 
 
         ContentRegistry::PatternLanguage::configureRuntime(*patternLanguage.runtime, provider);
 
         EventManager::post<EventHighlightingChanged>();
 
-        TaskManager::createTask("hex.builtin.view.pattern_editor.evaluating", TaskManager::NoProgress, [this, &patternLanguage, code](auto &task) {
+        TaskManager::createTask("hex.builtin.view.pattern_editor.evaluating", TaskManager::NoProgress, [this, provider, &patternLanguage, code](auto &task) {
             std::scoped_lock lock(patternLanguage.runtimeMutex);
             auto &runtime = patternLanguage.runtime;
 
@@ -624,31 +659,124 @@ namespace hex::plugin::builtin {
             });
 
             ON_SCOPE_EXIT {
-                patternLanguage.lastEvaluationLog     = runtime->getConsoleLog();
+                // The whole log is handed to the console ring in one batch; the
+                // ring discards all but the newest lines itself
+                auto log = runtime->getConsoleLog();
+                log.emplace_back(
+                   pl::core::LogConsole::Level::Info,
+                   hex::format("Evaluation took {}", runtime->getLastRunningTime())
+                );
+                patternLanguage.console.append(std::move(log));
+
                 patternLanguage.lastEvaluationOutVars = runtime->getOutVariables();
                 this->m_runningEvaluators--;
 
                 this->m_lastEvaluationProcessed = false;
-
-                patternLanguage.lastEvaluationLog.emplace_back(
-                   pl::core::LogConsole::Level::Info,
-                   hex::format("Evaluation took {}", runtime->getLastRunningTime())
-                );
             };
 
 
             this->m_lastEvaluationResult = runtime->executeString(code, envVars, inVariables);
             if (!this->m_lastEvaluationResult) {
                 patternLanguage.lastEvaluationError = runtime->getError();
+            } else {
+                this->updatePatternHighlights(provider);
             }
         });
     }
 
+    void ViewPatternEditor::updatePatternHighlights(prv::Provider *provider) {
+        auto &patternLanguage = ProviderExtraData::get(provider).patternLanguage;
+
+        auto &highlights = patternLanguage.highlights;
+        highlights.clear();
+        patternLanguage.maxHighlightSize = 0;
+
+        auto emit = [&](u64 address, u64 size, color_t color) {
+            if (size > 0)
+                highlights.push_back({ Region { address, size }, color });
+        };
+
+        // Nested patterns blend their color with their ancestors', approximating
+        // what the old per-byte lookup computed for the innermost pattern covering
+        // each byte
+        std::function<void(pl::ptrn::Pattern &, std::optional<color_t>)> collect = [&](pl::ptrn::Pattern &pattern, std::optional<color_t> inheritedColor) {
+            if (pattern.isHidden())
+                return;
+
+            const color_t color = inheritedColor.has_value() ? ImAlphaBlendColors(*inheritedColor, pattern.getColor()) : pattern.getColor();
+
+            auto collectEntries = [&](auto &iteratablePattern, u64 entryCount) {
+                if (pattern.isSealed()) {
+                    emit(pattern.getOffset(), pattern.getSize(), color);
+                } else {
+                    iteratablePattern.forEachEntry(0, entryCount, [&](u64, auto *entry) {
+                        collect(*entry, color);
+                    });
+                }
+            };
+
+            if (dynamic_cast<pl::ptrn::PatternPadding *>(&pattern) != nullptr) {
+                return;
+            } else if (auto pointer = dynamic_cast<pl::ptrn::PatternPointer *>(&pattern); pointer != nullptr) {
+                emit(pattern.getOffset(), pattern.getSize(), color);
+                if (!pattern.isSealed())
+                    collect(*pointer->getPointedAtPattern(), std::nullopt);
+            } else if (auto structPattern = dynamic_cast<pl::ptrn::PatternStruct *>(&pattern); structPattern != nullptr) {
+                collectEntries(*structPattern, structPattern->getMembers().size());
+            } else if (auto unionPattern = dynamic_cast<pl::ptrn::PatternUnion *>(&pattern); unionPattern != nullptr) {
+                collectEntries(*unionPattern, unionPattern->getEntryCount());
+            } else if (auto dynamicArray = dynamic_cast<pl::ptrn::PatternArrayDynamic *>(&pattern); dynamicArray != nullptr) {
+                collectEntries(*dynamicArray, dynamicArray->getEntryCount());
+            } else if (auto staticArray = dynamic_cast<pl::ptrn::PatternArrayStatic *>(&pattern); staticArray != nullptr) {
+                collectEntries(*staticArray, staticArray->getEntryCount());
+            } else {
+                // Leaves, bitfields included. Bitfields publish one interval for the
+                // whole field block instead of per-bit entries
+                emit(pattern.getOffset(), pattern.getSize(), color);
+            }
+        };
+
+        for (const auto &pattern : patternLanguage.runtime->getAllPatterns())
+            collect(*pattern, std::nullopt);
+
+        // Pointers can jump backwards in the file, so sort before merging adjacent
+        // intervals of the same color. A full-file array of one type collapses into
+        // a handful of entries this way
+        std::stable_sort(highlights.begin(), highlights.end(), [](const auto &a, const auto &b) {
+            return a.getRegion().getStartAddress() < b.getRegion().getStartAddress();
+        });
+
+        std::vector<ImHexApi::HexEditor::Highlighting> merged;
+        merged.reserve(highlights.size());
+        for (const auto &highlighting : highlights) {
+            const auto &region = highlighting.getRegion();
+
+            if (!merged.empty()) {
+                auto &last = merged.back();
+                if (last.getColor() == highlighting.getColor() && last.getRegion().getStartAddress() + last.getRegion().size == region.getStartAddress()) {
+                    last = { Region { last.getRegion().getStartAddress(), last.getRegion().size + region.size }, last.getColor() };
+                    continue;
+                }
+            }
+
+            merged.push_back(highlighting);
+        }
+        highlights = std::move(merged);
+
+        for (const auto &highlighting : highlights)
+            patternLanguage.maxHighlightSize = std::max<u64>(patternLanguage.maxHighlightSize, highlighting.getRegion().size);
+    }
+
     void ViewPatternEditor::registerEvents() {
         EventManager::subscribe<RequestSetPatternLanguageCode>(this, [this](const std::string &code) {
             this->m_textEditor.SetText(code);
         });
 
+        EventManager::subscribe<EventRegionDirtied>(this, [this](prv::Provider *, const Region &) {
+            if (this->m_runningEvaluators != 0)
+                this->m_dataModifiedDuringEvaluation = true;
+        });
+
         EventManager::subscribe<EventSettingsChanged>(this, [this] {
             {
                 auto syncPatternSource = ContentRegistry::Settings::getSetting("hex.builtin.setting.general", "hex.builtin.setting.general.sync_pattern_source");
@@ -682,12 +810,16 @@ namespace hex::plugin::builtin {
                 std::scoped_lock lock(data.runtimeMutex);
                 auto &runtime = data.runtime;
 
-                auto mimeType = magic::getMIMEType(provider);
+                // Shares the detection result cached when the provider opened
+                auto mimeType = getMagicInfo(provider).first;
 
                 bool foundCorrectType = false;
-                runtime->addPragma("MIME", [&mimeType, &foundCorrectType](pl::PatternLanguage &runtime, const std::string &value) {
+                std::vector<std::string> seenMimeTypes;
+                runtime->addPragma("MIME", [&mimeType, &foundCorrectType, &seenMimeTypes](pl::PatternLanguage &runtime, const std::string &value) {
                     hex::unused(runtime);
 
+                    seenMimeTypes.push_back(value);
+
                     if (value == mimeType) {
                         foundCorrectType = true;
                         return true;
@@ -700,16 +832,39 @@ namespace hex::plugin::builtin {
                 std::error_code errorCode;
                 for (const auto &dir : fs::getDefaultPaths(fs::ImHexPath::Patterns)) {
                     for (auto &entry : std::fs::recursive_directory_iterator(dir, errorCode)) {
-                        foundCorrectType = false;
                         if (!entry.is_regular_file())
                             continue;
 
+                        const auto writeTime = entry.last_write_time(errorCode);
+
+                        // Unchanged files answer from the cached pragma values, so only
+                        // new or modified patterns get read and preprocessed again
+                        {
+                            std::scoped_lock cacheLock(this->m_patternMimeCacheMutex);
+
+                            if (auto cached = this->m_patternMimeCache.find(entry.path()); cached != this->m_patternMimeCache.end() && cached->second.writeTime == writeTime) {
+                                const auto &mimeTypes = cached->second.mimeTypes;
+                                if (std::find(mimeTypes.begin(), mimeTypes.end(), mimeType) != mimeTypes.end())
+                                    this->m_possiblePatternFiles.push_back(entry.path());
+
+                                continue;
+                            }
+                        }
+
                         fs::File file(entry.path(), fs::File::Mode::Read);
                         if (!file.isValid())
                             continue;
 
+                        foundCorrectType = false;
+                        seenMimeTypes.clear();
+
                         runtime->getInternals().preprocessor->preprocess(*runtime, file.readString());
 
+                        {
+                            std::scoped_lock cacheLock(this->m_patternMimeCacheMutex);
+                            this->m_patternMimeCache[entry.path()] = { writeTime, seenMimeTypes };
+                        }
+
                         if (foundCorrectType)
                             this->m_possiblePatternFiles.push_back(entry.path());
 
@@ -892,24 +1047,32 @@ namespace hex::plugin::builtin {
             }
         });
 
-        ImHexApi::HexEditor::addBackgroundHighlightingProvider([this](u64 address, const u8 *data, size_t size, bool) -> std::optional<color_t> {
-            hex::unused(data, size);
-
+        // The highlights get precomputed as sorted colored intervals once per
+        // evaluation, so answering the visible region is a binary search instead of
+        // a pattern lookup per byte per frame
+        ImHexApi::HexEditor::addBackgroundRegionHighlightingProvider([this](const Region &region) -> std::vector<ImHexApi::HexEditor::Highlighting> {
             if (this->m_runningEvaluators != 0)
-                return std::nullopt;
+                return { };
 
-            std::optional<ImColor> color;
-            for (const auto &pattern : ProviderExtraData::getCurrent().patternLanguage.runtime->getPatternsAtAddress(address)) {
-                if (pattern->isHidden())
-                    continue;
+            const auto &patternLanguage = ProviderExtraData::getCurrent().patternLanguage;
+            const auto &highlights      = patternLanguage.highlights;
+            if (highlights.empty() || patternLanguage.maxHighlightSize == 0)
+                return { };
 
-                if (color.has_value())
-                    color = ImAlphaBlendColors(*color, pattern->getColor());
-                else
-                    color = pattern->getColor();
+            // Only intervals starting at most one maximum interval length before the region can overlap it
+            const u64 lowestStart = region.getStartAddress() - std::min<u64>(region.getStartAddress(), patternLanguage.maxHighlightSize - 1);
+
+            auto candidate = std::lower_bound(highlights.begin(), highlights.end(), lowestStart, [](const ImHexApi::HexEditor::Highlighting &highlighting, u64 startAddress) {
+                return highlighting.getRegion().getStartAddress() < startAddress;
+            });
+
+            std::vector<ImHexApi::HexEditor::Highlighting> result;
+            for (; candidate != highlights.end() && candidate->getRegion().getStartAddress() <= region.getEndAddress(); ++candidate) {
+                if (candidate->getRegion().getEndAddress() >= region.getStartAddress())
+                    result.push_back(*candidate);
             }
 
-            return color;
+            return result;
         });
 
         ImHexApi::HexEditor::addTooltipProvider([this](u64 address, const u8 *data, size_t size) {
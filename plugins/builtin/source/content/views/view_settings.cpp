@@ -69,6 +69,7 @@ namespace hex::plugin::builtin {
                                    else
                                        return "";
                                 }());
+                                ContentRegistry::Settings::requestStore();
                                 EventManager::post<EventSettingsChanged>();
 
                                 if (requiresRestart)
@@ -8,12 +8,14 @@
 
 #include <hex/helpers/utils.hpp>
 #include <hex/helpers/crypto.hpp>
+#include <hex/helpers/fmt.hpp>
 #include <hex/helpers/logger.hpp>
 #include <hex/helpers/magic.hpp>
 #include <hex/helpers/file.hpp>
 #include <hex/helpers/fs.hpp>
 #include <hex/helpers/tar.hpp>
 
+#include <algorithm>
 #include <fstream>
 #include <filesystem>
 #include <functional>
@@ -36,13 +38,27 @@ namespace hex::plugin::builtin {
     }
 
     void ViewStore::drawStore() {
+        this->processDownloads();
+
         ImGui::Header("hex.builtin.view.store.desc"_lang, true);
 
         if (ImGui::Button("hex.builtin.view.store.reload"_lang)) {
             this->refresh();
         }
 
-        auto drawTab = [this](auto title, fs::ImHexPath pathType, auto &content, const std::function<void(const StoreEntry &)> &downloadDoneCallback) {
+        if (!this->m_downloads.empty() || !this->m_downloadQueue.empty()) {
+            const auto remaining = this->m_downloads.size() + this->m_downloadQueue.size();
+            const auto finished  = this->m_downloadTotalCount - remaining;
+
+            float progress = float(finished);
+            for (const auto &download : this->m_downloads)
+                progress += download.net.getProgress();
+
+            ImGui::SameLine();
+            ImGui::ProgressBar(progress / float(this->m_downloadTotalCount), ImVec2(-1, 0), hex::format("{0} / {1}", finished, this->m_downloadTotalCount).c_str());
+        }
+
+        auto drawTab = [this](auto title, fs::ImHexPath pathType, auto &content) {
             if (ImGui::BeginTabItem(title)) {
                 if (ImGui::BeginTable("##pattern_language", 3, ImGuiTableFlags_ScrollY | ImGuiTableFlags_Borders | ImGuiTableFlags_SizingStretchSame | ImGuiTableFlags_RowBg)) {
                     ImGui::TableSetupScrollFreeze(0, 1);
@@ -62,32 +78,10 @@ namespace hex::plugin::builtin {
                         ImGui::TableNextColumn();
 
                         ImGui::PushID(id);
-                        ImGui::BeginDisabled(this->m_download.valid() && this->m_download.wait_for(0s) != std::future_status::ready);
                         {
                             if (entry.downloading) {
+                                // Completion is handled centrally in processDownloads()
                                 ImGui::TextSpinner("");
-
-                                if (this->m_download.valid() && this->m_download.wait_for(0s) == std::future_status::ready) {
-                                    entry.downloading = false;
-
-                                    auto response = this->m_download.get();
-                                    if (response.code == 200) {
-                                        entry.installed = true;
-                                        entry.hasUpdate = false;
-
-                                        if (entry.isFolder) {
-                                            Tar tar(this->m_downloadPath, Tar::Mode::Read);
-                                            tar.extractAll(this->m_downloadPath.parent_path() / this->m_downloadPath.stem());
-                                        }
-
-                                        downloadDoneCallback(entry);
-                                    } else
-                                        log::error("Download failed! HTTP Code {}", response.code);
-
-
-                                    this->m_download = {};
-                                }
-
                             } else if (entry.hasUpdate) {
                                 if (ImGui::Button("hex.builtin.view.store.update"_lang)) {
                                     entry.downloading = this->download(pathType, entry.fileName, entry.link, true);
@@ -102,7 +96,6 @@ namespace hex::plugin::builtin {
                                 }
                             }
                         }
-                        ImGui::EndDisabled();
                         ImGui::PopID();
                         id++;
                     }
@@ -114,23 +107,168 @@ namespace hex::plugin::builtin {
         };
 
         if (ImGui::BeginTabBar("storeTabs")) {
-            drawTab("hex.builtin.view.store.tab.patterns"_lang, fs::ImHexPath::Patterns, this->m_patterns, [](auto) {});
-            drawTab("hex.builtin.view.store.tab.libraries"_lang, fs::ImHexPath::PatternsInclude, this->m_includes, [](auto) {});
-            drawTab("hex.builtin.view.store.tab.magics"_lang, fs::ImHexPath::Magic, this->m_magics, [](auto) { magic::compile(); });
-            drawTab("hex.builtin.view.store.tab.constants"_lang, fs::ImHexPath::Constants, this->m_constants, [](auto) {});
-            drawTab("hex.builtin.view.store.tab.encodings"_lang, fs::ImHexPath::Encodings, this->m_encodings, [](auto) {});
-            drawTab("hex.builtin.view.store.tab.yara"_lang, fs::ImHexPath::Yara, this->m_yara, [](auto) {});
+            drawTab("hex.builtin.view.store.tab.patterns"_lang, fs::ImHexPath::Patterns, this->m_patterns);
+            drawTab("hex.builtin.view.store.tab.libraries"_lang, fs::ImHexPath::PatternsInclude, this->m_includes);
+            drawTab("hex.builtin.view.store.tab.magics"_lang, fs::ImHexPath::Magic, this->m_magics);
+            drawTab("hex.builtin.view.store.tab.constants"_lang, fs::ImHexPath::Constants, this->m_constants);
+            drawTab("hex.builtin.view.store.tab.encodings"_lang, fs::ImHexPath::Encodings, this->m_encodings);
+            drawTab("hex.builtin.view.store.tab.yara"_lang, fs::ImHexPath::Yara, this->m_yara);
 
             ImGui::EndTabBar();
         }
     }
 
+    StoreEntry *ViewStore::findEntry(fs::ImHexPath pathType, const std::string &fileName) {
+        std::vector<StoreEntry> *entries = nullptr;
+        switch (pathType) {
+            case fs::ImHexPath::Patterns:        entries = &this->m_patterns;  break;
+            case fs::ImHexPath::PatternsInclude: entries = &this->m_includes;  break;
+            case fs::ImHexPath::Magic:           entries = &this->m_magics;    break;
+            case fs::ImHexPath::Constants:       entries = &this->m_constants; break;
+            case fs::ImHexPath::Yara:            entries = &this->m_yara;      break;
+            case fs::ImHexPath::Encodings:       entries = &this->m_encodings; break;
+            default:                             return nullptr;
+        }
+
+        for (auto &entry : *entries) {
+            if (entry.fileName == fileName)
+                return &entry;
+        }
+
+        return nullptr;
+    }
+
+    void ViewStore::processDownloads() {
+        // Handle finished transfers first so their slots free up right away
+        for (auto it = this->m_downloads.begin(); it != this->m_downloads.end();) {
+            if (it->future.wait_for(0s) != std::future_status::ready) {
+                ++it;
+                continue;
+            }
+
+            auto response = it->future.get();
+            if (auto entry = this->findEntry(it->pathType, it->fileName); entry != nullptr) {
+                entry->downloading = false;
+
+                if (response.code == 200) {
+                    entry->installed = true;
+                    entry->hasUpdate = false;
+
+                    if (entry->isFolder) {
+                        Tar tar(it->path, Tar::Mode::Read);
+                        tar.extractAll(it->path.parent_path() / it->path.stem());
+                    }
+
+                    if (it->pathType == fs::ImHexPath::Magic)
+                        magic::compile();
+                } else {
+                    log::error("Download failed! HTTP Code {}", response.code);
+                }
+            }
+
+            it = this->m_downloads.erase(it);
+        }
+
+        // Start queued transfers while there are free slots
+        const auto maxConcurrent = std::max<i64>(1, ContentRegistry::Settings::read("hex.builtin.setting.general", "hex.builtin.setting.general.concurrent_downloads", 4));
+        while (!this->m_downloadQueue.empty() && this->m_downloads.size() < size_t(maxConcurrent)) {
+            auto queued = std::move(this->m_downloadQueue.front());
+            this->m_downloadQueue.pop_front();
+
+            auto &download    = this->m_downloads.emplace_back();
+            download.pathType = queued.pathType;
+            download.path     = queued.path;
+            download.fileName = queued.fileName;
+            download.future   = download.net.downloadFile(queued.url, queued.path, 30'0000);
+        }
+
+        if (this->m_downloads.empty() && this->m_downloadQueue.empty())
+            this->m_downloadTotalCount = 0;
+    }
+
+    constexpr static auto StoreIndexCacheFile = "store_index.json";
+
     void ViewStore::refresh() {
         // do not refresh if a refresh is already in progress
         if (this->m_requestStatus == RequestStatus::InProgress)
             return;
+
+        // On the first open, bring up the index the previous session cached so
+        // the store is usable immediately; the request below only revalidates it
+        if (this->m_requestStatus == RequestStatus::NotAttempted)
+            this->loadCachedIndex();
+
         this->m_requestStatus = RequestStatus::InProgress;
 
+        this->m_apiRequest = this->m_net.getStringConditional(ImHexApiURL + "/store"s, this->m_indexEtag, this->m_indexLastModified, 30'0000);
+    }
+
+    void ViewStore::loadCachedIndex() {
+        for (const auto &path : fs::getDefaultPaths(fs::ImHexPath::Config)) {
+            auto file = fs::File(path / StoreIndexCacheFile, fs::File::Mode::Read);
+            if (!file.isValid())
+                continue;
+
+            try {
+                auto cache = nlohmann::json::parse(file.readString());
+
+                this->m_indexEtag         = cache.value("etag", "");
+                this->m_indexLastModified = cache.value("last_modified", "");
+                this->parseStoreJson(cache.at("index"));
+                this->m_hasCachedIndex = true;
+            } catch (...) {
+                log::error("Failed to parse cached store index");
+            }
+
+            break;
+        }
+    }
+
+    void ViewStore::storeCachedIndex(const nlohmann::json &index, const std::string &etag, const std::string &lastModified) {
+        nlohmann::json cache = {
+            { "etag",          etag         },
+            { "last_modified", lastModified },
+            { "index",         index        }
+        };
+
+        for (const auto &path : fs::getDefaultPaths(fs::ImHexPath::Config)) {
+            if (auto file = fs::File(path / StoreIndexCacheFile, fs::File::Mode::Create); file.isValid()) {
+                file.write(cache.dump(4));
+                break;
+            }
+        }
+    }
+
+    void ViewStore::parseResponse() {
+        auto response = this->m_apiRequest.get();
+
+        if (response.code == 200) {
+            this->m_requestStatus = RequestStatus::Succeded;
+
+            try {
+                auto json = nlohmann::json::parse(response.body);
+
+                this->parseStoreJson(json);
+                this->storeCachedIndex(json, response.etag, response.lastModified);
+
+                this->m_indexEtag         = response.etag;
+                this->m_indexLastModified = response.lastModified;
+                this->m_hasCachedIndex    = true;
+            } catch (...) {
+                this->m_requestStatus = RequestStatus::Failed;
+            }
+        } else if (response.code == 304) {
+            // Not modified, the cached index parsed in refresh() is still current
+            this->m_requestStatus = RequestStatus::Succeded;
+        } else {
+            // Offline or server error; keep showing the cached index when there is one
+            this->m_requestStatus = this->m_hasCachedIndex ? RequestStatus::Succeded : RequestStatus::Failed;
+        }
+
+        this->m_apiRequest = {};
+    }
+
+    void ViewStore::parseStoreJson(const nlohmann::json &json) {
         this->m_patterns.clear();
         this->m_includes.clear();
         this->m_magics.clear();
@@ -138,70 +276,61 @@ namespace hex::plugin::builtin {
         this->m_yara.clear();
         this->m_encodings.clear();
 
-        this->m_apiRequest = this->m_net.getString(ImHexApiURL + "/store"s, 30'0000);
-    }
-
-    void ViewStore::parseResponse() {
-        auto response = this->m_apiRequest.get();
-        this->m_requestStatus = response.code == 200 ? RequestStatus::Succeded : RequestStatus::Failed;
-        if (this->m_requestStatus == RequestStatus::Succeded) {
-            auto json = nlohmann::json::parse(response.body);
-
-            auto parseStoreEntries = [](auto storeJson, const std::string &name, fs::ImHexPath pathType, std::vector<StoreEntry> &results) {
-                // Check if the response handles the type of files
-                if (storeJson.contains(name)) {
+        auto parseStoreEntries = [](auto storeJson, const std::string &name, fs::ImHexPath pathType, std::vector<StoreEntry> &results) {
+            // Check if the response handles the type of files
+            if (storeJson.contains(name)) {
 
-                    for (auto &entry : storeJson[name]) {
+                for (auto &entry : storeJson[name]) {
 
-                        // Check if entry is valid
-                        if (entry.contains("name") && entry.contains("desc") && entry.contains("file") && entry.contains("url") && entry.contains("hash") && entry.contains("folder")) {
+                    // Check if entry is valid
+                    if (entry.contains("name") && entry.contains("desc") && entry.contains("file") && entry.contains("url") && entry.contains("hash") && entry.contains("folder")) {
 
-                            // Parse entry
-                            StoreEntry storeEntry = { entry["name"], entry["desc"], entry["file"], entry["url"], entry["hash"], entry["folder"], false, false, false };
+                        // Parse entry
+                        StoreEntry storeEntry = { entry["name"], entry["desc"], entry["file"], entry["url"], entry["hash"], entry["folder"], false, false, false };
 
-                            // Check if file is installed already or has an update available
-                            for (const auto &folder : fs::getDefaultPaths(pathType)) {
+                        // Check if file is installed already or has an update available
+                        for (const auto &folder : fs::getDefaultPaths(pathType)) {
 
-                                auto path = folder / std::fs::path(storeEntry.fileName);
+                            auto path = folder / std::fs::path(storeEntry.fileName);
 
-                                if (fs::exists(path) && fs::isPathWritable(folder)) {
-                                    storeEntry.installed = true;
+                            if (fs::exists(path) && fs::isPathWritable(folder)) {
+                                storeEntry.installed = true;
 
-                                    std::ifstream file(path, std::ios::in | std::ios::binary);
-                                    std::vector<u8> data(fs::getFileSize(path), 0x00);
-                                    file.read(reinterpret_cast<char *>(data.data()), data.size());
+                                fs::File file(path, fs::File::Mode::Read);
 
-                                    auto fileHash = crypt::sha256(data);
+                                // Hash a mapped view of the file instead of copying it into memory first
+                                auto fileHash = crypt::sha256(file.map());
 
-                                    // Compare installed file hash with hash of repo file
-                                    if (std::vector(fileHash.begin(), fileHash.end()) != crypt::decode16(storeEntry.hash))
-                                        storeEntry.hasUpdate = true;
-                                }
+                                // Compare installed file hash with hash of repo file
+                                if (std::vector(fileHash.begin(), fileHash.end()) != crypt::decode16(storeEntry.hash))
+                                    storeEntry.hasUpdate = true;
                             }
-
-                            results.push_back(storeEntry);
                         }
+
+                        results.push_back(storeEntry);
                     }
                 }
-            };
-
-            parseStoreEntries(json, "patterns", fs::ImHexPath::Patterns, this->m_patterns);
-            parseStoreEntries(json, "includes", fs::ImHexPath::PatternsInclude, this->m_includes);
-            parseStoreEntries(json, "magic", fs::ImHexPath::Magic, this->m_magics);
-            parseStoreEntries(json, "constants", fs::ImHexPath::Constants, this->m_constants);
-            parseStoreEntries(json, "yara", fs::ImHexPath::Yara, this->m_yara);
-            parseStoreEntries(json, "encodings", fs::ImHexPath::Encodings, this->m_encodings);
-        }
-        this->m_apiRequest = {};
+            }
+        };
+
+        parseStoreEntries(json, "patterns", fs::ImHexPath::Patterns, this->m_patterns);
+        parseStoreEntries(json, "includes", fs::ImHexPath::PatternsInclude, this->m_includes);
+        parseStoreEntries(json, "magic", fs::ImHexPath::Magic, this->m_magics);
+        parseStoreEntries(json, "constants", fs::ImHexPath::Constants, this->m_constants);
+        parseStoreEntries(json, "yara", fs::ImHexPath::Yara, this->m_yara);
+        parseStoreEntries(json, "encodings", fs::ImHexPath::Encodings, this->m_encodings);
     }
 
     void ViewStore::drawContent() {
         if (ImGui::BeginPopupModal(View::toWindowName("hex.builtin.view.store.name").c_str(), &this->getWindowOpenState())) {
             if (this->m_apiRequest.valid()) {
-                if (this->m_apiRequest.wait_for(0s) != std::future_status::ready)
-                    ImGui::TextSpinner("hex.builtin.view.store.loading"_lang);
-                else
+                if (this->m_apiRequest.wait_for(0s) != std::future_status::ready) {
+                    // With a cached index on screen the revalidation happens silently
+                    if (!this->m_hasCachedIndex)
+                        ImGui::TextSpinner("hex.builtin.view.store.loading"_lang);
+                } else {
                     this->parseResponse();
+                }
             }
 
             if (this->m_requestStatus == RequestStatus::Failed)
@@ -224,9 +353,10 @@ namespace hex::plugin::builtin {
             auto fullPath = path / std::fs::path(fileName);
 
             if (!update || fs::exists(fullPath)) {
-                downloading          = true;
-                this->m_downloadPath = fullPath;
-                this->m_download     = this->m_net.downloadFile(url, fullPath, 30'0000);
+                // Only queued here; processDownloads() starts transfers as slots free up
+                downloading = true;
+                this->m_downloadQueue.push_back(QueuedDownload { pathType, fileName, url, fullPath });
+                this->m_downloadTotalCount++;
                 break;
             }
         }
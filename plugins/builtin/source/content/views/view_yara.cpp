@@ -3,18 +3,70 @@
 #include <hex/api/content_registry.hpp>
 
 #include <hex/helpers/utils.hpp>
+#include <hex/helpers/crypto.hpp>
 #include <hex/helpers/file.hpp>
 #include <hex/helpers/fs.hpp>
 
 #include <yara.h>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <filesystem>
+#include <map>
+#include <mutex>
+#include <optional>
 #include <thread>
 
 namespace hex::plugin::builtin {
 
+    constexpr static color_t YaraColor = 0x70B4771F;
+
     ViewYara::ViewYara() : View("hex.builtin.view.yara.name") {
         yr_initialize();
 
+        ImHexApi::HexEditor::addBackgroundRegionHighlightingProvider([this](const Region &region) -> std::vector<ImHexApi::HexEditor::Highlighting> {
+            if (this->m_matcherTask.isRunning() || this->m_matches.empty() || this->m_maxMatchSize == 0)
+                return { };
+
+            // Only matches starting at most one maximum match length before the region can overlap it
+            const u64 lowestStart = region.getStartAddress() - std::min<u64>(region.getStartAddress(), this->m_maxMatchSize - 1);
+
+            auto candidate = std::lower_bound(this->m_matches.begin(), this->m_matches.end(), lowestStart, [](const YaraMatch &match, u64 startAddress) {
+                return match.address < startAddress;
+            });
+
+            std::vector<ImHexApi::HexEditor::Highlighting> result;
+            for (; candidate != this->m_matches.end() && candidate->address <= region.getEndAddress(); ++candidate) {
+                if (!candidate->wholeDataMatch && candidate->address + candidate->size > region.getStartAddress())
+                    result.push_back({ Region { candidate->address, candidate->size }, YaraColor });
+            }
+
+            return result;
+        });
+
+        ImHexApi::HexEditor::addTooltipProvider([this](u64 address, const u8 *data, size_t size) {
+            hex::unused(data, size);
+
+            if (this->m_matcherTask.isRunning())
+                return;
+
+            const auto matches = this->getMatchesAt(address);
+            if (matches.empty())
+                return;
+
+            ImGui::BeginTooltip();
+
+            for (const auto *match : matches) {
+                ImGui::ColorButton("##color", ImColor(YaraColor));
+                ImGui::SameLine(0, 10);
+                ImGui::TextFormatted("{0} [{1}]", this->m_matchStrings[match->identifierIndex], this->m_matchStrings[match->variableIndex]);
+            }
+
+            ImGui::EndTooltip();
+        });
+
         this->reloadRules();
 
         ContentRegistry::FileHandler::add({ ".yar" }, [](const auto &path) {
@@ -60,6 +112,8 @@ namespace hex::plugin::builtin {
                     ImGui::SameLine();
                     if (ImGui::Button("hex.builtin.view.yara.reload"_lang)) this->reloadRules();
                     if (ImGui::Button("hex.builtin.view.yara.match"_lang)) this->applyRules();
+                    ImGui::SameLine();
+                    ImGui::Checkbox("hex.builtin.view.yara.parallel"_lang, &this->m_parallelScan);
                 }
                 ImGui::EndDisabled();
 
@@ -92,7 +146,7 @@ namespace hex::plugin::builtin {
 
                     while (clipper.Step()) {
                         for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
-                            auto &[identifier, variableName, address, size, wholeDataMatch, highlightId, tooltipId] = this->m_matches[i];
+                            auto &[identifierIndex, variableIndex, address, size, wholeDataMatch] = this->m_matches[i];
                             ImGui::TableNextRow();
                             ImGui::TableNextColumn();
                             ImGui::PushID(i);
@@ -101,9 +155,9 @@ namespace hex::plugin::builtin {
                             }
                             ImGui::PopID();
                             ImGui::SameLine();
-                            ImGui::TextUnformatted(identifier.c_str());
+                            ImGui::TextUnformatted(this->m_matchStrings[identifierIndex].c_str());
                             ImGui::TableNextColumn();
-                            ImGui::TextUnformatted(variableName.c_str());
+                            ImGui::TextUnformatted(this->m_matchStrings[variableIndex].c_str());
 
                             if (!wholeDataMatch) {
                                 ImGui::TableNextColumn();
@@ -145,12 +199,9 @@ namespace hex::plugin::builtin {
     }
 
     void ViewYara::clearResult() {
-        for (const auto &match : this->m_matches) {
-            ImHexApi::HexEditor::removeBackgroundHighlight(match.highlightId);
-            ImHexApi::HexEditor::removeTooltip(match.tooltipId);
-        }
-
         this->m_matches.clear();
+        this->m_matchStrings.clear();
+        this->m_maxMatchSize = 0;
         this->m_consoleMessages.clear();
     }
 
@@ -170,178 +221,434 @@ namespace hex::plugin::builtin {
         }
     }
 
-    void ViewYara::applyRules() {
-        this->clearResult();
+    // Compiled rules are cached on disk next to a manifest listing the hash of
+    // every source file that went into them, so repeat scans skip the compiler
+    // entirely as long as the rule file and everything it includes are unchanged
+    static std::optional<std::fs::path> getRuleCacheDirectory() {
+        for (const auto &path : fs::getDefaultPaths(fs::ImHexPath::Config)) {
+            auto cachePath = path / "yara_cache";
 
-        this->m_matcherTask = TaskManager::createTask("hex.builtin.view.yara.matching", 0, [this](auto &task) {
-            if (!ImHexApi::Provider::isValid()) return;
+            if (fs::createDirectories(cachePath) || fs::exists(cachePath))
+                return cachePath;
+        }
 
-            YR_COMPILER *compiler = nullptr;
-            yr_compiler_create(&compiler);
-            ON_SCOPE_EXIT {
-                yr_compiler_destroy(compiler);
-            };
+        return std::nullopt;
+    }
 
-            yr_compiler_set_include_callback(
-                compiler,
-                [](const char *includeName, const char *, const char *, void *userData) -> const char * {
-                    auto currFilePath = static_cast<const char *>(userData);
+    static std::string hashRuleFile(const std::fs::path &path) {
+        fs::File file(path, fs::File::Mode::Read);
+        if (!file.isValid())
+            return { };
 
-                    fs::File file(std::fs::path(currFilePath).parent_path() / includeName, fs::File::Mode::Read);
-                    if (!file.isValid())
-                        return nullptr;
+        return crypt::encode16(crypt::sha256(file.map()));
+    }
+
+    static bool isRuleCacheValid(const std::fs::path &manifestPath, const std::fs::path &compiledRulesPath) {
+        if (!fs::exists(manifestPath) || !fs::exists(compiledRulesPath))
+            return false;
+
+        fs::File manifestFile(manifestPath, fs::File::Mode::Read);
+        if (!manifestFile.isValid())
+            return false;
 
-                    auto size    = file.getSize();
-                    char *buffer = new char[size + 1];
-                    file.readBuffer(reinterpret_cast<u8 *>(buffer), size);
-                    buffer[size] = 0x00;
+        try {
+            auto manifest = nlohmann::json::parse(manifestFile.readString());
 
-                    return buffer;
-                },
-                [](const char *ptr, void *userData) {
-                    hex::unused(userData);
+            for (const auto &[filePath, hash] : manifest["files"].get<std::map<std::string, std::string>>()) {
+                if (hash.empty() || hashRuleFile(std::fs::path(filePath)) != hash)
+                    return false;
+            }
+        } catch (const std::exception &) {
+            return false;
+        }
 
-                    delete[] ptr;
-                },
-                hex::toUTF8String(fs::toShortPath(this->m_rules[this->m_selectedRule].second)).data()
-            );
+        return true;
+    }
 
-            fs::File file(this->m_rules[this->m_selectedRule].second, fs::File::Mode::Read);
-            if (!file.isValid()) return;
+    void ViewYara::applyRules() {
+        this->clearResult();
 
-            if (yr_compiler_add_file(compiler, file.getHandle(), nullptr, nullptr) != 0) {
-                std::string errorMessage(0xFFFF, '\x00');
-                yr_compiler_get_error_message(compiler, errorMessage.data(), errorMessage.size());
-                hex::trim(errorMessage);
+        this->m_matcherTask = TaskManager::createTask("hex.builtin.view.yara.matching", 0, [this](auto &task) {
+            if (!ImHexApi::Provider::isValid()) return;
 
-                TaskManager::doLater([this, errorMessage] {
-                    this->clearResult();
+            const auto rulePath = this->m_rules[this->m_selectedRule].second;
 
-                    this->m_consoleMessages.push_back("Error: " + errorMessage);
-                });
+            std::fs::path compiledRulesPath, manifestPath;
+            if (const auto cacheDirectory = getRuleCacheDirectory(); cacheDirectory.has_value()) {
+                const auto pathString = hex::toUTF8String(rulePath);
+                const auto cacheKey   = crypt::encode16(crypt::sha256(std::span(reinterpret_cast<const u8 *>(pathString.data()), pathString.size())));
 
-                return;
+                compiledRulesPath = *cacheDirectory / (cacheKey + ".yarac");
+                manifestPath      = *cacheDirectory / (cacheKey + ".json");
             }
 
-            YR_RULES *rules;
-            yr_compiler_get_rules(compiler, &rules);
-            ON_SCOPE_EXIT { yr_rules_destroy(rules); };
+            YR_RULES *rules = nullptr;
 
-            YR_MEMORY_BLOCK_ITERATOR iterator;
+            if (!compiledRulesPath.empty() && isRuleCacheValid(manifestPath, compiledRulesPath)) {
+                if (yr_rules_load(hex::toUTF8String(compiledRulesPath).c_str(), &rules) != ERROR_SUCCESS)
+                    rules = nullptr;
+            }
 
-            struct ScanContext {
-                Task *task = nullptr;
-                std::vector<u8> buffer;
-                YR_MEMORY_BLOCK currBlock = {};
-            };
+            if (rules == nullptr) {
+                YR_COMPILER *compiler = nullptr;
+                yr_compiler_create(&compiler);
+                ON_SCOPE_EXIT {
+                    yr_compiler_destroy(compiler);
+                };
 
-            ScanContext context;
-            context.task                 = &task;
-            context.currBlock.base       = 0;
-            context.currBlock.fetch_data = [](auto *block) -> const u8 * {
-                auto &context = *static_cast<ScanContext *>(block->context);
-                auto provider = ImHexApi::Provider::get();
+                // The include callback records every file it resolves, so the
+                // cache manifest covers the whole include graph
+                struct IncludeContext {
+                    std::string rootPath;
+                    std::vector<std::fs::path> includedPaths;
+                };
 
-                context.buffer.resize(context.currBlock.size);
+                IncludeContext includeContext = { hex::toUTF8String(fs::toShortPath(rulePath)), { } };
 
-                if (context.buffer.empty())
-                    return nullptr;
+                yr_compiler_set_include_callback(
+                    compiler,
+                    [](const char *includeName, const char *, const char *, void *userData) -> const char * {
+                        auto &context = *static_cast<IncludeContext *>(userData);
 
-                block->size = context.currBlock.size;
-                provider->read(context.currBlock.base + provider->getBaseAddress(), context.buffer.data(), context.buffer.size());
+                        auto includePath = std::fs::path(context.rootPath).parent_path() / includeName;
 
-                return context.buffer.data();
-            };
-            iterator.file_size = [](auto *iterator) -> u64 {
-                hex::unused(iterator);
+                        fs::File file(includePath, fs::File::Mode::Read);
+                        if (!file.isValid())
+                            return nullptr;
 
-                return ImHexApi::Provider::get()->getActualSize();
-            };
+                        context.includedPaths.push_back(std::move(includePath));
 
-            iterator.context = &context;
-            iterator.first   = [](YR_MEMORY_BLOCK_ITERATOR *iterator) -> YR_MEMORY_BLOCK   *{
-                auto &context = *static_cast<ScanContext *>(iterator->context);
+                        auto size    = file.getSize();
+                        char *buffer = new char[size + 1];
+                        file.readBuffer(reinterpret_cast<u8 *>(buffer), size);
+                        buffer[size] = 0x00;
 
-                context.currBlock.base = 0;
-                context.currBlock.size = 0;
-                context.buffer.clear();
-                iterator->last_error = ERROR_SUCCESS;
+                        return buffer;
+                    },
+                    [](const char *ptr, void *userData) {
+                        hex::unused(userData);
 
-                return iterator->next(iterator);
-            };
-            iterator.next = [](YR_MEMORY_BLOCK_ITERATOR *iterator) -> YR_MEMORY_BLOCK * {
-                auto &context = *static_cast<ScanContext *>(iterator->context);
+                        delete[] ptr;
+                    },
+                    &includeContext
+                );
 
-                u64 address = context.currBlock.base + context.currBlock.size;
+                fs::File file(rulePath, fs::File::Mode::Read);
+                if (!file.isValid()) return;
 
-                iterator->last_error      = ERROR_SUCCESS;
-                context.currBlock.base    = address;
-                context.currBlock.size    = ImHexApi::Provider::get()->getActualSize() - address;
-                context.currBlock.context = &context;
-                context.task->update(address);
+                if (yr_compiler_add_file(compiler, file.getHandle(), nullptr, nullptr) != 0) {
+                    std::string errorMessage(0xFFFF, '\x00');
+                    yr_compiler_get_error_message(compiler, errorMessage.data(), errorMessage.size());
+                    hex::trim(errorMessage);
 
-                if (context.currBlock.size == 0) return nullptr;
+                    TaskManager::doLater([this, errorMessage] {
+                        this->clearResult();
 
-                return &context.currBlock;
-            };
+                        this->m_consoleMessages.push_back("Error: " + errorMessage);
+                    });
+
+                    return;
+                }
+
+                yr_compiler_get_rules(compiler, &rules);
+
+                if (!compiledRulesPath.empty()) {
+                    nlohmann::json manifest;
+
+                    auto &files = manifest["files"];
+                    files[hex::toUTF8String(rulePath)] = hashRuleFile(rulePath);
+                    for (const auto &includedPath : includeContext.includedPaths)
+                        files[hex::toUTF8String(includedPath)] = hashRuleFile(includedPath);
+
+                    // The compiled form is written first; a manifest without it is
+                    // simply treated as a cache miss
+                    if (yr_rules_save(rules, hex::toUTF8String(compiledRulesPath).c_str()) == ERROR_SUCCESS) {
+                        fs::File manifestFile(manifestPath, fs::File::Mode::Create);
+                        if (manifestFile.isValid())
+                            manifestFile.write(manifest.dump(4));
+                    }
+                }
+            }
 
+            ON_SCOPE_EXIT { yr_rules_destroy(rules); };
 
             struct ResultContext {
                 std::vector<YaraMatch> newMatches;
                 std::vector<std::string> consoleMessages;
+
+                std::vector<std::string> stringPool;
+                std::map<std::string, u32> stringPoolIndices;
+
+                u32 internString(const char *string) {
+                    const auto [entry, inserted] = this->stringPoolIndices.try_emplace(string, u32(this->stringPool.size()));
+                    if (inserted)
+                        this->stringPool.emplace_back(string);
+
+                    return entry->second;
+                }
             };
 
             ResultContext resultContext;
 
-            yr_rules_scan_mem_blocks(
-                    rules, &iterator, 0, [](YR_SCAN_CONTEXT *context, int message, void *data, void *userData) -> int {
-                        auto &results = *static_cast<ResultContext *>(userData);
+            constexpr static auto ScanCallback = [](YR_SCAN_CONTEXT *context, int message, void *data, void *userData) -> int {
+                auto &results = *static_cast<ResultContext *>(userData);
 
-                        switch (message) {
-                            case CALLBACK_MSG_RULE_MATCHING:
-                            {
-                                auto rule = static_cast<YR_RULE *>(data);
+                switch (message) {
+                    case CALLBACK_MSG_RULE_MATCHING:
+                    {
+                        auto rule = static_cast<YR_RULE *>(data);
 
-                                YR_STRING *string;
-                                YR_MATCH *match;
+                        YR_STRING *string;
+                        YR_MATCH *match;
 
-                                if (rule->strings != nullptr) {
-                                    yr_rule_strings_foreach(rule, string) {
-                                        yr_string_matches_foreach(context, string, match) {
-                                                results.newMatches.push_back({ rule->identifier, string->identifier, u64(match->offset), size_t(match->match_length), false, 0, 0 });
-                                            }
+                        if (rule->strings != nullptr) {
+                            yr_rule_strings_foreach(rule, string) {
+                                yr_string_matches_foreach(context, string, match) {
+                                        results.newMatches.push_back({ results.internString(rule->identifier), results.internString(string->identifier), u64(match->offset), size_t(match->match_length), false });
                                     }
-                                } else {
-                                    results.newMatches.push_back({ rule->identifier, "", 0, 0, true, 0, 0 });
-                                }
                             }
-                                break;
-                            case CALLBACK_MSG_CONSOLE_LOG:
+                        } else {
+                            results.newMatches.push_back({ results.internString(rule->identifier), results.internString(""), 0, 0, true });
+                        }
+                    }
+                        break;
+                    case CALLBACK_MSG_CONSOLE_LOG:
+                    {
+                        results.consoleMessages.emplace_back(static_cast<const char *>(data));
+                    }
+                        break;
+                    default:
+                        break;
+                }
+
+                return CALLBACK_CONTINUE;
+            };
+
+            if (this->m_parallelScan) {
+                // Region partitioned parallel scan: the provider is cut into one
+                // region per core and every worker runs its own scanner instance
+                // over its regions against the shared compiled rules. Each region
+                // is scanned a bit past its end, so a match spanning a cut is
+                // still seen by the region that owns its start; matches longer
+                // than the overlap can be missed in this mode
+                constexpr static u64 RegionOverlap = 0x10'0000;
+                constexpr static u64 MinRegionSize = 0x400'0000;
+
+                const auto providerSize = ImHexApi::Provider::get()->getActualSize();
+                const auto baseAddress  = ImHexApi::Provider::get()->getBaseAddress();
+
+                const auto regionCount = std::max<u64>(1, std::min<u64>(std::thread::hardware_concurrency(), (providerSize + MinRegionSize - 1) / MinRegionSize));
+                const auto regionSize  = (providerSize + regionCount - 1) / regionCount;
+
+                task.setMaxValue(providerSize);
+
+                std::mutex resultMutex;
+                std::atomic<u64> nextRegion    = 0;
+                std::atomic<u64> processedSize = 0;
+                std::atomic<u32> activeWorkers = u32(regionCount);
+                std::atomic<bool> stopped      = false;
+
+                std::vector<std::jthread> workers;
+                for (u64 worker = 0; worker < regionCount; worker++) {
+                    workers.emplace_back([&] {
+                        ON_SCOPE_EXIT { activeWorkers -= 1; };
+
+                        const auto readRegion = [&](u64 region, std::vector<u8> &buffer) {
+                            const u64 start   = region * regionSize;
+                            const u64 scanEnd = std::min(providerSize, std::min(providerSize, start + regionSize) + RegionOverlap);
+
+                            buffer.resize(scanEnd - start);
+                            ImHexApi::Provider::get()->read(start + baseAddress, buffer.data(), buffer.size());
+                        };
+
+                        u64 region = nextRegion.fetch_add(1);
+                        if (region >= regionCount)
+                            return;
+
+                        std::vector<u8> buffer;
+                        readRegion(region, buffer);
+
+                        while (region < regionCount && !stopped) {
+                            // Double buffering: while this region is being scanned
+                            // the worker's next one is already being read, so on
+                            // cold files scan compute and provider I/O overlap
+                            // instead of taking turns
+                            const u64 followingRegion = nextRegion.fetch_add(1);
+
+                            std::vector<u8> followingBuffer;
+                            std::jthread prefetcher;
+                            if (followingRegion < regionCount)
+                                prefetcher = std::jthread([&] { readRegion(followingRegion, followingBuffer); });
+
+                            const u64 start  = region * regionSize;
+                            const u64 ownEnd = std::min(providerSize, start + regionSize);
+
+                            YR_SCANNER *scanner = nullptr;
+                            if (yr_scanner_create(rules, &scanner) != ERROR_SUCCESS) {
+                                stopped = true;
+                                return;
+                            }
+                            ON_SCOPE_EXIT { yr_scanner_destroy(scanner); };
+
+                            ResultContext regionResults;
+                            yr_scanner_set_callback(scanner, ScanCallback, &regionResults);
+
+                            const auto error = yr_scanner_scan_mem(scanner, buffer.data(), buffer.size());
+
                             {
-                                results.consoleMessages.emplace_back(static_cast<const char *>(data));
+                                std::scoped_lock lock(resultMutex);
+
+                                if (error != ERROR_SUCCESS) {
+                                    resultContext.consoleMessages.push_back(hex::format("Error: Scanning region 0x{0:X} - 0x{1:X} failed ({2})", start, start + buffer.size(), error));
+                                } else {
+                                    for (auto &match : regionResults.newMatches) {
+                                        // Every region interned into its own pool; rebase the
+                                        // indices into the shared one
+                                        match.identifierIndex = resultContext.internString(regionResults.stringPool[match.identifierIndex].c_str());
+                                        match.variableIndex   = resultContext.internString(regionResults.stringPool[match.variableIndex].c_str());
+
+                                        if (match.wholeDataMatch) {
+                                            // A rule without strings fires in every region;
+                                            // it's reported only once
+                                            if (region != 0)
+                                                continue;
+                                        } else {
+                                            match.address += start;
+
+                                            // Matches starting in the overlap tail belong
+                                            // to the next region
+                                            if (match.address >= ownEnd)
+                                                continue;
+                                        }
+
+                                        resultContext.newMatches.push_back(std::move(match));
+                                    }
+
+                                    std::move(regionResults.consoleMessages.begin(), regionResults.consoleMessages.end(), std::back_inserter(resultContext.consoleMessages));
+
+                                    processedSize += ownEnd - start;
+                                }
                             }
-                                break;
-                            default:
-                                break;
+
+                            if (prefetcher.joinable())
+                                prefetcher.join();
+
+                            region = followingRegion;
+                            buffer = std::move(followingBuffer);
                         }
+                    });
+                }
 
-                        return CALLBACK_CONTINUE;
-                    },
-                    &resultContext,
-                    0);
+                // Progress and cancellation are handled here; when the scan is
+                // cancelled every worker finishes its current region and winds down
+                try {
+                    while (activeWorkers > 0) {
+                        task.update(processedSize);
+                        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                    }
+                } catch (...) {
+                    stopped = true;
+                    throw;
+                }
+            } else {
+                YR_MEMORY_BLOCK_ITERATOR iterator;
+
+                struct ScanContext {
+                    Task *task = nullptr;
+                    std::vector<u8> buffer;
+                    YR_MEMORY_BLOCK currBlock = {};
+                };
+
+                ScanContext context;
+                context.task                 = &task;
+                context.currBlock.base       = 0;
+                context.currBlock.fetch_data = [](auto *block) -> const u8 * {
+                    auto &context = *static_cast<ScanContext *>(block->context);
+                    auto provider = ImHexApi::Provider::get();
+
+                    context.buffer.resize(context.currBlock.size);
+
+                    if (context.buffer.empty())
+                        return nullptr;
+
+                    block->size = context.currBlock.size;
+                    provider->read(context.currBlock.base + provider->getBaseAddress(), context.buffer.data(), context.buffer.size());
+
+                    return context.buffer.data();
+                };
+                iterator.file_size = [](auto *iterator) -> u64 {
+                    hex::unused(iterator);
+
+                    return ImHexApi::Provider::get()->getActualSize();
+                };
+
+                iterator.context = &context;
+                iterator.first   = [](YR_MEMORY_BLOCK_ITERATOR *iterator) -> YR_MEMORY_BLOCK   *{
+                    auto &context = *static_cast<ScanContext *>(iterator->context);
+
+                    context.currBlock.base = 0;
+                    context.currBlock.size = 0;
+                    context.buffer.clear();
+                    iterator->last_error = ERROR_SUCCESS;
+
+                    return iterator->next(iterator);
+                };
+                iterator.next = [](YR_MEMORY_BLOCK_ITERATOR *iterator) -> YR_MEMORY_BLOCK * {
+                    auto &context = *static_cast<ScanContext *>(iterator->context);
+
+                    u64 address = context.currBlock.base + context.currBlock.size;
+
+                    iterator->last_error      = ERROR_SUCCESS;
+                    context.currBlock.base    = address;
+                    context.currBlock.size    = ImHexApi::Provider::get()->getActualSize() - address;
+                    context.currBlock.context = &context;
+                    context.task->update(address);
+
+                    if (context.currBlock.size == 0) return nullptr;
+
+                    return &context.currBlock;
+                };
+
+                yr_rules_scan_mem_blocks(rules, &iterator, 0, ScanCallback, &resultContext, 0);
+            }
 
 
             TaskManager::doLater([this, resultContext] {
                 this->m_matches         = resultContext.newMatches;
                 this->m_consoleMessages = resultContext.consoleMessages;
+                this->m_matchStrings    = resultContext.stringPool;
 
-                constexpr static color_t YaraColor = 0x70B4771F;
-                for (auto &match : this->m_matches) {
-                    match.highlightId = ImHexApi::HexEditor::addBackgroundHighlight({ match.address, match.size }, YaraColor);
-                    match.tooltipId = ImHexApi::HexEditor::addTooltip({ match. address, match.size }, hex::format("{0} [{1}]", match.identifier, match.variable), YaraColor);
-                }
+                // Keeping the match list sorted by start address makes the highlight
+                // and tooltip lookups from the hex editor a binary search
+                std::sort(this->m_matches.begin(), this->m_matches.end(), [](const auto &left, const auto &right) {
+                    return left.address < right.address;
+                });
+
+                this->m_maxMatchSize = 0;
+                for (const auto &match : this->m_matches)
+                    this->m_maxMatchSize = std::max(this->m_maxMatchSize, match.size);
             });
         });
     }
 
+    std::vector<const ViewYara::YaraMatch *> ViewYara::getMatchesAt(u64 address) const {
+        if (this->m_matches.empty() || this->m_maxMatchSize == 0)
+            return { };
+
+        // Only matches starting at most one maximum match length before the address can overlap it
+        const u64 lowestStart = address - std::min<u64>(address, this->m_maxMatchSize - 1);
+
+        auto candidate = std::lower_bound(this->m_matches.begin(), this->m_matches.end(), lowestStart, [](const YaraMatch &match, u64 startAddress) {
+            return match.address < startAddress;
+        });
+
+        std::vector<const YaraMatch *> result;
+        for (; candidate != this->m_matches.end() && candidate->address <= address; ++candidate) {
+            if (!candidate->wholeDataMatch && candidate->address + candidate->size > address)
+                result.push_back(&*candidate);
+        }
+
+        return result;
+    }
+
 }
\ No newline at end of file
@@ -19,6 +19,10 @@
 
 #include <fonts/codicons_font.h>
 
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <list>
 #include <unordered_set>
@@ -54,8 +58,26 @@ namespace hex::plugin::builtin {
     };
 
     static std::atomic<bool> s_recentProvidersUpdating = false;
+    static std::mutex s_recentProvidersMutex;
     static std::list<RecentProvider> s_recentProviders;
 
+    // A recent entry sitting on a disconnected network share can block a stat call
+    // for multiple seconds, so every filesystem access gets this deadline and
+    // entries that don't answer in time are skipped instead of stalling the scan
+    constexpr static auto RecentProviderStatTimeout = std::chrono::milliseconds(250);
+
+    static std::optional<std::fs::file_time_type> statRecentProviderFile(const std::fs::path &path) {
+        auto future = std::async(std::launch::async, [path] {
+            std::error_code error;
+            return std::fs::last_write_time(path, error);
+        });
+
+        if (future.wait_for(RecentProviderStatTimeout) != std::future_status::ready)
+            return std::nullopt;
+
+        return future.get();
+    }
+
     static void updateRecentProviders() {
         TaskManager::createBackgroundTask("Updating recent files", [](auto&){
             if (s_recentProvidersUpdating)
@@ -64,37 +86,49 @@ namespace hex::plugin::builtin {
             s_recentProvidersUpdating = true;
             ON_SCOPE_EXIT { s_recentProvidersUpdating = false; };
 
-            s_recentProviders.clear();
+            {
+                std::scoped_lock lock(s_recentProvidersMutex);
+                s_recentProviders.clear();
+            }
 
-            // Query all recent providers
-            std::vector<std::fs::path> recentFilePaths;
+            // Query all recent providers, remembering each file's last modified
+            // time so sorting doesn't have to stat the same file over and over
+            std::vector<std::pair<std::fs::path, std::fs::file_time_type>> recentFilePaths;
             for (const auto &folder : fs::getDefaultPaths(fs::ImHexPath::Recent)) {
                 for (const auto &entry : std::fs::directory_iterator(folder)) {
-                    if (entry.is_regular_file())
-                        recentFilePaths.push_back(entry.path());
+                    if (!entry.is_regular_file())
+                        continue;
+
+                    if (auto writeTime = statRecentProviderFile(entry.path()); writeTime.has_value())
+                        recentFilePaths.emplace_back(entry.path(), writeTime.value());
                 }
             }
 
             // Sort recent provider files by last modified time
             std::sort(recentFilePaths.begin(), recentFilePaths.end(), [](const auto &a, const auto &b) {
-                return std::fs::last_write_time(a) > std::fs::last_write_time(b);
+                return a.second > b.second;
             });
 
+            // Append entries one by one so the welcome screen can draw
+            // whatever has been found so far while the scan is still running
             std::unordered_set<RecentProvider, RecentProvider::HashFunction> uniqueProviders;
             for (u32 i = 0; i < recentFilePaths.size() && uniqueProviders.size() < 5; i++) {
-                auto &path = recentFilePaths[i];
+                auto &path = recentFilePaths[i].first;
                 try {
                     auto jsonData = nlohmann::json::parse(fs::File(path, fs::File::Mode::Read).readString());
-                    uniqueProviders.insert(RecentProvider {
+                    auto [iter, inserted] = uniqueProviders.insert(RecentProvider {
                         .displayName    = jsonData["displayName"],
                         .type           = jsonData["type"],
                         .filePath       = path,
                         .data           = jsonData
                     });
+
+                    if (inserted) {
+                        std::scoped_lock lock(s_recentProvidersMutex);
+                        s_recentProviders.push_back(*iter);
+                    }
                 } catch (...) { }
             }
-
-            std::copy(uniqueProviders.begin(), uniqueProviders.end(), std::front_inserter(s_recentProviders));
         });
     }
 
@@ -242,15 +276,15 @@ namespace hex::plugin::builtin {
             ImGui::UnderlinedText("hex.builtin.welcome.start.recent"_lang);
             ImGui::SetCursorPosY(ImGui::GetCursorPosY() + 5_scaled);
             {
-                if (!s_recentProvidersUpdating) {
-                    for (const auto &recentProvider : s_recentProviders) {
-                        ImGui::PushID(&recentProvider);
-                        ON_SCOPE_EXIT { ImGui::PopID(); };
-
-                        if (ImGui::BulletHyperlink(recentProvider.displayName.c_str())) {
-                            loadRecentProvider(recentProvider);
-                            break;
-                        }
+                // Draw whatever the background scan has found so far
+                std::scoped_lock lock(s_recentProvidersMutex);
+                for (const auto &recentProvider : s_recentProviders) {
+                    ImGui::PushID(&recentProvider);
+                    ON_SCOPE_EXIT { ImGui::PopID(); };
+
+                    if (ImGui::BulletHyperlink(recentProvider.displayName.c_str())) {
+                        loadRecentProvider(recentProvider);
+                        break;
                     }
                 }
             }
@@ -518,9 +552,13 @@ namespace hex::plugin::builtin {
         });
 
         ContentRegistry::Interface::addMenuItem("hex.builtin.menu.file", 1075, [&] {
-            if (ImGui::BeginMenu("hex.builtin.menu.file.open_recent"_lang, !s_recentProvidersUpdating && !s_recentProviders.empty())) {
-                // Copy to avoid changing list while iteration
-                auto recentProviders = s_recentProviders;
+            // Copy to avoid changing list while iteration
+            auto recentProviders = [] {
+                std::scoped_lock lock(s_recentProvidersMutex);
+                return s_recentProviders;
+            }();
+
+            if (ImGui::BeginMenu("hex.builtin.menu.file.open_recent"_lang, !recentProviders.empty())) {
                 for (auto &recentProvider : recentProviders) {
                     if (ImGui::MenuItem(recentProvider.displayName.c_str())) {
                         loadRecentProvider(recentProvider);
@@ -529,7 +567,10 @@ namespace hex::plugin::builtin {
 
                 ImGui::Separator();
                 if (ImGui::MenuItem("hex.builtin.menu.file.clear_recent"_lang)) {
-                    s_recentProviders.clear();
+                    {
+                        std::scoped_lock lock(s_recentProvidersMutex);
+                        s_recentProviders.clear();
+                    }
 
                     // Remove all recent files
                     for (const auto &recentPath : fs::getDefaultPaths(fs::ImHexPath::Recent))
@@ -550,21 +591,23 @@ namespace hex::plugin::builtin {
             }
         }
 
-        auto tipsData = romfs::get("tips.json");
-        if(tipsData.valid()){
-            auto tipsCategories = nlohmann::json::parse(tipsData.string());
+        // With tips disabled the whole tips resource stays untouched
+        bool showTipOfTheDay = ContentRegistry::Settings::read("hex.builtin.setting.general", "hex.builtin.setting.general.show_tips", 1);
+        if (showTipOfTheDay) {
+            auto tipsData = romfs::get("tips.json");
+            if(tipsData.valid()){
+                auto tipsCategories = nlohmann::json::parse(tipsData.string());
 
-            auto now = std::chrono::system_clock::now();
-            auto days_since_epoch = std::chrono::duration_cast<std::chrono::days>(now.time_since_epoch());
-            std::mt19937 random(days_since_epoch.count());
+                auto now = std::chrono::system_clock::now();
+                auto days_since_epoch = std::chrono::duration_cast<std::chrono::days>(now.time_since_epoch());
+                std::mt19937 random(days_since_epoch.count());
 
-            auto chosenCategory = tipsCategories[random()%tipsCategories.size()]["tips"];
-            auto chosenTip = chosenCategory[random()%chosenCategory.size()];
-            s_tipOfTheDay = chosenTip.get<std::string>();
+                auto chosenCategory = tipsCategories[random()%tipsCategories.size()]["tips"];
+                auto chosenTip = chosenCategory[random()%chosenCategory.size()];
+                s_tipOfTheDay = chosenTip.get<std::string>();
 
-            bool showTipOfTheDay = ContentRegistry::Settings::read("hex.builtin.setting.general", "hex.builtin.setting.general.show_tips", 1);
-            if (showTipOfTheDay)
                 TaskManager::doLater([] { ImGui::OpenPopup("hex.builtin.welcome.tip_of_the_day"_lang); });
+            }
         }
     }
 
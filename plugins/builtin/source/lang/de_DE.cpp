@@ -6,7 +6,8 @@ namespace hex::plugin::builtin {
     void registerLanguageDeDE() {
         ContentRegistry::Language::registerLanguage("German", "de-DE");
 
-        ContentRegistry::Language::addLocalizations("de-DE", {
+        ContentRegistry::Language::addLocalizations("de-DE", [] {
+            return LanguageDefinition {
                 { "hex.builtin.welcome.header.main", "Wilkommen zu ImHex" },
                 { "hex.builtin.welcome.header.start", "Start" },
                     { "hex.builtin.welcome.start.create_file", "Neue Datei Erstellen" },
@@ -289,7 +290,6 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.view.help.calc_cheat_sheet", "Rechner Cheat Sheet" },
 
                 { "hex.builtin.view.hex_editor.name", "Hex editor" },
-                    { "hex.builtin.view.hex_editor.page", "Seite" },
                     { "hex.builtin.view.hex_editor.selection", "Auswahl" },
                         { "hex.builtin.view.hex_editor.selection.none", "Keine" },
                     { "hex.builtin.view.hex_editor.region", "Region" },
@@ -882,6 +882,7 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.hash.crc.xor_out", "XOR Out" },
                     { "hex.builtin.hash.crc.refl_in", "Reflect In" },
                     { "hex.builtin.hash.crc.refl_out", "Reflect Out" },
+            };
         });
     }
 
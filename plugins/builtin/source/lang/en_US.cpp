@@ -7,7 +7,8 @@ namespace hex::plugin::builtin {
         ContentRegistry::Language::registerLanguage("English (US)", "en-US");
         LangEntry::setFallbackLanguage("en-US");
 
-        ContentRegistry::Language::addLocalizations("en-US", {
+        ContentRegistry::Language::addLocalizations("en-US", [] {
+            return LanguageDefinition {
                 { "hex.builtin.welcome.header.main", "Welcome to ImHex" },
                 { "hex.builtin.welcome.header.start", "Start" },
                     { "hex.builtin.welcome.start.create_file", "Create New File" },
@@ -82,6 +83,8 @@ namespace hex::plugin::builtin {
                 { "hex.builtin.common.browse", "Browse..." },
                 { "hex.builtin.common.choose_file", "Choose file" },
                 { "hex.builtin.common.processing", "Processing" },
+                { "hex.builtin.task.magic_detection", "Detecting content type" },
+                { "hex.builtin.common.task.eta", "ETA" },
                 { "hex.builtin.common.filter", "Filter" },
                 { "hex.builtin.common.count", "Count" },
                 { "hex.builtin.common.value", "Value" },
@@ -200,6 +203,13 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.view.data_processor.menu.remove_link", "Remove Link" },
                     { "hex.builtin.view.data_processor.menu.file.load_processor", "Load data processor..." },
                     { "hex.builtin.view.data_processor.menu.file.save_processor", "Save data processor..." },
+                    { "hex.builtin.view.data_processor.evaluating", "Evaluating data processor..." },
+                    { "hex.builtin.view.data_processor.profiler", "Node Profiler" },
+                    { "hex.builtin.view.data_processor.profiler.node", "Node" },
+                    { "hex.builtin.view.data_processor.profiler.time", "Time" },
+                    { "hex.builtin.view.data_processor.profiler.bytes", "Processed data" },
+                    { "hex.builtin.view.data_processor.profiler.throughput", "Throughput" },
+                    { "hex.builtin.view.data_processor.profiler.total", "Total" },
 
                 { "hex.builtin.view.disassembler.name", "Disassembler" },
                     { "hex.builtin.view.disassembler.position", "Position" },
@@ -264,6 +274,13 @@ namespace hex::plugin::builtin {
 
                     { "hex.builtin.view.disassembler.disassemble", "Disassemble" },
                     { "hex.builtin.view.disassembler.disassembling", "Disassembling..." },
+                    { "hex.builtin.view.disassembler.windowed", "Windowed mode" },
+                    { "hex.builtin.view.disassembler.export", "Export" },
+                    { "hex.builtin.view.disassembler.exporting", "Exporting disassembly..." },
+                    { "hex.builtin.view.disassembler.search", "Search" },
+                    { "hex.builtin.view.disassembler.search.mnemonic", "Mnemonic" },
+                    { "hex.builtin.view.disassembler.search.value", "Operand value" },
+                    { "hex.builtin.view.disassembler.search.results", "{0} / {1}" },
                     { "hex.builtin.view.disassembler.disassembly.title", "Disassembly" },
                         { "hex.builtin.view.disassembler.disassembly.address", "Address" },
                         { "hex.builtin.view.disassembler.disassembly.offset", "Offset" },
@@ -277,6 +294,7 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.view.hashes.table.type", "Type" },
                     { "hex.builtin.view.hashes.table.result", "Result" },
                     { "hex.builtin.view.hashes.remove", "Remove hash" },
+                    { "hex.builtin.view.hashes.file_hashes", "File Hashes" },
                     { "hex.builtin.view.hashes.hover_info", "Hover over the Hex Editor selection and hold down SHIFT to view the hashes of that region." },
 
                 { "hex.builtin.view.help.name", "Help" },
@@ -294,12 +312,12 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.view.help.calc_cheat_sheet", "Calculator Cheat Sheet" },
 
                 { "hex.builtin.view.hex_editor.name", "Hex editor" },
-                    { "hex.builtin.view.hex_editor.page", "Page" },
                     { "hex.builtin.view.hex_editor.selection", "Selection" },
                         { "hex.builtin.view.hex_editor.selection.none", "None" },
                     { "hex.builtin.view.hex_editor.region", "Region" },
                     { "hex.builtin.view.hex_editor.data_size", "Data Size" },
                     { "hex.builtin.view.hex_editor.no_bytes", "No bytes available" },
+                    { "hex.builtin.view.hex_editor.minimap", "Updating minimap" },
 
                     { "hex.builtin.view.hex_editor.menu.file.load_encoding_file", "Load custom encoding..." },
                     { "hex.builtin.view.hex_editor.menu.file.search", "Search" },
@@ -321,6 +339,8 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.view.hex_editor.menu.file.save_as", "Save As..." },
                     { "hex.builtin.view.hex_editor.menu.edit.copy", "Copy" },
                     { "hex.builtin.view.hex_editor.menu.edit.copy_as", "Copy as..." },
+                    { "hex.builtin.view.hex_editor.menu.edit.export_as", "Export as..." },
+                    { "hex.builtin.view.hex_editor.exporting", "Exporting data..." },
                         { "hex.builtin.view.hex_editor.copy.hex", "Hex String" },
                         { "hex.builtin.view.hex_editor.copy.address", "Address" },
                         { "hex.builtin.view.hex_editor.copy.c", "C Array" },
@@ -345,7 +365,16 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.view.hex_editor.menu.edit.resize", "Resize..." },
                     { "hex.builtin.view.hex_editor.menu.edit.insert", "Insert..." },
                     { "hex.builtin.view.hex_editor.menu.edit.remove", "Remove..." },
+                    { "hex.builtin.view.hex_editor.menu.edit.fill", "Fill..." },
+                        { "hex.builtin.view.hex_editor.fill.pattern", "Pattern" },
                     { "hex.builtin.view.hex_editor.menu.edit.jump_to", "Jump to" },
+                    { "hex.builtin.view.hex_editor.stats", "Statistics" },
+                        { "hex.builtin.view.hex_editor.stats.sum", "Sum" },
+                        { "hex.builtin.view.hex_editor.stats.mean", "Mean" },
+                        { "hex.builtin.view.hex_editor.stats.min", "Min" },
+                        { "hex.builtin.view.hex_editor.stats.max", "Max" },
+                        { "hex.builtin.view.hex_editor.stats.popcount", "Set bits" },
+                        { "hex.builtin.view.hex_editor.stats.counting", "Calculating statistics..." },
 
                 { "hex.builtin.view.information.name", "Data Information" },
                     { "hex.builtin.view.information.control", "Control" },
@@ -353,6 +382,7 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.view.information.analyzing", "Analyzing..." },
                     { "hex.builtin.view.information.region", "Analyzed region" },
                     { "hex.builtin.view.information.magic", "Magic information" },
+                    { "hex.builtin.view.information.file_hashes", "File hashes" },
                     { "hex.builtin.view.information.description", "Description:" },
                     { "hex.builtin.view.information.mime", "MIME Type:" },
                     { "hex.builtin.view.information.info_analysis", "Information analysis" },
@@ -363,8 +393,38 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.view.information.file_entropy", "File entropy" },
                     { "hex.builtin.view.information.highest_entropy", "Highest entropy block" },
                     { "hex.builtin.view.information.encrypted", "This data is most likely encrypted or compressed!" },
+                    { "hex.builtin.view.information.metrics", "Data metrics" },
+                    { "hex.builtin.view.information.region_map", "Region map" },
+                    { "hex.builtin.view.information.region_map.padding", "Padding" },
+                    { "hex.builtin.view.information.region_map.text", "Text" },
+                    { "hex.builtin.view.information.region_map.code", "Code" },
+                    { "hex.builtin.view.information.region_map.high_entropy", "High entropy" },
+                    { "hex.builtin.view.information.region_map.unknown", "Unknown" },
                     { "hex.builtin.view.information.magic_db_added", "Magic database added!" },
 
+                { "hex.builtin.view.carver.name", "File Carver" },
+                    { "hex.builtin.view.carver.carve", "Carve" },
+                    { "hex.builtin.view.carver.carving", "Carving" },
+                    { "hex.builtin.view.carver.results", "Carved files" },
+                    { "hex.builtin.view.carver.results.type", "Type" },
+                    { "hex.builtin.view.carver.results.description", "Description" },
+                    { "hex.builtin.view.carver.bookmark", "Add bookmark" },
+                    { "hex.builtin.view.carver.export", "Export file" },
+                    { "hex.builtin.view.carver.type.jpeg", "JPEG image" },
+                    { "hex.builtin.view.carver.type.png", "PNG image" },
+                    { "hex.builtin.view.carver.type.gif", "GIF image" },
+                    { "hex.builtin.view.carver.type.pdf", "PDF document" },
+                    { "hex.builtin.view.carver.type.zip", "ZIP archive" },
+                    { "hex.builtin.view.carver.type.sqlite", "SQLite database" },
+                    { "hex.builtin.view.carver.type.bmp", "Bitmap image" },
+
+                { "hex.builtin.view.data_visualizer.name", "Data Visualizer" },
+                    { "hex.builtin.view.data_visualizer.visualize", "Visualize" },
+                    { "hex.builtin.view.data_visualizer.visualizing", "Visualizing" },
+                    { "hex.builtin.view.data_visualizer.mode", "Mode" },
+                    { "hex.builtin.view.data_visualizer.mode.digram", "Digram" },
+                    { "hex.builtin.view.data_visualizer.mode.byte_map", "Byte map (Hilbert curve)" },
+
                 { "hex.builtin.view.patches.name", "Patches" },
                     { "hex.builtin.view.patches.offset", "Offset" },
                     { "hex.builtin.view.patches.orig", "Original value" },
@@ -387,6 +447,7 @@ namespace hex::plugin::builtin {
                 { "hex.builtin.view.pattern_editor.evaluating", "Evaluating..." },
                 { "hex.builtin.view.pattern_editor.auto", "Auto evaluate" },
                 { "hex.builtin.view.pattern_editor.console", "Console" },
+                { "hex.builtin.view.pattern_editor.console.dropped", "({0} earlier lines discarded)" },
                 { "hex.builtin.view.pattern_editor.env_vars", "Environment Variables" },
                 { "hex.builtin.view.pattern_editor.settings", "Settings" },
                 { "hex.builtin.view.pattern_editor.dangerous_function.name", "Allow dangerous function?" },
@@ -400,6 +461,9 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.view.pattern_data.size", "Size" },
                     { "hex.builtin.view.pattern_data.type", "Type" },
                     { "hex.builtin.view.pattern_data.value", "Value" },
+                    { "hex.builtin.view.pattern_data.export.json", "Export JSON" },
+                    { "hex.builtin.view.pattern_data.export.csv", "Export CSV" },
+                    { "hex.builtin.view.pattern_data.exporting", "Exporting pattern data" },
 
                 { "hex.builtin.view.settings.name", "Settings" },
                     { "hex.builtin.view.settings.restart_question", "A change you made requires a restart of ImHex to take effect. Would you like to restart it now?" },
@@ -410,6 +474,7 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.view.yara.header.rules", "Rules" },
                         { "hex.builtin.view.yara.reload", "Reload" },
                         { "hex.builtin.view.yara.match", "Match Rules" },
+                        { "hex.builtin.view.yara.parallel", "Parallel scan" },
                         { "hex.builtin.view.yara.matching", "Matching..." },
                         { "hex.builtin.view.yara.error", "Yara Compiler error: " },
                     { "hex.builtin.view.yara.header.matches", "Matches" },
@@ -421,6 +486,7 @@ namespace hex::plugin::builtin {
 
 
                 { "hex.builtin.view.constants.name", "Constants" },
+                    { "hex.builtin.view.constants.loading", "Loading constants" },
                     { "hex.builtin.view.constants.row.category", "Category" },
                     { "hex.builtin.view.constants.row.name", "Name" },
                     { "hex.builtin.view.constants.row.desc", "Description" },
@@ -445,6 +511,7 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.view.store.download_error", "Failed to download file! Destination folder does not exist." },
 
                 { "hex.builtin.view.diff.name", "Diffing" },
+                    { "hex.builtin.view.diff.analyzing", "Analyzing file differences" },
 
                 { "hex.builtin.view.provider_settings.name", "Provider Settings" },
                     { "hex.builtin.view.provider_settings.load_popup", "Open Provider" },
@@ -466,6 +533,7 @@ namespace hex::plugin::builtin {
                         { "hex.builtin.view.find.strings.spaces", "Spaces" },
                         { "hex.builtin.view.find.strings.line_feeds", "Line Feeds" },
                     { "hex.builtin.view.find.sequences", "Sequences" },
+                    { "hex.builtin.view.find.sequences.multi", "Multiple sequences (one per line)" },
                     { "hex.builtin.view.find.regex", "Regex" },
                         { "hex.builtin.view.find.regex.pattern", "Pattern" },
                         { "hex.builtin.view.find.regex.full_match", "Require full match" },
@@ -478,6 +546,9 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.view.find.context.copy_demangle", "Copy Demangled Value" },
                     { "hex.builtin.view.find.search.entries", "{} entries found" },
                     { "hex.builtin.view.find.search.reset", "Reset" },
+                    { "hex.builtin.view.find.search.export.csv", "Export CSV" },
+                    { "hex.builtin.view.find.search.export.json", "Export JSON" },
+                    { "hex.builtin.view.find.exporting", "Exporting results..." },
 
 
                 { "hex.builtin.command.calc.desc", "Calculator" },
@@ -682,6 +753,10 @@ namespace hex::plugin::builtin {
                 { "hex.builtin.tools.demangler", "LLVM Demangler" },
                     { "hex.builtin.tools.demangler.mangled", "Mangled name" },
                     { "hex.builtin.tools.demangler.demangled", "Demangled name" },
+                    { "hex.builtin.tools.demangler.bulk", "Bulk demangling" },
+                    { "hex.builtin.tools.demangler.bulk.input", "Mangled names" },
+                    { "hex.builtin.tools.demangler.bulk.output", "Demangled names" },
+                    { "hex.builtin.tools.demangler.bulk.demangle", "Demangle" },
                 { "hex.builtin.tools.ascii_table", "ASCII table" },
                     { "hex.builtin.tools.ascii_table.octal", "Show octal" },
                 { "hex.builtin.tools.regex_replacer", "Regex replacer" },
@@ -689,6 +764,15 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.tools.regex_replacer.replace", "Replace pattern" },
                     { "hex.builtin.tools.regex_replacer.input", "Input" },
                     { "hex.builtin.tools.regex_replacer.output", "Output" },
+                    { "hex.builtin.tools.regex_replacer.file", "File replacement" },
+                    { "hex.builtin.tools.regex_replacer.file.input", "Input file" },
+                    { "hex.builtin.tools.regex_replacer.file.output", "Output file" },
+                    { "hex.builtin.tools.regex_replacer.file.replace", "Replace" },
+                    { "hex.builtin.tools.regex_replacer.file.replacing", "Replacing..." },
+                    { "hex.builtin.tools.regex_replacer.file.error.open", "Failed to open input file!" },
+                    { "hex.builtin.tools.regex_replacer.file.error.create", "Failed to create output file!" },
+                    { "hex.builtin.tools.regex_replacer.file.error.pattern", "Invalid regex pattern!" },
+                    { "hex.builtin.tools.regex_replacer.file.success", "File replaced successfully!" },
                 { "hex.builtin.tools.color", "Color picker" },
                 { "hex.builtin.tools.calc", "Calculator" },
                     { "hex.builtin.tools.input", "Input" },
@@ -787,6 +871,12 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.setting.general.auto_load_patterns", "Auto-load supported pattern" },
                     { "hex.builtin.setting.general.sync_pattern_source", "Sync pattern source code between providers" },
                     { "hex.builtin.setting.general.enable_unicode", "Load all unicode characters" },
+                    { "hex.builtin.setting.general.concurrent_downloads", "Parallel store downloads" },
+                    { "hex.builtin.setting.general.cache_budget", "Provider cache memory limit" },
+                    { "hex.builtin.setting.general.cache_budget.unlimited", "Unlimited" },
+                    { "hex.builtin.setting.general.undo_budget", "Undo history memory limit" },
+                    { "hex.builtin.setting.general.undo_budget.unlimited", "Unlimited" },
+                    { "hex.builtin.setting.general.pattern_console_lines", "Pattern console line limit" },
                 { "hex.builtin.setting.interface", "Interface" },
                     { "hex.builtin.setting.interface.color", "Color theme" },
                         { "hex.builtin.setting.interface.color.system", "System" },
@@ -814,7 +904,9 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.setting.hex_editor.grey_zeros", "Grey out zeros" },
                     { "hex.builtin.setting.hex_editor.uppercase_hex", "Upper case Hex characters" },
                     { "hex.builtin.setting.hex_editor.visualizer", "Data visualizer" },
+                    { "hex.builtin.setting.hex_editor.minimap", "Display minimap" },
                     { "hex.builtin.setting.hex_editor.sync_scrolling", "Synchronize editor position" },
+                    { "hex.builtin.setting.hex_editor.fast_render", "Fast cell rendering" },
                     { "hex.builtin.setting.hex_editor.byte_padding", "Extra byte cell padding" },
                     { "hex.builtin.setting.hex_editor.char_padding", "Extra character cell padding" },
                 { "hex.builtin.setting.folders", "Folders" },
@@ -846,6 +938,7 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.provider.disk.disk_size", "Disk Size" },
                     { "hex.builtin.provider.disk.sector_size", "Sector Size" },
                     { "hex.builtin.provider.disk.reload", "Reload" },
+                    { "hex.builtin.provider.disk.enumerating", "Detecting drives" },
                 { "hex.builtin.provider.intel_hex", "Intel Hex Provider" },
                     { "hex.builtin.provider.intel_hex.name", "Intel Hex {0}" },
                 { "hex.builtin.provider.motorola_srec", "Motorola SREC Provider" },
@@ -882,11 +975,19 @@ namespace hex::plugin::builtin {
                 { "hex.builtin.hash.crc8", "CRC8" },
                 { "hex.builtin.hash.crc16", "CRC16" },
                 { "hex.builtin.hash.crc32", "CRC32" },
+                { "hex.builtin.hash.tree_xxh64", "XXH64 (Parallel Tree)" },
+                { "hex.builtin.hash.tree_sha256", "SHA256 (Parallel Tree)" },
                     { "hex.builtin.hash.crc.poly", "Polynomial" },
                     { "hex.builtin.hash.crc.iv", "Initial Value" },
                     { "hex.builtin.hash.crc.xor_out", "XOR Out" },
                     { "hex.builtin.hash.crc.refl_in", "Reflect In" },
                     { "hex.builtin.hash.crc.refl_out", "Reflect Out" },
+
+                { "hex.builtin.metric.chi_squared", "Chi-squared" },
+                { "hex.builtin.metric.printable_ratio", "Printable characters" },
+                { "hex.builtin.metric.longest_run", "Longest byte run" },
+                { "hex.builtin.metric.serial_correlation", "Serial correlation" },
+            };
         });
     }
 
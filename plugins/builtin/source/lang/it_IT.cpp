@@ -6,7 +6,8 @@ namespace hex::plugin::builtin {
     void registerLanguageItIT() {
         ContentRegistry::Language::registerLanguage("Italian", "it-IT");
 
-        ContentRegistry::Language::addLocalizations("it-IT", {
+        ContentRegistry::Language::addLocalizations("it-IT", [] {
+            return LanguageDefinition {
                 { "hex.builtin.welcome.header.main", "Benvenuto in ImHex" },
                 { "hex.builtin.welcome.header.start", "Inizia" },
                     { "hex.builtin.welcome.start.create_file", "Crea un nuovo File" },
@@ -294,7 +295,6 @@ namespace hex::plugin::builtin {
 
                 { "hex.builtin.view.hex_editor.name", "Hex editor" },
 
-                    //{ "hex.builtin.view.hex_editor.page", "Page" },
                     //{ "hex.builtin.view.hex_editor.selection", "Selection" },
                         //{ "hex.builtin.view.hex_editor.selection.none", "None" },
                     //{ "hex.builtin.view.hex_editor.region", "Region" },
@@ -891,6 +891,7 @@ namespace hex::plugin::builtin {
                     //{ "hex.builtin.hash.crc.xor_out", "XOR Out" },
                     //{ "hex.builtin.hash.crc.refl_in", "Reflect In" },
                     //{ "hex.builtin.hash.crc.refl_out", "Reflect Out" },
+            };
         });
     }
 
@@ -6,7 +6,8 @@ namespace hex::plugin::builtin {
     void registerLanguageJaJP() {
         ContentRegistry::Language::registerLanguage("Japanese", "ja-JP");
 
-        ContentRegistry::Language::addLocalizations("ja-JP", {
+        ContentRegistry::Language::addLocalizations("ja-JP", [] {
+            return LanguageDefinition {
                 { "hex.builtin.welcome.header.main", "ImHexへようこそ" },
                 { "hex.builtin.welcome.header.start", "はじめる" },
                     { "hex.builtin.welcome.start.create_file", "新規ファイルを作成" },
@@ -294,7 +295,6 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.view.help.calc_cheat_sheet", "計算機チートシート" },
 
                 { "hex.builtin.view.hex_editor.name", "Hexエディタ" },
-                    { "hex.builtin.view.hex_editor.page", "ページ" },
                     { "hex.builtin.view.hex_editor.selection", "選択中" },
                         { "hex.builtin.view.hex_editor.selection.none", "なし" },
                     { "hex.builtin.view.hex_editor.region", "ページの領域" },
@@ -889,6 +889,7 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.hash.crc.xor_out", "最終XOR値" },
                     { "hex.builtin.hash.crc.refl_in", "入力を反映" },
                     { "hex.builtin.hash.crc.refl_out", "出力を反映" },
+            };
         });
     }
 
@@ -6,7 +6,8 @@ namespace hex::plugin::builtin {
     void registerLanguageKoKR() {
         ContentRegistry::Language::registerLanguage("한국어 (KR)", "ko-KR");
 
-        ContentRegistry::Language::addLocalizations("ko-KR", {
+        ContentRegistry::Language::addLocalizations("ko-KR", [] {
+            return LanguageDefinition {
                 { "hex.builtin.welcome.header.main", "Welcome to ImHex" },
                 { "hex.builtin.welcome.header.start", "시작하기" },
                     { "hex.builtin.welcome.start.create_file", "새 파일 생성" },
@@ -293,7 +294,6 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.view.help.calc_cheat_sheet", "치트시트 계산기" },
 
                 { "hex.builtin.view.hex_editor.name", "헥스 편집기" },
-                    { "hex.builtin.view.hex_editor.page", "페이지" },
                     { "hex.builtin.view.hex_editor.selection", "선택 영역" },
                         { "hex.builtin.view.hex_editor.selection.none", "없음" },
                     { "hex.builtin.view.hex_editor.region", "지역" },
@@ -886,6 +886,7 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.hash.crc.xor_out", "XOR Out" },
                     { "hex.builtin.hash.crc.refl_in", "Reflect In" },
                     { "hex.builtin.hash.crc.refl_out", "Reflect Out" },
+            };
         });
     }
 
@@ -6,7 +6,8 @@ namespace hex::plugin::builtin {
     void registerLanguagePtBR() {
         ContentRegistry::Language::registerLanguage("Portuguese (Brazilian)", "pt-BR");
 
-        ContentRegistry::Language::addLocalizations("pt-BR", {
+        ContentRegistry::Language::addLocalizations("pt-BR", [] {
+            return LanguageDefinition {
                 { "hex.builtin.welcome.header.main", "Bem-vindo ao ImHex" },
                 { "hex.builtin.welcome.header.start", "Iniciar" },
                     { "hex.builtin.welcome.start.create_file", "Criar Novo Arquivo" },
@@ -293,7 +294,6 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.view.help.calc_cheat_sheet", "Calculator Cheat Sheet" },
 
                 { "hex.builtin.view.hex_editor.name", "Editor Hex" },
-                    { "hex.builtin.view.hex_editor.page", "Pagina" },
                     { "hex.builtin.view.hex_editor.selection", "Seleção" },
                         { "hex.builtin.view.hex_editor.selection.none", "Nenhum" },
                     { "hex.builtin.view.hex_editor.region", "Região" },
@@ -885,6 +885,7 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.hash.crc.xor_out", "XOR Out" },
                     { "hex.builtin.hash.crc.refl_in", "Reflect In" },
                     { "hex.builtin.hash.crc.refl_out", "Reflect Out" },
+            };
         });
     }
 
@@ -6,7 +6,8 @@ namespace hex::plugin::builtin {
     void registerLanguageZhCN() {
         ContentRegistry::Language::registerLanguage("Chinese (Simplified)", "zh-CN");
 
-        ContentRegistry::Language::addLocalizations("zh-CN", {
+        ContentRegistry::Language::addLocalizations("zh-CN", [] {
+            return LanguageDefinition {
                 { "hex.builtin.welcome.header.main", "欢迎来到 ImHex" },
                 { "hex.builtin.welcome.header.start", "开始" },
                     { "hex.builtin.welcome.start.create_file", "创建新文件" },
@@ -294,7 +295,6 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.view.help.calc_cheat_sheet", "计算器帮助" },
 
                 { "hex.builtin.view.hex_editor.name", "Hex 编辑器" },
-                    { "hex.builtin.view.hex_editor.page", "分页" },
                     { "hex.builtin.view.hex_editor.selection", "选区" },
                         { "hex.builtin.view.hex_editor.selection.none", "未选中" },
                     { "hex.builtin.view.hex_editor.region", "范围" },
@@ -887,6 +887,7 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.hash.crc.xor_out", "结果异或值" },
                     { "hex.builtin.hash.crc.refl_in", "输入值取反" },
                     { "hex.builtin.hash.crc.refl_out", "输出值取反" },
+            };
         });
     }
 
@@ -6,7 +6,8 @@ namespace hex::plugin::builtin {
     void registerLanguageZhTW() {
         ContentRegistry::Language::registerLanguage("Chinese (Traditional)", "zh-TW");
 
-        ContentRegistry::Language::addLocalizations("zh-TW", {
+        ContentRegistry::Language::addLocalizations("zh-TW", [] {
+            return LanguageDefinition {
                 { "hex.builtin.welcome.header.main", "歡迎使用 ImHex" },
                 { "hex.builtin.welcome.header.start", "開始" },
                     { "hex.builtin.welcome.start.create_file", "建立新檔案" },
@@ -293,7 +294,6 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.view.help.calc_cheat_sheet", "計算機小抄" },
 
                 { "hex.builtin.view.hex_editor.name", "十六進位編輯器" },
-                    { "hex.builtin.view.hex_editor.page", "頁面" },
                     { "hex.builtin.view.hex_editor.selection", "選取" },
                         { "hex.builtin.view.hex_editor.selection.none", "無" },
                     { "hex.builtin.view.hex_editor.region", "區域" },
@@ -885,6 +885,7 @@ namespace hex::plugin::builtin {
                     { "hex.builtin.hash.crc.xor_out", "XOR Out" },
                     { "hex.builtin.hash.crc.refl_in", "Reflect In" },
                     { "hex.builtin.hash.crc.refl_out", "Reflect Out" },
+            };
         });
     }
 
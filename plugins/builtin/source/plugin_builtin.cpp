@@ -1,5 +1,7 @@
 #include <hex/plugin.hpp>
 
+#include <hex/api/plugin_manager.hpp>
+
 namespace hex::plugin::builtin {
 
     void registerEventHandlers();
@@ -13,6 +15,7 @@ namespace hex::plugin::builtin {
     void loadSettings();
     void registerDataProcessorNodes();
     void registerHashes();
+    void registerDataMetrics();
     void registerProviders();
     void registerDataFormatters();
     void registerLayouts();
@@ -41,14 +44,18 @@ IMHEX_PLUGIN_SETUP("Built-in", "WerWolv", "Default ImHex functionality") {
 
     using namespace hex::plugin::builtin;
 
+    // The fallback language has to exist from the start; the others only need to
+    // be registered by the time the user can reach the language setting
     registerLanguageEnUS();
-    registerLanguageDeDE();
-    registerLanguageItIT();
-    registerLanguageJaJP();
-    registerLanguageZhCN();
-    registerLanguagePtBR();
-    registerLanguageZhTW();
-    registerLanguageKoKR();
+    hex::PluginManager::addDeferredInitialization([] {
+        registerLanguageDeDE();
+        registerLanguageItIT();
+        registerLanguageJaJP();
+        registerLanguageZhCN();
+        registerLanguagePtBR();
+        registerLanguageZhTW();
+        registerLanguageKoKR();
+    });
 
     registerEventHandlers();
     registerDataVisualizers();
@@ -61,6 +68,7 @@ IMHEX_PLUGIN_SETUP("Built-in", "WerWolv", "Default ImHex functionality") {
     loadSettings();
     registerDataProcessorNodes();
     registerHashes();
+    registerDataMetrics();
     registerProviders();
     registerDataFormatters();
     createWelcomeScreen();
@@ -4,7 +4,9 @@
 
 #include <windows.h>
 
+#include <deque>
 #include <mutex>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -38,9 +40,14 @@ namespace hex::plugin::windows {
 
         bool m_shouldAutoScroll = true;
 
+        // Fixed-capacity line ring; once full, the oldest lines fall out so
+        // hour-long captures from chatty targets can't grow memory unbounded
+        constexpr static size_t MaxConsoleLines = 0x2'0000;
+
         std::mutex m_receiveBufferMutex;
-        std::vector<char> m_receiveDataBuffer, m_transmitDataBuffer;
-        std::vector<u32> m_wrapPositions;
+        std::deque<std::string> m_receiveLines;
+        std::string m_incompleteLine;
+        std::vector<char> m_transmitDataBuffer;
         bool m_transmitting = false;
 
         constexpr static std::array BaudRates = {
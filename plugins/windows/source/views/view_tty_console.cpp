@@ -9,8 +9,6 @@ namespace hex::plugin::windows {
     ViewTTYConsole::ViewTTYConsole() : View("hex.windows.view.tty_console.name") {
         this->m_comPorts = getAvailablePorts();
         this->m_transmitDataBuffer.resize(0xFFF, 0x00);
-        this->m_receiveDataBuffer.reserve(0xFFF);
-        this->m_receiveDataBuffer.push_back(0x00);
     }
 
     void ViewTTYConsole::drawContent() {
@@ -96,8 +94,8 @@ namespace hex::plugin::windows {
             if (ImGui::Button("hex.windows.view.tty_console.clear"_lang)) {
                 std::scoped_lock lock(this->m_receiveBufferMutex);
 
-                this->m_receiveDataBuffer.clear();
-                this->m_wrapPositions.clear();
+                this->m_receiveLines.clear();
+                this->m_incompleteLine.clear();
             }
 
             ImGui::SameLine();
@@ -111,21 +109,21 @@ namespace hex::plugin::windows {
             auto consoleSize = ImGui::GetContentRegionAvail();
             consoleSize.y -= ImGui::GetTextLineHeight() + ImGui::GetStyle().FramePadding.y * 4;
             if (ImGui::BeginChild("##scrolling", consoleSize, true, ImGuiWindowFlags_HorizontalScrollbar)) {
+                std::scoped_lock lock(this->m_receiveBufferMutex);
+
+                const size_t lineCount = this->m_receiveLines.size() + (this->m_incompleteLine.empty() ? 0 : 1);
+
                 ImGuiListClipper clipper;
-                clipper.Begin(this->m_wrapPositions.size(), ImGui::GetTextLineHeight());
+                clipper.Begin(lineCount, ImGui::GetTextLineHeight());
 
                 ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(4, 1));
                 while (clipper.Step()) {
-                    std::scoped_lock lock(this->m_receiveBufferMutex);
+                    for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+                        const auto &line = static_cast<size_t>(i) < this->m_receiveLines.size() ? this->m_receiveLines[i] : this->m_incompleteLine;
 
-                    for (int i = clipper.DisplayStart + 1; i < clipper.DisplayEnd; i++) {
-                        ImGui::TextUnformatted(this->m_receiveDataBuffer.data() + this->m_wrapPositions[i - 1], this->m_receiveDataBuffer.data() + this->m_wrapPositions[i]);
+                        ImGui::TextUnformatted(line.data(), line.data() + line.size());
                     }
 
-                    if (!this->m_receiveDataBuffer.empty() && !this->m_wrapPositions.empty())
-                        if (static_cast<size_t>(clipper.DisplayEnd) >= this->m_wrapPositions.size() - 1)
-                            ImGui::TextUnformatted(this->m_receiveDataBuffer.data() + this->m_wrapPositions.back());
-
                     if (this->m_shouldAutoScroll && ImGui::GetScrollY() >= ImGui::GetScrollMaxY()) {
                         ImGui::SetScrollHereY(0.0F);
                     }
@@ -222,10 +220,13 @@ namespace hex::plugin::windows {
         if (!::SetCommState(this->m_portHandle, &serialParams))
             return false;
 
+        // Reads complete as soon as the line goes quiet for a moment, the buffer
+        // fills up or half a second passes, whichever comes first. That batches a
+        // fast sender's bytes into large chunks instead of one read per byte
         COMMTIMEOUTS timeouts;
-        timeouts.ReadIntervalTimeout         = 500;
+        timeouts.ReadIntervalTimeout         = 1;
         timeouts.ReadTotalTimeoutConstant    = 500;
-        timeouts.ReadTotalTimeoutMultiplier  = 100;
+        timeouts.ReadTotalTimeoutMultiplier  = 0;
         timeouts.WriteTotalTimeoutConstant   = 500;
         timeouts.WriteTotalTimeoutMultiplier = 100;
 
@@ -239,44 +240,58 @@ namespace hex::plugin::windows {
             OVERLAPPED overlapped = { };
 
             overlapped.hEvent = ::CreateEvent(nullptr, true, false, nullptr);
-            ON_SCOPE_EXIT { ::CloseHandle(&overlapped); };
+            ON_SCOPE_EXIT { ::CloseHandle(overlapped.hEvent); };
 
-            auto addByte = [this](char byte) {
-                std::scoped_lock lock(this->m_receiveBufferMutex);
+            std::vector<char> readBuffer(0x1000);
+
+            // Splitting a chunk into lines happens right here on the receive
+            // thread; the buffer lock is only taken once per chunk to splice the
+            // finished lines in, so the UI never contends with the parsing
+            auto processBytes = [this, pendingLine = std::string()](const char *data, size_t size) mutable {
+                std::vector<std::string> completedLines;
 
-                if (byte >= 0x20 && byte <= 0x7E) {
-                    this->m_receiveDataBuffer.back() = byte;
-                    this->m_receiveDataBuffer.push_back(0x00);
-                } else if (byte == '\n' || byte == '\r') {
-                    if (this->m_receiveDataBuffer.empty())
-                        return;
+                for (size_t i = 0; i < size; i++) {
+                    const char byte = data[i];
 
-                    u32 wrapPos = this->m_receiveDataBuffer.size() - 1;
+                    if (byte >= 0x20 && byte <= 0x7E) {
+                        pendingLine.push_back(byte);
+                    } else if (byte == '\n' || byte == '\r') {
+                        if (pendingLine.empty())
+                            continue;
 
-                    if (this->m_wrapPositions.empty() || this->m_wrapPositions.back() != wrapPos)
-                        this->m_wrapPositions.push_back(wrapPos);
+                        completedLines.push_back(std::move(pendingLine));
+                        pendingLine.clear();
+                    }
                 }
+
+                std::scoped_lock lock(this->m_receiveBufferMutex);
+
+                for (auto &line : completedLines)
+                    this->m_receiveLines.push_back(std::move(line));
+
+                while (this->m_receiveLines.size() > MaxConsoleLines)
+                    this->m_receiveLines.pop_front();
+
+                this->m_incompleteLine = pendingLine;
             };
 
             while (!token.stop_requested()) {
                 DWORD bytesRead = 0;
 
-                char byte = 0;
                 if (!waitingOnRead) {
-                    if (::ReadFile(this->m_portHandle, &byte, sizeof(char), &bytesRead, &overlapped)) {
-                        addByte(byte);
+                    if (::ReadFile(this->m_portHandle, readBuffer.data(), readBuffer.size(), &bytesRead, &overlapped)) {
+                        processBytes(readBuffer.data(), bytesRead);
                     } else if (::GetLastError() == ERROR_IO_PENDING) {
                         waitingOnRead = true;
                     }
                 } else {
-                    byte     = 0;
                     auto res = ::WaitForSingleObject(overlapped.hEvent, 500);
                     switch (res) {
                         case WAIT_OBJECT_0:
-                            if (::GetOverlappedResult(this->m_portHandle, &overlapped, &bytesRead, false)) {
-                                addByte(byte);
-                                waitingOnRead = false;
-                            }
+                            if (::GetOverlappedResult(this->m_portHandle, &overlapped, &bytesRead, false))
+                                processBytes(readBuffer.data(), bytesRead);
+
+                            waitingOnRead = false;
                         default:
                             break;
                     }
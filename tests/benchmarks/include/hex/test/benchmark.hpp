@@ -0,0 +1,81 @@
+#pragma once
+
+#include <hex.hpp>
+
+#include <hex/helpers/logger.hpp>
+
+#include <chrono>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(OS_LINUX)
+    #include <sched.h>
+#endif
+
+namespace hex::test {
+
+    /// Keeps a computed value alive so the optimizer can't delete the measured loop
+    template<typename T>
+    void doNotOptimize(const T &value) {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    /// Deterministically filled test data so runs stay comparable across builds
+    inline std::vector<u8> randomData(size_t size) {
+        std::vector<u8> data(size);
+
+        std::mt19937 gen(0xDEAD'BEEF);
+        std::uniform_int_distribution<u8> dist;
+        for (auto &byte : data)
+            byte = dist(gen);
+
+        return data;
+    }
+
+    /**
+     * @brief Runs a function repeatedly and reports its ns/op and GB/s rates
+     *
+     * The calling thread is pinned to one core so the timings don't wander
+     * across the topology, the function is warmed up until caches and the
+     * frequency governor settle and the measured batch runs long enough that
+     * timer resolution stops mattering. bytesPerOp sizes the GB/s figure;
+     * pass 0 for kernels where a byte rate is meaningless
+     */
+    inline void benchmark(const std::string &name, u64 bytesPerOp, const std::function<void()> &function) {
+        #if defined(OS_LINUX)
+            cpu_set_t cpuSet;
+            CPU_ZERO(&cpuSet);
+            CPU_SET(0, &cpuSet);
+            sched_setaffinity(0, sizeof(cpuSet), &cpuSet);
+        #endif
+
+        using Clock = std::chrono::steady_clock;
+
+        constexpr static auto WarmupTime  = std::chrono::milliseconds(100);
+        constexpr static auto MeasureTime = std::chrono::milliseconds(500);
+
+        for (auto warmupStart = Clock::now(); (Clock::now() - warmupStart) < WarmupTime;)
+            function();
+
+        u64 iterations = 0;
+        const auto start = Clock::now();
+        Clock::duration elapsed = {};
+        do {
+            function();
+            iterations++;
+
+            elapsed = Clock::now() - start;
+        } while (elapsed < MeasureTime);
+
+        const auto nanoseconds = std::chrono::duration<double, std::nano>(elapsed).count();
+        const auto nsPerOp     = nanoseconds / double(iterations);
+
+        if (bytesPerOp == 0)
+            hex::log::info("{}: {:.1f} ns/op", name, nsPerOp);
+        else
+            hex::log::info("{}: {:.1f} ns/op, {:.3f} GB/s", name, nsPerOp, double(bytesPerOp) / nsPerOp);
+    }
+
+}
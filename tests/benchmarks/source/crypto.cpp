@@ -0,0 +1,38 @@
+#include <hex/helpers/crypto.hpp>
+#include <hex/test/benchmark.hpp>
+#include <hex/test/test_provider.hpp>
+#include <hex/test/tests.hpp>
+
+using namespace hex;
+
+TEST_SEQUENCE("Crc32Throughput") {
+    auto data = test::randomData(0x100'0000);
+    test::TestProvider testProvider(&data);
+    prv::Provider *provider = &testProvider;
+
+    test::benchmark("crc32", data.size(), [&] {
+        test::doNotOptimize(crypt::crc32(provider, 0, data.size(), 0x04C1'1DB7, 0xFFFF'FFFF, 0xFFFF'FFFF, true, true));
+    });
+
+    TEST_SUCCESS();
+};
+
+TEST_SEQUENCE("Md5Throughput") {
+    auto data = test::randomData(0x100'0000);
+
+    test::benchmark("md5", data.size(), [&] {
+        test::doNotOptimize(crypt::md5(data));
+    });
+
+    TEST_SUCCESS();
+};
+
+TEST_SEQUENCE("Sha256Throughput") {
+    auto data = test::randomData(0x100'0000);
+
+    test::benchmark("sha256", data.size(), [&] {
+        test::doNotOptimize(crypt::sha256(data));
+    });
+
+    TEST_SUCCESS();
+};
@@ -0,0 +1,23 @@
+#include <hex/helpers/utils.hpp>
+#include <hex/test/benchmark.hpp>
+#include <hex/test/tests.hpp>
+
+#include <vector>
+
+using namespace hex;
+
+TEST_SEQUENCE("EndianSwapThroughput") {
+    std::vector<u64> values(0x20'0000);
+    for (size_t i = 0; i < values.size(); i++)
+        values[i] = i * 0x9E37'79B9'7F4A'7C15;
+
+    test::benchmark("changeEndianess<u64>", values.size() * sizeof(u64), [&] {
+        u64 sum = 0;
+        for (const auto value : values)
+            sum += hex::changeEndianess(value, std::endian::big);
+
+        test::doNotOptimize(sum);
+    });
+
+    TEST_SUCCESS();
+};
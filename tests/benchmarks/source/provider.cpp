@@ -0,0 +1,62 @@
+#include <hex/providers/buffered_reader.hpp>
+#include <hex/test/benchmark.hpp>
+#include <hex/test/test_provider.hpp>
+#include <hex/test/tests.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace hex;
+
+TEST_SEQUENCE("ProviderReadPatched") {
+    auto data = test::randomData(0x100'0000);
+    test::TestProvider provider(&data);
+
+    // Sprinkle patches and overlays across the range so read() runs the full
+    // merge path instead of the plain passthrough
+    std::mt19937 gen(0xBE9C);
+    std::uniform_int_distribution<u64> offsetDist(0, data.size() - 0x200);
+
+    for (u32 i = 0; i < 0x100; i++) {
+        const u8 patchByte = u8(i);
+        provider.addPatch(offsetDist(gen), &patchByte, sizeof(patchByte));
+    }
+
+    for (u32 i = 0; i < 0x10; i++) {
+        auto overlay = provider.newOverlay();
+        overlay->setAddress(offsetDist(gen));
+        overlay->getData().assign(0x100, u8(i));
+    }
+
+    constexpr static size_t ReadSize = 0x1000;
+    std::vector<u8> buffer(ReadSize);
+    u64 address = 0;
+
+    test::benchmark("Provider::read through patches and overlays", ReadSize, [&] {
+        provider.read(address, buffer.data(), buffer.size());
+        test::doNotOptimize(buffer);
+
+        address += ReadSize;
+        if ((address + ReadSize) > data.size())
+            address = 0;
+    });
+
+    TEST_SUCCESS();
+};
+
+TEST_SEQUENCE("BufferedReaderIteration") {
+    auto data = test::randomData(0x100'0000);
+    test::TestProvider provider(&data);
+
+    test::benchmark("BufferedReader byte iteration", data.size(), [&] {
+        prv::BufferedReader reader(&provider);
+
+        u64 sum = 0;
+        for (u8 byte : reader)
+            sum += byte;
+
+        test::doNotOptimize(sum);
+    });
+
+    TEST_SUCCESS();
+};
@@ -0,0 +1,74 @@
+#include <hex/test/benchmark.hpp>
+#include <hex/test/tests.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstring>
+
+using namespace hex;
+
+/* ViewFind's scan kernels live in the builtin plugin and can't be linked from
+   here, so the two inner loops are reproduced in place: the memchr/memcmp
+   sequence scan and the table-driven string classification */
+
+TEST_SEQUENCE("SequenceSearchKernel") {
+    auto data = test::randomData(0x100'0000);
+
+    constexpr static std::array<u8, 4> Needle = { 0xDE, 0xAD, 0xBE, 0xEF };
+    std::copy(Needle.begin(), Needle.end(), data.end() - Needle.size());
+
+    test::benchmark("Sequence search (memchr/memcmp)", data.size(), [&] {
+        u32 occurrences = 0;
+
+        const u8 *candidate     = data.data();
+        const u8 *const scanEnd = data.data() + (data.size() - Needle.size()) + 1;
+        while (candidate < scanEnd) {
+            candidate = static_cast<const u8 *>(std::memchr(candidate, Needle[0], scanEnd - candidate));
+            if (candidate == nullptr)
+                break;
+
+            if (std::memcmp(candidate, Needle.data(), Needle.size()) == 0)
+                occurrences++;
+
+            candidate++;
+        }
+
+        test::doNotOptimize(occurrences);
+    });
+
+    TEST_SUCCESS();
+};
+
+TEST_SEQUENCE("StringSearchKernel") {
+    auto data = test::randomData(0x100'0000);
+
+    // The same per-byte classification table ViewFind::searchStrings builds
+    // for its default ASCII settings
+    std::array<bool, 256> validCharTable = {};
+    for (u32 byte = 0; byte < validCharTable.size(); byte++)
+        validCharTable[byte] =
+            std::islower(byte) || std::isupper(byte) || std::isdigit(byte) ||
+            std::isspace(byte) || std::ispunct(byte) || byte == '_';
+
+    constexpr static size_t MinLength = 4;
+
+    test::benchmark("String search (char table)", data.size(), [&] {
+        u32 occurrences  = 0;
+        size_t runLength = 0;
+
+        for (const u8 byte : data) {
+            if (validCharTable[byte]) {
+                runLength++;
+            } else {
+                if (runLength >= MinLength)
+                    occurrences++;
+                runLength = 0;
+            }
+        }
+
+        test::doNotOptimize(occurrences);
+    });
+
+    TEST_SUCCESS();
+};
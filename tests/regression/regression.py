@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+"""
+End-to-end performance regression harness for ImHex.
+
+Generates a deterministic synthetic corpus (sparse, random, text-heavy and
+repetitive files), runs scripted operations against each file through the
+headless mode (`imhex --headless <jobfile>`) and compares the reported
+per-job wall times against recorded baselines.
+
+Typical use:
+
+    # Record baselines on a known-good build
+    ./regression.py --imhex /path/to/imhex --record
+
+    # Gate a change: fails loudly when a path got >10% slower
+    ./regression.py --imhex /path/to/imhex
+
+The corpus is generated from fixed seeds, so timings stay comparable across
+runs and machines only need their own recorded baselines. File size defaults
+to 100 MB; pass e.g. --size 1GB or --size 10GB for the larger configurations.
+"""
+
+import argparse
+import json
+import random
+import statistics
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+
+CORPUS_SEED = 0x1DEC0DE
+
+# Operations timed per corpus file. "open" doubles as the
+# open-file-to-interactive measurement since headless opening runs the same
+# provider setup the UI waits on.
+OPERATIONS = [
+    {"action": "open"},
+    {"action": "hash", "algorithm": "sha256"},
+    {"action": "find", "pattern": "DE AD BE EF", "limit": 1000},
+    {"action": "entropy", "blockSize": 65536},
+]
+
+
+def parse_size(text):
+    units = {"KB": 1000 ** 1, "MB": 1000 ** 2, "GB": 1000 ** 3,
+             "KIB": 1024 ** 1, "MIB": 1024 ** 2, "GIB": 1024 ** 3}
+    text = text.strip().upper()
+    for unit, factor in sorted(units.items(), key=lambda u: -len(u[0])):
+        if text.endswith(unit):
+            return int(float(text[: -len(unit)]) * factor)
+    return int(text)
+
+
+def generate_sparse(path, size, rng):
+    # Mostly holes with small seeded data islands, the way disk images look
+    with open(path, "wb") as f:
+        f.truncate(size)
+        island = 4096
+        stride = max(size // 256, island)
+        offset = 0
+        while offset + island <= size:
+            f.seek(offset)
+            f.write(rng.randbytes(island))
+            offset += stride
+
+
+def generate_random(path, size, rng):
+    with open(path, "wb") as f:
+        remaining = size
+        while remaining > 0:
+            chunk = min(remaining, 16 * 1024 * 1024)
+            f.write(rng.randbytes(chunk))
+            remaining -= chunk
+
+
+def generate_text(path, size, rng):
+    words = ["firmware", "header", "segment", "offset", "checksum", "vector",
+             "padding", "entry", "table", "region", "import", "export"]
+    line = (" ".join(rng.choices(words, k=12)) + "\n").encode()
+    block = line * (65536 // len(line) + 1)
+    with open(path, "wb") as f:
+        remaining = size
+        while remaining > 0:
+            chunk = block[: min(remaining, len(block))]
+            f.write(chunk)
+            remaining -= len(chunk)
+
+
+def generate_repetitive(path, size, rng):
+    pattern = rng.randbytes(4096)
+    block = pattern * 256
+    with open(path, "wb") as f:
+        remaining = size
+        while remaining > 0:
+            chunk = block[: min(remaining, len(block))]
+            f.write(chunk)
+            remaining -= len(chunk)
+
+
+GENERATORS = {
+    "sparse": generate_sparse,
+    "random": generate_random,
+    "text": generate_text,
+    "repetitive": generate_repetitive,
+}
+
+
+def ensure_corpus(corpus_dir, size):
+    corpus_dir.mkdir(parents=True, exist_ok=True)
+    paths = {}
+    for name, generator in GENERATORS.items():
+        path = corpus_dir / f"{name}_{size}.bin"
+        if not path.exists() or path.stat().st_size != size:
+            print(f"generating {path} ...")
+            generator(path, size, random.Random((CORPUS_SEED, name)))
+        paths[name] = path
+    return paths
+
+
+def run_jobs(imhex, corpus_path):
+    """Runs the scripted operations once, returns {action: duration_us}."""
+    with tempfile.TemporaryDirectory() as tmp:
+        output = Path(tmp) / "results.json"
+        jobfile = Path(tmp) / "jobs.json"
+        jobs = [dict(OPERATIONS[0], path=str(corpus_path))] + OPERATIONS[1:]
+        jobfile.write_text(json.dumps({"jobs": jobs, "output": str(output)}))
+
+        result = subprocess.run([imhex, "--headless", str(jobfile)],
+                                stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+        if result.returncode != 0:
+            sys.exit(f"imhex failed on {corpus_path}:\n{result.stderr.decode(errors='replace')}")
+
+        durations = {}
+        for job in json.loads(output.read_text()):
+            if not job["success"]:
+                sys.exit(f"job '{job['action']}' failed on {corpus_path}: {job.get('error')}")
+            durations[job["action"]] = job["durationUs"]
+        return durations
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--imhex", default="imhex", help="path to the imhex executable")
+    parser.add_argument("--corpus-dir", default=Path(__file__).parent / "corpus", type=Path)
+    parser.add_argument("--baselines", default=Path(__file__).parent / "baselines.json", type=Path)
+    parser.add_argument("--size", default="100MB", help="corpus file size (100MB-10GB)")
+    parser.add_argument("--runs", default=3, type=int, help="runs per operation, the median is used")
+    parser.add_argument("--tolerance", default=0.10, type=float, help="allowed slowdown before failing")
+    parser.add_argument("--record", action="store_true", help="record the measured times as the new baselines")
+    args = parser.parse_args()
+
+    size = parse_size(args.size)
+    corpus = ensure_corpus(args.corpus_dir, size)
+
+    measured = {}
+    for name, path in corpus.items():
+        samples = [run_jobs(args.imhex, path) for _ in range(args.runs)]
+        for action in samples[0]:
+            key = f"{name}:{action}:{size}"
+            measured[key] = statistics.median(run[action] for run in samples)
+            print(f"{key:<40} {measured[key] / 1000:10.1f} ms")
+
+    if args.record:
+        args.baselines.write_text(json.dumps(measured, indent=4) + "\n")
+        print(f"\nrecorded {len(measured)} baselines to {args.baselines}")
+        return 0
+
+    if not args.baselines.exists():
+        sys.exit(f"\nno baselines at {args.baselines}; run once with --record on a known-good build")
+
+    baselines = json.loads(args.baselines.read_text())
+    regressions = []
+    for key, duration in measured.items():
+        baseline = baselines.get(key)
+        if baseline is None:
+            print(f"NOTE: no baseline for {key}, skipping")
+            continue
+
+        ratio = duration / baseline if baseline > 0 else 1.0
+        if ratio > 1.0 + args.tolerance:
+            regressions.append(f"REGRESSION: {key} took {duration / 1000:.1f} ms, "
+                               f"baseline {baseline / 1000:.1f} ms ({(ratio - 1) * 100:+.1f}%)")
+
+    if regressions:
+        print("\n" + "\n".join(regressions))
+        return 1
+
+    print(f"\nall {len(measured)} timings within {args.tolerance * 100:.0f}% of their baselines")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())